@@ -6,10 +6,6 @@ LOCAL_ARM_MODE := arm
 
 audioconvert_LOCAL_SRC_FILES:= \
 	gst/audioconvert/gstaudioconvert.c \
-	gst/audioconvert/audioconvert.c \
-	gst/audioconvert/gstaudioconvertorc-dist.c \
-	gst/audioconvert/gstchannelmix.c \
-	gst/audioconvert/gstaudioquantize.c \
 	gst/audioconvert/plugin.c 
 
 LOCAL_SRC_FILES:= $(addprefix ../,$(audioconvert_LOCAL_SRC_FILES))
@@ -5,9 +5,7 @@ include $(CLEAR_VARS)
 LOCAL_ARM_MODE := arm
 
 videoconvert_LOCAL_SRC_FILES:= \
-	gst/videoconvert/gstvideoconvert.c \
-	gst/videoconvert/gstvideoconvertorc-dist.c \
-	gst/videoconvert/videoconvert.c
+	gst/videoconvert/gstvideoconvert.c
 
 LOCAL_SRC_FILES:= $(addprefix ../,$(videoconvert_LOCAL_SRC_FILES))
 
@@ -57,6 +57,7 @@
 #define DEFAULT_DEVICE		"default"
 #define DEFAULT_DEVICE_NAME	""
 #define DEFAULT_CARD_NAME	""
+#define DEFAULT_USE_MMAP	FALSE
 #define SPDIF_PERIOD_SIZE 1536
 #define SPDIF_BUFFER_SIZE 15360
 
@@ -66,6 +67,7 @@ enum
   PROP_DEVICE,
   PROP_DEVICE_NAME,
   PROP_CARD_NAME,
+  PROP_USE_MMAP,
   PROP_LAST
 };
 
@@ -194,6 +196,20 @@ gst_alsasink_class_init (GstAlsaSinkClass * klass)
       g_param_spec_string ("card-name", "Card name",
           "Human-readable name of the sound card", DEFAULT_CARD_NAME,
           G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAlsaSink:use-mmap:
+   *
+   * Write the samples directly into the mmapped hardware buffer instead of
+   * passing them to snd_pcm_writei(). Falls back to read/write access when
+   * the device does not support mmap.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_USE_MMAP,
+      g_param_spec_boolean ("use-mmap", "Use mmap",
+          "Write directly into the mmapped hardware buffer", DEFAULT_USE_MMAP,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 }
 
 static void
@@ -213,6 +229,9 @@ gst_alsasink_set_property (GObject * object, guint prop_id,
         sink->device = g_strdup (DEFAULT_DEVICE);
       }
       break;
+    case PROP_USE_MMAP:
+      sink->use_mmap = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -241,6 +260,9 @@ gst_alsasink_get_property (GObject * object, guint prop_id,
           gst_alsa_find_card_name (GST_OBJECT_CAST (sink),
               sink->device, SND_PCM_STREAM_PLAYBACK));
       break;
+    case PROP_USE_MMAP:
+      g_value_set_boolean (value, sink->use_mmap);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -255,6 +277,7 @@ gst_alsasink_init (GstAlsaSink * alsasink)
   alsasink->device = g_strdup (DEFAULT_DEVICE);
   alsasink->handle = NULL;
   alsasink->cached_caps = NULL;
+  alsasink->use_mmap = DEFAULT_USE_MMAP;
   g_mutex_init (&alsasink->alsa_lock);
   g_mutex_init (&alsasink->delay_lock);
 
@@ -430,6 +453,11 @@ retry:
   /* choose all parameters */
   CHECK (snd_pcm_hw_params_any (alsa->handle, params), no_config);
   /* set the interleaved read/write format */
+  if (alsa->access == SND_PCM_ACCESS_MMAP_INTERLEAVED &&
+      snd_pcm_hw_params_set_access (alsa->handle, params, alsa->access) < 0) {
+    GST_INFO_OBJECT (alsa, "mmap access not available, using read/write");
+    alsa->access = SND_PCM_ACCESS_RW_INTERLEAVED;
+  }
   CHECK (snd_pcm_hw_params_set_access (alsa->handle, params, alsa->access),
       wrong_access);
   /* set the sample format */
@@ -805,7 +833,8 @@ alsasink_parse_spec (GstAlsaSink * alsa, GstAudioRingBufferSpec * spec)
   alsa->channels = GST_AUDIO_INFO_CHANNELS (&spec->info);
   alsa->buffer_time = spec->buffer_time;
   alsa->period_time = spec->latency_time;
-  alsa->access = SND_PCM_ACCESS_RW_INTERLEAVED;
+  alsa->access = alsa->use_mmap ? SND_PCM_ACCESS_MMAP_INTERLEAVED :
+      SND_PCM_ACCESS_RW_INTERLEAVED;
 
   if (spec->type == GST_AUDIO_RING_BUFFER_FORMAT_TYPE_RAW && alsa->channels < 9)
     gst_audio_ring_buffer_set_channel_positions (GST_AUDIO_BASE_SINK
@@ -984,22 +1013,68 @@ xrun_recovery (GstAlsaSink * alsa, snd_pcm_t * handle, gint err)
   return err;
 }
 
+/* Copies up to @cptr frames from @ptr into the mmapped hardware buffer.
+ * Returns the number of frames written or a negative error code like
+ * snd_pcm_writei(). */
+static snd_pcm_sframes_t
+gst_alsasink_write_mmap (GstAlsaSink * alsa, const guint8 * ptr,
+    snd_pcm_uframes_t cptr)
+{
+  const snd_pcm_channel_area_t *areas;
+  snd_pcm_uframes_t offset, frames;
+  snd_pcm_sframes_t avail, err;
+  guint8 *dest;
+
+  avail = snd_pcm_avail_update (alsa->handle);
+  if (avail < 0)
+    return avail;
+  if (avail == 0)
+    return -EAGAIN;
+
+  /* this can give less frames when the area wraps around */
+  frames = MIN ((snd_pcm_uframes_t) avail, cptr);
+  if ((err = snd_pcm_mmap_begin (alsa->handle, &areas, &offset, &frames)) < 0)
+    return err;
+
+  /* interleaved access, all channels are in the first area */
+  dest = (guint8 *) areas[0].addr +
+      (areas[0].first + offset * areas[0].step) / 8;
+  memcpy (dest, ptr, frames * alsa->bpf);
+
+  if ((err = snd_pcm_mmap_commit (alsa->handle, offset, frames)) < 0)
+    return err;
+
+  /* unlike snd_pcm_writei(), committing does not start the device when the
+   * start threshold is reached */
+  if (snd_pcm_state (alsa->handle) == SND_PCM_STATE_PREPARED) {
+    avail = snd_pcm_avail_update (alsa->handle);
+    if (avail >= 0 && alsa->buffer_size - avail >=
+        (alsa->buffer_size / alsa->period_size) * alsa->period_size) {
+      GST_DEBUG_OBJECT (alsa, "starting");
+      snd_pcm_start (alsa->handle);
+    }
+  }
+
+  return err;
+}
+
 static gint
 gst_alsasink_write (GstAudioSink * asink, gpointer data, guint length)
 {
   GstAlsaSink *alsa;
   gint err;
   gint cptr;
-  gint16 *ptr = data;
+  guint8 *ptr = data;
 
   alsa = GST_ALSA_SINK (asink);
 
   if (alsa->iec958 && alsa->need_swap) {
+    gint16 *samples = data;
     guint i;
 
     GST_DEBUG_OBJECT (asink, "swapping bytes");
     for (i = 0; i < length / 2; i++) {
-      ptr[i] = GUINT16_SWAP_LE_BE (ptr[i]);
+      samples[i] = GUINT16_SWAP_LE_BE (samples[i]);
     }
   }
 
@@ -1016,7 +1091,10 @@ gst_alsasink_write (GstAudioSink * asink, gpointer data, guint length)
       GST_DEBUG_OBJECT (asink, "wait error, %d", err);
     } else {
       GST_DELAY_SINK_LOCK (asink);
-      err = snd_pcm_writei (alsa->handle, ptr, cptr);
+      if (alsa->access == SND_PCM_ACCESS_MMAP_INTERLEAVED)
+        err = gst_alsasink_write_mmap (alsa, ptr, cptr);
+      else
+        err = snd_pcm_writei (alsa->handle, ptr, cptr);
       GST_DELAY_SINK_UNLOCK (asink);
     }
 
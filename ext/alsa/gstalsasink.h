@@ -74,6 +74,8 @@ struct _GstAlsaSink {
   snd_pcm_uframes_t buffer_size;
   snd_pcm_uframes_t period_size;
 
+  gboolean use_mmap;
+
   GstCaps *cached_caps;
 
   GMutex alsa_lock;
@@ -54,6 +54,7 @@
 #define DEFAULT_PROP_DEVICE		"default"
 #define DEFAULT_PROP_DEVICE_NAME	""
 #define DEFAULT_PROP_CARD_NAME	        ""
+#define DEFAULT_PROP_USE_MMAP		FALSE
 
 enum
 {
@@ -61,6 +62,7 @@ enum
   PROP_DEVICE,
   PROP_DEVICE_NAME,
   PROP_CARD_NAME,
+  PROP_USE_MMAP,
   PROP_LAST
 };
 
@@ -114,6 +116,8 @@ gst_alsasrc_finalize (GObject * object)
   GstAlsaSrc *src = GST_ALSA_SRC (object);
 
   g_free (src->device);
+  if (src->ts_clock)
+    gst_object_unref (src->ts_clock);
   g_mutex_clear (&src->alsa_lock);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
@@ -168,6 +172,20 @@ gst_alsasrc_class_init (GstAlsaSrcClass * klass)
       g_param_spec_string ("card-name", "Card name",
           "Human-readable name of the sound card",
           DEFAULT_PROP_CARD_NAME, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAlsaSrc:use-mmap:
+   *
+   * Read the samples directly from the mmapped hardware buffer instead of
+   * with snd_pcm_readi(). Falls back to read/write access when the device
+   * does not support mmap.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_USE_MMAP,
+      g_param_spec_boolean ("use-mmap", "Use mmap",
+          "Read directly from the mmapped hardware buffer",
+          DEFAULT_PROP_USE_MMAP, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 }
 
 static void
@@ -186,6 +204,9 @@ gst_alsasrc_set_property (GObject * object, guint prop_id,
         src->device = g_strdup (DEFAULT_PROP_DEVICE);
       }
       break;
+    case PROP_USE_MMAP:
+      src->use_mmap = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -214,6 +235,9 @@ gst_alsasrc_get_property (GObject * object, guint prop_id,
           gst_alsa_find_card_name (GST_OBJECT_CAST (src),
               src->device, SND_PCM_STREAM_CAPTURE));
       break;
+    case PROP_USE_MMAP:
+      g_value_set_boolean (value, src->use_mmap);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -238,6 +262,9 @@ gst_alsasrc_change_state (GstElement * element, GstStateChange transition)
 
     case GST_STATE_CHANGE_PAUSED_TO_PLAYING:
       alsa->driver_timestamps = FALSE;
+      GST_OBJECT_LOCK (alsa);
+      gst_object_replace ((GstObject **) & alsa->ts_clock, NULL);
+      GST_OBJECT_UNLOCK (alsa);
 
       clk = gst_element_get_clock (element);
       if (clk != NULL) {
@@ -250,6 +277,20 @@ gst_alsasrc_change_state (GstElement * element, GstStateChange transition)
           }
         }
 
+        /* the driver timestamps are in the monotonic clock, we can translate
+         * them to any other clock except our own. Our own clock is already
+         * derived from the device position */
+        if (!alsa->driver_timestamps &&
+            clk != GST_AUDIO_BASE_SRC (alsa)->clock) {
+          GST_INFO ("Using driver timestamps translated to %" GST_PTR_FORMAT,
+              clk);
+          GST_OBJECT_LOCK (alsa);
+          gst_object_replace ((GstObject **) & alsa->ts_clock,
+              (GstObject *) clk);
+          GST_OBJECT_UNLOCK (alsa);
+          alsa->driver_timestamps = TRUE;
+        }
+
         gst_object_unref (clk);
       }
       break;
@@ -267,6 +308,9 @@ gst_alsasrc_init (GstAlsaSrc * alsasrc)
   alsasrc->device = g_strdup (DEFAULT_PROP_DEVICE);
   alsasrc->cached_caps = NULL;
   alsasrc->driver_timestamps = FALSE;
+  alsasrc->ts_clock = NULL;
+  alsasrc->status = NULL;
+  alsasrc->use_mmap = DEFAULT_PROP_USE_MMAP;
 
   g_mutex_init (&alsasrc->alsa_lock);
 }
@@ -343,6 +387,11 @@ set_hwparams (GstAlsaSrc * alsa)
   /* choose all parameters */
   CHECK (snd_pcm_hw_params_any (alsa->handle, params), no_config);
   /* set the interleaved read/write format */
+  if (alsa->access == SND_PCM_ACCESS_MMAP_INTERLEAVED &&
+      snd_pcm_hw_params_set_access (alsa->handle, params, alsa->access) < 0) {
+    GST_INFO_OBJECT (alsa, "mmap access not available, using read/write");
+    alsa->access = SND_PCM_ACCESS_RW_INTERLEAVED;
+  }
   CHECK (snd_pcm_hw_params_set_access (alsa->handle, params, alsa->access),
       wrong_access);
   /* set the sample format */
@@ -699,7 +748,8 @@ alsasrc_parse_spec (GstAlsaSrc * alsa, GstAudioRingBufferSpec * spec)
   alsa->channels = GST_AUDIO_INFO_CHANNELS (&spec->info);
   alsa->buffer_time = spec->buffer_time;
   alsa->period_time = spec->latency_time;
-  alsa->access = SND_PCM_ACCESS_RW_INTERLEAVED;
+  alsa->access = alsa->use_mmap ? SND_PCM_ACCESS_MMAP_INTERLEAVED :
+      SND_PCM_ACCESS_RW_INTERLEAVED;
 
   if (spec->type == GST_AUDIO_RING_BUFFER_FORMAT_TYPE_RAW && alsa->channels < 9)
     gst_audio_ring_buffer_set_channel_positions (GST_AUDIO_BASE_SRC
@@ -726,6 +776,10 @@ gst_alsasrc_open (GstAudioSrc * asrc)
           (alsa->driver_timestamps == TRUE) ? 0 : SND_PCM_NONBLOCK),
       open_error);
 
+  /* reused for the driver timestamp of every period */
+  if (alsa->status == NULL)
+    snd_pcm_status_malloc (&alsa->status);
+
   return TRUE;
 
   /* ERRORS */
@@ -840,6 +894,11 @@ gst_alsasrc_close (GstAudioSrc * asrc)
   snd_pcm_close (alsa->handle);
   alsa->handle = NULL;
 
+  if (alsa->status) {
+    snd_pcm_status_free (alsa->status);
+    alsa->status = NULL;
+  }
+
   gst_caps_replace (&alsa->cached_caps, NULL);
 
   return TRUE;
@@ -876,22 +935,22 @@ xrun_recovery (GstAlsaSrc * alsa, snd_pcm_t * handle, gint err)
   return err;
 }
 
+/* Get the capture time of the first of the @frames frames that were just
+ * read, from the timestamp the driver took at the last hardware pointer
+ * update. */
 static GstClockTime
-gst_alsasrc_get_timestamp (GstAlsaSrc * asrc)
+gst_alsasrc_get_timestamp (GstAlsaSrc * asrc, snd_pcm_uframes_t frames)
 {
-  snd_pcm_status_t *status;
+  snd_pcm_status_t *status = asrc->status;
   snd_htimestamp_t tstamp;
   GstClockTime timestamp;
+  GstClockTime delay;
   snd_pcm_uframes_t avail;
+  GstClock *clock;
   gint err = -EPIPE;
 
-  if (G_UNLIKELY (!asrc)) {
-    GST_ERROR_OBJECT (asrc, "No alsa handle created yet !");
-    return GST_CLOCK_TIME_NONE;
-  }
-
-  if (G_UNLIKELY (snd_pcm_status_malloc (&status) != 0)) {
-    GST_ERROR_OBJECT (asrc, "snd_pcm_status_malloc failed");
+  if (G_UNLIKELY (status == NULL)) {
+    GST_ERROR_OBJECT (asrc, "No alsa status allocated");
     return GST_CLOCK_TIME_NONE;
   }
 
@@ -908,6 +967,7 @@ gst_alsasrc_get_timestamp (GstAlsaSrc * asrc)
     /* reload the status alsa status object, since recovery made it invalid */
     if (G_UNLIKELY (snd_pcm_status (asrc->handle, status) != 0)) {
       GST_ERROR_OBJECT (asrc, "snd_pcm_status failed");
+      return GST_CLOCK_TIME_NONE;
     }
   }
 
@@ -915,24 +975,80 @@ gst_alsasrc_get_timestamp (GstAlsaSrc * asrc)
   snd_pcm_status_get_htstamp (status, &tstamp);
   timestamp = GST_TIMESPEC_TO_TIME (tstamp);
 
-  /* max available frames sets the depth of the buffer */
+  /* the frames that were captured but not read yet come after the ones we
+   * just read */
   avail = snd_pcm_status_get_avail (status);
+  delay = gst_util_uint64_scale_int (avail + frames, GST_SECOND, asrc->rate);
+  if (G_UNLIKELY (timestamp < delay))
+    return GST_CLOCK_TIME_NONE;
+  timestamp -= delay;
+
+  GST_OBJECT_LOCK (asrc);
+  if ((clock = asrc->ts_clock))
+    gst_object_ref (clock);
+  GST_OBJECT_UNLOCK (asrc);
 
-  /* calculate the timestamp of the next sample to be read */
-  timestamp -= gst_util_uint64_scale_int (avail, GST_SECOND, asrc->rate);
+  if (clock) {
+    GstClockTimeDiff offset;
 
-  /* compensate for the fact that we really need the timestamp of the
-   * previously read data segment */
-  timestamp -= asrc->period_time * 1000;
+    /* translate from the monotonic clock to the pipeline clock */
+    offset = GST_CLOCK_DIFF (g_get_monotonic_time () * GST_USECOND,
+        gst_clock_get_time (clock));
+    gst_object_unref (clock);
 
-  snd_pcm_status_free (status);
+    if (G_UNLIKELY (offset < 0 && timestamp < -offset))
+      return GST_CLOCK_TIME_NONE;
+    timestamp += offset;
+  }
 
   GST_LOG_OBJECT (asrc, "ALSA timestamp : %" GST_TIME_FORMAT
-      ", delay %lu", GST_TIME_ARGS (timestamp), avail);
+      ", avail %lu", GST_TIME_ARGS (timestamp), avail);
 
   return timestamp;
 }
 
+/* Copies up to @cptr frames from the mmapped hardware buffer to @ptr.
+ * Returns the number of frames read or a negative error code like
+ * snd_pcm_readi(). */
+static snd_pcm_sframes_t
+gst_alsasrc_read_mmap (GstAlsaSrc * alsa, guint8 * ptr, snd_pcm_uframes_t cptr)
+{
+  const snd_pcm_channel_area_t *areas;
+  snd_pcm_uframes_t offset, frames;
+  snd_pcm_sframes_t avail, err;
+  const guint8 *src;
+
+  /* unlike snd_pcm_readi(), reading from the mmap area does not start the
+   * device */
+  if (snd_pcm_state (alsa->handle) == SND_PCM_STATE_PREPARED) {
+    GST_DEBUG_OBJECT (alsa, "starting");
+    if ((err = snd_pcm_start (alsa->handle)) < 0)
+      return err;
+  }
+
+  avail = snd_pcm_avail_update (alsa->handle);
+  if (avail < 0)
+    return avail;
+  if (avail == 0) {
+    /* wait for a period to become available, at most 4 period times */
+    if ((err = snd_pcm_wait (alsa->handle, 4 * alsa->period_time / 1000)) < 0)
+      return err;
+    return -EAGAIN;
+  }
+
+  /* this can give less frames when the area wraps around */
+  frames = MIN ((snd_pcm_uframes_t) avail, cptr);
+  if ((err = snd_pcm_mmap_begin (alsa->handle, &areas, &offset, &frames)) < 0)
+    return err;
+
+  /* interleaved access, all channels are in the first area */
+  src = (const guint8 *) areas[0].addr +
+      (areas[0].first + offset * areas[0].step) / 8;
+  memcpy (ptr, src, frames * alsa->bpf);
+
+  return snd_pcm_mmap_commit (alsa->handle, offset, frames);
+}
+
 static guint
 gst_alsasrc_read (GstAudioSrc * asrc, gpointer data, guint length,
     GstClockTime * timestamp)
@@ -940,7 +1056,7 @@ gst_alsasrc_read (GstAudioSrc * asrc, gpointer data, guint length,
   GstAlsaSrc *alsa;
   gint err;
   gint cptr;
-  gint16 *ptr;
+  guint8 *ptr;
 
   alsa = GST_ALSA_SRC (asrc);
 
@@ -949,7 +1065,12 @@ gst_alsasrc_read (GstAudioSrc * asrc, gpointer data, guint length,
 
   GST_ALSA_SRC_LOCK (asrc);
   while (cptr > 0) {
-    if ((err = snd_pcm_readi (alsa->handle, ptr, cptr)) < 0) {
+    if (alsa->access == SND_PCM_ACCESS_MMAP_INTERLEAVED)
+      err = gst_alsasrc_read_mmap (alsa, ptr, cptr);
+    else
+      err = snd_pcm_readi (alsa->handle, ptr, cptr);
+
+    if (err < 0) {
       if (err == -EAGAIN) {
         GST_DEBUG_OBJECT (asrc, "Read error: %s", snd_strerror (err));
         continue;
@@ -961,14 +1082,14 @@ gst_alsasrc_read (GstAudioSrc * asrc, gpointer data, guint length,
       continue;
     }
 
-    ptr += err * alsa->channels;
+    ptr += err * alsa->bpf;
     cptr -= err;
   }
   GST_ALSA_SRC_UNLOCK (asrc);
 
   /* if driver timestamps are enabled we need to return this here */
   if (alsa->driver_timestamps && timestamp)
-    *timestamp = gst_alsasrc_get_timestamp (alsa);
+    *timestamp = gst_alsasrc_get_timestamp (alsa, length / alsa->bpf - cptr);
 
   return length - (cptr * alsa->bpf);
 
@@ -64,12 +64,16 @@ struct _GstAlsaSrc {
   guint                 channels;
   gint                  bpf;
   gboolean              driver_timestamps;
+  GstClock              *ts_clock;
+  snd_pcm_status_t      *status;
 
   guint                 buffer_time;
   guint                 period_time;
   snd_pcm_uframes_t     buffer_size;
   snd_pcm_uframes_t     period_size;
 
+  gboolean              use_mmap;
+
   GMutex                alsa_lock;
 };
 
@@ -1824,6 +1824,7 @@ gst_ogg_chain_new (GstOggDemux * ogg)
   chain->segment_start = GST_CLOCK_TIME_NONE;
   chain->segment_stop = GST_CLOCK_TIME_NONE;
   chain->total_time = GST_CLOCK_TIME_NONE;
+  chain->index = g_array_new (FALSE, FALSE, sizeof (GstOggIndex));
 
   return chain;
 }
@@ -1839,6 +1840,7 @@ gst_ogg_chain_free (GstOggChain * chain)
     gst_object_unref (pad);
   }
   g_array_free (chain->streams, TRUE);
+  g_array_free (chain->index, TRUE);
   g_slice_free (GstOggChain, chain);
 }
 
@@ -1943,6 +1945,100 @@ gst_ogg_chain_has_stream (GstOggChain * chain, guint32 serialno)
   return gst_ogg_chain_get_stream (chain, serialno) != NULL;
 }
 
+/* Remember the time of the page at @offset. Entries are sorted on both
+ * offset and time and kept at least CHUNKSIZE apart, closer than that
+ * bisection reads linearly anyway. */
+static void
+gst_ogg_chain_index_add (GstOggChain * chain, gint64 offset, GstClockTime time)
+{
+  GstOggIndex entry, *e;
+  guint lo, hi, mid;
+
+  lo = 0;
+  hi = chain->index->len;
+  while (lo < hi) {
+    mid = lo + (hi - lo) / 2;
+    if ((gint64) g_array_index (chain->index, GstOggIndex, mid).offset < offset)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  if (lo > 0) {
+    e = &g_array_index (chain->index, GstOggIndex, lo - 1);
+    if (offset - (gint64) e->offset < CHUNKSIZE || time < e->timestamp)
+      return;
+  }
+  if (lo < chain->index->len) {
+    e = &g_array_index (chain->index, GstOggIndex, lo);
+    if ((gint64) e->offset - offset < CHUNKSIZE || time > e->timestamp)
+      return;
+  }
+
+  entry.offset = offset;
+  entry.timestamp = time;
+  g_array_insert_val (chain->index, lo, entry);
+}
+
+static void
+gst_ogg_chain_index_page (GstOggChain * chain, ogg_page * page, gint64 offset)
+{
+  GstOggPad *pad;
+  gint64 granulepos;
+  GstClockTime granuletime;
+
+  granulepos = ogg_page_granulepos (page);
+  if (granulepos == -1 || !GST_CLOCK_TIME_IS_VALID (chain->begin_time))
+    return;
+
+  pad = gst_ogg_chain_get_stream (chain, ogg_page_serialno (page));
+  if (pad == NULL || pad->map.is_skeleton)
+    return;
+
+  granuletime = gst_ogg_stream_get_end_time_for_granulepos (&pad->map,
+      granulepos);
+  if (!GST_CLOCK_TIME_IS_VALID (granuletime) || granuletime < pad->start_time)
+    return;
+
+  gst_ogg_chain_index_add (chain, offset,
+      granuletime - pad->start_time + chain->begin_time);
+}
+
+/* Narrow [begin, end) down to the indexed pages around @target */
+static void
+gst_ogg_chain_index_bounds (GstOggChain * chain, gint64 target,
+    gint64 * begin, gint64 * end, gint64 * begintime, gint64 * endtime)
+{
+  GstOggIndex *e;
+  guint lo, hi, mid;
+
+  lo = 0;
+  hi = chain->index->len;
+  while (lo < hi) {
+    mid = lo + (hi - lo) / 2;
+    if ((gint64) g_array_index (chain->index, GstOggIndex,
+            mid).timestamp < target)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  if (lo > 0) {
+    e = &g_array_index (chain->index, GstOggIndex, lo - 1);
+    if ((gint64) e->offset > *begin && (gint64) e->offset < *end) {
+      *begin = e->offset;
+      *begintime = e->timestamp;
+    }
+  }
+  if (lo < chain->index->len) {
+    e = &g_array_index (chain->index, GstOggIndex, lo);
+    if ((gint64) e->offset > *begin && (gint64) e->offset < *end) {
+      *end = e->offset;
+      *endtime = e->timestamp;
+    }
+  }
+}
+
 /* signals and args */
 enum
 {
@@ -1979,6 +2075,8 @@ static GstFlowReturn gst_ogg_demux_read_end_chain (GstOggDemux * ogg,
 static gboolean gst_ogg_demux_sink_event (GstPad * pad, GstObject * parent,
     GstEvent * event);
 static void gst_ogg_demux_loop (GstOggPad * pad);
+static GstFlowReturn gst_ogg_demux_handle_pages (GstOggDemux * ogg,
+    GstFlowReturn result);
 static GstFlowReturn gst_ogg_demux_chain (GstPad * pad, GstObject * parent,
     GstBuffer * buffer);
 static gboolean gst_ogg_demux_sink_activate (GstPad * sinkpad,
@@ -2701,6 +2799,10 @@ do_binary_search (GstOggDemux * ogg, GstOggChain * chain, gint64 begin,
   GstFlowReturn ret;
   gint64 result = 0;
 
+  /* start from the pages we already know of around the target */
+  gst_ogg_chain_index_bounds (chain, target, &begin, &end, &begintime,
+      &endtime);
+
   best = begin;
 
   GST_DEBUG_OBJECT (ogg,
@@ -2786,6 +2888,8 @@ do_binary_search (GstOggDemux * ogg, GstOggChain * chain, gint64 begin,
         granuletime -= pad->start_time;
         granuletime += chain->begin_time;
 
+        gst_ogg_chain_index_add (chain, result, granuletime);
+
         GST_DEBUG_OBJECT (ogg,
             "found page with granule %" G_GINT64_FORMAT " and time %"
             GST_TIME_FORMAT, granulepos, GST_TIME_ARGS (granuletime));
@@ -4167,7 +4271,6 @@ static GstFlowReturn
 gst_ogg_demux_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
 {
   GstOggDemux *ogg;
-  gint ret = 0;
   GstFlowReturn result = GST_FLOW_OK;
 
   ogg = GST_OGG_DEMUX (parent);
@@ -4178,6 +4281,15 @@ gst_ogg_demux_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
     GST_DEBUG_OBJECT (ogg, "gst_ogg_demux_submit_buffer returned %d", result);
   }
 
+  return gst_ogg_demux_handle_pages (ogg, result);
+}
+
+/* handles all complete pages in the sync buffer */
+static GstFlowReturn
+gst_ogg_demux_handle_pages (GstOggDemux * ogg, GstFlowReturn result)
+{
+  gint ret = 0;
+
   while (result == GST_FLOW_OK) {
     ogg_page page;
 
@@ -4189,6 +4301,13 @@ gst_ogg_demux_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
       /* discontinuity in the pages */
       GST_DEBUG_OBJECT (ogg, "discont in page found, continuing");
     } else {
+      /* in pull mode we know where the page started, remember its time
+       * for later seeks */
+      if (ogg->pullmode && ogg->current_chain)
+        gst_ogg_chain_index_page (ogg->current_chain, &page,
+            ogg->offset - (ogg->sync.fill - ogg->sync.returned) -
+            (page.header_len + page.body_len));
+
       result = gst_ogg_demux_handle_page (ogg, &page);
       if (result < 0) {
         GST_DEBUG_OBJECT (ogg, "gst_ogg_demux_handle_page returned %d", result);
@@ -4292,6 +4411,8 @@ gst_ogg_demux_loop_forward (GstOggDemux * ogg)
 {
   GstFlowReturn ret;
   GstBuffer *buffer = NULL;
+  gchar *oggbuffer;
+  gsize size;
 
   if (ogg->offset == ogg->length) {
     GST_LOG_OBJECT (ogg, "no more data to pull %" G_GINT64_FORMAT
@@ -4301,20 +4422,46 @@ gst_ogg_demux_loop_forward (GstOggDemux * ogg)
   }
 
   GST_LOG_OBJECT (ogg, "pull data %" G_GINT64_FORMAT, ogg->offset);
+
+  /* pull straight into the sync buffer instead of copying the data there
+   * afterwards */
+  oggbuffer = ogg_sync_buffer (&ogg->sync, CHUNKSIZE);
+  if (G_UNLIKELY (oggbuffer == NULL)) {
+    GST_ELEMENT_ERROR (ogg, STREAM, DECODE,
+        (NULL), ("failed to get ogg sync buffer"));
+    ret = GST_FLOW_ERROR;
+    goto done;
+  }
+
+  buffer =
+      gst_buffer_new_wrapped_full (0, oggbuffer, CHUNKSIZE, 0, CHUNKSIZE, NULL,
+      NULL);
+
   ret = gst_pad_pull_range (ogg->sinkpad, ogg->offset, CHUNKSIZE, &buffer);
   if (ret != GST_FLOW_OK) {
     GST_LOG_OBJECT (ogg, "Failed pull_range");
+    gst_buffer_unref (buffer);
     goto done;
   }
 
-  ogg->offset += gst_buffer_get_size (buffer);
+  size = gst_buffer_get_size (buffer);
+  gst_buffer_unref (buffer);
+
+  if (G_UNLIKELY (ogg_sync_wrote (&ogg->sync, size) < 0)) {
+    GST_ELEMENT_ERROR (ogg, STREAM, DECODE, (NULL),
+        ("failed to write %" G_GSIZE_FORMAT " bytes to the sync buffer", size));
+    ret = GST_FLOW_ERROR;
+    goto done;
+  }
+
+  ogg->offset += size;
 
   if (G_UNLIKELY (ogg->newsegment)) {
     gst_ogg_demux_send_event (ogg, ogg->newsegment);
     ogg->newsegment = NULL;
   }
 
-  ret = gst_ogg_demux_chain (ogg->sinkpad, GST_OBJECT_CAST (ogg), buffer);
+  ret = gst_ogg_demux_handle_pages (ogg, GST_FLOW_OK);
   if (ret != GST_FLOW_OK) {
     GST_LOG_OBJECT (ogg, "Failed demux_chain");
     goto done;
@@ -4582,6 +4729,21 @@ gst_ogg_demux_sink_activate (GstPad * sinkpad, GstObject * parent)
 
   pull_mode = gst_query_has_scheduling_mode_with_flags (query,
       GST_PAD_MODE_PULL, GST_SCHEDULING_FLAG_SEEKABLE);
+
+  /* In pull mode all chains are found by reading pages at the end and
+   * bisecting before anything is played. When every range request is a
+   * round trip to a server that's slow, so prefer push mode then, which
+   * starts after the headers of the first chain and picks up the duration
+   * and any later chains while playing. */
+  if (pull_mode && gst_query_has_scheduling_mode (query, GST_PAD_MODE_PUSH)) {
+    GstSchedulingFlags flags;
+
+    gst_query_parse_scheduling (query, &flags, NULL, NULL, NULL);
+    if (flags & GST_SCHEDULING_FLAG_BANDWIDTH_LIMITED) {
+      GST_DEBUG_OBJECT (sinkpad, "upstream is bandwidth limited");
+      pull_mode = FALSE;
+    }
+  }
   gst_query_unref (query);
 
   if (!pull_mode)
@@ -72,6 +72,9 @@ struct _GstOggChain
                                    the start times of all streams. */
   GstClockTime segment_stop;    /* the timestamp of the last page, this is the MAX of the
                                    streams. */
+
+  GArray *index;                /* GstOggIndex of pages seen so far, with times
+                                   in stream time, used to narrow down seeks */
 };
 
 /* all information needed for one ogg stream */
@@ -84,6 +84,7 @@ enum
 #define DEFAULT_MAX_PAGE_DELAY  G_GINT64_CONSTANT(500000000)
 #define DEFAULT_MAX_TOLERANCE   G_GINT64_CONSTANT(40000000)
 #define DEFAULT_SKELETON        FALSE
+#define DEFAULT_LOW_LATENCY     FALSE
 
 enum
 {
@@ -91,7 +92,8 @@ enum
   ARG_MAX_DELAY,
   ARG_MAX_PAGE_DELAY,
   ARG_MAX_TOLERANCE,
-  ARG_SKELETON
+  ARG_SKELETON,
+  ARG_LOW_LATENCY
 };
 
 static GstStaticPadTemplate src_factory = GST_STATIC_PAD_TEMPLATE ("src",
@@ -200,6 +202,21 @@ gst_ogg_mux_class_init (GstOggMuxClass * klass)
           "Whether to include a Skeleton track",
           DEFAULT_SKELETON,
           (GParamFlags) G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstOggMux:low-latency:
+   *
+   * Push out a page as soon as a packet is complete instead of filling up
+   * pages, and don't hold back pages of the other streams while a sparse
+   * stream has no data. This is meant for live streaming, at the expense of
+   * more overhead and a looser time ordering of sparse streams.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, ARG_LOW_LATENCY,
+      g_param_spec_boolean ("low-latency", "Low latency",
+          "Push out a page for every packet and don't wait for sparse streams",
+          DEFAULT_LOW_LATENCY,
+          (GParamFlags) G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gstelement_class->change_state = gst_ogg_mux_change_state;
 
@@ -244,6 +261,7 @@ gst_ogg_mux_init (GstOggMux * ogg_mux)
   ogg_mux->max_delay = DEFAULT_MAX_DELAY;
   ogg_mux->max_page_delay = DEFAULT_MAX_PAGE_DELAY;
   ogg_mux->max_tolerance = DEFAULT_MAX_TOLERANCE;
+  ogg_mux->low_latency = DEFAULT_LOW_LATENCY;
 
   gst_ogg_mux_clear (ogg_mux);
 }
@@ -604,6 +622,9 @@ gst_ogg_mux_dequeue_page (GstOggMux * mux, GstFlowReturn * flowret)
       if (pad->eos) {
         GST_LOG_OBJECT (pad->collect.pad,
             "pad is EOS, skipping for dequeue decision");
+      } else if (mux->low_latency && pad->map.is_sparse) {
+        GST_LOG_OBJECT (pad->collect.pad,
+            "sparse pad without pages, skipping for dequeue decision");
       } else {
         GST_LOG_OBJECT (pad->collect.pad,
             "no pages in this queue, can't dequeue");
@@ -1896,6 +1917,29 @@ gst_ogg_mux_process_best_pad (GstOggMux * ogg_mux, GstOggPadData * best)
       ogg_mux->pulling = NULL;
     }
 
+    /* in low latency mode don't wait for the page to fill up, the packet
+     * we just added ends the page */
+    if (ogg_mux->low_latency) {
+      gboolean flushed = FALSE;
+
+      while (ogg_stream_flush (&pad->map.stream, &page)) {
+        pad->gp_time = gp_time;
+        pad->timestamp_end = timestamp;
+        if (GST_CLOCK_TIME_IS_VALID (timestamp) && duration != -1)
+          pad->timestamp_end += duration;
+        ret = gst_ogg_mux_pad_queue_page (ogg_mux, pad, &page,
+            pad->first_delta);
+        pad->pageno++;
+        pad->first_delta = TRUE;
+        flushed = TRUE;
+      }
+      if (flushed) {
+        pad->new_page = TRUE;
+        pad->duration = 0;
+        ogg_mux->pulling = NULL;
+      }
+    }
+
     /* Update the gp time, if necessary, since any future page will have at
      * least this gp time.
      */
@@ -2016,6 +2060,9 @@ gst_ogg_mux_get_property (GObject * object,
     case ARG_SKELETON:
       g_value_set_boolean (value, ogg_mux->use_skeleton);
       break;
+    case ARG_LOW_LATENCY:
+      g_value_set_boolean (value, ogg_mux->low_latency);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2043,6 +2090,9 @@ gst_ogg_mux_set_property (GObject * object,
     case ARG_SKELETON:
       ogg_mux->use_skeleton = g_value_get_boolean (value);
       break;
+    case ARG_LOW_LATENCY:
+      ogg_mux->low_latency = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -131,6 +131,9 @@ struct _GstOggMux
 
   /* whether to create a skeleton track */
   gboolean use_skeleton;
+
+  /* whether to push out a page per packet and not wait for sparse pads */
+  gboolean low_latency;
 };
 
 struct _GstOggMuxClass
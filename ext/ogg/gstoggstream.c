@@ -127,6 +127,29 @@ gst_ogg_stream_get_end_time_for_granulepos (GstOggStream * pad,
       gst_ogg_stream_granulepos_to_granule (pad, granulepos));
 }
 
+static void
+gst_ogg_stream_update_granule_duration (GstOggStream * pad)
+{
+  guint64 num;
+
+  pad->granule_time_n = pad->granulerate_n;
+  pad->granule_time_d = pad->granulerate_d;
+  pad->granule_duration = 0;
+  pad->granule_duration_max = 0;
+
+  if (pad->granulerate_n <= 0 || pad->granulerate_d <= 0)
+    return;
+
+  num = GST_SECOND * (guint64) pad->granulerate_d;
+  if (num % pad->granulerate_n == 0) {
+    pad->granule_duration = num / pad->granulerate_n;
+    pad->granule_duration_max = G_MAXUINT64 / pad->granule_duration;
+  }
+
+  GST_DEBUG ("granulerate %d/%d, duration per granule %" G_GUINT64_FORMAT,
+      pad->granulerate_n, pad->granulerate_d, pad->granule_duration);
+}
+
 GstClockTime
 gst_ogg_stream_granule_to_time (GstOggStream * pad, gint64 granule)
 {
@@ -137,6 +160,16 @@ gst_ogg_stream_granule_to_time (GstOggStream * pad, gint64 granule)
   if (granule < 0)
     return 0;
 
+  /* the granulerate can still change after the setup, e.g. from a fisbone */
+  if (G_UNLIKELY (pad->granule_time_n != pad->granulerate_n ||
+          pad->granule_time_d != pad->granulerate_d))
+    gst_ogg_stream_update_granule_duration (pad);
+
+  /* most video rates give an exact duration per granule, so we can avoid the
+   * 128-bit scaling for those */
+  if (pad->granule_duration != 0 && granule <= pad->granule_duration_max)
+    return granule * pad->granule_duration;
+
   return gst_util_uint64_scale (granule, GST_SECOND * pad->granulerate_d,
       pad->granulerate_n);
 }
@@ -240,6 +273,81 @@ gst_ogg_stream_get_packet_duration (GstOggStream * pad, ogg_packet * packet)
   return mappers[pad->map].packet_duration_func (pad, packet);
 }
 
+/* Computes the granule at which each packet ending on @page ends, working
+ * back from the granulepos of the page, and stores them in @granules in
+ * packet order. A packet continued from the previous page is included, its
+ * duration is not needed. Packets are not submitted to the stream, but
+ * mappers that keep state between packets (vorbis) continue from the state
+ * of the stream, so pages should be passed in order for those.
+ *
+ * Returns the number of packets ending on @page, or -1 when their granules
+ * cannot be determined. */
+gint
+gst_ogg_stream_get_page_packet_granules (GstOggStream * pad, ogg_page * page,
+    gint64 * granules, gint n_granules)
+{
+  GstOggMapPacketDurationFunc duration_func;
+  const guint8 *lacing;
+  ogg_packet packet;
+  gint64 granule;
+  glong offset = 0, size = 0;
+  gint n_segments, i, n = 0;
+
+  duration_func = mappers[pad->map].packet_duration_func;
+  if (duration_func == NULL) {
+    GST_WARNING ("Failed to determine %s packet duration",
+        gst_ogg_stream_get_media_type (pad));
+    return -1;
+  }
+
+  granule = gst_ogg_stream_granulepos_to_granule (pad,
+      ogg_page_granulepos (page));
+  if (granule < 0)
+    return -1;
+
+  memset (&packet, 0, sizeof (packet));
+  packet.granulepos = -1;
+
+  n_segments = page->header[26];
+  lacing = page->header + 27;
+
+  /* first store the durations of the packets */
+  for (i = 0; i < n_segments; i++) {
+    size += lacing[i];
+    if (lacing[i] == 255)
+      continue;
+
+    if (n == n_granules) {
+      GST_WARNING ("more than %d packets on page", n_granules);
+      return -1;
+    }
+
+    if (n == 0 && ogg_page_continued (page)) {
+      granules[n] = 0;
+    } else {
+      packet.packet = page->body + offset;
+      packet.bytes = size;
+      granules[n] = duration_func (pad, &packet);
+      if (granules[n] < 0)
+        return -1;
+    }
+    offset += size;
+    size = 0;
+    n++;
+  }
+
+  /* then turn them into end granules, the last packet ends at the page
+   * granulepos */
+  for (i = n - 1; i >= 0; i--) {
+    gint64 duration = granules[i];
+
+    granules[i] = granule;
+    granule -= duration;
+  }
+
+  return n;
+}
+
 
 void
 gst_ogg_stream_extract_tags (GstOggStream * pad, ogg_packet * packet)
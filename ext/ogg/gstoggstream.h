@@ -71,6 +71,12 @@ struct _GstOggStream
   guint64 total_time;
   gboolean is_sparse;
   gboolean forbid_start_clamping;
+  /* granule to time conversion for the granulerate above, updated when
+   * the granulerate changes */
+  gint granule_time_n;
+  gint granule_time_d;
+  GstClockTime granule_duration;
+  guint64 granule_duration_max;
 
   GstCaps *caps;
 
@@ -131,6 +137,8 @@ gboolean gst_ogg_stream_granulepos_is_key_frame (GstOggStream *pad,
 gboolean gst_ogg_stream_packet_is_header (GstOggStream *pad, ogg_packet *packet);
 gboolean gst_ogg_stream_packet_is_key_frame (GstOggStream *pad, ogg_packet *packet);
 gint64 gst_ogg_stream_get_packet_duration (GstOggStream * pad, ogg_packet *packet);
+gint gst_ogg_stream_get_page_packet_granules (GstOggStream * pad,
+    ogg_page * page, gint64 * granules, gint n_granules);
 void gst_ogg_stream_extract_tags (GstOggStream * pad, ogg_packet * packet);
 const char *gst_ogg_stream_get_media_type (GstOggStream * pad);
 
@@ -121,6 +121,13 @@ GST_DEBUG_CATEGORY (pango_debug);
 #define MINIMUM_OUTLINE_OFFSET 1.0
 #define DEFAULT_SCALE_BASIS    640
 
+/* Number of rendered text images kept around for reuse */
+#define RENDER_CACHE_SIZE      32
+
+/* Characters the glyph atlas can compose text from */
+#define GLYPH_ATLAS_CHARS      "0123456789:.,-/ "
+#define GLYPH_ATLAS_SIZE       (sizeof (GLYPH_ATLAS_CHARS) - 1)
+
 enum
 {
   PROP_0,
@@ -294,6 +301,7 @@ static void gst_base_text_overlay_text_pad_unlink (GstPad * pad,
 static void gst_base_text_overlay_pop_text (GstBaseTextOverlay * overlay);
 static void gst_base_text_overlay_update_render_mode (GstBaseTextOverlay *
     overlay);
+static void gst_base_text_overlay_clear_glyphs (GstBaseTextOverlay * overlay);
 
 static void gst_base_text_overlay_finalize (GObject * object);
 static void gst_base_text_overlay_set_property (GObject * object, guint prop_id,
@@ -545,6 +553,8 @@ gst_base_text_overlay_finalize (GObject * object)
     overlay->text_image = NULL;
   }
 
+  gst_base_text_overlay_clear_glyphs (overlay);
+
   if (overlay->layout) {
     g_object_unref (overlay->layout);
     overlay->layout = NULL;
@@ -777,6 +787,8 @@ gst_base_text_overlay_setcaps (GstBaseTextOverlay * overlay, GstCaps * caps)
     gst_base_text_overlay_negotiate (overlay);
     gst_base_text_overlay_update_wrap_mode (overlay);
     g_mutex_unlock (GST_BASE_TEXT_OVERLAY_GET_CLASS (overlay)->pango_lock);
+    /* anything rendered ahead was for the old size */
+    overlay->need_render = TRUE;
     GST_BASE_TEXT_OVERLAY_UNLOCK (overlay);
   }
 
@@ -1124,7 +1136,7 @@ gst_base_text_overlay_get_pos (GstBaseTextOverlay * overlay,
   GstBaseTextOverlayVAlign valign;
   GstBaseTextOverlayHAlign halign;
 
-  width = overlay->image_width;
+  width = overlay->box_width;
   height = overlay->image_height;
 
   if (overlay->use_vertical_render)
@@ -1152,6 +1164,8 @@ gst_base_text_overlay_get_pos (GstBaseTextOverlay * overlay,
       *xpos = 0;
   }
   *xpos += overlay->deltax;
+  /* the image only covers the inked part of the box */
+  *xpos += overlay->image_xoffset;
 
   if (overlay->use_vertical_render)
     valign = GST_BASE_TEXT_OVERLAY_VALIGN_TOP;
@@ -1219,6 +1233,125 @@ gst_text_overlay_filter_foreground_attr (PangoAttribute * attr, gpointer data)
   }
 }
 
+/* Rendered images are shared between all overlay instances, since the same
+ * lines are usually shown for many frames and often by several elements */
+typedef struct
+{
+  gchar *key;
+  GList *link;
+  GstBuffer *image;
+  gint width, height;
+  gint xoffset, box_width;
+  gint baseline_y;
+  gdouble advance;
+} GstBaseTextOverlayRender;
+
+static GMutex render_cache_lock;
+static GHashTable *render_cache = NULL;
+static GQueue render_cache_lru = G_QUEUE_INIT;
+
+static void
+gst_base_text_overlay_render_free (GstBaseTextOverlayRender * render)
+{
+  g_free (render->key);
+  gst_buffer_unref (render->image);
+  g_slice_free (GstBaseTextOverlayRender, render);
+}
+
+/* Called with the pango lock */
+static gchar *
+gst_base_text_overlay_render_cache_key (GstBaseTextOverlay * overlay,
+    const gchar * string, gint textlen)
+{
+  const PangoFontDescription *desc;
+  gchar *font, *key;
+
+  desc = pango_layout_get_font_description (overlay->layout);
+  if (desc == NULL)
+    desc =
+        pango_context_get_font_description (pango_layout_get_context
+        (overlay->layout));
+  font = pango_font_description_to_string (desc);
+
+  key = g_strdup_printf ("%s|%dx%d|%d|%d|%d|%d|%08x|%08x|%g|%g|%d|%d|%d|%.*s",
+      font, overlay->width, overlay->height, overlay->wrap_mode,
+      overlay->line_align, overlay->auto_adjust_size,
+      overlay->use_vertical_render, overlay->color, overlay->outline_color,
+      overlay->shadow_offset, overlay->outline_offset, overlay->want_shading,
+      overlay->shading_value, overlay->deltax, textlen, string);
+  g_free (font);
+
+  return key;
+}
+
+static gboolean
+gst_base_text_overlay_render_cache_lookup (GstBaseTextOverlay * overlay,
+    const gchar * key)
+{
+  GstBaseTextOverlayRender *render = NULL;
+
+  g_mutex_lock (&render_cache_lock);
+  if (render_cache)
+    render = g_hash_table_lookup (render_cache, key);
+  if (render) {
+    g_queue_unlink (&render_cache_lru, render->link);
+    g_queue_push_head_link (&render_cache_lru, render->link);
+
+    /* the copy shares the memory but gets its own video meta */
+    if (overlay->text_image)
+      gst_buffer_unref (overlay->text_image);
+    overlay->text_image = gst_buffer_copy (render->image);
+    overlay->image_width = render->width;
+    overlay->image_height = render->height;
+    overlay->image_xoffset = render->xoffset;
+    overlay->box_width = render->box_width;
+    overlay->baseline_y = render->baseline_y;
+    overlay->image_advance = render->advance;
+  }
+  g_mutex_unlock (&render_cache_lock);
+
+  return render != NULL;
+}
+
+/* Takes ownership of @key */
+static void
+gst_base_text_overlay_render_cache_insert (GstBaseTextOverlay * overlay,
+    gchar * key)
+{
+  GstBaseTextOverlayRender *render;
+
+  g_mutex_lock (&render_cache_lock);
+  if (render_cache == NULL)
+    render_cache = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
+        (GDestroyNotify) gst_base_text_overlay_render_free);
+
+  if (g_hash_table_lookup (render_cache, key)) {
+    g_mutex_unlock (&render_cache_lock);
+    g_free (key);
+    return;
+  }
+
+  render = g_slice_new (GstBaseTextOverlayRender);
+  render->key = key;
+  render->image = gst_buffer_copy (overlay->text_image);
+  render->width = overlay->image_width;
+  render->height = overlay->image_height;
+  render->xoffset = overlay->image_xoffset;
+  render->box_width = overlay->box_width;
+  render->baseline_y = overlay->baseline_y;
+  render->advance = overlay->image_advance;
+
+  g_queue_push_head (&render_cache_lru, render);
+  render->link = render_cache_lru.head;
+  g_hash_table_insert (render_cache, render->key, render);
+
+  while (render_cache_lru.length > RENDER_CACHE_SIZE) {
+    render = g_queue_pop_tail (&render_cache_lru);
+    g_hash_table_remove (render_cache, render->key);
+  }
+  g_mutex_unlock (&render_cache_lock);
+}
+
 static void
 gst_base_text_overlay_render_pangocairo (GstBaseTextOverlay * overlay,
     const gchar * string, gint textlen)
@@ -1227,14 +1360,22 @@ gst_base_text_overlay_render_pangocairo (GstBaseTextOverlay * overlay,
   cairo_surface_t *surface;
   PangoRectangle ink_rect, logical_rect;
   cairo_matrix_t cairo_matrix;
-  int width, height;
+  int width, height, box_width, xoffset = 0;
   double scalef = 1.0;
   double a, r, g, b;
   GstBuffer *buffer;
   GstMapInfo map;
+  gchar *key;
 
   g_mutex_lock (GST_BASE_TEXT_OVERLAY_GET_CLASS (overlay)->pango_lock);
 
+  key = gst_base_text_overlay_render_cache_key (overlay, string, textlen);
+  if (gst_base_text_overlay_render_cache_lookup (overlay, key)) {
+    g_mutex_unlock (GST_BASE_TEXT_OVERLAY_GET_CLASS (overlay)->pango_lock);
+    g_free (key);
+    return;
+  }
+
   if (overlay->auto_adjust_size) {
     /* 640 pixel is default */
     scalef = (double) (overlay->width) / DEFAULT_SCALE_BASIS;
@@ -1247,6 +1388,7 @@ gst_base_text_overlay_render_pangocairo (GstBaseTextOverlay * overlay,
   pango_layout_get_pixel_extents (overlay->layout, &ink_rect, &logical_rect);
 
   width = (logical_rect.width + overlay->shadow_offset) * scalef;
+  box_width = width;
 
   if (width + overlay->deltax >
       (overlay->use_vertical_render ? overlay->height : overlay->width)) {
@@ -1256,7 +1398,15 @@ gst_base_text_overlay_render_pangocairo (GstBaseTextOverlay * overlay,
      */
     gst_base_text_overlay_update_wrap_mode (overlay);
     pango_layout_get_pixel_extents (overlay->layout, &ink_rect, &logical_rect);
-    width = overlay->width;
+    box_width = width = overlay->width;
+
+    if (!overlay->use_vertical_render) {
+      /* no need to render the empty space around the wrapped lines, only
+       * keep their position in the box */
+      xoffset = CLAMP (logical_rect.x * scalef, 0, box_width);
+      width = (logical_rect.width + overlay->shadow_offset) * scalef;
+      width = MIN (width, box_width - xoffset);
+    }
   }
 
   height =
@@ -1293,9 +1443,10 @@ gst_base_text_overlay_render_pangocairo (GstBaseTextOverlay * overlay,
 
     tmp = height;
     height = width;
-    width = tmp;
+    box_width = width = tmp;
   } else {
     cairo_matrix_init_scale (&cairo_matrix, scalef, scalef);
+    cairo_matrix.x0 = -xoffset;
   }
 
   /* reallocate overlay buffer */
@@ -1387,28 +1538,176 @@ gst_base_text_overlay_render_pangocairo (GstBaseTextOverlay * overlay,
   gst_buffer_unmap (buffer, &map);
   overlay->image_width = width;
   overlay->image_height = height;
+  overlay->image_xoffset = xoffset;
+  overlay->box_width = box_width;
   overlay->baseline_y = ink_rect.y;
+  overlay->image_advance = logical_rect.width * scalef;
+  gst_base_text_overlay_render_cache_insert (overlay, key);
+  g_mutex_unlock (GST_BASE_TEXT_OVERLAY_GET_CLASS (overlay)->pango_lock);
+}
+
+/* A single character, rendered with shadow and outline like any other text */
+struct _GstBaseTextOverlayGlyph
+{
+  GstBuffer *image;
+  gint width, height;
+  gdouble advance;
+};
+
+static void
+gst_base_text_overlay_clear_glyphs (GstBaseTextOverlay * overlay)
+{
+  guint i;
+
+  if (overlay->glyphs) {
+    for (i = 0; i < GLYPH_ATLAS_SIZE; i++) {
+      if (overlay->glyphs[i].image)
+        gst_buffer_unref (overlay->glyphs[i].image);
+    }
+    g_free (overlay->glyphs);
+    overlay->glyphs = NULL;
+  }
+
+  g_free (overlay->glyph_atlas_key);
+  overlay->glyph_atlas_key = NULL;
+}
+
+static GstBaseTextOverlayGlyph *
+gst_base_text_overlay_get_glyph (GstBaseTextOverlay * overlay, gchar c)
+{
+  GstBaseTextOverlayGlyph *glyph;
+
+  glyph = &overlay->glyphs[strchr (GLYPH_ATLAS_CHARS, c) - GLYPH_ATLAS_CHARS];
+  if (glyph->image)
+    return glyph;
+
+  GST_DEBUG_OBJECT (overlay, "rendering glyph '%c'", c);
+
+  gst_base_text_overlay_render_pangocairo (overlay, &c, 1);
+
+  /* steal the image, the glyph keeps its video meta from now on */
+  glyph->image = overlay->text_image;
+  overlay->text_image = NULL;
+  glyph->width = overlay->image_width;
+  glyph->height = overlay->image_height;
+  glyph->advance = overlay->image_advance;
+
+  if (glyph->width > 0 && glyph->height > 0)
+    gst_buffer_add_video_meta (glyph->image, GST_VIDEO_FRAME_FLAG_NONE,
+        GST_VIDEO_OVERLAY_COMPOSITION_FORMAT_RGB, glyph->width, glyph->height);
+
+  return glyph;
+}
+
+/* Composes @string from separately rendered glyphs, with one overlay
+ * rectangle per glyph. Rendering the few glyphs once is much cheaper than
+ * laying out and rendering a timestamp that changes on every frame.
+ * Returns FALSE if @string contains anything the atlas can't compose. */
+static gboolean
+gst_base_text_overlay_render_glyphs (GstBaseTextOverlay * overlay,
+    const gchar * string, gint textlen)
+{
+  GstBaseTextOverlayGlyph *glyph;
+  GstVideoOverlayRectangle *rectangle;
+  gdouble x;
+  gint i, xpos, ypos, width, height;
+  gchar *key;
+
+  if (!overlay->use_glyph_atlas || overlay->use_vertical_render ||
+      overlay->want_shading || textlen == 0)
+    return FALSE;
+
+  for (i = 0; i < textlen; i++) {
+    if (string[i] == '\0' || strchr (GLYPH_ATLAS_CHARS, string[i]) == NULL)
+      return FALSE;
+  }
+
+  /* all glyphs need rendering again when the font or colors changed */
+  g_mutex_lock (GST_BASE_TEXT_OVERLAY_GET_CLASS (overlay)->pango_lock);
+  key = gst_base_text_overlay_render_cache_key (overlay, "", 0);
   g_mutex_unlock (GST_BASE_TEXT_OVERLAY_GET_CLASS (overlay)->pango_lock);
 
-  gst_base_text_overlay_set_composition (overlay);
+  if (g_strcmp0 (key, overlay->glyph_atlas_key) != 0) {
+    gst_base_text_overlay_clear_glyphs (overlay);
+    overlay->glyphs = g_new0 (GstBaseTextOverlayGlyph, GLYPH_ATLAS_SIZE);
+    overlay->glyph_atlas_key = key;
+  } else {
+    g_free (key);
+  }
+
+  /* measure */
+  x = 0.0;
+  width = height = 0;
+  for (i = 0; i < textlen; i++) {
+    glyph = gst_base_text_overlay_get_glyph (overlay, string[i]);
+    width = MAX (width, (gint) x + glyph->width);
+    height = MAX (height, glyph->height);
+    x += glyph->advance;
+  }
+
+  gst_buffer_replace (&overlay->text_image, NULL);
+  overlay->image_width = overlay->box_width = width;
+  overlay->image_height = height;
+  overlay->image_xoffset = 0;
+  overlay->image_advance = x;
+
+  if (overlay->composition) {
+    gst_video_overlay_composition_unref (overlay->composition);
+    overlay->composition = NULL;
+  }
+
+  gst_base_text_overlay_get_pos (overlay, &xpos, &ypos);
+
+  /* compose */
+  x = 0.0;
+  for (i = 0; i < textlen; i++) {
+    glyph = gst_base_text_overlay_get_glyph (overlay, string[i]);
+
+    if (glyph->width > 0 && glyph->height > 0) {
+      rectangle = gst_video_overlay_rectangle_new_raw (glyph->image,
+          xpos + (gint) x, ypos, glyph->width, glyph->height,
+          GST_VIDEO_OVERLAY_FORMAT_FLAG_PREMULTIPLIED_ALPHA);
+
+      if (overlay->composition)
+        gst_video_overlay_composition_add_rectangle (overlay->composition,
+            rectangle);
+      else
+        overlay->composition = gst_video_overlay_composition_new (rectangle);
+      gst_video_overlay_rectangle_unref (rectangle);
+    }
+    x += glyph->advance;
+  }
+
+  return TRUE;
+}
+
+/* FIXME: orcify
+ * Shades @n contiguous bytes. Kept as a plain loop over a single line so
+ * that the compiler can vectorize it */
+static inline void
+gst_base_text_overlay_shade_line (guint8 * p, gint n, gint shading_val)
+{
+  gint i, tmp;
+
+  for (i = 0; i < n; i++) {
+    tmp = p[i] + shading_val;
+    p[i] = CLAMP (tmp, 0, 255);
+  }
 }
 
 static inline void
 gst_base_text_overlay_shade_planar_Y (GstBaseTextOverlay * overlay,
     GstVideoFrame * dest, gint x0, gint x1, gint y0, gint y1)
 {
-  gint i, j, dest_stride;
+  gint i, dest_stride;
   guint8 *dest_ptr;
 
   dest_stride = dest->info.stride[0];
   dest_ptr = dest->data[0];
 
   for (i = y0; i < y1; ++i) {
-    for (j = x0; j < x1; ++j) {
-      gint y = dest_ptr[(i * dest_stride) + j] + overlay->shading_value;
-
-      dest_ptr[(i * dest_stride) + j] = CLAMP (y, 0, 255);
-    }
+    gst_base_text_overlay_shade_line (dest_ptr + (i * dest_stride) + x0,
+        x1 - x0, overlay->shading_value);
   }
 }
 
@@ -1416,13 +1715,14 @@ static inline void
 gst_base_text_overlay_shade_packed_Y (GstBaseTextOverlay * overlay,
     GstVideoFrame * dest, gint x0, gint x1, gint y0, gint y1)
 {
-  gint i, j;
+  gint i, j, y, shading_val;
   guint dest_stride, pixel_stride;
-  guint8 *dest_ptr;
+  guint8 *dest_ptr, *p;
 
   dest_stride = GST_VIDEO_FRAME_COMP_STRIDE (dest, 0);
   dest_ptr = GST_VIDEO_FRAME_COMP_DATA (dest, 0);
   pixel_stride = GST_VIDEO_FRAME_COMP_PSTRIDE (dest, 0);
+  shading_val = overlay->shading_value;
 
   if (x0 != 0)
     x0 = GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (dest->info.finfo, 0, x0);
@@ -1435,14 +1735,11 @@ gst_base_text_overlay_shade_packed_Y (GstBaseTextOverlay * overlay,
     y1 = GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (dest->info.finfo, 0, y1);
 
   for (i = y0; i < y1; i++) {
+    p = dest_ptr + (i * dest_stride) + x0 * pixel_stride;
     for (j = x0; j < x1; j++) {
-      gint y;
-      gint y_pos;
-
-      y_pos = (i * dest_stride) + j * pixel_stride;
-      y = dest_ptr[y_pos] + overlay->shading_value;
-
-      dest_ptr[y_pos] = CLAMP (y, 0, 255);
+      y = *p + shading_val;
+      *p = CLAMP (y, 0, 255);
+      p += pixel_stride;
     }
   }
 }
@@ -1454,47 +1751,33 @@ static inline void
 gst_base_text_overlay_shade_xRGB (GstBaseTextOverlay * overlay,
     GstVideoFrame * dest, gint x0, gint x1, gint y0, gint y1)
 {
-  gint i, j;
+  gint i, stride;
   guint8 *dest_ptr;
 
-  dest_ptr = dest->data[0];
+  dest_ptr = GST_VIDEO_FRAME_PLANE_DATA (dest, 0);
+  stride = GST_VIDEO_FRAME_PLANE_STRIDE (dest, 0);
 
+  /* the padding byte can be shaded along, so whole lines can be done */
   for (i = y0; i < y1; i++) {
-    for (j = x0; j < x1; j++) {
-      gint y, y_pos, k;
-
-      y_pos = (i * 4 * overlay->width) + j * 4;
-      for (k = 0; k < 4; k++) {
-        y = dest_ptr[y_pos + k] + overlay->shading_value;
-        dest_ptr[y_pos + k] = CLAMP (y, 0, 255);
-      }
-    }
+    gst_base_text_overlay_shade_line (dest_ptr + (i * stride) + x0 * 4,
+        (x1 - x0) * 4, overlay->shading_value);
   }
 }
 
-/* FIXME: orcify */
 static void
 gst_base_text_overlay_shade_rgb24 (GstBaseTextOverlay * overlay,
     GstVideoFrame * frame, gint x0, gint x1, gint y0, gint y1)
 {
   const int pstride = 3;
-  gint y, x, stride, shading_val, tmp;
+  gint y, stride;
   guint8 *p;
 
-  shading_val = overlay->shading_value;
+  p = GST_VIDEO_FRAME_PLANE_DATA (frame, 0);
   stride = GST_VIDEO_FRAME_PLANE_STRIDE (frame, 0);
 
   for (y = y0; y < y1; ++y) {
-    p = GST_VIDEO_FRAME_PLANE_DATA (frame, 0);
-    p += (y * stride) + (x0 * pstride);
-    for (x = x0; x < x1; ++x) {
-      tmp = *p + shading_val;
-      *p++ = CLAMP (tmp, 0, 255);
-      tmp = *p + shading_val;
-      *p++ = CLAMP (tmp, 0, 255);
-      tmp = *p + shading_val;
-      *p++ = CLAMP (tmp, 0, 255);
-    }
+    gst_base_text_overlay_shade_line (p + (y * stride) + (x0 * pstride),
+        (x1 - x0) * pstride, overlay->shading_value);
   }
 }
 
@@ -1531,19 +1814,23 @@ static inline void \
 gst_base_text_overlay_shade_##name (GstBaseTextOverlay * overlay, GstVideoFrame * dest, \
 gint x0, gint x1, gint y0, gint y1) \
 { \
-  gint i, j;\
-  guint8 *dest_ptr;\
+  gint i, j, tmp, stride, shading_val;\
+  guint8 *dest_ptr, *p;\
   \
-  dest_ptr = dest->data[0];\
+  dest_ptr = GST_VIDEO_FRAME_PLANE_DATA (dest, 0);\
+  stride = GST_VIDEO_FRAME_PLANE_STRIDE (dest, 0);\
+  shading_val = overlay->shading_value;\
   \
   for (i = y0; i < y1; i++) {\
+    p = dest_ptr + (i * stride) + x0 * 4 + OFFSET;\
     for (j = x0; j < x1; j++) {\
-      gint y, y_pos, k;\
-      y_pos = (i * 4 * overlay->width) + j * 4;\
-      for (k = OFFSET; k < 3+OFFSET; k++) {\
-        y = dest_ptr[y_pos + k] + overlay->shading_value;\
-        dest_ptr[y_pos + k] = CLAMP (y, 0, 255);\
-      }\
+      tmp = p[0] + shading_val;\
+      p[0] = CLAMP (tmp, 0, 255);\
+      tmp = p[1] + shading_val;\
+      p[1] = CLAMP (tmp, 0, 255);\
+      tmp = p[2] + shading_val;\
+      p[2] = CLAMP (tmp, 0, 255);\
+      p += 4;\
     }\
   }\
 }
@@ -1578,12 +1865,17 @@ gst_base_text_overlay_render_text (GstBaseTextOverlay * overlay,
 
   /* FIXME: should we check for UTF-8 here? */
 
+  /* cleared before rendering, so that changes made while rendering from
+   * the text chain cause another render */
+  overlay->need_render = FALSE;
+
   GST_DEBUG ("Rendering '%s'", string);
-  gst_base_text_overlay_render_pangocairo (overlay, string, textlen);
+  if (!gst_base_text_overlay_render_glyphs (overlay, string, textlen)) {
+    gst_base_text_overlay_render_pangocairo (overlay, string, textlen);
+    gst_base_text_overlay_set_composition (overlay);
+  }
 
   g_free (string);
-
-  overlay->need_render = FALSE;
 }
 
 /* FIXME: should probably be relative to width/height (adjusted for PAR) */
@@ -1953,6 +2245,62 @@ gst_base_text_overlay_video_query (GstPad * pad, GstObject * parent,
   return ret;
 }
 
+static void
+gst_base_text_overlay_render_text_buffer (GstBaseTextOverlay * overlay,
+    GstBuffer * buffer)
+{
+  GstMapInfo map;
+  gchar *in_text, *text;
+  gsize in_size;
+
+  gst_buffer_map (buffer, &map, GST_MAP_READ);
+  in_text = (gchar *) map.data;
+  in_size = map.size;
+
+  if (in_size > 0) {
+    /* g_markup_escape_text() absolutely requires valid UTF8 input, it
+     * might crash otherwise. We don't fall back on GST_SUBTITLE_ENCODING
+     * here on purpose, this is something that needs fixing upstream */
+    if (!g_utf8_validate (in_text, in_size, NULL)) {
+      const gchar *end = NULL;
+
+      GST_WARNING_OBJECT (overlay, "received invalid UTF-8");
+      in_text = g_strndup (in_text, in_size);
+      while (!g_utf8_validate (in_text, in_size, &end) && end)
+        *((gchar *) end) = '*';
+    }
+
+    /* Get the string */
+    if (overlay->have_pango_markup) {
+      text = g_strndup (in_text, in_size);
+    } else {
+      text = g_markup_escape_text (in_text, in_size);
+    }
+
+    if (text != NULL && *text != '\0') {
+      gint text_len = strlen (text);
+
+      while (text_len > 0 && (text[text_len - 1] == '\n' ||
+              text[text_len - 1] == '\r')) {
+        --text_len;
+      }
+      GST_DEBUG_OBJECT (overlay, "Rendering text '%*s'", text_len, text);
+      gst_base_text_overlay_render_text (overlay, text, text_len);
+    } else {
+      GST_DEBUG_OBJECT (overlay, "No text to render (empty buffer)");
+      gst_base_text_overlay_render_text (overlay, " ", 1);
+    }
+    g_free (text);
+    if (in_text != (gchar *) map.data)
+      g_free (in_text);
+  } else {
+    GST_DEBUG_OBJECT (overlay, "No text to render (empty buffer)");
+    gst_base_text_overlay_render_text (overlay, " ", 1);
+  }
+
+  gst_buffer_unmap (buffer, &map);
+}
+
 /* Called with lock held */
 static void
 gst_base_text_overlay_pop_text (GstBaseTextOverlay * overlay)
@@ -2039,12 +2387,31 @@ gst_base_text_overlay_text_chain (GstPad * pad, GstObject * parent,
       }
     }
 
+    /* That's a new text buffer we need to render */
+    overlay->need_render = TRUE;
+
+    /* Render it right away from this thread, the video chain then only has
+     * to blend or attach the composition once the text becomes current.
+     * Nothing uses the previous composition anymore at this point since
+     * its text buffer is gone. Without video caps we don't know the size
+     * yet, leave it to the video chain then. */
+    if (overlay->width > 0 && overlay->height > 0) {
+      GST_BASE_TEXT_OVERLAY_UNLOCK (overlay);
+      gst_base_text_overlay_render_text_buffer (overlay, buffer);
+      GST_BASE_TEXT_OVERLAY_LOCK (overlay);
+
+      if (overlay->text_flushing) {
+        GST_BASE_TEXT_OVERLAY_UNLOCK (overlay);
+        gst_buffer_unref (buffer);
+        ret = GST_FLOW_FLUSHING;
+        goto beach;
+      }
+    }
+
     if (GST_BUFFER_TIMESTAMP_IS_VALID (buffer))
       overlay->text_segment.position = clip_start;
 
     overlay->text_buffer = buffer;
-    /* That's a new text buffer we need to render */
-    overlay->need_render = TRUE;
 
     /* in case the video chain is waiting for a text buffer, wake it up */
     GST_BASE_TEXT_OVERLAY_BROADCAST (overlay);
@@ -2233,55 +2600,9 @@ wait_for_text_buf:
         /* Push the video frame */
         ret = gst_pad_push (overlay->srcpad, buffer);
       } else {
-        GstMapInfo map;
-        gchar *in_text;
-        gsize in_size;
-
-        gst_buffer_map (overlay->text_buffer, &map, GST_MAP_READ);
-        in_text = (gchar *) map.data;
-        in_size = map.size;
-
-        if (in_size > 0) {
-          /* g_markup_escape_text() absolutely requires valid UTF8 input, it
-           * might crash otherwise. We don't fall back on GST_SUBTITLE_ENCODING
-           * here on purpose, this is something that needs fixing upstream */
-          if (!g_utf8_validate (in_text, in_size, NULL)) {
-            const gchar *end = NULL;
-
-            GST_WARNING_OBJECT (overlay, "received invalid UTF-8");
-            in_text = g_strndup (in_text, in_size);
-            while (!g_utf8_validate (in_text, in_size, &end) && end)
-              *((gchar *) end) = '*';
-          }
-
-          /* Get the string */
-          if (overlay->have_pango_markup) {
-            text = g_strndup (in_text, in_size);
-          } else {
-            text = g_markup_escape_text (in_text, in_size);
-          }
-
-          if (text != NULL && *text != '\0') {
-            gint text_len = strlen (text);
-
-            while (text_len > 0 && (text[text_len - 1] == '\n' ||
-                    text[text_len - 1] == '\r')) {
-              --text_len;
-            }
-            GST_DEBUG_OBJECT (overlay, "Rendering text '%*s'", text_len, text);
-            gst_base_text_overlay_render_text (overlay, text, text_len);
-          } else {
-            GST_DEBUG_OBJECT (overlay, "No text to render (empty buffer)");
-            gst_base_text_overlay_render_text (overlay, " ", 1);
-          }
-          if (in_text != (gchar *) map.data)
-            g_free (in_text);
-        } else {
-          GST_DEBUG_OBJECT (overlay, "No text to render (empty buffer)");
-          gst_base_text_overlay_render_text (overlay, " ", 1);
-        }
-
-        gst_buffer_unmap (overlay->text_buffer, &map);
+        if (overlay->need_render)
+          gst_base_text_overlay_render_text_buffer (overlay,
+              overlay->text_buffer);
 
         GST_BASE_TEXT_OVERLAY_UNLOCK (overlay);
         ret = gst_base_text_overlay_push_frame (overlay, buffer);
@@ -22,6 +22,7 @@ G_BEGIN_DECLS
 
 typedef struct _GstBaseTextOverlay      GstBaseTextOverlay;
 typedef struct _GstBaseTextOverlayClass GstBaseTextOverlayClass;
+typedef struct _GstBaseTextOverlayGlyph GstBaseTextOverlayGlyph;
 
 /**
  * GstBaseTextOverlayVAlign:
@@ -144,7 +145,10 @@ struct _GstBaseTextOverlay {
     GstBuffer               *text_image;
     gint                     image_width;
     gint                     image_height;
+    gint                     image_xoffset;  /* of text_image in the box */
+    gint                     box_width;      /* used for alignment */
     gint                     baseline_y;
+    gdouble                  image_advance;  /* logical width of the text */
 
     gboolean                 auto_adjust_size;
     gboolean                 need_render;
@@ -157,6 +161,12 @@ struct _GstBaseTextOverlay {
     gboolean                 attach_compo_to_buffer;
 
     GstVideoOverlayComposition *composition;
+
+    /* set by subclasses that only show digits and separators, which are
+     * then composed from individually rendered glyphs */
+    gboolean                 use_glyph_atlas;
+    gchar                   *glyph_atlas_key;
+    GstBaseTextOverlayGlyph *glyphs;
 };
 
 struct _GstBaseTextOverlayClass {
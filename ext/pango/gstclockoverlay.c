@@ -200,6 +200,7 @@ gst_clock_overlay_init (GstClockOverlay * overlay)
 
   textoverlay->valign = GST_BASE_TEXT_OVERLAY_VALIGN_TOP;
   textoverlay->halign = GST_BASE_TEXT_OVERLAY_HALIGN_LEFT;
+  textoverlay->use_glyph_atlas = TRUE;
 
   overlay->format = g_strdup (DEFAULT_PROP_TIMEFORMAT);
 }
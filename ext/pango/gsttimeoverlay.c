@@ -147,4 +147,5 @@ gst_time_overlay_init (GstTimeOverlay * overlay)
 
   textoverlay->valign = GST_BASE_TEXT_OVERLAY_VALIGN_TOP;
   textoverlay->halign = GST_BASE_TEXT_OVERLAY_HALIGN_LEFT;
+  textoverlay->use_glyph_atlas = TRUE;
 }
@@ -64,6 +64,9 @@ GST_DEBUG_CATEGORY_EXTERN (GST_CAT_PERFORMANCE);
    and does not leave theoraenc. */
 #define GST_CUSTOM_FLOW_DROP GST_FLOW_CUSTOM_SUCCESS_1
 
+/* border in pixels that libtheora keeps around the luma plane */
+#define THEORA_DEC_PLANE_BORDER 16
+
 enum
 {
   PROP_0,
@@ -661,11 +664,16 @@ theora_handle_image (GstTheoraDec * dec, th_ycbcr_buffer buf,
         * buf[comp].stride;
     src += (width == pic_width) ? offset_x : offset_x / 2;
 
-    for (i = 0; i < height; i++) {
-      memcpy (dest, src, width);
+    if (stride == buf[comp].stride) {
+      /* same layout as the libtheora plane, copy all lines at once */
+      memcpy (dest, src, (height - 1) * stride + width);
+    } else {
+      for (i = 0; i < height; i++) {
+        memcpy (dest, src, width);
 
-      dest += stride;
-      src += buf[comp].stride;
+        dest += stride;
+        src += buf[comp].stride;
+      }
     }
   }
   gst_video_frame_unmap (&vframe);
@@ -699,6 +707,11 @@ theora_handle_data_packet (GstTheoraDec * dec, ogg_packet * packet,
     dec->need_keyframe = FALSE;
   } else if (G_UNLIKELY (dec->need_keyframe)) {
     goto dropping;
+  } else if (frame && GST_VIDEO_CODEC_FRAME_IS_SKIP_NON_KEY (frame)) {
+    /* all theora frames are predicted from the previous one, so after
+     * skipping one we can only continue at the next keyframe */
+    dec->need_keyframe = TRUE;
+    goto skipping;
   }
 
   GST_DEBUG_OBJECT (dec, "parsing data packet");
@@ -707,9 +720,9 @@ theora_handle_data_packet (GstTheoraDec * dec, ogg_packet * packet,
   if (G_UNLIKELY (th_decode_packetin (dec->decoder, packet, &gp) < 0))
     goto decode_error;
 
-  if (frame &&
-      (gst_video_decoder_get_max_decode_time (GST_VIDEO_DECODER (dec),
-              frame) < 0))
+  /* the frame was needed as a reference but we are too late to output it,
+   * skip the postprocessing and copying */
+  if (frame && GST_VIDEO_CODEC_FRAME_IS_SKIP_NON_REF (frame))
     goto dropping_qos;
 
   /* this does postprocessing and set up the decoded frame
@@ -737,6 +750,11 @@ dropping:
     GST_WARNING_OBJECT (dec, "dropping frame because we need a keyframe");
     return GST_CUSTOM_FLOW_DROP;
   }
+skipping:
+  {
+    GST_DEBUG_OBJECT (dec, "skipping non-keyframe");
+    return GST_CUSTOM_FLOW_DROP;
+  }
 dropping_qos:
   {
     GST_WARNING_OBJECT (dec, "dropping frame because of QoS");
@@ -859,6 +877,24 @@ theora_dec_decide_allocation (GstVideoDecoder * decoder, GstQuery * query)
     dec->can_crop =
         gst_query_find_allocation_meta (query, GST_VIDEO_CROP_META_API_TYPE,
         NULL);
+
+    /* libtheora decodes into planes with a border around the frame. Pad
+     * the buffers of the pool the same way so that the strides match and
+     * each plane can be copied with one memcpy */
+    if (gst_buffer_pool_has_option (pool,
+            GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT)) {
+      GstVideoAlignment align;
+      gint width;
+
+      width = dec->can_crop ? dec->info.frame_width : state->info.width;
+
+      gst_video_alignment_reset (&align);
+      align.padding_right =
+          dec->info.frame_width + 2 * THEORA_DEC_PLANE_BORDER - width;
+      gst_buffer_pool_config_add_option (config,
+          GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT);
+      gst_buffer_pool_config_set_video_alignment (config, &align);
+    }
   }
 
   if (dec->can_crop) {
@@ -42,6 +42,12 @@
  * bitrate (CBR) stream while setting the quality property will produce a
  * variable bitrate (VBR) stream.
  *
+ * For live encoding, #GstTheoraEnc::adaptive-speed raises the speed level
+ * above #GstTheoraEnc::speed-level while encoding a frame takes longer than
+ * its duration, and lowers it again when there is enough headroom. With
+ * #GstTheoraEnc::adaptive-max-lag, frames are dropped once encoding falls
+ * further behind than that.
+ *
  * <refsect2>
  * <title>Example pipeline</title>
  * |[
@@ -115,6 +121,11 @@ _ilog (unsigned int v)
 #define THEORA_DEF_RATE_BUFFER          0
 #define THEORA_DEF_MULTIPASS_CACHE_FILE NULL
 #define THEORA_DEF_MULTIPASS_MODE       MULTIPASS_MODE_SINGLE_PASS
+#define THEORA_DEF_ADAPTIVE_SPEED       FALSE
+#define THEORA_DEF_ADAPTIVE_MAX_LAG     0
+
+/* frames to encode after a speed level change before looking again */
+#define ADAPTIVE_SPEED_SETTLE           16
 enum
 {
   PROP_0,
@@ -130,7 +141,9 @@ enum
   PROP_CAP_UNDERFLOW,
   PROP_RATE_BUFFER,
   PROP_MULTIPASS_CACHE_FILE,
-  PROP_MULTIPASS_MODE
+  PROP_MULTIPASS_MODE,
+  PROP_ADAPTIVE_SPEED,
+  PROP_ADAPTIVE_MAX_LAG
       /* FILL ME */
 };
 
@@ -297,6 +310,35 @@ gst_theora_enc_class_init (GstTheoraEncClass * klass)
           THEORA_DEF_MULTIPASS_MODE,
           (GParamFlags) G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTheoraEnc:adaptive-speed:
+   *
+   * Raise the speed level when encoding can't keep up with the frame rate,
+   * and lower it again down to speed-level when it can.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_ADAPTIVE_SPEED,
+      g_param_spec_boolean ("adaptive-speed", "Adaptive speed",
+          "Adapt the speed level to keep up with the frame rate",
+          THEORA_DEF_ADAPTIVE_SPEED,
+          (GParamFlags) G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstTheoraEnc:adaptive-max-lag:
+   *
+   * With adaptive-speed, how far encoding may fall behind the frame rate
+   * before frames are dropped. Dropped frames are sent as empty packets,
+   * which repeat the previous frame.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_ADAPTIVE_MAX_LAG,
+      g_param_spec_uint64 ("adaptive-max-lag", "Adaptive max lag",
+          "Drop frames when adaptive encoding falls further behind than this "
+          "(in ns, 0 = never drop)", 0, G_MAXUINT64,
+          THEORA_DEF_ADAPTIVE_MAX_LAG,
+          (GParamFlags) G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   GST_DEBUG_CATEGORY_INIT (theoraenc_debug, "theoraenc", 0, "Theora encoder");
 }
 
@@ -318,6 +360,9 @@ gst_theora_enc_init (GstTheoraEnc * enc)
 
   enc->multipass_mode = THEORA_DEF_MULTIPASS_MODE;
   enc->multipass_cache_file = THEORA_DEF_MULTIPASS_CACHE_FILE;
+
+  enc->adaptive_speed = THEORA_DEF_ADAPTIVE_SPEED;
+  enc->adaptive_max_lag = THEORA_DEF_ADAPTIVE_MAX_LAG;
 }
 
 static void
@@ -375,6 +420,14 @@ theora_enc_reset (GstTheoraEnc * enc)
   g_assert (enc->encoder != NULL);
   th_encode_ctl (enc->encoder, TH_ENCCTL_SET_SPLEVEL, &enc->speed_level,
       sizeof (enc->speed_level));
+  enc->cur_speed_level = enc->speed_level;
+  if (th_encode_ctl (enc->encoder, TH_ENCCTL_GET_SPLEVEL_MAX,
+          &enc->speed_level_max, sizeof (enc->speed_level_max)) != 0)
+    enc->speed_level_max = enc->speed_level;
+  enc->encode_avg = 0;
+  enc->lag = 0;
+  enc->frames_since_change = 0;
+  enc->dups_pending = 0;
   th_encode_ctl (enc->encoder, TH_ENCCTL_SET_VP3_COMPATIBLE,
       &enc->vp3_compatible, sizeof (enc->vp3_compatible));
 
@@ -625,6 +678,12 @@ theora_push_packet (GstTheoraEnc * enc, ogg_packet * packet)
   benc = GST_VIDEO_ENCODER (enc);
 
   frame = gst_video_encoder_get_oldest_frame (benc);
+  if (frame == NULL) {
+    /* duplicates queued for frames that never came before EOS */
+    GST_DEBUG_OBJECT (enc, "no frame for packet, dropping it");
+    return GST_FLOW_OK;
+  }
+
   if (gst_video_encoder_allocate_output_frame (benc, frame,
           packet->bytes) != GST_FLOW_OK) {
     GST_WARNING_OBJECT (enc, "Could not allocate buffer");
@@ -828,6 +887,57 @@ theora_enc_reset_ts (GstTheoraEnc * enc, GstClockTime running_time, gint pfn)
   enc->pfn_offset = pfn;
 }
 
+static GstClockTime
+theora_enc_frame_duration (GstTheoraEnc * enc, GstVideoCodecFrame * frame)
+{
+  if (GST_CLOCK_TIME_IS_VALID (frame->duration))
+    return frame->duration;
+  if (enc->fps_n > 0)
+    return gst_util_uint64_scale_int (GST_SECOND, enc->fps_d, enc->fps_n);
+  return GST_CLOCK_TIME_NONE;
+}
+
+/* account @elapsed encoding time for a frame of @duration and move the
+ * speed level towards what keeps up with realtime */
+static void
+theora_enc_adapt_speed (GstTheoraEnc * enc, GstClockTime elapsed,
+    GstClockTime duration)
+{
+  gint level = enc->cur_speed_level;
+
+  if (elapsed > duration)
+    enc->lag += elapsed - duration;
+  else
+    enc->lag -= MIN (enc->lag, duration - elapsed);
+
+  /* average over the last 8 frames or so */
+  if (enc->encode_avg == 0)
+    enc->encode_avg = elapsed;
+  else
+    enc->encode_avg = (enc->encode_avg * 7 + elapsed) / 8;
+
+  if (++enc->frames_since_change < ADAPTIVE_SPEED_SETTLE)
+    return;
+
+  if (enc->encode_avg > duration / 10 * 9 && level < enc->speed_level_max)
+    level++;
+  else if (enc->encode_avg < duration / 2 && enc->lag == 0 &&
+      level > enc->speed_level)
+    level--;
+
+  if (level == enc->cur_speed_level)
+    return;
+
+  GST_DEBUG_OBJECT (enc, "encoding takes %" GST_TIME_FORMAT " for frames of %"
+      GST_TIME_FORMAT ", %" GST_TIME_FORMAT " behind, speed level %d",
+      GST_TIME_ARGS (enc->encode_avg), GST_TIME_ARGS (duration),
+      GST_TIME_ARGS (enc->lag), level);
+
+  th_encode_ctl (enc->encoder, TH_ENCCTL_SET_SPLEVEL, &level, sizeof (level));
+  enc->cur_speed_level = level;
+  enc->frames_since_change = 0;
+}
+
 static GstBuffer *
 theora_enc_buffer_from_header_packet (GstTheoraEnc * enc, ogg_packet * packet)
 {
@@ -951,6 +1061,40 @@ theora_enc_handle_frame (GstVideoEncoder * benc, GstVideoCodecFrame * frame)
     th_ycbcr_buffer ycbcr;
     gint res, keyframe_interval;
     GstVideoFrame vframe;
+    GstClockTime duration = GST_CLOCK_TIME_NONE, start = 0;
+
+    if (enc->adaptive_speed)
+      duration = theora_enc_frame_duration (enc, frame);
+
+    /* this frame was dropped, send the duplicate libtheora queued for it
+     * with the previous frame */
+    if (enc->dups_pending > 0) {
+      GST_DEBUG_OBJECT (enc, "%" GST_TIME_FORMAT " behind, dropping frame",
+          GST_TIME_ARGS (enc->lag));
+      enc->dups_pending--;
+      if (GST_CLOCK_TIME_IS_VALID (duration))
+        enc->lag -= MIN (enc->lag, duration);
+      ret = GST_FLOW_OK;
+      if (th_encode_packetout (enc->encoder, 0, &op))
+        ret = theora_push_packet (enc, &op);
+      goto beach;
+    }
+
+    /* too far behind, drop the next frames to catch up. libtheora sends
+     * them as duplicates of this one, which decoders repeat, and counts them
+     * for the keyframe distance so that the granulepos stays valid */
+    if (GST_CLOCK_TIME_IS_VALID (duration) && duration > 0 &&
+        enc->adaptive_max_lag > 0 && enc->lag > enc->adaptive_max_lag &&
+        enc->packetno > 0 && !force_keyframe &&
+        enc->multipass_mode == MULTIPASS_MODE_SINGLE_PASS) {
+      gint max_dups, dups;
+
+      max_dups = enc->keyframe_auto ? enc->keyframe_force : enc->keyframe_freq;
+      dups = (gint) MIN (MAX (enc->lag / duration, 1), max_dups - 1);
+      if (dups > 0 && th_encode_ctl (enc->encoder, TH_ENCCTL_SET_DUP_COUNT,
+              &dups, sizeof (dups)) == 0)
+        enc->dups_pending = dups;
+    }
 
     if (force_keyframe) {
       /* if we want a keyframe, temporarily reset the max keyframe interval
@@ -969,6 +1113,9 @@ theora_enc_handle_frame (GstVideoEncoder * benc, GstVideoCodecFrame * frame)
       }
     }
 
+    if (GST_CLOCK_TIME_IS_VALID (duration))
+      start = gst_util_get_timestamp ();
+
     gst_video_frame_map (&vframe, &enc->input_state->info, frame->input_buffer,
         GST_MAP_READ);
     theora_enc_init_buffer (ycbcr, &vframe);
@@ -976,6 +1123,10 @@ theora_enc_handle_frame (GstVideoEncoder * benc, GstVideoCodecFrame * frame)
     res = th_encode_ycbcr_in (enc->encoder, ycbcr);
     gst_video_frame_unmap (&vframe);
 
+    if (GST_CLOCK_TIME_IS_VALID (duration))
+      theora_enc_adapt_speed (enc, gst_util_get_timestamp () - start,
+          duration);
+
     /* none of the failure cases can happen here */
     g_assert (res == 0);
 
@@ -1002,6 +1153,10 @@ theora_enc_handle_frame (GstVideoEncoder * benc, GstVideoCodecFrame * frame)
       ret = theora_push_packet (enc, &op);
       if (ret != GST_FLOW_OK)
         goto beach;
+
+      /* the duplicates are sent with the frames they replace */
+      if (enc->dups_pending > 0)
+        break;
     }
   }
 
@@ -1042,6 +1197,7 @@ theora_enc_finish (GstVideoEncoder * benc)
     while (th_encode_packetout (enc->encoder, 1, &op)) {
       theora_push_packet (enc, &op);
     }
+    enc->dups_pending = 0;
   }
   if (enc->initialised && enc->multipass_cache_fd
       && enc->multipass_mode == MULTIPASS_MODE_FIRST_PASS)
@@ -1120,6 +1276,12 @@ theora_enc_set_property (GObject * object, guint prop_id,
     case PROP_MULTIPASS_MODE:
       enc->multipass_mode = g_value_get_enum (value);
       break;
+    case PROP_ADAPTIVE_SPEED:
+      enc->adaptive_speed = g_value_get_boolean (value);
+      break;
+    case PROP_ADAPTIVE_MAX_LAG:
+      enc->adaptive_max_lag = g_value_get_uint64 (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1176,6 +1338,12 @@ theora_enc_get_property (GObject * object, guint prop_id,
     case PROP_MULTIPASS_MODE:
       g_value_set_enum (value, enc->multipass_mode);
       break;
+    case PROP_ADAPTIVE_SPEED:
+      g_value_set_boolean (value, enc->adaptive_speed);
+      break;
+    case PROP_ADAPTIVE_MAX_LAG:
+      g_value_set_uint64 (value, enc->adaptive_max_lag);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
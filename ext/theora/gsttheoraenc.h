@@ -100,6 +100,18 @@ struct _GstTheoraEnc
   gboolean cap_underflow;
   int rate_buffer;
 
+  gboolean adaptive_speed;
+  guint64 adaptive_max_lag;
+  gint cur_speed_level;
+  gint speed_level_max;
+  /* moving average of the time th_encode_ycbcr_in() takes */
+  GstClockTime encode_avg;
+  /* how far encoding fell behind the frame durations */
+  GstClockTime lag;
+  guint frames_since_change;
+  /* upcoming frames that get the duplicates libtheora queued */
+  gint dups_pending;
+
   GstTheoraEncMultipassMode multipass_mode;
   GIOChannel *multipass_cache_fd;
   GstAdapter *multipass_cache_adapter;
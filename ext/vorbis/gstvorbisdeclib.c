@@ -29,6 +29,7 @@
 #include <string.h>
 #include "gstvorbisdeclib.h"
 #include "gstvorbiscommon.h"
+#include "gstvorbisdecorc.h"
 
 #ifndef TREMOR
 /* These samples can be outside of the float -1.0 -- 1.0 range, this
@@ -49,13 +50,53 @@ copy_samples_s (vorbis_sample_t * out, vorbis_sample_t ** in, guint samples,
   out += samples;
   memcpy (out, in[1], samples * sizeof (float));
 #else
+  vorbis_orc_interleave_2ch_f32 ((guint64 *) out, in[0], in[1], samples);
+#endif
+}
+
+/* 5.1 and 7.1, with the channel pointers reordered up front so the
+ * compiler can unroll and vectorize the interleaving stores */
+static void
+copy_samples_6 (vorbis_sample_t * out, vorbis_sample_t ** in, guint samples,
+    gint channels)
+{
+  const gint *map = gst_vorbis_reorder_map[5];
+  const vorbis_sample_t *c0 = in[map[0]], *c1 = in[map[1]], *c2 = in[map[2]];
+  const vorbis_sample_t *c3 = in[map[3]], *c4 = in[map[4]], *c5 = in[map[5]];
   gint j;
 
   for (j = 0; j < samples; j++) {
-    *out++ = in[0][j];
-    *out++ = in[1][j];
+    out[0] = c0[j];
+    out[1] = c1[j];
+    out[2] = c2[j];
+    out[3] = c3[j];
+    out[4] = c4[j];
+    out[5] = c5[j];
+    out += 6;
+  }
+}
+
+static void
+copy_samples_8 (vorbis_sample_t * out, vorbis_sample_t ** in, guint samples,
+    gint channels)
+{
+  const gint *map = gst_vorbis_reorder_map[7];
+  const vorbis_sample_t *c0 = in[map[0]], *c1 = in[map[1]], *c2 = in[map[2]];
+  const vorbis_sample_t *c3 = in[map[3]], *c4 = in[map[4]], *c5 = in[map[5]];
+  const vorbis_sample_t *c6 = in[map[6]], *c7 = in[map[7]];
+  gint j;
+
+  for (j = 0; j < samples; j++) {
+    out[0] = c0[j];
+    out[1] = c1[j];
+    out[2] = c2[j];
+    out[3] = c3[j];
+    out[4] = c4[j];
+    out[5] = c5[j];
+    out[6] = c6[j];
+    out[7] = c7[j];
+    out += 8;
   }
-#endif
 }
 
 static void
@@ -93,6 +134,14 @@ gst_vorbis_get_copy_sample_func (gint channels)
     case 2:
       f = copy_samples_s;
       break;
+#ifndef GST_VORBIS_DEC_SEQUENTIAL
+    case 6:
+      f = copy_samples_6;
+      break;
+    case 8:
+      f = copy_samples_8;
+      break;
+#endif
     default:
       f = copy_samples;
       break;
@@ -136,24 +185,64 @@ copy_samples_16_m (vorbis_sample_t * _out, vorbis_sample_t ** _in,
 {
   gint16 *out = (gint16 *) _out;
   ogg_int32_t **in = (ogg_int32_t **) _in;
+
+  vorbis_orc_convert_s16_s32 (out, in[0], samples);
+}
+
+static void
+copy_samples_16_s (vorbis_sample_t * _out, vorbis_sample_t ** _in,
+    guint samples, gint channels)
+{
+  gint16 *out = (gint16 *) _out;
+  ogg_int32_t **in = (ogg_int32_t **) _in;
+
+  vorbis_orc_interleave_2ch_s16_s32 ((guint32 *) out, in[0], in[1], samples);
+}
+
+static void
+copy_samples_16_6 (vorbis_sample_t * _out, vorbis_sample_t ** _in,
+    guint samples, gint channels)
+{
+  gint16 *out = (gint16 *) _out;
+  ogg_int32_t **in = (ogg_int32_t **) _in;
+  const gint *map = gst_vorbis_reorder_map[5];
+  const ogg_int32_t *c0 = in[map[0]], *c1 = in[map[1]], *c2 = in[map[2]];
+  const ogg_int32_t *c3 = in[map[3]], *c4 = in[map[4]], *c5 = in[map[5]];
   gint j;
 
   for (j = 0; j < samples; j++) {
-    *out++ = CLIP_TO_15 (in[0][j] >> 9);
+    out[0] = CLIP_TO_15 (c0[j] >> 9);
+    out[1] = CLIP_TO_15 (c1[j] >> 9);
+    out[2] = CLIP_TO_15 (c2[j] >> 9);
+    out[3] = CLIP_TO_15 (c3[j] >> 9);
+    out[4] = CLIP_TO_15 (c4[j] >> 9);
+    out[5] = CLIP_TO_15 (c5[j] >> 9);
+    out += 6;
   }
 }
 
 static void
-copy_samples_16_s (vorbis_sample_t * _out, vorbis_sample_t ** _in,
+copy_samples_16_8 (vorbis_sample_t * _out, vorbis_sample_t ** _in,
     guint samples, gint channels)
 {
   gint16 *out = (gint16 *) _out;
   ogg_int32_t **in = (ogg_int32_t **) _in;
+  const gint *map = gst_vorbis_reorder_map[7];
+  const ogg_int32_t *c0 = in[map[0]], *c1 = in[map[1]], *c2 = in[map[2]];
+  const ogg_int32_t *c3 = in[map[3]], *c4 = in[map[4]], *c5 = in[map[5]];
+  const ogg_int32_t *c6 = in[map[6]], *c7 = in[map[7]];
   gint j;
 
   for (j = 0; j < samples; j++) {
-    *out++ = CLIP_TO_15 (in[0][j] >> 9);
-    *out++ = CLIP_TO_15 (in[1][j] >> 9);
+    out[0] = CLIP_TO_15 (c0[j] >> 9);
+    out[1] = CLIP_TO_15 (c1[j] >> 9);
+    out[2] = CLIP_TO_15 (c2[j] >> 9);
+    out[3] = CLIP_TO_15 (c3[j] >> 9);
+    out[4] = CLIP_TO_15 (c4[j] >> 9);
+    out[5] = CLIP_TO_15 (c5[j] >> 9);
+    out[6] = CLIP_TO_15 (c6[j] >> 9);
+    out[7] = CLIP_TO_15 (c7[j] >> 9);
+    out += 8;
   }
 }
 
@@ -184,6 +273,12 @@ gst_vorbis_get_copy_sample_func (gint channels)
     case 2:
       f = copy_samples_16_s;
       break;
+    case 6:
+      f = copy_samples_16_6;
+      break;
+    case 8:
+      f = copy_samples_16_8;
+      break;
     default:
       f = copy_samples_16;
       break;
@@ -35,6 +35,10 @@
  * |[
  * gst-launch -v alsasrc ! audioconvert ! vorbisenc ! oggmux ! filesink location=alsasrc.ogg
  * ]| Record from a sound card using ALSA and encode to Ogg/Vorbis.
+ * |[
+ * gst-launch -v filesrc location=long.wav ! wavparse ! audioconvert ! vorbisenc chunk-duration=30000000000 n-threads=0 ! oggmux ! filesink location=long.ogg
+ * ]| Transcode a long file, encoding chunks of 30 seconds in parallel on
+ * all processors.
  * </refsect2>
  *
  * Last reviewed on 2006-03-01 (0.10.4)
@@ -84,7 +88,8 @@ enum
   ARG_MIN_BITRATE,
   ARG_QUALITY,
   ARG_MANAGED,
-  ARG_LAST_MESSAGE
+  ARG_LAST_MESSAGE,
+  ARG_CHUNK_DURATION
 };
 
 static GstFlowReturn gst_vorbis_enc_output_buffers (GstVorbisEnc * vorbisenc);
@@ -96,6 +101,14 @@ static GstFlowReturn gst_vorbis_enc_output_buffers (GstVorbisEnc * vorbisenc);
 #define QUALITY_DEFAULT         0.3
 #define LOWEST_BITRATE          6000    /* lowest allowed for a 8 kHz stream */
 #define HIGHEST_BITRATE         250001  /* highest allowed for a 44 kHz stream */
+#define CHUNK_DURATION_DEFAULT  0
+
+/* samples encoded before and after each chunk in parallel mode, so the
+ * encoders of neighbouring chunks settle on the same blocks around the
+ * chunk boundary */
+#define CHUNK_OVERLAP           8192
+/* distance from the chunk boundary to look for a common block */
+#define CHUNK_SPLICE_WINDOW     (CHUNK_OVERLAP / 4)
 
 static gboolean gst_vorbis_enc_start (GstAudioEncoder * enc);
 static gboolean gst_vorbis_enc_stop (GstAudioEncoder * enc);
@@ -109,8 +122,13 @@ static gboolean gst_vorbis_enc_sink_event (GstAudioEncoder * enc,
     GstEvent * event);
 
 static gboolean gst_vorbis_enc_setup (GstVorbisEnc * vorbisenc);
+static void gst_vorbis_enc_setup_chunks (GstVorbisEnc * vorbisenc);
+static void gst_vorbis_enc_free_chunks (GstVorbisEnc * vorbisenc);
+static GstFlowReturn gst_vorbis_enc_encode_chunks (GstVorbisEnc * vorbisenc,
+    GstBuffer * buffer);
 
 static void gst_vorbis_enc_dispose (GObject * object);
+static void gst_vorbis_enc_finalize (GObject * object);
 static void gst_vorbis_enc_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec);
 static void gst_vorbis_enc_set_property (GObject * object, guint prop_id,
@@ -134,6 +152,7 @@ gst_vorbis_enc_class_init (GstVorbisEncClass * klass)
   gobject_class->set_property = gst_vorbis_enc_set_property;
   gobject_class->get_property = gst_vorbis_enc_get_property;
   gobject_class->dispose = gst_vorbis_enc_dispose;
+  gobject_class->finalize = gst_vorbis_enc_finalize;
 
   g_object_class_install_property (G_OBJECT_CLASS (klass), ARG_MAX_BITRATE,
       g_param_spec_int ("max-bitrate", "Maximum Bitrate",
@@ -165,6 +184,23 @@ gst_vorbis_enc_class_init (GstVorbisEncClass * klass)
       g_param_spec_string ("last-message", "last-message",
           "The last status message", NULL,
           G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstVorbisEnc:chunk-duration:
+   *
+   * When not 0 and the upstream pipeline is not live, the input is split in
+   * chunks of this duration that are encoded by separate encoder instances
+   * on up to #GstAudioEncoder:n-threads threads.  The chunks are encoded
+   * with some overlap and the resulting packets are joined where the
+   * encoders of both chunks produced the same block, with granule
+   * positions relative to the start of the stream.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (G_OBJECT_CLASS (klass), ARG_CHUNK_DURATION,
+      g_param_spec_uint64 ("chunk-duration", "Chunk Duration",
+          "Duration of chunks encoded in parallel when not live, "
+          "0 to disable (in nanoseconds)", 0, G_MAXUINT64,
+          CHUNK_DURATION_DEFAULT, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&vorbis_enc_src_factory));
@@ -199,6 +235,10 @@ gst_vorbis_enc_init (GstVorbisEnc * vorbisenc)
   vorbisenc->quality = QUALITY_DEFAULT;
   vorbisenc->quality_set = FALSE;
   vorbisenc->last_message = NULL;
+  vorbisenc->chunk_duration = CHUNK_DURATION_DEFAULT;
+
+  g_mutex_init (&vorbisenc->lock);
+  g_cond_init (&vorbisenc->cond);
 
   /* arrange granulepos marking (and required perfect ts) */
   gst_audio_encoder_set_mark_granule (enc, TRUE);
@@ -218,6 +258,18 @@ gst_vorbis_enc_dispose (GObject * object)
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
 
+static void
+gst_vorbis_enc_finalize (GObject * object)
+{
+  GstVorbisEnc *vorbisenc = GST_VORBISENC (object);
+
+  gst_vorbis_enc_free_chunks (vorbisenc);
+  g_mutex_clear (&vorbisenc->lock);
+  g_cond_clear (&vorbisenc->cond);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
 static gboolean
 gst_vorbis_enc_start (GstAudioEncoder * enc)
 {
@@ -246,6 +298,8 @@ gst_vorbis_enc_stop (GstAudioEncoder * enc)
 
   gst_tag_setter_reset_tags (GST_TAG_SETTER (enc));
 
+  gst_vorbis_enc_free_chunks (vorbisenc);
+
   return TRUE;
 }
 
@@ -333,6 +387,8 @@ gst_vorbis_enc_set_format (GstAudioEncoder * enc, GstAudioInfo * info)
   if (!gst_vorbis_enc_setup (vorbisenc))
     return FALSE;
 
+  gst_vorbis_enc_setup_chunks (vorbisenc);
+
   /* feedback to base class */
   gst_audio_encoder_set_latency (enc,
       gst_vorbis_enc_get_latency (vorbisenc),
@@ -454,30 +510,22 @@ update_start_message (GstVorbisEnc * vorbisenc)
   g_object_notify (G_OBJECT (vorbisenc), "last_message");
 }
 
+/* configure @vi for the current properties and input format, this is also
+ * used for the encoders of parallel chunks so must not modify @vorbisenc */
 static gboolean
-gst_vorbis_enc_setup (GstVorbisEnc * vorbisenc)
+gst_vorbis_enc_setup_info (GstVorbisEnc * vorbisenc, vorbis_info * vi)
 {
-
-  GST_LOG_OBJECT (vorbisenc, "setup");
-
-  if (vorbisenc->bitrate < 0 && vorbisenc->min_bitrate < 0
-      && vorbisenc->max_bitrate < 0) {
-    vorbisenc->quality_set = TRUE;
-  }
-
-  update_start_message (vorbisenc);
-
   /* choose an encoding mode */
   /* (mode 0: 44kHz stereo uncoupled, roughly 128kbps VBR) */
-  vorbis_info_init (&vorbisenc->vi);
+  vorbis_info_init (vi);
 
   if (vorbisenc->quality_set) {
-    if (vorbis_encode_setup_vbr (&vorbisenc->vi,
+    if (vorbis_encode_setup_vbr (vi,
             vorbisenc->channels, vorbisenc->frequency,
             vorbisenc->quality) != 0) {
       GST_ERROR_OBJECT (vorbisenc,
           "vorbisenc: initialisation failed: invalid parameters for quality");
-      vorbis_info_clear (&vorbisenc->vi);
+      vorbis_info_clear (vi);
       return FALSE;
     }
 
@@ -485,13 +533,13 @@ gst_vorbis_enc_setup (GstVorbisEnc * vorbisenc)
     if (vorbisenc->max_bitrate > 0 || vorbisenc->min_bitrate > 0) {
       struct ovectl_ratemanage_arg ai;
 
-      vorbis_encode_ctl (&vorbisenc->vi, OV_ECTL_RATEMANAGE_GET, &ai);
+      vorbis_encode_ctl (vi, OV_ECTL_RATEMANAGE_GET, &ai);
 
       ai.bitrate_hard_min = vorbisenc->min_bitrate;
       ai.bitrate_hard_max = vorbisenc->max_bitrate;
       ai.management_active = 1;
 
-      vorbis_encode_ctl (&vorbisenc->vi, OV_ECTL_RATEMANAGE_SET, &ai);
+      vorbis_encode_ctl (vi, OV_ECTL_RATEMANAGE_SET, &ai);
     }
   } else {
     long min_bitrate, max_bitrate;
@@ -499,7 +547,7 @@ gst_vorbis_enc_setup (GstVorbisEnc * vorbisenc)
     min_bitrate = vorbisenc->min_bitrate > 0 ? vorbisenc->min_bitrate : -1;
     max_bitrate = vorbisenc->max_bitrate > 0 ? vorbisenc->max_bitrate : -1;
 
-    if (vorbis_encode_setup_managed (&vorbisenc->vi,
+    if (vorbis_encode_setup_managed (vi,
             vorbisenc->channels,
             vorbisenc->frequency,
             max_bitrate, vorbisenc->bitrate, min_bitrate) != 0) {
@@ -508,18 +556,37 @@ gst_vorbis_enc_setup (GstVorbisEnc * vorbisenc)
           "(c %d, rate %d, max br %ld, br %d, min br %ld) failed",
           vorbisenc->channels, vorbisenc->frequency, max_bitrate,
           vorbisenc->bitrate, min_bitrate);
-      vorbis_info_clear (&vorbisenc->vi);
+      vorbis_info_clear (vi);
       return FALSE;
     }
   }
 
   if (vorbisenc->managed && vorbisenc->bitrate < 0) {
-    vorbis_encode_ctl (&vorbisenc->vi, OV_ECTL_RATEMANAGE_AVG, NULL);
+    vorbis_encode_ctl (vi, OV_ECTL_RATEMANAGE_AVG, NULL);
   } else if (!vorbisenc->managed) {
     /* Turn off management entirely (if it was turned on). */
-    vorbis_encode_ctl (&vorbisenc->vi, OV_ECTL_RATEMANAGE_SET, NULL);
+    vorbis_encode_ctl (vi, OV_ECTL_RATEMANAGE_SET, NULL);
   }
-  vorbis_encode_setup_init (&vorbisenc->vi);
+  vorbis_encode_setup_init (vi);
+
+  return TRUE;
+}
+
+static gboolean
+gst_vorbis_enc_setup (GstVorbisEnc * vorbisenc)
+{
+
+  GST_LOG_OBJECT (vorbisenc, "setup");
+
+  if (vorbisenc->bitrate < 0 && vorbisenc->min_bitrate < 0
+      && vorbisenc->max_bitrate < 0) {
+    vorbisenc->quality_set = TRUE;
+  }
+
+  update_start_message (vorbisenc);
+
+  if (!gst_vorbis_enc_setup_info (vorbisenc, &vorbisenc->vi))
+    return FALSE;
 
   /* set up the analysis state and auxiliary encoding storage */
   vorbis_analysis_init (&vorbisenc->vd, &vorbisenc->vi);
@@ -527,6 +594,9 @@ gst_vorbis_enc_setup (GstVorbisEnc * vorbisenc)
 
   /* samples == granulepos start at 0 again */
   vorbisenc->samples_out = 0;
+  vorbisenc->chunk_data_len = 0;
+  vorbisenc->chunk_data_start = 0;
+  vorbisenc->pending_start = 0;
 
   /* fresh encoder available */
   vorbisenc->setup = TRUE;
@@ -540,8 +610,12 @@ gst_vorbis_enc_clear (GstVorbisEnc * vorbisenc)
   GstFlowReturn ret = GST_FLOW_OK;
 
   if (vorbisenc->setup) {
-    vorbis_analysis_wrote (&vorbisenc->vd, 0);
-    ret = gst_vorbis_enc_output_buffers (vorbisenc);
+    if (vorbisenc->chunk_samples > 0) {
+      ret = gst_vorbis_enc_encode_chunks (vorbisenc, NULL);
+    } else {
+      vorbis_analysis_wrote (&vorbisenc->vd, 0);
+      ret = gst_vorbis_enc_output_buffers (vorbisenc);
+    }
 
     /* marked EOS to encoder, recreate if needed */
     vorbisenc->setup = FALSE;
@@ -652,6 +726,406 @@ _gst_caps_set_buffer_array (GstCaps * caps, const gchar * field,
   return caps;
 }
 
+/* deinterleave @size samples of @ptr in vorbis channel order */
+static void
+gst_vorbis_enc_deinterleave (GstVorbisEnc * vorbisenc, float **vorbis_buffer,
+    const gfloat * ptr, gulong size)
+{
+  gulong i;
+  gint j;
+
+  if (vorbisenc->channels < 2 || vorbisenc->channels > 8) {
+    for (i = 0; i < size; i++) {
+      for (j = 0; j < vorbisenc->channels; j++) {
+        vorbis_buffer[j][i] = *ptr++;
+      }
+    }
+  } else {
+    /* Reorder */
+    for (i = 0; i < size; i++) {
+      for (j = 0; j < vorbisenc->channels; j++) {
+        vorbis_buffer[gst_vorbis_reorder_map[vorbisenc->channels - 1][j]][i] =
+            ptr[j];
+      }
+      ptr += vorbisenc->channels;
+    }
+  }
+}
+
+/* Parallel chunk encoding.
+ *
+ * Every chunk is encoded by a separate libvorbis instance, together with up
+ * to CHUNK_OVERLAP samples before and after it.  Since the encoders of two
+ * neighbouring chunks see the same input around their boundary, they mostly
+ * produce the same blocks there.  The packets of both are joined at such a
+ * common block, so that the lapping windows of the packets around the
+ * boundary still match.  Vorbis granule positions count samples from the
+ * start of the encoded input, so packet granule positions only need to be
+ * offset by the start of the samples given to the chunk encoder.
+ *
+ * The last chunk of each input buffer is kept pending until the input after
+ * it arrives, which provides the samples after it. */
+typedef struct
+{
+  guint8 *data;
+  glong bytes;
+  guint64 granulepos;
+  glong blocksize;
+} GstVorbisEncPacket;
+
+typedef struct
+{
+  GstVorbisEnc *vorbisenc;
+  const gfloat *data;
+  glong samples;
+  /* position of data in the stream */
+  guint64 start;
+  GArray *packets;
+  gboolean ok;
+} GstVorbisEncChunk;
+
+static void
+gst_vorbis_enc_encode_chunk (GstVorbisEncChunk * chunk)
+{
+  GstVorbisEnc *vorbisenc = chunk->vorbisenc;
+  vorbis_info vi;
+  vorbis_dsp_state vd;
+  vorbis_block vb;
+  ogg_packet op;
+
+  chunk->packets = g_array_new (FALSE, FALSE, sizeof (GstVorbisEncPacket));
+  chunk->ok = gst_vorbis_enc_setup_info (vorbisenc, &vi);
+  if (!chunk->ok)
+    return;
+
+  vorbis_analysis_init (&vd, &vi);
+  vorbis_block_init (&vd, &vb);
+
+  gst_vorbis_enc_deinterleave (vorbisenc,
+      vorbis_analysis_buffer (&vd, chunk->samples), chunk->data,
+      chunk->samples);
+  vorbis_analysis_wrote (&vd, chunk->samples);
+  vorbis_analysis_wrote (&vd, 0);
+
+  while (vorbis_analysis_blockout (&vd, &vb) == 1) {
+    vorbis_analysis (&vb, NULL);
+    vorbis_bitrate_addblock (&vb);
+
+    while (vorbis_bitrate_flushpacket (&vd, &op)) {
+      GstVorbisEncPacket packet;
+
+      packet.data = g_memdup (op.packet, op.bytes);
+      packet.bytes = op.bytes;
+      packet.granulepos = chunk->start + op.granulepos;
+      packet.blocksize = vorbis_packet_blocksize (&vi, &op);
+      g_array_append_val (chunk->packets, packet);
+    }
+  }
+
+  GST_LOG_OBJECT (vorbisenc, "encoded %ld samples at %" G_GUINT64_FORMAT
+      " to %u packets", chunk->samples, chunk->start, chunk->packets->len);
+
+  vorbis_block_clear (&vb);
+  vorbis_dsp_clear (&vd);
+  vorbis_info_clear (&vi);
+}
+
+static void
+gst_vorbis_enc_pool_func (gpointer data, gpointer user_data)
+{
+  GstVorbisEnc *vorbisenc = user_data;
+
+  gst_vorbis_enc_encode_chunk (data);
+
+  g_mutex_lock (&vorbisenc->lock);
+  if (--vorbisenc->n_pending == 0)
+    g_cond_signal (&vorbisenc->cond);
+  g_mutex_unlock (&vorbisenc->lock);
+}
+
+static void
+gst_vorbis_enc_free_packets (GArray * packets, guint from)
+{
+  guint i;
+
+  for (i = from; i < packets->len; i++)
+    g_free (g_array_index (packets, GstVorbisEncPacket, i).data);
+  g_array_set_size (packets, from);
+}
+
+static GstFlowReturn
+gst_vorbis_enc_push_packet (GstVorbisEnc * vorbisenc,
+    GstVorbisEncPacket * packet)
+{
+  GstFlowReturn ret;
+  GstBuffer *buf;
+
+  buf = gst_audio_encoder_allocate_output_buffer (GST_AUDIO_ENCODER
+      (vorbisenc), packet->bytes);
+  gst_buffer_fill (buf, 0, packet->data, packet->bytes);
+  g_free (packet->data);
+
+  ret = gst_audio_encoder_finish_frame (GST_AUDIO_ENCODER (vorbisenc), buf,
+      packet->granulepos - vorbisenc->samples_out);
+  vorbisenc->samples_out = packet->granulepos;
+
+  return ret;
+}
+
+/* join the packets of the chunk [@boundary, @end) to the held packets of the
+ * previous chunk and push all packets the next chunk can't replace */
+static GstFlowReturn
+gst_vorbis_enc_splice_chunk (GstVorbisEnc * vorbisenc, GArray * packets,
+    guint64 boundary, guint64 end, gboolean last)
+{
+  GArray *held = vorbisenc->held;
+  GstFlowReturn ret = GST_FLOW_OK;
+  guint64 cut = boundary, best_dist = G_MAXUINT64;
+  gboolean joined = FALSE, holding = FALSE;
+  guint i, j;
+
+  if (held->len > 0) {
+    /* find a block both encoders produced at the same position, with the
+     * same size and followed by a block of the same size */
+    for (i = 0; i + 1 < held->len; i++) {
+      GstVorbisEncPacket *h = &g_array_index (held, GstVorbisEncPacket, i);
+
+      for (j = 0; j + 1 < packets->len; j++) {
+        GstVorbisEncPacket *p =
+            &g_array_index (packets, GstVorbisEncPacket, j);
+        guint64 dist;
+
+        if (p->granulepos > h->granulepos)
+          break;
+        if (p->granulepos != h->granulepos || p->blocksize != h->blocksize
+            || p[1].blocksize != h[1].blocksize)
+          continue;
+
+        dist = p->granulepos > boundary ? p->granulepos - boundary :
+            boundary - p->granulepos;
+        if (dist <= CHUNK_SPLICE_WINDOW && dist < best_dist) {
+          best_dist = dist;
+          cut = p->granulepos;
+        }
+      }
+    }
+    if (best_dist == G_MAXUINT64)
+      GST_WARNING_OBJECT (vorbisenc, "no common block near %"
+          G_GUINT64_FORMAT ", chunk boundary might be audible", boundary);
+    else
+      GST_LOG_OBJECT (vorbisenc, "joining chunks at %" G_GUINT64_FORMAT, cut);
+
+    /* previous chunk up to and including the common block */
+    for (i = 0; i < held->len; i++) {
+      GstVorbisEncPacket *h = &g_array_index (held, GstVorbisEncPacket, i);
+
+      if (ret == GST_FLOW_OK && h->granulepos <= cut)
+        ret = gst_vorbis_enc_push_packet (vorbisenc, h);
+      else
+        g_free (h->data);
+    }
+    g_array_set_size (held, 0);
+    joined = TRUE;
+  }
+
+  /* and this chunk after it, holding back what the next one might replace */
+  for (i = 0; i < packets->len; i++) {
+    GstVorbisEncPacket *p = &g_array_index (packets, GstVorbisEncPacket, i);
+
+    if (ret != GST_FLOW_OK || (joined && p->granulepos <= cut)) {
+      g_free (p->data);
+    } else if (holding || (!last
+            && p->granulepos + CHUNK_SPLICE_WINDOW >= end)) {
+      g_array_append_val (held, *p);
+      holding = TRUE;
+    } else {
+      ret = gst_vorbis_enc_push_packet (vorbisenc, p);
+    }
+  }
+  g_array_set_size (packets, 0);
+
+  return ret;
+}
+
+static GstFlowReturn
+gst_vorbis_enc_encode_chunks (GstVorbisEnc * vorbisenc, GstBuffer * buffer)
+{
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstVorbisEncChunk *chunks;
+  guint64 data_end, keep;
+  guint i, n_chunks;
+  gint channels = vorbisenc->channels;
+
+  if (buffer) {
+    GstMapInfo map;
+    gsize size;
+
+    gst_buffer_map (buffer, &map, GST_MAP_READ);
+    size = map.size / (channels * sizeof (gfloat));
+
+    if (vorbisenc->chunk_data_len + size > vorbisenc->chunk_data_size) {
+      vorbisenc->chunk_data_size = vorbisenc->chunk_data_len + size;
+      vorbisenc->chunk_data = g_renew (gfloat, vorbisenc->chunk_data,
+          vorbisenc->chunk_data_size * channels);
+    }
+    memcpy (vorbisenc->chunk_data + vorbisenc->chunk_data_len * channels,
+        map.data, size * channels * sizeof (gfloat));
+    vorbisenc->chunk_data_len += size;
+    vorbisenc->samples_in += size;
+
+    gst_buffer_unmap (buffer, &map);
+  }
+
+  /* the chunks of data after the pending one, except the last chunk if
+   * more data will follow */
+  data_end = vorbisenc->chunk_data_start + vorbisenc->chunk_data_len;
+  n_chunks = (data_end - vorbisenc->pending_start +
+      vorbisenc->chunk_samples - 1) / vorbisenc->chunk_samples;
+  if (buffer && n_chunks > 0)
+    n_chunks--;
+  if (n_chunks == 0)
+    return GST_FLOW_OK;
+
+  chunks = g_new0 (GstVorbisEncChunk, n_chunks);
+  for (i = 0; i < n_chunks; i++) {
+    guint64 start, end;
+
+    start = vorbisenc->pending_start + i * vorbisenc->chunk_samples;
+    end = MIN (start + vorbisenc->chunk_samples, data_end);
+    start = start > vorbisenc->chunk_data_start + CHUNK_OVERLAP ?
+        start - CHUNK_OVERLAP : vorbisenc->chunk_data_start;
+    end = buffer ? MIN (end + CHUNK_OVERLAP, data_end) : data_end;
+    if (!buffer && i == n_chunks - 1)
+      end = data_end;
+
+    chunks[i].vorbisenc = vorbisenc;
+    chunks[i].start = start;
+    chunks[i].samples = end - start;
+    chunks[i].data = vorbisenc->chunk_data +
+        (start - vorbisenc->chunk_data_start) * channels;
+  }
+
+  vorbisenc->n_pending = n_chunks - 1;
+  for (i = 1; i < n_chunks; i++)
+    g_thread_pool_push (vorbisenc->pool, &chunks[i], NULL);
+
+  gst_vorbis_enc_encode_chunk (&chunks[0]);
+
+  g_mutex_lock (&vorbisenc->lock);
+  while (vorbisenc->n_pending > 0)
+    g_cond_wait (&vorbisenc->cond, &vorbisenc->lock);
+  g_mutex_unlock (&vorbisenc->lock);
+
+  for (i = 0; i < n_chunks; i++) {
+    guint64 boundary, end;
+
+    boundary = vorbisenc->pending_start + i * vorbisenc->chunk_samples;
+    end = MIN (boundary + vorbisenc->chunk_samples, data_end);
+
+    if (ret == GST_FLOW_OK && !chunks[i].ok) {
+      GST_ELEMENT_ERROR (vorbisenc, LIBRARY, SETTINGS, (NULL),
+          ("Failed to set up chunk encoder"));
+      ret = GST_FLOW_ERROR;
+    }
+    if (ret == GST_FLOW_OK)
+      ret = gst_vorbis_enc_splice_chunk (vorbisenc, chunks[i].packets,
+          boundary, end, !buffer && i == n_chunks - 1);
+    gst_vorbis_enc_free_packets (chunks[i].packets, 0);
+    g_array_free (chunks[i].packets, TRUE);
+  }
+  g_free (chunks);
+
+  if (buffer) {
+    /* keep the pending chunk and what comes before it */
+    vorbisenc->pending_start += n_chunks * vorbisenc->chunk_samples;
+    keep = vorbisenc->pending_start > vorbisenc->chunk_data_start +
+        CHUNK_OVERLAP ? vorbisenc->pending_start - CHUNK_OVERLAP :
+        vorbisenc->chunk_data_start;
+    memmove (vorbisenc->chunk_data, vorbisenc->chunk_data +
+        (keep - vorbisenc->chunk_data_start) * channels,
+        (data_end - keep) * channels * sizeof (gfloat));
+    vorbisenc->chunk_data_start = keep;
+    vorbisenc->chunk_data_len = data_end - keep;
+  } else {
+    gst_vorbis_enc_free_packets (vorbisenc->held, 0);
+    vorbisenc->chunk_data_len = 0;
+  }
+
+  return ret;
+}
+
+/* enable parallel chunk encoding when configured and not live */
+static void
+gst_vorbis_enc_setup_chunks (GstVorbisEnc * vorbisenc)
+{
+  GstAudioEncoder *enc = GST_AUDIO_ENCODER (vorbisenc);
+  GstQuery *query;
+  gboolean live = FALSE;
+  guint n_threads;
+
+  gst_vorbis_enc_free_chunks (vorbisenc);
+
+  g_object_get (vorbisenc, "n-threads", &n_threads, NULL);
+  if (n_threads == 0) {
+#if GLIB_CHECK_VERSION(2,36,0)
+    n_threads = g_get_num_processors ();
+#else
+    n_threads = 1;
+#endif
+  }
+
+  query = gst_query_new_latency ();
+  if (gst_pad_peer_query (GST_AUDIO_ENCODER_SINK_PAD (enc), query))
+    gst_query_parse_latency (query, &live, NULL, NULL);
+  gst_query_unref (query);
+
+  if (vorbisenc->chunk_duration == 0 || n_threads < 2 || live) {
+    gst_audio_encoder_set_frame_samples_min (enc, 0);
+    gst_audio_encoder_set_frame_samples_max (enc, 0);
+    gst_audio_encoder_set_frame_max (enc, 0);
+    return;
+  }
+
+  vorbisenc->pool = g_thread_pool_new (gst_vorbis_enc_pool_func, vorbisenc,
+      n_threads - 1, FALSE, NULL);
+  if (vorbisenc->pool == NULL) {
+    GST_WARNING_OBJECT (vorbisenc, "could not create thread pool");
+    return;
+  }
+
+  vorbisenc->chunk_samples = MAX (gst_util_uint64_scale (vorbisenc->
+          chunk_duration, vorbisenc->frequency, GST_SECOND),
+      4 * CHUNK_OVERLAP);
+  vorbisenc->held = g_array_new (FALSE, FALSE, sizeof (GstVorbisEncPacket));
+
+  /* have base class hand us up to one chunk per thread at once */
+  gst_audio_encoder_set_frame_samples_min (enc, vorbisenc->chunk_samples);
+  gst_audio_encoder_set_frame_samples_max (enc, vorbisenc->chunk_samples);
+  gst_audio_encoder_set_frame_max (enc, n_threads);
+
+  GST_DEBUG_OBJECT (vorbisenc, "encoding chunks of %ld samples on %u threads",
+      vorbisenc->chunk_samples, n_threads);
+}
+
+static void
+gst_vorbis_enc_free_chunks (GstVorbisEnc * vorbisenc)
+{
+  if (vorbisenc->pool) {
+    g_thread_pool_free (vorbisenc->pool, FALSE, TRUE);
+    vorbisenc->pool = NULL;
+  }
+  if (vorbisenc->held) {
+    gst_vorbis_enc_free_packets (vorbisenc->held, 0);
+    g_array_free (vorbisenc->held, TRUE);
+    vorbisenc->held = NULL;
+  }
+  g_free (vorbisenc->chunk_data);
+  vorbisenc->chunk_data = NULL;
+  vorbisenc->chunk_data_size = 0;
+  vorbisenc->chunk_data_len = 0;
+  vorbisenc->chunk_samples = 0;
+}
+
 static GstFlowReturn
 gst_vorbis_enc_handle_frame (GstAudioEncoder * enc, GstBuffer * buffer)
 {
@@ -660,7 +1134,6 @@ gst_vorbis_enc_handle_frame (GstAudioEncoder * enc, GstBuffer * buffer)
   GstMapInfo map;
   gfloat *ptr;
   gulong size;
-  gulong i, j;
   float **vorbis_buffer;
   GstBuffer *buf1, *buf2, *buf3;
 
@@ -729,6 +1202,9 @@ gst_vorbis_enc_handle_frame (GstAudioEncoder * enc, GstBuffer * buffer)
   if (!buffer)
     return gst_vorbis_enc_clear (vorbisenc);
 
+  if (vorbisenc->chunk_samples > 0)
+    return gst_vorbis_enc_encode_chunks (vorbisenc, buffer);
+
   gst_buffer_map (buffer, &map, GST_MAP_WRITE);
 
   /* data to encode */
@@ -737,26 +1213,7 @@ gst_vorbis_enc_handle_frame (GstAudioEncoder * enc, GstBuffer * buffer)
 
   /* expose the buffer to submit data */
   vorbis_buffer = vorbis_analysis_buffer (&vorbisenc->vd, size);
-
-  /* deinterleave samples, write the buffer data */
-  if (vorbisenc->channels < 2 || vorbisenc->channels > 8) {
-    for (i = 0; i < size; i++) {
-      for (j = 0; j < vorbisenc->channels; j++) {
-        vorbis_buffer[j][i] = *ptr++;
-      }
-    }
-  } else {
-    gint i, j;
-
-    /* Reorder */
-    for (i = 0; i < size; i++) {
-      for (j = 0; j < vorbisenc->channels; j++) {
-        vorbis_buffer[gst_vorbis_reorder_map[vorbisenc->channels - 1][j]][i] =
-            ptr[j];
-      }
-      ptr += vorbisenc->channels;
-    }
-  }
+  gst_vorbis_enc_deinterleave (vorbisenc, vorbis_buffer, ptr, size);
 
   /* tell the library how much we actually submitted */
   vorbis_analysis_wrote (&vorbisenc->vd, size);
@@ -839,6 +1296,9 @@ gst_vorbis_enc_get_property (GObject * object, guint prop_id, GValue * value,
     case ARG_LAST_MESSAGE:
       g_value_set_string (value, vorbisenc->last_message);
       break;
+    case ARG_CHUNK_DURATION:
+      g_value_set_uint64 (value, vorbisenc->chunk_duration);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -911,6 +1371,9 @@ gst_vorbis_enc_set_property (GObject * object, guint prop_id,
     case ARG_MANAGED:
       vorbisenc->managed = g_value_get_boolean (value);
       break;
+    case ARG_CHUNK_DURATION:
+      vorbisenc->chunk_duration = g_value_get_uint64 (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -81,6 +81,25 @@ struct _GstVorbisEnc {
   gboolean         setup;
   gboolean         header_sent;
   gchar           *last_message;
+
+  /* parallel chunk encoding */
+  guint64          chunk_duration;
+  glong            chunk_samples;
+  GThreadPool     *pool;
+  guint            n_threads;
+  guint            n_pending;
+  GMutex           lock;
+  GCond            cond;
+  /* interleaved input not encoded yet, the preroll of and the
+   * pending chunk itself */
+  gfloat          *chunk_data;
+  gsize            chunk_data_len;
+  gsize            chunk_data_size;
+  guint64          chunk_data_start;
+  guint64          pending_start;
+  /* packets of the previously encoded chunk that might still be
+   * replaced by those of the next chunk */
+  GArray          *held;
 };
 
 struct _GstVorbisEncClass {
@@ -36,12 +36,18 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#ifdef HAVE_LINUX_DMA_BUF_H
+#include <sys/ioctl.h>
+#include <linux/dma-buf.h>
+#endif
+
 /*
  * GstDmaBufMemory
  * @fd: the file descriptor associated this memory
- * @data: mmapped address
+ * @data: mmapped address, kept after the last unmap until the memory is freed
  * @mmapping_flags: mmapping flags
  * @mmap_count: mmapping counter
+ * @sync_flags: access directions started with DMA_BUF_IOCTL_SYNC
  * @lock: a mutex to make mmapping thread safe
  */
 typedef struct
@@ -53,6 +59,7 @@ typedef struct
   gint mmapping_flags;
   gint mmap_count;
   gsize mmap_size;
+  gint sync_flags;
   GMutex lock;
 } GstDmaBufMemory;
 
@@ -67,7 +74,9 @@ gst_dmabuf_allocator_free (GstAllocator * allocator, GstMemory * gmem)
   GstDmaBufMemory *mem = (GstDmaBufMemory *) gmem;
 
   if (mem->data) {
-    g_warning (G_STRLOC ":%s: Freeing memory %p still mapped", G_STRFUNC, mem);
+    if (mem->mmap_count > 0)
+      g_warning (G_STRLOC ":%s: Freeing memory %p still mapped", G_STRFUNC,
+          mem);
     munmap ((void *) mem->data, mem->mmap_size);
   }
   close (mem->fd);
@@ -76,6 +85,26 @@ gst_dmabuf_allocator_free (GstAllocator * allocator, GstMemory * gmem)
   GST_DEBUG ("%p: freed", mem);
 }
 
+/* Tell the exporter that the CPU is going to access (start) or is done
+ * accessing (end) the memory, so that caches can be kept coherent while the
+ * mapping itself is cached. This is a no-op on kernels without the ioctl. */
+static void
+gst_dmabuf_mem_sync (GstDmaBufMemory * mem, gboolean start, gint prot)
+{
+#if defined(HAVE_LINUX_DMA_BUF_H) && defined(DMA_BUF_IOCTL_SYNC)
+  struct dma_buf_sync sync = { 0 };
+
+  sync.flags = start ? DMA_BUF_SYNC_START : DMA_BUF_SYNC_END;
+  if (prot & PROT_READ)
+    sync.flags |= DMA_BUF_SYNC_READ;
+  if (prot & PROT_WRITE)
+    sync.flags |= DMA_BUF_SYNC_WRITE;
+
+  if (ioctl (mem->fd, DMA_BUF_IOCTL_SYNC, &sync) < 0)
+    GST_LOG ("%p: fd %d: sync failed: %s", mem, mem->fd, g_strerror (errno));
+#endif
+}
+
 static gpointer
 gst_dmabuf_mem_map (GstMemory * gmem, gsize maxsize, GstMapFlags flags)
 {
@@ -88,14 +117,28 @@ gst_dmabuf_mem_map (GstMemory * gmem, gsize maxsize, GstMapFlags flags)
   prot = flags & GST_MAP_READ ? PROT_READ : 0;
   prot |= flags & GST_MAP_WRITE ? PROT_WRITE : 0;
 
-  /* do not mmap twice the buffer */
+  /* do not mmap twice the buffer, the mapping is kept around after the last
+   * unmap so that repeated CPU access doesn't mmap/munmap every time */
   if (mem->data) {
-    /* only return address if mapping flags are a subset
+    /* only reuse the address if mapping flags are a subset
      * of the previous flags */
-    if ((mem->mmapping_flags & prot) && (mem->mmap_size >= maxsize))
+    if ((prot & ~mem->mmapping_flags) == 0 && mem->mmap_size >= maxsize) {
       ret = mem->data;
+      goto mapped;
+    }
 
-    goto out;
+    /* can't replace a mapping that is still in use */
+    if (mem->mmap_count > 0)
+      goto out;
+
+    GST_DEBUG ("%p: fd %d: remapping for new flags or size", mem, mem->fd);
+    munmap ((void *) mem->data, mem->mmap_size);
+    /* keep the previous access too, so alternating read and write maps
+     * don't remap each time */
+    prot |= mem->mmapping_flags;
+    mem->data = NULL;
+    mem->mmap_size = 0;
+    mem->mmapping_flags = 0;
   }
 
   if (mem->fd != -1) {
@@ -110,12 +153,23 @@ gst_dmabuf_mem_map (GstMemory * gmem, gsize maxsize, GstMapFlags flags)
 
   GST_DEBUG ("%p: fd %d: mapped %p", mem, mem->fd, mem->data);
 
-  if (mem->data) {
-    mem->mmapping_flags = prot;
-    mem->mmap_size = maxsize;
-    mem->mmap_count++;
-    ret = mem->data;
+  if (mem->data == NULL)
+    goto out;
+
+  mem->mmapping_flags = prot;
+  mem->mmap_size = maxsize;
+  ret = mem->data;
+
+mapped:
+  /* only sync the directions that weren't started yet by a mapping that
+   * is still active */
+  prot = (flags & GST_MAP_READ ? PROT_READ : 0) |
+      (flags & GST_MAP_WRITE ? PROT_WRITE : 0);
+  if (prot & ~mem->sync_flags) {
+    mem->sync_flags |= prot;
+    gst_dmabuf_mem_sync (mem, TRUE, mem->sync_flags);
   }
+  mem->mmap_count++;
 
 out:
   g_mutex_unlock (&mem->lock);
@@ -128,11 +182,10 @@ gst_dmabuf_mem_unmap (GstMemory * gmem)
   GstDmaBufMemory *mem = (GstDmaBufMemory *) gmem;
   g_mutex_lock (&mem->lock);
 
-  if (mem->data && !(--mem->mmap_count)) {
-    munmap ((void *) mem->data, mem->mmap_size);
-    mem->data = NULL;
-    mem->mmap_size = 0;
-    mem->mmapping_flags = 0;
+  if (mem->data && mem->mmap_count > 0 && !(--mem->mmap_count)) {
+    /* keep the mapping, it is released when the memory is freed */
+    gst_dmabuf_mem_sync (mem, FALSE, mem->sync_flags);
+    mem->sync_flags = 0;
     GST_DEBUG ("%p: fd %d unmapped", mem, mem->fd);
   }
   g_mutex_unlock (&mem->lock);
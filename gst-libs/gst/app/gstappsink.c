@@ -85,6 +85,9 @@ struct _GstAppSinkPrivate
   GCond cond;
   GMutex mutex;
   GQueue *queue;
+  /* only signal the cond for new or removed buffers when someone waits */
+  gboolean render_waiting;
+  guint app_waiting;
   GstBuffer *preroll;
   GstCaps *preroll_caps;
   GstCaps *last_caps;
@@ -155,6 +158,8 @@ static gboolean gst_app_sink_start (GstBaseSink * psink);
 static gboolean gst_app_sink_stop (GstBaseSink * psink);
 static gboolean gst_app_sink_event (GstBaseSink * sink, GstEvent * event);
 static gboolean gst_app_sink_query (GstBaseSink * bsink, GstQuery * query);
+static gboolean gst_app_sink_propose_allocation (GstBaseSink * bsink,
+    GstQuery * query);
 static GstFlowReturn gst_app_sink_preroll (GstBaseSink * psink,
     GstBuffer * buffer);
 static GstFlowReturn gst_app_sink_render (GstBaseSink * psink,
@@ -337,6 +342,7 @@ gst_app_sink_class_init (GstAppSinkClass * klass)
   basesink_class->get_caps = gst_app_sink_getcaps;
   basesink_class->set_caps = gst_app_sink_setcaps;
   basesink_class->query = gst_app_sink_query;
+  basesink_class->propose_allocation = gst_app_sink_propose_allocation;
 
   klass->pull_preroll = gst_app_sink_pull_preroll;
   klass->pull_sample = gst_app_sink_pull_sample;
@@ -735,7 +741,9 @@ restart:
       }
 
       /* wait for a buffer to be removed or flush */
+      priv->render_waiting = TRUE;
       g_cond_wait (&priv->cond, &priv->mutex);
+      priv->render_waiting = FALSE;
       if (priv->flushing)
         goto flushing;
     }
@@ -743,7 +751,8 @@ restart:
   /* we need to ref the buffer when pushing it in the queue */
   g_queue_push_tail (priv->queue, gst_buffer_ref (buffer));
   priv->num_buffers++;
-  g_cond_signal (&priv->cond);
+  if (priv->app_waiting > 0)
+    g_cond_signal (&priv->cond);
   emit = priv->emit_signals;
   g_mutex_unlock (&priv->mutex);
 
@@ -769,6 +778,18 @@ stopping:
   }
 }
 
+static gboolean
+gst_app_sink_propose_allocation (GstBaseSink * bsink, GstQuery * query)
+{
+  GstAppSink *appsink = GST_APP_SINK_CAST (bsink);
+  GstAppSinkPrivate *priv = appsink->priv;
+
+  if (priv->callbacks.propose_allocation == NULL)
+    return FALSE;
+
+  return priv->callbacks.propose_allocation (appsink, query, priv->user_data);
+}
+
 static GstCaps *
 gst_app_sink_getcaps (GstBaseSink * psink, GstCaps * filter)
 {
@@ -1170,10 +1191,42 @@ GstSample *
 gst_app_sink_pull_sample (GstAppSink * appsink)
 {
   GstSample *sample = NULL;
+
+  g_return_val_if_fail (GST_IS_APP_SINK (appsink), NULL);
+
+  gst_app_sink_pull_samples (appsink, &sample, 1);
+
+  return sample;
+}
+
+/**
+ * gst_app_sink_pull_samples:
+ * @appsink: a #GstAppSink
+ * @samples: (out) (array length=n_samples) (transfer full): location to
+ *     store the samples
+ * @n_samples: the maximum number of samples to pull
+ *
+ * Like gst_app_sink_pull_sample(), this function blocks until a sample or
+ * EOS becomes available or the appsink element is set to the READY/NULL
+ * state. It then takes up to @n_samples of the queued samples at once,
+ * which is cheaper than pulling them one by one.
+ *
+ * Returns: the number of samples stored in @samples, or 0 when the appsink
+ * is stopped or EOS.
+ *
+ * Since: 1.2
+ */
+guint
+gst_app_sink_pull_samples (GstAppSink * appsink, GstSample ** samples,
+    guint n_samples)
+{
   GstBuffer *buffer;
   GstAppSinkPrivate *priv;
+  guint i;
 
-  g_return_val_if_fail (GST_IS_APP_SINK (appsink), NULL);
+  g_return_val_if_fail (GST_IS_APP_SINK (appsink), 0);
+  g_return_val_if_fail (samples != NULL, 0);
+  g_return_val_if_fail (n_samples > 0, 0);
 
   priv = appsink->priv;
 
@@ -1192,30 +1245,37 @@ gst_app_sink_pull_sample (GstAppSink * appsink)
 
     /* nothing to return, wait */
     GST_DEBUG_OBJECT (appsink, "waiting for a buffer");
+    priv->app_waiting++;
     g_cond_wait (&priv->cond, &priv->mutex);
+    priv->app_waiting--;
+  }
+  for (i = 0; i < n_samples && priv->num_buffers > 0; i++) {
+    buffer = dequeue_buffer (appsink);
+    GST_DEBUG_OBJECT (appsink, "we have a buffer %p", buffer);
+    samples[i] = gst_sample_new (buffer, priv->last_caps, &priv->last_segment,
+        NULL);
+    gst_buffer_unref (buffer);
   }
-  buffer = dequeue_buffer (appsink);
-  GST_DEBUG_OBJECT (appsink, "we have a buffer %p", buffer);
-  sample = gst_sample_new (buffer, priv->last_caps, &priv->last_segment, NULL);
-  gst_buffer_unref (buffer);
 
-  g_cond_signal (&priv->cond);
+  /* wake up the streaming thread once for all removed buffers */
+  if (priv->render_waiting)
+    g_cond_signal (&priv->cond);
   g_mutex_unlock (&priv->mutex);
 
-  return sample;
+  return i;
 
   /* special conditions */
 eos:
   {
-    GST_DEBUG_OBJECT (appsink, "we are EOS, return NULL");
+    GST_DEBUG_OBJECT (appsink, "we are EOS, return no samples");
     g_mutex_unlock (&priv->mutex);
-    return NULL;
+    return 0;
   }
 not_started:
   {
-    GST_DEBUG_OBJECT (appsink, "we are stopped, return NULL");
+    GST_DEBUG_OBJECT (appsink, "we are stopped, return no samples");
     g_mutex_unlock (&priv->mutex);
-    return NULL;
+    return 0;
   }
 }
 
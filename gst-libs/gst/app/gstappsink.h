@@ -56,6 +56,12 @@ typedef struct _GstAppSinkPrivate GstAppSinkPrivate;
  *       The new sample can be retrieved with
  *       gst_app_sink_pull_sample() either from this callback
  *       or from any other thread.
+ * @propose_allocation: Called when upstream asks for an allocation, with
+ *       the ALLOCATION query. The application can add its own
+ *       #GstBufferPool or allocator to the query, so that upstream writes
+ *       directly into memory owned by the application. Return %FALSE when
+ *       no allocation parameters were proposed. This callback is called
+ *       from the steaming thread. Since: 1.2
  *
  * A set of callbacks that can be installed on the appsink with
  * gst_app_sink_set_callbacks().
@@ -64,9 +70,11 @@ typedef struct {
   void          (*eos)              (GstAppSink *appsink, gpointer user_data);
   GstFlowReturn (*new_preroll)      (GstAppSink *appsink, gpointer user_data);
   GstFlowReturn (*new_sample)       (GstAppSink *appsink, gpointer user_data);
+  gboolean      (*propose_allocation) (GstAppSink *appsink, GstQuery *query,
+                                     gpointer user_data);
 
   /*< private >*/
-  gpointer     _gst_reserved[GST_PADDING];
+  gpointer     _gst_reserved[GST_PADDING - 1];
 } GstAppSinkCallbacks;
 
 struct _GstAppSink
@@ -115,6 +123,8 @@ gboolean        gst_app_sink_get_drop         (GstAppSink *appsink);
 
 GstSample *     gst_app_sink_pull_preroll     (GstAppSink *appsink);
 GstSample *     gst_app_sink_pull_sample      (GstAppSink *appsink);
+guint           gst_app_sink_pull_samples     (GstAppSink *appsink, GstSample **samples,
+                                               guint n_samples);
 
 void            gst_app_sink_set_callbacks    (GstAppSink * appsink,
                                                GstAppSinkCallbacks *callbacks,
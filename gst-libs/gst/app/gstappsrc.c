@@ -105,6 +105,9 @@ struct _GstAppSrcPrivate
   GCond cond;
   GMutex mutex;
   GQueue *queue;
+  /* only signal the cond when someone waits for it */
+  gboolean stream_waiting;
+  guint app_waiting;
 
   GstCaps *caps;
   gint64 size;
@@ -119,6 +122,13 @@ struct _GstAppSrcPrivate
   gboolean started;
   gboolean is_eos;
   guint64 queued_bytes;
+  guint max_buffers;
+  guint64 max_time;
+  GstAppLeakyType leaky_type;
+  /* end timestamps of the last data queued and taken from the queue, for
+   * the amount of time that is queued */
+  GstClockTime in_ts;
+  GstClockTime out_ts;
   guint64 offset;
   GstAppStreamType current_type;
 
@@ -130,8 +140,36 @@ struct _GstAppSrcPrivate
   GstAppSrcCallbacks callbacks;
   gpointer user_data;
   GDestroyNotify notify;
+
+  /* statistics */
+  guint64 dropped;
+  guint64 n_waits;
+  GstClockTime min_wait;
+  GstClockTime max_wait;
+  GstClockTime total_wait;
+
+  /* data for random access pushed ahead of time, sorted by offset. No range
+   * contains another one, so they are also sorted by their end. */
+  GSequence *ranges;
+  guint64 ranges_bytes;
+  guint64 max_range_bytes;
+  guint64 range_clock;
 };
 
+typedef struct
+{
+  GstBuffer *buffer;
+  gint64 queued;                /* monotonic time the buffer was queued at */
+} GstAppSrcItem;
+
+typedef struct
+{
+  guint64 offset;
+  guint64 size;
+  GstBuffer *buffer;
+  guint64 used;                 /* range_clock of the last use */
+} GstAppSrcRange;
+
 GST_DEBUG_CATEGORY_STATIC (app_src_debug);
 #define GST_CAT_DEFAULT app_src_debug
 
@@ -159,6 +197,10 @@ enum
 #define DEFAULT_PROP_MAX_LATENCY   -1
 #define DEFAULT_PROP_EMIT_SIGNALS  TRUE
 #define DEFAULT_PROP_MIN_PERCENT   0
+#define DEFAULT_PROP_MAX_BUFFERS   0
+#define DEFAULT_PROP_MAX_TIME      0
+#define DEFAULT_PROP_LEAKY_TYPE    GST_APP_LEAKY_TYPE_NONE
+#define DEFAULT_PROP_MAX_RANGE_BYTES 0
 
 enum
 {
@@ -174,6 +216,11 @@ enum
   PROP_MAX_LATENCY,
   PROP_EMIT_SIGNALS,
   PROP_MIN_PERCENT,
+  PROP_MAX_BUFFERS,
+  PROP_MAX_TIME,
+  PROP_LEAKY_TYPE,
+  PROP_STATS,
+  PROP_MAX_RANGE_BYTES,
   PROP_LAST
 };
 
@@ -203,6 +250,26 @@ gst_app_stream_type_get_type (void)
   return (GType) stream_type_type;
 }
 
+GType
+gst_app_leaky_type_get_type (void)
+{
+  static volatile gsize leaky_type_type = 0;
+  static const GEnumValue leaky_type[] = {
+    {GST_APP_LEAKY_TYPE_NONE, "GST_APP_LEAKY_TYPE_NONE", "none"},
+    {GST_APP_LEAKY_TYPE_UPSTREAM, "GST_APP_LEAKY_TYPE_UPSTREAM", "upstream"},
+    {GST_APP_LEAKY_TYPE_DOWNSTREAM, "GST_APP_LEAKY_TYPE_DOWNSTREAM",
+        "downstream"},
+    {0, NULL, NULL}
+  };
+
+  if (g_once_init_enter (&leaky_type_type)) {
+    GType tmp = g_enum_register_static ("GstAppLeakyType", leaky_type);
+    g_once_init_leave (&leaky_type_type, tmp);
+  }
+
+  return (GType) leaky_type_type;
+}
+
 static void gst_app_src_uri_handler_init (gpointer g_iface,
     gpointer iface_data);
 
@@ -218,6 +285,7 @@ static void gst_app_src_set_latencies (GstAppSrc * appsrc,
     gboolean do_min, guint64 min, gboolean do_max, guint64 max);
 
 static gboolean gst_app_src_negotiate (GstBaseSrc * basesrc);
+static gboolean gst_app_src_do_negotiate (GstBaseSrc * basesrc);
 static GstCaps *gst_app_src_internal_get_caps (GstBaseSrc * bsrc,
     GstCaps * filter);
 static GstFlowReturn gst_app_src_create (GstBaseSrc * bsrc, guint64 offset,
@@ -230,6 +298,8 @@ static gboolean gst_app_src_do_seek (GstBaseSrc * src, GstSegment * segment);
 static gboolean gst_app_src_is_seekable (GstBaseSrc * src);
 static gboolean gst_app_src_do_get_size (GstBaseSrc * src, guint64 * size);
 static gboolean gst_app_src_query (GstBaseSrc * src, GstQuery * query);
+static gboolean gst_app_src_decide_allocation (GstBaseSrc * bsrc,
+    GstQuery * query);
 
 static GstFlowReturn gst_app_src_push_buffer_action (GstAppSrc * appsrc,
     GstBuffer * buffer);
@@ -379,6 +449,83 @@ gst_app_src_class_init (GstAppSrcClass * klass)
           0, 100, DEFAULT_PROP_MIN_PERCENT,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAppSrc::max-buffers:
+   *
+   * The maximum number of buffers that can be queued internally. Like
+   * max-bytes, appsrc emits the "enough-data" signal when it is reached.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_BUFFERS,
+      g_param_spec_uint ("max-buffers", "Max buffers",
+          "The maximum number of buffers to queue internally (0 = unlimited)",
+          0, G_MAXUINT, DEFAULT_PROP_MAX_BUFFERS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAppSrc::max-time:
+   *
+   * The maximum amount of time that can be queued internally, measured from
+   * the timestamps of the queued buffers. Like max-bytes, appsrc emits the
+   * "enough-data" signal when it is reached.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_TIME,
+      g_param_spec_uint64 ("max-time", "Max time",
+          "The maximum amount of time to queue internally in ns "
+          "(0 = unlimited)", 0, G_MAXUINT64, DEFAULT_PROP_MAX_TIME,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAppSrc::leaky-type:
+   *
+   * What to do with new buffers when the queue is full, after the
+   * "enough-data" signal was emitted. By default they are queued anyway or,
+   * with the block property, the push waits for free space. Otherwise the
+   * new (upstream) or the oldest queued (downstream) buffers are dropped.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_LEAKY_TYPE,
+      g_param_spec_enum ("leaky-type", "Leaky type",
+          "Whether to drop buffers once the queue is full",
+          GST_TYPE_APP_LEAKY_TYPE, DEFAULT_PROP_LEAKY_TYPE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAppSrc::stats:
+   *
+   * Statistics about the queue, as a #GstStructure with the current level
+   * ("current-level-bytes", "current-level-buffers" and
+   * "current-level-time"), the number of "dropped" buffers and the
+   * "min-wait", "max-wait" and "avg-wait" times that buffers spent in the
+   * queue. The wait times are %GST_CLOCK_TIME_NONE until the first buffer
+   * was taken from the queue.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS,
+      g_param_spec_boxed ("stats", "Statistics",
+          "Statistics about the queue", GST_TYPE_STRUCTURE,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAppSrc::max-range-bytes:
+   *
+   * The maximum amount of data pushed with gst_app_src_push_range() that is
+   * kept. When more is pushed, the ranges that were used least recently are
+   * dropped.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_RANGE_BYTES,
+      g_param_spec_uint64 ("max-range-bytes", "Max range bytes",
+          "The maximum number of bytes of pushed ranges to keep "
+          "(0 = unlimited)", 0, G_MAXUINT64, DEFAULT_PROP_MAX_RANGE_BYTES,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstAppSrc::need-data:
    * @appsrc: the appsrc element that emitted the signal
@@ -477,6 +624,7 @@ gst_app_src_class_init (GstAppSrcClass * klass)
   basesrc_class->get_size = gst_app_src_do_get_size;
   basesrc_class->get_size = gst_app_src_do_get_size;
   basesrc_class->query = gst_app_src_query;
+  basesrc_class->decide_allocation = gst_app_src_decide_allocation;
 
   klass->push_buffer = gst_app_src_push_buffer_action;
   klass->end_of_stream = gst_app_src_end_of_stream;
@@ -484,6 +632,150 @@ gst_app_src_class_init (GstAppSrcClass * klass)
   g_type_class_add_private (klass, sizeof (GstAppSrcPrivate));
 }
 
+static void
+gst_app_src_range_free (GstAppSrcRange * range)
+{
+  gst_buffer_unref (range->buffer);
+  g_slice_free (GstAppSrcRange, range);
+}
+
+static gint
+gst_app_src_range_compare (gconstpointer a, gconstpointer b, gpointer data)
+{
+  const GstAppSrcRange *ra = a, *rb = b;
+
+  if (ra->offset < rb->offset)
+    return -1;
+  if (ra->offset > rb->offset)
+    return 1;
+  return 0;
+}
+
+/* call with priv->mutex. Returns the range that contains @offset or NULL */
+static GSequenceIter *
+gst_app_src_range_lookup (GstAppSrcPrivate * priv, guint64 offset)
+{
+  GstAppSrcRange key, *range;
+  GSequenceIter *iter;
+
+  key.offset = offset;
+  iter = g_sequence_search (priv->ranges, &key, gst_app_src_range_compare,
+      NULL);
+
+  /* a range that starts at @offset can be on either side */
+  if (!g_sequence_iter_is_end (iter)) {
+    range = g_sequence_get (iter);
+    if (range->offset == offset)
+      return iter;
+  }
+  if (g_sequence_iter_is_begin (iter))
+    return NULL;
+
+  /* the last range that starts before @offset is the only one that can
+   * contain it */
+  iter = g_sequence_iter_prev (iter);
+  range = g_sequence_get (iter);
+  if (offset - range->offset < range->size)
+    return iter;
+
+  return NULL;
+}
+
+/* call with priv->mutex, drops the ranges used least recently until the
+ * ranges fit in max-range-bytes. @keep is not dropped. */
+static void
+gst_app_src_range_evict (GstAppSrcPrivate * priv, GstAppSrcRange * keep)
+{
+  while (priv->max_range_bytes && priv->ranges_bytes > priv->max_range_bytes) {
+    GSequenceIter *iter, *oldest = NULL;
+    GstAppSrcRange *range, *oldest_range = NULL;
+
+    iter = g_sequence_get_begin_iter (priv->ranges);
+    for (; !g_sequence_iter_is_end (iter); iter = g_sequence_iter_next (iter)) {
+      range = g_sequence_get (iter);
+      if (range == keep)
+        continue;
+      if (oldest_range == NULL || range->used < oldest_range->used) {
+        oldest = iter;
+        oldest_range = range;
+      }
+    }
+    if (oldest == NULL)
+      break;
+
+    priv->ranges_bytes -= oldest_range->size;
+    g_sequence_remove (oldest);
+  }
+}
+
+/* call with priv->mutex */
+static void
+gst_app_src_range_flush (GstAppSrcPrivate * priv)
+{
+  g_sequence_remove_range (g_sequence_get_begin_iter (priv->ranges),
+      g_sequence_get_end_iter (priv->ranges));
+  priv->ranges_bytes = 0;
+}
+
+/* call with priv->mutex. Makes a buffer of @size bytes at @offset, or up to
+ * the end of the stream, from the pushed ranges. Returns FALSE when they
+ * don't contain all of it. */
+static gboolean
+gst_app_src_take_range (GstAppSrc * appsrc, guint64 offset, guint size,
+    GstBuffer ** buf)
+{
+  GstAppSrcPrivate *priv = appsrc->priv;
+  GstBuffer *result = NULL;
+  guint64 pos, end;
+
+  if (g_sequence_get_length (priv->ranges) == 0)
+    return FALSE;
+
+  end = offset + size;
+  if (priv->size >= 0 && end > (guint64) priv->size)
+    end = priv->size;
+  if (offset >= end)
+    return FALSE;
+
+  for (pos = offset; pos < end;) {
+    GSequenceIter *iter;
+    GstAppSrcRange *range;
+    GstBuffer *sub;
+    guint64 len;
+
+    iter = gst_app_src_range_lookup (priv, pos);
+    if (iter == NULL) {
+      if (result)
+        gst_buffer_unref (result);
+      return FALSE;
+    }
+
+    range = g_sequence_get (iter);
+    range->used = ++priv->range_clock;
+
+    len = MIN (range->offset + range->size, end) - pos;
+    sub = gst_buffer_copy_region (range->buffer, GST_BUFFER_COPY_MEMORY,
+        pos - range->offset, len);
+    result = result ? gst_buffer_append (result, sub) : sub;
+    pos += len;
+  }
+
+  GST_BUFFER_OFFSET (result) = offset;
+  GST_BUFFER_OFFSET_END (result) = end;
+
+  GST_DEBUG_OBJECT (appsrc, "took %" G_GUINT64_FORMAT " bytes at %"
+      G_GUINT64_FORMAT " from the pushed ranges", end - offset, offset);
+
+  if (priv->new_caps) {
+    gst_app_src_do_negotiate (GST_BASE_SRC_CAST (appsrc));
+    priv->new_caps = FALSE;
+  }
+
+  *buf = result;
+
+  return TRUE;
+}
+
 static void
 gst_app_src_init (GstAppSrc * appsrc)
 {
@@ -505,19 +797,151 @@ gst_app_src_init (GstAppSrc * appsrc)
   priv->max_latency = DEFAULT_PROP_MAX_LATENCY;
   priv->emit_signals = DEFAULT_PROP_EMIT_SIGNALS;
   priv->min_percent = DEFAULT_PROP_MIN_PERCENT;
+  priv->max_buffers = DEFAULT_PROP_MAX_BUFFERS;
+  priv->max_time = DEFAULT_PROP_MAX_TIME;
+  priv->leaky_type = DEFAULT_PROP_LEAKY_TYPE;
+  priv->ranges = g_sequence_new ((GDestroyNotify) gst_app_src_range_free);
+  priv->max_range_bytes = DEFAULT_PROP_MAX_RANGE_BYTES;
+  priv->in_ts = GST_CLOCK_TIME_NONE;
+  priv->out_ts = GST_CLOCK_TIME_NONE;
 
   gst_base_src_set_live (GST_BASE_SRC (appsrc), DEFAULT_PROP_IS_LIVE);
 }
 
+static GstClockTime
+buffer_get_ts (GstBuffer * buffer)
+{
+  if (GST_BUFFER_DTS_IS_VALID (buffer))
+    return GST_BUFFER_DTS (buffer);
+  return GST_BUFFER_PTS (buffer);
+}
+
+/* call with priv->mutex */
+static GstClockTime
+gst_app_src_queued_time (GstAppSrcPrivate * priv)
+{
+  if (!GST_CLOCK_TIME_IS_VALID (priv->in_ts) ||
+      !GST_CLOCK_TIME_IS_VALID (priv->out_ts) || priv->in_ts < priv->out_ts)
+    return 0;
+
+  return priv->in_ts - priv->out_ts;
+}
+
+/* call with priv->mutex */
+static gboolean
+gst_app_src_is_full (GstAppSrcPrivate * priv)
+{
+  if (priv->max_bytes && priv->queued_bytes >= priv->max_bytes)
+    return TRUE;
+  if (priv->max_buffers && priv->queue->length >= priv->max_buffers)
+    return TRUE;
+  if (priv->max_time && gst_app_src_queued_time (priv) >= priv->max_time)
+    return TRUE;
+
+  return FALSE;
+}
+
+/* call with priv->mutex, takes ownership of @buffer */
+static void
+gst_app_src_queue_buffer (GstAppSrcPrivate * priv, GstBuffer * buffer,
+    gint64 now)
+{
+  GstAppSrcItem *item;
+  GstClockTime ts;
+
+  item = g_slice_new (GstAppSrcItem);
+  item->buffer = buffer;
+  item->queued = now;
+  g_queue_push_tail (priv->queue, item);
+  priv->queued_bytes += gst_buffer_get_size (buffer);
+
+  ts = buffer_get_ts (buffer);
+  if (GST_CLOCK_TIME_IS_VALID (ts)) {
+    if (!GST_CLOCK_TIME_IS_VALID (priv->out_ts))
+      priv->out_ts = ts;
+    if (GST_BUFFER_DURATION_IS_VALID (buffer))
+      ts += GST_BUFFER_DURATION (buffer);
+    priv->in_ts = ts;
+  }
+}
+
+/* call with priv->mutex. @now is the monotonic time at which the buffer
+ * leaves the queue, or -1 when it is dropped */
+static GstBuffer *
+gst_app_src_dequeue_buffer (GstAppSrcPrivate * priv, gint64 now)
+{
+  GstAppSrcItem *item;
+  GstBuffer *buffer;
+  GstClockTime ts;
+
+  item = g_queue_pop_head (priv->queue);
+  if (item == NULL)
+    return NULL;
+
+  buffer = item->buffer;
+  priv->queued_bytes -= gst_buffer_get_size (buffer);
+
+  ts = buffer_get_ts (buffer);
+  if (GST_CLOCK_TIME_IS_VALID (ts)) {
+    if (GST_BUFFER_DURATION_IS_VALID (buffer))
+      ts += GST_BUFFER_DURATION (buffer);
+    priv->out_ts = ts;
+  }
+
+  if (now >= 0) {
+    GstClockTime wait = (MAX (now, item->queued) - item->queued) * GST_USECOND;
+
+    if (priv->n_waits == 0 || wait < priv->min_wait)
+      priv->min_wait = wait;
+    if (priv->n_waits == 0 || wait > priv->max_wait)
+      priv->max_wait = wait;
+    priv->total_wait += wait;
+    priv->n_waits++;
+  }
+  g_slice_free (GstAppSrcItem, item);
+
+  return buffer;
+}
+
 static void
 gst_app_src_flush_queued (GstAppSrc * src)
 {
   GstBuffer *buf;
   GstAppSrcPrivate *priv = src->priv;
 
-  while ((buf = g_queue_pop_head (priv->queue)))
+  while ((buf = gst_app_src_dequeue_buffer (priv, -1)))
     gst_buffer_unref (buf);
   priv->queued_bytes = 0;
+  priv->in_ts = GST_CLOCK_TIME_NONE;
+  priv->out_ts = GST_CLOCK_TIME_NONE;
+}
+
+static GstStructure *
+gst_app_src_get_stats (GstAppSrc * appsrc)
+{
+  GstAppSrcPrivate *priv = appsrc->priv;
+  GstStructure *stats;
+  GstClockTime min_wait, max_wait, avg_wait;
+
+  g_mutex_lock (&priv->mutex);
+  if (priv->n_waits > 0) {
+    min_wait = priv->min_wait;
+    max_wait = priv->max_wait;
+    avg_wait = priv->total_wait / priv->n_waits;
+  } else {
+    min_wait = max_wait = avg_wait = GST_CLOCK_TIME_NONE;
+  }
+  stats = gst_structure_new ("application/x-app-src-stats",
+      "current-level-bytes", G_TYPE_UINT64, priv->queued_bytes,
+      "current-level-buffers", G_TYPE_UINT, priv->queue->length,
+      "current-level-time", G_TYPE_UINT64, gst_app_src_queued_time (priv),
+      "dropped", G_TYPE_UINT64, priv->dropped,
+      "min-wait", G_TYPE_UINT64, min_wait,
+      "max-wait", G_TYPE_UINT64, max_wait,
+      "avg-wait", G_TYPE_UINT64, avg_wait, NULL);
+  g_mutex_unlock (&priv->mutex);
+
+  return stats;
 }
 
 static void
@@ -531,6 +955,7 @@ gst_app_src_dispose (GObject * obj)
     priv->caps = NULL;
   }
   gst_app_src_flush_queued (appsrc);
+  gst_app_src_range_flush (priv);
 
   G_OBJECT_CLASS (parent_class)->dispose (obj);
 }
@@ -544,6 +969,7 @@ gst_app_src_finalize (GObject * obj)
   g_mutex_clear (&priv->mutex);
   g_cond_clear (&priv->cond);
   g_queue_free (priv->queue);
+  g_sequence_free (priv->ranges);
 
   g_free (priv->uri);
 
@@ -620,6 +1046,31 @@ gst_app_src_set_property (GObject * object, guint prop_id,
     case PROP_MIN_PERCENT:
       priv->min_percent = g_value_get_uint (value);
       break;
+    case PROP_MAX_BUFFERS:
+      g_mutex_lock (&priv->mutex);
+      priv->max_buffers = g_value_get_uint (value);
+      /* the queue might not be full anymore */
+      g_cond_broadcast (&priv->cond);
+      g_mutex_unlock (&priv->mutex);
+      break;
+    case PROP_MAX_TIME:
+      g_mutex_lock (&priv->mutex);
+      priv->max_time = g_value_get_uint64 (value);
+      g_cond_broadcast (&priv->cond);
+      g_mutex_unlock (&priv->mutex);
+      break;
+    case PROP_LEAKY_TYPE:
+      g_mutex_lock (&priv->mutex);
+      priv->leaky_type = g_value_get_enum (value);
+      g_cond_broadcast (&priv->cond);
+      g_mutex_unlock (&priv->mutex);
+      break;
+    case PROP_MAX_RANGE_BYTES:
+      g_mutex_lock (&priv->mutex);
+      priv->max_range_bytes = g_value_get_uint64 (value);
+      gst_app_src_range_evict (priv, NULL);
+      g_mutex_unlock (&priv->mutex);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -677,6 +1128,29 @@ gst_app_src_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_MIN_PERCENT:
       g_value_set_uint (value, priv->min_percent);
       break;
+    case PROP_MAX_BUFFERS:
+      g_mutex_lock (&priv->mutex);
+      g_value_set_uint (value, priv->max_buffers);
+      g_mutex_unlock (&priv->mutex);
+      break;
+    case PROP_MAX_TIME:
+      g_mutex_lock (&priv->mutex);
+      g_value_set_uint64 (value, priv->max_time);
+      g_mutex_unlock (&priv->mutex);
+      break;
+    case PROP_LEAKY_TYPE:
+      g_mutex_lock (&priv->mutex);
+      g_value_set_enum (value, priv->leaky_type);
+      g_mutex_unlock (&priv->mutex);
+      break;
+    case PROP_MAX_RANGE_BYTES:
+      g_mutex_lock (&priv->mutex);
+      g_value_set_uint64 (value, priv->max_range_bytes);
+      g_mutex_unlock (&priv->mutex);
+      break;
+    case PROP_STATS:
+      g_value_take_boxed (value, gst_app_src_get_stats (appsrc));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -727,6 +1201,9 @@ gst_app_src_start (GstBaseSrc * bsrc)
    * in random-access mode. */
   priv->offset = -1;
   priv->flushing = FALSE;
+  priv->dropped = 0;
+  priv->n_waits = 0;
+  priv->total_wait = 0;
   g_mutex_unlock (&priv->mutex);
 
   gst_base_src_set_format (bsrc, priv->format);
@@ -746,6 +1223,7 @@ gst_app_src_stop (GstBaseSrc * bsrc)
   priv->flushing = TRUE;
   priv->started = FALSE;
   gst_app_src_flush_queued (appsrc);
+  gst_app_src_range_flush (priv);
   g_cond_broadcast (&priv->cond);
   g_mutex_unlock (&priv->mutex);
 
@@ -832,6 +1310,24 @@ gst_app_src_query (GstBaseSrc * src, GstQuery * query)
 }
 
 /* will be called in push mode */
+static gboolean
+gst_app_src_decide_allocation (GstBaseSrc * bsrc, GstQuery * query)
+{
+  GstAppSrc *appsrc = GST_APP_SRC_CAST (bsrc);
+  GstAppSrcPrivate *priv = appsrc->priv;
+
+  /* let the application see and change what downstream proposed before we
+   * configure the pool from it */
+  if (priv->callbacks.decide_allocation) {
+    if (!priv->callbacks.decide_allocation (appsrc, query, priv->user_data)) {
+      GST_DEBUG_OBJECT (appsrc, "application refused the allocation");
+      return FALSE;
+    }
+  }
+
+  return GST_BASE_SRC_CLASS (parent_class)->decide_allocation (bsrc, query);
+}
+
 static gboolean
 gst_app_src_do_seek (GstBaseSrc * src, GstSegment * segment)
 {
@@ -987,6 +1483,12 @@ gst_app_src_create (GstBaseSrc * bsrc, guint64 offset, guint size,
     goto flushing;
 
   if (priv->stream_type == GST_APP_STREAM_TYPE_RANDOM_ACCESS) {
+    /* serve what the application pushed ahead of time without asking it */
+    if (gst_app_src_take_range (appsrc, offset, size, buf)) {
+      g_mutex_unlock (&priv->mutex);
+      return GST_FLOW_OK;
+    }
+
     /* if we are dealing with a random-access stream, issue a seek if the offset
      * changed. */
     if (G_UNLIKELY (priv->offset != offset)) {
@@ -1014,19 +1516,18 @@ gst_app_src_create (GstBaseSrc * bsrc, guint64 offset, guint size,
         priv->new_caps = FALSE;
       }
 
-      *buf = g_queue_pop_head (priv->queue);
+      *buf = gst_app_src_dequeue_buffer (priv, g_get_monotonic_time ());
       buf_size = gst_buffer_get_size (*buf);
 
       GST_DEBUG_OBJECT (appsrc, "we have buffer %p of size %u", *buf, buf_size);
 
-      priv->queued_bytes -= buf_size;
-
       /* only update the offset when in random_access mode */
       if (priv->stream_type == GST_APP_STREAM_TYPE_RANDOM_ACCESS)
         priv->offset += buf_size;
 
       /* signal that we removed an item */
-      g_cond_broadcast (&priv->cond);
+      if (priv->app_waiting > 0)
+        g_cond_broadcast (&priv->cond);
 
       /* see if we go lower than the empty-percent */
       if (priv->min_percent && priv->max_bytes) {
@@ -1060,7 +1561,16 @@ gst_app_src_create (GstBaseSrc * bsrc, guint64 offset, guint size,
       goto eos;
 
     /* nothing to return, wait a while for new data or flushing. */
+    priv->stream_waiting = TRUE;
     g_cond_wait (&priv->cond, &priv->mutex);
+    priv->stream_waiting = FALSE;
+
+    /* the application can also answer with gst_app_src_push_range() */
+    if (priv->stream_type == GST_APP_STREAM_TYPE_RANDOM_ACCESS &&
+        gst_app_src_take_range (appsrc, offset, size, buf)) {
+      ret = GST_FLOW_OK;
+      break;
+    }
   }
   g_mutex_unlock (&priv->mutex);
   return ret;
@@ -1413,15 +1923,15 @@ gst_app_src_get_emit_signals (GstAppSrc * appsrc)
   return result;
 }
 
+/* queues either @buffer or all buffers of @buflist, the ref of @buflist is
+ * always stolen */
 static GstFlowReturn
-gst_app_src_push_buffer_full (GstAppSrc * appsrc, GstBuffer * buffer,
-    gboolean steal_ref)
+gst_app_src_push_internal (GstAppSrc * appsrc, GstBuffer * buffer,
+    GstBufferList * buflist, gboolean steal_ref)
 {
   gboolean first = TRUE;
   GstAppSrcPrivate *priv;
-
-  g_return_val_if_fail (GST_IS_APP_SRC (appsrc), GST_FLOW_ERROR);
-  g_return_val_if_fail (GST_IS_BUFFER (buffer), GST_FLOW_ERROR);
+  gint64 now;
 
   priv = appsrc->priv;
 
@@ -1435,10 +1945,11 @@ gst_app_src_push_buffer_full (GstAppSrc * appsrc, GstBuffer * buffer,
     if (priv->is_eos)
       goto eos;
 
-    if (priv->max_bytes && priv->queued_bytes >= priv->max_bytes) {
+    if (gst_app_src_is_full (priv)) {
       GST_DEBUG_OBJECT (appsrc,
-          "queue filled (%" G_GUINT64_FORMAT " >= %" G_GUINT64_FORMAT ")",
-          priv->queued_bytes, priv->max_bytes);
+          "queue filled (%" G_GUINT64_FORMAT " bytes, %u buffers, %"
+          GST_TIME_FORMAT ")", priv->queued_bytes, priv->queue->length,
+          GST_TIME_ARGS (gst_app_src_queued_time (priv)));
 
       if (first) {
         gboolean emit;
@@ -1458,11 +1969,26 @@ gst_app_src_push_buffer_full (GstAppSrc * appsrc, GstBuffer * buffer,
         first = FALSE;
         continue;
       }
-      if (priv->block) {
+      if (priv->leaky_type == GST_APP_LEAKY_TYPE_UPSTREAM) {
+        goto dropped;
+      } else if (priv->leaky_type == GST_APP_LEAKY_TYPE_DOWNSTREAM) {
+        GstBuffer *old;
+
+        /* make room by dropping the oldest buffers */
+        while (gst_app_src_is_full (priv) &&
+            (old = gst_app_src_dequeue_buffer (priv, -1))) {
+          GST_DEBUG_OBJECT (appsrc, "dropping old buffer %p", old);
+          gst_buffer_unref (old);
+          priv->dropped++;
+        }
+        break;
+      } else if (priv->block) {
         GST_DEBUG_OBJECT (appsrc, "waiting for free space");
         /* we are filled, wait until a buffer gets popped or when we
          * flush. */
+        priv->app_waiting++;
         g_cond_wait (&priv->cond, &priv->mutex);
+        priv->app_waiting--;
       } else {
         /* no need to wait for free space, we just pump more data into the
          * queue hoping that the caller reacts to the enough-data signal and
@@ -1473,12 +1999,26 @@ gst_app_src_push_buffer_full (GstAppSrc * appsrc, GstBuffer * buffer,
       break;
   }
 
-  GST_DEBUG_OBJECT (appsrc, "queueing buffer %p", buffer);
-  if (!steal_ref)
-    gst_buffer_ref (buffer);
-  g_queue_push_tail (priv->queue, buffer);
-  priv->queued_bytes += gst_buffer_get_size (buffer);
-  g_cond_broadcast (&priv->cond);
+  now = g_get_monotonic_time ();
+  if (buflist != NULL) {
+    guint i, len;
+
+    len = gst_buffer_list_length (buflist);
+    GST_DEBUG_OBJECT (appsrc, "queueing buffer list %p of %u buffers", buflist,
+        len);
+    for (i = 0; i < len; i++) {
+      buffer = gst_buffer_list_get (buflist, i);
+      gst_app_src_queue_buffer (priv, gst_buffer_ref (buffer), now);
+    }
+    gst_buffer_list_unref (buflist);
+  } else {
+    GST_DEBUG_OBJECT (appsrc, "queueing buffer %p", buffer);
+    if (!steal_ref)
+      gst_buffer_ref (buffer);
+    gst_app_src_queue_buffer (priv, buffer, now);
+  }
+  if (priv->stream_waiting)
+    g_cond_broadcast (&priv->cond);
   g_mutex_unlock (&priv->mutex);
 
   return GST_FLOW_OK;
@@ -1486,20 +2026,51 @@ gst_app_src_push_buffer_full (GstAppSrc * appsrc, GstBuffer * buffer,
   /* ERRORS */
 flushing:
   {
-    GST_DEBUG_OBJECT (appsrc, "refuse buffer %p, we are flushing", buffer);
-    if (steal_ref)
+    GST_DEBUG_OBJECT (appsrc, "refuse buffer %p, we are flushing",
+        buflist ? (gpointer) buflist : (gpointer) buffer);
+    if (buflist)
+      gst_buffer_list_unref (buflist);
+    else if (steal_ref)
       gst_buffer_unref (buffer);
     g_mutex_unlock (&priv->mutex);
     return GST_FLOW_FLUSHING;
   }
 eos:
   {
-    GST_DEBUG_OBJECT (appsrc, "refuse buffer %p, we are EOS", buffer);
-    if (steal_ref)
+    GST_DEBUG_OBJECT (appsrc, "refuse buffer %p, we are EOS",
+        buflist ? (gpointer) buflist : (gpointer) buffer);
+    if (buflist)
+      gst_buffer_list_unref (buflist);
+    else if (steal_ref)
       gst_buffer_unref (buffer);
     g_mutex_unlock (&priv->mutex);
     return GST_FLOW_EOS;
   }
+dropped:
+  {
+    GST_DEBUG_OBJECT (appsrc, "dropping buffer %p, the queue is full",
+        buflist ? (gpointer) buflist : (gpointer) buffer);
+    if (buflist) {
+      priv->dropped += gst_buffer_list_length (buflist);
+      gst_buffer_list_unref (buflist);
+    } else {
+      priv->dropped++;
+      if (steal_ref)
+        gst_buffer_unref (buffer);
+    }
+    g_mutex_unlock (&priv->mutex);
+    return GST_FLOW_OK;
+  }
+}
+
+static GstFlowReturn
+gst_app_src_push_buffer_full (GstAppSrc * appsrc, GstBuffer * buffer,
+    gboolean steal_ref)
+{
+  g_return_val_if_fail (GST_IS_APP_SRC (appsrc), GST_FLOW_ERROR);
+  g_return_val_if_fail (GST_IS_BUFFER (buffer), GST_FLOW_ERROR);
+
+  return gst_app_src_push_internal (appsrc, buffer, NULL, steal_ref);
 }
 
 /**
@@ -1523,6 +2094,144 @@ gst_app_src_push_buffer (GstAppSrc * appsrc, GstBuffer * buffer)
   return gst_app_src_push_buffer_full (appsrc, buffer, TRUE);
 }
 
+/**
+ * gst_app_src_push_buffer_list:
+ * @appsrc: a #GstAppSrc
+ * @buffer_list: (transfer full): a #GstBufferList to push
+ *
+ * Adds all buffers of @buffer_list to the queue of buffers that the appsrc
+ * element will push to its source pad, in one go. This is cheaper than
+ * pushing the buffers one by one with gst_app_src_push_buffer(). This
+ * function takes ownership of the buffer list.
+ *
+ * When the block property is TRUE, this function can block until free
+ * space becomes available in the queue. The buffers of the list are then
+ * queued together, even if they exceed max-bytes.
+ *
+ * Returns: #GST_FLOW_OK when the buffers were successfuly queued.
+ * #GST_FLOW_FLUSHING when @appsrc is not PAUSED or PLAYING.
+ * #GST_FLOW_EOS when EOS occured.
+ *
+ * Since: 1.2
+ */
+GstFlowReturn
+gst_app_src_push_buffer_list (GstAppSrc * appsrc, GstBufferList * buffer_list)
+{
+  g_return_val_if_fail (GST_IS_APP_SRC (appsrc), GST_FLOW_ERROR);
+  g_return_val_if_fail (GST_IS_BUFFER_LIST (buffer_list), GST_FLOW_ERROR);
+
+  return gst_app_src_push_internal (appsrc, NULL, buffer_list, TRUE);
+}
+
+/**
+ * gst_app_src_push_range:
+ * @appsrc: a #GstAppSrc
+ * @offset: the byte offset of the data in the stream
+ * @buffer: (transfer full): a #GstBuffer with the data at @offset
+ *
+ * Gives @appsrc the data at @offset of a random-access stream ahead of time.
+ * Data requested by downstream that is completely in the pushed ranges is
+ * served from them without emitting the "seek-data" and "need-data"
+ * signals, so that applications can request several ranges at once, for
+ * example while a demuxer searches the stream. Overlapping and adjacent
+ * ranges can be pushed, the max-range-bytes property limits how much is
+ * kept. The ranges are dropped when @appsrc stops. This function takes
+ * ownership of the buffer.
+ *
+ * This is only used when the stream-type is
+ * %GST_APP_STREAM_TYPE_RANDOM_ACCESS.
+ *
+ * Returns: #GST_FLOW_OK when the data was kept.
+ * #GST_FLOW_FLUSHING when @appsrc is not PAUSED or PLAYING.
+ *
+ * Since: 1.2
+ */
+GstFlowReturn
+gst_app_src_push_range (GstAppSrc * appsrc, guint64 offset, GstBuffer * buffer)
+{
+  GstAppSrcPrivate *priv;
+  GstAppSrcRange *range;
+  GSequenceIter *iter;
+  guint64 end;
+
+  g_return_val_if_fail (GST_IS_APP_SRC (appsrc), GST_FLOW_ERROR);
+  g_return_val_if_fail (GST_IS_BUFFER (buffer), GST_FLOW_ERROR);
+
+  priv = appsrc->priv;
+
+  g_mutex_lock (&priv->mutex);
+  if (priv->flushing)
+    goto flushing;
+
+  end = offset + gst_buffer_get_size (buffer);
+  if (end == offset)
+    goto done;
+
+  /* we have all of it already */
+  iter = gst_app_src_range_lookup (priv, offset);
+  if (iter) {
+    range = g_sequence_get (iter);
+    if (range->offset + range->size >= end)
+      goto done;
+  }
+
+  /* drop the ranges that the new one contains, they start at or after
+   * @offset and the first one that ends after @end stops them */
+  if (iter == NULL || range->offset < offset) {
+    GstAppSrcRange key;
+
+    key.offset = offset;
+    iter = g_sequence_search (priv->ranges, &key, gst_app_src_range_compare,
+        NULL);
+  }
+  while (!g_sequence_iter_is_end (iter)) {
+    GSequenceIter *next;
+
+    range = g_sequence_get (iter);
+    if (range->offset + range->size > end)
+      break;
+
+    next = g_sequence_iter_next (iter);
+    priv->ranges_bytes -= range->size;
+    g_sequence_remove (iter);
+    iter = next;
+  }
+
+  range = g_slice_new (GstAppSrcRange);
+  range->offset = offset;
+  range->size = end - offset;
+  range->buffer = buffer;
+  range->used = ++priv->range_clock;
+  g_sequence_insert_sorted (priv->ranges, range, gst_app_src_range_compare,
+      NULL);
+  priv->ranges_bytes += range->size;
+  buffer = NULL;
+
+  GST_DEBUG_OBJECT (appsrc, "pushed range of %" G_GUINT64_FORMAT " bytes at %"
+      G_GUINT64_FORMAT, range->size, offset);
+
+  gst_app_src_range_evict (priv, range);
+
+  if (priv->stream_waiting)
+    g_cond_broadcast (&priv->cond);
+
+done:
+  g_mutex_unlock (&priv->mutex);
+  if (buffer)
+    gst_buffer_unref (buffer);
+
+  return GST_FLOW_OK;
+
+  /* ERRORS */
+flushing:
+  {
+    GST_DEBUG_OBJECT (appsrc, "refuse range, we are flushing");
+    g_mutex_unlock (&priv->mutex);
+    gst_buffer_unref (buffer);
+    return GST_FLOW_FLUSHING;
+  }
+}
+
 /* push a buffer without stealing the ref of the buffer. This is used for the
  * action signal. */
 static GstFlowReturn
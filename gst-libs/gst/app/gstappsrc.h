@@ -53,6 +53,12 @@ typedef struct _GstAppSrcPrivate GstAppSrcPrivate;
  * @seek_data: Called when a seek should be performed to the offset.
  *    The next push-buffer should produce buffers from the new @offset.
  *    This callback is only called for seekable stream types.
+ * @decide_allocation: Called with the ALLOCATION query answered by
+ *    downstream, before appsrc configures the buffer pool from it. The
+ *    application can take the proposed #GstBufferPool or allocator from the
+ *    query to allocate the buffers it pushes, avoiding a copy downstream,
+ *    or change the query. Return %FALSE to make the allocation fail.
+ *    Since: 1.2
  *
  * A set of callbacks that can be installed on the appsrc with
  * gst_app_src_set_callbacks().
@@ -61,9 +67,11 @@ typedef struct {
   void      (*need_data)    (GstAppSrc *src, guint length, gpointer user_data);
   void      (*enough_data)  (GstAppSrc *src, gpointer user_data);
   gboolean  (*seek_data)    (GstAppSrc *src, guint64 offset, gpointer user_data);
+  gboolean  (*decide_allocation) (GstAppSrc *src, GstQuery *query,
+                                  gpointer user_data);
 
   /*< private >*/
-  gpointer     _gst_reserved[GST_PADDING];
+  gpointer     _gst_reserved[GST_PADDING - 1];
 } GstAppSrcCallbacks;
 
 /**
@@ -84,6 +92,24 @@ typedef enum
   GST_APP_STREAM_TYPE_RANDOM_ACCESS
 } GstAppStreamType;
 
+/**
+ * GstAppLeakyType:
+ * @GST_APP_LEAKY_TYPE_NONE: Don't drop buffers when the queue is full.
+ * @GST_APP_LEAKY_TYPE_UPSTREAM: Drop new buffers when the queue is full.
+ * @GST_APP_LEAKY_TYPE_DOWNSTREAM: Drop the oldest queued buffers to make
+ * room for new buffers when the queue is full.
+ *
+ * What appsrc does with new buffers when its queue is full.
+ *
+ * Since: 1.2
+ */
+typedef enum
+{
+  GST_APP_LEAKY_TYPE_NONE,
+  GST_APP_LEAKY_TYPE_UPSTREAM,
+  GST_APP_LEAKY_TYPE_DOWNSTREAM
+} GstAppLeakyType;
+
 struct _GstAppSrc
 {
   GstBaseSrc basesrc;
@@ -118,6 +144,10 @@ GType gst_app_src_get_type(void);
 #define GST_TYPE_APP_STREAM_TYPE (gst_app_stream_type_get_type ())
 GType gst_app_stream_type_get_type (void);
 
+/* GType getter for GstAppLeakyType */
+#define GST_TYPE_APP_LEAKY_TYPE (gst_app_leaky_type_get_type ())
+GType gst_app_leaky_type_get_type (void);
+
 void             gst_app_src_set_caps         (GstAppSrc *appsrc, const GstCaps *caps);
 GstCaps*         gst_app_src_get_caps         (GstAppSrc *appsrc);
 
@@ -137,6 +167,8 @@ void             gst_app_src_set_emit_signals (GstAppSrc *appsrc, gboolean emit)
 gboolean         gst_app_src_get_emit_signals (GstAppSrc *appsrc);
 
 GstFlowReturn    gst_app_src_push_buffer      (GstAppSrc *appsrc, GstBuffer *buffer);
+GstFlowReturn    gst_app_src_push_buffer_list (GstAppSrc *appsrc, GstBufferList *buffer_list);
+GstFlowReturn    gst_app_src_push_range       (GstAppSrc *appsrc, guint64 offset, GstBuffer *buffer);
 GstFlowReturn    gst_app_src_end_of_stream    (GstAppSrc *appsrc);
 
 void             gst_app_src_set_callbacks    (GstAppSrc * appsrc,
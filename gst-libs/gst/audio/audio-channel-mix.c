@@ -2,7 +2,7 @@
  * Copyright (C) 2004 Ronald Bultje <rbultje@ronald.bitfreak.net>
  * Copyright (C) 2008 Sebastian Dröge <slomo@circular-chaos.org>
  *
- * gstchannelmix.c: setup of channel conversion matrices
+ * audio-channel-mix.c: setup of channel conversion matrices
  *
  * This library is free software; you can redistribute it and/or
  * modify it under the terms of the GNU Library General Public
@@ -27,14 +27,14 @@
 #include <math.h>
 #include <string.h>
 
-#include "gstchannelmix.h"
+#include "audio-channel-mix.h"
 
 /*
  * Channel matrix functions.
  */
 
 void
-gst_channel_mix_unset_matrix (AudioConvertCtx * this)
+audio_channel_mix_unset_matrix (AudioConvertCtx * this)
 {
   gint i;
 
@@ -50,6 +50,13 @@ gst_channel_mix_unset_matrix (AudioConvertCtx * this)
   this->matrix = NULL;
   g_free (this->tmp);
   this->tmp = NULL;
+
+  g_free (this->mix_in);
+  this->mix_in = NULL;
+  g_free (this->mix_coef);
+  this->mix_coef = NULL;
+  g_free (this->mix_offset);
+  this->mix_offset = NULL;
 }
 
 /*
@@ -59,7 +66,7 @@ gst_channel_mix_unset_matrix (AudioConvertCtx * this)
  */
 
 static void
-gst_channel_mix_fill_identical (AudioConvertCtx * this)
+audio_channel_mix_fill_identical (AudioConvertCtx * this)
 {
   gint ci, co;
 
@@ -83,7 +90,7 @@ gst_channel_mix_fill_identical (AudioConvertCtx * this)
  */
 
 static void
-gst_channel_mix_fill_compatible (AudioConvertCtx * this)
+audio_channel_mix_fill_compatible (AudioConvertCtx * this)
 {
   /* Conversions from one-channel to compatible two-channel configs */
   struct
@@ -181,7 +188,7 @@ gst_channel_mix_fill_compatible (AudioConvertCtx * this)
  */
 
 static void
-gst_channel_mix_detect_pos (GstAudioInfo * info,
+audio_channel_mix_detect_pos (GstAudioInfo * info,
     gint * f, gboolean * has_f,
     gint * c, gboolean * has_c, gint * r, gboolean * has_r,
     gint * s, gboolean * has_s, gint * b, gboolean * has_b)
@@ -245,7 +252,7 @@ gst_channel_mix_detect_pos (GstAudioInfo * info,
 }
 
 static void
-gst_channel_mix_fill_one_other (gfloat ** matrix,
+audio_channel_mix_fill_one_other (gfloat ** matrix,
     GstAudioInfo * from_info, gint * from_idx,
     GstAudioInfo * to_info, gint * to_idx, gfloat ratio)
 {
@@ -312,7 +319,7 @@ gst_channel_mix_fill_one_other (gfloat ** matrix,
 #define RATIO_REAR_BASS (1.0 / sqrt (2.0))
 
 static void
-gst_channel_mix_fill_others (AudioConvertCtx * this)
+audio_channel_mix_fill_others (AudioConvertCtx * this)
 {
   gboolean in_has_front = FALSE, out_has_front = FALSE,
       in_has_center = FALSE, out_has_center = FALSE,
@@ -337,11 +344,11 @@ gst_channel_mix_fill_others (AudioConvertCtx * this)
 
   /* First see where (if at all) the various channels from/to
    * which we want to convert are located in our matrix/array. */
-  gst_channel_mix_detect_pos (&this->in,
+  audio_channel_mix_detect_pos (&this->in,
       in_f, &in_has_front,
       in_c, &in_has_center, in_r, &in_has_rear,
       in_s, &in_has_side, in_b, &in_has_bass);
-  gst_channel_mix_detect_pos (&this->out,
+  audio_channel_mix_detect_pos (&this->out,
       out_f, &out_has_front,
       out_c, &out_has_center, out_r, &out_has_rear,
       out_s, &out_has_side, out_b, &out_has_bass);
@@ -358,149 +365,149 @@ gst_channel_mix_fill_others (AudioConvertCtx * this)
 
   /* center <-> front/side/rear */
   if (!in_has_center && in_has_front && out_has_center) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_f, &this->out, out_c, RATIO_CENTER_FRONT);
   } else if (!in_has_center && !in_has_front && in_has_side && out_has_center) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_s, &this->out, out_c, RATIO_CENTER_SIDE);
   } else if (!in_has_center && !in_has_front && !in_has_side && in_has_rear
       && out_has_center) {
-    gst_channel_mix_fill_one_other (this->matrix, &this->in, in_r, &this->out,
+    audio_channel_mix_fill_one_other (this->matrix, &this->in, in_r, &this->out,
         out_c, RATIO_CENTER_REAR);
   } else if (in_has_center && !out_has_center && out_has_front) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_c, &this->out, out_f, RATIO_CENTER_FRONT);
   } else if (in_has_center && !out_has_center && !out_has_front && out_has_side) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_c, &this->out, out_s, RATIO_CENTER_SIDE);
   } else if (in_has_center && !out_has_center && !out_has_front && !out_has_side
       && out_has_rear) {
-    gst_channel_mix_fill_one_other (this->matrix, &this->in, in_c, &this->out,
+    audio_channel_mix_fill_one_other (this->matrix, &this->in, in_c, &this->out,
         out_r, RATIO_CENTER_REAR);
   }
 
   /* front <-> center/side/rear */
   if (!in_has_front && in_has_center && !in_has_side && out_has_front) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_c, &this->out, out_f, RATIO_CENTER_FRONT);
   } else if (!in_has_front && !in_has_center && in_has_side && out_has_front) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_s, &this->out, out_f, RATIO_FRONT_SIDE);
   } else if (!in_has_front && in_has_center && in_has_side && out_has_front) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_c, &this->out, out_f, 0.5 * RATIO_CENTER_FRONT);
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_s, &this->out, out_f, 0.5 * RATIO_FRONT_SIDE);
   } else if (!in_has_front && !in_has_center && !in_has_side && in_has_rear
       && out_has_front) {
-    gst_channel_mix_fill_one_other (this->matrix, &this->in, in_r, &this->out,
+    audio_channel_mix_fill_one_other (this->matrix, &this->in, in_r, &this->out,
         out_f, RATIO_FRONT_REAR);
   } else if (in_has_front && out_has_center && !out_has_side && !out_has_front) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_f, &this->out, out_c, RATIO_CENTER_FRONT);
   } else if (in_has_front && !out_has_center && out_has_side && !out_has_front) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_f, &this->out, out_s, RATIO_FRONT_SIDE);
   } else if (in_has_front && out_has_center && out_has_side && !out_has_front) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_f, &this->out, out_c, 0.5 * RATIO_CENTER_FRONT);
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_f, &this->out, out_s, 0.5 * RATIO_FRONT_SIDE);
   } else if (in_has_front && !out_has_center && !out_has_side && !out_has_front
       && out_has_rear) {
-    gst_channel_mix_fill_one_other (this->matrix, &this->in, in_f, &this->out,
+    audio_channel_mix_fill_one_other (this->matrix, &this->in, in_f, &this->out,
         out_r, RATIO_FRONT_REAR);
   }
 
   /* side <-> center/front/rear */
   if (!in_has_side && in_has_front && !in_has_rear && out_has_side) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_f, &this->out, out_s, RATIO_FRONT_SIDE);
   } else if (!in_has_side && !in_has_front && in_has_rear && out_has_side) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_r, &this->out, out_s, RATIO_SIDE_REAR);
   } else if (!in_has_side && in_has_front && in_has_rear && out_has_side) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_f, &this->out, out_s, 0.5 * RATIO_FRONT_SIDE);
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_r, &this->out, out_s, 0.5 * RATIO_SIDE_REAR);
   } else if (!in_has_side && !in_has_front && !in_has_rear && in_has_center
       && out_has_side) {
-    gst_channel_mix_fill_one_other (this->matrix, &this->in, in_c, &this->out,
+    audio_channel_mix_fill_one_other (this->matrix, &this->in, in_c, &this->out,
         out_s, RATIO_CENTER_SIDE);
   } else if (in_has_side && out_has_front && !out_has_rear && !out_has_side) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_s, &this->out, out_f, RATIO_FRONT_SIDE);
   } else if (in_has_side && !out_has_front && out_has_rear && !out_has_side) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_s, &this->out, out_r, RATIO_SIDE_REAR);
   } else if (in_has_side && out_has_front && out_has_rear && !out_has_side) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_s, &this->out, out_f, 0.5 * RATIO_FRONT_SIDE);
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_s, &this->out, out_r, 0.5 * RATIO_SIDE_REAR);
   } else if (in_has_side && !out_has_front && !out_has_rear && out_has_center
       && !out_has_side) {
-    gst_channel_mix_fill_one_other (this->matrix, &this->in, in_s, &this->out,
+    audio_channel_mix_fill_one_other (this->matrix, &this->in, in_s, &this->out,
         out_c, RATIO_CENTER_SIDE);
   }
 
   /* rear <-> center/front/side */
   if (!in_has_rear && in_has_side && out_has_rear) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_s, &this->out, out_r, RATIO_SIDE_REAR);
   } else if (!in_has_rear && !in_has_side && in_has_front && out_has_rear) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_f, &this->out, out_r, RATIO_FRONT_REAR);
   } else if (!in_has_rear && !in_has_side && !in_has_front && in_has_center
       && out_has_rear) {
-    gst_channel_mix_fill_one_other (this->matrix, &this->in, in_c, &this->out,
+    audio_channel_mix_fill_one_other (this->matrix, &this->in, in_c, &this->out,
         out_r, RATIO_CENTER_REAR);
   } else if (in_has_rear && !out_has_rear && out_has_side) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_r, &this->out, out_s, RATIO_SIDE_REAR);
   } else if (in_has_rear && !out_has_rear && !out_has_side && out_has_front) {
-    gst_channel_mix_fill_one_other (this->matrix,
+    audio_channel_mix_fill_one_other (this->matrix,
         &this->in, in_r, &this->out, out_f, RATIO_FRONT_REAR);
   } else if (in_has_rear && !out_has_rear && !out_has_side && !out_has_front
       && out_has_center) {
-    gst_channel_mix_fill_one_other (this->matrix, &this->in, in_r, &this->out,
+    audio_channel_mix_fill_one_other (this->matrix, &this->in, in_r, &this->out,
         out_c, RATIO_CENTER_REAR);
   }
 
   /* bass <-> any */
   if (in_has_bass && !out_has_bass) {
     if (out_has_center) {
-      gst_channel_mix_fill_one_other (this->matrix,
+      audio_channel_mix_fill_one_other (this->matrix,
           &this->in, in_b, &this->out, out_c, RATIO_CENTER_BASS);
     }
     if (out_has_front) {
-      gst_channel_mix_fill_one_other (this->matrix,
+      audio_channel_mix_fill_one_other (this->matrix,
           &this->in, in_b, &this->out, out_f, RATIO_FRONT_BASS);
     }
     if (out_has_side) {
-      gst_channel_mix_fill_one_other (this->matrix,
+      audio_channel_mix_fill_one_other (this->matrix,
           &this->in, in_b, &this->out, out_s, RATIO_SIDE_BASS);
     }
     if (out_has_rear) {
-      gst_channel_mix_fill_one_other (this->matrix,
+      audio_channel_mix_fill_one_other (this->matrix,
           &this->in, in_b, &this->out, out_r, RATIO_REAR_BASS);
     }
   } else if (!in_has_bass && out_has_bass) {
     if (in_has_center) {
-      gst_channel_mix_fill_one_other (this->matrix,
+      audio_channel_mix_fill_one_other (this->matrix,
           &this->in, in_c, &this->out, out_b, RATIO_CENTER_BASS);
     }
     if (in_has_front) {
-      gst_channel_mix_fill_one_other (this->matrix,
+      audio_channel_mix_fill_one_other (this->matrix,
           &this->in, in_f, &this->out, out_b, RATIO_FRONT_BASS);
     }
     if (in_has_side) {
-      gst_channel_mix_fill_one_other (this->matrix,
+      audio_channel_mix_fill_one_other (this->matrix,
           &this->in, in_s, &this->out, out_b, RATIO_REAR_BASS);
     }
     if (in_has_rear) {
-      gst_channel_mix_fill_one_other (this->matrix,
+      audio_channel_mix_fill_one_other (this->matrix,
           &this->in, in_r, &this->out, out_b, RATIO_REAR_BASS);
     }
   }
@@ -511,7 +518,7 @@ gst_channel_mix_fill_others (AudioConvertCtx * this)
  */
 
 static void
-gst_channel_mix_fill_normalize (AudioConvertCtx * this)
+audio_channel_mix_fill_normalize (AudioConvertCtx * this)
 {
   gfloat sum, top = 0;
   gint i, j;
@@ -539,7 +546,7 @@ gst_channel_mix_fill_normalize (AudioConvertCtx * this)
 }
 
 static gboolean
-gst_channel_mix_fill_special (AudioConvertCtx * this)
+audio_channel_mix_fill_special (AudioConvertCtx * this)
 {
   GstAudioInfo *in = &this->in, *out = &this->out;
 
@@ -576,28 +583,75 @@ gst_channel_mix_fill_special (AudioConvertCtx * this)
  */
 
 static void
-gst_channel_mix_fill_matrix (AudioConvertCtx * this)
+audio_channel_mix_fill_matrix (AudioConvertCtx * this)
 {
-  if (gst_channel_mix_fill_special (this))
+  if (audio_channel_mix_fill_special (this))
     return;
 
-  gst_channel_mix_fill_identical (this);
+  audio_channel_mix_fill_identical (this);
 
   if (!GST_AUDIO_INFO_IS_UNPOSITIONED (&this->in)) {
-    gst_channel_mix_fill_compatible (this);
-    gst_channel_mix_fill_others (this);
-    gst_channel_mix_fill_normalize (this);
+    audio_channel_mix_fill_compatible (this);
+    audio_channel_mix_fill_others (this);
+    audio_channel_mix_fill_normalize (this);
   }
 }
 
+/*
+ * Store the non-zero coefficients of the matrix per output channel and
+ * pick the mixing kernel. Most matrices only have a few non-zero
+ * coefficients per output channel, e.g. a reordering of the channels or
+ * a downmix of a few channels.
+ */
+
+static void
+audio_channel_mix_compile_matrix (AudioConvertCtx * this)
+{
+  gint i, j, n;
+  gboolean permute = TRUE;
+
+  this->mix_in = g_new (gint, this->in.channels * this->out.channels);
+  this->mix_coef = g_new (gfloat, this->in.channels * this->out.channels);
+  this->mix_offset = g_new (gint, this->out.channels + 1);
+
+  n = 0;
+  for (j = 0; j < this->out.channels; j++) {
+    this->mix_offset[j] = n;
+    for (i = 0; i < this->in.channels; i++) {
+      if (this->matrix[i][j] == 0.0)
+        continue;
+      this->mix_in[n] = i;
+      this->mix_coef[n] = this->matrix[i][j];
+      n++;
+    }
+    /* every output channel is a copy of one input channel or silence */
+    if (n - this->mix_offset[j] > 1 ||
+        (n - this->mix_offset[j] == 1 && this->mix_coef[n - 1] != 1.0))
+      permute = FALSE;
+  }
+  this->mix_offset[j] = n;
+
+  if (permute)
+    this->mix_type = MIX_PERMUTE;
+  else if (this->in.channels == 2 && this->out.channels == 1)
+    this->mix_type = MIX_STEREO_MONO;
+  else if (this->in.channels == 6 && this->out.channels == 2)
+    this->mix_type = MIX_5_1_STEREO;
+  else
+    this->mix_type = MIX_SPARSE;
+
+  GST_DEBUG ("%d of %d coefficients used, mix type %d", n,
+      this->in.channels * this->out.channels, this->mix_type);
+}
+
 /* only call after this->out and this->in are filled in */
 void
-gst_channel_mix_setup_matrix (AudioConvertCtx * this)
+audio_channel_mix_setup_matrix (AudioConvertCtx * this)
 {
   gint i, j;
 
   /* don't lose memory */
-  gst_channel_mix_unset_matrix (this);
+  audio_channel_mix_unset_matrix (this);
 
   /* temp storage */
   if (GST_AUDIO_FORMAT_INFO_IS_INTEGER (this->in.finfo) ||
@@ -616,7 +670,7 @@ gst_channel_mix_setup_matrix (AudioConvertCtx * this)
   }
 
   /* setup the matrix' internal values */
-  gst_channel_mix_fill_matrix (this);
+  audio_channel_mix_fill_matrix (this);
 
 #ifndef GST_DISABLE_GST_DEBUG
   /* debug */
@@ -642,10 +696,12 @@ gst_channel_mix_setup_matrix (AudioConvertCtx * this)
     g_string_free (s, TRUE);
   }
 #endif
+
+  audio_channel_mix_compile_matrix (this);
 }
 
 gboolean
-gst_channel_mix_passthrough (AudioConvertCtx * this)
+audio_channel_mix_passthrough (AudioConvertCtx * this)
 {
   gint i;
   guint64 in_mask, out_mask;
@@ -664,82 +720,202 @@ gst_channel_mix_passthrough (AudioConvertCtx * this)
   return in_mask == out_mask;
 }
 
-/* IMPORTANT: out_data == in_data is possible, make sure to not overwrite data
+/* The kernels below are plain scalar C and produce the same result as the
+ * full matrix multiplication, terms with a zero coefficient are only
+ * skipped.
+ *
+ * IMPORTANT: out_data == in_data is possible, make sure to not overwrite data
  * you might need later on! */
+
+/* any matrix, only the non-zero coefficients are used */
+#define MAKE_MIX_SPARSE_FUNC(name, type, restype, min, max)                   \
+static void                                                                   \
+name (AudioConvertCtx * this, type * in_data, type * out_data, gint samples)  \
+{                                                                             \
+  gint out, n, k, end;                                                        \
+  restype res;                                                                \
+  gboolean backwards;                                                         \
+  gint inchannels, outchannels;                                               \
+  type *in, *tmp = (type *) this->tmp;                                        \
+                                                                              \
+  inchannels = this->in.channels;                                             \
+  outchannels = this->out.channels;                                           \
+  backwards = outchannels > inchannels;                                       \
+                                                                              \
+  for (n = (backwards ? samples - 1 : 0); n < samples && n >= 0;              \
+      backwards ? n-- : n++) {                                                \
+    in = &in_data[n * inchannels];                                            \
+    for (out = 0; out < outchannels; out++) {                                 \
+      res = 0;                                                                \
+      end = this->mix_offset[out + 1];                                        \
+      for (k = this->mix_offset[out]; k < end; k++)                           \
+        res += in[this->mix_in[k]] * this->mix_coef[k];                       \
+                                                                              \
+      if (res < min)                                                          \
+        res = min;                                                            \
+      else if (res > max)                                                     \
+        res = max;                                                            \
+      tmp[out] = res;                                                         \
+    }                                                                         \
+    memcpy (&out_data[n * outchannels], tmp, sizeof (type) * outchannels);    \
+  }                                                                           \
+}
+
+/* every output channel is a copy of one input channel or silence */
+#define MAKE_MIX_PERMUTE_FUNC(name, type, CLIP)                               \
+static void                                                                   \
+name (AudioConvertCtx * this, type * in_data, type * out_data, gint samples)  \
+{                                                                             \
+  gint out, n;                                                                \
+  gboolean backwards;                                                         \
+  gint inchannels, outchannels;                                               \
+  type *in, *tmp = (type *) this->tmp;                                        \
+                                                                              \
+  inchannels = this->in.channels;                                             \
+  outchannels = this->out.channels;                                           \
+  backwards = outchannels > inchannels;                                       \
+                                                                              \
+  for (n = (backwards ? samples - 1 : 0); n < samples && n >= 0;              \
+      backwards ? n-- : n++) {                                                \
+    in = &in_data[n * inchannels];                                            \
+    for (out = 0; out < outchannels; out++) {                                 \
+      if (this->mix_offset[out] == this->mix_offset[out + 1]) {               \
+        tmp[out] = 0;                                                         \
+        continue;                                                             \
+      }                                                                       \
+      tmp[out] = CLIP (in[this->mix_in[this->mix_offset[out]]]);              \
+    }                                                                         \
+    memcpy (&out_data[n * outchannels], tmp, sizeof (type) * outchannels);    \
+  }                                                                           \
+}
+
+/* 2 -> 1 channels, the output sample never overlaps unread input */
+#define MAKE_MIX_STEREO_MONO_FUNC(name, type, restype, min, max)              \
+static void                                                                   \
+name (AudioConvertCtx * this, type * in_data, type * out_data, gint samples)  \
+{                                                                             \
+  gint n;                                                                     \
+  restype res;                                                                \
+  gfloat c0 = this->matrix[0][0], c1 = this->matrix[1][0];                    \
+                                                                              \
+  for (n = 0; n < samples; n++) {                                             \
+    res = 0;                                                                  \
+    res += in_data[2 * n] * c0;                                               \
+    res += in_data[2 * n + 1] * c1;                                           \
+                                                                              \
+    if (res < min)                                                            \
+      res = min;                                                              \
+    else if (res > max)                                                       \
+      res = max;                                                              \
+    out_data[n] = res;                                                        \
+  }                                                                           \
+}
+
+/* 6 -> 2 channels, like 5.1 to stereo. All 12 coefficients are used, the
+ * fixed number of terms lets the compiler unroll the inner loops. This is
+ * still scalar code, one frame at a time. */
+#define MAKE_MIX_5_1_STEREO_FUNC(name, type, restype, min, max)               \
+static void                                                                   \
+name (AudioConvertCtx * this, type * in_data, type * out_data, gint samples)  \
+{                                                                             \
+  gint n, i;                                                                  \
+  restype l, r;                                                               \
+  gfloat cl[6], cr[6];                                                        \
+  type in[6];                                                                 \
+                                                                              \
+  for (i = 0; i < 6; i++) {                                                   \
+    cl[i] = this->matrix[i][0];                                               \
+    cr[i] = this->matrix[i][1];                                               \
+  }                                                                           \
+                                                                              \
+  for (n = 0; n < samples; n++) {                                             \
+    for (i = 0; i < 6; i++)                                                   \
+      in[i] = in_data[6 * n + i];                                             \
+                                                                              \
+    l = r = 0;                                                                \
+    for (i = 0; i < 6; i++) {                                                 \
+      l += in[i] * cl[i];                                                     \
+      r += in[i] * cr[i];                                                     \
+    }                                                                         \
+                                                                              \
+    if (l < min)                                                              \
+      l = min;                                                                \
+    else if (l > max)                                                         \
+      l = max;                                                                \
+    if (r < min)                                                              \
+      r = min;                                                                \
+    else if (r > max)                                                         \
+      r = max;                                                                \
+    out_data[2 * n] = l;                                                      \
+    out_data[2 * n + 1] = r;                                                  \
+  }                                                                           \
+}
+
+/* FIXME: the intermediate format for int mixing is 32 bits, shouldn't we
+ * use doubles instead? */
+MAKE_MIX_SPARSE_FUNC (audio_channel_mix_mix_int_sparse, gint32, gint64,
+    G_MININT32, G_MAXINT32);
+#define CLIP_INT(v) (v)
+#define CLIP_FLOAT(v) CLAMP (v, -1.0, 1.0)
+
+MAKE_MIX_PERMUTE_FUNC (audio_channel_mix_mix_int_permute, gint32, CLIP_INT);
+MAKE_MIX_STEREO_MONO_FUNC (audio_channel_mix_mix_int_stereo_mono, gint32,
+    gint64, G_MININT32, G_MAXINT32);
+MAKE_MIX_5_1_STEREO_FUNC (audio_channel_mix_mix_int_5_1_stereo, gint32,
+    gint64, G_MININT32, G_MAXINT32);
+
+MAKE_MIX_SPARSE_FUNC (audio_channel_mix_mix_float_sparse, gdouble, gdouble,
+    -1.0, 1.0);
+MAKE_MIX_PERMUTE_FUNC (audio_channel_mix_mix_float_permute, gdouble,
+    CLIP_FLOAT);
+MAKE_MIX_STEREO_MONO_FUNC (audio_channel_mix_mix_float_stereo_mono, gdouble,
+    gdouble, -1.0, 1.0);
+MAKE_MIX_5_1_STEREO_FUNC (audio_channel_mix_mix_float_5_1_stereo, gdouble,
+    gdouble, -1.0, 1.0);
+
 void
-gst_channel_mix_mix_int (AudioConvertCtx * this,
+audio_channel_mix_mix_int (AudioConvertCtx * this,
     gint32 * in_data, gint32 * out_data, gint samples)
 {
-  gint in, out, n;
-  gint64 res;
-  gboolean backwards;
-  gint inchannels, outchannels;
-  gint32 *tmp = (gint32 *) this->tmp;
-
   g_return_if_fail (this->matrix != NULL);
   g_return_if_fail (this->tmp != NULL);
 
-  inchannels = this->in.channels;
-  outchannels = this->out.channels;
-  backwards = outchannels > inchannels;
-
-  /* FIXME: use orc here? */
-  for (n = (backwards ? samples - 1 : 0); n < samples && n >= 0;
-      backwards ? n-- : n++) {
-    for (out = 0; out < outchannels; out++) {
-      /* convert */
-      res = 0;
-      for (in = 0; in < inchannels; in++) {
-        res += in_data[n * inchannels + in] * this->matrix[in][out];
-      }
-
-      /* clip (shouldn't we use doubles instead as intermediate format?) */
-      if (res < G_MININT32)
-        res = G_MININT32;
-      else if (res > G_MAXINT32)
-        res = G_MAXINT32;
-      tmp[out] = res;
-    }
-    memcpy (&out_data[n * outchannels], this->tmp,
-        sizeof (gint32) * outchannels);
+  switch (this->mix_type) {
+    case MIX_PERMUTE:
+      audio_channel_mix_mix_int_permute (this, in_data, out_data, samples);
+      break;
+    case MIX_STEREO_MONO:
+      audio_channel_mix_mix_int_stereo_mono (this, in_data, out_data, samples);
+      break;
+    case MIX_5_1_STEREO:
+      audio_channel_mix_mix_int_5_1_stereo (this, in_data, out_data, samples);
+      break;
+    default:
+      audio_channel_mix_mix_int_sparse (this, in_data, out_data, samples);
+      break;
   }
 }
 
 void
-gst_channel_mix_mix_float (AudioConvertCtx * this,
+audio_channel_mix_mix_float (AudioConvertCtx * this,
     gdouble * in_data, gdouble * out_data, gint samples)
 {
-  gint in, out, n;
-  gdouble res;
-  gboolean backwards;
-  gint inchannels, outchannels;
-  gdouble *tmp = (gdouble *) this->tmp;
-
   g_return_if_fail (this->matrix != NULL);
   g_return_if_fail (this->tmp != NULL);
 
-  inchannels = this->in.channels;
-  outchannels = this->out.channels;
-  backwards = outchannels > inchannels;
-
-  /* FIXME: use liboil here? */
-  for (n = (backwards ? samples - 1 : 0); n < samples && n >= 0;
-      backwards ? n-- : n++) {
-    for (out = 0; out < outchannels; out++) {
-      /* convert */
-      res = 0.0;
-      for (in = 0; in < inchannels; in++) {
-        res += in_data[n * inchannels + in] * this->matrix[in][out];
-      }
-
-      /* clip (shouldn't we use doubles instead as intermediate format?) */
-      if (res < -1.0)
-        res = -1.0;
-      else if (res > 1.0)
-        res = 1.0;
-      tmp[out] = res;
-    }
-    memcpy (&out_data[n * outchannels], this->tmp,
-        sizeof (gdouble) * outchannels);
+  switch (this->mix_type) {
+    case MIX_PERMUTE:
+      audio_channel_mix_mix_float_permute (this, in_data, out_data, samples);
+      break;
+    case MIX_STEREO_MONO:
+      audio_channel_mix_mix_float_stereo_mono (this, in_data, out_data,
+          samples);
+      break;
+    case MIX_5_1_STEREO:
+      audio_channel_mix_mix_float_5_1_stereo (this, in_data, out_data, samples);
+      break;
+    default:
+      audio_channel_mix_mix_float_sparse (this, in_data, out_data, samples);
+      break;
   }
 }
@@ -1,7 +1,7 @@
 /* GStreamer
  * Copyright (C) 2004 Ronald Bultje <rbultje@ronald.bitfreak.net>
  *
- * gstchannelmix.h: setup of channel conversion matrices
+ * audio-channel-mix.h: setup of channel conversion matrices
  *
  * This library is free software; you can redistribute it and/or
  * modify it under the terms of the GNU Library General Public
@@ -23,32 +23,32 @@
 #define __GST_CHANNEL_MIX_H__
 
 #include <gst/gst.h>
-#include "audioconvert.h"
+#include "audio-converter-private.h"
 
 /*
  * Delete channel mixer matrix.
  */
-void            gst_channel_mix_unset_matrix    (AudioConvertCtx * this);
+void            audio_channel_mix_unset_matrix  (AudioConvertCtx * this);
 
 /*
  * Setup channel mixer matrix.
  */
-void            gst_channel_mix_setup_matrix    (AudioConvertCtx * this);
+void            audio_channel_mix_setup_matrix  (AudioConvertCtx * this);
 
 /*
  * Checks for passthrough (= identity matrix).
  */
-gboolean        gst_channel_mix_passthrough     (AudioConvertCtx * this);
+gboolean        audio_channel_mix_passthrough   (AudioConvertCtx * this);
 
 /*
  * Do actual mixing.
  */
-void            gst_channel_mix_mix_int         (AudioConvertCtx * this,
+void            audio_channel_mix_mix_int       (AudioConvertCtx * this,
                                                  gint32          * in_data,
                                                  gint32          * out_data,
                                                  gint              samples);
 
-void            gst_channel_mix_mix_float       (AudioConvertCtx * this,
+void            audio_channel_mix_mix_float     (AudioConvertCtx * this,
                                                  gdouble         * in_data,
                                                  gdouble         * out_data,
                                                  gint              samples);
@@ -145,6 +145,21 @@ check_valid_channel_positions (const GstAudioChannelPosition * position,
   return TRUE;
 }
 
+#define REORDER_FRAMES(type, data, n_frames, channels, reorder_map)      \
+G_STMT_START {                                                          \
+  type *p = (type *) (data);                                            \
+  type t[64];                                                           \
+  gint f, c;                                                            \
+                                                                        \
+  for (f = 0; f < (n_frames); f++) {                                    \
+    for (c = 0; c < (channels); c++)                                    \
+      t[c] = p[c];                                                      \
+    for (c = 0; c < (channels); c++)                                    \
+      p[(reorder_map)[c]] = t[c];                                       \
+    p += (channels);                                                    \
+  }                                                                     \
+} G_STMT_END
+
 /**
  * gst_audio_reorder_channels:
  * @data: (array length=size) (element-type guint8): The pointer to
@@ -199,6 +214,28 @@ gst_audio_reorder_channels (gpointer data, gsize size, GstAudioFormat format,
   ptr = data;
 
   n = size / bpf;
+
+  /* copy whole samples for the common sample sizes instead of calling memcpy
+   * for every single sample */
+  if (((guintptr) data) % bps == 0) {
+    switch (bps) {
+      case 1:
+        REORDER_FRAMES (guint8, data, n, channels, reorder_map);
+        return TRUE;
+      case 2:
+        REORDER_FRAMES (guint16, data, n, channels, reorder_map);
+        return TRUE;
+      case 4:
+        REORDER_FRAMES (guint32, data, n, channels, reorder_map);
+        return TRUE;
+      case 8:
+        REORDER_FRAMES (guint64, data, n, channels, reorder_map);
+        return TRUE;
+      default:
+        break;
+    }
+  }
+
   for (i = 0; i < n; i++) {
 
     memcpy (tmp, ptr, bpf);
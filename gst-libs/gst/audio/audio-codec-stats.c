@@ -0,0 +1,195 @@
+/* GStreamer
+ *
+ * audio-codec-stats.c: statistics kept by the audio codec base classes
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "audio-codec-stats.h"
+
+/* Times are taken from the monotonic clock in microseconds, which is cheap
+ * to read on every frame and is not affected by the pipeline clock */
+
+typedef struct
+{
+  guint64 end;
+  gint64 arrival;
+} AudioCodecArrival;
+
+void
+audio_codec_stats_init (AudioCodecStats * stats)
+{
+  memset (stats, 0, sizeof (AudioCodecStats));
+  stats->arrivals = g_array_new (FALSE, FALSE, sizeof (AudioCodecArrival));
+}
+
+void
+audio_codec_stats_free (AudioCodecStats * stats)
+{
+  g_array_free (stats->arrivals, TRUE);
+  stats->arrivals = NULL;
+}
+
+void
+audio_codec_stats_reset (AudioCodecStats * stats)
+{
+  GstClockTime interval = stats->interval;
+  GArray *arrivals = stats->arrivals;
+
+  memset (stats, 0, sizeof (AudioCodecStats));
+  stats->interval = interval;
+  stats->last_post = g_get_monotonic_time ();
+  stats->arrivals = arrivals;
+  g_array_set_size (arrivals, 0);
+}
+
+/* Audio has no frame objects to carry the arrival time, so the arrival of
+ * the input is tracked by the position of its last unit in the stream.
+ * The units are whatever the element consumes the input in, input frames
+ * for decoders and bytes for encoders. */
+void
+audio_codec_stats_add_input (AudioCodecStats * stats, guint64 units)
+{
+  AudioCodecArrival arrival;
+
+  stats->units_in += units;
+  arrival.end = stats->units_in;
+  arrival.arrival = g_get_monotonic_time ();
+  g_array_append_val (stats->arrivals, arrival);
+}
+
+/* consumes @units of input and returns the time the first of them arrived,
+ * or 0 when unknown */
+gint64
+audio_codec_stats_take_input (AudioCodecStats * stats, guint64 units)
+{
+  AudioCodecArrival *arrivals = (AudioCodecArrival *) stats->arrivals->data;
+  gint64 arrival = 0;
+  guint i;
+
+  if (stats->arrivals->len > 0)
+    arrival = arrivals[0].arrival;
+
+  stats->units_out = MIN (stats->units_out + units, stats->units_in);
+  for (i = 0; i < stats->arrivals->len; i++) {
+    if (arrivals[i].end > stats->units_out)
+      break;
+  }
+  if (i > 0)
+    g_array_remove_range (stats->arrivals, 0, i);
+
+  return arrival;
+}
+
+/* forget about the pending input, after a flush */
+void
+audio_codec_stats_clear_input (AudioCodecStats * stats)
+{
+  g_array_set_size (stats->arrivals, 0);
+  stats->units_out = stats->units_in;
+}
+
+/* @start is the monotonic time before the subclass was called */
+void
+audio_codec_stats_add_processed (AudioCodecStats * stats, gint64 start)
+{
+  GstClockTime elapsed;
+  guint bucket;
+
+  elapsed = (g_get_monotonic_time () - start) * GST_USECOND;
+
+  stats->processed++;
+  stats->proc_time += elapsed;
+  if (elapsed > stats->max_proc_time)
+    stats->max_proc_time = elapsed;
+
+  bucket = g_bit_storage (elapsed / GST_MSECOND);
+  if (elapsed < GST_MSECOND)
+    bucket = 0;
+  stats->proc_hist[MIN (bucket, AUDIO_CODEC_STATS_N_BUCKETS - 1)]++;
+}
+
+/* @arrival is the monotonic time the frame arrived, or 0 when unknown */
+void
+audio_codec_stats_add_pushed (AudioCodecStats * stats, gint64 arrival)
+{
+  GstClockTime latency;
+
+  stats->pushed++;
+  if (arrival == 0)
+    return;
+
+  latency = (g_get_monotonic_time () - arrival) * GST_USECOND;
+  stats->latency += latency;
+  stats->n_latency++;
+  if (latency > stats->max_latency)
+    stats->max_latency = latency;
+}
+
+GstStructure *
+audio_codec_stats_to_structure (AudioCodecStats * stats, const gchar * name,
+    guint in_flight)
+{
+  GstStructure *s;
+  GValue hist = G_VALUE_INIT;
+  GValue val = G_VALUE_INIT;
+  guint i;
+
+  s = gst_structure_new (name,
+      "processed", G_TYPE_UINT64, stats->processed,
+      "pushed", G_TYPE_UINT64, stats->pushed,
+      "dropped", G_TYPE_UINT64, stats->dropped,
+      "in-flight", G_TYPE_UINT, in_flight,
+      "processing-time", G_TYPE_UINT64, stats->proc_time,
+      "max-processing-time", G_TYPE_UINT64, stats->max_proc_time,
+      "average-latency", G_TYPE_UINT64,
+      stats->n_latency ? stats->latency / stats->n_latency : 0,
+      "max-latency", G_TYPE_UINT64, stats->max_latency, NULL);
+
+  g_value_init (&hist, GST_TYPE_ARRAY);
+  g_value_init (&val, G_TYPE_UINT64);
+  for (i = 0; i < AUDIO_CODEC_STATS_N_BUCKETS; i++) {
+    g_value_set_uint64 (&val, stats->proc_hist[i]);
+    gst_value_array_append_value (&hist, &val);
+  }
+  g_value_unset (&val);
+  gst_structure_take_value (s, "processing-histogram", &hist);
+
+  return s;
+}
+
+/* TRUE when the stats are due to be posted on the bus again */
+gboolean
+audio_codec_stats_need_post (AudioCodecStats * stats)
+{
+  gint64 now;
+
+  if (stats->interval == 0)
+    return FALSE;
+
+  now = g_get_monotonic_time ();
+  if ((now - stats->last_post) * GST_USECOND < stats->interval)
+    return FALSE;
+
+  stats->last_post = now;
+  return TRUE;
+}
@@ -0,0 +1,87 @@
+/* GStreamer
+ *
+ * audio-codec-stats.h: statistics kept by the audio codec base classes
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_AUDIO_CODEC_STATS_H__
+#define __GST_AUDIO_CODEC_STATS_H__
+
+#include <gst/gst.h>
+
+G_BEGIN_DECLS
+
+/* processing times are counted in power of two buckets of milliseconds,
+ * the first bucket holds times below 1ms and the last one everything from
+ * 64ms up */
+#define AUDIO_CODEC_STATS_N_BUCKETS 8
+
+typedef struct _AudioCodecStats AudioCodecStats;
+
+/* all fields are protected by the object lock of the element */
+struct _AudioCodecStats
+{
+  /* handle_frame calls */
+  guint64 processed;
+  /* buffers pushed downstream */
+  guint64 pushed;
+  /* input frames finished without output */
+  guint64 dropped;
+
+  /* time spent in handle_frame */
+  GstClockTime proc_time;
+  GstClockTime max_proc_time;
+  guint64 proc_hist[AUDIO_CODEC_STATS_N_BUCKETS];
+
+  /* time between the arrival of the input and pushing the output */
+  GstClockTime latency;
+  GstClockTime max_latency;
+  guint64 n_latency;
+
+  /* arrival times of the pending input, see audio_codec_stats_add_input() */
+  GArray *arrivals;
+  guint64 units_in;
+  guint64 units_out;
+
+  /* interval for posting the stats on the bus, 0 disables */
+  GstClockTime interval;
+  gint64 last_post;
+};
+
+void           audio_codec_stats_init         (AudioCodecStats * stats);
+void           audio_codec_stats_free         (AudioCodecStats * stats);
+void           audio_codec_stats_reset        (AudioCodecStats * stats);
+
+void           audio_codec_stats_add_input    (AudioCodecStats * stats,
+                                               guint64 units);
+gint64         audio_codec_stats_take_input   (AudioCodecStats * stats,
+                                               guint64 units);
+void           audio_codec_stats_clear_input  (AudioCodecStats * stats);
+
+void           audio_codec_stats_add_processed (AudioCodecStats * stats,
+                                                gint64 start);
+void           audio_codec_stats_add_pushed   (AudioCodecStats * stats,
+                                               gint64 arrival);
+
+GstStructure * audio_codec_stats_to_structure (AudioCodecStats * stats,
+                                               const gchar * name,
+                                               guint in_flight);
+gboolean       audio_codec_stats_need_post    (AudioCodecStats * stats);
+
+G_END_DECLS
+
+#endif /* __GST_AUDIO_CODEC_STATS_H__ */
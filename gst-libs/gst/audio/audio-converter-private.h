@@ -0,0 +1,111 @@
+/* GStreamer
+ * Copyright (C) 2004 Ronald Bultje <rbultje@ronald.bitfreak.net>
+ *
+ * audio-converter-private.h: audio format conversion engine
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_AUDIO_CONVERTER_PRIVATE_H__
+#define __GST_AUDIO_CONVERTER_PRIVATE_H__
+
+#include <gst/gst.h>
+#include <gst/audio/audio.h>
+
+GST_DEBUG_CATEGORY_EXTERN (audio_converter_debug);
+#define GST_CAT_DEFAULT (audio_converter_debug)
+
+typedef struct _AudioConvertCtx AudioConvertCtx;
+typedef struct _AudioConvertTask AudioConvertTask;
+
+typedef void (*AudioConvertUnpack) (gpointer src, gpointer dst, gint scale,
+    gint count);
+typedef void (*AudioConvertPack) (gpointer src, gpointer dst, gint scale,
+    gint count);
+
+typedef void (*AudioConvertMix) (AudioConvertCtx *, gpointer, gpointer, gint);
+
+/* kernel used by the channel mixer, picked from the matrix at setup */
+typedef enum
+{
+  MIX_SPARSE = 0,
+  MIX_PERMUTE,
+  MIX_STEREO_MONO,
+  MIX_5_1_STEREO
+} AudioConvertMixType;
+typedef void (*AudioConvertQuantize) (AudioConvertCtx * ctx, gpointer src,
+    gpointer dst, gint count);
+typedef void (*AudioConvertFastpath) (gpointer src, gpointer dst, gint count);
+
+struct _AudioConvertCtx
+{
+  GstAudioInfo in;
+  GstAudioInfo out;
+
+  AudioConvertUnpack unpack;
+  AudioConvertPack pack;
+
+  /* channel conversion matrix, m[in_channels][out_channels].
+   * If identity matrix, passthrough applies. */
+  gfloat **matrix;
+  /* sparse form of the matrix: output channel o is the sum of the input
+   * channels mix_in[mix_offset[o] .. mix_offset[o + 1] - 1] multiplied
+   * with the matching mix_coef */
+  AudioConvertMixType mix_type;
+  gint *mix_in;
+  gfloat *mix_coef;
+  gint *mix_offset;
+  /* temp storage for channelmix */
+  gpointer tmp;
+
+  gboolean in_default;
+  gboolean mix_passthrough;
+  gboolean out_default;
+
+  gpointer tmpbuf;
+  gint tmpbufsize;
+
+  gint in_scale;
+  gint out_scale;
+
+  AudioConvertMix channel_mix;
+
+  AudioConvertQuantize quantize;
+
+  /* direct conversion from the input to the output format, replaces
+   * all of the above when set */
+  AudioConvertFastpath fastpath;
+
+  GstAudioDitherMethod dither;
+  GstAudioNoiseShapingMethod ns;
+  /* last random number generated per channel for hifreq TPDF dither */
+  gpointer last_random;
+  /* contains the past quantization errors, error[count][out_channels] */
+  gdouble *error_buf;
+  /* dither noise for all samples of the current buffer */
+  gpointer dither_buf;
+  gint dither_bufsize;
+
+  /* worker threads converting blocks of samples of large buffers */
+  guint n_threads;
+  GThreadPool *pool;
+  AudioConvertTask *tasks;
+  GMutex lock;
+  GCond cond;
+  guint n_pending;
+};
+
+#endif /* __GST_AUDIO_CONVERTER_PRIVATE_H__ */
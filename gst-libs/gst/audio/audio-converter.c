@@ -1,7 +1,7 @@
 /* GStreamer
  * Copyright (C) 2005 Wim Taymans <wim at fluendo dot com>
  *
- * audioconvert.c: Convert audio to different audio formats automatically
+ * audio-converter.c: Convert audio to different audio formats automatically
  *
  * This library is free software; you can redistribute it and/or
  * modify it under the terms of the GNU Library General Public
@@ -19,6 +19,22 @@
  * Boston, MA 02110-1301, USA.
  */
 
+/**
+ * SECTION:gstaudioconverter
+ * @short_description: Convert audio samples between formats
+ *
+ * #GstAudioConverter converts raw audio samples between the sample formats
+ * and channel layouts described by two #GstAudioInfo with the same rate.
+ * It uses optimized code for the common format pairs and falls back to
+ * a generic unpack, mix, quantize and pack path for the others.
+ *
+ * The conversion can be tuned with a #GstStructure holding the
+ * GST_AUDIO_CONVERTER_OPT_* options, passed to gst_audio_converter_new()
+ * or gst_audio_converter_set_config().
+ *
+ * Since: 1.2
+ */
+
 #ifdef HAVE_CONFIG_H
 #include "config.h"
 #endif
@@ -26,10 +42,25 @@
 #include <math.h>
 #include <string.h>
 
-#include "gstchannelmix.h"
-#include "gstaudioquantize.h"
-#include "audioconvert.h"
-#include "gstaudioconvertorc.h"
+#include "audio-channel-mix.h"
+#include "audio-quantize.h"
+#include "audio-converter-private.h"
+#include "audio-converter.h"
+#include "gstaudiopack.h"
+
+GST_DEBUG_CATEGORY (audio_converter_debug);
+
+struct _GstAudioConverter
+{
+  AudioConvertCtx ctx;
+
+  /* the requested methods, the context disables them for formats where they
+   * make no difference */
+  GstAudioDitherMethod dither;
+  GstAudioNoiseShapingMethod ns;
+
+  GstStructure *config;
+};
 
 #if G_BYTE_ORDER == G_LITTLE_ENDIAN
 #define audio_convert_orc_unpack_u16_le audio_convert_orc_unpack_u16
@@ -558,7 +589,7 @@ static AudioConvertPack pack_funcs[] = {
 #define DOUBLE_INTERMEDIATE_FORMAT(ctx)                   \
     ((!GST_AUDIO_FORMAT_INFO_IS_INTEGER (ctx->in.finfo) &&    \
       !GST_AUDIO_FORMAT_INFO_IS_INTEGER (ctx->out.finfo)) ||  \
-     (ctx->ns != NOISE_SHAPING_NONE))
+     (ctx->ns != GST_AUDIO_NOISE_SHAPING_NONE))
 
 static gint
 audio_convert_get_func_index (AudioConvertCtx * ctx,
@@ -570,7 +601,7 @@ audio_convert_get_func_index (AudioConvertCtx * ctx,
     index += (GST_AUDIO_FORMAT_INFO_WIDTH (fmt) / 8 - 1) * 4;
     index += GST_AUDIO_FORMAT_INFO_IS_LITTLE_ENDIAN (fmt) ? 0 : 2;
     index += GST_AUDIO_FORMAT_INFO_IS_SIGNED (fmt) ? 1 : 0;
-    index += (ctx->ns == NOISE_SHAPING_NONE) ? 0 : 24;
+    index += (ctx->ns == GST_AUDIO_NOISE_SHAPING_NONE) ? 0 : 24;
   } else {
     /* this is float/double */
     index = 16;
@@ -592,10 +623,79 @@ check_default (AudioConvertCtx * ctx, const GstAudioFormatInfo * fmt)
   }
 }
 
-gboolean
+/***
+ * fastpaths, converting directly between two formats without going
+ * through the intermediate format
+ */
+static void
+audio_convert_fastpath_s16_float (gpointer src, gpointer dst, gint count)
+{
+  audio_convert_orc_s16_float (dst, src, count);
+}
+
+static void
+audio_convert_fastpath_float_s16 (gpointer src, gpointer dst, gint count)
+{
+  audio_convert_orc_float_s16 (dst, src, count);
+}
+
+static void
+audio_convert_fastpath_float_s32 (gpointer src, gpointer dst, gint count)
+{
+  audio_convert_orc_unpack_float_s32 (dst, src, count);
+}
+
+typedef struct
+{
+  GstAudioFormat in_format;
+  GstAudioFormat out_format;
+  AudioConvertFastpath convert;
+} AudioConvertTransform;
+
+/* these give the same result as the generic conversion, for int output
+ * they are only used without dithering and noise shaping */
+static const AudioConvertTransform transforms[] = {
+  {GST_AUDIO_FORMAT_S16, GST_AUDIO_FORMAT_F32,
+      audio_convert_fastpath_s16_float},
+  {GST_AUDIO_FORMAT_F32, GST_AUDIO_FORMAT_S16,
+      audio_convert_fastpath_float_s16},
+  {GST_AUDIO_FORMAT_F32, GST_AUDIO_FORMAT_S32,
+      audio_convert_fastpath_float_s32},
+};
+
+static AudioConvertFastpath
+audio_convert_lookup_fastpath (AudioConvertCtx * ctx)
+{
+  gint i;
+  GstAudioFormat in_format, out_format;
+
+  if (!ctx->mix_passthrough)
+    return NULL;
+
+  if (GST_AUDIO_FORMAT_INFO_IS_INTEGER (ctx->out.finfo) &&
+      (ctx->dither != GST_AUDIO_DITHER_NONE
+          || ctx->ns != GST_AUDIO_NOISE_SHAPING_NONE))
+    return NULL;
+
+  in_format = GST_AUDIO_INFO_FORMAT (&ctx->in);
+  out_format = GST_AUDIO_INFO_FORMAT (&ctx->out);
+
+  for (i = 0; i < G_N_ELEMENTS (transforms); i++) {
+    if (transforms[i].in_format == in_format &&
+        transforms[i].out_format == out_format) {
+      GST_INFO ("using fastpath");
+      return transforms[i].convert;
+    }
+  }
+  return NULL;
+}
+
+static gboolean audio_convert_clean_context (AudioConvertCtx * ctx);
+
+static gboolean
 audio_convert_prepare_context (AudioConvertCtx * ctx, GstAudioInfo * in,
-    GstAudioInfo * out, GstAudioConvertDithering dither,
-    GstAudioConvertNoiseShaping ns)
+    GstAudioInfo * out, GstAudioDitherMethod dither,
+    GstAudioNoiseShapingMethod ns)
 {
   gint idx_in, idx_out;
   gint in_depth, out_depth;
@@ -629,17 +729,17 @@ audio_convert_prepare_context (AudioConvertCtx * ctx, GstAudioInfo * in,
     ctx->ns = ns;
     GST_INFO ("using dither %d and noise shaping %d", dither, ns);
   } else {
-    ctx->dither = DITHER_NONE;
-    ctx->ns = NOISE_SHAPING_NONE;
+    ctx->dither = GST_AUDIO_DITHER_NONE;
+    ctx->ns = GST_AUDIO_NOISE_SHAPING_NONE;
     GST_INFO ("using no dither and noise shaping");
   }
 
   /* Use simple error feedback when output sample rate is smaller than
    * 32000 as the other methods might move the noise to audible ranges */
-  if (ctx->ns > NOISE_SHAPING_ERROR_FEEDBACK && out->rate < 32000)
-    ctx->ns = NOISE_SHAPING_ERROR_FEEDBACK;
+  if (ctx->ns > GST_AUDIO_NOISE_SHAPING_ERROR_FEEDBACK && out->rate < 32000)
+    ctx->ns = GST_AUDIO_NOISE_SHAPING_ERROR_FEEDBACK;
 
-  gst_channel_mix_setup_matrix (ctx);
+  audio_channel_mix_setup_matrix (ctx);
 
   idx_in = audio_convert_get_func_index (ctx, in->finfo);
   ctx->unpack = unpack_funcs[idx_in];
@@ -653,17 +753,17 @@ audio_convert_prepare_context (AudioConvertCtx * ctx, GstAudioInfo * in,
    * intermediate format and switch mixing */
   if (!DOUBLE_INTERMEDIATE_FORMAT (ctx)) {
     GST_INFO ("use int mixing");
-    ctx->channel_mix = (AudioConvertMix) gst_channel_mix_mix_int;
+    ctx->channel_mix = (AudioConvertMix) audio_channel_mix_mix_int;
   } else {
     GST_INFO ("use float mixing");
-    ctx->channel_mix = (AudioConvertMix) gst_channel_mix_mix_float;
+    ctx->channel_mix = (AudioConvertMix) audio_channel_mix_mix_float;
   }
   GST_INFO ("unitsizes: %d -> %d", in->bpf, out->bpf);
 
   /* check if input is in default format */
   ctx->in_default = check_default (ctx, in->finfo);
   /* check if channel mixer is passthrough */
-  ctx->mix_passthrough = gst_channel_mix_passthrough (ctx);
+  ctx->mix_passthrough = audio_channel_mix_passthrough (ctx);
   /* check if output is in default format */
   ctx->out_default = check_default (ctx, out->finfo);
 
@@ -677,7 +777,9 @@ audio_convert_prepare_context (AudioConvertCtx * ctx, GstAudioInfo * in,
 
   GST_INFO ("scale in %d, out %d", ctx->in_scale, ctx->out_scale);
 
-  gst_audio_quantize_setup (ctx);
+  audio_quantize_setup (ctx);
+
+  ctx->fastpath = audio_convert_lookup_fastpath (ctx);
 
   return TRUE;
 
@@ -689,15 +791,52 @@ unpositioned:
   }
 }
 
-gboolean
+/* don't split buffers in blocks of fewer values than this */
+#define MIN_TASK_VALUES 8192
+
+struct _AudioConvertTask
+{
+  /* copy of the context with its own temp buffers */
+  AudioConvertCtx ctx;
+  gpointer src;
+  gpointer dst;
+  gint samples;
+  gboolean src_writable;
+};
+
+static void
+audio_convert_free_tasks (AudioConvertCtx * ctx)
+{
+  guint i;
+
+  if (ctx->pool) {
+    g_thread_pool_free (ctx->pool, FALSE, TRUE);
+    ctx->pool = NULL;
+    g_mutex_clear (&ctx->lock);
+    g_cond_clear (&ctx->cond);
+  }
+  if (ctx->tasks) {
+    for (i = 1; i < ctx->n_threads; i++) {
+      g_free (ctx->tasks[i].ctx.tmp);
+      g_free (ctx->tasks[i].ctx.tmpbuf);
+    }
+    g_free (ctx->tasks);
+    ctx->tasks = NULL;
+  }
+  ctx->n_threads = 1;
+}
+
+static gboolean
 audio_convert_clean_context (AudioConvertCtx * ctx)
 {
   g_return_val_if_fail (ctx != NULL, FALSE);
 
-  gst_audio_quantize_free (ctx);
-  gst_channel_mix_unset_matrix (ctx);
+  audio_convert_free_tasks (ctx);
+  audio_quantize_free (ctx);
+  audio_channel_mix_unset_matrix (ctx);
   gst_audio_info_init (&ctx->in);
   gst_audio_info_init (&ctx->out);
+  ctx->fastpath = NULL;
 
   g_free (ctx->tmpbuf);
   ctx->tmpbuf = NULL;
@@ -706,22 +845,8 @@ audio_convert_clean_context (AudioConvertCtx * ctx)
   return TRUE;
 }
 
-gboolean
-audio_convert_get_sizes (AudioConvertCtx * ctx, gint samples, gint * srcsize,
-    gint * dstsize)
-{
-  g_return_val_if_fail (ctx != NULL, FALSE);
-
-  if (srcsize)
-    *srcsize = samples * ctx->in.bpf;
-  if (dstsize)
-    *dstsize = samples * ctx->out.bpf;
-
-  return TRUE;
-}
-
-gboolean
-audio_convert_convert (AudioConvertCtx * ctx, gpointer src,
+static void
+audio_convert_convert_block (AudioConvertCtx * ctx, gpointer src,
     gpointer dst, gint samples, gboolean src_writable)
 {
   guint insize, outsize, size;
@@ -729,13 +854,10 @@ audio_convert_convert (AudioConvertCtx * ctx, gpointer src,
   guint intemp = 0, outtemp = 0, biggest;
   gint in_width, out_width;
 
-  g_return_val_if_fail (ctx != NULL, FALSE);
-  g_return_val_if_fail (src != NULL, FALSE);
-  g_return_val_if_fail (dst != NULL, FALSE);
-  g_return_val_if_fail (samples >= 0, FALSE);
-
-  if (samples == 0)
-    return TRUE;
+  if (ctx->fastpath) {
+    ctx->fastpath (src, dst, samples * ctx->in.channels);
+    return;
+  }
 
   insize = ctx->in.bpf * samples;
   outsize = ctx->out.bpf * samples;
@@ -806,6 +928,353 @@ audio_convert_convert (AudioConvertCtx * ctx, gpointer src,
     /* pack default format into dst */
     ctx->pack (src, dst, ctx->out_scale, samples * ctx->out.channels);
   }
+}
+
+static void
+audio_convert_pool_func (gpointer data, gpointer user_data)
+{
+  AudioConvertTask *task = data;
+  AudioConvertCtx *ctx = user_data;
+
+  audio_convert_convert_block (&task->ctx, task->src, task->dst,
+      task->samples, task->src_writable);
+
+  g_mutex_lock (&ctx->lock);
+  if (--ctx->n_pending == 0)
+    g_cond_signal (&ctx->cond);
+  g_mutex_unlock (&ctx->lock);
+}
+
+/* split buffers in up to @n_threads blocks of samples and convert them in
+ * parallel, 0 uses the number of processors. The calling thread converts the
+ * first block. */
+static void
+audio_convert_set_threads (AudioConvertCtx * ctx, guint n_threads)
+{
+  guint i;
+
+  if (n_threads == 0) {
+#if GLIB_CHECK_VERSION(2,36,0)
+    n_threads = g_get_num_processors ();
+#else
+    n_threads = 1;
+#endif
+  }
+  /* dithering and noise shaping carry state from one sample to the next */
+  if (ctx->out.finfo && GST_AUDIO_FORMAT_INFO_IS_INTEGER (ctx->out.finfo)
+      && (ctx->dither != GST_AUDIO_DITHER_NONE
+          || ctx->ns != GST_AUDIO_NOISE_SHAPING_NONE))
+    n_threads = 1;
+
+  if (n_threads == MAX (ctx->n_threads, 1))
+    return;
+
+  audio_convert_free_tasks (ctx);
+
+  if (n_threads == 1)
+    return;
+
+  ctx->pool = g_thread_pool_new (audio_convert_pool_func, ctx,
+      n_threads - 1, FALSE, NULL);
+  if (ctx->pool == NULL) {
+    GST_WARNING ("could not create thread pool, using 1 thread");
+    return;
+  }
+  g_mutex_init (&ctx->lock);
+  g_cond_init (&ctx->cond);
+
+  ctx->n_threads = n_threads;
+  ctx->tasks = g_new0 (AudioConvertTask, n_threads);
+  /* the first task uses the temp buffers of the context */
+  for (i = 1; i < n_threads; i++) {
+    AudioConvertTask *task = &ctx->tasks[i];
+
+    task->ctx = *ctx;
+    task->ctx.pool = NULL;
+    task->ctx.tasks = NULL;
+    task->ctx.tmpbuf = NULL;
+    task->ctx.tmpbufsize = 0;
+    task->ctx.tmp = ctx->tmp ? g_new (gdouble, ctx->out.channels) : NULL;
+  }
+  GST_DEBUG ("using %u threads", n_threads);
+}
+
+static gboolean
+audio_convert_convert (AudioConvertCtx * ctx, gpointer src,
+    gpointer dst, gint samples, gboolean src_writable)
+{
+  guint i, n_tasks;
+  gint s, block;
+
+  g_return_val_if_fail (ctx != NULL, FALSE);
+  g_return_val_if_fail (src != NULL, FALSE);
+  g_return_val_if_fail (dst != NULL, FALSE);
+  g_return_val_if_fail (samples >= 0, FALSE);
+
+  if (samples == 0)
+    return TRUE;
+
+  n_tasks = 1;
+  if (ctx->n_threads > 1) {
+    guint64 values;
+
+    values = (guint64) samples * MAX (ctx->in.channels, ctx->out.channels);
+    n_tasks = MIN (ctx->n_threads, values / MIN_TASK_VALUES);
+  }
+
+  if (n_tasks <= 1) {
+    audio_convert_convert_block (ctx, src, dst, samples, src_writable);
+    return TRUE;
+  }
+
+  /* blocks only use their own part of src and dst as temp memory */
+  block = (samples + n_tasks - 1) / n_tasks;
+  for (i = 0, s = 0; s < samples; i++, s += block) {
+    AudioConvertTask *task = &ctx->tasks[i];
+
+    task->src = (guint8 *) src + s * ctx->in.bpf;
+    task->dst = (guint8 *) dst + s * ctx->out.bpf;
+    task->samples = MIN (block, samples - s);
+    task->src_writable = src_writable;
+  }
+  n_tasks = i;
+
+  ctx->n_pending = n_tasks - 1;
+  for (i = 1; i < n_tasks; i++)
+    g_thread_pool_push (ctx->pool, &ctx->tasks[i], NULL);
+
+  audio_convert_convert_block (ctx, src, dst, ctx->tasks[0].samples,
+      src_writable);
+
+  g_mutex_lock (&ctx->lock);
+  while (ctx->n_pending > 0)
+    g_cond_wait (&ctx->cond, &ctx->lock);
+  g_mutex_unlock (&ctx->lock);
 
   return TRUE;
 }
+
+/* the category is shared with the channel mixer and the quantizer */
+static void
+audio_converter_init_debug (void)
+{
+#ifndef GST_DISABLE_GST_DEBUG
+  static gsize cat_gonce = 0;
+
+  if (g_once_init_enter (&cat_gonce)) {
+    GST_DEBUG_CATEGORY_INIT (audio_converter_debug, "audio-converter", 0,
+        "audio-converter object");
+    g_once_init_leave (&cat_gonce, 1);
+  }
+#endif
+}
+
+static void
+audio_converter_apply_config (GstAudioConverter * convert)
+{
+  AudioConvertCtx *ctx = &convert->ctx;
+  gint dither, ns;
+  guint n_threads;
+
+  if (!gst_structure_get_enum (convert->config,
+          GST_AUDIO_CONVERTER_OPT_DITHER_METHOD, GST_TYPE_AUDIO_DITHER_METHOD,
+          &dither))
+    dither = GST_AUDIO_DITHER_TPDF;
+  if (!gst_structure_get_enum (convert->config,
+          GST_AUDIO_CONVERTER_OPT_NOISE_SHAPING_METHOD,
+          GST_TYPE_AUDIO_NOISE_SHAPING_METHOD, &ns))
+    ns = GST_AUDIO_NOISE_SHAPING_NONE;
+
+  /* the quantizer is set up with the context */
+  if (dither != convert->dither || ns != convert->ns) {
+    GstAudioInfo in = ctx->in, out = ctx->out;
+
+    audio_convert_prepare_context (ctx, &in, &out, dither, ns);
+    convert->dither = dither;
+    convert->ns = ns;
+  }
+
+  if (!gst_structure_get_uint (convert->config,
+          GST_AUDIO_CONVERTER_OPT_THREADS, &n_threads))
+    n_threads = 1;
+  audio_convert_set_threads (ctx, n_threads);
+}
+
+/**
+ * gst_audio_converter_new:
+ * @in_info: a #GstAudioInfo
+ * @out_info: a #GstAudioInfo
+ * @config: (transfer full) (allow-none): a #GstStructure with configuration
+ *    options or %NULL
+ *
+ * Create a new converter object to convert between @in_info and @out_info
+ * with @config. @in_info and @out_info must have the same rate, channels can
+ * only be added or removed when both layouts are positioned.
+ *
+ * Returns: a #GstAudioConverter or %NULL if conversion is not possible.
+ *
+ * Since: 1.2
+ */
+GstAudioConverter *
+gst_audio_converter_new (GstAudioInfo * in_info, GstAudioInfo * out_info,
+    GstStructure * config)
+{
+  GstAudioConverter *convert;
+
+  g_return_val_if_fail (in_info != NULL, NULL);
+  g_return_val_if_fail (out_info != NULL, NULL);
+  /* we won't ever do resampling */
+  g_return_val_if_fail (in_info->rate == out_info->rate, NULL);
+
+  audio_converter_init_debug ();
+
+  convert = g_slice_new0 (GstAudioConverter);
+
+  convert->dither = GST_AUDIO_DITHER_TPDF;
+  convert->ns = GST_AUDIO_NOISE_SHAPING_NONE;
+  if (!audio_convert_prepare_context (&convert->ctx, in_info, out_info,
+          convert->dither, convert->ns))
+    goto no_convert;
+
+  convert->config = gst_structure_new_empty ("GstAudioConverter");
+  if (config)
+    gst_audio_converter_set_config (convert, config);
+  else
+    audio_converter_apply_config (convert);
+
+  return convert;
+
+  /* ERRORS */
+no_convert:
+  {
+    if (config)
+      gst_structure_free (config);
+    gst_audio_converter_free (convert);
+    return NULL;
+  }
+}
+
+/**
+ * gst_audio_converter_free:
+ * @convert: a #GstAudioConverter
+ *
+ * Free @convert
+ *
+ * Since: 1.2
+ */
+void
+gst_audio_converter_free (GstAudioConverter * convert)
+{
+  g_return_if_fail (convert != NULL);
+
+  audio_convert_clean_context (&convert->ctx);
+
+  if (convert->config)
+    gst_structure_free (convert->config);
+
+  g_slice_free (GstAudioConverter, convert);
+}
+
+static gboolean
+copy_config (GQuark field_id, const GValue * value, gpointer user_data)
+{
+  GstAudioConverter *convert = user_data;
+
+  gst_structure_id_set_value (convert->config, field_id, value);
+
+  return TRUE;
+}
+
+/**
+ * gst_audio_converter_set_config:
+ * @convert: a #GstAudioConverter
+ * @config: (transfer full): a #GstStructure
+ *
+ * Set @config as extra configuration for @convert.
+ *
+ * If the parameters in @config can not be set exactly, this function returns
+ * %FALSE and will try to update as much state as possible. The new state can
+ * then be retrieved and refined with gst_audio_converter_get_config().
+ *
+ * Look at the #GST_AUDIO_CONVERTER_OPT_* fields to check valid configuration
+ * option and values.
+ *
+ * This function must not be called while samples are being converted.
+ *
+ * Returns: %TRUE when @config could be set.
+ *
+ * Since: 1.2
+ */
+gboolean
+gst_audio_converter_set_config (GstAudioConverter * convert,
+    GstStructure * config)
+{
+  guint n_threads;
+  gboolean res = TRUE;
+
+  g_return_val_if_fail (convert != NULL, FALSE);
+  g_return_val_if_fail (config != NULL, FALSE);
+
+  gst_structure_foreach (config, copy_config, convert);
+  gst_structure_free (config);
+
+  audio_converter_apply_config (convert);
+
+  /* dithering and noise shaping need a single thread, report back what
+   * was actually configured */
+  if (gst_structure_get_uint (convert->config,
+          GST_AUDIO_CONVERTER_OPT_THREADS, &n_threads) && n_threads != 0
+      && n_threads != convert->ctx.n_threads) {
+    gst_structure_set (convert->config, GST_AUDIO_CONVERTER_OPT_THREADS,
+        G_TYPE_UINT, convert->ctx.n_threads, NULL);
+    res = FALSE;
+  }
+
+  return res;
+}
+
+/**
+ * gst_audio_converter_get_config:
+ * @convert: a #GstAudioConverter
+ *
+ * Get the current configuration of @convert.
+ *
+ * Returns: a #GstStructure that remains valid for as long as @convert is valid
+ *   or until gst_audio_converter_set_config() is called.
+ *
+ * Since: 1.2
+ */
+const GstStructure *
+gst_audio_converter_get_config (GstAudioConverter * convert)
+{
+  g_return_val_if_fail (convert != NULL, NULL);
+
+  return convert->config;
+}
+
+/**
+ * gst_audio_converter_samples:
+ * @convert: a #GstAudioConverter
+ * @src: the input samples
+ * @dst: memory for the output samples
+ * @samples: the number of samples (frames) in @src
+ * @src_writable: if @src can be used as temporary memory
+ *
+ * Convert @samples samples from @src into @dst using @convert. @src must
+ * hold the input and @dst the output format of @convert. @src and @dst can
+ * point to the same memory when both formats use the same number of bytes
+ * per frame, which allows in-place conversion.
+ *
+ * Returns: %TRUE when the samples were converted.
+ *
+ * Since: 1.2
+ */
+gboolean
+gst_audio_converter_samples (GstAudioConverter * convert, gpointer src,
+    gpointer dst, gint samples, gboolean src_writable)
+{
+  g_return_val_if_fail (convert != NULL, FALSE);
+
+  return audio_convert_convert (&convert->ctx, src, dst, samples,
+      src_writable);
+}
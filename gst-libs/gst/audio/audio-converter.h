@@ -0,0 +1,128 @@
+/* GStreamer
+ * Copyright (C) 2004 Ronald Bultje <rbultje@ronald.bitfreak.net>
+ *
+ * audio-converter.h: audio format conversion library
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_AUDIO_CONVERTER_H__
+#define __GST_AUDIO_CONVERTER_H__
+
+#include <gst/gst.h>
+#include <gst/audio/audio-info.h>
+
+G_BEGIN_DECLS
+
+/**
+ * GstAudioDitherMethod:
+ * @GST_AUDIO_DITHER_NONE: No dithering
+ * @GST_AUDIO_DITHER_RPDF: Rectangular dithering
+ * @GST_AUDIO_DITHER_TPDF: Triangular dithering (default)
+ * @GST_AUDIO_DITHER_TPDF_HF: High frequency triangular dithering
+ *
+ * Set of available dithering methods when converting audio.
+ *
+ * Since: 1.2
+ */
+typedef enum
+{
+  GST_AUDIO_DITHER_NONE = 0,
+  GST_AUDIO_DITHER_RPDF,
+  GST_AUDIO_DITHER_TPDF,
+  GST_AUDIO_DITHER_TPDF_HF
+} GstAudioDitherMethod;
+
+/**
+ * GstAudioNoiseShapingMethod:
+ * @GST_AUDIO_NOISE_SHAPING_NONE: No noise shaping (default)
+ * @GST_AUDIO_NOISE_SHAPING_ERROR_FEEDBACK: Error feedback
+ * @GST_AUDIO_NOISE_SHAPING_SIMPLE: Simple 2-pole noise shaping
+ * @GST_AUDIO_NOISE_SHAPING_MEDIUM: Medium 5-pole noise shaping
+ * @GST_AUDIO_NOISE_SHAPING_HIGH: High 8-pole noise shaping
+ *
+ * Set of available noise shaping methods
+ *
+ * Since: 1.2
+ */
+typedef enum
+{
+  GST_AUDIO_NOISE_SHAPING_NONE = 0,
+  GST_AUDIO_NOISE_SHAPING_ERROR_FEEDBACK,
+  GST_AUDIO_NOISE_SHAPING_SIMPLE,
+  GST_AUDIO_NOISE_SHAPING_MEDIUM,
+  GST_AUDIO_NOISE_SHAPING_HIGH
+} GstAudioNoiseShapingMethod;
+
+/**
+ * GST_AUDIO_CONVERTER_OPT_DITHER_METHOD:
+ *
+ * #GstAudioDitherMethod, The dither method to use when
+ * changing bit depth.
+ * Default is #GST_AUDIO_DITHER_TPDF.
+ *
+ * Since: 1.2
+ */
+#define GST_AUDIO_CONVERTER_OPT_DITHER_METHOD   "GstAudioConverter.dither-method"
+
+/**
+ * GST_AUDIO_CONVERTER_OPT_NOISE_SHAPING_METHOD:
+ *
+ * #GstAudioNoiseShapingMethod, The noise shaping method to use
+ * to mask noise from quantization errors.
+ * Default is #GST_AUDIO_NOISE_SHAPING_NONE.
+ *
+ * Since: 1.2
+ */
+#define GST_AUDIO_CONVERTER_OPT_NOISE_SHAPING_METHOD   "GstAudioConverter.noise-shaping-method"
+
+/**
+ * GST_AUDIO_CONVERTER_OPT_THREADS:
+ *
+ * #G_TYPE_UINT, maximum number of threads to use for converting large
+ * buffers, 0 uses the number of processors.
+ * Default 1
+ *
+ * Since: 1.2
+ */
+#define GST_AUDIO_CONVERTER_OPT_THREADS   "GstAudioConverter.threads"
+
+/**
+ * GstAudioConverter:
+ *
+ * Opaque audio conversion object.
+ *
+ * Since: 1.2
+ */
+typedef struct _GstAudioConverter GstAudioConverter;
+
+GstAudioConverter *  gst_audio_converter_new            (GstAudioInfo *in_info,
+                                                         GstAudioInfo *out_info,
+                                                         GstStructure *config);
+void                 gst_audio_converter_free           (GstAudioConverter * convert);
+
+gboolean             gst_audio_converter_set_config     (GstAudioConverter * convert,
+                                                         GstStructure *config);
+const GstStructure * gst_audio_converter_get_config     (GstAudioConverter * convert);
+
+gboolean             gst_audio_converter_samples        (GstAudioConverter * convert,
+                                                         gpointer src, gpointer dst,
+                                                         gint samples,
+                                                         gboolean src_writable);
+
+G_END_DECLS
+
+#endif /* __GST_AUDIO_CONVERTER_H__ */
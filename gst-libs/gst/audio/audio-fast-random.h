@@ -1,7 +1,7 @@
 /* GStreamer
  * Copyright (C) 2008 Sebastian Dröge <sebastian.droege@collabora.co.uk>
  *
- * gstfastrandom.h: Fast, bad PNRG
+ * audio-fast-random.h: Fast, bad PNRG
  *
  * This library is free software; you can redistribute it and/or
  * modify it under the terms of the GNU Library General Public
@@ -160,6 +160,44 @@ gst_audio_info_set_format (GstAudioInfo * info, GstAudioFormat format,
     info->position[i] = GST_AUDIO_CHANNEL_POSITION_NONE;
 }
 
+/* per thread, the last few caps that were parsed successfully.
+ * Negotiation and allocation queries parse the same caps over and over. An
+ * entry is found by the caps pointer and only used if its structure is still
+ * equal to the one that was parsed, so caps that were changed in place or
+ * freed and replaced at the same address are parsed again. Comparing the
+ * structure needs no field name lookups and no format string search. */
+#define AUDIO_INFO_CACHE_SIZE 4
+
+static gboolean audio_info_parse_caps (GstAudioInfo * info, const GstCaps * caps);
+
+typedef struct
+{
+  const GstCaps *caps;
+  GstStructure *structure;
+  GstAudioInfo info;
+} AudioInfoCacheEntry;
+
+typedef struct
+{
+  AudioInfoCacheEntry entries[AUDIO_INFO_CACHE_SIZE];
+  guint next;
+} AudioInfoCache;
+
+static void
+audio_info_cache_free (AudioInfoCache * cache)
+{
+  guint i;
+
+  for (i = 0; i < AUDIO_INFO_CACHE_SIZE; i++) {
+    if (cache->entries[i].structure)
+      gst_structure_free (cache->entries[i].structure);
+  }
+  g_free (cache);
+}
+
+static GPrivate audio_info_cache =
+G_PRIVATE_INIT ((GDestroyNotify) audio_info_cache_free);
+
 /**
  * gst_audio_info_from_caps:
  * @info: a #GstAudioInfo
@@ -171,6 +209,52 @@ gst_audio_info_set_format (GstAudioInfo * info, GstAudioFormat format,
  */
 gboolean
 gst_audio_info_from_caps (GstAudioInfo * info, const GstCaps * caps)
+{
+  AudioInfoCache *cache;
+  AudioInfoCacheEntry *entry;
+  GstStructure *structure;
+  guint i;
+
+  g_return_val_if_fail (info != NULL, FALSE);
+  g_return_val_if_fail (caps != NULL, FALSE);
+  g_return_val_if_fail (gst_caps_is_fixed (caps), FALSE);
+
+  GST_DEBUG ("parsing caps %" GST_PTR_FORMAT, caps);
+
+  structure = gst_caps_get_structure (caps, 0);
+
+  cache = g_private_get (&audio_info_cache);
+  if (cache) {
+    for (i = 0; i < AUDIO_INFO_CACHE_SIZE; i++) {
+      entry = &cache->entries[i];
+      if (entry->caps == caps &&
+          gst_structure_is_equal (entry->structure, structure)) {
+        *info = entry->info;
+        return TRUE;
+      }
+    }
+  }
+
+  if (!audio_info_parse_caps (info, caps))
+    return FALSE;
+
+  if (cache == NULL) {
+    cache = g_new0 (AudioInfoCache, 1);
+    g_private_set (&audio_info_cache, cache);
+  }
+  entry = &cache->entries[cache->next];
+  if (entry->structure)
+    gst_structure_free (entry->structure);
+  entry->caps = caps;
+  entry->structure = gst_structure_copy (structure);
+  entry->info = *info;
+  cache->next = (cache->next + 1) % AUDIO_INFO_CACHE_SIZE;
+
+  return TRUE;
+}
+
+static gboolean
+audio_info_parse_caps (GstAudioInfo * info, const GstCaps * caps)
 {
   GstStructure *str;
   const gchar *s;
@@ -180,12 +264,6 @@ gst_audio_info_from_caps (GstAudioInfo * info, const GstCaps * caps)
   gint i;
   GstAudioChannelPosition position[64];
 
-  g_return_val_if_fail (info != NULL, FALSE);
-  g_return_val_if_fail (caps != NULL, FALSE);
-  g_return_val_if_fail (gst_caps_is_fixed (caps), FALSE);
-
-  GST_DEBUG ("parsing caps %" GST_PTR_FORMAT, caps);
-
   info->flags = 0;
 
   str = gst_caps_get_structure (caps, 0);
@@ -1,7 +1,7 @@
 /* GStreamer
  * Copyright (C) 2007 Sebastian Dröge <slomo@circular-chaos.org>
  *
- * gstaudioquantize.c: quantizes audio to the target format and optionally
+ * audio-quantize.c: quantizes audio to the target format and optionally
  *                     applies dithering and noise shaping.
  *
  * This library is free software; you can redistribute it and/or
@@ -34,13 +34,30 @@
 #include <gst/gst.h>
 #include <string.h>
 #include <math.h>
-#include "audioconvert.h"
-#include "gstaudioquantize.h"
+#include "audio-converter-private.h"
+#include "audio-quantize.h"
 
-#include "gstfastrandom.h"
+#include "audio-fast-random.h"
 
 #define MAKE_QUANTIZE_FUNC_NAME(name)                                   \
-gst_audio_quantize_quantize_##name
+audio_quantize_quantize_##name
+
+/* Quantize functions for gint32 as intermediate format */
+
+/* Returns room for n dither noise values. The noise for a whole buffer is
+ * generated before quantizing, the scalar sample loops below then only add
+ * it and don't call into the random number generator. */
+static gpointer
+audio_quantize_get_dither_buf (AudioConvertCtx * ctx, gint n)
+{
+  gint size = n * sizeof (gdouble);
+
+  if (size > ctx->dither_bufsize) {
+    ctx->dither_buf = g_realloc (ctx->dither_buf, size);
+    ctx->dither_bufsize = size;
+  }
+  return ctx->dither_buf;
+}
 
 /* Quantize functions for gint32 as intermediate format */
 
@@ -52,36 +69,32 @@ MAKE_QUANTIZE_FUNC_NAME (name) (AudioConvertCtx *ctx, gint32 *src,      \
 {                                                                       \
   gint scale = ctx->out_scale;                                          \
   gint channels = ctx->out.channels;                                    \
-  gint chan_pos;                                                        \
+  gint i, n = count * channels;                                         \
                                                                         \
   if (scale > 0) {                                                      \
-    gint32 tmp;                                                         \
+    gint64 tmp;                                                         \
     guint32 mask = 0xffffffff & (0xffffffff << scale);                  \
     guint32 bias = 1U << (scale - 1);                                   \
     DITHER_INIT_FUNC()                                                  \
                                                                         \
-    for (;count;count--) {                                              \
-      for (chan_pos = 0; chan_pos < channels; chan_pos++) {             \
-        tmp = *src++;                                                   \
-        ADD_DITHER_FUNC()                                               \
-        ROUND_FUNC()                                                    \
-        *dst = tmp & mask;                                              \
-        dst++;                                                          \
-      }                                                                 \
+    for (i = 0; i < n; i++) {                                           \
+      tmp = src[i];                                                     \
+      ADD_DITHER_FUNC()                                                 \
+      ROUND_FUNC()                                                      \
+      tmp = CLAMP (tmp, G_MININT32, G_MAXINT32);                        \
+      dst[i] = ((gint32) tmp) & mask;                                   \
     }                                                                   \
   } else {                                                              \
-    for (;count;count--) {                                              \
-      for (chan_pos = 0; chan_pos < channels; chan_pos++) {             \
-        *dst = *src++;                                                  \
-        dst++;                                                          \
-      }                                                                 \
-    }                                                                   \
+    for (i = 0; i < n; i++)                                             \
+      dst[i] = src[i];                                                  \
   }                                                                     \
 }
 
 
 /* Quantize functions for gdouble as intermediate format with
- * int as target */
+ * int as target. The error feedback of noise shaping only depends on
+ * earlier samples of the same channel, so all channels of a frame are
+ * handled in one loop. */
 
 #define MAKE_QUANTIZE_FUNC_F(name, DITHER_INIT_FUNC, NS_INIT_FUNC,      \
                              ADD_NS_FUNC, ADD_DITHER_FUNC,              \
@@ -92,32 +105,28 @@ MAKE_QUANTIZE_FUNC_NAME (name) (AudioConvertCtx *ctx, gdouble *src,     \
 {                                                                       \
   gint scale = ctx->out_scale;                                          \
   gint channels = ctx->out.channels;                                    \
+  gint i, n = count * channels;                                         \
   gint chan_pos;                                                        \
   gdouble factor = (1U<<(32-scale-1)) - 1;                              \
                                                                         \
   if (scale > 0) {                                                      \
     gdouble tmp;                                                        \
-    DITHER_INIT_FUNC()                                                  \
     NS_INIT_FUNC()                                                      \
+    DITHER_INIT_FUNC()                                                  \
                                                                         \
-    for (;count;count--) {                                              \
+    for (i = 0; i < n; i += channels) {                                 \
       for (chan_pos = 0; chan_pos < channels; chan_pos++) {             \
-        tmp = *src++;                                                   \
+        tmp = src[i + chan_pos];                                        \
         ADD_NS_FUNC()                                                   \
         ADD_DITHER_FUNC()                                               \
         tmp = floor(tmp * factor + 0.5);                                \
-        *dst = CLAMP (tmp, -factor - 1, factor);                        \
+        dst[i + chan_pos] = CLAMP (tmp, -factor - 1, factor);           \
         UPDATE_ERROR_FUNC()                                             \
-        dst++;                                                          \
       }                                                                 \
     }                                                                   \
   } else {                                                              \
-    for (;count;count--) {                                              \
-      for (chan_pos = 0; chan_pos < channels; chan_pos++) {             \
-        *dst = *src++ * 2147483647.0;                                   \
-        dst++;                                                          \
-      }                                                                 \
-    }                                                                   \
+    for (i = 0; i < n; i++)                                             \
+      dst[i] = src[i] * 2147483647.0;                                   \
   }                                                                     \
 }
 
@@ -126,10 +135,7 @@ MAKE_QUANTIZE_FUNC_NAME (name) (AudioConvertCtx *ctx, gdouble *src,     \
  * dither noise instead. */
 
 #define ROUND()                                                         \
-        if (tmp > 0 && G_MAXINT32 - tmp <= bias)                        \
-          tmp = G_MAXINT32;                                             \
-        else                                                            \
-          tmp += bias;
+      tmp += bias;
 
 
 #define NONE_FUNC()
@@ -142,83 +148,83 @@ MAKE_QUANTIZE_FUNC_NAME (name) (AudioConvertCtx *ctx, gdouble *src,     \
  * to have only one overflow check instead of two. */
 
 #define INIT_DITHER_RPDF_I()                                            \
-  gint32 rand;                                                          \
-  gint32 dither = (1<<(scale));
-
-#define ADD_DITHER_RPDF_I()                                             \
-        rand = gst_fast_random_int32_range (bias - dither,              \
-	    bias + dither);                                             \
-        if (rand > 0 && tmp > 0 && G_MAXINT32 - tmp <= rand)            \
-                tmp = G_MAXINT32;                                       \
-        else if (rand < 0 && tmp < 0 && G_MININT32 - tmp >= rand)       \
-                tmp = G_MININT32;                                       \
-        else                                                            \
-                tmp += rand;
+  gint32 dither = (1<<(scale));                                         \
+  gint32 *noise = audio_quantize_get_dither_buf (ctx, n);           \
+                                                                        \
+  for (i = 0; i < n; i++)                                               \
+    noise[i] = gst_fast_random_int32_range (bias - dither,              \
+        bias + dither);
+
+#define ADD_DITHER_I()                                                  \
+      tmp += noise[i];
 
 #define INIT_DITHER_RPDF_F()                                            \
-  gdouble dither = 1.0/(1U<<(32 - scale - 1));
+  gdouble dither = 1.0/(1U<<(32 - scale - 1));                          \
+  gdouble *noise = audio_quantize_get_dither_buf (ctx, n);          \
+                                                                        \
+  for (i = 0; i < n; i++)                                               \
+    noise[i] = gst_fast_random_double_range (- dither, dither);
 
-#define ADD_DITHER_RPDF_F()                                             \
-        tmp += gst_fast_random_double_range (- dither, dither);
+#define ADD_DITHER_F()                                                  \
+        tmp += noise[i + chan_pos];
 
 #define INIT_DITHER_TPDF_I()                                            \
-  gint32 rand;                                                          \
   gint32 dither = (1<<(scale - 1));                                     \
-  bias = bias >> 1;
-
-#define ADD_DITHER_TPDF_I()                                             \
-        rand = gst_fast_random_int32_range (bias - dither,              \
-                   bias + dither - 1)                                   \
-               + gst_fast_random_int32_range (bias - dither,            \
-                   bias + dither - 1);                                  \
-        if (rand > 0 && tmp > 0 && G_MAXINT32 - tmp <= rand)            \
-                tmp = G_MAXINT32;                                       \
-        else if (rand < 0 && tmp < 0 && G_MININT32 - tmp >= rand)       \
-                tmp = G_MININT32;                                       \
-        else                                                            \
-                tmp += rand;
+  gint32 *noise = audio_quantize_get_dither_buf (ctx, n);           \
+                                                                        \
+  bias = bias >> 1;                                                     \
+  for (i = 0; i < n; i++)                                               \
+    noise[i] = gst_fast_random_int32_range (bias - dither,              \
+        bias + dither - 1)                                              \
+        + gst_fast_random_int32_range (bias - dither,                   \
+        bias + dither - 1);
 
 #define INIT_DITHER_TPDF_F()                                            \
-  gdouble dither = 1.0/(1U<<(32 - scale));
-
-#define ADD_DITHER_TPDF_F()                                             \
-        tmp += gst_fast_random_double_range (- dither, dither)          \
-               + gst_fast_random_double_range (- dither, dither);
+  gdouble dither = 1.0/(1U<<(32 - scale));                              \
+  gdouble *noise = audio_quantize_get_dither_buf (ctx, n);          \
+                                                                        \
+  for (i = 0; i < n; i++)                                               \
+    noise[i] = gst_fast_random_double_range (- dither, dither)          \
+        + gst_fast_random_double_range (- dither, dither);
 
 #define INIT_DITHER_TPDF_HF_I()                                         \
-  gint32 rand;                                                          \
   gint32 dither = (1<<(scale-1));                                       \
   gint32 *last_random = (gint32 *) ctx->last_random, tmp_rand;          \
-  bias = bias >> 1;
-
-#define ADD_DITHER_TPDF_HF_I()                                          \
-        tmp_rand = gst_fast_random_int32_range (bias - dither,          \
-                       bias + dither);                                  \
-        rand = tmp_rand - last_random[chan_pos];                        \
-        last_random[chan_pos] = tmp_rand;                               \
-        if (rand > 0 && tmp > 0 && G_MAXINT32 - tmp <= rand)            \
-                tmp = G_MAXINT32;                                       \
-        else if (rand < 0 && tmp < 0 && G_MININT32 - tmp >= rand)       \
-                tmp = G_MININT32;                                       \
-        else                                                            \
-                tmp += rand;
+  gint32 *noise = audio_quantize_get_dither_buf (ctx, n);           \
+  gint c;                                                               \
+                                                                        \
+  bias = bias >> 1;                                                     \
+  for (i = 0; i < n; i += channels) {                                   \
+    for (c = 0; c < channels; c++) {                                    \
+      tmp_rand = gst_fast_random_int32_range (bias - dither,            \
+          bias + dither);                                               \
+      noise[i + c] = tmp_rand - last_random[c];                         \
+      last_random[c] = tmp_rand;                                        \
+    }                                                                   \
+  }
 
 /* Like TPDF dither but the dither noise is oriented more to the
  * higher frequencies */
 
 #define INIT_DITHER_TPDF_HF_F()                                         \
-  gdouble rand;                                                         \
   gdouble dither = 1.0/(1U<<(32 - scale));                              \
-  gdouble *last_random = (gdouble *) ctx->last_random, tmp_rand;
-
-#define ADD_DITHER_TPDF_HF_F()                                          \
-        tmp_rand = gst_fast_random_double_range (- dither, dither);     \
-        rand = tmp_rand - last_random[chan_pos];                        \
-        last_random[chan_pos] = tmp_rand;                               \
-        tmp += rand;
+  gdouble *last_random = (gdouble *) ctx->last_random, tmp_rand;        \
+  gdouble *noise = audio_quantize_get_dither_buf (ctx, n);          \
+  gint c;                                                               \
+                                                                        \
+  for (i = 0; i < n; i += channels) {                                   \
+    for (c = 0; c < channels; c++) {                                    \
+      tmp_rand = gst_fast_random_double_range (- dither, dither);       \
+      noise[i + c] = tmp_rand - last_random[c];                         \
+      last_random[c] = tmp_rand;                                        \
+    }                                                                   \
+  }
 
 /* Noise shaping definitions.
- * See http://en.wikipedia.org/wiki/Noise_shaping for explanations. */
+ * See http://en.wikipedia.org/wiki/Noise_shaping for explanations.
+ *
+ * The past errors are stored as errors[n_errors][channels], so that
+ * the same error of all channels is next to each other in memory. */
 
 
 /* Simple error feedback: Just accumulate the dithering and quantization
@@ -233,7 +239,7 @@ MAKE_QUANTIZE_FUNC_NAME (name) (AudioConvertCtx *ctx, gdouble *src,     \
         tmp -= errors[chan_pos];
 
 #define UPDATE_ERROR_ERROR_FEEDBACK()                                   \
-        errors[chan_pos] += (*dst)/factor - orig;
+        errors[chan_pos] += dst[i + chan_pos]/factor - orig;
 
 /* Same as error feedback but also add 1/2 of the previous error value.
  * This moves the noise a bit more into the higher frequencies. */
@@ -243,13 +249,13 @@ MAKE_QUANTIZE_FUNC_NAME (name) (AudioConvertCtx *ctx, gdouble *src,     \
   gdouble *errors = ctx->error_buf, cur_error;
 
 #define ADD_NS_SIMPLE()                                                 \
-        cur_error = errors[chan_pos*2] - 0.5 * errors[chan_pos*2 + 1];  \
+        cur_error = errors[chan_pos] - 0.5 * errors[channels + chan_pos]; \
         tmp -= cur_error;                                               \
         orig = tmp;
 
 #define UPDATE_ERROR_SIMPLE()                                           \
-        errors[chan_pos*2 + 1] = errors[chan_pos*2];                    \
-        errors[chan_pos*2] = (*dst)/factor - orig;
+        errors[channels + chan_pos] = errors[chan_pos];                 \
+        errors[chan_pos] = dst[i + chan_pos]/factor - orig;
 
 
 /* Noise shaping coefficients from[1], moves most power of the
@@ -272,14 +278,14 @@ static const gdouble ns_medium_coeffs[] = {
 #define ADD_NS_MEDIUM()                                                 \
         cur_error = 0.0;                                                \
         for (j = 0; j < 5; j++)                                         \
-          cur_error += errors[chan_pos*5 + j] * ns_medium_coeffs[j];    \
+          cur_error += errors[j*channels + chan_pos] * ns_medium_coeffs[j]; \
         tmp -= cur_error;                                               \
         orig = tmp;
 
 #define UPDATE_ERROR_MEDIUM()                                           \
         for (j = 4; j > 0; j--)                                         \
-          errors[chan_pos*5 + j] = errors[chan_pos*5 + j-1];            \
-        errors[chan_pos*5] = (*dst)/factor - orig;
+          errors[j*channels + chan_pos] = errors[(j-1)*channels + chan_pos]; \
+        errors[chan_pos] = dst[i + chan_pos]/factor - orig;
 
 /* Noise shaping coefficients by David Schleef, moves most power of the
  * error noise into inaudible frequency ranges */
@@ -296,31 +302,31 @@ static const gdouble ns_high_coeffs[] = {
 #define ADD_NS_HIGH()                                                   \
         cur_error = 0.0;                                                \
         for (j = 0; j < 8; j++)                                         \
-          cur_error += errors[chan_pos + j] * ns_high_coeffs[j];          \
+          cur_error += errors[j*channels + chan_pos] * ns_high_coeffs[j]; \
         tmp -= cur_error;                                               \
         orig = tmp;
 
 #define UPDATE_ERROR_HIGH()                                             \
         for (j = 7; j > 0; j--)                                         \
-          errors[chan_pos + j] = errors[chan_pos + j-1];                \
-        errors[chan_pos] = (*dst)/factor - orig;
+          errors[j*channels + chan_pos] = errors[(j-1)*channels + chan_pos]; \
+        errors[chan_pos] = dst[i + chan_pos]/factor - orig;
 
 
 MAKE_QUANTIZE_FUNC_I (signed_none_none, NONE_FUNC, NONE_FUNC, ROUND);
-MAKE_QUANTIZE_FUNC_I (signed_rpdf_none, INIT_DITHER_RPDF_I, ADD_DITHER_RPDF_I,
+MAKE_QUANTIZE_FUNC_I (signed_rpdf_none, INIT_DITHER_RPDF_I, ADD_DITHER_I,
     NONE_FUNC);
-MAKE_QUANTIZE_FUNC_I (signed_tpdf_none, INIT_DITHER_TPDF_I, ADD_DITHER_TPDF_I,
+MAKE_QUANTIZE_FUNC_I (signed_tpdf_none, INIT_DITHER_TPDF_I, ADD_DITHER_I,
     NONE_FUNC);
 MAKE_QUANTIZE_FUNC_I (signed_tpdf_hf_none, INIT_DITHER_TPDF_HF_I,
-    ADD_DITHER_TPDF_HF_I, NONE_FUNC);
+    ADD_DITHER_I, NONE_FUNC);
 
 MAKE_QUANTIZE_FUNC_I (unsigned_none_none, NONE_FUNC, NONE_FUNC, ROUND);
-MAKE_QUANTIZE_FUNC_I (unsigned_rpdf_none, INIT_DITHER_RPDF_I, ADD_DITHER_RPDF_I,
+MAKE_QUANTIZE_FUNC_I (unsigned_rpdf_none, INIT_DITHER_RPDF_I, ADD_DITHER_I,
     NONE_FUNC);
-MAKE_QUANTIZE_FUNC_I (unsigned_tpdf_none, INIT_DITHER_TPDF_I, ADD_DITHER_TPDF_I,
+MAKE_QUANTIZE_FUNC_I (unsigned_tpdf_none, INIT_DITHER_TPDF_I, ADD_DITHER_I,
     NONE_FUNC);
 MAKE_QUANTIZE_FUNC_I (unsigned_tpdf_hf_none, INIT_DITHER_TPDF_HF_I,
-    ADD_DITHER_TPDF_HF_I, NONE_FUNC);
+    ADD_DITHER_I, NONE_FUNC);
 
 MAKE_QUANTIZE_FUNC_F (float_none_error_feedback, NONE_FUNC,
     INIT_NS_ERROR_FEEDBACK, ADD_NS_ERROR_FEEDBACK, NONE_FUNC,
@@ -333,34 +339,34 @@ MAKE_QUANTIZE_FUNC_F (float_none_high, NONE_FUNC, INIT_NS_HIGH, ADD_NS_HIGH,
     NONE_FUNC, UPDATE_ERROR_HIGH);
 
 MAKE_QUANTIZE_FUNC_F (float_rpdf_error_feedback, INIT_DITHER_RPDF_F,
-    INIT_NS_ERROR_FEEDBACK, ADD_NS_ERROR_FEEDBACK, ADD_DITHER_RPDF_F,
+    INIT_NS_ERROR_FEEDBACK, ADD_NS_ERROR_FEEDBACK, ADD_DITHER_F,
     UPDATE_ERROR_ERROR_FEEDBACK);
 MAKE_QUANTIZE_FUNC_F (float_rpdf_simple, INIT_DITHER_RPDF_F, INIT_NS_SIMPLE,
-    ADD_NS_SIMPLE, ADD_DITHER_RPDF_F, UPDATE_ERROR_SIMPLE);
+    ADD_NS_SIMPLE, ADD_DITHER_F, UPDATE_ERROR_SIMPLE);
 MAKE_QUANTIZE_FUNC_F (float_rpdf_medium, INIT_DITHER_RPDF_F, INIT_NS_MEDIUM,
-    ADD_NS_MEDIUM, ADD_DITHER_RPDF_F, UPDATE_ERROR_MEDIUM);
+    ADD_NS_MEDIUM, ADD_DITHER_F, UPDATE_ERROR_MEDIUM);
 MAKE_QUANTIZE_FUNC_F (float_rpdf_high, INIT_DITHER_RPDF_F, INIT_NS_HIGH,
-    ADD_NS_HIGH, ADD_DITHER_RPDF_F, UPDATE_ERROR_HIGH);
+    ADD_NS_HIGH, ADD_DITHER_F, UPDATE_ERROR_HIGH);
 
 MAKE_QUANTIZE_FUNC_F (float_tpdf_error_feedback, INIT_DITHER_TPDF_F,
-    INIT_NS_ERROR_FEEDBACK, ADD_NS_ERROR_FEEDBACK, ADD_DITHER_TPDF_F,
+    INIT_NS_ERROR_FEEDBACK, ADD_NS_ERROR_FEEDBACK, ADD_DITHER_F,
     UPDATE_ERROR_ERROR_FEEDBACK);
 MAKE_QUANTIZE_FUNC_F (float_tpdf_simple, INIT_DITHER_TPDF_F, INIT_NS_SIMPLE,
-    ADD_NS_SIMPLE, ADD_DITHER_TPDF_F, UPDATE_ERROR_SIMPLE);
+    ADD_NS_SIMPLE, ADD_DITHER_F, UPDATE_ERROR_SIMPLE);
 MAKE_QUANTIZE_FUNC_F (float_tpdf_medium, INIT_DITHER_TPDF_F, INIT_NS_MEDIUM,
-    ADD_NS_MEDIUM, ADD_DITHER_TPDF_F, UPDATE_ERROR_MEDIUM);
+    ADD_NS_MEDIUM, ADD_DITHER_F, UPDATE_ERROR_MEDIUM);
 MAKE_QUANTIZE_FUNC_F (float_tpdf_high, INIT_DITHER_TPDF_F, INIT_NS_HIGH,
-    ADD_NS_HIGH, ADD_DITHER_TPDF_F, UPDATE_ERROR_HIGH);
+    ADD_NS_HIGH, ADD_DITHER_F, UPDATE_ERROR_HIGH);
 
 MAKE_QUANTIZE_FUNC_F (float_tpdf_hf_error_feedback, INIT_DITHER_TPDF_HF_F,
-    INIT_NS_ERROR_FEEDBACK, ADD_NS_ERROR_FEEDBACK, ADD_DITHER_TPDF_HF_F,
+    INIT_NS_ERROR_FEEDBACK, ADD_NS_ERROR_FEEDBACK, ADD_DITHER_F,
     UPDATE_ERROR_ERROR_FEEDBACK);
 MAKE_QUANTIZE_FUNC_F (float_tpdf_hf_simple, INIT_DITHER_TPDF_HF_F,
-    INIT_NS_SIMPLE, ADD_NS_SIMPLE, ADD_DITHER_TPDF_HF_F, UPDATE_ERROR_SIMPLE);
+    INIT_NS_SIMPLE, ADD_NS_SIMPLE, ADD_DITHER_F, UPDATE_ERROR_SIMPLE);
 MAKE_QUANTIZE_FUNC_F (float_tpdf_hf_medium, INIT_DITHER_TPDF_HF_F,
-    INIT_NS_MEDIUM, ADD_NS_MEDIUM, ADD_DITHER_TPDF_HF_F, UPDATE_ERROR_MEDIUM);
+    INIT_NS_MEDIUM, ADD_NS_MEDIUM, ADD_DITHER_F, UPDATE_ERROR_MEDIUM);
 MAKE_QUANTIZE_FUNC_F (float_tpdf_hf_high, INIT_DITHER_TPDF_HF_F, INIT_NS_HIGH,
-    ADD_NS_HIGH, ADD_DITHER_TPDF_HF_F, UPDATE_ERROR_HIGH);
+    ADD_NS_HIGH, ADD_DITHER_F, UPDATE_ERROR_HIGH);
 
 static AudioConvertQuantize quantize_funcs[] = {
   (AudioConvertQuantize) MAKE_QUANTIZE_FUNC_NAME (signed_none_none),
@@ -390,25 +396,25 @@ static AudioConvertQuantize quantize_funcs[] = {
 };
 
 static void
-gst_audio_quantize_setup_noise_shaping (AudioConvertCtx * ctx)
+audio_quantize_setup_noise_shaping (AudioConvertCtx * ctx)
 {
   switch (ctx->ns) {
-    case NOISE_SHAPING_HIGH:{
+    case GST_AUDIO_NOISE_SHAPING_HIGH:{
       ctx->error_buf = g_new0 (gdouble, ctx->out.channels * 8);
       break;
     }
-    case NOISE_SHAPING_MEDIUM:{
+    case GST_AUDIO_NOISE_SHAPING_MEDIUM:{
       ctx->error_buf = g_new0 (gdouble, ctx->out.channels * 5);
       break;
     }
-    case NOISE_SHAPING_SIMPLE:{
+    case GST_AUDIO_NOISE_SHAPING_SIMPLE:{
       ctx->error_buf = g_new0 (gdouble, ctx->out.channels * 2);
       break;
     }
-    case NOISE_SHAPING_ERROR_FEEDBACK:
+    case GST_AUDIO_NOISE_SHAPING_ERROR_FEEDBACK:
       ctx->error_buf = g_new0 (gdouble, ctx->out.channels);
       break;
-    case NOISE_SHAPING_NONE:
+    case GST_AUDIO_NOISE_SHAPING_NONE:
     default:
       ctx->error_buf = NULL;
       break;
@@ -417,14 +423,14 @@ gst_audio_quantize_setup_noise_shaping (AudioConvertCtx * ctx)
 }
 
 static void
-gst_audio_quantize_free_noise_shaping (AudioConvertCtx * ctx)
+audio_quantize_free_noise_shaping (AudioConvertCtx * ctx)
 {
   switch (ctx->ns) {
-    case NOISE_SHAPING_HIGH:
-    case NOISE_SHAPING_MEDIUM:
-    case NOISE_SHAPING_SIMPLE:
-    case NOISE_SHAPING_ERROR_FEEDBACK:
-    case NOISE_SHAPING_NONE:
+    case GST_AUDIO_NOISE_SHAPING_HIGH:
+    case GST_AUDIO_NOISE_SHAPING_MEDIUM:
+    case GST_AUDIO_NOISE_SHAPING_SIMPLE:
+    case GST_AUDIO_NOISE_SHAPING_ERROR_FEEDBACK:
+    case GST_AUDIO_NOISE_SHAPING_NONE:
     default:
       break;
   }
@@ -435,20 +441,20 @@ gst_audio_quantize_free_noise_shaping (AudioConvertCtx * ctx)
 }
 
 static void
-gst_audio_quantize_setup_dither (AudioConvertCtx * ctx)
+audio_quantize_setup_dither (AudioConvertCtx * ctx)
 {
   switch (ctx->dither) {
-    case DITHER_TPDF_HF:
+    case GST_AUDIO_DITHER_TPDF_HF:
       if (GST_AUDIO_FORMAT_INFO_IS_INTEGER (ctx->out.finfo))
         ctx->last_random = g_new0 (gint32, ctx->out.channels);
       else
         ctx->last_random = g_new0 (gdouble, ctx->out.channels);
       break;
-    case DITHER_RPDF:
-    case DITHER_TPDF:
+    case GST_AUDIO_DITHER_RPDF:
+    case GST_AUDIO_DITHER_TPDF:
       ctx->last_random = NULL;
       break;
-    case DITHER_NONE:
+    case GST_AUDIO_DITHER_NONE:
     default:
       ctx->last_random = NULL;
       break;
@@ -457,7 +463,7 @@ gst_audio_quantize_setup_dither (AudioConvertCtx * ctx)
 }
 
 static void
-gst_audio_quantize_free_dither (AudioConvertCtx * ctx)
+audio_quantize_free_dither (AudioConvertCtx * ctx)
 {
   g_free (ctx->last_random);
 
@@ -465,7 +471,7 @@ gst_audio_quantize_free_dither (AudioConvertCtx * ctx)
 }
 
 static void
-gst_audio_quantize_setup_quantize_func (AudioConvertCtx * ctx)
+audio_quantize_setup_quantize_func (AudioConvertCtx * ctx)
 {
   gint index = 0;
 
@@ -474,7 +480,7 @@ gst_audio_quantize_setup_quantize_func (AudioConvertCtx * ctx)
     return;
   }
 
-  if (ctx->ns == NOISE_SHAPING_NONE) {
+  if (ctx->ns == GST_AUDIO_NOISE_SHAPING_NONE) {
     index += ctx->dither;
     index += GST_AUDIO_FORMAT_INFO_IS_SIGNED (ctx->out.finfo) ? 0 : 4;
   } else {
@@ -486,18 +492,22 @@ gst_audio_quantize_setup_quantize_func (AudioConvertCtx * ctx)
 }
 
 gboolean
-gst_audio_quantize_setup (AudioConvertCtx * ctx)
+audio_quantize_setup (AudioConvertCtx * ctx)
 {
-  gst_audio_quantize_setup_dither (ctx);
-  gst_audio_quantize_setup_noise_shaping (ctx);
-  gst_audio_quantize_setup_quantize_func (ctx);
+  audio_quantize_setup_dither (ctx);
+  audio_quantize_setup_noise_shaping (ctx);
+  audio_quantize_setup_quantize_func (ctx);
 
   return TRUE;
 }
 
 void
-gst_audio_quantize_free (AudioConvertCtx * ctx)
+audio_quantize_free (AudioConvertCtx * ctx)
 {
-  gst_audio_quantize_free_dither (ctx);
-  gst_audio_quantize_free_noise_shaping (ctx);
+  audio_quantize_free_dither (ctx);
+  audio_quantize_free_noise_shaping (ctx);
+
+  g_free (ctx->dither_buf);
+  ctx->dither_buf = NULL;
+  ctx->dither_bufsize = 0;
 }
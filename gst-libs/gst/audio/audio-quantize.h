@@ -1,7 +1,7 @@
 /* GStreamer
  * Copyright (C) 2007 Sebastian Dröge <slomo@circular-chaos.org>
  *
- * gstaudioquantize.h: quantizes audio to the target format and optionally
+ * audio-quantize.h: quantizes audio to the target format and optionally
  *                     applies dithering and noise shaping.
  *
  * This library is free software; you can redistribute it and/or
@@ -21,14 +21,14 @@
  */
 
 #include <gst/gst.h>
-#include "audioconvert.h"
+#include "audio-converter-private.h"
 
 #ifndef __GST_AUDIO_QUANTIZE_H__
 #define __GST_AUDIO_QUANTIZE_H__
 
-gboolean gst_audio_quantize_setup (AudioConvertCtx * ctx);
-void gst_audio_quantize_reset (AudioConvertCtx * ctx);
-void gst_audio_quantize_free (AudioConvertCtx * ctx);
+gboolean audio_quantize_setup (AudioConvertCtx * ctx);
+void audio_quantize_reset (AudioConvertCtx * ctx);
+void audio_quantize_free (AudioConvertCtx * ctx);
 
 
 #endif /* __GST_AUDIO_QUANTIZE_H__ */
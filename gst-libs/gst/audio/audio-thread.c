@@ -0,0 +1,210 @@
+/* GStreamer
+ *
+ * audio-thread.c: scheduling helpers for the audio device threads
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* for the CPU_* macros */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#endif
+
+#include "audio-thread.h"
+
+#ifndef GST_DISABLE_GST_DEBUG
+
+#define GST_CAT_DEFAULT ensure_debug_category()
+
+static GstDebugCategory *
+ensure_debug_category (void)
+{
+  static gsize cat_gonce = 0;
+
+  if (g_once_init_enter (&cat_gonce)) {
+    gsize cat_done;
+
+    cat_done = (gsize) _gst_debug_category_new ("audio-thread", 0,
+        "audio device thread scheduling");
+
+    g_once_init_leave (&cat_gonce, cat_done);
+  }
+
+  return (GstDebugCategory *) cat_gonce;
+}
+
+#else
+
+#define ensure_debug_category() /* NOOP */
+
+#endif /* GST_DISABLE_GST_DEBUG */
+
+#define DEFAULT_PRIORITY 0
+#define DEFAULT_CPU      -1
+
+/* On Linux the sched_* functions with a pid of 0 act on the calling thread,
+ * elsewhere they would change the whole process so we don't use them
+ * there. */
+
+/* Switch the calling thread to SCHED_FIFO with @priority, clamped to the
+ * range of the policy. Returns FALSE with errno set when that is not allowed
+ * or not supported. */
+static gboolean
+audio_thread_set_priority (gint priority)
+{
+#if defined (__linux__) && defined (HAVE_SCHED_SETSCHEDULER)
+  struct sched_param param = { 0, };
+
+  param.sched_priority = CLAMP (priority,
+      sched_get_priority_min (SCHED_FIFO), sched_get_priority_max (SCHED_FIFO));
+
+  return sched_setscheduler (0, SCHED_FIFO, &param) == 0;
+#else
+  errno = ENOSYS;
+  return FALSE;
+#endif
+}
+
+/* Restrict the calling thread to run on @cpu only. Returns FALSE with errno
+ * set on failure. */
+static gboolean
+audio_thread_set_cpu (gint cpu)
+{
+#if defined (__linux__) && defined (HAVE_SCHED_SETAFFINITY)
+  cpu_set_t set;
+
+  if (cpu < 0 || cpu >= CPU_SETSIZE) {
+    errno = EINVAL;
+    return FALSE;
+  }
+
+  CPU_ZERO (&set);
+  CPU_SET (cpu, &set);
+
+  return sched_setaffinity (0, sizeof (set), &set) == 0;
+#else
+  errno = ENOSYS;
+  return FALSE;
+#endif
+}
+
+void
+audio_thread_settings_init (AudioThreadSettings * settings)
+{
+  settings->priority = DEFAULT_PRIORITY;
+  settings->cpu = DEFAULT_CPU;
+}
+
+/* install the thread-priority and thread-cpu properties with the
+ * AUDIO_THREAD_PROP_* ids. The element documents them because the device
+ * thread does something else in each element. */
+void
+audio_thread_install_properties (GObjectClass * gobject_class)
+{
+  g_object_class_install_property (gobject_class, AUDIO_THREAD_PROP_PRIORITY,
+      g_param_spec_int ("thread-priority", "Thread Priority",
+          "Realtime priority of the audio device thread (0 = default "
+          "scheduling)", 0, 99, DEFAULT_PRIORITY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, AUDIO_THREAD_PROP_CPU,
+      g_param_spec_int ("thread-cpu", "Thread CPU",
+          "CPU to run the audio device thread on (-1 = any)", -1, G_MAXINT,
+          DEFAULT_CPU, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+}
+
+/* returns FALSE when @prop_id is not one of the thread properties */
+gboolean
+audio_thread_set_property (GObject * object, AudioThreadSettings * settings,
+    guint prop_id, const GValue * value)
+{
+  switch (prop_id) {
+    case AUDIO_THREAD_PROP_PRIORITY:
+      GST_OBJECT_LOCK (object);
+      settings->priority = g_value_get_int (value);
+      GST_OBJECT_UNLOCK (object);
+      break;
+    case AUDIO_THREAD_PROP_CPU:
+      GST_OBJECT_LOCK (object);
+      settings->cpu = g_value_get_int (value);
+      GST_OBJECT_UNLOCK (object);
+      break;
+    default:
+      return FALSE;
+  }
+  return TRUE;
+}
+
+/* returns FALSE when @prop_id is not one of the thread properties */
+gboolean
+audio_thread_get_property (GObject * object, AudioThreadSettings * settings,
+    guint prop_id, GValue * value)
+{
+  switch (prop_id) {
+    case AUDIO_THREAD_PROP_PRIORITY:
+      GST_OBJECT_LOCK (object);
+      g_value_set_int (value, settings->priority);
+      GST_OBJECT_UNLOCK (object);
+      break;
+    case AUDIO_THREAD_PROP_CPU:
+      GST_OBJECT_LOCK (object);
+      g_value_set_int (value, settings->cpu);
+      GST_OBJECT_UNLOCK (object);
+      break;
+    default:
+      return FALSE;
+  }
+  return TRUE;
+}
+
+/* apply the scheduling that was configured with the properties of @object to
+ * the calling thread. When we are not allowed to, we simply keep running with
+ * the default scheduling. */
+void
+audio_thread_setup (GstObject * object, AudioThreadSettings * settings)
+{
+  gint priority, cpu;
+
+  GST_OBJECT_LOCK (object);
+  priority = settings->priority;
+  cpu = settings->cpu;
+  GST_OBJECT_UNLOCK (object);
+
+  if (priority > 0) {
+    if (audio_thread_set_priority (priority))
+      GST_DEBUG_OBJECT (object, "running with realtime priority %d", priority);
+    else
+      GST_WARNING_OBJECT (object, "could not set realtime priority %d: %s",
+          priority, g_strerror (errno));
+  }
+
+  if (cpu >= 0) {
+    if (audio_thread_set_cpu (cpu))
+      GST_DEBUG_OBJECT (object, "running on CPU %d", cpu);
+    else
+      GST_WARNING_OBJECT (object, "could not bind thread to CPU %d: %s", cpu,
+          g_strerror (errno));
+  }
+}
@@ -0,0 +1,57 @@
+/* GStreamer
+ *
+ * audio-thread.h: scheduling helpers for the audio device threads
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include <gst/gst.h>
+
+#ifndef __GST_AUDIO_THREAD_H__
+#define __GST_AUDIO_THREAD_H__
+
+/* the property ids installed by audio_thread_install_properties(), the
+ * element using them should not install other properties with these ids */
+enum
+{
+  AUDIO_THREAD_PROP_PRIORITY = 1,
+  AUDIO_THREAD_PROP_CPU
+};
+
+typedef struct _AudioThreadSettings AudioThreadSettings;
+
+struct _AudioThreadSettings
+{
+  /* with the object LOCK */
+  gint priority;
+  gint cpu;
+};
+
+void     audio_thread_settings_init      (AudioThreadSettings * settings);
+
+void     audio_thread_install_properties (GObjectClass * gobject_class);
+
+gboolean audio_thread_set_property       (GObject * object,
+                                          AudioThreadSettings * settings,
+                                          guint prop_id, const GValue * value);
+gboolean audio_thread_get_property       (GObject * object,
+                                          AudioThreadSettings * settings,
+                                          guint prop_id, GValue * value);
+
+void     audio_thread_setup              (GstObject * object,
+                                          AudioThreadSettings * settings);
+
+#endif /* __GST_AUDIO_THREAD_H__ */
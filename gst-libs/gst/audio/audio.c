@@ -32,29 +32,9 @@
 #include "audio.h"
 #include "audio-enumtypes.h"
 
-/**
- * gst_audio_buffer_clip:
- * @buffer: (transfer full): The buffer to clip.
- * @segment: Segment in %GST_FORMAT_TIME or %GST_FORMAT_DEFAULT to which
- *           the buffer should be clipped.
- * @rate: sample rate.
- * @bpf: size of one audio frame in bytes. This is the size of one sample
- * * channels.
- *
- * Clip the buffer to the given %GstSegment.
- *
- * After calling this function the caller does not own a reference to
- * @buffer anymore.
- *
- * Returns: (transfer full): %NULL if the buffer is completely outside the configured segment,
- * otherwise the clipped buffer is returned.
- *
- * If the buffer has no timestamp, it is assumed to be inside the segment and
- * is not clipped
- */
-GstBuffer *
-gst_audio_buffer_clip (GstBuffer * buffer, GstSegment * segment, gint rate,
-    gint bpf)
+static GstBuffer *
+audio_buffer_clip (GstBuffer * buffer, GstSegment * segment, gint rate,
+    gint bpf, gboolean use_meta)
 {
   GstBuffer *ret;
   GstClockTime timestamp = GST_CLOCK_TIME_NONE, duration = GST_CLOCK_TIME_NONE;
@@ -187,11 +167,25 @@ gst_audio_buffer_clip (GstBuffer * buffer, GstSegment * segment, gint rate,
   if (trim == 0 && size == osize) {
     /* nothing changed */
     ret = buffer;
+  } else if (use_meta) {
+    /* leave the data and timestamps alone, only describe what to drop */
+    GST_DEBUG ("clipping meta start %" G_GSIZE_FORMAT " end %" G_GSIZE_FORMAT,
+        trim / bpf, (osize - trim - size) / bpf);
+    ret = gst_buffer_make_writable (buffer);
+    gst_buffer_add_audio_clipping_meta (ret, GST_FORMAT_DEFAULT, trim / bpf,
+        (osize - trim - size) / bpf);
   } else {
-    /* Get a writable buffer and apply all changes */
     GST_DEBUG ("trim %" G_GSIZE_FORMAT " size %" G_GSIZE_FORMAT, trim, size);
-    ret = gst_buffer_copy_region (buffer, GST_BUFFER_COPY_ALL, trim, size);
-    gst_buffer_unref (buffer);
+    if (gst_buffer_is_writable (buffer)) {
+      /* trim the memory offsets in place, this keeps the memory layout of
+       * the buffer and does not need a new buffer */
+      ret = buffer;
+      gst_buffer_resize (ret, trim, size);
+    } else {
+      /* Get a writable buffer sharing the memory and apply all changes */
+      ret = gst_buffer_copy_region (buffer, GST_BUFFER_COPY_ALL, trim, size);
+      gst_buffer_unref (buffer);
+    }
 
     GST_DEBUG ("timestamp %" GST_TIME_FORMAT, GST_TIME_ARGS (timestamp));
     GST_BUFFER_TIMESTAMP (ret) = timestamp;
@@ -205,3 +199,61 @@ gst_audio_buffer_clip (GstBuffer * buffer, GstSegment * segment, gint rate,
   }
   return ret;
 }
+
+/**
+ * gst_audio_buffer_clip:
+ * @buffer: (transfer full): The buffer to clip.
+ * @segment: Segment in %GST_FORMAT_TIME or %GST_FORMAT_DEFAULT to which
+ *           the buffer should be clipped.
+ * @rate: sample rate.
+ * @bpf: size of one audio frame in bytes. This is the size of one sample
+ * * channels.
+ *
+ * Clip the buffer to the given %GstSegment.
+ *
+ * After calling this function the caller does not own a reference to
+ * @buffer anymore.
+ *
+ * Returns: (transfer full): %NULL if the buffer is completely outside the configured segment,
+ * otherwise the clipped buffer is returned.
+ *
+ * If the buffer has no timestamp, it is assumed to be inside the segment and
+ * is not clipped
+ */
+GstBuffer *
+gst_audio_buffer_clip (GstBuffer * buffer, GstSegment * segment, gint rate,
+    gint bpf)
+{
+  return audio_buffer_clip (buffer, segment, rate, bpf, FALSE);
+}
+
+/**
+ * gst_audio_buffer_clip_with_meta:
+ * @buffer: (transfer full): The buffer to clip.
+ * @segment: Segment in %GST_FORMAT_TIME or %GST_FORMAT_DEFAULT to which
+ *           the buffer should be clipped.
+ * @rate: sample rate.
+ * @bpf: size of one audio frame in bytes. This is the size of one sample
+ * * channels.
+ *
+ * Like gst_audio_buffer_clip() but instead of trimming the data of
+ * @buffer, a #GstAudioClippingMeta in %GST_FORMAT_DEFAULT is attached that
+ * describes how many samples should be dropped from the start and the end
+ * of the buffer. The data, timestamp, duration and offsets of @buffer are
+ * not changed.
+ *
+ * After calling this function the caller does not own a reference to
+ * @buffer anymore.
+ *
+ * Returns: (transfer full): %NULL if the buffer is completely outside the
+ * configured segment, otherwise the buffer with the clipping meta (if any
+ * clipping was needed) is returned.
+ *
+ * Since: 1.2
+ */
+GstBuffer *
+gst_audio_buffer_clip_with_meta (GstBuffer * buffer, GstSegment * segment,
+    gint rate, gint bpf)
+{
+  return audio_buffer_clip (buffer, segment, rate, bpf, TRUE);
+}
@@ -27,6 +27,7 @@
 #include <gst/audio/audio-format.h>
 #include <gst/audio/audio-channels.h>
 #include <gst/audio/audio-info.h>
+#include <gst/audio/audio-converter.h>
 
 G_BEGIN_DECLS
 
@@ -59,6 +60,10 @@ G_BEGIN_DECLS
 GstBuffer *    gst_audio_buffer_clip     (GstBuffer *buffer, GstSegment *segment,
                                           gint rate, gint bpf);
 
+GstBuffer *    gst_audio_buffer_clip_with_meta (GstBuffer *buffer,
+                                                GstSegment *segment,
+                                                gint rate, gint bpf);
+
 
 G_END_DECLS
 
@@ -43,6 +43,10 @@ GST_DEBUG_CATEGORY_STATIC (gst_audio_base_sink_debug);
 #define GST_AUDIO_BASE_SINK_GET_PRIVATE(obj)  \
    (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GST_TYPE_AUDIO_BASE_SINK, GstAudioBaseSinkPrivate))
 
+/* number of bins of the ring buffer fill level histogram in the
+ * slaving-stats, each covers an equal part of the ring buffer */
+#define SLAVING_STATS_FILL_BINS 10
+
 struct _GstAudioBaseSinkPrivate
 {
   /* upstream latency */
@@ -71,6 +75,15 @@ struct _GstAudioBaseSinkPrivate
 
   /* number of nanoseconds to wait until creating a discontinuity */
   GstClockTime discont_wait;
+
+  /* clock slaving statistics, protected by the object lock */
+  guint64 skew_corrections;
+  guint64 resyncs;
+  guint64 aligned_samples;
+  guint64 inserted_samples;
+  guint64 dropped_samples;
+  gdouble fill_level;
+  guint64 fill_histogram[SLAVING_STATS_FILL_BINS];
 };
 
 /* BaseAudioSink signals and args */
@@ -113,6 +126,7 @@ enum
   PROP_ALIGNMENT_THRESHOLD,
   PROP_DRIFT_TOLERANCE,
   PROP_DISCONT_WAIT,
+  PROP_SLAVING_STATS,
 
   PROP_LAST
 };
@@ -270,6 +284,37 @@ gst_audio_base_sink_class_init (GstAudioBaseSinkClass * klass)
           G_MAXUINT64 - 1, DEFAULT_DISCONT_WAIT,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAudioBaseSink:slaving-stats:
+   *
+   * Statistics about the clock slaving and the timestamp alignment since the
+   * ring buffer was last acquired, to help tuning #GstAudioBaseSink:drift-tolerance
+   * and #GstAudioBaseSink:alignment-threshold. The structure contains:
+   *
+   * "skew" (gint64): the running average of the clock skew in nanoseconds,
+   * -1 when unknown.
+   * "skew-corrections" (guint64): how often skew slaving moved the playout
+   * pointer.
+   * "resyncs" (guint64): how often the sample position was resynced instead
+   * of being aligned to the previous buffer.
+   * "aligned-samples" (guint64): the total number of samples buffers were
+   * moved by to align them to the previous buffer.
+   * "inserted-samples" (guint64): the total number of samples of silence left
+   * in gaps on resyncs.
+   * "dropped-samples" (guint64): the total number of samples overwritten on
+   * resyncs.
+   * "fill-level" (gdouble): the part of the ring buffer that was filled ahead
+   * of the playback position when the last buffer was rendered.
+   * "fill-histogram" (#GstValueArray of guint64): how often the fill level was
+   * found in each tenth of the ring buffer.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_SLAVING_STATS,
+      g_param_spec_boxed ("slaving-stats", "Slaving Statistics",
+          "Clock slaving and alignment statistics", GST_TYPE_STRUCTURE,
+          G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_audio_base_sink_change_state);
   gstelement_class->provide_clock =
@@ -795,6 +840,82 @@ gst_audio_base_sink_set_property (GObject * object, guint prop_id,
   }
 }
 
+static void
+gst_audio_base_sink_reset_slaving_stats (GstAudioBaseSink * sink)
+{
+  GstAudioBaseSinkPrivate *priv = sink->priv;
+
+  GST_OBJECT_LOCK (sink);
+  priv->skew_corrections = 0;
+  priv->resyncs = 0;
+  priv->aligned_samples = 0;
+  priv->inserted_samples = 0;
+  priv->dropped_samples = 0;
+  priv->fill_level = 0.0;
+  memset (priv->fill_histogram, 0, sizeof (priv->fill_histogram));
+  GST_OBJECT_UNLOCK (sink);
+}
+
+static GstStructure *
+gst_audio_base_sink_get_slaving_stats (GstAudioBaseSink * sink)
+{
+  GstAudioBaseSinkPrivate *priv = sink->priv;
+  GValue histogram = G_VALUE_INIT;
+  GValue bin = G_VALUE_INIT;
+  GstStructure *s;
+  gint i;
+
+  g_value_init (&histogram, GST_TYPE_ARRAY);
+  g_value_init (&bin, G_TYPE_UINT64);
+
+  GST_OBJECT_LOCK (sink);
+  s = gst_structure_new ("GstAudioBaseSinkSlavingStats",
+      "skew", G_TYPE_INT64, priv->avg_skew,
+      "skew-corrections", G_TYPE_UINT64, priv->skew_corrections,
+      "resyncs", G_TYPE_UINT64, priv->resyncs,
+      "aligned-samples", G_TYPE_UINT64, priv->aligned_samples,
+      "inserted-samples", G_TYPE_UINT64, priv->inserted_samples,
+      "dropped-samples", G_TYPE_UINT64, priv->dropped_samples,
+      "fill-level", G_TYPE_DOUBLE, priv->fill_level, NULL);
+  for (i = 0; i < SLAVING_STATS_FILL_BINS; i++) {
+    g_value_set_uint64 (&bin, priv->fill_histogram[i]);
+    gst_value_array_append_value (&histogram, &bin);
+  }
+  GST_OBJECT_UNLOCK (sink);
+
+  gst_structure_take_value (s, "fill-histogram", &histogram);
+  g_value_unset (&bin);
+
+  return s;
+}
+
+/* record how much of the ring buffer is filled ahead of the playback
+ * position when writing at @sample_offset */
+static void
+gst_audio_base_sink_update_fill_level (GstAudioBaseSink * sink,
+    guint64 sample_offset)
+{
+  GstAudioBaseSinkPrivate *priv = sink->priv;
+  GstAudioRingBuffer *ringbuf = sink->ringbuffer;
+  gint segdone = g_atomic_int_get (&ringbuf->segdone) - ringbuf->segbase;
+  gint64 samples_done = (gint64) segdone * ringbuf->samples_per_seg;
+  gint64 total = (gint64) ringbuf->spec.segtotal * ringbuf->samples_per_seg;
+  gint64 fill = (gint64) sample_offset - samples_done;
+  gint bin;
+
+  if (total <= 0)
+    return;
+
+  fill = CLAMP (fill, 0, total);
+  bin = MIN (fill * SLAVING_STATS_FILL_BINS / total,
+      SLAVING_STATS_FILL_BINS - 1);
+
+  GST_OBJECT_LOCK (sink);
+  priv->fill_level = (gdouble) fill / total;
+  priv->fill_histogram[bin]++;
+  GST_OBJECT_UNLOCK (sink);
+}
+
 static void
 gst_audio_base_sink_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec)
@@ -829,6 +950,9 @@ gst_audio_base_sink_get_property (GObject * object, guint prop_id,
     case PROP_DISCONT_WAIT:
       g_value_set_uint64 (value, gst_audio_base_sink_get_discont_wait (sink));
       break;
+    case PROP_SLAVING_STATS:
+      g_value_take_boxed (value, gst_audio_base_sink_get_slaving_stats (sink));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -889,6 +1013,7 @@ gst_audio_base_sink_setcaps (GstBaseSink * bsink, GstCaps * caps)
   sink->next_sample = -1;
   sink->priv->eos_time = -1;
   sink->priv->discont_time = -1;
+  gst_audio_base_sink_reset_slaving_stats (sink);
 
   if (bsink->pad_mode == GST_PAD_MODE_PUSH) {
     GST_DEBUG_OBJECT (sink, "activate ringbuffer");
@@ -1283,6 +1408,12 @@ gst_audio_base_sink_skew_slaving (GstAudioBaseSink * sink,
     if (last_align < 0 || last_align > driftsamples)
       sink->next_sample = -1;
 
+    GST_OBJECT_LOCK (sink);
+    sink->priv->skew_corrections++;
+    if (sink->next_sample == -1)
+      sink->priv->resyncs++;
+    GST_OBJECT_UNLOCK (sink);
+
     GST_DEBUG_OBJECT (sink,
         "last_align %" G_GINT64_FORMAT " driftsamples %u, next %"
         G_GUINT64_FORMAT, last_align, driftsamples, sink->next_sample);
@@ -1305,6 +1436,12 @@ gst_audio_base_sink_skew_slaving (GstAudioBaseSink * sink,
     if (last_align > 0 || -last_align > driftsamples)
       sink->next_sample = -1;
 
+    GST_OBJECT_LOCK (sink);
+    sink->priv->skew_corrections++;
+    if (sink->next_sample == -1)
+      sink->priv->resyncs++;
+    GST_OBJECT_UNLOCK (sink);
+
     GST_DEBUG_OBJECT (sink,
         "last_align %" G_GINT64_FORMAT " driftsamples %u, next %"
         G_GUINT64_FORMAT, last_align, driftsamples, sink->next_sample);
@@ -1566,6 +1703,10 @@ gst_audio_base_sink_get_alignment (GstAudioBaseSink * sink,
     GST_DEBUG_OBJECT (sink,
         "align with prev sample, ABS (%" G_GINT64_FORMAT ") < %"
         G_GINT64_FORMAT, align, max_sample_diff);
+
+    GST_OBJECT_LOCK (sink);
+    sink->priv->aligned_samples += sample_diff;
+    GST_OBJECT_UNLOCK (sink);
   } else {
     gint64 diff_s G_GNUC_UNUSED;
 
@@ -1579,6 +1720,15 @@ gst_audio_base_sink_get_alignment (GstAudioBaseSink * sink,
         "%s%" GST_TIME_FORMAT ", resyncing",
         sample_offset > sink->next_sample ? "+" : "-", GST_TIME_ARGS (diff_s));
     align = 0;
+
+    /* a gap is left as silence and an overlap overwrites what was written */
+    GST_OBJECT_LOCK (sink);
+    sink->priv->resyncs++;
+    if (sample_offset > sink->next_sample)
+      sink->priv->inserted_samples += sample_diff;
+    else
+      sink->priv->dropped_samples += sample_diff;
+    GST_OBJECT_UNLOCK (sink);
   }
 
   return align;
@@ -1885,6 +2035,8 @@ no_align:
   GST_DEBUG_OBJECT (sink, "rendering at %" G_GUINT64_FORMAT " %d/%d",
       sample_offset, samples, out_samples);
 
+  gst_audio_base_sink_update_fill_level (sink, sample_offset);
+
   /* we need to accumulate over different runs for when we get interrupted */
   accum = 0;
   align_next = TRUE;
@@ -2027,7 +2179,7 @@ gst_audio_base_sink_callback (GstAudioRingBuffer * rbuf, guint8 * data,
 {
   GstBaseSink *basesink;
   GstAudioBaseSink *sink;
-  GstBuffer *buf = NULL;
+  GstBuffer *buf = NULL, *wrapped = NULL;
   GstFlowReturn ret;
   gsize size;
 
@@ -2036,15 +2188,26 @@ gst_audio_base_sink_callback (GstAudioRingBuffer * rbuf, guint8 * data,
 
   GST_PAD_STREAM_LOCK (basesink->sinkpad);
 
-  /* would be nice to arrange for pad_alloc_buffer to return data -- as it is we
-     will copy twice, once into data, once into DMA */
+  /* let upstream fill the segment directly. We can't do that when the buffer
+   * is kept around as the last-sample because the memory is only ours until
+   * the segment is played */
+  if (!gst_base_sink_is_last_sample_enabled (basesink)) {
+    wrapped = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_NO_SHARE, data,
+        len, 0, len, NULL, NULL);
+    buf = wrapped;
+  }
+
   GST_LOG_OBJECT (basesink, "pulling %u bytes offset %" G_GUINT64_FORMAT
-      " to fill audio buffer", len, basesink->offset);
+      " to fill audio buffer%s", len, basesink->offset,
+      wrapped ? " in place" : "");
   ret =
       gst_pad_pull_range (basesink->sinkpad, basesink->segment.position, len,
       &buf);
 
   if (ret != GST_FLOW_OK) {
+    /* the buffer we passed is left untouched on errors */
+    if (wrapped)
+      gst_buffer_unref (wrapped);
     if (ret == GST_FLOW_EOS)
       goto eos;
     else
@@ -2071,11 +2234,15 @@ gst_audio_base_sink_callback (GstAudioRingBuffer * rbuf, guint8 * data,
 
   basesink->segment.position += len;
 
-  gst_buffer_extract (buf, 0, data, len);
+  /* nothing to copy when upstream filled our segment */
+  if (buf != wrapped)
+    gst_buffer_extract (buf, 0, data, len);
   GST_BASE_SINK_PREROLL_UNLOCK (basesink);
 
   GST_PAD_STREAM_UNLOCK (basesink->sinkpad);
 
+  gst_buffer_unref (buf);
+
   return;
 
 error:
@@ -2104,6 +2271,7 @@ flushing:
     gst_audio_ring_buffer_pause (rbuf);
     GST_BASE_SINK_PREROLL_UNLOCK (basesink);
     GST_PAD_STREAM_UNLOCK (basesink->sinkpad);
+    gst_buffer_unref (buf);
     return;
   }
 preroll_error:
@@ -2112,6 +2280,7 @@ preroll_error:
     gst_audio_ring_buffer_pause (rbuf);
     GST_BASE_SINK_PREROLL_UNLOCK (basesink);
     GST_PAD_STREAM_UNLOCK (basesink->sinkpad);
+    gst_buffer_unref (buf);
     return;
   }
 }
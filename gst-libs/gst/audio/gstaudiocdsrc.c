@@ -120,6 +120,9 @@ GST_DEBUG_CATEGORY_STATIC (gst_audio_cd_src_debug);
 #define TIME_INTERVAL_FROM_SECTORS(sectors)  ((SAMPLES_PER_SECTOR * sectors * GST_SECOND) / 44100)
 #define SECTORS_FROM_TIME_INTERVAL(dtime)    (dtime * 44100 / (SAMPLES_PER_SECTOR * GST_SECOND))
 
+#define DEFAULT_READ_AHEAD                   0
+#define MAX_READ_AHEAD                       (SECTORS_PER_MINUTE)
+
 enum
 {
   ARG_0,
@@ -127,7 +130,8 @@ enum
   ARG_DEVICE,
   ARG_TRACK,
   ARG_TOC_OFFSET,
-  ARG_TOC_BIAS
+  ARG_TOC_BIAS,
+  ARG_READ_AHEAD
 };
 
 struct _GstAudioCdSrcPrivate
@@ -161,6 +165,20 @@ struct _GstAudioCdSrcPrivate
 
   GstEvent *toc_event;          /* pending TOC event */
   GstToc *toc;
+
+  /* read-ahead */
+  guint read_ahead;             /* max sectors to cache, 0 = off, with LOCK */
+  GThread *ra_thread;
+  GMutex ra_lock;
+  GCond ra_cond;
+  gboolean ra_running;
+  gboolean ra_error;            /* reading ra_next failed          */
+  guint ra_size;                /* read_ahead when source started  */
+  guint ra_gen;                 /* bumped when the cache is reset  */
+  gint ra_last;                 /* last sector worth reading       */
+  GQueue ra_cache;              /* buffers for ra_start..ra_next-1 */
+  gint ra_start;
+  gint ra_next;
 };
 
 static void gst_audio_cd_src_uri_handler_init (gpointer g_iface,
@@ -181,6 +199,7 @@ static GstFlowReturn gst_audio_cd_src_create (GstPushSrc * pushsrc,
     GstBuffer ** buf);
 static gboolean gst_audio_cd_src_is_seekable (GstBaseSrc * basesrc);
 static void gst_audio_cd_src_update_duration (GstAudioCdSrc * src);
+static void gst_audio_cd_src_stop_read_ahead (GstAudioCdSrc * src);
 #if 0
 static void gst_audio_cd_src_set_index (GstElement * src, GstIndex * index);
 static GstIndex *gst_audio_cd_src_get_index (GstElement * src);
@@ -273,6 +292,23 @@ gst_audio_cd_src_class_init (GstAudioCdSrcClass * klass)
       g_param_spec_uint ("track", "Track", "Track", 1, 99, 1,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAudioCdSrc:read-ahead:
+   *
+   * Maximum number of sectors to read ahead from a separate thread. This
+   * keeps the drive busy while downstream is processing the data and lets
+   * the reading of the next track overlap with the processing of the
+   * current one. 0 reads each sector synchronously from the streaming
+   * thread. Changes take effect the next time the source is started.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (G_OBJECT_CLASS (klass), ARG_READ_AHEAD,
+      g_param_spec_uint ("read-ahead", "Read ahead",
+          "Maximum number of sectors to read ahead (0 = disabled)", 0,
+          MAX_READ_AHEAD, DEFAULT_READ_AHEAD,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
 #if 0
   /* Do we really need this toc adjustment stuff as properties? does the user
    * have a chance to set it in practice, e.g. when using sound-juicer, rb,
@@ -325,6 +361,11 @@ gst_audio_cd_src_init (GstAudioCdSrc * src)
   src->priv->device = NULL;
   src->priv->mode = GST_AUDIO_CD_SRC_MODE_NORMAL;
   src->priv->uri_track = -1;
+  src->priv->read_ahead = DEFAULT_READ_AHEAD;
+
+  g_mutex_init (&src->priv->ra_lock);
+  g_cond_init (&src->priv->ra_cond);
+  g_queue_init (&src->priv->ra_cache);
 }
 
 static void
@@ -335,6 +376,9 @@ gst_audio_cd_src_finalize (GObject * obj)
   g_free (cddasrc->priv->uri);
   g_free (cddasrc->priv->device);
 
+  g_mutex_clear (&cddasrc->priv->ra_lock);
+  g_cond_clear (&cddasrc->priv->ra_cond);
+
 #if 0
   if (cddasrc->priv->index)
     gst_object_unref (cddasrc->priv->index);
@@ -415,6 +459,10 @@ gst_audio_cd_src_set_property (GObject * object, guint prop_id,
       src->priv->toc_bias = g_value_get_boolean (value);
       break;
     }
+    case ARG_READ_AHEAD:{
+      src->priv->read_ahead = g_value_get_uint (value);
+      break;
+    }
     default:{
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -471,6 +519,9 @@ gst_audio_cd_src_get_property (GObject * object, guint prop_id,
     case ARG_TOC_BIAS:
       g_value_set_boolean (value, src->priv->toc_bias);
       break;
+    case ARG_READ_AHEAD:
+      g_value_set_uint (value, src->priv->read_ahead);
+      break;
     default:{
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1549,6 +1600,11 @@ gst_audio_cd_src_start (GstBaseSrc * basesrc)
   src->priv->discid = 0;
   src->priv->mb_discid[0] = '\0';
 
+  /* the streaming and read-ahead threads only look at this copy */
+  GST_OBJECT_LOCK (src);
+  src->priv->ra_size = src->priv->read_ahead;
+  GST_OBJECT_UNLOCK (src);
+
   g_assert (klass->open != NULL);
 
   if (src->priv->device != NULL) {
@@ -1675,6 +1731,9 @@ gst_audio_cd_src_stop (GstBaseSrc * basesrc)
 
   g_assert (klass->close != NULL);
 
+  /* the read-ahead thread may be inside read_sector */
+  gst_audio_cd_src_stop_read_ahead (src);
+
   klass->close (src);
 
   gst_audio_cd_src_clear_tracks (src);
@@ -1697,6 +1756,141 @@ gst_audio_cd_src_stop (GstBaseSrc * basesrc)
   return TRUE;
 }
 
+/* discards the cache and restarts reading at @sector, call with ra_lock */
+static void
+gst_audio_cd_src_reset_read_ahead (GstAudioCdSrc * src, gint sector)
+{
+  GstAudioCdSrcPrivate *priv = src->priv;
+  GstBuffer *buf;
+
+  GST_DEBUG_OBJECT (src, "read-ahead restarting at sector %d", sector);
+
+  while ((buf = g_queue_pop_head (&priv->ra_cache)))
+    gst_buffer_unref (buf);
+
+  priv->ra_start = priv->ra_next = sector;
+  priv->ra_error = FALSE;
+  priv->ra_gen++;
+  g_cond_broadcast (&priv->ra_cond);
+}
+
+static gpointer
+gst_audio_cd_src_read_ahead_func (GstAudioCdSrc * src)
+{
+  GstAudioCdSrcClass *klass = GST_AUDIO_CD_SRC_GET_CLASS (src);
+  GstAudioCdSrcPrivate *priv = src->priv;
+
+  GST_DEBUG_OBJECT (src, "read-ahead thread started");
+
+  g_mutex_lock (&priv->ra_lock);
+  while (priv->ra_running) {
+    GstBuffer *buf;
+    gint sector;
+    guint gen;
+
+    if (priv->ra_error || priv->ra_next > priv->ra_last ||
+        g_queue_get_length (&priv->ra_cache) >= priv->ra_size) {
+      g_cond_wait (&priv->ra_cond, &priv->ra_lock);
+      continue;
+    }
+
+    sector = priv->ra_next;
+    gen = priv->ra_gen;
+    g_mutex_unlock (&priv->ra_lock);
+
+    GST_LOG_OBJECT (src, "reading ahead sector %d", sector);
+    buf = klass->read_sector (src, sector);
+
+    g_mutex_lock (&priv->ra_lock);
+    if (gen != priv->ra_gen) {
+      /* cache was reset while we were reading, this sector is useless now */
+      if (buf)
+        gst_buffer_unref (buf);
+      continue;
+    }
+    if (buf == NULL) {
+      GST_WARNING_OBJECT (src, "failed to read ahead sector %d", sector);
+      priv->ra_error = TRUE;
+    } else {
+      g_queue_push_tail (&priv->ra_cache, buf);
+      priv->ra_next++;
+    }
+    g_cond_broadcast (&priv->ra_cond);
+  }
+  g_mutex_unlock (&priv->ra_lock);
+
+  GST_DEBUG_OBJECT (src, "read-ahead thread stopped");
+
+  return NULL;
+}
+
+static void
+gst_audio_cd_src_stop_read_ahead (GstAudioCdSrc * src)
+{
+  GstAudioCdSrcPrivate *priv = src->priv;
+  GThread *thread;
+
+  g_mutex_lock (&priv->ra_lock);
+  priv->ra_running = FALSE;
+  thread = priv->ra_thread;
+  priv->ra_thread = NULL;
+  g_cond_broadcast (&priv->ra_cond);
+  g_mutex_unlock (&priv->ra_lock);
+
+  if (thread)
+    g_thread_join (thread);
+
+  g_mutex_lock (&priv->ra_lock);
+  gst_audio_cd_src_reset_read_ahead (src, 0);
+  g_mutex_unlock (&priv->ra_lock);
+}
+
+/* returns @sector from the read-ahead cache, or reads it directly when
+ * read-ahead is disabled. Sectors before @sector are dropped from the cache,
+ * anything else (a seek) restarts the read-ahead at @sector. */
+static GstBuffer *
+gst_audio_cd_src_read_sector (GstAudioCdSrc * src, gint sector)
+{
+  GstAudioCdSrcClass *klass = GST_AUDIO_CD_SRC_GET_CLASS (src);
+  GstAudioCdSrcPrivate *priv = src->priv;
+  GstBuffer *buf;
+
+  if (priv->ra_size == 0)
+    return klass->read_sector (src, sector);
+
+  g_mutex_lock (&priv->ra_lock);
+  if (priv->ra_thread == NULL) {
+    /* read across track boundaries, so that the next track is already
+     * being read while downstream is still busy with the current one */
+    priv->ra_last = priv->tracks[priv->num_tracks - 1].end;
+    priv->ra_running = TRUE;
+    gst_audio_cd_src_reset_read_ahead (src, sector);
+    priv->ra_thread = g_thread_new ("audiocdsrc-read-ahead",
+        (GThreadFunc) gst_audio_cd_src_read_ahead_func, src);
+  }
+
+  if (sector < priv->ra_start || sector > priv->ra_next) {
+    gst_audio_cd_src_reset_read_ahead (src, sector);
+  } else {
+    while (priv->ra_start < sector) {
+      gst_buffer_unref (g_queue_pop_head (&priv->ra_cache));
+      priv->ra_start++;
+    }
+  }
+
+  while (g_queue_is_empty (&priv->ra_cache) && !priv->ra_error)
+    g_cond_wait (&priv->ra_cond, &priv->ra_lock);
+
+  buf = g_queue_pop_head (&priv->ra_cache);
+  if (buf) {
+    priv->ra_start++;
+    /* make room for the next sector */
+    g_cond_broadcast (&priv->ra_cond);
+  }
+  g_mutex_unlock (&priv->ra_lock);
+
+  return buf;
+}
 
 static GstFlowReturn
 gst_audio_cd_src_create (GstPushSrc * pushsrc, GstBuffer ** buffer)
@@ -1758,7 +1952,7 @@ gst_audio_cd_src_create (GstPushSrc * pushsrc, GstBuffer ** buffer)
 
   GST_LOG_OBJECT (src, "asking for sector %u", src->priv->cur_sector);
 
-  buf = klass->read_sector (src, src->priv->cur_sector);
+  buf = gst_audio_cd_src_read_sector (src, src->priv->cur_sector);
 
   if (buf == NULL) {
     GST_WARNING_OBJECT (src, "failed to read sector %u", src->priv->cur_sector);
@@ -42,10 +42,33 @@
 GST_DEBUG_CATEGORY_STATIC (gst_audio_clock_debug);
 #define GST_CAT_DEFAULT gst_audio_clock_debug
 
+#define GST_AUDIO_CLOCK_GET_PRIVATE(obj)  \
+   (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GST_TYPE_AUDIO_CLOCK, GstAudioClockPrivate))
+
+/* Asking the time function for the time usually means asking the audio
+ * device for its delay, which is a syscall for most devices. Between two
+ * samples we extrapolate the last sample with the monotonic system clock
+ * instead. The error of the extrapolation is bounded by the interval: when
+ * the device stalls, the clock runs ahead for at most this long and then
+ * stays at that time until the device catches up. */
+#define SAMPLE_INTERVAL (10 * GST_MSECOND)
+
+struct _GstAudioClockPrivate
+{
+  GMutex lock;
+
+  /* with lock */
+  gboolean sample_valid;
+  gboolean moving;
+  GstClockTime sample_time;
+  gint64 sample_monotonic;
+};
+
 static void gst_audio_clock_class_init (GstAudioClockClass * klass);
 static void gst_audio_clock_init (GstAudioClock * clock);
 
 static void gst_audio_clock_dispose (GObject * object);
+static void gst_audio_clock_finalize (GObject * object);
 
 static GstClockTime gst_audio_clock_get_internal_time (GstClock * clock);
 
@@ -90,7 +113,10 @@ gst_audio_clock_class_init (GstAudioClockClass * klass)
 
   parent_class = g_type_class_peek_parent (klass);
 
+  g_type_class_add_private (klass, sizeof (GstAudioClockPrivate));
+
   gobject_class->dispose = gst_audio_clock_dispose;
+  gobject_class->finalize = gst_audio_clock_finalize;
   gstclock_class->get_internal_time = gst_audio_clock_get_internal_time;
 
   GST_DEBUG_CATEGORY_INIT (gst_audio_clock_debug, "audioclock", 0,
@@ -101,8 +127,12 @@ static void
 gst_audio_clock_init (GstAudioClock * clock)
 {
   GST_DEBUG_OBJECT (clock, "init");
+  clock->priv = GST_AUDIO_CLOCK_GET_PRIVATE (clock);
   clock->last_time = 0;
   clock->time_offset = 0;
+  g_mutex_init (&clock->priv->lock);
+  clock->priv->sample_valid = FALSE;
+  clock->priv->moving = FALSE;
   GST_OBJECT_FLAG_SET (clock, GST_CLOCK_FLAG_CAN_SET_MASTER);
 }
 
@@ -119,6 +149,26 @@ gst_audio_clock_dispose (GObject * object)
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
 
+static void
+gst_audio_clock_finalize (GObject * object)
+{
+  GstAudioClock *clock = GST_AUDIO_CLOCK (object);
+
+  g_mutex_clear (&clock->priv->lock);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+/* forget the last sample, the next time is asked from the time function */
+static void
+gst_audio_clock_invalidate_sample (GstAudioClock * clock)
+{
+  g_mutex_lock (&clock->priv->lock);
+  clock->priv->sample_valid = FALSE;
+  clock->priv->moving = FALSE;
+  g_mutex_unlock (&clock->priv->lock);
+}
+
 /**
  * gst_audio_clock_new:
  * @name: the name of the clock
@@ -168,6 +218,7 @@ gst_audio_clock_reset (GstAudioClock * clock, GstClockTime time)
     time_offset = -(time - clock->last_time);
 
   clock->time_offset = time_offset;
+  gst_audio_clock_invalidate_sample (clock);
 
   GST_DEBUG_OBJECT (clock,
       "reset clock to %" GST_TIME_FORMAT ", last %" GST_TIME_FORMAT ", offset %"
@@ -181,6 +232,50 @@ gst_audio_clock_func_invalid (GstClock * clock, gpointer user_data)
   return GST_CLOCK_TIME_NONE;
 }
 
+/* get the time from the time function or extrapolate it from the last
+ * sample when that was taken recently enough */
+static GstClockTime
+gst_audio_clock_sample_time (GstAudioClock * aclock)
+{
+  GstAudioClockPrivate *priv = aclock->priv;
+  GstClockTime result;
+  gint64 now;
+
+  now = g_get_monotonic_time ();
+
+  g_mutex_lock (&priv->lock);
+  /* only extrapolate when the clock was moving between the last two samples,
+   * a stopped device would otherwise make the clock advance */
+  if (priv->sample_valid && priv->moving &&
+      (now - priv->sample_monotonic) * GST_USECOND < SAMPLE_INTERVAL) {
+    result = priv->sample_time + (now - priv->sample_monotonic) * GST_USECOND;
+    g_mutex_unlock (&priv->lock);
+
+    GST_LOG_OBJECT (aclock, "extrapolated %" GST_TIME_FORMAT,
+        GST_TIME_ARGS (result));
+    return result;
+  }
+  g_mutex_unlock (&priv->lock);
+
+  /* don't hold our lock while calling out, the function takes locks of its
+   * own */
+  result = aclock->func (GST_CLOCK_CAST (aclock), aclock->user_data);
+
+  g_mutex_lock (&priv->lock);
+  if (result == GST_CLOCK_TIME_NONE) {
+    priv->sample_valid = FALSE;
+    priv->moving = FALSE;
+  } else {
+    priv->moving = priv->sample_valid && result > priv->sample_time;
+    priv->sample_valid = TRUE;
+    priv->sample_time = result;
+    priv->sample_monotonic = now;
+  }
+  g_mutex_unlock (&priv->lock);
+
+  return result;
+}
+
 static GstClockTime
 gst_audio_clock_get_internal_time (GstClock * clock)
 {
@@ -189,7 +284,7 @@ gst_audio_clock_get_internal_time (GstClock * clock)
 
   aclock = GST_AUDIO_CLOCK_CAST (clock);
 
-  result = aclock->func (clock, aclock->user_data);
+  result = gst_audio_clock_sample_time (aclock);
   if (result == GST_CLOCK_TIME_NONE) {
     result = aclock->last_time;
   } else {
@@ -279,4 +374,5 @@ gst_audio_clock_invalidate (GstClock * clock)
   aclock = GST_AUDIO_CLOCK_CAST (clock);
 
   aclock->func = gst_audio_clock_func_invalid;
+  gst_audio_clock_invalidate_sample (aclock);
 }
@@ -43,6 +43,7 @@ G_BEGIN_DECLS
 
 typedef struct _GstAudioClock GstAudioClock;
 typedef struct _GstAudioClockClass GstAudioClockClass;
+typedef struct _GstAudioClockPrivate GstAudioClockPrivate;
 
 /**
  * GstAudioClockGetTimeFunc:
@@ -75,7 +76,9 @@ struct _GstAudioClock {
   GstClockTime             last_time;
   GstClockTimeDiff         time_offset;
 
-  gpointer _gst_reserved[GST_PADDING];
+  GstAudioClockPrivate    *priv;
+
+  gpointer _gst_reserved[GST_PADDING - 1];
 };
 
 struct _GstAudioClockClass {
@@ -149,6 +149,7 @@
 #endif
 
 #include "gstaudiodecoder.h"
+#include "audio-codec-stats.h"
 #include <gst/pbutils/descriptions.h>
 
 #include <string.h>
@@ -170,12 +171,15 @@ enum
   PROP_0,
   PROP_LATENCY,
   PROP_TOLERANCE,
-  PROP_PLC
+  PROP_PLC,
+  PROP_STATS,
+  PROP_STATS_INTERVAL
 };
 
 #define DEFAULT_LATENCY    0
 #define DEFAULT_TOLERANCE  0
 #define DEFAULT_PLC        FALSE
+#define DEFAULT_STATS_INTERVAL 0
 #define DEFAULT_DRAINABLE  TRUE
 #define DEFAULT_NEEDS_FORMAT  FALSE
 
@@ -205,6 +209,9 @@ typedef struct _GstAudioDecoderContext
 
   GstAllocator *allocator;
   GstAllocationParams params;
+  /* downstream pool and the size of its buffers, if any */
+  GstBufferPool *pool;
+  guint pool_size;
 } GstAudioDecoderContext;
 
 struct _GstAudioDecoderPrivate
@@ -274,6 +281,11 @@ struct _GstAudioDecoderPrivate
 
   /* pending serialized sink events, will be sent from finish_frame() */
   GList *pending_events;
+
+  /* OBJECT_LOCK */
+  AudioCodecStats stats;
+  /* time spent pushing downstream from within handle_frame, in us */
+  gint64 push_time;
 };
 
 
@@ -389,6 +401,58 @@ gst_audio_decoder_class_init (GstAudioDecoderClass * klass)
           "Perform packet loss concealment (if supported)",
           DEFAULT_PLC, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstAudioDecoder:stats:
+   *
+   * Statistics of the decoder since it was started, in a structure named
+   * "GstAudioDecoderStats" with the following fields:
+   *
+   * "processed" G_TYPE_UINT64: handle_frame calls
+   *
+   * "pushed" G_TYPE_UINT64: decoded buffers finished by the subclass
+   *
+   * "dropped" G_TYPE_UINT64: input frames finished without output
+   *
+   * "in-flight" G_TYPE_UINT: input frames waiting to be finished
+   *
+   * "processing-time" G_TYPE_UINT64: total time spent in the handle_frame
+   * vmethod in nanoseconds, without the time spent pushing downstream
+   *
+   * "max-processing-time" G_TYPE_UINT64: longest handle_frame call in
+   * nanoseconds
+   *
+   * "processing-histogram" #GstValueArray of G_TYPE_UINT64: number of
+   * handle_frame calls that took less than 1, 2, 4, 8, 16, 32 and 64
+   * milliseconds and longer
+   *
+   * "average-latency" G_TYPE_UINT64: average time between the arrival of
+   * an input frame and the output decoded from it in nanoseconds
+   *
+   * "max-latency" G_TYPE_UINT64: longest time between the arrival of an
+   * input frame and the output decoded from it in nanoseconds
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS,
+      g_param_spec_boxed ("stats", "Statistics",
+          "Statistics of the decoder since it was started",
+          GST_TYPE_STRUCTURE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioDecoder:stats-interval:
+   *
+   * Interval in nanoseconds at which the #GstAudioDecoder:stats are posted
+   * as an element message on the bus while output is produced, 0 disables
+   * the messages.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS_INTERVAL,
+      g_param_spec_uint64 ("stats-interval", "Stats Interval",
+          "Interval for posting the stats on the bus in nanoseconds "
+          "(0 = disabled)", 0, G_MAXUINT64, DEFAULT_STATS_INTERVAL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   audiodecoder_class->sink_event =
       GST_DEBUG_FUNCPTR (gst_audio_decoder_sink_eventfunc);
   audiodecoder_class->src_event =
@@ -442,6 +506,7 @@ gst_audio_decoder_init (GstAudioDecoder * dec, GstAudioDecoderClass * klass)
   dec->priv->adapter = gst_adapter_new ();
   dec->priv->adapter_out = gst_adapter_new ();
   g_queue_init (&dec->priv->frames);
+  audio_codec_stats_init (&dec->priv->stats);
 
   g_rec_mutex_init (&dec->stream_lock);
 
@@ -493,11 +558,21 @@ gst_audio_decoder_reset (GstAudioDecoder * dec, gboolean full)
       gst_object_unref (dec->priv->ctx.allocator);
     dec->priv->ctx.allocator = NULL;
 
+    if (dec->priv->ctx.pool) {
+      gst_buffer_pool_set_active (dec->priv->ctx.pool, FALSE);
+      gst_object_unref (dec->priv->ctx.pool);
+    }
+    dec->priv->ctx.pool = NULL;
+    dec->priv->ctx.pool_size = 0;
+
     gst_caps_replace (&dec->priv->ctx.input_caps, NULL);
   }
 
   g_queue_foreach (&dec->priv->frames, (GFunc) gst_buffer_unref, NULL);
   g_queue_clear (&dec->priv->frames);
+  GST_OBJECT_LOCK (dec);
+  audio_codec_stats_clear_input (&dec->priv->stats);
+  GST_OBJECT_UNLOCK (dec);
   gst_adapter_clear (dec->priv->adapter);
   gst_adapter_clear (dec->priv->adapter_out);
   dec->priv->out_ts = GST_CLOCK_TIME_NONE;
@@ -527,6 +602,7 @@ gst_audio_decoder_finalize (GObject * object)
   if (dec->priv->adapter_out) {
     g_object_unref (dec->priv->adapter_out);
   }
+  audio_codec_stats_free (&dec->priv->stats);
 
   g_rec_mutex_clear (&dec->stream_lock);
 
@@ -565,6 +641,8 @@ gst_audio_decoder_negotiate_default (GstAudioDecoder * dec)
   GstQuery *query = NULL;
   GstAllocator *allocator;
   GstAllocationParams params;
+  GstBufferPool *pool = NULL;
+  guint pool_size = 0;
 
   g_return_val_if_fail (GST_IS_AUDIO_DECODER (dec), FALSE);
   g_return_val_if_fail (GST_AUDIO_INFO_IS_VALID (&dec->priv->ctx.info), FALSE);
@@ -632,6 +710,24 @@ gst_audio_decoder_negotiate_default (GstAudioDecoder * dec)
   dec->priv->ctx.allocator = allocator;
   dec->priv->ctx.params = params;
 
+  /* output buffers that fit are taken from the pool */
+  if (gst_query_get_n_allocation_pools (query) > 0)
+    gst_query_parse_nth_allocation_pool (query, 0, &pool, &pool_size, NULL,
+        NULL);
+
+  if (dec->priv->ctx.pool) {
+    gst_buffer_pool_set_active (dec->priv->ctx.pool, FALSE);
+    gst_object_unref (dec->priv->ctx.pool);
+  }
+
+  if (pool && (pool_size == 0 || !gst_buffer_pool_set_active (pool, TRUE))) {
+    GST_DEBUG_OBJECT (dec, "not using pool %" GST_PTR_FORMAT, pool);
+    gst_object_unref (pool);
+    pool = NULL;
+  }
+  dec->priv->ctx.pool = pool;
+  dec->priv->ctx.pool_size = pool ? pool_size : 0;
+
 done:
 
   if (query)
@@ -811,6 +907,7 @@ gst_audio_decoder_push_forward (GstAudioDecoder * dec, GstBuffer * buf)
   GstAudioDecoderPrivate *priv;
   GstAudioDecoderContext *ctx;
   GstFlowReturn ret = GST_FLOW_OK;
+  gint64 push_start;
 
   klass = GST_AUDIO_DECODER_GET_CLASS (dec);
   priv = dec->priv;
@@ -870,7 +967,9 @@ gst_audio_decoder_push_forward (GstAudioDecoder * dec, GstBuffer * buf)
       GST_TIME_ARGS (GST_BUFFER_TIMESTAMP (buf)),
       GST_TIME_ARGS (GST_BUFFER_DURATION (buf)));
 
+  push_start = g_get_monotonic_time ();
   ret = gst_pad_push (dec->srcpad, buf);
+  priv->push_time += g_get_monotonic_time () - push_start;
 
 exit:
   return ret;
@@ -1007,6 +1106,8 @@ gst_audio_decoder_finish_frame (GstAudioDecoder * dec, GstBuffer * buf,
   GstClockTime ts, next_ts;
   gsize size;
   GstFlowReturn ret = GST_FLOW_OK;
+  GstStructure *stats = NULL;
+  gint64 arrival;
 
   /* subclass should not hand us no data */
   g_return_val_if_fail (buf == NULL || gst_buffer_get_size (buf) > 0,
@@ -1075,6 +1176,23 @@ gst_audio_decoder_finish_frame (GstAudioDecoder * dec, GstBuffer * buf,
   GST_DEBUG_OBJECT (dec, "leading frame ts %" GST_TIME_FORMAT,
       GST_TIME_ARGS (ts));
 
+  GST_OBJECT_LOCK (dec);
+  arrival = audio_codec_stats_take_input (&priv->stats,
+      MIN (frames, priv->frames.length));
+  if (buf) {
+    audio_codec_stats_add_pushed (&priv->stats, arrival);
+    if (audio_codec_stats_need_post (&priv->stats))
+      stats = audio_codec_stats_to_structure (&priv->stats,
+          "GstAudioDecoderStats", priv->frames.length);
+  } else {
+    priv->stats.dropped += MIN (frames, priv->frames.length);
+  }
+  GST_OBJECT_UNLOCK (dec);
+
+  if (stats)
+    gst_element_post_message (GST_ELEMENT_CAST (dec),
+        gst_message_new_element (GST_OBJECT_CAST (dec), stats));
+
   while (priv->frames.length && frames) {
     gst_buffer_unref (g_queue_pop_head (&priv->frames));
     dec->priv->ctx.delay = dec->priv->frames.length;
@@ -1183,6 +1301,9 @@ static GstFlowReturn
 gst_audio_decoder_handle_frame (GstAudioDecoder * dec,
     GstAudioDecoderClass * klass, GstBuffer * buffer)
 {
+  GstFlowReturn ret;
+  gint64 start;
+
   if (G_LIKELY (buffer)) {
     gsize size = gst_buffer_get_size (buffer);
     /* keep around for admin */
@@ -1192,11 +1313,23 @@ gst_audio_decoder_handle_frame (GstAudioDecoder * dec,
     g_queue_push_tail (&dec->priv->frames, buffer);
     dec->priv->ctx.delay = dec->priv->frames.length;
     dec->priv->bytes_in += size;
+    GST_OBJECT_LOCK (dec);
+    audio_codec_stats_add_input (&dec->priv->stats, 1);
+    GST_OBJECT_UNLOCK (dec);
   } else {
     GST_LOG_OBJECT (dec, "providing subclass with NULL frame");
   }
 
-  return klass->handle_frame (dec, buffer);
+  dec->priv->push_time = 0;
+  start = g_get_monotonic_time ();
+  ret = klass->handle_frame (dec, buffer);
+
+  GST_OBJECT_LOCK (dec);
+  audio_codec_stats_add_processed (&dec->priv->stats,
+      start + dec->priv->push_time);
+  GST_OBJECT_UNLOCK (dec);
+
+  return ret;
 }
 
 /* maybe subclass configurable instead, but this allows for a whole lot of
@@ -1341,6 +1474,9 @@ gst_audio_decoder_drain (GstAudioDecoder * dec)
           dec->priv->frames.length);
       g_queue_foreach (&dec->priv->frames, (GFunc) gst_buffer_unref, NULL);
       g_queue_clear (&dec->priv->frames);
+      GST_OBJECT_LOCK (dec);
+      audio_codec_stats_clear_input (&dec->priv->stats);
+      GST_OBJECT_UNLOCK (dec);
     }
     /* discard (unparsed) leftover */
     gst_adapter_clear (dec->priv->adapter);
@@ -2049,6 +2185,8 @@ gst_audio_decoder_decide_allocation_default (GstAudioDecoder * dec,
   GstAllocator *allocator = NULL;
   GstAllocationParams params;
   gboolean update_allocator;
+  GstBufferPool *pool = NULL;
+  guint size, min, max;
 
   /* we got configuration from our peer or the decide_allocation method,
    * parse them */
@@ -2066,6 +2204,38 @@ gst_audio_decoder_decide_allocation_default (GstAudioDecoder * dec,
     gst_query_set_nth_allocation_param (query, 0, allocator, &params);
   else
     gst_query_add_allocation_param (query, allocator, &params);
+
+  /* use the pool of downstream when there is one, without a size hint we
+   * can't guess the output buffer sizes of the subclass well enough to make
+   * our own */
+  if (gst_query_get_n_allocation_pools (query) > 0)
+    gst_query_parse_nth_allocation_pool (query, 0, &pool, &size, &min, &max);
+
+  if (pool) {
+    GstCaps *outcaps;
+    GstStructure *config;
+    gint bpf = GST_AUDIO_INFO_BPF (&dec->priv->ctx.info);
+
+    gst_query_parse_allocation (query, &outcaps, NULL);
+
+    /* only hand out buffers holding whole frames */
+    if (bpf > 0)
+      size -= size % bpf;
+
+    config = gst_buffer_pool_get_config (pool);
+    gst_buffer_pool_config_set_params (config, outcaps, size, min, max);
+    gst_buffer_pool_config_set_allocator (config, allocator, &params);
+    if (size == 0 || !gst_buffer_pool_set_config (pool, config)) {
+      GST_DEBUG_OBJECT (dec, "could not configure downstream pool");
+      gst_object_unref (pool);
+      pool = NULL;
+      size = min = max = 0;
+    }
+    gst_query_set_nth_allocation_pool (query, 0, pool, size, min, max);
+    if (pool)
+      gst_object_unref (pool);
+  }
+
   if (allocator)
     gst_object_unref (allocator);
 
@@ -2398,6 +2568,18 @@ gst_audio_decoder_get_property (GObject * object, guint prop_id,
     case PROP_PLC:
       g_value_set_boolean (value, dec->priv->plc);
       break;
+    case PROP_STATS:
+      GST_OBJECT_LOCK (dec);
+      g_value_take_boxed (value,
+          audio_codec_stats_to_structure (&dec->priv->stats,
+              "GstAudioDecoderStats", dec->priv->frames.length));
+      GST_OBJECT_UNLOCK (dec);
+      break;
+    case PROP_STATS_INTERVAL:
+      GST_OBJECT_LOCK (dec);
+      g_value_set_uint64 (value, dec->priv->stats.interval);
+      GST_OBJECT_UNLOCK (dec);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2422,6 +2604,11 @@ gst_audio_decoder_set_property (GObject * object, guint prop_id,
     case PROP_PLC:
       dec->priv->plc = g_value_get_boolean (value);
       break;
+    case PROP_STATS_INTERVAL:
+      GST_OBJECT_LOCK (dec);
+      dec->priv->stats.interval = g_value_get_uint64 (value);
+      GST_OBJECT_UNLOCK (dec);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2446,6 +2633,9 @@ gst_audio_decoder_change_state (GstElement * element, GstStateChange transition)
       }
       break;
     case GST_STATE_CHANGE_READY_TO_PAUSED:
+      GST_OBJECT_LOCK (codec);
+      audio_codec_stats_reset (&codec->priv->stats);
+      GST_OBJECT_UNLOCK (codec);
       if (!gst_audio_decoder_start (codec)) {
         goto start_failed;
       }
@@ -2970,7 +3160,10 @@ gst_audio_decoder_merge_tags (GstAudioDecoder * dec,
  * @size: size of the buffer
  *
  * Helper function that allocates a buffer to hold an audio frame
- * for @dec's current output format.
+ * for @dec's current output format. When downstream provided a buffer pool
+ * with big enough buffers, the buffer is taken from that pool so the
+ * subclass can decode directly into downstream memory. If all buffers of
+ * the pool are in use, a new buffer is allocated instead of waiting.
  *
  * Returns: (transfer full): allocated buffer
  */
@@ -2994,6 +3187,22 @@ gst_audio_decoder_allocate_output_buffer (GstAudioDecoder * dec, gsize size)
     }
   }
 
+  if (dec->priv->ctx.pool && size <= dec->priv->ctx.pool_size) {
+    GstBufferPoolAcquireParams acquire_params = { 0, };
+
+    /* never wait for downstream to release a buffer here, the stream lock
+     * is held and a flush could not unblock us */
+    acquire_params.flags = GST_BUFFER_POOL_ACQUIRE_FLAG_DONTWAIT;
+    if (gst_buffer_pool_acquire_buffer (dec->priv->ctx.pool, &buffer,
+            &acquire_params) == GST_FLOW_OK) {
+      gst_buffer_resize (buffer, 0, size);
+      GST_AUDIO_DECODER_STREAM_UNLOCK (dec);
+      return buffer;
+    }
+    GST_DEBUG_OBJECT (dec, "no free buffer in pool, allocating one");
+    buffer = NULL;
+  }
+
   buffer =
       gst_buffer_new_allocate (dec->priv->ctx.allocator, size,
       &dec->priv->ctx.params);
@@ -59,6 +59,9 @@
  *     <listitem><para>
  *       Base class gathers input sample data (as directed by the context's
  *       frame_samples and frame_max) and provides this to subclass' @handle_frame.
+ *       The data is passed as sub-buffers of the input buffers, which are only
+ *       merged when a frame spans several of them. With fixed size frames the
+ *       default @propose_allocation suggests upstream buffers of whole frames.
  *     </para></listitem>
  *     <listitem><para>
  *       If codec processing results in encoded data, subclass should call
@@ -94,6 +97,18 @@
  * is typically when base class calls subclass' @set_format function, though
  * it might be delayed until calling @gst_audio_encoder_finish_frame.
  *
+ * Subclasses of codecs that carry no state from one frame to the next can
+ * declare so with gst_audio_encoder_set_frame_independent().  With
+ * #GstAudioEncoder:n-threads set to more than one, base class then hands
+ * several frames at once to @handle_frame from a pool of worker threads.
+ * The encoded data these calls provide to gst_audio_encoder_finish_frame()
+ * is collected and finished in input order afterwards, so output ordering
+ * and timestamps are just as in sequential operation.  In this mode,
+ * @handle_frame should only use the provided buffer and subclass state
+ * that is not modified while encoding, and not call any other base class
+ * API than gst_audio_encoder_finish_frame() and
+ * gst_audio_encoder_allocate_output_buffer().
+ *
  * In summary, above process should have subclass concentrating on
  * codec data processing while leaving other matters to base class,
  * such as most notably timestamp handling.  While it may exert more control
@@ -152,6 +167,7 @@
 #endif
 
 #include "gstaudioencoder.h"
+#include "audio-codec-stats.h"
 #include <gst/base/gstadapter.h>
 #include <gst/audio/audio.h>
 #include <gst/pbutils/descriptions.h>
@@ -173,7 +189,10 @@ enum
   PROP_PERFECT_TS,
   PROP_GRANULE,
   PROP_HARD_RESYNC,
-  PROP_TOLERANCE
+  PROP_TOLERANCE,
+  PROP_N_THREADS,
+  PROP_STATS,
+  PROP_STATS_INTERVAL
 };
 
 #define DEFAULT_PERFECT_TS   FALSE
@@ -182,6 +201,8 @@ enum
 #define DEFAULT_TOLERANCE    40000000
 #define DEFAULT_HARD_MIN     FALSE
 #define DEFAULT_DRAINABLE    TRUE
+#define DEFAULT_N_THREADS    1
+#define DEFAULT_STATS_INTERVAL 0
 
 typedef struct _GstAudioEncoderContext
 {
@@ -208,6 +229,28 @@ typedef struct _GstAudioEncoderContext
   GstAllocationParams params;
 } GstAudioEncoderContext;
 
+/* a frame encoded by a worker thread and what it provided to
+ * gst_audio_encoder_finish_frame() */
+typedef struct
+{
+  GstAudioEncoder *enc;
+  GstBuffer *buffer;
+  /* samples of buffer not yet claimed by finish_frame */
+  gint samples;
+  /* queue of GstAudioEncoderResult */
+  GQueue results;
+  GstFlowReturn ret;
+} GstAudioEncoderTask;
+
+typedef struct
+{
+  GstBuffer *buffer;
+  gint samples;
+} GstAudioEncoderResult;
+
+/* task the current thread is encoding, if any */
+static GPrivate current_task = G_PRIVATE_INIT (NULL);
+
 struct _GstAudioEncoderPrivate
 {
   /* activation status */
@@ -224,6 +267,10 @@ struct _GstAudioEncoderPrivate
 
   /* currently collected sample data */
   GstAdapter *adapter;
+  /* the buffers in adapter, frames are handed out as sub-buffers of these */
+  GQueue inbufs;
+  /* bytes of the head of inbufs already flushed from adapter */
+  gsize inbufs_skip;
   /* offset in adapter up to which already supplied to encoder */
   gint offset;
   /* mark outgoing discont */
@@ -256,12 +303,27 @@ struct _GstAudioEncoderPrivate
   gboolean granule;
   gboolean hard_min;
   gboolean drainable;
+  gboolean frame_independent;
+  guint n_threads;
+
+  /* parallel encoding of independent frames */
+  GThreadPool *pool;
+  GstAudioEncoderTask *tasks;
+  guint n_tasks;
+  guint n_pending;
+  GMutex tasks_lock;
+  GCond tasks_cond;
 
   /* pending tags */
   GstTagList *tags;
   gboolean tags_changed;
   /* pending serialized sink events, will be sent from finish_frame() */
   GList *pending_events;
+
+  /* OBJECT_LOCK */
+  AudioCodecStats stats;
+  /* time spent pushing downstream from within handle_frame, in us */
+  gint64 push_time;
 };
 
 
@@ -305,6 +367,9 @@ gst_audio_encoder_get_type (void)
 
 static void gst_audio_encoder_finalize (GObject * object);
 static void gst_audio_encoder_reset (GstAudioEncoder * enc, gboolean full);
+static void gst_audio_encoder_inbufs_clear (GstAudioEncoderPrivate * priv);
+static void gst_audio_encoder_inbufs_flush (GstAudioEncoderPrivate * priv,
+    gsize flush);
 
 static void gst_audio_encoder_set_property (GObject * object,
     guint prop_id, const GValue * value, GParamSpec * pspec);
@@ -380,6 +445,75 @@ gst_audio_encoder_class_init (GstAudioEncoderClass * klass)
           "Consider discontinuity if timestamp jitter/imperfection exceeds tolerance (ns)",
           0, G_MAXINT64, DEFAULT_TOLERANCE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstAudioEncoder:n-threads:
+   *
+   * Number of frames to encode in parallel, 0 uses the number of
+   * processors.  Base class only makes use of it if the subclass declared
+   * its frames independent with gst_audio_encoder_set_frame_independent()
+   * and uses a fixed frame size, subclasses may also use it for their own
+   * parallel encoding.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Number of frames to encode in parallel, 0 for the number of "
+          "processors", 0, G_MAXINT, DEFAULT_N_THREADS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioEncoder:stats:
+   *
+   * Statistics of the encoder since it was started, in a structure named
+   * "GstAudioEncoderStats" with the following fields:
+   *
+   * "processed" G_TYPE_UINT64: handle_frame calls
+   *
+   * "pushed" G_TYPE_UINT64: encoded buffers pushed downstream
+   *
+   * "dropped" G_TYPE_UINT64: finished input that produced no output
+   *
+   * "in-flight" G_TYPE_UINT: bytes of input waiting to be encoded
+   *
+   * "processing-time" G_TYPE_UINT64: total time spent in the handle_frame
+   * vmethod in nanoseconds, without the time spent pushing downstream. With
+   * #GstAudioEncoder:n-threads this is the sum of all threads.
+   *
+   * "max-processing-time" G_TYPE_UINT64: longest handle_frame call in
+   * nanoseconds
+   *
+   * "processing-histogram" #GstValueArray of G_TYPE_UINT64: number of
+   * handle_frame calls that took less than 1, 2, 4, 8, 16, 32 and 64
+   * milliseconds and longer
+   *
+   * "average-latency" G_TYPE_UINT64: average time between the arrival of
+   * the input and pushing the data encoded from it in nanoseconds
+   *
+   * "max-latency" G_TYPE_UINT64: longest time between the arrival of the
+   * input and pushing the data encoded from it in nanoseconds
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS,
+      g_param_spec_boxed ("stats", "Statistics",
+          "Statistics of the encoder since it was started",
+          GST_TYPE_STRUCTURE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioEncoder:stats-interval:
+   *
+   * Interval in nanoseconds at which the #GstAudioEncoder:stats are posted
+   * as an element message on the bus while data is pushed, 0 disables the
+   * messages.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS_INTERVAL,
+      g_param_spec_uint64 ("stats-interval", "Stats Interval",
+          "Interval for posting the stats on the bus in nanoseconds "
+          "(0 = disabled)", 0, G_MAXUINT64, DEFAULT_STATS_INTERVAL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_audio_encoder_change_state);
@@ -432,6 +566,7 @@ gst_audio_encoder_init (GstAudioEncoder * enc, GstAudioEncoderClass * bclass)
   GST_DEBUG_OBJECT (enc, "src created");
 
   enc->priv->adapter = gst_adapter_new ();
+  audio_codec_stats_init (&enc->priv->stats);
 
   g_rec_mutex_init (&enc->stream_lock);
 
@@ -442,6 +577,11 @@ gst_audio_encoder_init (GstAudioEncoder * enc, GstAudioEncoderClass * bclass)
   enc->priv->tolerance = DEFAULT_TOLERANCE;
   enc->priv->hard_min = DEFAULT_HARD_MIN;
   enc->priv->drainable = DEFAULT_DRAINABLE;
+  enc->priv->n_threads = DEFAULT_N_THREADS;
+
+  g_mutex_init (&enc->priv->tasks_lock);
+  g_cond_init (&enc->priv->tasks_cond);
+  enc->priv->n_tasks = 1;
 
   /* init state */
   gst_audio_encoder_reset (enc, TRUE);
@@ -489,6 +629,10 @@ gst_audio_encoder_reset (GstAudioEncoder * enc, gboolean full)
   gst_segment_init (&enc->output_segment, GST_FORMAT_TIME);
 
   gst_adapter_clear (enc->priv->adapter);
+  gst_audio_encoder_inbufs_clear (enc->priv);
+  GST_OBJECT_LOCK (enc);
+  audio_codec_stats_clear_input (&enc->priv->stats);
+  GST_OBJECT_UNLOCK (enc);
   enc->priv->got_data = FALSE;
   enc->priv->drained = TRUE;
   enc->priv->offset = 0;
@@ -506,6 +650,14 @@ gst_audio_encoder_finalize (GObject * object)
   GstAudioEncoder *enc = GST_AUDIO_ENCODER (object);
 
   g_object_unref (enc->priv->adapter);
+  gst_audio_encoder_inbufs_clear (enc->priv);
+  audio_codec_stats_free (&enc->priv->stats);
+
+  if (enc->priv->pool)
+    g_thread_pool_free (enc->priv->pool, FALSE, TRUE);
+  g_free (enc->priv->tasks);
+  g_mutex_clear (&enc->priv->tasks_lock);
+  g_cond_clear (&enc->priv->tasks_cond);
 
   g_rec_mutex_clear (&enc->stream_lock);
 
@@ -525,6 +677,12 @@ gst_audio_encoder_change_state (GstElement * element, GstStateChange transition)
         if (!klass->open (enc))
           goto open_failed;
       }
+      break;
+    case GST_STATE_CHANGE_READY_TO_PAUSED:
+      GST_OBJECT_LOCK (enc);
+      audio_codec_stats_reset (&enc->priv->stats);
+      GST_OBJECT_UNLOCK (enc);
+      break;
     default:
       break;
   }
@@ -604,7 +762,10 @@ gst_audio_encoder_finish_frame (GstAudioEncoder * enc, GstBuffer * buf,
   GstAudioEncoderClass *klass;
   GstAudioEncoderPrivate *priv;
   GstAudioEncoderContext *ctx;
+  GstAudioEncoderTask *task;
   GstFlowReturn ret = GST_FLOW_OK;
+  GstStructure *stats = NULL;
+  gint64 arrival = 0, push_start;
 
   klass = GST_AUDIO_ENCODER_GET_CLASS (enc);
   priv = enc->priv;
@@ -614,6 +775,22 @@ gst_audio_encoder_finish_frame (GstAudioEncoder * enc, GstBuffer * buf,
   g_return_val_if_fail (buf == NULL || gst_buffer_get_size (buf) > 0,
       GST_FLOW_ERROR);
 
+  /* encoding in parallel, keep for finishing in order later on */
+  task = g_private_get (&current_task);
+  if (G_UNLIKELY (task && task->enc == enc)) {
+    GstAudioEncoderResult *result = g_slice_new (GstAudioEncoderResult);
+
+    if (samples < 0)
+      samples = task->samples;
+    task->samples = MAX (task->samples - samples, 0);
+
+    result->buffer = buf;
+    result->samples = samples;
+    g_queue_push_tail (&task->results, result);
+
+    return GST_FLOW_OK;
+  }
+
   /* subclass should know what it is producing by now */
   if (!ctx->caps)
     goto no_caps;
@@ -679,6 +856,11 @@ gst_audio_encoder_finish_frame (GstAudioEncoder * enc, GstBuffer * buf,
     samples = (enc->priv->offset / ctx->info.bpf);
 
   if (G_LIKELY (samples)) {
+    GST_OBJECT_LOCK (enc);
+    arrival = audio_codec_stats_take_input (&priv->stats,
+        samples * ctx->info.bpf);
+    GST_OBJECT_UNLOCK (enc);
+
     /* track upstream ts if so configured */
     if (!enc->priv->perfect_ts) {
       guint64 ts, distance;
@@ -730,17 +912,23 @@ gst_audio_encoder_finish_frame (GstAudioEncoder * enc, GstBuffer * buf,
         goto overflow;
       } else {
         priv->offset = 0;
-        if (samples * ctx->info.bpf >= gst_adapter_available (priv->adapter))
+        if (samples * ctx->info.bpf >= gst_adapter_available (priv->adapter)) {
           gst_adapter_clear (priv->adapter);
-        else
+          gst_audio_encoder_inbufs_clear (priv);
+        } else {
           gst_adapter_flush (priv->adapter, samples * ctx->info.bpf);
+          gst_audio_encoder_inbufs_flush (priv, samples * ctx->info.bpf);
+        }
       }
     } else {
       gst_adapter_flush (priv->adapter, samples * ctx->info.bpf);
+      gst_audio_encoder_inbufs_flush (priv, samples * ctx->info.bpf);
       priv->offset -= samples * ctx->info.bpf;
       /* avoid subsequent stray prev_ts */
-      if (G_UNLIKELY (gst_adapter_available (priv->adapter) == 0))
+      if (G_UNLIKELY (gst_adapter_available (priv->adapter) == 0)) {
         gst_adapter_clear (priv->adapter);
+        gst_audio_encoder_inbufs_clear (priv);
+      }
     }
     /* sample count advanced below after buffer handling */
   }
@@ -779,7 +967,9 @@ gst_audio_encoder_finish_frame (GstAudioEncoder * enc, GstBuffer * buf,
 
         priv->bytes_out += size;
 
+        push_start = g_get_monotonic_time ();
         gst_pad_push (enc->srcpad, tmpbuf);
+        priv->push_time += g_get_monotonic_time () - push_start;
       }
       priv->ctx.new_headers = FALSE;
     }
@@ -852,11 +1042,30 @@ gst_audio_encoder_finish_frame (GstAudioEncoder * enc, GstBuffer * buf,
         GST_TIME_ARGS (GST_BUFFER_TIMESTAMP (buf)),
         GST_TIME_ARGS (GST_BUFFER_DURATION (buf)));
 
+    GST_OBJECT_LOCK (enc);
+    audio_codec_stats_add_pushed (&priv->stats, arrival);
+    if (audio_codec_stats_need_post (&priv->stats))
+      stats = audio_codec_stats_to_structure (&priv->stats,
+          "GstAudioEncoderStats",
+          priv->stats.units_in - priv->stats.units_out);
+    GST_OBJECT_UNLOCK (enc);
+
+    if (stats)
+      gst_element_post_message (GST_ELEMENT_CAST (enc),
+          gst_message_new_element (GST_OBJECT_CAST (enc), stats));
+
+    push_start = g_get_monotonic_time ();
     ret = gst_pad_push (enc->srcpad, buf);
+    priv->push_time += g_get_monotonic_time () - push_start;
     GST_LOG_OBJECT (enc, "buffer pushed: %s", gst_flow_get_name (ret));
   } else {
     /* merely advance samples, most work for that already done above */
     priv->samples += samples;
+    if (samples) {
+      GST_OBJECT_LOCK (enc);
+      priv->stats.dropped++;
+      GST_OBJECT_UNLOCK (enc);
+    }
   }
 
 exit:
@@ -884,6 +1093,205 @@ overflow:
   }
 }
 
+static void
+gst_audio_encoder_run_task (GstAudioEncoder * enc, GstAudioEncoderTask * task)
+{
+  GstAudioEncoderClass *klass = GST_AUDIO_ENCODER_GET_CLASS (enc);
+  gint64 start;
+
+  /* nothing is pushed from a task, finish_frame() keeps the results */
+  g_private_set (&current_task, task);
+  start = g_get_monotonic_time ();
+  task->ret = klass->handle_frame (enc, task->buffer);
+  g_private_set (&current_task, NULL);
+
+  GST_OBJECT_LOCK (enc);
+  audio_codec_stats_add_processed (&enc->priv->stats, start);
+  GST_OBJECT_UNLOCK (enc);
+}
+
+static void
+gst_audio_encoder_pool_func (gpointer data, gpointer user_data)
+{
+  GstAudioEncoder *enc = user_data;
+
+  gst_audio_encoder_run_task (enc, data);
+
+  g_mutex_lock (&enc->priv->tasks_lock);
+  if (--enc->priv->n_pending == 0)
+    g_cond_signal (&enc->priv->tasks_cond);
+  g_mutex_unlock (&enc->priv->tasks_lock);
+}
+
+/* (re)create the worker pool if n-threads changed,
+ * the streaming thread encodes the first frame of a batch itself */
+static void
+gst_audio_encoder_update_threads (GstAudioEncoder * enc)
+{
+  GstAudioEncoderPrivate *priv = enc->priv;
+  guint n_threads;
+
+  GST_OBJECT_LOCK (enc);
+  n_threads = priv->frame_independent ? priv->n_threads : 1;
+  GST_OBJECT_UNLOCK (enc);
+
+  if (n_threads == 0) {
+#if GLIB_CHECK_VERSION(2,36,0)
+    n_threads = g_get_num_processors ();
+#else
+    n_threads = 1;
+#endif
+  }
+
+  if (n_threads == priv->n_tasks)
+    return;
+
+  if (priv->pool) {
+    g_thread_pool_free (priv->pool, FALSE, TRUE);
+    priv->pool = NULL;
+  }
+  g_free (priv->tasks);
+  priv->tasks = NULL;
+  priv->n_tasks = 1;
+
+  if (n_threads == 1)
+    return;
+
+  priv->pool = g_thread_pool_new (gst_audio_encoder_pool_func, enc,
+      n_threads - 1, FALSE, NULL);
+  if (priv->pool == NULL) {
+    GST_WARNING_OBJECT (enc, "could not create thread pool, using 1 thread");
+    return;
+  }
+  priv->tasks = g_new0 (GstAudioEncoderTask, n_threads);
+  priv->n_tasks = n_threads;
+
+  GST_DEBUG_OBJECT (enc, "encoding up to %u frames in parallel", n_threads);
+}
+
+/* inbufs mirrors the buffers in the adapter */
+static void
+gst_audio_encoder_inbufs_clear (GstAudioEncoderPrivate * priv)
+{
+  GstBuffer *buf;
+
+  while ((buf = g_queue_pop_head (&priv->inbufs)))
+    gst_buffer_unref (buf);
+  priv->inbufs_skip = 0;
+}
+
+static void
+gst_audio_encoder_inbufs_flush (GstAudioEncoderPrivate * priv, gsize flush)
+{
+  GstBuffer *buf;
+  gsize left;
+
+  while (flush > 0 && (buf = g_queue_peek_head (&priv->inbufs))) {
+    left = gst_buffer_get_size (buf) - priv->inbufs_skip;
+    if (flush < left) {
+      priv->inbufs_skip += flush;
+      break;
+    }
+    flush -= left;
+    gst_buffer_unref (g_queue_pop_head (&priv->inbufs));
+    priv->inbufs_skip = 0;
+  }
+}
+
+/* @size bytes at @offset in the adapter, as a sub-buffer of the input buffer
+ * that contains them. Only frames spanning input buffers consist of several
+ * memories, which get merged when mapped. */
+static GstBuffer *
+gst_audio_encoder_get_input (GstAudioEncoderPrivate * priv, gsize offset,
+    gsize size)
+{
+  GstBuffer *result = NULL, *buf, *sub;
+  GList *walk;
+  gsize bsize, len;
+
+  offset += priv->inbufs_skip;
+  for (walk = priv->inbufs.head; walk && size > 0; walk = walk->next) {
+    buf = walk->data;
+    bsize = gst_buffer_get_size (buf);
+    if (offset >= bsize) {
+      offset -= bsize;
+      continue;
+    }
+
+    len = MIN (bsize - offset, size);
+    sub = gst_buffer_copy_region (buf, GST_BUFFER_COPY_MEMORY, offset, len);
+    result = result ? gst_buffer_append (result, sub) : sub;
+    offset = 0;
+    size -= len;
+  }
+  g_assert (size == 0);
+
+  return result;
+}
+
+/* encode @n_frames of @size bytes following the already supplied data in
+ * parallel, then finish whatever the subclass provided in input order */
+static GstFlowReturn
+gst_audio_encoder_encode_parallel (GstAudioEncoder * enc, gint size,
+    guint n_frames)
+{
+  GstAudioEncoderPrivate *priv = enc->priv;
+  GstFlowReturn ret = GST_FLOW_OK;
+  gint bpf = priv->ctx.info.bpf;
+  guint i;
+
+  GST_LOG_OBJECT (enc, "providing subclass with %u frames of %d bytes "
+      "at offset %d", n_frames, size, priv->offset);
+
+  for (i = 0; i < n_frames; i++) {
+    GstAudioEncoderTask *task = &priv->tasks[i];
+
+    task->enc = enc;
+    task->buffer =
+        gst_audio_encoder_get_input (priv, priv->offset + i * size, size);
+    task->samples = size / bpf;
+    task->ret = GST_FLOW_OK;
+    g_queue_init (&task->results);
+  }
+
+  priv->n_pending = n_frames - 1;
+  for (i = 1; i < n_frames; i++)
+    g_thread_pool_push (priv->pool, &priv->tasks[i], NULL);
+
+  gst_audio_encoder_run_task (enc, &priv->tasks[0]);
+
+  g_mutex_lock (&priv->tasks_lock);
+  while (priv->n_pending > 0)
+    g_cond_wait (&priv->tasks_cond, &priv->tasks_lock);
+  g_mutex_unlock (&priv->tasks_lock);
+
+  for (i = 0; i < n_frames; i++)
+    gst_buffer_unref (priv->tasks[i].buffer);
+
+  /* mark all of it consumed, finish_frame takes it out again */
+  priv->offset += n_frames * size;
+  priv->samples_in += n_frames * size / bpf;
+  priv->got_data = FALSE;
+
+  for (i = 0; i < n_frames; i++) {
+    GstAudioEncoderTask *task = &priv->tasks[i];
+    GstAudioEncoderResult *result;
+
+    while ((result = g_queue_pop_head (&task->results))) {
+      if (ret == GST_FLOW_OK)
+        ret = gst_audio_encoder_finish_frame (enc, result->buffer,
+            result->samples);
+      else if (result->buffer)
+        gst_buffer_unref (result->buffer);
+      g_slice_free (GstAudioEncoderResult, result);
+    }
+    if (ret == GST_FLOW_OK)
+      ret = task->ret;
+  }
+
+  return ret;
+}
+
  /* adapter tracking idea:
   * - start of adapter corresponds with what has already been encoded
   * (i.e. really returned by encoder subclass)
@@ -905,6 +1313,8 @@ gst_audio_encoder_push_buffers (GstAudioEncoder * enc, gboolean force)
   priv = enc->priv;
   ctx = &enc->priv->ctx;
 
+  gst_audio_encoder_update_threads (enc);
+
   while (ret == GST_FLOW_OK) {
 
     buf = NULL;
@@ -934,6 +1344,20 @@ gst_audio_encoder_push_buffers (GstAudioEncoder * enc, gboolean force)
       need = MIN (av, ctx->frame_samples_max * ctx->info.bpf);
 
     if (ctx->frame_samples_min == ctx->frame_samples_max) {
+      /* several complete frames available, split them in batches of equal
+       * size and encode those in parallel */
+      if (priv->n_tasks > 1 && !priv->force && need > 0 && av / need > 1) {
+        guint n_frames = av / need, per_task;
+
+        per_task = MAX (n_frames / priv->n_tasks, 1);
+        if (ctx->frame_max > 0)
+          per_task = MIN (per_task, ctx->frame_max);
+
+        ret = gst_audio_encoder_encode_parallel (enc, need * per_task,
+            MIN (priv->n_tasks, n_frames / per_task));
+        continue;
+      }
+
       /* if we have some extra metadata,
        * provide for integer multiple of frames to allow for better granularity
        * of processing */
@@ -947,12 +1371,7 @@ gst_audio_encoder_push_buffers (GstAudioEncoder * enc, gboolean force)
 
     priv->got_data = FALSE;
     if (G_LIKELY (need)) {
-      const guint8 *data;
-
-      data = gst_adapter_map (priv->adapter, priv->offset + need);
-      buf =
-          gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
-          (gpointer) data, priv->offset + need, priv->offset, need, NULL, NULL);
+      buf = gst_audio_encoder_get_input (priv, priv->offset, need);
     } else if (!priv->drainable) {
       GST_DEBUG_OBJECT (enc, "non-drainable and no more data");
       goto finish;
@@ -972,13 +1391,19 @@ gst_audio_encoder_push_buffers (GstAudioEncoder * enc, gboolean force)
       GST_DEBUG_OBJECT (enc, "bypassing subclass with leftover");
       ret = gst_audio_encoder_finish_frame (enc, NULL, -1);
     } else {
+      gint64 start;
+
+      priv->push_time = 0;
+      start = g_get_monotonic_time ();
       ret = klass->handle_frame (enc, buf);
+
+      GST_OBJECT_LOCK (enc);
+      audio_codec_stats_add_processed (&priv->stats, start + priv->push_time);
+      GST_OBJECT_UNLOCK (enc);
     }
 
-    if (G_LIKELY (buf)) {
+    if (G_LIKELY (buf))
       gst_buffer_unref (buf);
-      gst_adapter_unmap (priv->adapter);
-    }
 
   finish:
     /* no data to feed, no leftover provided, then bail out */
@@ -1187,6 +1612,11 @@ gst_audio_encoder_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
     }
   }
 
+  GST_OBJECT_LOCK (enc);
+  audio_codec_stats_add_input (&priv->stats, gst_buffer_get_size (buffer));
+  GST_OBJECT_UNLOCK (enc);
+
+  g_queue_push_tail (&enc->priv->inbufs, gst_buffer_ref (buffer));
   gst_adapter_push (enc->priv->adapter, buffer);
   /* new stuff, so we can push subclass again */
   enc->priv->drained = FALSE;
@@ -1709,6 +2139,23 @@ static gboolean
 gst_audio_encoder_propose_allocation_default (GstAudioEncoder * enc,
     GstQuery * query)
 {
+  GstAudioEncoderContext *ctx = &enc->priv->ctx;
+  guint size;
+
+  /* with fixed size frames, ask for buffers of whole frames so that
+   * handle_frame gets plain sub-buffers of the input */
+  if (ctx->frame_samples_min > 0 &&
+      ctx->frame_samples_min == ctx->frame_samples_max &&
+      GST_AUDIO_INFO_BPF (&ctx->info) > 0 &&
+      gst_query_get_n_allocation_pools (query) == 0) {
+    size = ctx->frame_samples_min * GST_AUDIO_INFO_BPF (&ctx->info);
+    if (ctx->frame_max > 1)
+      size *= ctx->frame_max;
+
+    GST_DEBUG_OBJECT (enc, "proposing buffers of %u bytes", size);
+    gst_query_add_allocation_pool (query, NULL, size, 0, 0);
+  }
+
   return TRUE;
 }
 
@@ -1914,6 +2361,16 @@ gst_audio_encoder_set_property (GObject * object, guint prop_id,
     case PROP_TOLERANCE:
       enc->priv->tolerance = g_value_get_int64 (value);
       break;
+    case PROP_STATS_INTERVAL:
+      GST_OBJECT_LOCK (enc);
+      enc->priv->stats.interval = g_value_get_uint64 (value);
+      GST_OBJECT_UNLOCK (enc);
+      break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (enc);
+      enc->priv->n_threads = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (enc);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1941,6 +2398,24 @@ gst_audio_encoder_get_property (GObject * object, guint prop_id,
     case PROP_TOLERANCE:
       g_value_set_int64 (value, enc->priv->tolerance);
       break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (enc);
+      g_value_set_uint (value, enc->priv->n_threads);
+      GST_OBJECT_UNLOCK (enc);
+      break;
+    case PROP_STATS:
+      GST_OBJECT_LOCK (enc);
+      g_value_take_boxed (value,
+          audio_codec_stats_to_structure (&enc->priv->stats,
+              "GstAudioEncoderStats",
+              enc->priv->stats.units_in - enc->priv->stats.units_out));
+      GST_OBJECT_UNLOCK (enc);
+      break;
+    case PROP_STATS_INTERVAL:
+      GST_OBJECT_LOCK (enc);
+      g_value_set_uint64 (value, enc->priv->stats.interval);
+      GST_OBJECT_UNLOCK (enc);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2489,6 +2964,57 @@ gst_audio_encoder_get_drainable (GstAudioEncoder * enc)
   return result;
 }
 
+/**
+ * gst_audio_encoder_set_frame_independent:
+ * @enc: a #GstAudioEncoder
+ * @enabled: new state
+ *
+ * Configures whether subclass encodes each frame independently of any
+ * other frame.  If so, and #GstAudioEncoder:n-threads allows for it,
+ * @handle_frame might be called concurrently for consecutive frames,
+ * see the class documentation for the restrictions in that case.
+ *
+ * MT safe.
+ *
+ * Since: 1.2
+ */
+void
+gst_audio_encoder_set_frame_independent (GstAudioEncoder * enc,
+    gboolean enabled)
+{
+  g_return_if_fail (GST_IS_AUDIO_ENCODER (enc));
+
+  GST_OBJECT_LOCK (enc);
+  enc->priv->frame_independent = enabled;
+  GST_OBJECT_UNLOCK (enc);
+}
+
+/**
+ * gst_audio_encoder_get_frame_independent:
+ * @enc: a #GstAudioEncoder
+ *
+ * Queries whether subclass declared its frames independent.
+ *
+ * Returns: TRUE if frames may be encoded in parallel.
+ *
+ * MT safe.
+ *
+ * Since: 1.2
+ */
+gboolean
+gst_audio_encoder_get_frame_independent (GstAudioEncoder * enc)
+{
+  gboolean result;
+
+  g_return_val_if_fail (GST_IS_AUDIO_ENCODER (enc), 0);
+
+  GST_OBJECT_LOCK (enc);
+  result = enc->priv->frame_independent;
+  GST_OBJECT_UNLOCK (enc);
+
+  return result;
+}
+
 /**
  * gst_audio_encoder_merge_tags:
  * @enc: a #GstAudioEncoder
@@ -2700,12 +3226,24 @@ refuse_caps:
 GstBuffer *
 gst_audio_encoder_allocate_output_buffer (GstAudioEncoder * enc, gsize size)
 {
+  GstAudioEncoderTask *task;
   GstBuffer *buffer = NULL;
 
   g_return_val_if_fail (size > 0, NULL);
 
   GST_DEBUG ("alloc src buffer");
 
+  /* the streaming thread holds the stream lock while waiting for
+   * parallel encoding, the allocator can't change meanwhile */
+  task = g_private_get (&current_task);
+  if (G_UNLIKELY (task && task->enc == enc)) {
+    buffer = gst_buffer_new_allocate (enc->priv->ctx.allocator, size,
+        &enc->priv->ctx.params);
+    if (!buffer)
+      buffer = gst_buffer_new_allocate (NULL, size, NULL);
+    return buffer;
+  }
+
   GST_AUDIO_ENCODER_STREAM_LOCK (enc);
 
   if (G_UNLIKELY (enc->priv->ctx.output_caps_changed || (enc->priv->ctx.caps
@@ -299,6 +299,11 @@ void            gst_audio_encoder_set_drainable (GstAudioEncoder * enc,
 
 gboolean        gst_audio_encoder_get_drainable (GstAudioEncoder * enc);
 
+void            gst_audio_encoder_set_frame_independent (GstAudioEncoder * enc,
+                                                         gboolean enabled);
+
+gboolean        gst_audio_encoder_get_frame_independent (GstAudioEncoder * enc);
+
 void            gst_audio_encoder_get_allocator (GstAudioEncoder * enc,
                                                  GstAllocator ** allocator,
                                                  GstAllocationParams * params);
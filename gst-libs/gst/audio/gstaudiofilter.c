@@ -37,6 +37,13 @@
  * #GstBaseTransformClass.transform()
  * virtual functions in their class_init function.
  *
+ * Derived classes whose #GstBaseTransformClass.transform() also works when
+ * the input and output buffer are the same can set
+ * #GstAudioFilterClass.transform_in_place_if_writable. Writable buffers are
+ * then transformed in place and the others in one pass into a buffer from
+ * the pool, so that buffers that are still used elsewhere in the pipeline
+ * don't have to be copied before they are processed.
+ *
  * Last reviewed on 2007-02-03 (0.10.11.1)
  */
 
@@ -57,6 +64,8 @@ static gboolean gst_audio_filter_set_caps (GstBaseTransform * btrans,
     GstCaps * incaps, GstCaps * outcaps);
 static gboolean gst_audio_filter_get_unit_size (GstBaseTransform * btrans,
     GstCaps * caps, gsize * size);
+static GstFlowReturn gst_audio_filter_prepare_output_buffer (GstBaseTransform *
+    btrans, GstBuffer * inbuf, GstBuffer ** outbuf);
 
 #define do_init G_STMT_START { \
     GST_DEBUG_CATEGORY_INIT (audiofilter_dbg, "audiofilter", 0, "audiofilter"); \
@@ -76,6 +85,8 @@ gst_audio_filter_class_init (GstAudioFilterClass * klass)
   basetrans_class->set_caps = GST_DEBUG_FUNCPTR (gst_audio_filter_set_caps);
   basetrans_class->get_unit_size =
       GST_DEBUG_FUNCPTR (gst_audio_filter_get_unit_size);
+  basetrans_class->prepare_output_buffer =
+      GST_DEBUG_FUNCPTR (gst_audio_filter_prepare_output_buffer);
 }
 
 static void
@@ -134,6 +145,11 @@ gst_audio_filter_set_caps (GstBaseTransform * btrans, GstCaps * incaps,
   if (ret) {
     filter->info = info;
     GST_LOG_OBJECT (filter, "configured caps: %" GST_PTR_FORMAT, incaps);
+
+    /* always negotiate a pool, prepare_output_buffer() still works in place
+     * on writable buffers */
+    if (klass->transform_in_place_if_writable)
+      gst_base_transform_set_in_place (btrans, FALSE);
   }
 
   return ret;
@@ -160,6 +176,26 @@ gst_audio_filter_get_unit_size (GstBaseTransform * btrans, GstCaps * caps,
   return TRUE;
 }
 
+static GstFlowReturn
+gst_audio_filter_prepare_output_buffer (GstBaseTransform * btrans,
+    GstBuffer * inbuf, GstBuffer ** outbuf)
+{
+  GstAudioFilterClass *klass = GST_AUDIO_FILTER_GET_CLASS (btrans);
+
+  /* transform() is called with the same buffer twice then */
+  if (klass->transform_in_place_if_writable &&
+      !gst_base_transform_is_passthrough (btrans) &&
+      gst_buffer_is_writable (inbuf)) {
+    GST_LOG_OBJECT (btrans, "transforming writable buffer in place");
+    *outbuf = inbuf;
+    return GST_FLOW_OK;
+  }
+
+  return
+      GST_BASE_TRANSFORM_CLASS (gst_audio_filter_parent_class)->
+      prepare_output_buffer (btrans, inbuf, outbuf);
+}
+
 /**
  * gst_audio_filter_class_add_pad_templates:
  * @klass: an #GstAudioFilterClass
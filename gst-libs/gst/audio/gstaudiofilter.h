@@ -74,6 +74,11 @@ struct _GstAudioFilter {
  * GstAudioFilterClass:
  * @basetransformclass: parent class
  * @setup: virtual function called whenever the format changes
+ * @transform_in_place_if_writable: If set to %TRUE,
+ *   GstBaseTransform::transform is called with the input buffer as output
+ *   buffer when it is writable, and with an output buffer from the negotiated
+ *   pool otherwise, instead of copying non-writable buffers before
+ *   GstBaseTransform::transform_ip. Since: 1.2
  *
  * In addition to the @setup virtual function, you should also override the
  * GstBaseTransform::transform and/or GstBaseTransform::transform_ip virtual
@@ -86,8 +91,10 @@ struct _GstAudioFilterClass {
   /* virtual function, called whenever the format changes */
   gboolean  (*setup) (GstAudioFilter * filter, const GstAudioInfo * info);
 
+  gboolean  transform_in_place_if_writable;
+
   /*< private >*/
-  gpointer _gst_reserved[GST_PADDING];
+  gpointer _gst_reserved[GST_PADDING - 1];
 };
 
 GType   gst_audio_filter_get_type (void);
@@ -36,6 +36,7 @@
 
 #include <gst/audio/audio.h>
 #include "gstaudioiec61937.h"
+#include "gstaudiopack.h"
 
 #define IEC61937_HEADER_SIZE      8
 #define IEC61937_PAYLOAD_SIZE_AC3 (1536 * 4)
@@ -340,11 +341,7 @@ gst_audio_iec61937_payload (const guint8 * src, guint src_n, guint8 * dst,
     memcpy (dst + i, src, src_n);
   } else {
     /* Byte-swapped again */
-    /* FIXME: orc-ify this */
-    for (tmp = 1; tmp < src_n; tmp += 2) {
-      dst[i + tmp - 1] = src[tmp];
-      dst[i + tmp] = src[tmp - 1];
-    }
+    audio_orc_swap_u16 (dst + i, src, src_n / 2);
     /* Do we have 1 byte remaining? */
     if (src_n % 2) {
       dst[i + src_n - 1] = 0;
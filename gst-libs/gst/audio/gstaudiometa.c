@@ -181,3 +181,101 @@ gst_audio_downmix_meta_get_info (void)
   }
   return audio_downmix_meta_info;
 }
+
+static gboolean
+gst_audio_clipping_meta_init (GstMeta * meta, gpointer params,
+    GstBuffer * buffer)
+{
+  GstAudioClippingMeta *cmeta = (GstAudioClippingMeta *) meta;
+
+  cmeta->format = GST_FORMAT_UNDEFINED;
+  cmeta->start = cmeta->end = 0;
+
+  return TRUE;
+}
+
+static gboolean
+gst_audio_clipping_meta_transform (GstBuffer * dest, GstMeta * meta,
+    GstBuffer * buffer, GQuark type, gpointer data)
+{
+  GstAudioClippingMeta *smeta;
+
+  if (GST_META_TRANSFORM_IS_COPY (type)) {
+    GstMetaTransformCopy *copy = data;
+
+    /* the clipped amounts are only meaningful for the complete buffer */
+    if (copy->region)
+      return FALSE;
+  } else {
+    /* don't know how to transform */
+    return FALSE;
+  }
+
+  smeta = (GstAudioClippingMeta *) meta;
+  gst_buffer_add_audio_clipping_meta (dest, smeta->format, smeta->start,
+      smeta->end);
+
+  return TRUE;
+}
+
+/**
+ * gst_buffer_add_audio_clipping_meta:
+ * @buffer: a #GstBuffer
+ * @format: GstFormat of @start and @end
+ * @start: Amount of audio to clip from start of buffer
+ * @end: Amount of audio to clip from end of buffer
+ *
+ * Attaches #GstAudioClippingMeta metadata to @buffer with the given
+ * parameters.
+ *
+ * Returns: the #GstAudioClippingMeta on @buffer.
+ *
+ * Since: 1.2
+ */
+GstAudioClippingMeta *
+gst_buffer_add_audio_clipping_meta (GstBuffer * buffer,
+    GstFormat format, guint64 start, guint64 end)
+{
+  GstAudioClippingMeta *meta;
+
+  g_return_val_if_fail (format != GST_FORMAT_UNDEFINED, NULL);
+
+  meta =
+      (GstAudioClippingMeta *) gst_buffer_add_meta (buffer,
+      GST_AUDIO_CLIPPING_META_INFO, NULL);
+
+  meta->format = format;
+  meta->start = start;
+  meta->end = end;
+
+  return meta;
+}
+
+GType
+gst_audio_clipping_meta_api_get_type (void)
+{
+  static volatile GType type;
+  static const gchar *tags[] = { NULL };
+
+  if (g_once_init_enter (&type)) {
+    GType _type = gst_meta_api_type_register ("GstAudioClippingMetaAPI", tags);
+    g_once_init_leave (&type, _type);
+  }
+  return type;
+}
+
+const GstMetaInfo *
+gst_audio_clipping_meta_get_info (void)
+{
+  static const GstMetaInfo *audio_clipping_meta_info = NULL;
+
+  if (g_once_init_enter (&audio_clipping_meta_info)) {
+    const GstMetaInfo *meta =
+        gst_meta_register (GST_AUDIO_CLIPPING_META_API_TYPE,
+        "GstAudioClippingMeta", sizeof (GstAudioClippingMeta),
+        gst_audio_clipping_meta_init, NULL,
+        gst_audio_clipping_meta_transform);
+    g_once_init_leave (&audio_clipping_meta_info, meta);
+  }
+  return audio_clipping_meta_info;
+}
@@ -73,6 +73,42 @@ GstAudioDownmixMeta * gst_buffer_add_audio_downmix_meta (GstBuffer    *buffer,
                                                          gint                           to_channels,
                                                          const gfloat                 **matrix);
 
+#define GST_AUDIO_CLIPPING_META_API_TYPE (gst_audio_clipping_meta_api_get_type())
+#define GST_AUDIO_CLIPPING_META_INFO  (gst_audio_clipping_meta_get_info())
+
+typedef struct _GstAudioClippingMeta GstAudioClippingMeta;
+
+/**
+ * GstAudioClippingMeta:
+ * @meta: parent #GstMeta
+ * @format: GstFormat of @start and @end, GST_FORMAT_DEFAULT is samples
+ * @start: Amount of audio to clip from start of buffer
+ * @end: Amount of audio to clip from end of buffer
+ *
+ * Extra buffer metadata describing how much audio has to be clipped from
+ * the start or end of a buffer. This is used instead of trimming the buffer
+ * data, for example by gst_audio_buffer_clip_with_meta().
+ *
+ * Since: 1.2
+ */
+struct _GstAudioClippingMeta {
+  GstMeta   meta;
+
+  GstFormat format;
+  guint64   start;
+  guint64   end;
+};
+
+GType gst_audio_clipping_meta_api_get_type (void);
+const GstMetaInfo * gst_audio_clipping_meta_get_info (void);
+
+#define gst_buffer_get_audio_clipping_meta(b) ((GstAudioClippingMeta*)gst_buffer_get_meta((b), GST_AUDIO_CLIPPING_META_API_TYPE))
+
+GstAudioClippingMeta * gst_buffer_add_audio_clipping_meta (GstBuffer *buffer,
+                                                           GstFormat  format,
+                                                           guint64    start,
+                                                           guint64    end);
+
 G_END_DECLS
 
 #endif /* __GST_AUDIO_META_H__ */
@@ -1263,10 +1263,13 @@ gst_audio_ring_buffer_clear_all (GstAudioRingBuffer * buf)
 }
 
 
+/* The writer (or reader in capture mode) and the device thread only share
+ * the atomic segdone counter and the waiting flag, the device thread takes
+ * the lock only to signal a waiter. @segdone is the value of buf->segdone the
+ * caller based its decision to wait on. */
 static gboolean
-wait_segment (GstAudioRingBuffer * buf)
+wait_segment (GstAudioRingBuffer * buf, gint segdone)
 {
-  gint segments;
   gboolean wait = TRUE;
 
   /* buffer must be started now or we deadlock since nobody is reading */
@@ -1277,12 +1280,11 @@ wait_segment (GstAudioRingBuffer * buf)
       goto no_start;
 
     GST_DEBUG_OBJECT (buf, "start!");
-    segments = g_atomic_int_get (&buf->segdone);
     gst_audio_ring_buffer_start (buf);
 
     /* After starting, the writer may have wrote segments already and then we
      * don't need to wait anymore */
-    if (G_LIKELY (g_atomic_int_get (&buf->segdone) != segments))
+    if (G_LIKELY (g_atomic_int_get (&buf->segdone) != segdone))
       wait = FALSE;
   }
 
@@ -1296,7 +1298,19 @@ wait_segment (GstAudioRingBuffer * buf)
     goto not_started;
 
   if (G_LIKELY (wait)) {
-    if (g_atomic_int_compare_and_exchange (&buf->waiting, 0, 1)) {
+    /* there is only one waiter, so the flag can only still be set by us when
+     * we woke up spuriously before */
+    g_atomic_int_set (&buf->waiting, 1);
+
+    /* the device thread only signals when it sees the flag. If it advanced
+     * after the caller read segdone and before the flag was set, that wakeup
+     * is lost and we would sleep for a whole segment with a free segment
+     * available, so check again. */
+    if (G_UNLIKELY (g_atomic_int_get (&buf->segdone) != segdone)) {
+      /* if the device thread already took the flag, its signal will come
+       * after we release the lock and nobody is waiting for it anymore */
+      g_atomic_int_compare_and_exchange (&buf->waiting, 1, 0);
+    } else {
       GST_DEBUG_OBJECT (buf, "waiting..");
       GST_AUDIO_RING_BUFFER_WAIT (buf);
 
@@ -1525,7 +1539,7 @@ default_commit (GstAudioRingBuffer * buf, guint64 * sample,
       }
 
       /* else we need to wait for the segment to become writable. */
-      if (!wait_segment (buf))
+      if (!wait_segment (buf, segdone + buf->segbase))
         goto not_started;
     }
 
@@ -1741,7 +1755,7 @@ gst_audio_ring_buffer_read (GstAudioRingBuffer * buf, guint64 sample,
         break;
 
       /* else we need to wait for the segment to become readable. */
-      if (!wait_segment (buf))
+      if (!wait_segment (buf, segdone + buf->segbase))
         goto not_started;
     }
 
@@ -68,13 +68,25 @@
  */
 
 #include <string.h>
+#include <errno.h>
 
 #include <gst/audio/audio.h>
 #include "gstaudiosink.h"
+#include "audio-thread.h"
 
 GST_DEBUG_CATEGORY_STATIC (gst_audio_sink_debug);
 #define GST_CAT_DEFAULT gst_audio_sink_debug
 
+#define GST_AUDIO_SINK_GET_PRIVATE(obj)  \
+   (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GST_TYPE_AUDIO_SINK, GstAudioSinkPrivate))
+
+typedef struct _GstAudioSinkPrivate GstAudioSinkPrivate;
+
+struct _GstAudioSinkPrivate
+{
+  AudioThreadSettings thread;
+};
+
 #define GST_TYPE_AUDIO_SINK_RING_BUFFER        \
         (gst_audio_sink_ring_buffer_get_type())
 #define GST_AUDIO_SINK_RING_BUFFER(obj)        \
@@ -231,6 +243,9 @@ audioringbuffer_thread_func (GstAudioRingBuffer * buf)
   if (writefunc == NULL)
     goto no_function;
 
+  audio_thread_setup (GST_OBJECT_CAST (sink),
+      &GST_AUDIO_SINK_GET_PRIVATE (sink)->thread);
+
   message = gst_message_new_stream_status (GST_OBJECT_CAST (buf),
       GST_STREAM_STATUS_TYPE_ENTER, GST_ELEMENT_CAST (sink));
   g_value_init (&val, GST_TYPE_G_THREAD);
@@ -589,10 +604,7 @@ enum
   LAST_SIGNAL
 };
 
-enum
-{
-  ARG_0,
-};
+/* the thread properties use AUDIO_THREAD_PROP_* */
 
 #define _do_init \
     GST_DEBUG_CATEGORY_INIT (gst_audio_sink_debug, "audiosink", 0, "audiosink element");
@@ -602,14 +614,46 @@ G_DEFINE_TYPE_WITH_CODE (GstAudioSink, gst_audio_sink,
 
 static GstAudioRingBuffer *gst_audio_sink_create_ringbuffer (GstAudioBaseSink *
     sink);
+static void gst_audio_sink_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_audio_sink_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
 
 static void
 gst_audio_sink_class_init (GstAudioSinkClass * klass)
 {
+  GObjectClass *gobject_class;
   GstAudioBaseSinkClass *gstaudiobasesink_class;
 
+  gobject_class = (GObjectClass *) klass;
   gstaudiobasesink_class = (GstAudioBaseSinkClass *) klass;
 
+  g_type_class_add_private (klass, sizeof (GstAudioSinkPrivate));
+
+  gobject_class->set_property = gst_audio_sink_set_property;
+  gobject_class->get_property = gst_audio_sink_get_property;
+
+  /**
+   * GstAudioSink:thread-priority:
+   *
+   * The SCHED_FIFO priority of the thread that writes the audio device,
+   * 0 keeps the default scheduling. When the process is not allowed to use
+   * realtime scheduling, a warning is logged and the thread runs with the
+   * default scheduling.
+   *
+   * Since: 1.2
+   */
+
+  /**
+   * GstAudioSink:thread-cpu:
+   *
+   * The CPU to bind the thread that writes the audio device to, -1 lets
+   * it run on any CPU.
+   *
+   * Since: 1.2
+   */
+  audio_thread_install_properties (gobject_class);
+
   gstaudiobasesink_class->create_ringbuffer =
       GST_DEBUG_FUNCPTR (gst_audio_sink_create_ringbuffer);
 
@@ -619,6 +663,29 @@ gst_audio_sink_class_init (GstAudioSinkClass * klass)
 static void
 gst_audio_sink_init (GstAudioSink * audiosink)
 {
+  GstAudioSinkPrivate *priv = GST_AUDIO_SINK_GET_PRIVATE (audiosink);
+
+  audio_thread_settings_init (&priv->thread);
+}
+
+static void
+gst_audio_sink_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstAudioSinkPrivate *priv = GST_AUDIO_SINK_GET_PRIVATE (object);
+
+  if (!audio_thread_set_property (object, &priv->thread, prop_id, value))
+    G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+}
+
+static void
+gst_audio_sink_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstAudioSinkPrivate *priv = GST_AUDIO_SINK_GET_PRIVATE (object);
+
+  if (!audio_thread_get_property (object, &priv->thread, prop_id, value))
+    G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
 }
 
 static GstAudioRingBuffer *
@@ -68,13 +68,25 @@
  */
 
 #include <string.h>
+#include <errno.h>
 
 #include <gst/audio/audio.h>
 #include "gstaudiosrc.h"
+#include "audio-thread.h"
 
 GST_DEBUG_CATEGORY_STATIC (gst_audio_src_debug);
 #define GST_CAT_DEFAULT gst_audio_src_debug
 
+#define GST_AUDIO_SRC_GET_PRIVATE(obj)  \
+   (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GST_TYPE_AUDIO_SRC, GstAudioSrcPrivate))
+
+typedef struct _GstAudioSrcPrivate GstAudioSrcPrivate;
+
+struct _GstAudioSrcPrivate
+{
+  AudioThreadSettings thread;
+};
+
 #define GST_TYPE_AUDIO_SRC_RING_BUFFER        \
         (gst_audio_src_ring_buffer_get_type())
 #define GST_AUDIO_SRC_RING_BUFFER(obj)        \
@@ -217,6 +229,9 @@ audioringbuffer_thread_func (GstAudioRingBuffer * buf)
   if ((readfunc = csrc->read) == NULL)
     goto no_function;
 
+  audio_thread_setup (GST_OBJECT_CAST (src),
+      &GST_AUDIO_SRC_GET_PRIVATE (src)->thread);
+
   message = gst_message_new_stream_status (GST_OBJECT_CAST (buf),
       GST_STREAM_STATUS_TYPE_ENTER, GST_ELEMENT_CAST (src));
   g_value_init (&val, GST_TYPE_G_THREAD);
@@ -502,10 +517,7 @@ enum
   LAST_SIGNAL
 };
 
-enum
-{
-  ARG_0,
-};
+/* the thread properties use AUDIO_THREAD_PROP_* */
 
 #define _do_init \
     GST_DEBUG_CATEGORY_INIT (gst_audio_src_debug, "audiosrc", 0, "audiosrc element");
@@ -515,14 +527,46 @@ G_DEFINE_TYPE_WITH_CODE (GstAudioSrc, gst_audio_src,
 
 static GstAudioRingBuffer *gst_audio_src_create_ringbuffer (GstAudioBaseSrc *
     src);
+static void gst_audio_src_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_audio_src_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
 
 static void
 gst_audio_src_class_init (GstAudioSrcClass * klass)
 {
+  GObjectClass *gobject_class;
   GstAudioBaseSrcClass *gstaudiobasesrc_class;
 
+  gobject_class = (GObjectClass *) klass;
   gstaudiobasesrc_class = (GstAudioBaseSrcClass *) klass;
 
+  g_type_class_add_private (klass, sizeof (GstAudioSrcPrivate));
+
+  gobject_class->set_property = gst_audio_src_set_property;
+  gobject_class->get_property = gst_audio_src_get_property;
+
+  /**
+   * GstAudioSrc:thread-priority:
+   *
+   * The SCHED_FIFO priority of the thread that reads the audio device,
+   * 0 keeps the default scheduling. When the process is not allowed to use
+   * realtime scheduling, a warning is logged and the thread runs with the
+   * default scheduling.
+   *
+   * Since: 1.2
+   */
+
+  /**
+   * GstAudioSrc:thread-cpu:
+   *
+   * The CPU to bind the thread that reads the audio device to, -1 lets
+   * it run on any CPU.
+   *
+   * Since: 1.2
+   */
+  audio_thread_install_properties (gobject_class);
+
   gstaudiobasesrc_class->create_ringbuffer =
       GST_DEBUG_FUNCPTR (gst_audio_src_create_ringbuffer);
 
@@ -532,6 +576,29 @@ gst_audio_src_class_init (GstAudioSrcClass * klass)
 static void
 gst_audio_src_init (GstAudioSrc * audiosrc)
 {
+  GstAudioSrcPrivate *priv = GST_AUDIO_SRC_GET_PRIVATE (audiosrc);
+
+  audio_thread_settings_init (&priv->thread);
+}
+
+static void
+gst_audio_src_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstAudioSrcPrivate *priv = GST_AUDIO_SRC_GET_PRIVATE (object);
+
+  if (!audio_thread_set_property (object, &priv->thread, prop_id, value))
+    G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+}
+
+static void
+gst_audio_src_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstAudioSrcPrivate *priv = GST_AUDIO_SRC_GET_PRIVATE (object);
+
+  if (!audio_thread_get_property (object, &priv->thread, prop_id, value))
+    G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
 }
 
 static GstAudioRingBuffer *
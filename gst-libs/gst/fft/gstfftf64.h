@@ -53,6 +53,9 @@ void            gst_fft_f64_free        (GstFFTF64 *self);
 
 void            gst_fft_f64_fft         (GstFFTF64 *self, const gdouble *timedata,
                                          GstFFTF64Complex *freqdata);
+void            gst_fft_f64_fft_interleaved (GstFFTF64 *self, const gdouble *timedata,
+                                             gint channels, GstFFTWindow window,
+                                             GstFFTF64Complex *freqdata);
 void            gst_fft_f64_inverse_fft (GstFFTF64 *self, const GstFFTF64Complex *freqdata,
                                          gdouble *timedata);
 
@@ -66,8 +66,53 @@ struct _GstFFTS16
   void *cfg;
   gboolean inverse;
   gint len;
+
+  /* coefficients of the last used window function */
+  GstFFTWindow window;
+  gdouble *window_data;
+
+  /* one de-interleaved channel for gst_fft_s16_fft_interleaved() */
+  gint16 *scratch;
 };
 
+static void
+gst_fft_s16_update_window (GstFFTS16 * self, GstFFTWindow window)
+{
+  gdouble *data;
+  gint i, len;
+
+  len = self->len;
+
+  if (self->window_data == NULL)
+    self->window_data = g_new (gdouble, len);
+  data = self->window_data;
+
+  switch (window) {
+    case GST_FFT_WINDOW_HAMMING:
+      for (i = 0; i < len; i++)
+        data[i] = 0.53836 - 0.46164 * cos (2.0 * G_PI * i / len);
+      break;
+    case GST_FFT_WINDOW_HANN:
+      for (i = 0; i < len; i++)
+        data[i] = 0.5 - 0.5 * cos (2.0 * G_PI * i / len);
+      break;
+    case GST_FFT_WINDOW_BARTLETT:
+      for (i = 0; i < len; i++)
+        data[i] = 1.0 - fabs ((2.0 * i - len) / len);
+      break;
+    case GST_FFT_WINDOW_BLACKMAN:
+      for (i = 0; i < len; i++)
+        data[i] = 0.42 - 0.5 * cos ((2.0 * i) / len) +
+            0.08 * cos ((4.0 * i) / len);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+
+  self->window = window;
+}
+
 /**
  * gst_fft_s16_new:
  * @len: Length of the FFT in the time domain
@@ -133,6 +178,76 @@ gst_fft_s16_fft (GstFFTS16 * self, const gint16 * timedata,
   kiss_fftr_s16 (self->cfg, timedata, (kiss_fft_s16_cpx *) freqdata);
 }
 
+/**
+ * gst_fft_s16_fft_interleaved:
+ * @self: #GstFFTS16 instance for this call
+ * @timedata: Buffer of interleaved samples in the time domain
+ * @channels: Number of channels interleaved in @timedata
+ * @window: Window function to apply to every channel
+ * @freqdata: Target buffer for the samples in the frequency domain
+ *
+ * This applies the window function @window to each of the @channels signals
+ * interleaved in @timedata, performs the FFT on them and puts the results
+ * one after another in @freqdata. Unlike gst_fft_s16_window(), @timedata is
+ * not modified.
+ *
+ * This gives the same results as de-interleaving @timedata and calling
+ * gst_fft_s16_window() and gst_fft_s16_fft() on every channel, but
+ * saves the separate passes over the data.
+ *
+ * @timedata must have @channels times as many samples as specified with the
+ * @len parameter while allocating the #GstFFTS16 instance with
+ * gst_fft_s16_new().
+ *
+ * @freqdata must be large enough to hold @channels * (@len/2 + 1)
+ * #GstFFTS16Complex frequency domain samples, the spectrum of channel c
+ * starts at @freqdata + c * (@len/2 + 1).
+ *
+ * Since: 1.2
+ */
+void
+gst_fft_s16_fft_interleaved (GstFFTS16 * self, const gint16 * timedata,
+    gint channels, GstFFTWindow window, GstFFTS16Complex * freqdata)
+{
+  const gdouble *data = NULL;
+  gint16 *scratch;
+  gint c, i, len;
+
+  g_return_if_fail (self);
+  g_return_if_fail (!self->inverse);
+  g_return_if_fail (timedata);
+  g_return_if_fail (channels > 0);
+  g_return_if_fail (freqdata);
+
+  len = self->len;
+
+  if (window != GST_FFT_WINDOW_RECTANGULAR) {
+    if (self->window_data == NULL || self->window != window)
+      gst_fft_s16_update_window (self, window);
+    data = self->window_data;
+  }
+
+  if (self->scratch == NULL)
+    self->scratch = g_new (gint16, len);
+  scratch = self->scratch;
+
+  for (c = 0; c < channels; c++) {
+    const gint16 *in = timedata + c;
+
+    /* de-interleave and window in one go */
+    if (data) {
+      for (i = 0; i < len; i++, in += channels)
+        scratch[i] = *in * data[i];
+    } else {
+      for (i = 0; i < len; i++, in += channels)
+        scratch[i] = *in;
+    }
+
+    kiss_fftr_s16 (self->cfg, scratch,
+        (kiss_fft_s16_cpx *) freqdata + c * (len / 2 + 1));
+  }
+}
+
 /**
  * gst_fft_s16_inverse_fft:
  * @self: #GstFFTS16 instance for this call
@@ -169,6 +284,8 @@ gst_fft_s16_inverse_fft (GstFFTS16 * self, const GstFFTS16Complex * freqdata,
 void
 gst_fft_s16_free (GstFFTS16 * self)
 {
+  g_free (self->window_data);
+  g_free (self->scratch);
   g_free (self);
 }
 
@@ -184,36 +301,24 @@ gst_fft_s16_free (GstFFTS16 * self)
 void
 gst_fft_s16_window (GstFFTS16 * self, gint16 * timedata, GstFFTWindow window)
 {
+  const gdouble *data;
   gint i, len;
 
   g_return_if_fail (self);
   g_return_if_fail (timedata);
 
+  /* do nothing */
+  if (window == GST_FFT_WINDOW_RECTANGULAR)
+    return;
+
+  /* the window is usually the same for every call, so only evaluate the
+   * window function when it changes */
+  if (self->window_data == NULL || self->window != window)
+    gst_fft_s16_update_window (self, window);
+
   len = self->len;
+  data = self->window_data;
 
-  switch (window) {
-    case GST_FFT_WINDOW_RECTANGULAR:
-      /* do nothing */
-      break;
-    case GST_FFT_WINDOW_HAMMING:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.53836 - 0.46164 * cos (2.0 * G_PI * i / len));
-      break;
-    case GST_FFT_WINDOW_HANN:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.5 - 0.5 * cos (2.0 * G_PI * i / len));
-      break;
-    case GST_FFT_WINDOW_BARTLETT:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (1.0 - fabs ((2.0 * i - len) / len));
-      break;
-    case GST_FFT_WINDOW_BLACKMAN:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.42 - 0.5 * cos ((2.0 * i) / len) +
-            0.08 * cos ((4.0 * i) / len));
-      break;
-    default:
-      g_assert_not_reached ();
-      break;
-  }
+  for (i = 0; i < len; i++)
+    timedata[i] *= data[i];
 }
@@ -53,6 +53,9 @@ void            gst_fft_s16_free        (GstFFTS16 *self);
 
 void            gst_fft_s16_fft         (GstFFTS16 *self, const gint16 *timedata,
                                          GstFFTS16Complex *freqdata);
+void            gst_fft_s16_fft_interleaved (GstFFTS16 *self, const gint16 *timedata,
+                                             gint channels, GstFFTWindow window,
+                                             GstFFTS16Complex *freqdata);
 void            gst_fft_s16_inverse_fft (GstFFTS16 *self, const GstFFTS16Complex *freqdata,
                                          gint16 *timedata);
 
@@ -53,6 +53,9 @@ void            gst_fft_s32_free        (GstFFTS32 *self);
 
 void            gst_fft_s32_fft         (GstFFTS32 *self, const gint32 *timedata,
                                          GstFFTS32Complex *freqdata);
+void            gst_fft_s32_fft_interleaved (GstFFTS32 *self, const gint32 *timedata,
+                                             gint channels, GstFFTWindow window,
+                                             GstFFTS32Complex *freqdata);
 void            gst_fft_s32_inverse_fft (GstFFTS32 *self, const GstFFTS32Complex *freqdata,
                                          gint32 *timedata);
 
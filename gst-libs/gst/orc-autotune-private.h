@@ -0,0 +1,200 @@
+/* GStreamer
+ *
+ * orc-autotune-private.h: pick the faster of an ORC and a C kernel
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_ORC_AUTOTUNE_PRIVATE_H__
+#define __GST_ORC_AUTOTUNE_PRIVATE_H__
+
+#include <string.h>
+#include <gst/gst.h>
+
+G_BEGIN_DECLS
+
+/* Elements with a plain C version of an ORC kernel can use
+ * gst_orc_autotune_use_orc() to find out which of the two is faster on the
+ * CPU they run on, as some ORC backends generate code that is slower than
+ * what the compiler makes of a simple loop.
+ *
+ * Every kernel is measured once per CPU model and release, and the result
+ * is kept in $XDG_CACHE_HOME/gstreamer-1.0/orc-autotune so that other
+ * processes don't need to measure again. Setting GST_ORC_AUTOTUNE to "orc"
+ * or "c" in the environment skips the measurement and always uses that
+ * implementation.
+ *
+ * The caller needs config.h to be included first. */
+
+/* Runs the kernel once on @data, with ORC if @use_orc is TRUE and in C
+ * otherwise. @data must be valid input for repeated runs. */
+typedef void (*GstOrcAutotuneFunc) (gpointer data, gboolean use_orc);
+
+/* best of this many rounds of GST_ORC_AUTOTUNE_CALLS calls */
+#define GST_ORC_AUTOTUNE_ROUNDS 5
+#define GST_ORC_AUTOTUNE_CALLS  32
+
+#ifdef HAVE_ORC
+static GMutex gst_orc_autotune_lock;
+static GHashTable *gst_orc_autotune_results;
+
+/* A name for the CPU, from the first line in /proc/cpuinfo that describes
+ * the model. Different steppings of the same model are treated alike. */
+static gchar *
+gst_orc_autotune_get_cpu (void)
+{
+  static const gchar *keys[] = { "model name", "cpu model", "Processor",
+    "Hardware", "cpu"
+  };
+  gchar *contents = NULL, **lines, *cpu = NULL;
+  gint i, k;
+
+  if (g_file_get_contents ("/proc/cpuinfo", &contents, NULL, NULL)) {
+    lines = g_strsplit (contents, "\n", -1);
+    for (k = 0; k < G_N_ELEMENTS (keys) && cpu == NULL; k++) {
+      for (i = 0; lines[i] && cpu == NULL; i++) {
+        gchar *colon;
+
+        if (!g_str_has_prefix (lines[i], keys[k]))
+          continue;
+        if ((colon = strchr (lines[i], ':')) == NULL)
+          continue;
+        cpu = g_strstrip (g_strdup (colon + 1));
+      }
+    }
+    g_strfreev (lines);
+    g_free (contents);
+  }
+
+  if (cpu == NULL || *cpu == '\0') {
+    g_free (cpu);
+    cpu = g_strdup ("unknown");
+  }
+
+  /* becomes a group name in the key file */
+  g_strdelimit (cpu, "[]\n", '_');
+
+  return cpu;
+}
+
+static gint64
+gst_orc_autotune_measure (GstOrcAutotuneFunc func, gpointer data,
+    gboolean use_orc)
+{
+  gint64 start, elapsed, best = G_MAXINT64;
+  gint i, j;
+
+  /* compiles the ORC code and warms the caches */
+  func (data, use_orc);
+
+  for (i = 0; i < GST_ORC_AUTOTUNE_ROUNDS; i++) {
+    start = g_get_monotonic_time ();
+    for (j = 0; j < GST_ORC_AUTOTUNE_CALLS; j++)
+      func (data, use_orc);
+    elapsed = g_get_monotonic_time () - start;
+    best = MIN (best, elapsed);
+  }
+
+  return best;
+}
+#endif /* HAVE_ORC */
+
+/* Returns TRUE if the ORC version of @kernel is faster than the C version
+ * on this machine, measuring them with @func on @data unless the result is
+ * known already. */
+static gboolean
+gst_orc_autotune_use_orc (const gchar * kernel, GstOrcAutotuneFunc func,
+    gpointer data)
+{
+#ifdef HAVE_ORC
+  const gchar *env;
+  gpointer result;
+  GKeyFile *keyfile;
+  gchar *filename, *cpu, *group, *value;
+  gboolean use_orc;
+
+  env = g_getenv ("GST_ORC_AUTOTUNE");
+  if (env && g_str_equal (env, "orc"))
+    return TRUE;
+  if (env && g_str_equal (env, "c"))
+    return FALSE;
+
+  g_mutex_lock (&gst_orc_autotune_lock);
+  if (gst_orc_autotune_results == NULL)
+    gst_orc_autotune_results = g_hash_table_new (g_str_hash, g_str_equal);
+
+  if (g_hash_table_lookup_extended (gst_orc_autotune_results, kernel, NULL,
+          &result)) {
+    g_mutex_unlock (&gst_orc_autotune_lock);
+    return GPOINTER_TO_INT (result);
+  }
+
+  filename = g_build_filename (g_get_user_cache_dir (),
+      "gstreamer-" GST_API_VERSION, "orc-autotune", NULL);
+  cpu = gst_orc_autotune_get_cpu ();
+  group = g_strdup_printf ("%s %s", cpu, VERSION);
+
+  keyfile = g_key_file_new ();
+  g_key_file_load_from_file (keyfile, filename, G_KEY_FILE_NONE, NULL);
+
+  value = g_key_file_get_string (keyfile, group, kernel, NULL);
+  if (value && (g_str_equal (value, "orc") || g_str_equal (value, "c"))) {
+    use_orc = g_str_equal (value, "orc");
+    GST_DEBUG ("%s: using %s implementation from %s", kernel, value,
+        filename);
+  } else {
+    gint64 orc_time, c_time;
+    gchar *dirname, *contents;
+    gsize length;
+
+    orc_time = gst_orc_autotune_measure (func, data, TRUE);
+    c_time = gst_orc_autotune_measure (func, data, FALSE);
+    use_orc = orc_time <= c_time;
+
+    GST_INFO ("%s: ORC %" G_GINT64_FORMAT "us, C %" G_GINT64_FORMAT
+        "us, using %s", kernel, orc_time, c_time, use_orc ? "ORC" : "C");
+
+    g_key_file_set_string (keyfile, group, kernel, use_orc ? "orc" : "c");
+    contents = g_key_file_to_data (keyfile, &length, NULL);
+    dirname = g_path_get_dirname (filename);
+    if (g_mkdir_with_parents (dirname, 0755) != 0 ||
+        !g_file_set_contents (filename, contents, length, NULL))
+      GST_DEBUG ("could not write %s", filename);
+    g_free (dirname);
+    g_free (contents);
+  }
+
+  g_free (value);
+  g_key_file_free (keyfile);
+  g_free (group);
+  g_free (cpu);
+  g_free (filename);
+
+  /* kernel names are static strings */
+  g_hash_table_insert (gst_orc_autotune_results, (gpointer) kernel,
+      GINT_TO_POINTER (use_orc));
+  g_mutex_unlock (&gst_orc_autotune_lock);
+
+  return use_orc;
+#else
+  /* the "ORC" version is the C backup and there is nothing to compare */
+  return TRUE;
+#endif
+}
+
+G_END_DECLS
+
+#endif /* __GST_ORC_AUTOTUNE_PRIVATE_H__ */
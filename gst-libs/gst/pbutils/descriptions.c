@@ -672,6 +672,28 @@ format_info_get_desc (const FormatInfo * info, const GstCaps * caps)
   return NULL;
 }
 
+/* maps media types to 1 + the index of their first record in formats[],
+ * records for the same media type follow each other in the table */
+static GHashTable *
+get_format_index (void)
+{
+  static GHashTable *index = NULL;
+
+  if (g_once_init_enter (&index)) {
+    GHashTable *table;
+    guint i;
+
+    table = g_hash_table_new (g_str_hash, g_str_equal);
+    for (i = 0; i < G_N_ELEMENTS (formats); ++i) {
+      if (!g_hash_table_contains (table, formats[i].type))
+        g_hash_table_insert (table, (gpointer) formats[i].type,
+            GUINT_TO_POINTER (i + 1));
+    }
+    g_once_init_leave (&index, table);
+  }
+  return index;
+}
+
 /* returns format info structure, will return NULL for dynamic media types! */
 static const FormatInfo *
 find_format_info (const GstCaps * caps)
@@ -683,17 +705,22 @@ find_format_info (const GstCaps * caps)
   s = gst_caps_get_structure (caps, 0);
   media_type = gst_structure_get_name (s);
 
-  for (i = 0; i < G_N_ELEMENTS (formats); ++i) {
-    if (strcmp (media_type, formats[i].type) == 0) {
-      gboolean is_sys = FALSE;
+  i = GPOINTER_TO_UINT (g_hash_table_lookup (get_format_index (), media_type));
+  if (i == 0)
+    return NULL;
 
-      if ((formats[i].flags & FLAG_SYSTEMSTREAM) == 0)
-        return &formats[i];
+  for (i = i - 1; i < G_N_ELEMENTS (formats); ++i) {
+    gboolean is_sys = FALSE;
 
-      /* this record should only be matched if the systemstream field is set */
-      if (gst_structure_get_boolean (s, "systemstream", &is_sys) && is_sys)
-        return &formats[i];
-    }
+    if (strcmp (media_type, formats[i].type) != 0)
+      break;
+
+    if ((formats[i].flags & FLAG_SYSTEMSTREAM) == 0)
+      return &formats[i];
+
+    /* this record should only be matched if the systemstream field is set */
+    if (gst_structure_get_boolean (s, "systemstream", &is_sys) && is_sys)
+      return &formats[i];
   }
 
   return NULL;
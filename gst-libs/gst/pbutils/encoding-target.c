@@ -24,6 +24,7 @@
 
 #include <locale.h>
 #include <string.h>
+#include <glib/gstdio.h>
 #include "encoding-target.h"
 
 /*
@@ -87,6 +88,136 @@ struct _GstEncodingTarget
 
 G_DEFINE_TYPE (GstEncodingTarget, gst_encoding_target, G_TYPE_OBJECT);
 
+/*
+ * Cache of the target files and of the listings of the target directories,
+ * so that looking up targets only has to stat() them again. Entries are
+ * refreshed when the mtime (or size for files) changed. Entries modified in
+ * the last second are not cached since later changes in the same second
+ * would go unnoticed.
+ */
+typedef struct
+{
+  time_t mtime;
+  goffset size;
+  GKeyFile *keyfile;
+} CachedFile;
+
+typedef struct
+{
+  time_t mtime;
+  gchar **files;
+  gchar **subdirs;
+} CachedDir;
+
+static GMutex cache_lock;
+static GHashTable *file_cache = NULL;   /* path -> CachedFile */
+static GHashTable *dir_cache = NULL;    /* path -> CachedDir */
+
+static void
+cached_file_free (CachedFile * cfile)
+{
+  g_key_file_unref (cfile->keyfile);
+  g_slice_free (CachedFile, cfile);
+}
+
+static void
+cached_dir_free (CachedDir * cdir)
+{
+  g_strfreev (cdir->files);
+  g_strfreev (cdir->subdirs);
+  g_slice_free (CachedDir, cdir);
+}
+
+/* must be called with the cache_lock */
+static void
+ensure_caches (void)
+{
+  if (G_LIKELY (file_cache))
+    return;
+
+  file_cache = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+      (GDestroyNotify) cached_file_free);
+  dir_cache = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+      (GDestroyNotify) cached_dir_free);
+}
+
+static inline gboolean
+is_racy (time_t mtime)
+{
+  return mtime >= g_get_real_time () / G_USEC_PER_SEC - 1;
+}
+
+/* Lists the regular files and the subdirectories of @path. Returns FALSE if
+ * the directory can't be read. */
+static gboolean
+list_directory (const gchar * path, gchar *** files, gchar *** subdirs)
+{
+  GStatBuf st;
+  CachedDir *cdir;
+
+  g_mutex_lock (&cache_lock);
+  ensure_caches ();
+
+  if (g_stat (path, &st) != 0)
+    goto no_dir;
+
+  cdir = g_hash_table_lookup (dir_cache, path);
+  if (cdir && cdir->mtime == st.st_mtime) {
+    GST_LOG ("using cached listing of %s", path);
+  } else {
+    GPtrArray *farr, *darr;
+    const gchar *name;
+    GDir *dir;
+
+    dir = g_dir_open (path, 0, NULL);
+    if (G_UNLIKELY (dir == NULL))
+      goto no_dir;
+
+    farr = g_ptr_array_new ();
+    darr = g_ptr_array_new ();
+    while ((name = g_dir_read_name (dir))) {
+      gchar *ltmp = g_build_filename (path, name, NULL);
+
+      if (g_file_test (ltmp, G_FILE_TEST_IS_DIR))
+        g_ptr_array_add (darr, g_strdup (name));
+      else
+        g_ptr_array_add (farr, g_strdup (name));
+      g_free (ltmp);
+    }
+    g_dir_close (dir);
+    g_ptr_array_add (farr, NULL);
+    g_ptr_array_add (darr, NULL);
+
+    cdir = g_slice_new (CachedDir);
+    cdir->mtime = st.st_mtime;
+    cdir->files = (gchar **) g_ptr_array_free (farr, FALSE);
+    cdir->subdirs = (gchar **) g_ptr_array_free (darr, FALSE);
+
+    if (is_racy (st.st_mtime)) {
+      g_hash_table_remove (dir_cache, path);
+      *files = cdir->files;
+      *subdirs = cdir->subdirs;
+      g_slice_free (CachedDir, cdir);
+      g_mutex_unlock (&cache_lock);
+      return TRUE;
+    }
+    g_hash_table_insert (dir_cache, g_strdup (path), cdir);
+  }
+
+  *files = g_strdupv (cdir->files);
+  *subdirs = g_strdupv (cdir->subdirs);
+  g_mutex_unlock (&cache_lock);
+
+  return TRUE;
+
+no_dir:
+  {
+    g_hash_table_remove (dir_cache, path);
+    g_mutex_unlock (&cache_lock);
+    return FALSE;
+  }
+}
+
 static void
 gst_encoding_target_init (GstEncodingTarget * target)
 {
@@ -696,6 +827,8 @@ parse_keyfile (GKeyFile * in, gchar * targetname, gchar * categoryname,
   return res;
 }
 
+/* must be called with the cache_lock, the returned keyfile is shared with
+ * the cache and can only be used while holding it */
 static GKeyFile *
 load_file_and_read_header (const gchar * path, gchar ** targetname,
     gchar ** categoryname, gchar ** description, GError ** error)
@@ -703,18 +836,44 @@ load_file_and_read_header (const gchar * path, gchar ** targetname,
   GKeyFile *in;
   gboolean res;
   GError *key_error = NULL;
+  CachedFile *cfile;
+  GStatBuf st;
 
   g_return_val_if_fail (error == NULL || *error == NULL, NULL);
 
-  in = g_key_file_new ();
-
   GST_DEBUG ("path:%s", path);
 
-  res =
-      g_key_file_load_from_file (in, path,
-      G_KEY_FILE_KEEP_COMMENTS | G_KEY_FILE_KEEP_TRANSLATIONS, &key_error);
-  if (!res || key_error != NULL)
-    goto load_error;
+  ensure_caches ();
+
+  if (g_stat (path, &st) != 0) {
+    g_hash_table_remove (file_cache, path);
+    st.st_mtime = 0;
+    st.st_size = -1;
+  }
+
+  cfile = g_hash_table_lookup (file_cache, path);
+  if (cfile && cfile->mtime == st.st_mtime && cfile->size == st.st_size) {
+    GST_LOG ("using cached %s", path);
+    in = g_key_file_ref (cfile->keyfile);
+  } else {
+    in = g_key_file_new ();
+
+    res =
+        g_key_file_load_from_file (in, path,
+        G_KEY_FILE_KEEP_COMMENTS | G_KEY_FILE_KEEP_TRANSLATIONS, &key_error);
+    if (!res || key_error != NULL)
+      goto load_error;
+
+    if (is_racy (st.st_mtime)) {
+      g_hash_table_remove (file_cache, path);
+    } else {
+      cfile = g_slice_new (CachedFile);
+      cfile->mtime = st.st_mtime;
+      cfile->size = st.st_size;
+      cfile->keyfile = g_key_file_ref (in);
+      g_hash_table_insert (file_cache, g_strdup (path), cfile);
+    }
+  }
 
   key_error = NULL;
   *targetname =
@@ -734,8 +893,9 @@ load_error:
   {
     GST_WARNING ("Unable to read GstEncodingTarget file %s: %s",
         path, key_error->message);
+    g_hash_table_remove (file_cache, path);
     g_propagate_error (error, key_error);
-    g_key_file_free (in);
+    g_key_file_unref (in);
     return NULL;
   }
 
@@ -743,7 +903,7 @@ empty_name:
   {
     GST_WARNING ("Wrong header in file %s: %s", path, key_error->message);
     g_propagate_error (error, key_error);
-    g_key_file_free (in);
+    g_key_file_unref (in);
     return NULL;
   }
 }
@@ -766,6 +926,7 @@ gst_encoding_target_load_from_file (const gchar * filepath, GError ** error)
   gchar *targetname, *categoryname, *description;
   GstEncodingTarget *res = NULL;
 
+  g_mutex_lock (&cache_lock);
   in = load_file_and_read_header (filepath, &targetname, &categoryname,
       &description, error);
   if (!in)
@@ -773,9 +934,10 @@ gst_encoding_target_load_from_file (const gchar * filepath, GError ** error)
 
   res = parse_keyfile (in, targetname, categoryname, description);
 
-  g_key_file_free (in);
+  g_key_file_unref (in);
 
 beach:
+  g_mutex_unlock (&cache_lock);
   return res;
 }
 
@@ -786,28 +948,23 @@ static GList *
 get_matching_filenames (gchar * path, gchar * filename)
 {
   GList *res = NULL;
-  GDir *topdir;
-  const gchar *subdirname;
+  gchar **files, **subdirs;
+  guint i;
 
-  topdir = g_dir_open (path, 0, NULL);
-  if (G_UNLIKELY (topdir == NULL))
+  if (!list_directory (path, &files, &subdirs))
     return NULL;
 
-  while ((subdirname = g_dir_read_name (topdir))) {
-    gchar *ltmp = g_build_filename (path, subdirname, NULL);
-
-    if (g_file_test (ltmp, G_FILE_TEST_IS_DIR)) {
-      gchar *tmp = g_build_filename (path, subdirname, filename, NULL);
-      /* Test to see if we have a file named like that in that directory */
-      if (g_file_test (tmp, G_FILE_TEST_EXISTS))
-        res = g_list_append (res, tmp);
-      else
-        g_free (tmp);
-    }
-    g_free (ltmp);
+  for (i = 0; subdirs[i]; i++) {
+    gchar *tmp = g_build_filename (path, subdirs[i], filename, NULL);
+    /* Test to see if we have a file named like that in that directory */
+    if (g_file_test (tmp, G_FILE_TEST_EXISTS))
+      res = g_list_append (res, tmp);
+    else
+      g_free (tmp);
   }
 
-  g_dir_close (topdir);
+  g_strfreev (files);
+  g_strfreev (subdirs);
 
   return res;
 }
@@ -1008,23 +1165,17 @@ static GList *
 get_categories (gchar * path)
 {
   GList *res = NULL;
-  GDir *topdir;
-  const gchar *subdirname;
+  gchar **files, **subdirs;
+  guint i;
 
-  topdir = g_dir_open (path, 0, NULL);
-  if (G_UNLIKELY (topdir == NULL))
+  if (!list_directory (path, &files, &subdirs))
     return NULL;
 
-  while ((subdirname = g_dir_read_name (topdir))) {
-    gchar *ltmp = g_build_filename (path, subdirname, NULL);
+  for (i = 0; subdirs[i]; i++)
+    res = g_list_append (res, (gpointer) g_strdup (subdirs[i]));
 
-    if (g_file_test (ltmp, G_FILE_TEST_IS_DIR)) {
-      res = g_list_append (res, (gpointer) g_strdup (subdirname));
-    }
-    g_free (ltmp);
-  }
-
-  g_dir_close (topdir);
+  g_strfreev (files);
+  g_strfreev (subdirs);
 
   return res;
 }
@@ -1073,22 +1224,21 @@ static inline GList *
 sub_get_all_targets (gchar * subdir)
 {
   GList *res = NULL;
-  const gchar *filename;
-  GDir *dir;
+  gchar **files, **subdirs;
   GstEncodingTarget *target;
+  guint i;
 
-  dir = g_dir_open (subdir, 0, NULL);
-  if (G_UNLIKELY (dir == NULL))
+  if (!list_directory (subdir, &files, &subdirs))
     return NULL;
 
-  while ((filename = g_dir_read_name (dir))) {
+  for (i = 0; files[i]; i++) {
     gchar *fullname;
 
     /* Only try files ending with .gstprofile */
-    if (!g_str_has_suffix (filename, GST_ENCODING_TARGET_SUFFIX))
+    if (!g_str_has_suffix (files[i], GST_ENCODING_TARGET_SUFFIX))
       continue;
 
-    fullname = g_build_filename (subdir, filename, NULL);
+    fullname = g_build_filename (subdir, files[i], NULL);
     target = gst_encoding_target_load_from_file (fullname, NULL);
     if (target) {
       res = g_list_append (res, target);
@@ -1096,7 +1246,9 @@ sub_get_all_targets (gchar * subdir)
       GST_WARNING ("Failed to get a target from %s", fullname);
     g_free (fullname);
   }
-  g_dir_close (dir);
+
+  g_strfreev (files);
+  g_strfreev (subdirs);
 
   return res;
 }
@@ -1112,21 +1264,21 @@ get_all_targets (gchar * topdir, const gchar * categoryname)
     res = sub_get_all_targets (subdir);
     g_free (subdir);
   } else {
-    const gchar *subdirname;
-    GDir *dir = g_dir_open (topdir, 0, NULL);
+    gchar **files, **subdirs;
+    guint i;
 
-    if (G_UNLIKELY (dir == NULL))
+    if (!list_directory (topdir, &files, &subdirs))
       return NULL;
 
-    while ((subdirname = g_dir_read_name (dir))) {
-      gchar *ltmp = g_build_filename (topdir, subdirname, NULL);
+    for (i = 0; subdirs[i]; i++) {
+      gchar *ltmp = g_build_filename (topdir, subdirs[i], NULL);
 
-      if (g_file_test (ltmp, G_FILE_TEST_IS_DIR)) {
-        res = g_list_concat (res, sub_get_all_targets (ltmp));
-      }
+      res = g_list_concat (res, sub_get_all_targets (ltmp));
       g_free (ltmp);
     }
-    g_dir_close (dir);
+
+    g_strfreev (files);
+    g_strfreev (subdirs);
   }
 
   return res;
@@ -439,6 +439,313 @@ gst_discoverer_info_class_init (GObjectClass * klass)
   klass->finalize = gst_discoverer_info_finalize;
 }
 
+/* Serialization, used by the discoverer cache.
+ *
+ * A stream is stored as a (kind, caps, tags, stream-id, misc, language,
+ * values, index in the stream list, children) tuple. The children are the
+ * streams of a container or the next stream of any other stream, the values
+ * are the type specific fields of audio and video streams. TOCs can't be
+ * serialized, so infos containing one are not stored. */
+#define DISCOVERER_SERIALIZATION_VERSION 1
+#define STREAM_VARIANT_FORMAT "(ymsmsmsmsmsauiav)"
+#define INFO_VARIANT_FORMAT "(ustbmsmsmv)"
+#define MAX_LISTED_STREAMS 4096
+
+static gchar *
+tags_to_string (const GstTagList * tags)
+{
+  GstTagList *copy;
+  gchar *res;
+  gint i;
+
+  if (tags == NULL)
+    return NULL;
+
+  /* samples (e.g. cover art) don't round-trip through a string */
+  copy = gst_tag_list_copy (tags);
+  for (i = gst_tag_list_n_tags (copy) - 1; i >= 0; i--) {
+    const gchar *tag = gst_tag_list_nth_tag_name (copy, i);
+
+    if (gst_tag_get_type (tag) == GST_TYPE_SAMPLE)
+      gst_tag_list_remove_tag (copy, tag);
+  }
+  res = gst_tag_list_to_string (copy);
+  gst_tag_list_unref (copy);
+
+  return res;
+}
+
+static gboolean
+stream_info_has_toc (GstDiscovererStreamInfo * info)
+{
+  GList *tmp;
+
+  if (info->toc)
+    return TRUE;
+
+  if (GST_IS_DISCOVERER_CONTAINER_INFO (info)) {
+    for (tmp = ((GstDiscovererContainerInfo *) info)->streams; tmp;
+        tmp = tmp->next)
+      if (stream_info_has_toc (tmp->data))
+        return TRUE;
+  }
+
+  return info->next && stream_info_has_toc (info->next);
+}
+
+static GVariant *
+stream_info_to_variant (GstDiscovererStreamInfo * info, GList * stream_list)
+{
+  GVariantBuilder values, children;
+  const gchar *language = NULL;
+  gchar *caps, *tags, *misc;
+  guchar kind;
+  GVariant *res;
+  GList *tmp;
+
+  g_variant_builder_init (&values, G_VARIANT_TYPE ("au"));
+  g_variant_builder_init (&children, G_VARIANT_TYPE ("av"));
+
+  if (GST_IS_DISCOVERER_CONTAINER_INFO (info)) {
+    kind = 'c';
+    for (tmp = ((GstDiscovererContainerInfo *) info)->streams; tmp;
+        tmp = tmp->next)
+      g_variant_builder_add (&children, "v",
+          stream_info_to_variant (tmp->data, stream_list));
+  } else if (GST_IS_DISCOVERER_AUDIO_INFO (info)) {
+    GstDiscovererAudioInfo *audio = (GstDiscovererAudioInfo *) info;
+
+    kind = 'a';
+    g_variant_builder_add (&values, "u", audio->channels);
+    g_variant_builder_add (&values, "u", audio->sample_rate);
+    g_variant_builder_add (&values, "u", audio->depth);
+    g_variant_builder_add (&values, "u", audio->bitrate);
+    g_variant_builder_add (&values, "u", audio->max_bitrate);
+    language = audio->language;
+  } else if (GST_IS_DISCOVERER_VIDEO_INFO (info)) {
+    GstDiscovererVideoInfo *video = (GstDiscovererVideoInfo *) info;
+
+    kind = 'v';
+    g_variant_builder_add (&values, "u", video->width);
+    g_variant_builder_add (&values, "u", video->height);
+    g_variant_builder_add (&values, "u", video->depth);
+    g_variant_builder_add (&values, "u", video->framerate_num);
+    g_variant_builder_add (&values, "u", video->framerate_denom);
+    g_variant_builder_add (&values, "u", video->par_num);
+    g_variant_builder_add (&values, "u", video->par_denom);
+    g_variant_builder_add (&values, "u", (guint) video->interlaced);
+    g_variant_builder_add (&values, "u", video->bitrate);
+    g_variant_builder_add (&values, "u", video->max_bitrate);
+    g_variant_builder_add (&values, "u", (guint) video->is_image);
+  } else if (GST_IS_DISCOVERER_SUBTITLE_INFO (info)) {
+    kind = 's';
+    language = ((GstDiscovererSubtitleInfo *) info)->language;
+  } else {
+    kind = 'u';
+  }
+
+  if (info->next)
+    g_variant_builder_add (&children, "v",
+        stream_info_to_variant (info->next, stream_list));
+
+  caps = info->caps ? gst_caps_to_string (info->caps) : NULL;
+  tags = tags_to_string (info->tags);
+  misc = info->misc ? gst_structure_to_string (info->misc) : NULL;
+
+  res = g_variant_new (STREAM_VARIANT_FORMAT, kind, caps, tags,
+      info->stream_id, misc, language, &values,
+      (gint32) g_list_index (stream_list, info), &children);
+
+  g_free (caps);
+  g_free (tags);
+  g_free (misc);
+
+  return res;
+}
+
+/* returns a floating #GVariant or NULL if @info can't be serialized */
+GVariant *
+_gst_discoverer_info_to_variant (GstDiscovererInfo * info)
+{
+  GVariant *stream = NULL;
+  gchar *misc, *tags;
+  GVariant *res;
+
+  g_return_val_if_fail (info != NULL, NULL);
+
+  if (info->toc || (info->stream_info
+          && stream_info_has_toc (info->stream_info)))
+    return NULL;
+
+  if (info->stream_info)
+    stream = stream_info_to_variant (info->stream_info, info->stream_list);
+
+  misc = info->misc ? gst_structure_to_string (info->misc) : NULL;
+  tags = tags_to_string (info->tags);
+
+  res = g_variant_new (INFO_VARIANT_FORMAT, DISCOVERER_SERIALIZATION_VERSION,
+      info->uri, info->duration, info->seekable, misc, tags, stream);
+
+  g_free (misc);
+  g_free (tags);
+
+  return res;
+}
+
+static GstDiscovererStreamInfo *
+stream_info_from_variant (GVariant * variant, GPtrArray * listed)
+{
+  GstDiscovererStreamInfo *res, *child;
+  const gchar *caps, *tags, *stream_id, *misc, *language;
+  GVariantIter *values, *children;
+  guint vals[11] = { 0, };
+  guint n_vals = 0, val;
+  GVariant *childv;
+  gint32 index;
+  guchar kind;
+
+  g_variant_get (variant, "(y&ms&ms&ms&ms&msauiav)", &kind, &caps, &tags,
+      &stream_id, &misc, &language, &values, &index, &children);
+
+  while (n_vals < G_N_ELEMENTS (vals) && g_variant_iter_next (values, "u",
+          &val))
+    vals[n_vals++] = val;
+  g_variant_iter_free (values);
+
+  switch (kind) {
+    case 'c':
+      res = (GstDiscovererStreamInfo *) gst_discoverer_container_info_new ();
+      break;
+    case 'a':{
+      GstDiscovererAudioInfo *audio = gst_discoverer_audio_info_new ();
+
+      audio->channels = vals[0];
+      audio->sample_rate = vals[1];
+      audio->depth = vals[2];
+      audio->bitrate = vals[3];
+      audio->max_bitrate = vals[4];
+      audio->language = g_strdup (language);
+      res = (GstDiscovererStreamInfo *) audio;
+      break;
+    }
+    case 'v':{
+      GstDiscovererVideoInfo *video = gst_discoverer_video_info_new ();
+
+      video->width = vals[0];
+      video->height = vals[1];
+      video->depth = vals[2];
+      video->framerate_num = vals[3];
+      video->framerate_denom = vals[4];
+      video->par_num = vals[5];
+      video->par_denom = vals[6];
+      video->interlaced = vals[7] != 0;
+      video->bitrate = vals[8];
+      video->max_bitrate = vals[9];
+      video->is_image = vals[10] != 0;
+      res = (GstDiscovererStreamInfo *) video;
+      break;
+    }
+    case 's':{
+      GstDiscovererSubtitleInfo *subtitle = gst_discoverer_subtitle_info_new ();
+
+      subtitle->language = g_strdup (language);
+      res = (GstDiscovererStreamInfo *) subtitle;
+      break;
+    }
+    default:
+      res = gst_discoverer_stream_info_new ();
+      break;
+  }
+
+  if (caps)
+    res->caps = gst_caps_from_string (caps);
+  if (tags)
+    res->tags = gst_tag_list_new_from_string (tags);
+  res->stream_id = g_strdup (stream_id);
+  if (misc)
+    res->misc = gst_structure_from_string (misc, NULL);
+
+  if (index >= 0 && index < MAX_LISTED_STREAMS) {
+    if (listed->len <= (guint) index)
+      g_ptr_array_set_size (listed, index + 1);
+    g_ptr_array_index (listed, index) = res;
+  }
+
+  while ((childv = g_variant_iter_next_value (children))) {
+    GVariant *v = g_variant_get_variant (childv);
+
+    if (g_variant_is_of_type (v, G_VARIANT_TYPE (STREAM_VARIANT_FORMAT))) {
+      child = stream_info_from_variant (v, listed);
+      child->previous = res;
+      if (kind == 'c') {
+        GstDiscovererContainerInfo *cont = (GstDiscovererContainerInfo *) res;
+
+        /* like the discoverer, the container owns two references */
+        cont->streams = g_list_append (cont->streams,
+            gst_discoverer_stream_info_ref (child));
+      } else if (res->next == NULL) {
+        res->next = child;
+      } else {
+        gst_discoverer_stream_info_unref (child);
+      }
+    }
+    g_variant_unref (v);
+    g_variant_unref (childv);
+  }
+  g_variant_iter_free (children);
+
+  return res;
+}
+
+/* returns a new #GstDiscovererInfo or NULL if @variant was not created by
+ * this version of _gst_discoverer_info_to_variant() */
+GstDiscovererInfo *
+_gst_discoverer_info_from_variant (GVariant * variant)
+{
+  GstDiscovererInfo *info;
+  const gchar *uri, *misc, *tags;
+  GVariant *stream;
+  GPtrArray *listed;
+  guint32 version;
+  guint i;
+
+  g_return_val_if_fail (variant != NULL, NULL);
+
+  if (!g_variant_is_of_type (variant, G_VARIANT_TYPE (INFO_VARIANT_FORMAT)))
+    return NULL;
+
+  g_variant_get_child (variant, 0, "u", &version);
+  if (version != DISCOVERER_SERIALIZATION_VERSION)
+    return NULL;
+
+  info = gst_discoverer_info_new ();
+  g_variant_get (variant, "(u&stb&ms&msmv)", NULL, &uri, &info->duration,
+      &info->seekable, &misc, &tags, &stream);
+
+  info->uri = g_strdup (uri);
+  info->result = GST_DISCOVERER_OK;
+  if (misc)
+    info->misc = gst_structure_from_string (misc, NULL);
+  if (tags)
+    info->tags = gst_tag_list_new_from_string (tags);
+
+  if (stream) {
+    if (g_variant_is_of_type (stream, G_VARIANT_TYPE (STREAM_VARIANT_FORMAT))) {
+      listed = g_ptr_array_new ();
+      info->stream_info = stream_info_from_variant (stream, listed);
+      for (i = 0; i < listed->len; i++) {
+        if (g_ptr_array_index (listed, i))
+          info->stream_list = g_list_append (info->stream_list,
+              g_ptr_array_index (listed, i));
+      }
+      g_ptr_array_free (listed, TRUE);
+    }
+    g_variant_unref (stream);
+  }
+
+  return info;
+}
+
 /**
  * gst_discoverer_stream_info_list_free:
  * @infos: (element-type GstPbutils.DiscovererStreamInfo): a #GList of #GstDiscovererStreamInfo
@@ -42,6 +42,10 @@
 #include "config.h"
 #endif
 
+#include <errno.h>
+#include <string.h>
+#include <glib/gstdio.h>
+
 #include <gst/video/video.h>
 #include <gst/audio/audio.h>
 
@@ -124,6 +128,27 @@ struct _GstDiscovererPrivate
   gulong source_chg_id;
   gulong element_added_id;
   gulong bus_cb_id;
+  gulong autoplug_select_id;
+
+  /* TRUE if decoders should not be plugged */
+  gboolean parse_only;
+
+  /* maximum number of URIs discovered at the same time in async mode */
+  guint max_concurrent;
+
+  /* Additional discoverers running next to our own pipeline in async mode,
+   * each of them takes the next pending URI when idle */
+  GList *workers;
+  GList *idle_workers;
+  guint busy_workers;
+
+  /* directory of the on-disk result cache, NULL if disabled */
+  gchar *cache_directory;
+  guint cache_max_entries;
+
+  /* results found in the cache in async mode, waiting to be emitted */
+  GList *cached_infos;
+  guint cachedid;
 };
 
 #define DISCO_LOCK(dc) g_mutex_lock (&dc->priv->lock);
@@ -156,13 +181,25 @@ enum
 };
 
 #define DEFAULT_PROP_TIMEOUT 15 * GST_SECOND
+#define DEFAULT_PROP_MAX_CONCURRENT 1
+#define DEFAULT_PROP_PARSE_ONLY FALSE
+#define DEFAULT_PROP_CACHE_DIRECTORY NULL
+#define DEFAULT_PROP_CACHE_MAX_ENTRIES 1000
 
 enum
 {
   PROP_0,
-  PROP_TIMEOUT
+  PROP_TIMEOUT,
+  PROP_MAX_CONCURRENT,
+  PROP_PARSE_ONLY,
+  PROP_CACHE_DIRECTORY,
+  PROP_CACHE_MAX_ENTRIES
 };
 
+/* values of GstAutoplugSelectResult from the playback plugin */
+#define AUTOPLUG_SELECT_TRY 0
+#define AUTOPLUG_SELECT_EXPOSE 1
+
 static guint gst_discoverer_signals[LAST_SIGNAL] = { 0 };
 
 static void gst_discoverer_set_timeout (GstDiscoverer * dc,
@@ -177,6 +214,9 @@ static void uridecodebin_pad_removed_cb (GstElement * uridecodebin,
     GstPad * pad, GstDiscoverer * dc);
 static void uridecodebin_source_changed_cb (GstElement * uridecodebin,
     GParamSpec * pspec, GstDiscoverer * dc);
+static gint uridecodebin_autoplug_select_cb (GstElement * uridecodebin,
+    GstPad * pad, GstCaps * caps, GstElementFactory * factory,
+    GstDiscoverer * dc);
 
 static void gst_discoverer_dispose (GObject * dc);
 static void gst_discoverer_finalize (GObject * dc);
@@ -213,6 +253,76 @@ gst_discoverer_class_init (GstDiscovererClass * klass)
           GST_SECOND, 3600 * GST_SECOND, DEFAULT_PROP_TIMEOUT,
           G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstDiscoverer:max-concurrent:
+   *
+   * The maximum number of URIs that are discovered at the same time in
+   * asynchronous mode. Each of them uses its own pipeline, which is reused
+   * for the following URIs. The #GstDiscoverer::discovered signal is emitted
+   * as soon as each of them is done, so not necessarily in the order in
+   * which the URIs were added.
+   *
+   * Changes only take effect on the next gst_discoverer_start().
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_CONCURRENT,
+      g_param_spec_uint ("max-concurrent", "Max concurrent",
+          "Maximum number of URIs discovered at the same time in async mode",
+          1, 64, DEFAULT_PROP_MAX_CONCURRENT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstDiscoverer:parse-only:
+   *
+   * Don't plug any decoders and stop at the parsed, encoded streams.
+   *
+   * The container, codecs, duration and tags are still discovered, but
+   * streams are described by their encoded caps only, so information that
+   * is only known after decoding (e.g. the exact raw audio or video format)
+   * might be missing. This makes discovery a lot cheaper.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_PARSE_ONLY,
+      g_param_spec_boolean ("parse-only", "Parse only",
+          "Don't plug decoders, stop at the parsed streams",
+          DEFAULT_PROP_PARSE_ONLY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstDiscoverer:cache-directory:
+   *
+   * Directory in which the results of successful discoveries of local files
+   * are stored. If set, a URI that was already discovered is not discovered
+   * again as long as the file it points to keeps the same modification time
+   * and size. The cache is disabled if %NULL.
+   *
+   * Tables of contents and tags containing samples (e.g. cover art) are not
+   * stored, results containing a table of contents are not cached at all.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_CACHE_DIRECTORY,
+      g_param_spec_string ("cache-directory", "Cache directory",
+          "Directory where discovery results are cached (NULL = disabled)",
+          DEFAULT_PROP_CACHE_DIRECTORY,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstDiscoverer:cache-max-entries:
+   *
+   * The maximum number of results kept in the #GstDiscoverer:cache-directory.
+   * The least recently used results are removed when this is exceeded.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_CACHE_MAX_ENTRIES,
+      g_param_spec_uint ("cache-max-entries", "Cache max entries",
+          "Maximum number of results kept in the cache (0 = unlimited)",
+          0, G_MAXUINT, DEFAULT_PROP_CACHE_MAX_ENTRIES,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /* signals */
   /**
    * GstDiscoverer::finished:
@@ -299,6 +409,8 @@ gst_discoverer_init (GstDiscoverer * dc)
       GstDiscovererPrivate);
 
   dc->priv->timeout = DEFAULT_PROP_TIMEOUT;
+  dc->priv->max_concurrent = DEFAULT_PROP_MAX_CONCURRENT;
+  dc->priv->cache_max_entries = DEFAULT_PROP_CACHE_MAX_ENTRIES;
   dc->priv->async = FALSE;
   dc->priv->async_done = FALSE;
 
@@ -327,6 +439,9 @@ gst_discoverer_init (GstDiscoverer * dc)
   dc->priv->source_chg_id =
       g_signal_connect_object (dc->priv->uridecodebin, "notify::source",
       G_CALLBACK (uridecodebin_source_changed_cb), dc, 0);
+  dc->priv->autoplug_select_id =
+      g_signal_connect_object (dc->priv->uridecodebin, "autoplug-select",
+      G_CALLBACK (uridecodebin_autoplug_select_cb), dc, 0);
 
   GST_LOG_OBJECT (dc, "Getting pipeline bus");
   dc->priv->bus = gst_pipeline_get_bus ((GstPipeline *) dc->priv->pipeline);
@@ -362,6 +477,13 @@ discoverer_reset (GstDiscoverer * dc)
     dc->priv->pending_uris = NULL;
   }
 
+  if (dc->priv->cached_infos) {
+    g_list_foreach (dc->priv->cached_infos, (GFunc) gst_discoverer_info_unref,
+        NULL);
+    g_list_free (dc->priv->cached_infos);
+    dc->priv->cached_infos = NULL;
+  }
+
   if (dc->priv->pipeline)
     gst_element_set_state ((GstElement *) dc->priv->pipeline, GST_STATE_NULL);
 }
@@ -386,6 +508,7 @@ gst_discoverer_dispose (GObject * obj)
     DISCONNECT_SIGNAL (dc->priv->uridecodebin, dc->priv->pad_added_id);
     DISCONNECT_SIGNAL (dc->priv->uridecodebin, dc->priv->pad_remove_id);
     DISCONNECT_SIGNAL (dc->priv->uridecodebin, dc->priv->source_chg_id);
+    DISCONNECT_SIGNAL (dc->priv->uridecodebin, dc->priv->autoplug_select_id);
     DISCONNECT_SIGNAL (dc->priv->uridecodebin, dc->priv->element_added_id);
     DISCONNECT_SIGNAL (dc->priv->bus, dc->priv->bus_cb_id);
 
@@ -414,6 +537,7 @@ gst_discoverer_finalize (GObject * obj)
   GstDiscoverer *dc = (GstDiscoverer *) obj;
 
   g_mutex_clear (&dc->priv->lock);
+  g_free (dc->priv->cache_directory);
 
   G_OBJECT_CLASS (gst_discoverer_parent_class)->finalize (obj);
 }
@@ -428,6 +552,27 @@ gst_discoverer_set_property (GObject * object, guint prop_id,
     case PROP_TIMEOUT:
       gst_discoverer_set_timeout (dc, g_value_get_uint64 (value));
       break;
+    case PROP_MAX_CONCURRENT:
+      DISCO_LOCK (dc);
+      dc->priv->max_concurrent = g_value_get_uint (value);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_PARSE_ONLY:
+      DISCO_LOCK (dc);
+      dc->priv->parse_only = g_value_get_boolean (value);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_CACHE_DIRECTORY:
+      DISCO_LOCK (dc);
+      g_free (dc->priv->cache_directory);
+      dc->priv->cache_directory = g_value_dup_string (value);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_CACHE_MAX_ENTRIES:
+      DISCO_LOCK (dc);
+      dc->priv->cache_max_entries = g_value_get_uint (value);
+      DISCO_UNLOCK (dc);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -446,6 +591,26 @@ gst_discoverer_get_property (GObject * object, guint prop_id,
       g_value_set_uint64 (value, dc->priv->timeout);
       DISCO_UNLOCK (dc);
       break;
+    case PROP_MAX_CONCURRENT:
+      DISCO_LOCK (dc);
+      g_value_set_uint (value, dc->priv->max_concurrent);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_PARSE_ONLY:
+      DISCO_LOCK (dc);
+      g_value_set_boolean (value, dc->priv->parse_only);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_CACHE_DIRECTORY:
+      DISCO_LOCK (dc);
+      g_value_set_string (value, dc->priv->cache_directory);
+      DISCO_UNLOCK (dc);
+      break;
+    case PROP_CACHE_MAX_ENTRIES:
+      DISCO_LOCK (dc);
+      g_value_set_uint (value, dc->priv->cache_max_entries);
+      DISCO_UNLOCK (dc);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -578,6 +743,32 @@ uridecodebin_source_changed_cb (GstElement * uridecodebin,
   gst_object_unref (src);
 }
 
+/* In parse-only mode, expose the stream instead of plugging a decoder */
+static gint
+uridecodebin_autoplug_select_cb (GstElement * uridecodebin, GstPad * pad,
+    GstCaps * caps, GstElementFactory * factory, GstDiscoverer * dc)
+{
+  const gchar *klass;
+  gboolean parse_only;
+
+  DISCO_LOCK (dc);
+  parse_only = dc->priv->parse_only;
+  DISCO_UNLOCK (dc);
+
+  if (!parse_only)
+    return AUTOPLUG_SELECT_TRY;
+
+  klass = gst_element_factory_get_metadata (factory,
+      GST_ELEMENT_METADATA_KLASS);
+  if (klass && strstr (klass, "Decoder")) {
+    GST_DEBUG_OBJECT (dc, "not plugging decoder %s for %" GST_PTR_FORMAT,
+        gst_plugin_feature_get_name (GST_PLUGIN_FEATURE (factory)), caps);
+    return AUTOPLUG_SELECT_EXPOSE;
+  }
+
+  return AUTOPLUG_SELECT_TRY;
+}
+
 static void
 uridecodebin_pad_added_cb (GstElement * uridecodebin, GstPad * pad,
     GstDiscoverer * dc)
@@ -1184,6 +1375,265 @@ parse_stream_topology (GstDiscoverer * dc, const GstStructure * topology,
   return res;
 }
 
+/* On-disk result cache.
+ *
+ * Every URI gets its own file, named after the checksum of the URI, holding
+ * the modification time and size of the file at the time of the discovery
+ * and the serialized #GstDiscovererInfo. Entries are stored in little endian
+ * and their mtime is refreshed on every hit so that the least recently used
+ * ones are removed first. */
+#define CACHE_ENTRY_VERSION 1
+#define CACHE_ENTRY_FORMAT "(uxtv)"
+#define CACHE_ENTRY_SUFFIX ".info"
+
+/* Returns the path of the cache entry for @uri and the identity of the file
+ * it points to, or NULL if the cache is disabled or @uri is not cacheable */
+static gchar *
+cache_get_entry (GstDiscoverer * dc, const gchar * uri, gint64 * mtime,
+    guint64 * size)
+{
+  gchar *filename, *checksum, *name, *path = NULL;
+  GStatBuf st;
+
+  DISCO_LOCK (dc);
+  if (dc->priv->cache_directory == NULL) {
+    DISCO_UNLOCK (dc);
+    return NULL;
+  }
+
+  filename = g_filename_from_uri (uri, NULL, NULL);
+  if (filename && g_file_test (filename, G_FILE_TEST_IS_REGULAR) &&
+      g_stat (filename, &st) == 0) {
+    *mtime = st.st_mtime;
+    *size = st.st_size;
+    checksum = g_compute_checksum_for_string (G_CHECKSUM_SHA1, uri, -1);
+    name = g_strconcat (checksum, CACHE_ENTRY_SUFFIX, NULL);
+    path = g_build_filename (dc->priv->cache_directory, name, NULL);
+    g_free (name);
+    g_free (checksum);
+  }
+  DISCO_UNLOCK (dc);
+  g_free (filename);
+
+  return path;
+}
+
+static GstDiscovererInfo *
+cache_lookup (GstDiscoverer * dc, const gchar * uri)
+{
+  GstDiscovererInfo *info = NULL;
+  GVariant *entry, *infov;
+  gchar *path, *contents;
+  gint64 mtime, entry_mtime;
+  guint64 size, entry_size;
+  guint32 version;
+  gsize len;
+
+  path = cache_get_entry (dc, uri, &mtime, &size);
+  if (path == NULL)
+    return NULL;
+
+  if (!g_file_get_contents (path, &contents, &len, NULL))
+    goto done;
+
+  entry = g_variant_new_from_data (G_VARIANT_TYPE (CACHE_ENTRY_FORMAT),
+      contents, len, FALSE, g_free, contents);
+  g_variant_ref_sink (entry);
+  if (G_BYTE_ORDER == G_BIG_ENDIAN) {
+    GVariant *swapped = g_variant_byteswap (entry);
+
+    g_variant_unref (entry);
+    entry = swapped;
+  }
+
+  g_variant_get (entry, CACHE_ENTRY_FORMAT, &version, &entry_mtime,
+      &entry_size, &infov);
+  if (version == CACHE_ENTRY_VERSION && entry_mtime == mtime &&
+      entry_size == size)
+    info = _gst_discoverer_info_from_variant (infov);
+  g_variant_unref (infov);
+  g_variant_unref (entry);
+
+  if (info && g_strcmp0 (info->uri, uri) != 0) {
+    gst_discoverer_info_unref (info);
+    info = NULL;
+  }
+
+  if (info) {
+    GST_DEBUG_OBJECT (dc, "found %s in the cache", uri);
+    g_utime (path, NULL);
+  } else {
+    GST_DEBUG_OBJECT (dc, "removing stale cache entry %s", path);
+    g_unlink (path);
+  }
+
+done:
+  g_free (path);
+  return info;
+}
+
+typedef struct
+{
+  gchar *path;
+  time_t mtime;
+} CacheFile;
+
+static gint
+cache_file_compare (const CacheFile * a, const CacheFile * b)
+{
+  return (a->mtime > b->mtime) - (a->mtime < b->mtime);
+}
+
+/* Removes the least recently used entries once there are more than
+ * @max_entries, leaving some room so that this doesn't happen for every
+ * new entry */
+static void
+cache_trim (const gchar * directory, guint max_entries)
+{
+  const gchar *name;
+  GArray *files;
+  GStatBuf st;
+  GDir *dir;
+  guint i, n_remove;
+
+  if (max_entries == 0)
+    return;
+
+  dir = g_dir_open (directory, 0, NULL);
+  if (dir == NULL)
+    return;
+
+  files = g_array_new (FALSE, FALSE, sizeof (CacheFile));
+  while ((name = g_dir_read_name (dir))) {
+    CacheFile file;
+
+    if (!g_str_has_suffix (name, CACHE_ENTRY_SUFFIX))
+      continue;
+    file.path = g_build_filename (directory, name, NULL);
+    if (g_stat (file.path, &st) != 0) {
+      g_free (file.path);
+      continue;
+    }
+    file.mtime = st.st_mtime;
+    g_array_append_val (files, file);
+  }
+  g_dir_close (dir);
+
+  if (files->len > max_entries) {
+    n_remove = files->len - max_entries + max_entries / 10;
+    g_array_sort (files, (GCompareFunc) cache_file_compare);
+    for (i = 0; i < n_remove && i < files->len; i++)
+      g_unlink (g_array_index (files, CacheFile, i).path);
+  }
+
+  for (i = 0; i < files->len; i++)
+    g_free (g_array_index (files, CacheFile, i).path);
+  g_array_free (files, TRUE);
+}
+
+static void
+cache_store (GstDiscoverer * dc, GstDiscovererInfo * info, GError * err)
+{
+  GVariant *entry, *infov;
+  GError *error = NULL;
+  gchar *path, *directory;
+  guint max_entries;
+  gint64 mtime;
+  guint64 size;
+
+  if (err != NULL || info->result != GST_DISCOVERER_OK)
+    return;
+
+  path = cache_get_entry (dc, info->uri, &mtime, &size);
+  if (path == NULL)
+    return;
+
+  infov = _gst_discoverer_info_to_variant (info);
+  if (infov == NULL) {
+    GST_DEBUG_OBJECT (dc, "%s can't be cached", info->uri);
+    g_free (path);
+    return;
+  }
+
+  entry = g_variant_new (CACHE_ENTRY_FORMAT, CACHE_ENTRY_VERSION, mtime, size,
+      infov);
+  g_variant_ref_sink (entry);
+  if (G_BYTE_ORDER == G_BIG_ENDIAN) {
+    GVariant *swapped = g_variant_byteswap (entry);
+
+    g_variant_unref (entry);
+    entry = swapped;
+  }
+
+  DISCO_LOCK (dc);
+  directory = g_strdup (dc->priv->cache_directory);
+  max_entries = dc->priv->cache_max_entries;
+  DISCO_UNLOCK (dc);
+
+  if (directory && (g_mkdir_with_parents (directory, 0755) != 0 ||
+          !g_file_set_contents (path, g_variant_get_data (entry),
+              g_variant_get_size (entry), &error))) {
+    GST_WARNING_OBJECT (dc, "failed to store %s in the cache: %s", info->uri,
+        error ? error->message : g_strerror (errno));
+    g_clear_error (&error);
+  } else if (directory) {
+    GST_DEBUG_OBJECT (dc, "stored %s in the cache", info->uri);
+    cache_trim (directory, max_entries);
+  }
+
+  g_variant_unref (entry);
+  g_free (directory);
+  g_free (path);
+}
+
+/* Emits the results that were found in the cache in async mode */
+static gboolean
+cached_infos_cb (GstDiscoverer * dc)
+{
+  GstDiscovererInfo *info;
+  gboolean finished;
+
+  DISCO_LOCK (dc);
+  while (dc->priv->running && dc->priv->cached_infos) {
+    info = dc->priv->cached_infos->data;
+    dc->priv->cached_infos =
+        g_list_delete_link (dc->priv->cached_infos, dc->priv->cached_infos);
+    DISCO_UNLOCK (dc);
+
+    g_signal_emit (dc, gst_discoverer_signals[SIGNAL_DISCOVERED], 0, info,
+        NULL);
+    gst_discoverer_info_unref (info);
+
+    DISCO_LOCK (dc);
+  }
+  dc->priv->cachedid = 0;
+  finished = dc->priv->running && dc->priv->busy_workers == 0 &&
+      dc->priv->pending_uris == NULL && dc->priv->current_info == NULL;
+  DISCO_UNLOCK (dc);
+
+  if (finished)
+    g_signal_emit (dc, gst_discoverer_signals[SIGNAL_FINISHED], 0);
+
+  return FALSE;
+}
+
+/* Call with the lock held */
+static void
+schedule_cached_infos_locked (GstDiscoverer * dc)
+{
+  GSource *source;
+
+  if (!dc->priv->running || dc->priv->cachedid != 0 ||
+      dc->priv->cached_infos == NULL)
+    return;
+
+  source = g_idle_source_new ();
+  g_source_set_callback (source, (GSourceFunc) cached_infos_cb,
+      g_object_ref (dc), g_object_unref);
+  dc->priv->cachedid = g_source_attach (source, dc->priv->ctx);
+  g_source_unref (source);
+}
+
 /* Called when pipeline is pre-rolled */
 static void
 discoverer_collect (GstDiscoverer * dc)
@@ -1277,6 +1727,9 @@ discoverer_collect (GstDiscoverer * dc)
     }
   }
 
+  if (dc->priv->current_info)
+    cache_store (dc, dc->priv->current_info, dc->priv->current_error);
+
   if (dc->priv->async) {
     GST_DEBUG ("Emitting 'discoverered'");
     g_signal_emit (dc, gst_discoverer_signals[SIGNAL_DISCOVERED], 0,
@@ -1547,9 +2000,14 @@ discoverer_cleanup (GstDiscoverer * dc)
       /* Start timeout */
       handle_current_async (dc);
     } else {
-      /* We're done ! */
+      /* We're done, unless a worker is still busy or cached results are
+       * still to be emitted ! */
+      gboolean finished = (dc->priv->busy_workers == 0 &&
+          dc->priv->cached_infos == NULL);
+
       DISCO_UNLOCK (dc);
-      g_signal_emit (dc, gst_discoverer_signals[SIGNAL_FINISHED], 0);
+      if (finished)
+        g_signal_emit (dc, gst_discoverer_signals[SIGNAL_FINISHED], 0);
     }
   } else
     DISCO_UNLOCK (dc);
@@ -1631,6 +2089,131 @@ beach:
 }
 
 
+/* Hands pending URIs to idle workers */
+static void
+dispatch_to_workers (GstDiscoverer * dc)
+{
+  GstDiscoverer *worker;
+  gchar *uri;
+
+  while (TRUE) {
+    DISCO_LOCK (dc);
+    if (!dc->priv->running || dc->priv->idle_workers == NULL ||
+        dc->priv->pending_uris == NULL) {
+      DISCO_UNLOCK (dc);
+      break;
+    }
+    worker = dc->priv->idle_workers->data;
+    dc->priv->idle_workers =
+        g_list_delete_link (dc->priv->idle_workers, dc->priv->idle_workers);
+    uri = dc->priv->pending_uris->data;
+    dc->priv->pending_uris =
+        g_list_delete_link (dc->priv->pending_uris, dc->priv->pending_uris);
+    dc->priv->busy_workers++;
+    DISCO_UNLOCK (dc);
+
+    GST_DEBUG_OBJECT (dc, "worker %p takes %s", worker, uri);
+    gst_discoverer_discover_uri_async (worker, uri);
+    g_free (uri);
+  }
+}
+
+static void
+worker_discovered_cb (GstDiscoverer * worker, GstDiscovererInfo * info,
+    GError * err, GstDiscoverer * dc)
+{
+  g_signal_emit (dc, gst_discoverer_signals[SIGNAL_DISCOVERED], 0, info, err);
+}
+
+static void
+worker_source_setup_cb (GstDiscoverer * worker, GstElement * source,
+    GstDiscoverer * dc)
+{
+  g_signal_emit (dc, gst_discoverer_signals[SIGNAL_SOURCE_SETUP], 0, source);
+}
+
+static void
+worker_finished_cb (GstDiscoverer * worker, GstDiscoverer * dc)
+{
+  gboolean finished;
+
+  DISCO_LOCK (dc);
+  dc->priv->busy_workers--;
+  dc->priv->idle_workers = g_list_prepend (dc->priv->idle_workers, worker);
+  finished = dc->priv->running && dc->priv->busy_workers == 0 &&
+      dc->priv->pending_uris == NULL && dc->priv->current_info == NULL &&
+      dc->priv->cached_infos == NULL;
+  DISCO_UNLOCK (dc);
+
+  dispatch_to_workers (dc);
+
+  if (finished)
+    g_signal_emit (dc, gst_discoverer_signals[SIGNAL_FINISHED], 0);
+}
+
+static void
+start_workers (GstDiscoverer * dc)
+{
+  GstClockTime timeout;
+  gboolean parse_only;
+  gchar *cache_directory;
+  guint i, n_workers, cache_max_entries;
+
+  DISCO_LOCK (dc);
+  n_workers = dc->priv->max_concurrent - 1;
+  timeout = dc->priv->timeout;
+  parse_only = dc->priv->parse_only;
+  cache_directory = g_strdup (dc->priv->cache_directory);
+  cache_max_entries = dc->priv->cache_max_entries;
+  DISCO_UNLOCK (dc);
+
+  for (i = 0; i < n_workers; i++) {
+    GstDiscoverer *worker;
+
+    worker = gst_discoverer_new (timeout, NULL);
+    if (worker == NULL)
+      break;
+    g_object_set (worker, "parse-only", parse_only, "cache-directory",
+        cache_directory, "cache-max-entries", cache_max_entries, NULL);
+
+    g_signal_connect (worker, "discovered",
+        G_CALLBACK (worker_discovered_cb), dc);
+    g_signal_connect (worker, "source-setup",
+        G_CALLBACK (worker_source_setup_cb), dc);
+    g_signal_connect (worker, "finished", G_CALLBACK (worker_finished_cb), dc);
+    gst_discoverer_start (worker);
+
+    DISCO_LOCK (dc);
+    dc->priv->workers = g_list_prepend (dc->priv->workers, worker);
+    dc->priv->idle_workers = g_list_prepend (dc->priv->idle_workers, worker);
+    DISCO_UNLOCK (dc);
+  }
+  g_free (cache_directory);
+}
+
+static void
+stop_workers (GstDiscoverer * dc)
+{
+  GList *workers, *l;
+
+  DISCO_LOCK (dc);
+  workers = dc->priv->workers;
+  dc->priv->workers = NULL;
+  g_list_free (dc->priv->idle_workers);
+  dc->priv->idle_workers = NULL;
+  dc->priv->busy_workers = 0;
+  DISCO_UNLOCK (dc);
+
+  for (l = workers; l; l = l->next) {
+    GstDiscoverer *worker = l->data;
+
+    g_signal_handlers_disconnect_by_data (worker, dc);
+    gst_discoverer_stop (worker);
+    g_object_unref (worker);
+  }
+  g_list_free (workers);
+}
+
 /**
  * gst_discoverer_start:
  * @discoverer: A #GstDiscoverer
@@ -1668,7 +2251,14 @@ gst_discoverer_start (GstDiscoverer * discoverer)
   g_source_unref (source);
   discoverer->priv->ctx = g_main_context_ref (ctx);
 
+  start_workers (discoverer);
+
+  DISCO_LOCK (discoverer);
+  schedule_cached_infos_locked (discoverer);
+  DISCO_UNLOCK (discoverer);
+
   start_discovering (discoverer);
+  dispatch_to_workers (discoverer);
   GST_DEBUG_OBJECT (discoverer, "Started");
 }
 
@@ -1704,11 +2294,18 @@ gst_discoverer_stop (GstDiscoverer * discoverer)
   discoverer->priv->running = FALSE;
   DISCO_UNLOCK (discoverer);
 
+  stop_workers (discoverer);
+
   /* Remove timeout handler */
   if (discoverer->priv->timeoutid) {
     g_source_remove (discoverer->priv->timeoutid);
     discoverer->priv->timeoutid = 0;
   }
+  /* Remove pending emission of cached results */
+  if (discoverer->priv->cachedid) {
+    g_source_remove (discoverer->priv->cachedid);
+    discoverer->priv->cachedid = 0;
+  }
   /* Remove signal watch */
   if (discoverer->priv->sourceid) {
     g_source_remove (discoverer->priv->sourceid);
@@ -1745,10 +2342,21 @@ gboolean
 gst_discoverer_discover_uri_async (GstDiscoverer * discoverer,
     const gchar * uri)
 {
+  GstDiscovererInfo *info;
   gboolean can_run;
 
   GST_DEBUG_OBJECT (discoverer, "uri : %s", uri);
 
+  info = cache_lookup (discoverer, uri);
+  if (info) {
+    DISCO_LOCK (discoverer);
+    discoverer->priv->cached_infos =
+        g_list_append (discoverer->priv->cached_infos, info);
+    schedule_cached_infos_locked (discoverer);
+    DISCO_UNLOCK (discoverer);
+    return TRUE;
+  }
+
   DISCO_LOCK (discoverer);
   can_run = (discoverer->priv->pending_uris == NULL);
   discoverer->priv->pending_uris =
@@ -1757,6 +2365,7 @@ gst_discoverer_discover_uri_async (GstDiscoverer * discoverer,
 
   if (can_run)
     start_discovering (discoverer);
+  dispatch_to_workers (discoverer);
 
   return TRUE;
 }
@@ -1792,7 +2401,16 @@ gst_discoverer_discover_uri (GstDiscoverer * discoverer, const gchar * uri,
     GST_WARNING_OBJECT (discoverer, "Already handling a uri");
     return NULL;
   }
+  DISCO_UNLOCK (discoverer);
 
+  info = cache_lookup (discoverer, uri);
+  if (info) {
+    if (err)
+      *err = NULL;
+    return info;
+  }
+
+  DISCO_LOCK (discoverer);
   discoverer->priv->pending_uris =
       g_list_append (discoverer->priv->pending_uris, g_strdup (uri));
   DISCO_UNLOCK (discoverer);
@@ -104,6 +104,11 @@ struct _GstDiscovererInfo {
   gpointer _gst_reserved[GST_PADDING];
 };
 
+/* gstdiscoverer-types.c */
+
+GVariant *           _gst_discoverer_info_to_variant   (GstDiscovererInfo * info);
+GstDiscovererInfo *  _gst_discoverer_info_from_variant (GVariant * variant);
+
 /* missing-plugins.c */
 
 GstCaps *copy_and_clean_caps (const GstCaps * caps);
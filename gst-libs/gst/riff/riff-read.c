@@ -32,6 +32,10 @@
 GST_DEBUG_CATEGORY_EXTERN (riff_debug);
 #define GST_CAT_DEFAULT riff_debug
 
+/* how much to pull at once when reading chunks, most header chunks and
+ * the JUNK padding between them are smaller than this */
+#define RIFF_READ_AHEAD_SIZE 4096
+
 /**
  * gst_riff_read_chunk:
  * @element: caller element (used for debugging).
@@ -50,11 +54,13 @@ GstFlowReturn
 gst_riff_read_chunk (GstElement * element,
     GstPad * pad, guint64 * _offset, guint32 * tag, GstBuffer ** _chunk_data)
 {
-  GstBuffer *buf;
+  GstBuffer *buf, *block = NULL;
   GstFlowReturn res;
   GstMapInfo info;
   guint size;
   guint64 offset = *_offset;
+  guint64 block_offset = 0;
+  gsize block_size = 0;
 
   g_return_val_if_fail (element != NULL, GST_FLOW_ERROR);
   g_return_val_if_fail (pad != NULL, GST_FLOW_ERROR);
@@ -63,18 +69,29 @@ gst_riff_read_chunk (GstElement * element,
   g_return_val_if_fail (_chunk_data != NULL, GST_FLOW_ERROR);
 
 skip_junk:
-  size = 8;
-  buf = NULL;
-  if ((res = gst_pad_pull_range (pad, offset, size, &buf)) != GST_FLOW_OK)
-    return res;
-  else if (gst_buffer_get_size (buf) < size)
-    goto too_small;
+  /* read ahead a block instead of just the chunk header, so that small
+   * chunks and JUNK in front of them don't each need another pull */
+  if (block == NULL || offset < block_offset ||
+      offset + 8 > block_offset + block_size) {
+    if (block)
+      gst_buffer_unref (block);
+    block = NULL;
+    if ((res = gst_pad_pull_range (pad, offset, RIFF_READ_AHEAD_SIZE,
+                &block)) != GST_FLOW_OK)
+      return res;
+    block_offset = offset;
+    block_size = gst_buffer_get_size (block);
+    if (block_size < 8) {
+      buf = block;
+      size = 8;
+      goto too_small;
+    }
+  }
 
-  gst_buffer_map (buf, &info, GST_MAP_READ);
-  *tag = GST_READ_UINT32_LE (info.data);
-  size = GST_READ_UINT32_LE (info.data + 4);
-  gst_buffer_unmap (buf, &info);
-  gst_buffer_unref (buf);
+  gst_buffer_map (block, &info, GST_MAP_READ);
+  *tag = GST_READ_UINT32_LE (info.data + (offset - block_offset));
+  size = GST_READ_UINT32_LE (info.data + (offset - block_offset) + 4);
+  gst_buffer_unmap (block, &info);
 
   GST_DEBUG_OBJECT (element, "fourcc=%" GST_FOURCC_FORMAT ", size=%u",
       GST_FOURCC_ARGS (*tag), size);
@@ -88,11 +105,19 @@ skip_junk:
     goto skip_junk;
   }
 
-  buf = NULL;
-  if ((res = gst_pad_pull_range (pad, offset + 8, size, &buf)) != GST_FLOW_OK)
-    return res;
-  else if (gst_buffer_get_size (buf) < size)
-    goto too_small;
+  if (offset + 8 + size <= block_offset + block_size) {
+    /* the whole chunk is in the block already */
+    buf = gst_buffer_copy_region (block, GST_BUFFER_COPY_ALL,
+        offset + 8 - block_offset, size);
+    gst_buffer_unref (block);
+  } else {
+    gst_buffer_unref (block);
+    buf = NULL;
+    if ((res = gst_pad_pull_range (pad, offset + 8, size, &buf)) != GST_FLOW_OK)
+      return res;
+    else if (gst_buffer_get_size (buf) < size)
+      goto too_small;
+  }
 
   *_chunk_data = buf;
   *_offset += 8 + GST_ROUND_UP_2 (size);
@@ -436,6 +436,9 @@ end:
  * Add a new packet of @type to @rtcp. @packet will point to the newly created 
  * packet.
  *
+ * The packet is appended after the data of @rtcp, the existing packets are
+ * not parsed again.
+ *
  * Returns: %TRUE if the packet could be created. This function returns %FALSE
  * if the max mtu is exceeded for the buffer.
  */
@@ -454,9 +457,11 @@ gst_rtcp_buffer_add_packet (GstRTCPBuffer * rtcp, GstRTCPType type,
   g_return_val_if_fail (packet != NULL, FALSE);
   g_return_val_if_fail (rtcp->map.flags & GST_MAP_WRITE, FALSE);
 
-  /* find free space */
-  if (gst_rtcp_buffer_get_first_packet (rtcp, packet))
-    while (gst_rtcp_packet_move_to_next (packet));
+  /* the packets written so far end at the current size, the new packet goes
+   * right after them, there is no need to walk the existing packets */
+  packet->rtcp = rtcp;
+  packet->offset = rtcp->map.size;
+  packet->type = GST_RTCP_TYPE_INVALID;
 
   maxsize = rtcp->map.maxsize;
 
@@ -930,6 +935,85 @@ no_space:
   }
 }
 
+/**
+ * gst_rtcp_packet_add_rbs:
+ * @packet: a valid SR or RR #GstRTCPPacket
+ * @blocks: (array length=n_blocks): the report blocks to add
+ * @n_blocks: the number of report blocks in @blocks
+ *
+ * Add the report blocks in @blocks to @packet. This is the same as calling
+ * gst_rtcp_packet_add_rb() for each of them but only updates the packet
+ * header once.
+ *
+ * Returns: the number of report blocks that were added. This is less than
+ * @n_blocks when the max MTU or #GST_RTCP_MAX_RB_COUNT is reached; the
+ * remaining blocks can then be added to a new packet.
+ *
+ * Since: 1.2
+ */
+guint
+gst_rtcp_packet_add_rbs (GstRTCPPacket * packet,
+    const GstRTCPReportBlock * blocks, guint n_blocks)
+{
+  guint8 *data;
+  guint maxsize, offset, i;
+
+  g_return_val_if_fail (packet != NULL, 0);
+  g_return_val_if_fail (packet->type == GST_RTCP_TYPE_RR ||
+      packet->type == GST_RTCP_TYPE_SR, 0);
+  g_return_val_if_fail (packet->rtcp != NULL, 0);
+  g_return_val_if_fail (packet->rtcp->map.flags & GST_MAP_WRITE, 0);
+  g_return_val_if_fail (blocks != NULL || n_blocks == 0, 0);
+
+  maxsize = packet->rtcp->map.maxsize;
+
+  /* skip header */
+  offset = packet->offset + 4;
+  if (packet->type == GST_RTCP_TYPE_RR)
+    offset += 4;
+  else
+    offset += 24;
+
+  /* move to current index */
+  offset += (packet->count * 24);
+
+  /* clip to the free report blocks and the free space, we need 24 bytes per
+   * block */
+  n_blocks = MIN (n_blocks, GST_RTCP_MAX_RB_COUNT - packet->count);
+  if (offset >= maxsize)
+    n_blocks = 0;
+  else
+    n_blocks = MIN (n_blocks, (maxsize - offset - 1) / 24);
+
+  if (n_blocks == 0)
+    return 0;
+
+  data = packet->rtcp->map.data + offset;
+  for (i = 0; i < n_blocks; i++) {
+    const GstRTCPReportBlock *rb = &blocks[i];
+
+    GST_WRITE_UINT32_BE (data, rb->ssrc);
+    GST_WRITE_UINT32_BE (data + 4,
+        (rb->fractionlost << 24) | (rb->packetslost & 0xffffff));
+    GST_WRITE_UINT32_BE (data + 8, rb->exthighestseq);
+    GST_WRITE_UINT32_BE (data + 12, rb->jitter);
+    GST_WRITE_UINT32_BE (data + 16, rb->lsr);
+    GST_WRITE_UINT32_BE (data + 20, rb->dlsr);
+    data += 24;
+  }
+
+  /* increment packet count and length */
+  data = packet->rtcp->map.data;
+  packet->count += n_blocks;
+  data[packet->offset] = (data[packet->offset] & 0xe0) | packet->count;
+  packet->length += 6 * n_blocks;
+  data[packet->offset + 2] = (packet->length) >> 8;
+  data[packet->offset + 3] = (packet->length) & 0xff;
+  packet->rtcp->map.size += 24 * n_blocks;
+
+  return n_blocks;
+}
+
 /**
  * gst_rtcp_packet_set_rb:
  * @packet: a valid SR or RR #GstRTCPPacket
@@ -1295,7 +1379,7 @@ gst_rtcp_packet_sdes_add_item (GstRTCPPacket * packet, guint32 ssrc)
   offset = packet->item_offset;
 
   /* we need 2 free words now */
-  if (offset + 8 >= maxsize)
+  if (packet->offset + offset + 8 >= maxsize)
     goto no_next;
 
   /* write SSRC */
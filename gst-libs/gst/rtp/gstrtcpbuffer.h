@@ -208,6 +208,31 @@ struct _GstRTCPPacket
   guint          entry_offset; /* current entry offset for navigating SDES items */
 };
 
+/**
+ * GstRTCPReportBlock:
+ * @ssrc: data source being reported
+ * @fractionlost: fraction lost since last SR/RR
+ * @packetslost: the cumululative number of packets lost
+ * @exthighestseq: the extended last sequence number received
+ * @jitter: the interarrival jitter
+ * @lsr: the last SR packet from this source
+ * @dlsr: the delay since last SR packet
+ *
+ * The values of a report block, used to add report blocks in bulk with
+ * gst_rtcp_packet_add_rbs().
+ *
+ * Since: 1.2
+ */
+typedef struct {
+  guint32 ssrc;
+  guint8  fractionlost;
+  gint32  packetslost;
+  guint32 exthighestseq;
+  guint32 jitter;
+  guint32 lsr;
+  guint32 dlsr;
+} GstRTCPReportBlock;
+
 /* creating buffers */
 GstBuffer*      gst_rtcp_buffer_new_take_data     (gpointer data, guint len);
 GstBuffer*      gst_rtcp_buffer_new_copy_data     (gpointer data, guint len);
@@ -258,6 +283,9 @@ gboolean        gst_rtcp_packet_add_rb                (GstRTCPPacket *packet, gu
                                                        guint8 fractionlost, gint32 packetslost,
                                                        guint32 exthighestseq, guint32 jitter,
                                                        guint32 lsr, guint32 dlsr);
+guint           gst_rtcp_packet_add_rbs               (GstRTCPPacket *packet,
+                                                       const GstRTCPReportBlock *blocks,
+                                                       guint n_blocks);
 void            gst_rtcp_packet_set_rb                (GstRTCPPacket *packet, guint nth, guint32 ssrc,
                                                        guint8 fractionlost, gint32 packetslost,
                                                        guint32 exthighestseq, guint32 jitter,
@@ -68,7 +68,7 @@
 GST_DEBUG_CATEGORY_STATIC (rtpbaseaudiopayload_debug);
 #define GST_CAT_DEFAULT (rtpbaseaudiopayload_debug)
 
-#define DEFAULT_BUFFER_LIST             FALSE
+#define DEFAULT_BUFFER_LIST             TRUE
 
 enum
 {
@@ -178,6 +178,13 @@ gst_rtp_base_audio_payload_class_init (GstRTPBaseAudioPayloadClass * klass)
   gobject_class->set_property = gst_rtp_base_audio_payload_set_property;
   gobject_class->get_property = gst_rtp_base_audio_payload_get_property;
 
+  /**
+   * GstRTPBaseAudioPayload:buffer-list:
+   *
+   * Don't copy the data into the packets. The memory of the input buffers
+   * is attached as the payload behind a pooled RTP header instead. Set to
+   * %FALSE to get packets with one contiguous memory block.
+   */
   g_object_class_install_property (G_OBJECT_CLASS (klass), PROP_BUFFER_LIST,
       g_param_spec_boolean ("buffer-list", "Buffer List",
           "Use Buffer Lists",
@@ -234,10 +241,7 @@ gst_rtp_base_audio_payload_set_property (GObject * object,
 
   switch (prop_id) {
     case PROP_BUFFER_LIST:
-#if 0
       payload->priv->buffer_list = g_value_get_boolean (value);
-#endif
-      payload->priv->buffer_list = FALSE;
       break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -460,7 +464,8 @@ gst_rtp_base_audio_payload_push (GstRTPBaseAudioPayload * baseaudiopayload,
       payload_len, GST_TIME_ARGS (timestamp));
 
   /* create buffer to hold the payload */
-  outbuf = gst_rtp_buffer_new_allocate (payload_len, 0, 0);
+  outbuf = gst_rtp_base_payload_allocate_output_buffer (basepayload,
+      payload_len, 0, 0);
 
   /* copy payload */
   gst_rtp_buffer_map (outbuf, GST_MAP_WRITE, &rtp);
@@ -497,48 +502,32 @@ gst_rtp_base_audio_payload_push_buffer (GstRTPBaseAudioPayload *
       payload_len, GST_TIME_ARGS (timestamp));
 
   if (priv->buffer_list) {
-    /* create just the RTP header buffer */
-    outbuf = gst_rtp_buffer_new_allocate (0, 0, 0);
-  } else {
-    /* create buffer to hold the payload */
-    outbuf = gst_rtp_buffer_new_allocate (payload_len, 0, 0);
-  }
-
-  /* set metadata */
-  gst_rtp_base_audio_payload_set_meta (baseaudiopayload, outbuf, payload_len,
-      timestamp);
-
-  if (priv->buffer_list) {
-    GstBufferList *list;
-    guint i, len;
-
-    list = gst_buffer_list_new ();
-    len = gst_buffer_list_length (list);
-
-    for (i = 0; i < len; i++) {
-      /* FIXME */
-      g_warning ("bufferlist not implemented");
-      gst_buffer_list_add (list, outbuf);
-      gst_buffer_list_add (list, buffer);
-    }
-
-    GST_DEBUG_OBJECT (baseaudiopayload, "Pushing list %p", list);
-    ret = gst_rtp_base_payload_push_list (basepayload, list);
+    /* take a pooled RTP header and use the memory of the buffer as the
+     * payload */
+    outbuf = gst_rtp_base_payload_allocate_output_buffer (basepayload, 0, 0, 0);
+    outbuf = gst_buffer_append (outbuf, buffer);
   } else {
     GstRTPBuffer rtp = { NULL };
 
+    /* create buffer to hold the payload */
+    outbuf = gst_rtp_base_payload_allocate_output_buffer (basepayload,
+        payload_len, 0, 0);
+
     /* copy payload */
     gst_rtp_buffer_map (outbuf, GST_MAP_WRITE, &rtp);
     payload = gst_rtp_buffer_get_payload (&rtp);
     gst_buffer_extract (buffer, 0, payload, payload_len);
     gst_rtp_buffer_unmap (&rtp);
-
     gst_buffer_unref (buffer);
-
-    GST_DEBUG_OBJECT (baseaudiopayload, "Pushing buffer %p", outbuf);
-    ret = gst_rtp_base_payload_push (basepayload, outbuf);
   }
 
+  /* set metadata */
+  gst_rtp_base_audio_payload_set_meta (baseaudiopayload, outbuf, payload_len,
+      timestamp);
+
+  GST_DEBUG_OBJECT (baseaudiopayload, "Pushing buffer %p", outbuf);
+  ret = gst_rtp_base_payload_push (basepayload, outbuf);
+
   return ret;
 }
 
@@ -608,11 +597,28 @@ gst_rtp_base_audio_payload_flush (GstRTPBaseAudioPayload * baseaudiopayload,
     ret =
         gst_rtp_base_audio_payload_push_buffer (baseaudiopayload, buffer,
         timestamp);
+  } else if (priv->buffer_list) {
+    GList *buffers, *walk;
+
+    /* the payload spans several input buffers, take them out of the adapter
+     * and append all their memory behind the header */
+    outbuf = gst_rtp_base_payload_allocate_output_buffer (basepayload, 0, 0, 0);
+    buffers = gst_adapter_take_list (adapter, payload_len);
+    for (walk = buffers; walk; walk = g_list_next (walk))
+      outbuf = gst_buffer_append (outbuf, walk->data);
+    g_list_free (buffers);
+
+    /* set metadata */
+    gst_rtp_base_audio_payload_set_meta (baseaudiopayload, outbuf, payload_len,
+        timestamp);
+
+    ret = gst_rtp_base_payload_push (basepayload, outbuf);
   } else {
     GstRTPBuffer rtp = { NULL };
 
     /* create buffer to hold the payload */
-    outbuf = gst_rtp_buffer_new_allocate (payload_len, 0, 0);
+    outbuf = gst_rtp_base_payload_allocate_output_buffer (basepayload,
+        payload_len, 0, 0);
 
     /* copy payload */
     gst_rtp_buffer_map (outbuf, GST_MAP_WRITE, &rtp);
@@ -73,6 +73,8 @@ static void gst_rtp_base_depayload_get_property (GObject * object,
 
 static GstFlowReturn gst_rtp_base_depayload_chain (GstPad * pad,
     GstObject * parent, GstBuffer * in);
+static GstFlowReturn gst_rtp_base_depayload_chain_list (GstPad * pad,
+    GstObject * parent, GstBufferList * list);
 static gboolean gst_rtp_base_depayload_handle_sink_event (GstPad * pad,
     GstObject * parent, GstEvent * event);
 
@@ -157,6 +159,8 @@ gst_rtp_base_depayload_init (GstRTPBaseDepayload * filter,
   g_return_if_fail (pad_template != NULL);
   filter->sinkpad = gst_pad_new_from_template (pad_template, "sink");
   gst_pad_set_chain_function (filter->sinkpad, gst_rtp_base_depayload_chain);
+  gst_pad_set_chain_list_function (filter->sinkpad,
+      gst_rtp_base_depayload_chain_list);
   gst_pad_set_event_function (filter->sinkpad,
       gst_rtp_base_depayload_handle_sink_event);
   gst_element_add_pad (GST_ELEMENT (filter), filter->sinkpad);
@@ -256,14 +260,14 @@ caps_not_changed:
   }
 }
 
-static GstFlowReturn
-gst_rtp_base_depayload_chain (GstPad * pad, GstObject * parent, GstBuffer * in)
+/* check the seqnum of @in and remember its timestamps for the outgoing
+ * buffers. Returns the packet, possibly marked DISCONT, or %NULL when it was
+ * dropped. */
+static GstBuffer *
+gst_rtp_base_depayload_check_packet (GstRTPBaseDepayload * filter,
+    GstBuffer * in)
 {
-  GstRTPBaseDepayload *filter;
   GstRTPBaseDepayloadPrivate *priv;
-  GstRTPBaseDepayloadClass *bclass;
-  GstFlowReturn ret = GST_FLOW_OK;
-  GstBuffer *out_buf;
   GstClockTime pts, dts;
   guint16 seqnum;
   guint32 rtptime;
@@ -271,13 +275,8 @@ gst_rtp_base_depayload_chain (GstPad * pad, GstObject * parent, GstBuffer * in)
   gint gap;
   GstRTPBuffer rtp = { NULL };
 
-  filter = GST_RTP_BASE_DEPAYLOAD (parent);
   priv = filter->priv;
 
-  /* we must have a setcaps first */
-  if (G_UNLIKELY (!priv->negotiated))
-    goto not_negotiated;
-
   if (G_UNLIKELY (!gst_rtp_buffer_map (in, GST_MAP_READ, &rtp)))
     goto invalid_buffer;
 
@@ -344,10 +343,35 @@ gst_rtp_base_depayload_chain (GstPad * pad, GstObject * parent, GstBuffer * in)
     GST_BUFFER_FLAG_SET (in, GST_BUFFER_FLAG_DISCONT);
   }
 
-  bclass = GST_RTP_BASE_DEPAYLOAD_GET_CLASS (filter);
+  return in;
 
-  if (G_UNLIKELY (bclass->process == NULL))
-    goto no_process;
+  /* ERRORS */
+invalid_buffer:
+  {
+    /* this is not fatal but should be filtered earlier */
+    GST_ELEMENT_WARNING (filter, STREAM, DECODE, (NULL),
+        ("Received invalid RTP payload, dropping"));
+    gst_buffer_unref (in);
+    return NULL;
+  }
+dropping:
+  {
+    GST_WARNING_OBJECT (filter, "%d <= 100, dropping old packet", gap);
+    gst_buffer_unref (in);
+    return NULL;
+  }
+}
+
+static GstFlowReturn
+gst_rtp_base_depayload_process_packet (GstRTPBaseDepayload * filter,
+    GstRTPBaseDepayloadClass * bclass, GstBuffer * in)
+{
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstBuffer *out_buf;
+
+  in = gst_rtp_base_depayload_check_packet (filter, in);
+  if (G_UNLIKELY (in == NULL))
+    return GST_FLOW_OK;
 
   /* let's send it out to processing */
   out_buf = bclass->process (filter, in);
@@ -357,42 +381,148 @@ gst_rtp_base_depayload_chain (GstPad * pad, GstObject * parent, GstBuffer * in)
   gst_buffer_unref (in);
 
   return ret;
+}
+
+static void
+post_not_negotiated (GstRTPBaseDepayload * filter)
+{
+  /* this is not fatal but should be filtered earlier */
+  GST_ELEMENT_ERROR (filter, CORE, NEGOTIATION,
+      ("No RTP format was negotiated."),
+      ("Input buffers need to have RTP caps set on them. This is usually "
+          "achieved by setting the 'caps' property of the upstream source "
+          "element (often udpsrc or appsrc), or by putting a capsfilter "
+          "element before the depayloader and setting the 'caps' property "
+          "on that. Also see http://cgit.freedesktop.org/gstreamer/"
+          "gst-plugins-good/tree/gst/rtp/README"));
+}
+
+static GstFlowReturn
+gst_rtp_base_depayload_chain (GstPad * pad, GstObject * parent, GstBuffer * in)
+{
+  GstRTPBaseDepayload *filter;
+  GstRTPBaseDepayloadClass *bclass;
+
+  filter = GST_RTP_BASE_DEPAYLOAD (parent);
+
+  /* we must have a setcaps first */
+  if (G_UNLIKELY (!filter->priv->negotiated))
+    goto not_negotiated;
+
+  bclass = GST_RTP_BASE_DEPAYLOAD_GET_CLASS (filter);
+
+  if (G_UNLIKELY (bclass->process == NULL))
+    goto no_process;
+
+  return gst_rtp_base_depayload_process_packet (filter, bclass, in);
 
   /* ERRORS */
 not_negotiated:
   {
-    /* this is not fatal but should be filtered earlier */
-    GST_ELEMENT_ERROR (filter, CORE, NEGOTIATION,
-        ("No RTP format was negotiated."),
-        ("Input buffers need to have RTP caps set on them. This is usually "
-            "achieved by setting the 'caps' property of the upstream source "
-            "element (often udpsrc or appsrc), or by putting a capsfilter "
-            "element before the depayloader and setting the 'caps' property "
-            "on that. Also see http://cgit.freedesktop.org/gstreamer/"
-            "gst-plugins-good/tree/gst/rtp/README"));
+    post_not_negotiated (filter);
     gst_buffer_unref (in);
     return GST_FLOW_NOT_NEGOTIATED;
   }
-invalid_buffer:
+no_process:
   {
     /* this is not fatal but should be filtered earlier */
-    GST_ELEMENT_WARNING (filter, STREAM, DECODE, (NULL),
-        ("Received invalid RTP payload, dropping"));
+    GST_ELEMENT_ERROR (filter, STREAM, NOT_IMPLEMENTED, (NULL),
+        ("The subclass does not have a process method"));
     gst_buffer_unref (in);
+    return GST_FLOW_ERROR;
+  }
+}
+
+static GstFlowReturn
+gst_rtp_base_depayload_chain_list (GstPad * pad, GstObject * parent,
+    GstBufferList * list)
+{
+  GstRTPBaseDepayload *filter;
+  GstRTPBaseDepayloadPrivate *priv;
+  GstRTPBaseDepayloadClass *bclass;
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstBufferList *in_list, *out_list;
+  GstBuffer *in;
+  GstClockTime pts = GST_CLOCK_TIME_NONE, dts = GST_CLOCK_TIME_NONE;
+  GstClockTime duration = GST_CLOCK_TIME_NONE;
+  guint i, len;
+
+  filter = GST_RTP_BASE_DEPAYLOAD (parent);
+  priv = filter->priv;
+
+  /* we must have a setcaps first */
+  if (G_UNLIKELY (!priv->negotiated))
+    goto not_negotiated;
+
+  bclass = GST_RTP_BASE_DEPAYLOAD_GET_CLASS (filter);
+
+  len = gst_buffer_list_length (list);
+
+  if (bclass->process_list == NULL) {
+    if (G_UNLIKELY (bclass->process == NULL))
+      goto no_process;
+
+    /* handle the packets one by one without going through the pad again */
+    for (i = 0; i < len && ret == GST_FLOW_OK; i++) {
+      in = gst_buffer_ref (gst_buffer_list_get (list, i));
+      ret = gst_rtp_base_depayload_process_packet (filter, bclass, in);
+    }
+    gst_buffer_list_unref (list);
+
+    return ret;
+  }
+
+  /* check all packets and give the valid ones to the subclass at once */
+  in_list = gst_buffer_list_new_sized (len);
+  for (i = 0; i < len; i++) {
+    in = gst_buffer_ref (gst_buffer_list_get (list, i));
+    in = gst_rtp_base_depayload_check_packet (filter, in);
+    if (G_UNLIKELY (in == NULL))
+      continue;
+
+    if (gst_buffer_list_length (in_list) == 0) {
+      pts = priv->pts;
+      dts = priv->dts;
+      duration = priv->duration;
+    }
+    gst_buffer_list_add (in_list, in);
+  }
+  gst_buffer_list_unref (list);
+
+  if (G_UNLIKELY (gst_buffer_list_length (in_list) == 0)) {
+    gst_buffer_list_unref (in_list);
     return GST_FLOW_OK;
   }
-dropping:
+
+  /* the first packet of the list provides the timestamps of the output */
+  priv->pts = pts;
+  priv->dts = dts;
+  priv->duration = duration;
+
+  out_list = bclass->process_list (filter, in_list);
+  if (out_list) {
+    if (gst_buffer_list_length (out_list) > 0)
+      ret = gst_rtp_base_depayload_push_list (filter, out_list);
+    else
+      gst_buffer_list_unref (out_list);
+  }
+  gst_buffer_list_unref (in_list);
+
+  return ret;
+
+  /* ERRORS */
+not_negotiated:
   {
-    GST_WARNING_OBJECT (filter, "%d <= 100, dropping old packet", gap);
-    gst_buffer_unref (in);
-    return GST_FLOW_OK;
+    post_not_negotiated (filter);
+    gst_buffer_list_unref (list);
+    return GST_FLOW_NOT_NEGOTIATED;
   }
 no_process:
   {
     /* this is not fatal but should be filtered earlier */
     GST_ELEMENT_ERROR (filter, STREAM, NOT_IMPLEMENTED, (NULL),
         ("The subclass does not have a process method"));
-    gst_buffer_unref (in);
+    gst_buffer_list_unref (list);
     return GST_FLOW_ERROR;
   }
 }
@@ -69,6 +69,7 @@ struct _GstRTPBaseDepayload
  * @process: process incoming rtp packets
  * @packet_lost: signal the depayloader about packet loss
  * @handle_event: custom event handling
+ * @process_list: process a list of incoming rtp packets. Since: 1.2
  *
  * Base class for audio RTP payloader.
  */
@@ -95,8 +96,15 @@ struct _GstRTPBaseDepayloadClass
    * implementation can override. */
   gboolean (*handle_event) (GstRTPBaseDepayload * filter, GstEvent * event);
 
+  /* optional, process a list of incoming rtp packets at once. The packets
+   * have been checked and the timestamp of the first packet is applied to
+   * the result buffers without a valid timestamp. If this function returns
+   * %NULL, nothing is pushed. When not implemented, @process is called for
+   * each packet of the list. */
+  GstBufferList * (*process_list) (GstRTPBaseDepayload *base, GstBufferList *in);
+
   /*< private >*/
-  gpointer _gst_reserved[GST_PADDING];
+  gpointer _gst_reserved[GST_PADDING - 1];
 };
 
 GType gst_rtp_base_depayload_get_type (void);
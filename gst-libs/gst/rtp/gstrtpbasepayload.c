@@ -17,6 +17,13 @@
  * @short_description: Base class for RTP payloader
  *
  * Provides a base class for RTP payloaders
+ *
+ * Subclasses that put parts of their input buffers in packets unchanged
+ * can create the packets with gst_rtp_buffer_new_share_payload(). The
+ * packets then consist of a small header memory followed by the shared
+ * memory of the input buffer, so that the payload is not copied. The
+ * header fields of the packets are filled in by
+ * gst_rtp_base_payload_push() and gst_rtp_base_payload_push_list().
  */
 
 #ifdef HAVE_CONFIG_H
@@ -26,6 +33,7 @@
 #include <string.h>
 
 #include <gst/rtp/gstrtpbuffer.h>
+#include <gst/rtp/gstrtpbufferpool.h>
 
 #include "gstrtpbasepayload.h"
 
@@ -54,6 +62,10 @@ struct _GstRTPBasePayloadPrivate
 
   gboolean delay_segment;
   GstEvent *pending_segment;
+
+  /* pool of MTU sized output packets */
+  GstBufferPool *pool;
+  guint pool_size;
 };
 
 /* RTPBasePayload signals and args */
@@ -79,6 +91,9 @@ enum
 #define DEFAULT_PERFECT_RTPTIME         TRUE
 #define DEFAULT_PTIME_MULTIPLE          0
 
+/* packets preallocated in the output pool */
+#define DEFAULT_POOL_MIN_BUFFERS        16
+
 enum
 {
   PROP_0,
@@ -100,6 +115,7 @@ static void gst_rtp_base_payload_class_init (GstRTPBasePayloadClass * klass);
 static void gst_rtp_base_payload_init (GstRTPBasePayload * rtpbasepayload,
     gpointer g_class);
 static void gst_rtp_base_payload_finalize (GObject * object);
+static void gst_rtp_base_payload_clear_pool (GstRTPBasePayload * payload);
 
 static GstCaps *gst_rtp_base_payload_getcaps_default (GstRTPBasePayload *
     rtpbasepayload, GstPad * pad, GstCaps * filter);
@@ -314,6 +330,7 @@ gst_rtp_base_payload_finalize (GObject * object)
   rtpbasepayload->media = NULL;
   g_free (rtpbasepayload->encoding_name);
   rtpbasepayload->encoding_name = NULL;
+  gst_rtp_base_payload_clear_pool (rtpbasepayload);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -740,6 +757,119 @@ gst_rtp_base_payload_is_filled (GstRTPBasePayload * payload,
   return FALSE;
 }
 
+static void
+gst_rtp_base_payload_clear_pool (GstRTPBasePayload * payload)
+{
+  GstRTPBasePayloadPrivate *priv = payload->priv;
+
+  if (priv->pool) {
+    gst_buffer_pool_set_active (priv->pool, FALSE);
+    gst_object_unref (priv->pool);
+    priv->pool = NULL;
+  }
+  priv->pool_size = 0;
+}
+
+static gboolean
+gst_rtp_base_payload_ensure_pool (GstRTPBasePayload * payload)
+{
+  GstRTPBasePayloadPrivate *priv = payload->priv;
+  GstStructure *config;
+
+  if (priv->pool && priv->pool_size == payload->mtu)
+    return TRUE;
+
+  gst_rtp_base_payload_clear_pool (payload);
+
+  priv->pool = gst_rtp_buffer_pool_new ();
+  config = gst_buffer_pool_get_config (priv->pool);
+  gst_buffer_pool_config_set_params (config, NULL, payload->mtu,
+      DEFAULT_POOL_MIN_BUFFERS, 0);
+  if (!gst_buffer_pool_set_config (priv->pool, config))
+    goto config_failed;
+  if (!gst_buffer_pool_set_active (priv->pool, TRUE))
+    goto activate_failed;
+
+  priv->pool_size = payload->mtu;
+  GST_DEBUG_OBJECT (payload, "created pool of %u byte packets",
+      priv->pool_size);
+
+  return TRUE;
+
+  /* ERRORS */
+config_failed:
+  {
+    GST_WARNING_OBJECT (payload, "failed to configure packet pool");
+    gst_rtp_base_payload_clear_pool (payload);
+    return FALSE;
+  }
+activate_failed:
+  {
+    GST_WARNING_OBJECT (payload, "failed to activate packet pool");
+    gst_rtp_base_payload_clear_pool (payload);
+    return FALSE;
+  }
+}
+
+/**
+ * gst_rtp_base_payload_allocate_output_buffer:
+ * @payload: a #GstRTPBasePayload
+ * @payload_len: the length of the payload
+ * @pad_len: the amount of padding
+ * @csrc_count: the number of CSRC entries
+ *
+ * Allocate a new RTP packet with room for a payload of @payload_len bytes,
+ * @pad_len padding bytes and @csrc_count CSRCs, like
+ * gst_rtp_buffer_new_allocate().
+ *
+ * Packets that fit in the MTU are taken from an internal pool of MTU sized
+ * buffers so that payloaders producing many packets do not need to allocate
+ * memory for each of them. The returned buffer has a valid RTP header with
+ * a zeroed timestamp, payload type, seqnum and SSRC; these are filled in
+ * when the packet is pushed.
+ *
+ * Returns: (transfer full): a newly allocated RTP packet.
+ *
+ * Since: 1.2
+ */
+GstBuffer *
+gst_rtp_base_payload_allocate_output_buffer (GstRTPBasePayload * payload,
+    guint payload_len, guint8 pad_len, guint8 csrc_count)
+{
+  GstBuffer *buffer = NULL;
+  GstMapInfo map;
+  guint packet_len, header_len;
+
+  g_return_val_if_fail (GST_IS_RTP_BASE_PAYLOAD (payload), NULL);
+  g_return_val_if_fail (csrc_count <= 15, NULL);
+
+  packet_len = gst_rtp_buffer_calc_packet_len (payload_len, pad_len,
+      csrc_count);
+
+  if (packet_len > payload->mtu || !gst_rtp_base_payload_ensure_pool (payload))
+    return gst_rtp_buffer_new_allocate (payload_len, pad_len, csrc_count);
+
+  if (gst_buffer_pool_acquire_buffer (payload->priv->pool, &buffer,
+          NULL) != GST_FLOW_OK)
+    return gst_rtp_buffer_new_allocate (payload_len, pad_len, csrc_count);
+
+  gst_buffer_resize (buffer, 0, packet_len);
+
+  header_len = gst_rtp_buffer_calc_header_len (csrc_count);
+
+  gst_buffer_map (buffer, &map, GST_MAP_WRITE);
+  memset (map.data, 0, header_len);
+  /* version 2, padding bit and CSRC count */
+  map.data[0] = (GST_RTP_VERSION << 6) | csrc_count;
+  if (pad_len) {
+    map.data[0] |= 0x20;
+    map.data[packet_len - 1] = pad_len;
+  }
+  gst_buffer_unmap (buffer, &map);
+
+  return buffer;
+}
+
 typedef struct
 {
   GstRTPBasePayload *payload;
@@ -774,7 +904,9 @@ set_headers (GstBuffer ** buffer, guint idx, gpointer user_data)
   HeaderData *data = user_data;
   GstRTPBuffer rtp = { NULL, };
 
-  if (!gst_rtp_buffer_map (*buffer, GST_MAP_WRITE, &rtp))
+  /* only the header is changed */
+  if (!gst_rtp_buffer_map (*buffer,
+          GST_MAP_WRITE | GST_RTP_BUFFER_MAP_FLAG_SKIP_PADDING, &rtp))
     goto map_failed;
 
   gst_rtp_buffer_set_ssrc (&rtp, data->ssrc);
@@ -869,7 +1001,9 @@ gst_rtp_base_payload_prepare_push (GstRTPBasePayload * payload,
 
   /* set ssrc, payload type, seq number, caps and rtptime */
   if (is_list) {
-    gst_buffer_list_foreach (GST_BUFFER_LIST_CAST (obj), set_headers, &data);
+    data.seqnum =
+        gst_rtp_buffer_list_set_headers (GST_BUFFER_LIST_CAST (obj), data.ssrc,
+        data.pt, data.seqnum, data.rtptime, 0);
   } else {
     GstBuffer *buf = GST_BUFFER_CAST (obj);
     set_headers (&buf, 0, &data);
@@ -1132,6 +1266,7 @@ gst_rtp_base_payload_change_state (GstElement * element,
       break;
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       gst_event_replace (&rtpbasepayload->priv->pending_segment, NULL);
+      gst_rtp_base_payload_clear_pool (rtpbasepayload);
       break;
     default:
       break;
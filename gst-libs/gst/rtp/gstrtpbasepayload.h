@@ -159,6 +159,10 @@ gboolean        gst_rtp_base_payload_set_outcaps        (GstRTPBasePayload *payl
 gboolean        gst_rtp_base_payload_is_filled          (GstRTPBasePayload *payload,
                                                          guint size, GstClockTime duration);
 
+GstBuffer *     gst_rtp_base_payload_allocate_output_buffer (GstRTPBasePayload *payload,
+                                                         guint payload_len, guint8 pad_len,
+                                                         guint8 csrc_count);
+
 GstFlowReturn   gst_rtp_base_payload_push               (GstRTPBasePayload *payload,
                                                          GstBuffer *buffer);
 
@@ -215,6 +215,55 @@ gst_rtp_buffer_new_allocate (guint payload_len, guint8 pad_len,
   return result;
 }
 
+/**
+ * gst_rtp_buffer_new_share_payload:
+ * @payload: a #GstBuffer with the payload data
+ * @offset: the offset of the payload in @payload
+ * @size: the size of the payload or -1 for the rest of @payload
+ * @pad_len: the amount of padding
+ * @csrc_count: the number of CSRC entries
+ *
+ * Create a new #GstBuffer with an RTP packet that has the @size bytes of
+ * @payload at @offset as payload, without copying them. The packet consists
+ * of a newly allocated header memory with room for @csrc_count CSRCs, the
+ * shared memory of @payload and a memory with @pad_len bytes of padding.
+ * All other RTP header fields will be set to 0/FALSE.
+ *
+ * Payloaders can use this instead of gst_rtp_buffer_new_allocate() and
+ * copying the input data into the payload. The payload is read-only in the
+ * resulting packet, the header can be changed.
+ *
+ * Returns: A new RTP packet with the payload of @payload.
+ *
+ * Since: 1.2
+ */
+GstBuffer *
+gst_rtp_buffer_new_share_payload (GstBuffer * payload, gsize offset,
+    gsize size, guint8 pad_len, guint8 csrc_count)
+{
+  GstBuffer *result;
+  GstMemory *padding = NULL;
+
+  g_return_val_if_fail (GST_IS_BUFFER (payload), NULL);
+  g_return_val_if_fail (csrc_count <= 15, NULL);
+
+  result = gst_buffer_new ();
+  gst_rtp_buffer_allocate_data (result, 0, pad_len, csrc_count);
+
+  /* the padding goes after the payload */
+  if (pad_len) {
+    padding = gst_buffer_get_memory (result, 1);
+    gst_buffer_remove_memory (result, 1);
+  }
+
+  gst_buffer_copy_into (result, payload, GST_BUFFER_COPY_MEMORY, offset, size);
+
+  if (padding)
+    gst_buffer_append_memory (result, padding);
+
+  return result;
+}
+
 /**
  * gst_rtp_buffer_new_allocate_len:
  * @packet_len: the total length of the packet
@@ -308,6 +357,13 @@ gst_rtp_buffer_calc_payload_len (guint packet_len, guint8 pad_len,
  *
  * Map the contents of @buffer into @rtp.
  *
+ * Only the memory with the header and the extension is mapped. The payload
+ * is mapped when it is first requested. When
+ * #GST_RTP_BUFFER_MAP_FLAG_SKIP_PADDING is in @flags, the padding is not
+ * mapped and checked either, so that the memory with the payload is not
+ * mapped at all when it is not also holding the header. The payload then
+ * includes the padding.
+ *
  * Returns: %TRUE if @buffer could be mapped.
  */
 gboolean
@@ -321,6 +377,7 @@ gst_rtp_buffer_map (GstBuffer * buffer, GstMapFlags flags, GstRTPBuffer * rtp)
   guint size;
   gsize bufsize, skip;
   guint idx, length;
+  gboolean skip_padding;
 
   g_return_val_if_fail (GST_IS_BUFFER (buffer), FALSE);
   g_return_val_if_fail (rtp != NULL, FALSE);
@@ -329,6 +386,10 @@ gst_rtp_buffer_map (GstBuffer * buffer, GstMapFlags flags, GstRTPBuffer * rtp)
   if (gst_buffer_n_memory (buffer) < 1)
     goto no_memory;
 
+  /* the memories are mapped with the core flags only */
+  skip_padding = (flags & GST_RTP_BUFFER_MAP_FLAG_SKIP_PADDING) != 0;
+  flags &= GST_MAP_FLAG_LAST - 1;
+
   /* map first memory, this should be the header */
   if (!gst_buffer_map_range (buffer, 0, 1, &rtp->map[0], flags))
     goto map_failed;
@@ -389,7 +450,7 @@ gst_rtp_buffer_map (GstBuffer * buffer, GstMapFlags flags, GstRTPBuffer * rtp)
   }
 
   /* check for padding */
-  if (data[0] & 0x20) {
+  if ((data[0] & 0x20) && !skip_padding) {
     /* find memory for the padding bits */
     if (!gst_buffer_find_memory (buffer, bufsize - 1, 1, &idx, &length, &skip))
       goto wrong_length;
@@ -1250,6 +1311,130 @@ gst_rtp_buffer_ext_timestamp (guint64 * exttimestamp, guint32 timestamp)
   return result;
 }
 
+/**
+ * gst_rtp_buffer_list_set_headers:
+ * @list: a #GstBufferList of writable RTP packets
+ * @ssrc: the SSRC of the packets
+ * @payload_type: the payload type of the packets
+ * @seqnum: the sequence number of the first packet
+ * @rtptime: the RTP timestamp of the first packet
+ * @rtptime_delta: the amount to add to the RTP timestamp for each packet
+ *
+ * Sets the SSRC, payload type, sequence number and timestamp of all packets
+ * in @list in one pass. The sequence numbers increase by one for each packet
+ * and the timestamps by @rtptime_delta, use 0 when all packets are part of
+ * the same frame. Only the memory with the fixed header of each packet is
+ * mapped and the packets are not validated further.
+ *
+ * Stops at the first packet that is not a valid RTP packet.
+ *
+ * Returns: the sequence number following the last packet that was changed.
+ *
+ * Since: 1.2
+ */
+guint16
+gst_rtp_buffer_list_set_headers (GstBufferList * list, guint32 ssrc,
+    guint8 payload_type, guint16 seqnum, guint32 rtptime,
+    guint32 rtptime_delta)
+{
+  guint i, len;
+
+  g_return_val_if_fail (GST_IS_BUFFER_LIST (list), seqnum);
+  g_return_val_if_fail (payload_type < 0x80, seqnum);
+
+  len = gst_buffer_list_length (list);
+  for (i = 0; i < len; i++) {
+    GstBuffer *buffer = gst_buffer_list_get (list, i);
+    GstMapInfo map;
+    gboolean valid;
+
+    if (G_UNLIKELY (gst_buffer_n_memory (buffer) < 1))
+      goto invalid_packet;
+
+    /* the fixed header must be in the first memory */
+    if (!gst_buffer_map_range (buffer, 0, 1, &map, GST_MAP_WRITE))
+      goto invalid_packet;
+
+    valid = map.size >= GST_RTP_HEADER_LEN &&
+        GST_RTP_HEADER_VERSION (map.data) == GST_RTP_VERSION;
+    if (G_LIKELY (valid)) {
+      GST_RTP_HEADER_SSRC (map.data) = g_htonl (ssrc);
+      GST_RTP_HEADER_PAYLOAD_TYPE (map.data) = payload_type;
+      GST_RTP_HEADER_SEQ (map.data) = g_htons (seqnum);
+      GST_RTP_HEADER_TIMESTAMP (map.data) = g_htonl (rtptime);
+    }
+    gst_buffer_unmap (buffer, &map);
+
+    if (G_UNLIKELY (!valid))
+      goto invalid_packet;
+
+    seqnum++;
+    rtptime += rtptime_delta;
+  }
+
+  return seqnum;
+
+  /* ERRORS */
+invalid_packet:
+  {
+    GST_ERROR ("packet %u in list %p is not a valid RTP packet", i, list);
+    return seqnum;
+  }
+}
+
+/* reads the RFC 5285 header extension at @offset and moves @offset past it,
+ * padding is skipped. Returns FALSE when there are no more header extensions
+ * or the next one does not fit in @bytelen. */
+static gboolean
+read_extension_header (guint8 * pdata, guint bytelen, gboolean twobytes,
+    guint * offset, guint8 * id, guint8 ** data, guint * size)
+{
+  guint pos = *offset;
+
+  for (;;) {
+    guint8 read_id;
+    guint read_len;
+
+    if (pos + (twobytes ? 2 : 1) >= bytelen)
+      return FALSE;
+
+    if (twobytes) {
+      read_id = GST_READ_UINT8 (pdata + pos);
+      pos += 1;
+
+      /* ID 0 means its padding, skip */
+      if (read_id == 0)
+        continue;
+
+      read_len = GST_READ_UINT8 (pdata + pos);
+      pos += 1;
+    } else {
+      read_id = GST_READ_UINT8 (pdata + pos) >> 4;
+      read_len = (GST_READ_UINT8 (pdata + pos) & 0x0F) + 1;
+      pos += 1;
+
+      /* ID 0 means its padding, skip */
+      if (read_id == 0)
+        continue;
+
+      /* ID 15 is special and means we should stop parsing */
+      if (read_id == 15)
+        return FALSE;
+    }
+
+    /* Ignore extension headers where the size does not fit */
+    if (pos + read_len > bytelen)
+      return FALSE;
+
+    *id = read_id;
+    *data = pdata + pos;
+    *size = read_len;
+    *offset = pos + read_len;
+
+    return TRUE;
+  }
+}
+
 /**
  * gst_rtp_buffer_get_extension_onebyte_header:
  * @rtp: the RTP packet
@@ -1272,8 +1457,11 @@ gst_rtp_buffer_get_extension_onebyte_header (GstRTPBuffer * rtp, guint8 id,
   guint16 bits;
   guint8 *pdata;
   guint wordlen;
-  gulong offset = 0;
+  guint offset = 0;
   guint count = 0;
+  guint8 read_id;
+  guint8 *read_data;
+  guint read_len;
 
   g_return_val_if_fail (id > 0 && id < 15, FALSE);
 
@@ -1284,33 +1472,13 @@ gst_rtp_buffer_get_extension_onebyte_header (GstRTPBuffer * rtp, guint8 id,
   if (bits != 0xBEDE)
     return FALSE;
 
-  for (;;) {
-    guint8 read_id, read_len;
-
-    if (offset + 1 >= wordlen * 4)
-      break;
-
-    read_id = GST_READ_UINT8 (pdata + offset) >> 4;
-    read_len = (GST_READ_UINT8 (pdata + offset) & 0x0F) + 1;
-    offset += 1;
-
-    /* ID 0 means its padding, skip */
-    if (read_id == 0)
-      continue;
-
-    /* ID 15 is special and means we should stop parsing */
-    if (read_id == 15)
-      break;
-
-    /* Ignore extension headers where the size does not fit */
-    if (offset + read_len > wordlen * 4)
-      break;
-
+  while (read_extension_header (pdata, wordlen * 4, FALSE, &offset, &read_id,
+          &read_data, &read_len)) {
     /* If we have the right one */
     if (id == read_id) {
       if (nth == count) {
         if (data)
-          *data = pdata + offset;
+          *data = read_data;
         if (size)
           *size = read_len;
 
@@ -1319,10 +1487,6 @@ gst_rtp_buffer_get_extension_onebyte_header (GstRTPBuffer * rtp, guint8 id,
 
       count++;
     }
-    offset += read_len;
-
-    if (offset >= wordlen * 4)
-      break;
   }
 
   return FALSE;
@@ -1351,9 +1515,11 @@ gst_rtp_buffer_get_extension_twobytes_header (GstRTPBuffer * rtp,
   guint16 bits;
   guint8 *pdata = NULL;
   guint wordlen;
-  guint bytelen;
-  gulong offset = 0;
+  guint offset = 0;
   guint count = 0;
+  guint8 read_id;
+  guint8 *read_data;
+  guint read_len;
 
   if (!gst_rtp_buffer_get_extension_data (rtp, &bits, (gpointer *) & pdata,
           &wordlen))
@@ -1362,32 +1528,13 @@ gst_rtp_buffer_get_extension_twobytes_header (GstRTPBuffer * rtp,
   if (bits >> 4 != 0x100)
     return FALSE;
 
-  bytelen = wordlen * 4;
-
-  for (;;) {
-    guint8 read_id, read_len;
-
-    if (offset + 2 >= bytelen)
-      break;
-
-    read_id = GST_READ_UINT8 (pdata + offset);
-    offset += 1;
-
-    if (read_id == 0)
-      continue;
-
-    read_len = GST_READ_UINT8 (pdata + offset);
-    offset += 1;
-
-    /* Ignore extension headers where the size does not fit */
-    if (offset + read_len > bytelen)
-      break;
-
+  while (read_extension_header (pdata, wordlen * 4, TRUE, &offset, &read_id,
+          &read_data, &read_len)) {
     /* If we have the right one, return it */
     if (id == read_id) {
       if (nth == count) {
         if (data)
-          *data = pdata + offset;
+          *data = read_data;
         if (size)
           *size = read_len;
         if (appbits)
@@ -1398,12 +1545,162 @@ gst_rtp_buffer_get_extension_twobytes_header (GstRTPBuffer * rtp,
 
       count++;
     }
-    offset += read_len;
   }
 
   return FALSE;
 }
 
+/**
+ * gst_rtp_buffer_get_extension_headers:
+ * @rtp: the RTP packet
+ * @appbits: (out) (allow-none): Application specific bits of a two bytes
+ *   header extension, 0 for a one byte header extension
+ * @exts: (out caller-allocates) (array length=n_exts) (allow-none): location
+ *   for the header extensions
+ * @n_exts: the number of elements in @exts
+ *
+ * Parses RFC 5285 style header extensions with a one byte or a two bytes
+ * header in one pass and stores the first @n_exts of them, in the order they
+ * appear in the packet, in @exts. This is cheaper than looking up several
+ * IDs one by one with gst_rtp_buffer_get_extension_onebyte_header() or
+ * gst_rtp_buffer_get_extension_twobytes_header().
+ *
+ * The data of the stored header extensions points into the mapped RTP header
+ * and is valid until @rtp is unmapped or its extension data is changed.
+ *
+ * Returns: the number of header extensions in @rtp, which can be larger
+ *   than @n_exts.
+ *
+ * Since: 1.2
+ */
+guint
+gst_rtp_buffer_get_extension_headers (GstRTPBuffer * rtp, guint8 * appbits,
+    GstRTPHeaderExtension * exts, guint n_exts)
+{
+  guint16 bits;
+  guint8 *pdata = NULL;
+  guint wordlen;
+  gboolean twobytes;
+  guint offset = 0;
+  guint count = 0;
+  guint8 read_id;
+  guint8 *read_data;
+  guint read_len;
+
+  g_return_val_if_fail (exts != NULL || n_exts == 0, 0);
+
+  if (!gst_rtp_buffer_get_extension_data (rtp, &bits, (gpointer *) & pdata,
+          &wordlen))
+    return 0;
+
+  if (bits == 0xBEDE)
+    twobytes = FALSE;
+  else if (bits >> 4 == 0x100)
+    twobytes = TRUE;
+  else
+    return 0;
+
+  if (appbits)
+    *appbits = twobytes ? bits & 0x0F : 0;
+
+  while (read_extension_header (pdata, wordlen * 4, twobytes, &offset,
+          &read_id, &read_data, &read_len)) {
+    if (count < n_exts) {
+      exts[count].id = read_id;
+      exts[count].size = read_len;
+      exts[count].data = read_data;
+    }
+    count++;
+  }
+
+  return count;
+}
+
+/**
+ * gst_rtp_buffer_set_extension_onebyte_header:
+ * @rtp: the RTP packet
+ * @id: The ID of the header extension to be changed (between 1 and 14).
+ * @nth: Change the nth extension packet with the requested ID
+ * @data: (array length=size) (element-type guint8): location for data
+ * @size: the size of the data in bytes
+ *
+ * Overwrites the data of the nth RFC 5285 header extension with a one byte
+ * header and the requested id in place, without moving or reallocating any
+ * of the extension data. This only works when @size is the same as the size
+ * of the existing header extension.
+ *
+ * Returns: %TRUE if the header extension was changed
+ *
+ * Since: 1.2
+ */
+gboolean
+gst_rtp_buffer_set_extension_onebyte_header (GstRTPBuffer * rtp, guint8 id,
+    guint nth, gpointer data, guint size)
+{
+  gpointer old_data;
+  guint old_size;
+
+  g_return_val_if_fail (id > 0 && id < 15, FALSE);
+  g_return_val_if_fail (size >= 1 && size <= 16, FALSE);
+
+  if (!gst_rtp_buffer_get_extension_onebyte_header (rtp, id, nth,
+          &old_data, &old_size))
+    return FALSE;
+
+  g_return_val_if_fail (rtp->map[1].flags & GST_MAP_WRITE, FALSE);
+
+  /* only overwrite in place, anything else needs the extension data to be
+   * rebuilt */
+  if (size != old_size)
+    return FALSE;
+
+  memcpy (old_data, data, size);
+
+  return TRUE;
+}
+
+/**
+ * gst_rtp_buffer_set_extension_twobytes_header:
+ * @rtp: the RTP packet
+ * @id: The ID of the header extension to be changed
+ * @nth: Change the nth extension packet with the requested ID
+ * @data: (array length=size) (element-type guint8): location for data
+ * @size: the size of the data in bytes
+ *
+ * Overwrites the data of the nth RFC 5285 header extension with a two bytes
+ * header and the requested id in place, without moving or reallocating any
+ * of the extension data. This only works when @size is the same as the size
+ * of the existing header extension.
+ *
+ * Returns: %TRUE if the header extension was changed
+ *
+ * Since: 1.2
+ */
+gboolean
+gst_rtp_buffer_set_extension_twobytes_header (GstRTPBuffer * rtp, guint8 id,
+    guint nth, gpointer data, guint size)
+{
+  gpointer old_data;
+  guint old_size;
+
+  g_return_val_if_fail (size < 256, FALSE);
+
+  if (!gst_rtp_buffer_get_extension_twobytes_header (rtp, NULL, id, nth,
+          &old_data, &old_size))
+    return FALSE;
+
+  g_return_val_if_fail (rtp->map[1].flags & GST_MAP_WRITE, FALSE);
+
+  /* only overwrite in place, anything else needs the extension data to be
+   * rebuilt */
+  if (size != old_size)
+    return FALSE;
+
+  memcpy (old_data, data, size);
+
+  return TRUE;
+}
+
 static guint
 get_onebyte_header_end_offset (guint8 * pdata, guint wordlen)
 {
@@ -36,6 +36,20 @@ G_BEGIN_DECLS
  */
 #define GST_RTP_VERSION 2
 
+/**
+ * GstRTPBufferMapFlags:
+ * @GST_RTP_BUFFER_MAP_FLAG_SKIP_PADDING: Skip mapping and checking padding
+ * @GST_RTP_BUFFER_MAP_FLAG_LAST: Offset to define more flags
+ *
+ * Additional mapping flags for gst_rtp_buffer_map().
+ *
+ * Since: 1.2
+ */
+typedef enum {
+  GST_RTP_BUFFER_MAP_FLAG_SKIP_PADDING = (GST_MAP_FLAG_LAST << 0),
+  GST_RTP_BUFFER_MAP_FLAG_LAST = (GST_MAP_FLAG_LAST << 8)
+  /* 8 more flags possible afterwards */
+} GstRTPBufferMapFlags;
 
 typedef struct _GstRTPBuffer GstRTPBuffer;
 
@@ -59,6 +73,24 @@ struct _GstRTPBuffer
   GstMapInfo   map[4];
 };
 
+/**
+ * GstRTPHeaderExtension:
+ * @id: the ID of the header extension
+ * @size: the size of @data in bytes
+ * @data: (array length=size) (element-type guint8): the data of the header
+ *   extension, pointing into the mapped RTP header
+ *
+ * A RFC 5285 header extension as returned by
+ * gst_rtp_buffer_get_extension_headers().
+ *
+ * Since: 1.2
+ */
+typedef struct {
+  guint8    id;
+  guint     size;
+  gpointer  data;
+} GstRTPHeaderExtension;
+
 #define GST_RTP_BUFFER_INIT { NULL, 0, { NULL, NULL, NULL, NULL}, { 0, 0, 0, 0 }, \
   { GST_MAP_INFO_INIT, GST_MAP_INFO_INIT, GST_MAP_INFO_INIT, GST_MAP_INFO_INIT} }
 
@@ -70,6 +102,8 @@ GstBuffer*      gst_rtp_buffer_new_take_data         (gpointer data, gsize len);
 GstBuffer*      gst_rtp_buffer_new_copy_data         (gpointer data, gsize len);
 GstBuffer*      gst_rtp_buffer_new_allocate          (guint payload_len, guint8 pad_len, guint8 csrc_count);
 GstBuffer*      gst_rtp_buffer_new_allocate_len      (guint packet_len, guint8 pad_len, guint8 csrc_count);
+GstBuffer*      gst_rtp_buffer_new_share_payload     (GstBuffer *payload, gsize offset, gsize size,
+                                                      guint8 pad_len, guint8 csrc_count);
 
 guint           gst_rtp_buffer_calc_header_len       (guint8 csrc_count);
 guint           gst_rtp_buffer_calc_packet_len       (guint payload_len, guint8 pad_len, guint8 csrc_count);
@@ -128,6 +162,10 @@ guint32         gst_rtp_buffer_default_clock_rate    (guint8 payload_type);
 gint            gst_rtp_buffer_compare_seqnum        (guint16 seqnum1, guint16 seqnum2);
 guint64         gst_rtp_buffer_ext_timestamp         (guint64 *exttimestamp, guint32 timestamp);
 
+guint16         gst_rtp_buffer_list_set_headers      (GstBufferList *list, guint32 ssrc,
+                                                      guint8 payload_type, guint16 seqnum,
+                                                      guint32 rtptime, guint32 rtptime_delta);
+
 gboolean        gst_rtp_buffer_get_extension_onebyte_header  (GstRTPBuffer *rtp,
                                                               guint8 id,
                                                               guint nth,
@@ -139,6 +177,10 @@ gboolean        gst_rtp_buffer_get_extension_twobytes_header (GstRTPBuffer *rtp,
                                                               guint nth,
                                                               gpointer * data,
                                                               guint * size);
+guint           gst_rtp_buffer_get_extension_headers         (GstRTPBuffer *rtp,
+                                                              guint8 * appbits,
+                                                              GstRTPHeaderExtension * exts,
+                                                              guint n_exts);
 
 gboolean       gst_rtp_buffer_add_extension_onebyte_header  (GstRTPBuffer *rtp,
                                                              guint8 id,
@@ -150,6 +192,17 @@ gboolean       gst_rtp_buffer_add_extension_twobytes_header (GstRTPBuffer *rtp,
                                                              gpointer data,
                                                              guint size);
 
+gboolean       gst_rtp_buffer_set_extension_onebyte_header  (GstRTPBuffer *rtp,
+                                                             guint8 id,
+                                                             guint nth,
+                                                             gpointer data,
+                                                             guint size);
+gboolean       gst_rtp_buffer_set_extension_twobytes_header (GstRTPBuffer *rtp,
+                                                             guint8 id,
+                                                             guint nth,
+                                                             gpointer data,
+                                                             guint size);
+
 
 G_END_DECLS
 
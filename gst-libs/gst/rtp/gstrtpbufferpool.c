@@ -0,0 +1,192 @@
+/* GStreamer
+ * Copyright (C) <2013> Wim Taymans <wim.taymans@gmail.com>
+ *
+ * gstrtpbufferpool.c: pool of MTU sized RTP packets
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:gstrtpbufferpool
+ * @short_description: Pool of MTU sized RTP packets
+ * @see_also: #GstBufferPool, #GstRTPBasePayload
+ *
+ * A #GstRTPBufferPool hands out buffers with one memory block of the
+ * configured size, usually the MTU of the payloader. Payloaders acquire a
+ * buffer, shrink it to the size of the packet they are going to make and
+ * write the RTP header and payload into it.
+ *
+ * When a buffer is released, the pool removes any memory that was appended
+ * to it, replaces a first memory block that is too small and restores the
+ * full configured size, so that the next packet again starts with an empty
+ * MTU sized block.
+ *
+ * Since: 1.2
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "gstrtpbufferpool.h"
+
+GST_DEBUG_CATEGORY_STATIC (rtp_buffer_pool_debug);
+#define GST_CAT_DEFAULT rtp_buffer_pool_debug
+
+struct _GstRTPBufferPoolPrivate
+{
+  guint size;
+  GstAllocator *allocator;
+  GstAllocationParams params;
+};
+
+static void gst_rtp_buffer_pool_finalize (GObject * object);
+
+#define GST_RTP_BUFFER_POOL_GET_PRIVATE(obj)  \
+   (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GST_TYPE_RTP_BUFFER_POOL, GstRTPBufferPoolPrivate))
+
+#define gst_rtp_buffer_pool_parent_class parent_class
+G_DEFINE_TYPE (GstRTPBufferPool, gst_rtp_buffer_pool, GST_TYPE_BUFFER_POOL);
+
+static gboolean
+rtp_buffer_pool_set_config (GstBufferPool * pool, GstStructure * config)
+{
+  GstRTPBufferPool *rpool = GST_RTP_BUFFER_POOL_CAST (pool);
+  GstRTPBufferPoolPrivate *priv = rpool->priv;
+  GstCaps *caps;
+  guint size, min_buffers, max_buffers;
+  GstAllocator *allocator;
+  GstAllocationParams params;
+
+  if (!gst_buffer_pool_config_get_params (config, &caps, &size, &min_buffers,
+          &max_buffers))
+    goto wrong_config;
+
+  if (size == 0)
+    goto wrong_size;
+
+  if (!gst_buffer_pool_config_get_allocator (config, &allocator, &params))
+    goto wrong_config;
+
+  if (priv->allocator)
+    gst_object_unref (priv->allocator);
+  if ((priv->allocator = allocator))
+    gst_object_ref (allocator);
+  priv->params = params;
+  priv->size = size;
+
+  GST_LOG_OBJECT (pool, "configured size %u", size);
+
+  return GST_BUFFER_POOL_CLASS (parent_class)->set_config (pool, config);
+
+  /* ERRORS */
+wrong_config:
+  {
+    GST_WARNING_OBJECT (pool, "invalid config");
+    return FALSE;
+  }
+wrong_size:
+  {
+    GST_WARNING_OBJECT (pool, "size must be > 0");
+    return FALSE;
+  }
+}
+
+static void
+rtp_buffer_pool_release (GstBufferPool * pool, GstBuffer * buffer)
+{
+  GstRTPBufferPool *rpool = GST_RTP_BUFFER_POOL_CAST (pool);
+  GstRTPBufferPoolPrivate *priv = rpool->priv;
+  gsize offset, maxsize;
+  guint n_mem;
+
+  /* the payloader may have added the payload as extra memory, drop it */
+  n_mem = gst_buffer_n_memory (buffer);
+  if (n_mem > 1)
+    gst_buffer_remove_memory_range (buffer, 1, -1);
+
+  gst_buffer_get_sizes (buffer, &offset, &maxsize);
+  if (n_mem == 0 || maxsize < priv->size) {
+    GST_LOG_OBJECT (pool, "replacing memory of %" G_GSIZE_FORMAT " bytes",
+        maxsize);
+    gst_buffer_remove_all_memory (buffer);
+    gst_buffer_append_memory (buffer,
+        gst_allocator_alloc (priv->allocator, priv->size, &priv->params));
+  } else {
+    gst_buffer_resize (buffer, -offset, priv->size);
+  }
+
+  GST_BUFFER_POOL_CLASS (parent_class)->release_buffer (pool, buffer);
+}
+
+static void
+gst_rtp_buffer_pool_class_init (GstRTPBufferPoolClass * klass)
+{
+  GObjectClass *gobject_class = (GObjectClass *) klass;
+  GstBufferPoolClass *gstbufferpool_class = (GstBufferPoolClass *) klass;
+
+  g_type_class_add_private (klass, sizeof (GstRTPBufferPoolPrivate));
+
+  gobject_class->finalize = gst_rtp_buffer_pool_finalize;
+
+  gstbufferpool_class->set_config = rtp_buffer_pool_set_config;
+  gstbufferpool_class->release_buffer = rtp_buffer_pool_release;
+
+  GST_DEBUG_CATEGORY_INIT (rtp_buffer_pool_debug, "rtpbufferpool", 0,
+      "RTP buffer pool");
+}
+
+static void
+gst_rtp_buffer_pool_init (GstRTPBufferPool * pool)
+{
+  pool->priv = GST_RTP_BUFFER_POOL_GET_PRIVATE (pool);
+}
+
+static void
+gst_rtp_buffer_pool_finalize (GObject * object)
+{
+  GstRTPBufferPool *pool = GST_RTP_BUFFER_POOL_CAST (object);
+  GstRTPBufferPoolPrivate *priv = pool->priv;
+
+  GST_LOG_OBJECT (pool, "finalize RTP buffer pool %p", pool);
+
+  if (priv->allocator)
+    gst_object_unref (priv->allocator);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+/**
+ * gst_rtp_buffer_pool_new:
+ *
+ * Create a new bufferpool of RTP packets. Configure it with the maximum
+ * packet size, usually the MTU, as the buffer size.
+ *
+ * Returns: a new #GstBufferPool
+ *
+ * Since: 1.2
+ */
+GstBufferPool *
+gst_rtp_buffer_pool_new (void)
+{
+  GstRTPBufferPool *pool;
+
+  pool = g_object_new (GST_TYPE_RTP_BUFFER_POOL, NULL);
+
+  GST_LOG_OBJECT (pool, "new RTP buffer pool %p", pool);
+
+  return GST_BUFFER_POOL_CAST (pool);
+}
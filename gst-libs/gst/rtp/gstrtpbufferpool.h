@@ -0,0 +1,64 @@
+/* GStreamer
+ * Copyright (C) <2013> Wim Taymans <wim.taymans@gmail.com>
+ *
+ * gstrtpbufferpool.h: pool of MTU sized RTP packets
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_RTP_BUFFER_POOL_H__
+#define __GST_RTP_BUFFER_POOL_H__
+
+#include <gst/gst.h>
+
+G_BEGIN_DECLS
+
+typedef struct _GstRTPBufferPool GstRTPBufferPool;
+typedef struct _GstRTPBufferPoolClass GstRTPBufferPoolClass;
+typedef struct _GstRTPBufferPoolPrivate GstRTPBufferPoolPrivate;
+
+#define GST_TYPE_RTP_BUFFER_POOL      (gst_rtp_buffer_pool_get_type())
+#define GST_IS_RTP_BUFFER_POOL(obj)   (G_TYPE_CHECK_INSTANCE_TYPE ((obj), GST_TYPE_RTP_BUFFER_POOL))
+#define GST_RTP_BUFFER_POOL(obj)      (G_TYPE_CHECK_INSTANCE_CAST ((obj), GST_TYPE_RTP_BUFFER_POOL, GstRTPBufferPool))
+#define GST_RTP_BUFFER_POOL_CAST(obj) ((GstRTPBufferPool*)(obj))
+
+/**
+ * GstRTPBufferPool:
+ *
+ * Opaque bufferpool of MTU sized RTP packets.
+ *
+ * Since: 1.2
+ */
+struct _GstRTPBufferPool
+{
+  GstBufferPool bufferpool;
+
+  /*< private >*/
+  GstRTPBufferPoolPrivate *priv;
+};
+
+struct _GstRTPBufferPoolClass
+{
+  GstBufferPoolClass parent_class;
+};
+
+GType             gst_rtp_buffer_pool_get_type      (void);
+
+GstBufferPool *   gst_rtp_buffer_pool_new           (void);
+
+G_END_DECLS
+
+#endif /* __GST_RTP_BUFFER_POOL_H__ */
@@ -23,6 +23,7 @@
 #define __GST_RTP_H__
 
 #include <gst/rtp/gstrtpbuffer.h>
+#include <gst/rtp/gstrtpbufferpool.h>
 #include <gst/rtp/gstrtcpbuffer.h>
 #include <gst/rtp/gstrtppayloads.h>
 #include <gst/rtp/gstrtphdrext.h>
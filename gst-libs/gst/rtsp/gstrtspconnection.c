@@ -102,6 +102,10 @@ typedef enum
 
 #define TUNNELID_LEN   24
 
+/* size of the receive buffer, messages and interleaved data are read from the
+ * input stream in chunks of this size */
+#define RECV_BUFFER_SIZE 16384
+
 struct _GstRTSPConnection
 {
   /*< private > */
@@ -137,6 +141,11 @@ struct _GstRTSPConnection
   gchar *initial_buffer;
   gsize initial_buffer_offset;
 
+  /* data read from the input stream that was not consumed yet */
+  guint8 *recv_buffer;
+  guint recv_offset;
+  guint recv_size;
+
   gboolean remember_session_id; /* remember the session id or not */
 
   /* Session state */
@@ -902,6 +911,25 @@ error:
   }
 }
 
+static gint
+read_raw_bytes (GstRTSPConnection * conn, guint8 * buffer, guint size,
+    gboolean block, GError ** err)
+{
+  if (block)
+    return g_input_stream_read (conn->input_stream, (gchar *) buffer,
+        size, conn->may_cancel ? conn->cancellable : NULL, err);
+  else
+    return g_pollable_input_stream_read_nonblocking (G_POLLABLE_INPUT_STREAM
+        (conn->input_stream), (gchar *) buffer, size,
+        conn->may_cancel ? conn->cancellable : NULL, err);
+}
+
+static gboolean
+has_buffered_bytes (GstRTSPConnection * conn)
+{
+  return conn->initial_buffer != NULL || conn->recv_offset < conn->recv_size;
+}
+
 static gint
 fill_raw_bytes (GstRTSPConnection * conn, guint8 * buffer, guint size,
     gboolean block, GError ** err)
@@ -922,27 +950,44 @@ fill_raw_bytes (GstRTSPConnection * conn, guint8 * buffer, guint size,
       conn->initial_buffer_offset += out;
   }
 
-  if (G_LIKELY (size > (guint) out)) {
+  /* take what is left in the receive buffer */
+  if (size > (guint) out && conn->recv_offset < conn->recv_size) {
+    guint avail = MIN (conn->recv_size - conn->recv_offset, size - out);
+
+    memcpy (&buffer[out], &conn->recv_buffer[conn->recv_offset], avail);
+    conn->recv_offset += avail;
+    out += avail;
+  }
+
+  /* only go to the input stream when we have nothing yet, the callers loop
+   * until they have all the bytes they need */
+  if (G_LIKELY (out == 0)) {
     gssize r;
-    gsize count = size - out;
-    if (block)
-      r = g_input_stream_read (conn->input_stream, (gchar *) & buffer[out],
-          count, conn->may_cancel ? conn->cancellable : NULL, err);
-    else
-      r = g_pollable_input_stream_read_nonblocking (G_POLLABLE_INPUT_STREAM
-          (conn->input_stream), (gchar *) & buffer[out], count,
-          conn->may_cancel ? conn->cancellable : NULL, err);
 
-    if (G_UNLIKELY (r < 0)) {
-      if (out == 0) {
-        /* propagate the error */
+    if (size >= RECV_BUFFER_SIZE) {
+      /* large reads, like the body of interleaved data, go directly into the
+       * destination */
+      r = read_raw_bytes (conn, buffer, size, block, err);
+      if (r > 0)
         out = r;
-      } else {
-        /* we have some data ignore error */
-        g_clear_error (err);
+    } else {
+      /* read a chunk into the receive buffer so that the next lines and
+       * small messages don't need a read each */
+      if (G_UNLIKELY (conn->recv_buffer == NULL))
+        conn->recv_buffer = g_malloc (RECV_BUFFER_SIZE);
+
+      r = read_raw_bytes (conn, conn->recv_buffer, RECV_BUFFER_SIZE, block,
+          err);
+      if (r > 0) {
+        out = MIN ((guint) r, size);
+        memcpy (buffer, conn->recv_buffer, out);
+        conn->recv_offset = out;
+        conn->recv_size = r;
       }
-    } else
-      out += r;
+    }
+    /* propagate EOF and errors */
+    if (r <= 0)
+      out = r;
   }
 
   return out;
@@ -2048,6 +2093,9 @@ gst_rtsp_connection_close (GstRTSPConnection * conn)
   conn->initial_buffer = NULL;
   conn->initial_buffer_offset = 0;
 
+  conn->recv_offset = 0;
+  conn->recv_size = 0;
+
   conn->write_socket = NULL;
   conn->read_socket = NULL;
   conn->tunneled = FALSE;
@@ -2090,6 +2138,7 @@ gst_rtsp_connection_free (GstRTSPConnection * conn)
   g_timer_destroy (conn->timer);
   gst_rtsp_url_free (conn->url);
   g_free (conn->proxy_host);
+  g_free (conn->recv_buffer);
   g_free (conn);
 
   return res;
@@ -2128,6 +2177,15 @@ gst_rtsp_connection_poll (GstRTSPConnection * conn, GstRTSPEvent events,
   g_return_val_if_fail (conn->read_socket != NULL, GST_RTSP_EINVAL);
   g_return_val_if_fail (conn->write_socket != NULL, GST_RTSP_EINVAL);
 
+  /* data that was already read can be received without waiting */
+  if ((events & GST_RTSP_EV_READ) && has_buffered_bytes (conn)) {
+    *revents = GST_RTSP_EV_READ;
+    if ((events & GST_RTSP_EV_WRITE) &&
+        (g_socket_condition_check (conn->write_socket, G_IO_OUT) & G_IO_OUT))
+      *revents |= GST_RTSP_EV_WRITE;
+    return GST_RTSP_OK;
+  }
+
   ctx = g_main_context_new ();
 
   /* configure timeout if any */
@@ -2714,6 +2772,14 @@ gst_rtsp_connection_do_tunnel (GstRTSPConnection * conn,
     conn->initial_buffer = conn2->initial_buffer;
     conn2->initial_buffer = NULL;
     conn->initial_buffer_offset = conn2->initial_buffer_offset;
+
+    /* the data after the POST request is for the tunnel */
+    g_free (conn->recv_buffer);
+    conn->recv_buffer = conn2->recv_buffer;
+    conn->recv_offset = conn2->recv_offset;
+    conn->recv_size = conn2->recv_size;
+    conn2->recv_buffer = NULL;
+    conn2->recv_offset = conn2->recv_size = 0;
   }
 
   /* we need base64 decoding for the readfd */
@@ -2766,6 +2832,9 @@ gst_rtsp_connection_get_remember_session_id (GstRTSPConnection * conn)
 #define WRITE_ERR   (G_IO_HUP | G_IO_ERR | G_IO_NVAL)
 #define WRITE_COND  (G_IO_OUT | WRITE_ERR)
 
+/* queued messages are merged into writes of at most this size */
+#define WRITE_COALESCE_SIZE 65536
+
 typedef struct
 {
   guint8 *data;
@@ -2798,9 +2867,16 @@ struct _GstRTSPWatch
   guint write_off;
   guint write_size;
   guint write_id;
+  guint write_count;
   gsize max_bytes;
   guint max_messages;
 
+  /* statistics, protected with the mutex */
+  guint64 bytes_sent;
+  guint64 messages_sent;
+  guint64 writes;
+  guint64 dropped;
+
   GstRTSPWatchFuncs funcs;
 
   gpointer user_data;
@@ -2812,7 +2888,7 @@ gst_rtsp_source_prepare (GSource * source, gint * timeout)
 {
   GstRTSPWatch *watch = (GstRTSPWatch *) source;
 
-  if (watch->conn->initial_buffer != NULL)
+  if (has_buffered_bytes (watch->conn))
     return TRUE;
 
   *timeout = (watch->conn->timeout * 1000);
@@ -2949,13 +3025,46 @@ gst_rtsp_source_dispatch (GSource * source, GSourceFunc callback G_GNUC_UNUSED,
   GstRTSPWatch *watch = (GstRTSPWatch *) source;
   GstRTSPConnection *conn = watch->conn;
 
-  if (conn->initial_buffer != NULL) {
+  if (has_buffered_bytes (conn)) {
     gst_rtsp_source_dispatch_read (G_POLLABLE_INPUT_STREAM (conn->input_stream),
         watch);
   }
   return watch->keep_running;
 }
 
+/* append the queued messages that fit in WRITE_COALESCE_SIZE to the data
+ * of the current write. Must be called with the mutex. */
+static void
+coalesce_messages (GstRTSPWatch * watch)
+{
+  GstRTSPRec *rec;
+  GList *walk;
+  guint size;
+  guint8 *data;
+
+  size = watch->write_size;
+  for (walk = watch->messages->tail; walk; walk = g_list_previous (walk)) {
+    rec = walk->data;
+    if (size + rec->size > WRITE_COALESCE_SIZE)
+      break;
+    size += rec->size;
+  }
+
+  data = g_realloc (watch->write_data, size);
+  while (watch->write_size < size) {
+    rec = g_queue_pop_tail (watch->messages);
+    watch->messages_bytes -= rec->size;
+
+    memcpy (data + watch->write_size, rec->data, rec->size);
+    watch->write_size += rec->size;
+    watch->write_count++;
+
+    g_free (rec->data);
+    g_slice_free (GstRTSPRec, rec);
+  }
+  watch->write_data = data;
+}
+
 static gboolean
 gst_rtsp_source_dispatch_write (GPollableOutputStream * stream,
     GstRTSPWatch * watch)
@@ -2969,6 +3078,8 @@ gst_rtsp_source_dispatch_write (GPollableOutputStream * stream,
 
   g_mutex_lock (&watch->mutex);
   do {
+    guint off, i, id;
+
     if (watch->write_data == NULL) {
       GstRTSPRec *rec;
 
@@ -2988,19 +3099,39 @@ gst_rtsp_source_dispatch_write (GPollableOutputStream * stream,
       watch->write_data = rec->data;
       watch->write_size = rec->size;
       watch->write_id = rec->id;
+      watch->write_count = 1;
 
       g_slice_free (GstRTSPRec, rec);
+
+      /* merge the following small messages, like interleaved RTP packets,
+       * into the same write */
+      rec = g_queue_peek_tail (watch->messages);
+      if (rec && watch->write_size + rec->size <= WRITE_COALESCE_SIZE)
+        coalesce_messages (watch);
     }
 
+    off = watch->write_off;
     res = write_bytes (conn->output_stream, watch->write_data,
         &watch->write_off, watch->write_size, FALSE, conn->cancellable);
+    if (watch->write_off > off) {
+      watch->bytes_sent += watch->write_off - off;
+      watch->writes++;
+    }
+    if (res == GST_RTSP_OK)
+      watch->messages_sent += watch->write_count;
     g_mutex_unlock (&watch->mutex);
 
     if (res == GST_RTSP_EINTR)
       goto write_blocked;
     else if (G_LIKELY (res == GST_RTSP_OK)) {
-      if (watch->funcs.message_sent)
-        watch->funcs.message_sent (watch, watch->write_id, watch->user_data);
+      if (watch->funcs.message_sent) {
+        /* queued messages get consecutive ids, skipping 0 */
+        for (i = 0, id = watch->write_id; i < watch->write_count; i++, id++) {
+          if (G_UNLIKELY (id == 0))
+            id++;
+          watch->funcs.message_sent (watch, id, watch->user_data);
+        }
+      }
     } else {
       goto write_error;
     }
@@ -3253,6 +3384,38 @@ gst_rtsp_watch_get_send_backlog (GstRTSPWatch * watch,
   g_mutex_unlock (&watch->mutex);
 }
 
+/**
+ * gst_rtsp_watch_get_stats:
+ * @watch: a #GstRTSPWatch
+ * @bytes_sent: (out) (allow-none): bytes written to the connection
+ * @messages_sent: (out) (allow-none): messages written completely
+ * @writes: (out) (allow-none): writes done on the connection
+ * @dropped: (out) (allow-none): messages refused because the backlog was full
+ *
+ * Get the send statistics of @watch. Queued messages are merged into larger
+ * writes, so @writes is usually lower than @messages_sent when the
+ * connection can't keep up.
+ *
+ * Since: 1.2
+ */
+void
+gst_rtsp_watch_get_stats (GstRTSPWatch * watch, guint64 * bytes_sent,
+    guint64 * messages_sent, guint64 * writes, guint64 * dropped)
+{
+  g_return_if_fail (watch != NULL);
+
+  g_mutex_lock (&watch->mutex);
+  if (bytes_sent)
+    *bytes_sent = watch->bytes_sent;
+  if (messages_sent)
+    *messages_sent = watch->messages_sent;
+  if (writes)
+    *writes = watch->writes;
+  if (dropped)
+    *dropped = watch->dropped;
+  g_mutex_unlock (&watch->mutex);
+}
+
 /**
  * gst_rtsp_watch_write_data:
  * @watch: a #GstRTSPWatch
@@ -3296,6 +3459,12 @@ gst_rtsp_watch_write_data (GstRTSPWatch * watch, const guint8 * data,
     res =
         write_bytes (watch->conn->output_stream, data, &off, size,
         FALSE, watch->conn->cancellable);
+    if (off > 0) {
+      watch->bytes_sent += off;
+      watch->writes++;
+    }
+    if (res == GST_RTSP_OK)
+      watch->messages_sent++;
     if (res != GST_RTSP_EINTR) {
       if (id != NULL)
         *id = 0;
@@ -3356,6 +3525,7 @@ too_much_backlog:
     GST_WARNING ("too much backlog: max_bytes %" G_GSIZE_FORMAT ", current %"
         G_GSIZE_FORMAT ", max_messages %u, current %u", watch->max_bytes,
         watch->messages_bytes, watch->max_messages, watch->messages->length);
+    watch->dropped++;
     g_mutex_unlock (&watch->mutex);
     g_free ((gpointer) data);
     return GST_RTSP_ENOMEM;
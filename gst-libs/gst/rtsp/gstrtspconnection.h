@@ -198,6 +198,12 @@ void               gst_rtsp_watch_set_send_backlog  (GstRTSPWatch *watch,
 void               gst_rtsp_watch_get_send_backlog  (GstRTSPWatch *watch,
                                                      gsize *bytes, guint *messages);
 
+void               gst_rtsp_watch_get_stats         (GstRTSPWatch *watch,
+                                                     guint64 *bytes_sent,
+                                                     guint64 *messages_sent,
+                                                     guint64 *writes,
+                                                     guint64 *dropped);
+
 GstRTSPResult      gst_rtsp_watch_write_data         (GstRTSPWatch *watch,
                                                       const guint8 *data,
                                                       guint size, guint *id);
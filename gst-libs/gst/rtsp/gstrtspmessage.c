@@ -60,8 +60,54 @@ typedef struct _RTSPKeyValue
 {
   GstRTSPHeaderField field;
   gchar *value;
+  /* position of the next header with the same field or -1 */
+  gint next;
 } RTSPKeyValue;
 
+/* the positions of the first and last header of each field in hdr_fields,
+ * or -1. The headers of a field are chained with the next member so that
+ * lookups don't need to scan all headers. hdr_fields itself stays in
+ * insertion order for serialization. */
+typedef struct _RTSPHeaderIndex
+{
+  gint first[GST_RTSP_HDR_LAST];
+  gint last[GST_RTSP_HDR_LAST];
+} RTSPHeaderIndex;
+
+#define HEADER_INDEX(msg) ((RTSPHeaderIndex *) (msg)->_gst_reserved[0])
+#define FIELD_IS_INDEXED(field) ((field) >= 0 && (field) < GST_RTSP_HDR_LAST)
+
+static void
+header_index_add (RTSPHeaderIndex * index, GArray * array, guint pos)
+{
+  RTSPKeyValue *key_value = &g_array_index (array, RTSPKeyValue, pos);
+  GstRTSPHeaderField field = key_value->field;
+
+  key_value->next = -1;
+
+  if (!FIELD_IS_INDEXED (field))
+    return;
+
+  if (index->last[field] >= 0)
+    g_array_index (array, RTSPKeyValue, index->last[field]).next = pos;
+  else
+    index->first[field] = pos;
+  index->last[field] = pos;
+}
+
+/* removing headers moves the headers after them, rebuild the index */
+static void
+header_index_rebuild (RTSPHeaderIndex * index, GArray * array)
+{
+  guint i;
+
+  memset (index->first, 0xff, sizeof (index->first));
+  memset (index->last, 0xff, sizeof (index->last));
+
+  for (i = 0; i < array->len; i++)
+    header_index_add (index, array, i);
+}
+
 static void
 key_value_foreach (GArray * array, GFunc func, gpointer user_data)
 {
@@ -467,6 +513,8 @@ gst_rtsp_message_unset (GstRTSPMessage * msg)
     }
     g_array_free (msg->hdr_fields, TRUE);
   }
+  if (HEADER_INDEX (msg))
+    g_slice_free (RTSPHeaderIndex, HEADER_INDEX (msg));
   g_free (msg->body);
 
   memset (msg, 0, sizeof (GstRTSPMessage));
@@ -521,6 +569,16 @@ gst_rtsp_message_take_header (GstRTSPMessage * msg, GstRTSPHeaderField field,
 
   g_array_append_val (msg->hdr_fields, key_value);
 
+  /* the index is made when the first header is added so that it also works
+   * for messages that were only cleared */
+  if (HEADER_INDEX (msg) == NULL) {
+    msg->_gst_reserved[0] = g_slice_new (RTSPHeaderIndex);
+    header_index_rebuild (HEADER_INDEX (msg), msg->hdr_fields);
+  } else {
+    header_index_add (HEADER_INDEX (msg), msg->hdr_fields,
+        msg->hdr_fields->len - 1);
+  }
+
   return GST_RTSP_OK;
 }
 
@@ -576,6 +634,10 @@ gst_rtsp_message_remove_header (GstRTSPMessage * msg, GstRTSPHeaderField field,
       i++;
     }
   }
+
+  if (res == GST_RTSP_OK && HEADER_INDEX (msg))
+    header_index_rebuild (HEADER_INDEX (msg), msg->hdr_fields);
+
   return res;
 }
 
@@ -605,6 +667,23 @@ gst_rtsp_message_get_header (const GstRTSPMessage * msg,
   if (msg->hdr_fields == NULL)
     return GST_RTSP_ENOTIMPL;
 
+  if (HEADER_INDEX (msg) && FIELD_IS_INDEXED (field)) {
+    gint pos = HEADER_INDEX (msg)->first[field];
+
+    if (indx < 0)
+      return GST_RTSP_ENOTIMPL;
+
+    while (pos >= 0 && cnt++ < indx)
+      pos = g_array_index (msg->hdr_fields, RTSPKeyValue, pos).next;
+
+    if (pos < 0)
+      return GST_RTSP_ENOTIMPL;
+
+    if (value)
+      *value = g_array_index (msg->hdr_fields, RTSPKeyValue, pos).value;
+    return GST_RTSP_OK;
+  }
+
   for (i = 0; i < msg->hdr_fields->len; i++) {
     RTSPKeyValue *key_value = &g_array_index (msg->hdr_fields, RTSPKeyValue, i);
 
@@ -162,6 +162,7 @@ GstSDPResult gst_sdp_message_add_##method (GstSDPMessage *msg, const type val) {
     DEFINE_ARRAY_REMOVE (method, field, gchar *, free_string)
 
 static GstSDPMessage *gst_sdp_message_boxed_copy (GstSDPMessage * orig);
+static void media_append_text (GString * lines, const GstSDPMedia * media);
 static void gst_sdp_message_boxed_free (GstSDPMessage * msg);
 
 G_DEFINE_BOXED_TYPE (GstSDPMessage, gst_sdp_message, gst_sdp_message_boxed_copy,
@@ -460,7 +461,8 @@ gst_sdp_message_as_text (const GstSDPMessage * msg)
 
   g_return_val_if_fail (msg != NULL, NULL);
 
-  lines = g_string_new ("");
+  /* most of the text is in the media, start with room for a few of them */
+  lines = g_string_sized_new (256 * (1 + gst_sdp_message_medias_len (msg)));
 
   if (msg->version)
     g_string_append_printf (lines, "v=%s\r\n", msg->version);
@@ -554,21 +556,19 @@ gst_sdp_message_as_text (const GstSDPMessage * msg)
     const GstSDPAttribute *attr = gst_sdp_message_get_attribute (msg, i);
 
     if (attr->key) {
-      g_string_append_printf (lines, "a=%s", attr->key);
-      if (attr->value)
-        g_string_append_printf (lines, ":%s", attr->value);
-      g_string_append_printf (lines, "\r\n");
+      g_string_append (lines, "a=");
+      g_string_append (lines, attr->key);
+      if (attr->value) {
+        g_string_append_c (lines, ':');
+        g_string_append (lines, attr->value);
+      }
+      g_string_append (lines, "\r\n");
     }
   }
 
-  for (i = 0; i < gst_sdp_message_medias_len (msg); i++) {
-    const GstSDPMedia *media = gst_sdp_message_get_media (msg, i);
-    gchar *sdp_media_str;
-
-    sdp_media_str = gst_sdp_media_as_text (media);
-    g_string_append_printf (lines, "%s", sdp_media_str);
-    g_free (sdp_media_str);
-  }
+  /* write the media directly into the same string */
+  for (i = 0; i < gst_sdp_message_medias_len (msg); i++)
+    media_append_text (lines, gst_sdp_message_get_media (msg, i));
 
   return g_string_free (lines, FALSE);
 }
@@ -1878,24 +1878,12 @@ gst_sdp_media_copy (const GstSDPMedia * media, GstSDPMedia ** copy)
   return GST_SDP_OK;
 }
 
-/**
- * gst_sdp_media_as_text:
- * @media: a #GstSDPMedia
- *
- * Convert the contents of @media to a text string.
- *
- * Returns: A dynamically allocated string representing the media.
- */
-gchar *
-gst_sdp_media_as_text (const GstSDPMedia * media)
+/* append the text of @media to @lines */
+static void
+media_append_text (GString * lines, const GstSDPMedia * media)
 {
-  GString *lines;
   guint i;
 
-  g_return_val_if_fail (media != NULL, NULL);
-
-  lines = g_string_new ("");
-
   if (media->media)
     g_string_append_printf (lines, "m=%s", media->media);
 
@@ -1904,14 +1892,17 @@ gst_sdp_media_as_text (const GstSDPMedia * media)
   if (media->num_ports > 1)
     g_string_append_printf (lines, "/%u", media->num_ports);
 
-  g_string_append_printf (lines, " %s", media->proto);
+  g_string_append_c (lines, ' ');
+  g_string_append (lines, media->proto);
 
-  for (i = 0; i < gst_sdp_media_formats_len (media); i++)
-    g_string_append_printf (lines, " %s", gst_sdp_media_get_format (media, i));
-  g_string_append_printf (lines, "\r\n");
+  for (i = 0; i < gst_sdp_media_formats_len (media); i++) {
+    g_string_append_c (lines, ' ');
+    g_string_append (lines, gst_sdp_media_get_format (media, i));
+  }
+  g_string_append (lines, "\r\n");
 
   if (media->information)
-    g_string_append_printf (lines, "i=%s", media->information);
+    g_string_append_printf (lines, "i=%s\r\n", media->information);
 
   for (i = 0; i < gst_sdp_media_connections_len (media); i++) {
     const GstSDPConnection *conn = gst_sdp_media_get_connection (media, i);
@@ -1927,7 +1918,7 @@ gst_sdp_media_as_text (const GstSDPMedia * media)
         if (conn->addr_number > 1)
           g_string_append_printf (lines, "/%u", conn->addr_number);
       }
-      g_string_append_printf (lines, "\r\n");
+      g_string_append (lines, "\r\n");
     }
   }
 
@@ -1942,19 +1933,41 @@ gst_sdp_media_as_text (const GstSDPMedia * media)
     g_string_append_printf (lines, "k=%s", media->key.type);
     if (media->key.data)
       g_string_append_printf (lines, ":%s", media->key.data);
-    g_string_append_printf (lines, "\r\n");
+    g_string_append (lines, "\r\n");
   }
 
   for (i = 0; i < gst_sdp_media_attributes_len (media); i++) {
     const GstSDPAttribute *attr = gst_sdp_media_get_attribute (media, i);
 
     if (attr->key) {
-      g_string_append_printf (lines, "a=%s", attr->key);
-      if (attr->value && attr->value[0] != '\0')
-        g_string_append_printf (lines, ":%s", attr->value);
-      g_string_append_printf (lines, "\r\n");
+      g_string_append (lines, "a=");
+      g_string_append (lines, attr->key);
+      if (attr->value && attr->value[0] != '\0') {
+        g_string_append_c (lines, ':');
+        g_string_append (lines, attr->value);
+      }
+      g_string_append (lines, "\r\n");
     }
   }
+}
+
+/**
+ * gst_sdp_media_as_text:
+ * @media: a #GstSDPMedia
+ *
+ * Convert the contents of @media to a text string.
+ *
+ * Returns: A dynamically allocated string representing the media.
+ */
+gchar *
+gst_sdp_media_as_text (const GstSDPMedia * media)
+{
+  GString *lines;
+
+  g_return_val_if_fail (media != NULL, NULL);
+
+  lines = g_string_sized_new (256);
+  media_append_text (lines, media);
 
   return g_string_free (lines, FALSE);
 }
@@ -2939,7 +2952,7 @@ GstSDPResult
 gst_sdp_message_parse_buffer (const guint8 * data, guint size,
     GstSDPMessage * msg)
 {
-  gchar *p, *s;
+  const gchar *p, *s;
   SDPContext c;
   gchar type;
   gchar *buffer = NULL;
@@ -2954,21 +2967,26 @@ gst_sdp_message_parse_buffer (const guint8 * data, guint size,
   c.msg = msg;
   c.media = NULL;
 
-  p = (gchar *) data;
+  /* never look past @size, @data does not need to be 0 terminated */
+#define AT_END(p) ((guint) ((p) - (const gchar *) data) >= size)
+
+  p = (const gchar *) data;
   while (TRUE) {
-    while (g_ascii_isspace (*p))
+    while (!AT_END (p) && g_ascii_isspace (*p))
       p++;
 
+    if (AT_END (p))
+      break;
     type = *p++;
     if (type == '\0')
       break;
 
-    if (*p != '=')
+    if (AT_END (p) || *p != '=')
       goto line_done;
     p++;
 
     s = p;
-    while (*p != '\n' && *p != '\r' && *p != '\0')
+    while (!AT_END (p) && *p != '\n' && *p != '\r' && *p != '\0')
       p++;
 
     len = p - s;
@@ -2982,11 +3000,13 @@ gst_sdp_message_parse_buffer (const guint8 * data, guint size,
     gst_sdp_parse_line (&c, type, buffer);
 
   line_done:
-    while (*p != '\n' && *p != '\0')
-      p++;
-    if (*p == '\n')
+    while (!AT_END (p) && *p != '\n' && *p != '\0')
       p++;
+    if (AT_END (p) || *p == '\0')
+      break;
+    p++;
   }
+#undef AT_END
 
   if (buffer)
     g_free (buffer);
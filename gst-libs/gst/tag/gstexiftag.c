@@ -524,11 +524,19 @@ gst_exif_reader_reset (GstExifReader * reader, gboolean return_taglist)
 /* GstExifWriter functions */
 
 static void
-gst_exif_writer_init (GstExifWriter * writer, gint byte_order)
+gst_exif_writer_init (GstExifWriter * writer, gint byte_order,
+    const GstExifTagMatch * tag_map)
 {
+  guint n_tags = 0;
+
   ensure_exif_tags ();
 
-  gst_byte_writer_init (&writer->tagwriter);
+  /* every map entry results in at most one tag header, so reserve room for
+   * all of them up front instead of growing the writer tag by tag */
+  while (tag_map[n_tags].exif_tag != 0)
+    n_tags++;
+  gst_byte_writer_init_with_size (&writer->tagwriter,
+      2 + n_tags * EXIF_TAG_ENTRY_SIZE + 4, FALSE);
   gst_byte_writer_init (&writer->datawriter);
 
   writer->byte_order = byte_order;
@@ -541,16 +549,34 @@ gst_exif_writer_init (GstExifWriter * writer, gint byte_order)
   }
 }
 
+/* Returns a single buffer with the tag headers followed by the tag data,
+ * after @prefix_size bytes that are left for the caller to fill */
 static GstBuffer *
-gst_exif_writer_reset_and_get_buffer (GstExifWriter * writer)
+gst_exif_writer_reset_and_get_buffer (GstExifWriter * writer,
+    guint prefix_size)
 {
-  GstBuffer *header;
-  GstBuffer *data;
+  GstBuffer *buffer;
+  GstMapInfo info;
+  guint header_size, data_size;
+
+  header_size = gst_byte_writer_get_size (&writer->tagwriter);
+  data_size = gst_byte_writer_get_size (&writer->datawriter);
+
+  buffer = gst_buffer_new_allocate (NULL,
+      prefix_size + header_size + data_size, NULL);
+  gst_buffer_map (buffer, &info, GST_MAP_WRITE);
+  if (header_size > 0)
+    memcpy (info.data + prefix_size,
+        ((GstByteReader *) & writer->tagwriter)->data, header_size);
+  if (data_size > 0)
+    memcpy (info.data + prefix_size + header_size,
+        ((GstByteReader *) & writer->datawriter)->data, data_size);
+  gst_buffer_unmap (buffer, &info);
 
-  header = gst_byte_writer_reset_and_get_buffer (&writer->tagwriter);
-  data = gst_byte_writer_reset_and_get_buffer (&writer->datawriter);
+  gst_byte_writer_reset (&writer->tagwriter);
+  gst_byte_writer_reset (&writer->datawriter);
 
-  return gst_buffer_append (header, data);
+  return buffer;
 }
 
 /*
@@ -1490,7 +1516,7 @@ parse_exif_rational_tag (GstExifReader * exif_reader,
 
 static GstBuffer *
 write_exif_ifd (const GstTagList * taglist, guint byte_order,
-    guint32 base_offset, const GstExifTagMatch * tag_map)
+    guint32 base_offset, const GstExifTagMatch * tag_map, guint prefix_size)
 {
   GstExifWriter writer;
   gint i;
@@ -1506,7 +1532,7 @@ write_exif_ifd (const GstTagList * taglist, guint byte_order,
     return NULL;
   }
 
-  gst_exif_writer_init (&writer, byte_order);
+  gst_exif_writer_init (&writer, byte_order, tag_map);
 
   /* write tag number as 0 */
   handled &= gst_byte_writer_put_uint16_le (&writer.tagwriter, 0);
@@ -1540,7 +1566,7 @@ write_exif_ifd (const GstTagList * taglist, guint byte_order,
       if (inner_tag_map) {
         /* base offset and tagheader size are added when rewriting offset */
         inner_ifd = write_exif_ifd (taglist, byte_order,
-            gst_byte_writer_get_size (&writer.datawriter), inner_tag_map);
+            gst_byte_writer_get_size (&writer.datawriter), inner_tag_map, 0);
       }
 
       if (inner_ifd) {
@@ -1590,11 +1616,12 @@ write_exif_ifd (const GstTagList * taglist, guint byte_order,
 
   if (G_UNLIKELY (!handled)) {
     GST_WARNING ("Error rewriting tags");
-    gst_buffer_unref (gst_exif_writer_reset_and_get_buffer (&writer));
+    gst_byte_writer_reset (&writer.tagwriter);
+    gst_byte_writer_reset (&writer.datawriter);
     return NULL;
   }
 
-  return gst_exif_writer_reset_and_get_buffer (&writer);
+  return gst_exif_writer_reset_and_get_buffer (&writer, prefix_size);
 }
 
 static gboolean
@@ -1785,7 +1812,7 @@ GstBuffer *
 gst_tag_list_to_exif_buffer (const GstTagList * taglist, gint byte_order,
     guint32 base_offset)
 {
-  return write_exif_ifd (taglist, byte_order, base_offset, tag_map_ifd0);
+  return write_exif_ifd (taglist, byte_order, base_offset, tag_map_ifd0, 0);
 }
 
 /**
@@ -1800,21 +1827,24 @@ gst_tag_list_to_exif_buffer (const GstTagList * taglist, gint byte_order,
 GstBuffer *
 gst_tag_list_to_exif_buffer_with_tiff_header (const GstTagList * taglist)
 {
-  GstBuffer *ifd, *res;
+  GstBuffer *res;
   GstByteWriter writer;
   GstMapInfo info;
   gboolean handled = TRUE;
 
-  ifd = gst_tag_list_to_exif_buffer (taglist, G_BYTE_ORDER, 8);
-  if (ifd == NULL) {
+  /* have the ifd written right after room for the header, so that the result
+   * doesn't need to be copied again */
+  res = write_exif_ifd (taglist, G_BYTE_ORDER, TIFF_HEADER_SIZE, tag_map_ifd0,
+      TIFF_HEADER_SIZE);
+  if (res == NULL) {
     GST_WARNING ("Failed to create exif buffer");
     return NULL;
   }
 
-  gst_buffer_map (ifd, &info, GST_MAP_READ);
+  gst_buffer_map (res, &info, GST_MAP_WRITE);
 
   /* TODO what is the correct endianness here? */
-  gst_byte_writer_init_with_size (&writer, info.size + TIFF_HEADER_SIZE, FALSE);
+  gst_byte_writer_init_with_data (&writer, info.data, TIFF_HEADER_SIZE, FALSE);
   /* TIFF header */
   if (G_BYTE_ORDER == G_LITTLE_ENDIAN) {
     handled &= gst_byte_writer_put_uint16_le (&writer, TIFF_LITTLE_ENDIAN);
@@ -1825,20 +1855,7 @@ gst_tag_list_to_exif_buffer_with_tiff_header (const GstTagList * taglist)
     handled &= gst_byte_writer_put_uint16_be (&writer, 42);
     handled &= gst_byte_writer_put_uint32_be (&writer, 8);
   }
-  if (!gst_byte_writer_put_data (&writer, info.data, info.size)) {
-    GST_WARNING ("Byte writer size mismatch");
-    /* reaching here is a programming error because we should have a buffer
-     * large enough */
-    g_assert_not_reached ();
-    gst_buffer_unmap (ifd, &info);
-    gst_buffer_unref (ifd);
-    gst_byte_writer_reset (&writer);
-    return NULL;
-  }
-  gst_buffer_unmap (ifd, &info);
-  gst_buffer_unref (ifd);
-
-  res = gst_byte_writer_reset_and_get_buffer (&writer);
+  gst_buffer_unmap (res, &info);
 
   if (G_UNLIKELY (!handled)) {
     GST_WARNING ("Error creating buffer");
@@ -343,14 +343,36 @@ gboolean
 gst_tag_list_add_id3_image (GstTagList * tag_list, const guint8 * image_data,
     guint image_data_len, guint id3_picture_type)
 {
-  GstTagImageType tag_image_type;
-  const gchar *tag_name;
-  GstSample *image;
+  GstBuffer *image;
+  GstMapInfo info;
 
   g_return_val_if_fail (GST_IS_TAG_LIST (tag_list), FALSE);
   g_return_val_if_fail (image_data != NULL, FALSE);
   g_return_val_if_fail (image_data_len > 0, FALSE);
 
+  /* allocate space for a NUL terminator for an uri too */
+  image = gst_buffer_new_and_alloc (image_data_len + 1);
+  gst_buffer_map (image, &info, GST_MAP_WRITE);
+  memcpy (info.data, image_data, image_data_len);
+  info.data[image_data_len] = '\0';
+  gst_buffer_unmap (image, &info);
+
+  return __gst_tag_list_add_id3_image_buffer (tag_list, image, image_data_len,
+      id3_picture_type, NULL);
+}
+
+/* Like gst_tag_list_add_id3_image(), but takes ownership of @image, which
+ * may share memory with the tag it was parsed from, and of @caps if the
+ * media type of the image is already known.
+ * See __gst_tag_image_buffer_to_image_sample() */
+gboolean
+__gst_tag_list_add_id3_image_buffer (GstTagList * tag_list, GstBuffer * image,
+    guint image_data_len, guint id3_picture_type, GstCaps * caps)
+{
+  GstTagImageType tag_image_type;
+  const gchar *tag_name;
+  GstSample *sample;
+
   if (id3_picture_type == 0x01 || id3_picture_type == 0x02) {
     /* file icon for preview. Don't add image-type to caps, since there
      * is only supposed to be one of these, and the type is already indicated
@@ -367,13 +389,13 @@ gst_tag_list_add_id3_image (GstTagList * tag_list, const guint8 * image_data,
       tag_image_type = GST_TAG_IMAGE_TYPE_UNDEFINED;
   }
 
-  image = gst_tag_image_data_to_image_sample (image_data, image_data_len,
-      tag_image_type);
+  sample = __gst_tag_image_buffer_to_image_sample (image, image_data_len,
+      tag_image_type, caps);
 
-  if (image == NULL)
+  if (sample == NULL)
     return FALSE;
 
-  gst_tag_list_add (tag_list, GST_TAG_MERGE_APPEND, tag_name, image, NULL);
-  gst_sample_unref (image);
+  gst_tag_list_add (tag_list, GST_TAG_MERGE_APPEND, tag_name, sample, NULL);
+  gst_sample_unref (sample);
   return TRUE;
 }
@@ -39,6 +39,7 @@
 #include <gst/gsttagsetter.h>
 #include <gst/base/gstbytereader.h>
 #include <gst/base/gstbytewriter.h>
+#include <gst/base/gsttypefindhelper.h>
 #include "gsttageditingprivate.h"
 #include <stdlib.h>
 #include <string.h>
@@ -296,6 +297,300 @@ gst_vorbis_tag_add (GstTagList * list, const gchar * tag, const gchar * value)
   }
 }
 
+/* Pictures are big and often not looked at, so they are only decoded when
+ * the image buffer is first mapped. The memory keeps the base64 encoded
+ * comment and the decoded data of the whole comment, shared memories refer
+ * to the root memory for both. */
+typedef struct
+{
+  GstMemory mem;
+
+  /* allocation holding base64 */
+  gpointer alloc;
+  const gchar *base64;
+  gsize base64_len;
+  /* decoded comment, NULL until the memory is mapped */
+  guint8 *data;
+} GstVorbisTagImageMemory;
+
+typedef GstAllocator GstVorbisTagImageAllocator;
+typedef GstAllocatorClass GstVorbisTagImageAllocatorClass;
+
+GType vorbis_tag_image_allocator_get_type (void);
+G_DEFINE_TYPE (GstVorbisTagImageAllocator, vorbis_tag_image_allocator,
+    GST_TYPE_ALLOCATOR);
+
+/* base64 characters decoded right away to find the image type */
+#define LAZY_IMAGE_PREFIX 8192
+
+G_LOCK_DEFINE_STATIC (image_memory);
+
+static GstVorbisTagImageMemory *
+gst_vorbis_tag_image_memory_root (GstVorbisTagImageMemory * mem)
+{
+  if (mem->mem.parent)
+    return (GstVorbisTagImageMemory *) mem->mem.parent;
+  return mem;
+}
+
+static gpointer
+gst_vorbis_tag_image_memory_map (GstVorbisTagImageMemory * mem, gsize maxsize,
+    GstMapFlags flags)
+{
+  GstVorbisTagImageMemory *root = gst_vorbis_tag_image_memory_root (mem);
+  guint8 *data;
+
+  G_LOCK (image_memory);
+  if (root->data == NULL) {
+    gint state = 0;
+    guint save = 0;
+
+    GST_LOG ("decoding %" G_GSIZE_FORMAT " bytes of image data",
+        root->mem.maxsize);
+    root->data = g_malloc (root->base64_len / 4 * 3 + 3);
+    g_base64_decode_step (root->base64, root->base64_len, root->data, &state,
+        &save);
+    g_free (root->alloc);
+    root->alloc = NULL;
+    root->base64 = NULL;
+  }
+  data = root->data;
+  G_UNLOCK (image_memory);
+
+  return data;
+}
+
+static void
+gst_vorbis_tag_image_memory_unmap (GstVorbisTagImageMemory * mem)
+{
+}
+
+static GstVorbisTagImageMemory *
+gst_vorbis_tag_image_memory_share (GstVorbisTagImageMemory * mem,
+    gssize offset, gssize size)
+{
+  GstVorbisTagImageMemory *root = gst_vorbis_tag_image_memory_root (mem);
+  GstVorbisTagImageMemory *sub;
+
+  if (size == -1)
+    size = mem->mem.size - offset;
+
+  sub = g_slice_new0 (GstVorbisTagImageMemory);
+  gst_memory_init (GST_MEMORY_CAST (sub),
+      GST_MINI_OBJECT_FLAGS (root) | GST_MEMORY_FLAG_READONLY,
+      root->mem.allocator, GST_MEMORY_CAST (root), root->mem.maxsize,
+      root->mem.align, mem->mem.offset + offset, size);
+
+  return sub;
+}
+
+static void
+gst_vorbis_tag_image_allocator_free (GstAllocator * allocator,
+    GstMemory * memory)
+{
+  GstVorbisTagImageMemory *mem = (GstVorbisTagImageMemory *) memory;
+
+  if (memory->parent == NULL) {
+    g_free (mem->alloc);
+    g_free (mem->data);
+  }
+  g_slice_free (GstVorbisTagImageMemory, mem);
+}
+
+static void
+vorbis_tag_image_allocator_class_init (GstVorbisTagImageAllocatorClass * klass)
+{
+  /* only made by gst_vorbis_tag_image_buffer_new() */
+  klass->alloc = NULL;
+  klass->free = gst_vorbis_tag_image_allocator_free;
+}
+
+static void
+vorbis_tag_image_allocator_init (GstVorbisTagImageAllocator * allocator)
+{
+  GstAllocator *alloc = GST_ALLOCATOR_CAST (allocator);
+
+  alloc->mem_type = "VorbisTagImage";
+  alloc->mem_map = (GstMemoryMapFunction) gst_vorbis_tag_image_memory_map;
+  alloc->mem_unmap = (GstMemoryUnmapFunction) gst_vorbis_tag_image_memory_unmap;
+  alloc->mem_share = (GstMemoryShareFunction) gst_vorbis_tag_image_memory_share;
+  /* Use the default, fallback copy function */
+
+  GST_OBJECT_FLAG_SET (allocator, GST_ALLOCATOR_FLAG_CUSTOM_ALLOC);
+}
+
+/* a buffer with @size bytes at @offset of the @decoded_len bytes encoded
+ * in @base64, which is decoded when the buffer is mapped. Takes ownership of
+ * @alloc, the allocation that holds @base64. */
+static GstBuffer *
+gst_vorbis_tag_image_buffer_new (gpointer alloc, const gchar * base64,
+    gsize base64_len, gsize decoded_len, gsize offset, gsize size)
+{
+  static GstAllocator *allocator = NULL;
+  GstVorbisTagImageMemory *mem;
+  GstBuffer *buffer;
+
+  if (g_once_init_enter (&allocator)) {
+    GstAllocator *a;
+
+    a = g_object_new (vorbis_tag_image_allocator_get_type (), NULL);
+    g_once_init_leave (&allocator, a);
+  }
+
+  mem = g_slice_new0 (GstVorbisTagImageMemory);
+  gst_memory_init (GST_MEMORY_CAST (mem), GST_MEMORY_FLAG_READONLY,
+      allocator, NULL, decoded_len, 0, offset, size);
+  mem->alloc = alloc;
+  mem->base64 = base64;
+  mem->base64_len = base64_len;
+
+  buffer = gst_buffer_new ();
+  gst_buffer_append_memory (buffer, GST_MEMORY_CAST (mem));
+
+  return buffer;
+}
+
+/* the size of the data encoded in @value if it is plain base64, which is
+ * then decoded to exactly that many bytes later */
+static gboolean
+gst_vorbis_tag_base64_decoded_len (const gchar * value, gsize len,
+    gsize * decoded_len)
+{
+  gsize i, pad = 0;
+
+  if (len == 0 || len % 4 != 0)
+    return FALSE;
+
+  if (value[len - 1] == '=') {
+    pad++;
+    if (value[len - 2] == '=')
+      pad++;
+  }
+  for (i = 0; i < len - pad; i++) {
+    if (!g_ascii_isalnum (value[i]) && value[i] != '+' && value[i] != '/')
+      return FALSE;
+  }
+  *decoded_len = len / 4 * 3 - pad;
+
+  return TRUE;
+}
+
+/* typefinds the start of an image, links are left to the eager path, where
+ * the whole data is decoded */
+static GstCaps *
+gst_vorbis_tag_typefind_image (const guint8 * data, gsize size)
+{
+  GstCaps *caps;
+
+  if (size == 0)
+    return NULL;
+
+  caps = gst_type_find_helper_for_data (NULL, data, size, NULL);
+  if (caps && gst_structure_has_name (gst_caps_get_structure (caps, 0),
+          "text/uri-list")) {
+    gst_caps_unref (caps);
+    caps = NULL;
+  }
+
+  return caps;
+}
+
+/* adds the COVERART in @value without decoding it. Returns FALSE when it
+ * can't, otherwise it took ownership of @alloc, the allocation of @value */
+static gboolean
+gst_vorbis_tag_add_lazy_coverart (GstTagList * tags, gpointer alloc,
+    const gchar * value, gsize value_len)
+{
+  guint8 prefix[LAZY_IMAGE_PREFIX / 4 * 3 + 3];
+  GstSample *img;
+  GstBuffer *image;
+  GstCaps *caps;
+  gsize decoded_len, prefix_len;
+  gint state = 0;
+  guint save = 0;
+
+  /* small images are decoded right away */
+  if (value_len <= LAZY_IMAGE_PREFIX ||
+      !gst_vorbis_tag_base64_decoded_len (value, value_len, &decoded_len))
+    return FALSE;
+
+  prefix_len = g_base64_decode_step (value, LAZY_IMAGE_PREFIX, prefix, &state,
+      &save);
+  caps = gst_vorbis_tag_typefind_image (prefix, prefix_len);
+  if (caps == NULL)
+    return FALSE;
+
+  image = gst_vorbis_tag_image_buffer_new (alloc, value, value_len,
+      decoded_len, 0, decoded_len);
+  img = __gst_tag_image_buffer_to_image_sample (image, decoded_len,
+      GST_TAG_IMAGE_TYPE_NONE, caps);
+  if (img == NULL) {
+    GST_WARNING ("Couldn't extract image or image type from COVERART tag");
+    return TRUE;
+  }
+
+  gst_tag_list_add (tags, GST_TAG_MERGE_APPEND,
+      GST_TAG_PREVIEW_IMAGE, img, NULL);
+  gst_sample_unref (img);
+
+  return TRUE;
+}
+
+/* adds the METADATA_BLOCK_PICTURE in @value, only decoding the header and
+ * the start of the image. Returns FALSE when it can't, otherwise it took
+ * ownership of @alloc, the allocation of @value */
+static gboolean
+gst_vorbis_tag_add_lazy_metadata_block_picture (GstTagList * tags,
+    gpointer alloc, const gchar * value, gsize value_len)
+{
+  guint8 prefix[LAZY_IMAGE_PREFIX / 4 * 3 + 3];
+  GstByteReader reader;
+  guint32 img_len = 0, img_type = 0;
+  guint32 img_mimetype_len = 0, img_description_len = 0;
+  GstBuffer *image;
+  GstCaps *caps;
+  gsize decoded_len, prefix_len, offset;
+  gint state = 0;
+  guint save = 0;
+
+  if (value_len <= LAZY_IMAGE_PREFIX ||
+      !gst_vorbis_tag_base64_decoded_len (value, value_len, &decoded_len))
+    return FALSE;
+
+  prefix_len = g_base64_decode_step (value, LAZY_IMAGE_PREFIX, prefix, &state,
+      &save);
+  gst_byte_reader_init (&reader, prefix, prefix_len);
+
+  /* a header that doesn't fit in the prefix is left to the eager path */
+  if (!gst_byte_reader_get_uint32_be (&reader, &img_type) ||
+      !gst_byte_reader_get_uint32_be (&reader, &img_mimetype_len) ||
+      !gst_byte_reader_skip (&reader, img_mimetype_len) ||
+      !gst_byte_reader_get_uint32_be (&reader, &img_description_len) ||
+      !gst_byte_reader_skip (&reader, img_description_len) ||
+      !gst_byte_reader_skip (&reader, 4 * 4) ||
+      !gst_byte_reader_get_uint32_be (&reader, &img_len))
+    return FALSE;
+
+  offset = gst_byte_reader_get_pos (&reader);
+  if (img_len == 0 || img_len > decoded_len - offset)
+    return FALSE;
+
+  caps = gst_vorbis_tag_typefind_image (prefix + offset,
+      MIN (prefix_len - offset, img_len));
+  if (caps == NULL)
+    return FALSE;
+
+  image = gst_vorbis_tag_image_buffer_new (alloc, value, value_len,
+      decoded_len, offset, img_len);
+  if (__gst_tag_list_add_id3_image_buffer (tags, image, img_len, img_type,
+          caps))
+    return TRUE;
+
+  GST_WARNING
+      ("Couldn't extract image or image type from METADATA_BLOCK_PICTURE tag");
+  return TRUE;
+}
+
 static void
 gst_vorbis_tag_add_coverart (GstTagList * tags, gchar * img_data_base64,
     gint base64_len)
@@ -479,8 +774,14 @@ gst_tag_list_from_vorbiscomment (const guint8 * data, gsize size,
       g_free (cur);
       continue;
     } else if (g_ascii_strcasecmp (cur, "COVERART") == 0) {
+      /* value stays with the image when it's decoded later */
+      if (gst_vorbis_tag_add_lazy_coverart (list, cur, value, value_len))
+        continue;
       gst_vorbis_tag_add_coverart (list, value, value_len);
     } else if (g_ascii_strcasecmp (cur, "METADATA_BLOCK_PICTURE") == 0) {
+      if (gst_vorbis_tag_add_lazy_metadata_block_picture (list, cur, value,
+              value_len))
+        continue;
       gst_vorbis_tag_add_metadata_block_picture (list, value, value_len);
     } else {
       gst_vorbis_tag_add (list, cur, value);
@@ -230,6 +230,8 @@ gst_tag_list_from_id3v2_tag (GstBuffer * buffer)
 
   memset (&work, 0, sizeof (ID3TagsWorking));
   work.buffer = buffer;
+  work.buffer_data = info.data;
+  work.buffer_size = info.size;
   work.hdr.version = version;
   work.hdr.size = read_size;
   work.hdr.flags = flags;
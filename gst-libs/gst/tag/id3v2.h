@@ -51,6 +51,9 @@ typedef struct {
   ID3v2Header hdr;
   
   GstBuffer *buffer;
+  /* mapped data of buffer, to find frames that can share its memory */
+  const guint8 *buffer_data;
+  gsize buffer_size;
   GstTagList *tags;
 
   /* Current frame decoding */
@@ -34,6 +34,7 @@
 #endif
 
 #include "id3v2.h"
+#include "gsttageditingprivate.h"
 
 #ifndef GST_DISABLE_GST_DEBUG
 #define GST_CAT_DEFAULT id3v2_ensure_debug_category()
@@ -587,8 +588,25 @@ parse_picture_frame (ID3TagsWorking * work)
   if (work->parse_size <= 0)
     goto not_enough_data;
 
-  if (!gst_tag_list_add_id3_image (work->tags, (guint8 *) work->parse_data,
-          work->parse_size, pic_type)) {
+  /* If the image data was neither unsynced nor compressed it is still in
+   * the tag buffer, so let the image share its memory instead of copying
+   * what is usually the bulk of the tag. Don't do that for small images in
+   * a big tag though (padding, other images), or the whole tag would be kept
+   * alive for as long as the image is. */
+  if (work->parse_data >= work->buffer_data &&
+      work->parse_data + work->parse_size <=
+      work->buffer_data + work->buffer_size &&
+      work->parse_size >= work->buffer_size / 2) {
+    GstBuffer *image;
+
+    GST_LOG ("sharing image data with tag buffer");
+    image = gst_buffer_copy_region (work->buffer, GST_BUFFER_COPY_MEMORY,
+        work->parse_data - work->buffer_data, work->parse_size);
+    if (!__gst_tag_list_add_id3_image_buffer (work->tags, image,
+            work->parse_size, pic_type, NULL))
+      goto error;
+  } else if (!gst_tag_list_add_id3_image (work->tags,
+          (guint8 *) work->parse_data, work->parse_size, pic_type)) {
     goto error;
   }
 
@@ -1015,16 +1033,25 @@ string_utf8_dup (const gchar * start, const guint size)
     }
   }
 
-  /* Try ISO-8859-1 */
-  utf8 =
-      g_convert (start, size, "UTF-8", "ISO-8859-1", &bytes_read, NULL, NULL);
-  if (utf8 != NULL && bytes_read == size) {
-    goto beach;
+  /* Try ISO-8859-1, which maps 1:1 onto the first 256 unicode code points
+   * and can't fail, so convert it here instead of going through iconv */
+  {
+    const guint8 *in = (const guint8 *) start;
+    gchar *out;
+    guint i;
+
+    out = utf8 = g_malloc (2 * size + 1);
+    for (i = 0; i < size; ++i) {
+      if (in[i] < 0x80) {
+        *out++ = in[i];
+      } else {
+        *out++ = 0xc0 | (in[i] >> 6);
+        *out++ = 0x80 | (in[i] & 0x3f);
+      }
+    }
+    *out = '\0';
   }
 
-  g_free (utf8);
-  return NULL;
-
 beach:
 
   g_strchomp (utf8);
@@ -1032,11 +1059,44 @@ beach:
   return (utf8);
 }
 
+/* Convert UTF-16 with known endianness straight to UTF-8, without setting
+ * up an iconv converter for every single field */
+static gchar *
+utf16_to_utf8 (const gchar * data, gint data_size, const gchar * in_encode)
+{
+  gunichar2 stack_buf[128], *buf;
+  gchar *utf8;
+  gint i, n;
+
+  /* iconv would fail on a partial character too */
+  if (data_size % 2 != 0)
+    return NULL;
+
+  n = data_size / 2;
+  buf = (n <= G_N_ELEMENTS (stack_buf)) ? stack_buf : g_new (gunichar2, n);
+
+  if (in_encode == utf16leenc) {
+    for (i = 0; i < n; ++i)
+      buf[i] = GST_READ_UINT16_LE (data + 2 * i);
+  } else {
+    for (i = 0; i < n; ++i)
+      buf[i] = GST_READ_UINT16_BE (data + 2 * i);
+  }
+
+  utf8 = g_utf16_to_utf8 (buf, n, NULL, NULL, NULL);
+
+  if (buf != stack_buf)
+    g_free (buf);
+
+  return utf8;
+}
+
 static void
 parse_insert_string_field (guint8 encoding, gchar * data, gint data_size,
     GArray * fields)
 {
   gchar *field = NULL;
+  gboolean valid = FALSE;
 
   switch (encoding) {
     case ID3V2_ENCODING_UTF16:
@@ -1057,24 +1117,40 @@ parse_insert_string_field (guint8 encoding, gchar * data, gint data_size,
         data_size -= 2;
       }
 
-      field = g_convert (data, data_size, "UTF-8", in_encode, NULL, NULL, NULL);
+      /* without BOM leave the byte order guessing to iconv as before */
+      if (in_encode == utf16enc)
+        field = g_convert (data, data_size, "UTF-8", in_encode, NULL, NULL,
+            NULL);
+      else
+        field = utf16_to_utf8 (data, data_size, in_encode);
 
       if (field == NULL || g_utf8_validate (field, -1, NULL) == FALSE) {
         /* As a fallback, try interpreting UTF-16 in the other endianness */
-        if (in_encode == utf16beenc)
-          field = g_convert (data, data_size, "UTF-8", utf16leenc,
-              NULL, NULL, NULL);
+        if (in_encode == utf16beenc) {
+          g_free (field);
+          field = utf16_to_utf8 (data, data_size, utf16leenc);
+        }
       }
     }
 
       break;
     case ID3V2_ENCODING_ISO8859:
-      if (g_utf8_validate (data, data_size, NULL))
+      /* plain ASCII and UTF-8 mislabeled as ISO-8859-1 are by far the most
+       * common, these only need a copy */
+      if (g_utf8_validate (data, data_size, NULL)) {
         field = g_strndup (data, data_size);
-      else
+        valid = TRUE;
+      } else {
         /* field = g_convert (data, data_size, "UTF-8", "ISO-8859-1",
            NULL, NULL, NULL); */
         field = string_utf8_dup (data, data_size);
+      }
+      break;
+    case ID3V2_ENCODING_UTF8:
+      if (g_utf8_validate (data, data_size, NULL)) {
+        field = g_strndup (data, data_size);
+        valid = TRUE;
+      }
       break;
     default:
       field = g_strndup (data, data_size);
@@ -1082,7 +1158,7 @@ parse_insert_string_field (guint8 encoding, gchar * data, gint data_size,
   }
 
   if (field) {
-    if (g_utf8_validate (field, -1, NULL)) {
+    if (valid || g_utf8_validate (field, -1, NULL)) {
       g_array_append_val (fields, field);
       return;
     }
@@ -27,6 +27,7 @@
 #include <gst/gst.h>
 #include "tag.h"
 #include "id3v2.h"
+#include "gsttageditingprivate.h"
 
 #include <string.h>
 
@@ -560,12 +561,8 @@ GstSample *
 gst_tag_image_data_to_image_sample (const guint8 * image_data,
     guint image_data_len, GstTagImageType image_type)
 {
-  const gchar *name;
   GstBuffer *image;
-  GstSample *sample;
-  GstCaps *caps;
   GstMapInfo info;
-  GstStructure *image_info = NULL;
 
   g_return_val_if_fail (image_data != NULL, NULL);
   g_return_val_if_fail (image_data_len > 0, NULL);
@@ -583,8 +580,36 @@ gst_tag_image_data_to_image_sample (const guint8 * image_data,
   info.data[image_data_len] = '\0';
   gst_buffer_unmap (image, &info);
 
+  return __gst_tag_image_buffer_to_image_sample (image, image_data_len,
+      image_type, NULL);
+
+/* ERRORS */
+alloc_failed:
+  {
+    GST_WARNING ("failed to allocate buffer of %d for image", image_data_len);
+    return NULL;
+  }
+}
+
+/* Like gst_tag_image_data_to_image_sample(), but takes ownership of an
+ * existing @image buffer instead of copying the data, so that tag readers
+ * can pass a buffer that shares memory with the tag they parsed. @image may
+ * be one byte bigger than @image_data_len to hold a NUL terminator for
+ * text/uri-list data; if it isn't and the data turns out to be an uri, a
+ * NUL-terminated copy is made here. @caps takes ownership of the media type
+ * of the image when the caller already found it, otherwise it is NULL and
+ * @image is typefound. */
+GstSample *
+__gst_tag_image_buffer_to_image_sample (GstBuffer * image,
+    guint image_data_len, GstTagImageType image_type, GstCaps * caps)
+{
+  const gchar *name;
+  GstSample *sample;
+  GstStructure *image_info = NULL;
+
   /* Find GStreamer media type, can't trust declared type */
-  caps = gst_type_find_helper_for_buffer (NULL, image, NULL);
+  if (caps == NULL)
+    caps = gst_type_find_helper_for_buffer (NULL, image, NULL);
 
   if (caps == NULL)
     goto no_type;
@@ -601,11 +626,25 @@ gst_tag_image_data_to_image_sample (const guint8 * image_data,
     goto error;
   }
 
-  /* Decrease size by 1 if we don't have an URI list
-   * to keep the original size of the image
-   */
-  if (!g_str_equal (name, "text/uri-list"))
+  if (g_str_equal (name, "text/uri-list")) {
+    if (gst_buffer_get_size (image) == image_data_len) {
+      GstBuffer *uri;
+      GstMapInfo info;
+
+      uri = gst_buffer_new_and_alloc (image_data_len + 1);
+      gst_buffer_map (uri, &info, GST_MAP_WRITE);
+      gst_buffer_extract (image, 0, info.data, image_data_len);
+      info.data[image_data_len] = '\0';
+      gst_buffer_unmap (uri, &info);
+      gst_buffer_unref (image);
+      image = uri;
+    }
+  } else if (gst_buffer_get_size (image) != image_data_len) {
+    /* Decrease size by 1 if we don't have an URI list
+     * to keep the original size of the image
+     */
     gst_buffer_set_size (image, image_data_len);
+  }
 
   if (image_type != GST_TAG_IMAGE_TYPE_NONE) {
     GST_LOG ("Setting image type: %d", image_type);
@@ -626,17 +665,9 @@ no_type:
   }
 error:
   {
-    if (image)
-      gst_buffer_unref (image);
+    gst_buffer_unref (image);
     if (caps)
       gst_caps_unref (caps);
     return NULL;
   }
-alloc_failed:
-  {
-    GST_WARNING ("failed to allocate buffer of %d for image", image_data_len);
-    gst_buffer_unref (image);
-    return NULL;
-  }
-
 }
@@ -231,6 +231,222 @@ link_failed:
   }
 }
 
+static gboolean
+colorimetry_is_equal (const GstVideoColorimetry * c1,
+    const GstVideoColorimetry * c2)
+{
+  return c1->range == c2->range && c1->matrix == c2->matrix &&
+      c1->transfer == c2->transfer && c1->primaries == c2->primaries;
+}
+
+/* converts @buf in memory with a #GstVideoConverter when only the format,
+ * the colorimetry or the chroma siting change. Scaling is left to the
+ * pipeline. Returns NULL when the pipeline has to be used. */
+static GstSample *
+convert_sample_raw (GstBuffer * buf, GstCaps * from_caps, GstCaps * to_caps)
+{
+  GstVideoInfo in_info, out_info;
+  GstVideoFrame in_frame, out_frame;
+  GstVideoConverter *convert;
+  GstStructure *s;
+  GstCaps *out_caps;
+  GstBuffer *out_buf;
+  GstSample *result;
+  const gchar *str;
+  gint width, height;
+
+  if (gst_caps_get_size (to_caps) != 1 || !caps_are_raw (to_caps))
+    return NULL;
+
+  if (!gst_video_info_from_caps (&in_info, from_caps))
+    return NULL;
+
+  if (GST_VIDEO_INFO_IS_INTERLACED (&in_info))
+    return NULL;
+
+  width = GST_VIDEO_INFO_WIDTH (&in_info);
+  height = GST_VIDEO_INFO_HEIGHT (&in_info);
+
+  /* everything but the format, colorimetry and chroma siting stays the
+   * same */
+  out_info = in_info;
+  s = gst_caps_get_structure (to_caps, 0);
+  if (gst_structure_has_field (s, "format")) {
+    GstVideoFormat out_format;
+
+    if (!(str = gst_structure_get_string (s, "format")))
+      return NULL;
+
+    out_format = gst_video_format_from_string (str);
+    if (out_format == GST_VIDEO_FORMAT_UNKNOWN ||
+        out_format == GST_VIDEO_FORMAT_ENCODED)
+      return NULL;
+
+    gst_video_info_set_format (&out_info, out_format, width, height);
+    out_info.interlace_mode = in_info.interlace_mode;
+    out_info.flags = in_info.flags;
+    out_info.par_n = in_info.par_n;
+    out_info.par_d = in_info.par_d;
+    out_info.fps_n = in_info.fps_n;
+    out_info.fps_d = in_info.fps_d;
+    /* between YUV and RGB the defaults of the output format are used */
+    if (in_info.finfo->unpack_format == out_info.finfo->unpack_format) {
+      out_info.chroma_site = in_info.chroma_site;
+      out_info.colorimetry = in_info.colorimetry;
+    } else {
+      out_info.chroma_site = GST_VIDEO_CHROMA_SITE_UNKNOWN;
+    }
+  }
+  if ((str = gst_structure_get_string (s, "colorimetry")) &&
+      !gst_video_colorimetry_from_string (&out_info.colorimetry, str))
+    return NULL;
+  if ((str = gst_structure_get_string (s, "chroma-site")))
+    out_info.chroma_site = gst_video_chroma_from_string (str);
+
+  if (in_info.finfo->unpack_func == NULL || out_info.finfo->pack_func == NULL)
+    return NULL;
+
+  out_caps = gst_video_info_to_caps (&out_info);
+  if (!gst_caps_is_subset (out_caps, to_caps)) {
+    gst_caps_unref (out_caps);
+    return NULL;
+  }
+
+  if (GST_VIDEO_INFO_FORMAT (&in_info) == GST_VIDEO_INFO_FORMAT (&out_info)
+      && in_info.chroma_site == out_info.chroma_site
+      && colorimetry_is_equal (&in_info.colorimetry, &out_info.colorimetry)) {
+    out_buf = gst_buffer_ref (buf);
+  } else {
+    convert = gst_video_converter_new (&in_info, &out_info, NULL);
+    if (convert == NULL) {
+      gst_caps_unref (out_caps);
+      return NULL;
+    }
+    if (!gst_video_frame_map (&in_frame, &in_info, buf, GST_MAP_READ)) {
+      gst_video_converter_free (convert);
+      gst_caps_unref (out_caps);
+      return NULL;
+    }
+    out_buf = gst_buffer_new_and_alloc (out_info.size);
+    gst_buffer_copy_into (out_buf, buf,
+        GST_BUFFER_COPY_FLAGS | GST_BUFFER_COPY_TIMESTAMPS, 0, -1);
+    gst_video_frame_map (&out_frame, &out_info, out_buf, GST_MAP_WRITE);
+
+    GST_DEBUG ("converting %s to %s in memory",
+        GST_VIDEO_INFO_NAME (&in_info), GST_VIDEO_INFO_NAME (&out_info));
+
+    gst_video_converter_frame (convert, &in_frame, &out_frame);
+    gst_video_converter_free (convert);
+
+    gst_video_frame_unmap (&out_frame);
+    gst_video_frame_unmap (&in_frame);
+  }
+
+  result = gst_sample_new (out_buf, out_caps, NULL, NULL);
+  gst_buffer_unref (out_buf);
+  gst_caps_unref (out_caps);
+
+  return result;
+}
+
+/* conversion pipelines that finished their last conversion are kept around
+ * to be reused for the same caps */
+#define MAX_CACHED_PIPELINES 4
+
+typedef struct
+{
+  GstCaps *from_caps;
+  GstCaps *to_caps;
+  GstElement *pipeline;
+  GstElement *src;
+  GstElement *sink;
+} CachedPipeline;
+
+static GMutex pipeline_cache_lock;
+static GQueue pipeline_cache = G_QUEUE_INIT;
+
+static GstElement *
+get_convert_frame_pipeline (GstElement ** src_element,
+    GstElement ** sink_element, const GstCaps * from_caps,
+    const GstCaps * to_caps, GError ** err)
+{
+  CachedPipeline *cached = NULL;
+  GstElement *pipeline;
+  GList *l;
+
+  g_mutex_lock (&pipeline_cache_lock);
+  for (l = pipeline_cache.head; l != NULL; l = l->next) {
+    CachedPipeline *c = l->data;
+
+    if (gst_caps_is_equal (c->from_caps, from_caps) &&
+        gst_caps_is_equal (c->to_caps, to_caps)) {
+      g_queue_delete_link (&pipeline_cache, l);
+      cached = c;
+      break;
+    }
+  }
+  g_mutex_unlock (&pipeline_cache_lock);
+
+  if (cached == NULL)
+    return build_convert_frame_pipeline (src_element, sink_element,
+        from_caps, to_caps, err);
+
+  GST_DEBUG ("reusing conversion pipeline %p", cached->pipeline);
+
+  pipeline = cached->pipeline;
+  *src_element = cached->src;
+  *sink_element = cached->sink;
+  gst_caps_unref (cached->from_caps);
+  gst_caps_unref (cached->to_caps);
+  g_slice_free (CachedPipeline, cached);
+
+  return pipeline;
+}
+
+static void
+release_convert_frame_pipeline (GstElement * pipeline, GstElement * src,
+    GstElement * sink, const GstCaps * from_caps, const GstCaps * to_caps)
+{
+  CachedPipeline *cached;
+  GstBus *bus;
+
+  /* back to READY, that drops the prerolled buffer and the messages of this
+   * conversion */
+  if (gst_element_set_state (pipeline,
+          GST_STATE_READY) == GST_STATE_CHANGE_FAILURE) {
+    gst_element_set_state (pipeline, GST_STATE_NULL);
+    gst_object_unref (pipeline);
+    return;
+  }
+  bus = gst_element_get_bus (pipeline);
+  gst_bus_set_flushing (bus, TRUE);
+  gst_bus_set_flushing (bus, FALSE);
+  gst_object_unref (bus);
+
+  cached = g_slice_new (CachedPipeline);
+  cached->from_caps = gst_caps_copy (from_caps);
+  cached->to_caps = gst_caps_copy (to_caps);
+  cached->pipeline = pipeline;
+  cached->src = src;
+  cached->sink = sink;
+
+  g_mutex_lock (&pipeline_cache_lock);
+  g_queue_push_head (&pipeline_cache, cached);
+  if (g_queue_get_length (&pipeline_cache) > MAX_CACHED_PIPELINES)
+    cached = g_queue_pop_tail (&pipeline_cache);
+  else
+    cached = NULL;
+  g_mutex_unlock (&pipeline_cache_lock);
+
+  if (cached) {
+    gst_element_set_state (cached->pipeline, GST_STATE_NULL);
+    gst_object_unref (cached->pipeline);
+    gst_caps_unref (cached->from_caps);
+    gst_caps_unref (cached->to_caps);
+    g_slice_free (CachedPipeline, cached);
+  }
+}
+
 /**
  * gst_video_convert_sample:
  * @sample: a #GstSample
@@ -244,6 +460,10 @@ link_failed:
  *
  * The width, height and pixel-aspect-ratio can also be specified in the output caps.
  *
+ * Raw to raw conversions that keep the size are done in memory with a
+ * #GstVideoConverter, for everything else the conversion pipeline of a previous call with the
+ * same caps is reused when possible.
+ *
  * Returns: The converted #GstSample, or %NULL if an error happened (in which case @err
  * will point to the #GError).
  */
@@ -281,8 +501,14 @@ gst_video_convert_sample (GstSample * sample, const GstCaps * to_caps,
     gst_caps_append_structure (to_caps_copy, s);
   }
 
+  result = convert_sample_raw (buf, from_caps, to_caps_copy);
+  if (result) {
+    gst_caps_unref (to_caps_copy);
+    return result;
+  }
+
   pipeline =
-      build_convert_frame_pipeline (&src, &sink, from_caps, to_caps_copy, &err);
+      get_convert_frame_pipeline (&src, &sink, from_caps, to_caps_copy, &err);
   if (!pipeline)
     goto no_pipeline;
 
@@ -344,9 +570,14 @@ gst_video_convert_sample (GstSample * sample, const GstCaps * to_caps,
           "Could not convert video frame: timeout during conversion");
   }
 
-  gst_element_set_state (pipeline, GST_STATE_NULL);
   gst_object_unref (bus);
-  gst_object_unref (pipeline);
+  if (result) {
+    release_convert_frame_pipeline (pipeline, src, sink, from_caps,
+        to_caps_copy);
+  } else {
+    gst_element_set_state (pipeline, GST_STATE_NULL);
+    gst_object_unref (pipeline);
+  }
   gst_caps_unref (to_caps_copy);
 
   return result;
@@ -616,6 +847,7 @@ gst_video_convert_sample_async (GstSample * sample,
   GstBuffer *buf;
   GstCaps *from_caps, *to_caps_copy = NULL;
   GstElement *pipeline, *src, *sink;
+  GstSample *result;
   guint i, n;
   GSource *source;
   GstVideoConvertSampleContext *ctx;
@@ -645,6 +877,10 @@ gst_video_convert_sample_async (GstSample * sample,
     gst_caps_append_structure (to_caps_copy, s);
   }
 
+  result = convert_sample_raw (buf, from_caps, to_caps_copy);
+  if (result)
+    goto done;
+
   pipeline =
       build_convert_frame_pipeline (&src, &sink, from_caps, to_caps_copy,
       &error);
@@ -689,6 +925,28 @@ gst_video_convert_sample_async (GstSample * sample,
   gst_caps_unref (to_caps_copy);
 
   return;
+
+  /* converted in memory already, only dispatch the callback */
+done:
+  {
+    GstVideoConvertSampleCallbackContext *ctx;
+
+    gst_caps_unref (to_caps_copy);
+
+    ctx = g_slice_new0 (GstVideoConvertSampleCallbackContext);
+    ctx->callback = callback;
+    ctx->user_data = user_data;
+    ctx->destroy_notify = destroy_notify;
+    ctx->sample = result;
+
+    source = g_timeout_source_new (0);
+    g_source_set_callback (source,
+        (GSourceFunc) convert_frame_dispatch_callback, ctx,
+        (GDestroyNotify) gst_video_convert_frame_callback_context_free);
+    g_source_attach (source, context);
+    g_source_unref (source);
+    return;
+  }
   /* ERRORS */
 no_pipeline:
   {
@@ -127,6 +127,21 @@
  * bitrates. To enable it, a subclass should call
  * @gst_video_decoder_set_estimate_rate to enable handling of incoming byte-streams.
  *
+ * Subclasses that decode several frames at the same time, e.g. by handing
+ * them to a pool of worker threads, should say so with
+ * @gst_video_decoder_set_max_concurrent_frames.  The base class then accepts
+ * finished frames in any order and from any thread and pushes them
+ * downstream in presentation order.  It also makes room for the frames in
+ * flight in the output buffer pool and accounts for them in the reported
+ * latency and the QoS deadlines.
+ *
+ * The base class tells the subclass which frames it may skip without
+ * decoding them. Frames that can no longer be decoded in time according to
+ * QoS get the %GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_REF flag, and all frames of
+ * a trick mode segment, for which upstream was asked to skip with
+ * %GST_SEEK_FLAG_SKIP, get the %GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_KEY flag.
+ * The subclass drops the frames it skips with gst_video_decoder_drop_frame().
+ *
  * The base class provides some support for reverse playback, in particular
  * in case incoming data is not packetized or upstream does not provide
  * fragments on keyframe boundaries.  However, the subclass should then be prepared
@@ -134,6 +149,10 @@
  * forward processing, the latter immediately follows the former),
  * The subclass also needs to ensure the parsing stage properly marks keyframes,
  * unless it knows the upstream elements will do so properly for incoming data.
+ * By default all the frames from a keyframe to the next one are decoded and
+ * queued before they are pushed in reverse, the memory this takes can be
+ * limited with @gst_video_decoder_set_reverse_memory_limit at the cost of
+ * decoding parts of the frames multiple times.
  *
  * The bare minimum that a functional subclass needs to implement is:
  * <itemizedlist>
@@ -295,6 +314,7 @@
 
 #include "gstvideodecoder.h"
 #include "gstvideoutils.h"
+#include "video-codec-stats.h"
 
 #include <gst/video/video.h>
 #include <gst/video/video-event.h>
@@ -309,6 +329,15 @@ GST_DEBUG_CATEGORY (videodecoder_debug);
     (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GST_TYPE_VIDEO_DECODER, \
         GstVideoDecoderPrivate))
 
+#define DEFAULT_STATS_INTERVAL 0
+
+enum
+{
+  PROP_0,
+  PROP_STATS,
+  PROP_STATS_INTERVAL
+};
+
 struct _GstVideoDecoderPrivate
 {
   /* FIXME introduce a context ? */
@@ -357,6 +386,11 @@ struct _GstVideoDecoderPrivate
   GstClockTime pts_delta;
   gboolean reordered_output;
 
+  /* frames the subclass decodes at the same time; OBJECT_LOCK */
+  guint max_concurrent_frames;
+  /* finished frames that wait for earlier ones, in output order */
+  GList *finished_frames;
+
   /* reverse playback */
   /* collect input */
   GList *gather;
@@ -368,6 +402,8 @@ struct _GstVideoDecoderPrivate
   GList *decode;
   /* collected output - of buffer objects, not frames */
   GList *output_queued;
+  /* max bytes of decoded frames to queue, 0 is unlimited; OBJECT_LOCK */
+  guint64 reverse_memory_limit;
 
 
   /* base_picture_number is the picture number of the reference picture */
@@ -405,6 +441,11 @@ struct _GstVideoDecoderPrivate
 
   GstTagList *tags;
   gboolean tags_changed;
+
+  /* OBJECT_LOCK */
+  VideoCodecStats stats;
+  /* time spent pushing downstream from within handle_frame, in us */
+  gint64 push_time;
 };
 
 static GstElementClass *parent_class = NULL;
@@ -413,6 +454,10 @@ static void gst_video_decoder_init (GstVideoDecoder * dec,
     GstVideoDecoderClass * klass);
 
 static void gst_video_decoder_finalize (GObject * object);
+static void gst_video_decoder_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_video_decoder_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
 
 static gboolean gst_video_decoder_setcaps (GstVideoDecoder * dec,
     GstCaps * caps);
@@ -441,6 +486,14 @@ static GstVideoCodecFrame *gst_video_decoder_new_frame (GstVideoDecoder *
     decoder);
 static GstFlowReturn gst_video_decoder_clip_and_push_buf (GstVideoDecoder *
     decoder, GstBuffer * buf);
+static GstFlowReturn gst_video_decoder_finish_frame_internal (GstVideoDecoder *
+    decoder, GstVideoCodecFrame * frame);
+static GstFlowReturn gst_video_decoder_push_finished_frames (GstVideoDecoder *
+    decoder, gboolean force);
+static gint gst_video_decoder_compare_frame_order (GstVideoCodecFrame * a,
+    GstVideoCodecFrame * b);
+static GstClockTime gst_video_decoder_get_in_flight_duration (GstVideoDecoder *
+    decoder);
 static GstFlowReturn gst_video_decoder_flush_parse (GstVideoDecoder * dec,
     gboolean at_eos);
 
@@ -502,6 +555,61 @@ gst_video_decoder_class_init (GstVideoDecoderClass * klass)
   g_type_class_add_private (klass, sizeof (GstVideoDecoderPrivate));
 
   gobject_class->finalize = gst_video_decoder_finalize;
+  gobject_class->set_property = gst_video_decoder_set_property;
+  gobject_class->get_property = gst_video_decoder_get_property;
+
+  /**
+   * GstVideoDecoder:stats:
+   *
+   * Statistics of the decoder since it was started, in a structure named
+   * "GstVideoDecoderStats" with the following fields:
+   *
+   * "processed" G_TYPE_UINT64: frames handed to the subclass
+   *
+   * "pushed" G_TYPE_UINT64: decoded frames that were output
+   *
+   * "dropped" G_TYPE_UINT64: frames dropped with
+   * gst_video_decoder_drop_frame()
+   *
+   * "in-flight" G_TYPE_UINT: frames currently being decoded
+   *
+   * "processing-time" G_TYPE_UINT64: total time spent in the handle_frame
+   * vmethod in nanoseconds, without the time spent pushing downstream
+   *
+   * "max-processing-time" G_TYPE_UINT64: longest handle_frame call in
+   * nanoseconds
+   *
+   * "processing-histogram" #GstValueArray of G_TYPE_UINT64: number of
+   * handle_frame calls that took less than 1, 2, 4, 8, 16, 32 and 64
+   * milliseconds and longer
+   *
+   * "average-latency" G_TYPE_UINT64: average time between the creation of
+   * a frame and its output in nanoseconds
+   *
+   * "max-latency" G_TYPE_UINT64: longest time between the creation of a
+   * frame and its output in nanoseconds
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS,
+      g_param_spec_boxed ("stats", "Statistics",
+          "Statistics of the decoder since it was started",
+          GST_TYPE_STRUCTURE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstVideoDecoder:stats-interval:
+   *
+   * Interval in nanoseconds at which the #GstVideoDecoder:stats are posted
+   * as an element message on the bus while frames are output, 0 disables
+   * the messages.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS_INTERVAL,
+      g_param_spec_uint64 ("stats-interval", "Stats Interval",
+          "Interval for posting the stats on the bus in nanoseconds "
+          "(0 = disabled)", 0, G_MAXUINT64, DEFAULT_STATS_INTERVAL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_video_decoder_change_state);
@@ -557,6 +665,8 @@ gst_video_decoder_init (GstVideoDecoder * decoder, GstVideoDecoderClass * klass)
   decoder->priv->input_adapter = gst_adapter_new ();
   decoder->priv->output_adapter = gst_adapter_new ();
   decoder->priv->packetized = TRUE;
+  decoder->priv->max_concurrent_frames = 1;
+  decoder->priv->reverse_memory_limit = 0;
 
   gst_video_decoder_reset (decoder, TRUE);
 }
@@ -849,6 +959,49 @@ gst_video_decoder_finalize (GObject * object)
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
+static void
+gst_video_decoder_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstVideoDecoder *dec = GST_VIDEO_DECODER (object);
+
+  switch (prop_id) {
+    case PROP_STATS_INTERVAL:
+      GST_OBJECT_LOCK (dec);
+      dec->priv->stats.interval = g_value_get_uint64 (value);
+      GST_OBJECT_UNLOCK (dec);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_video_decoder_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstVideoDecoder *dec = GST_VIDEO_DECODER (object);
+  GstVideoDecoderPrivate *priv = dec->priv;
+
+  switch (prop_id) {
+    case PROP_STATS:
+      GST_OBJECT_LOCK (dec);
+      g_value_take_boxed (value, video_codec_stats_to_structure (&priv->stats,
+              "GstVideoDecoderStats", g_list_length (priv->frames)));
+      GST_OBJECT_UNLOCK (dec);
+      break;
+    case PROP_STATS_INTERVAL:
+      GST_OBJECT_LOCK (dec);
+      g_value_set_uint64 (value, priv->stats.interval);
+      GST_OBJECT_UNLOCK (dec);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
 /* hard == FLUSH, otherwise discont */
 static GstFlowReturn
 gst_video_decoder_flush (GstVideoDecoder * dec, gboolean hard)
@@ -971,6 +1124,10 @@ gst_video_decoder_drain_out (GstVideoDecoder * dec, gboolean at_eos)
   if (at_eos) {
     if (decoder_class->finish)
       ret = decoder_class->finish (dec);
+
+    /* nothing is going to finish the frames these are waiting for anymore */
+    if (priv->finished_frames && ret == GST_FLOW_OK)
+      ret = gst_video_decoder_push_finished_frames (dec, TRUE);
   }
 
   GST_VIDEO_DECODER_STREAM_UNLOCK (dec);
@@ -1470,7 +1627,7 @@ gst_video_decoder_src_query (GstPad * pad, GstObject * parent, GstQuery * query)
     case GST_QUERY_LATENCY:
     {
       gboolean live;
-      GstClockTime min_latency, max_latency;
+      GstClockTime min_latency, max_latency, in_flight;
 
       res = gst_pad_peer_query (dec->sinkpad, query);
       if (res) {
@@ -1480,11 +1637,12 @@ gst_video_decoder_src_query (GstPad * pad, GstObject * parent, GstQuery * query)
             GST_TIME_ARGS (min_latency), GST_TIME_ARGS (max_latency));
 
         GST_OBJECT_LOCK (dec);
-        min_latency += dec->priv->min_latency;
+        in_flight = gst_video_decoder_get_in_flight_duration (dec);
+        min_latency += dec->priv->min_latency + in_flight;
         if (dec->priv->max_latency == GST_CLOCK_TIME_NONE) {
           max_latency = GST_CLOCK_TIME_NONE;
         } else if (max_latency != GST_CLOCK_TIME_NONE) {
-          max_latency += dec->priv->max_latency;
+          max_latency += dec->priv->max_latency + in_flight;
         }
         GST_OBJECT_UNLOCK (dec);
 
@@ -1643,6 +1801,9 @@ gst_video_decoder_clear_queues (GstVideoDecoder * dec)
   g_list_free_full (priv->parse_gather,
       (GDestroyNotify) gst_video_codec_frame_unref);
   priv->parse_gather = NULL;
+  g_list_free_full (priv->finished_frames,
+      (GDestroyNotify) gst_video_codec_frame_unref);
+  priv->finished_frames = NULL;
   g_list_free_full (priv->frames, (GDestroyNotify) gst_video_codec_frame_unref);
   priv->frames = NULL;
 }
@@ -1707,6 +1868,9 @@ gst_video_decoder_reset (GstVideoDecoder * decoder, gboolean full)
   priv->decode_frame_number = 0;
   priv->base_picture_number = 0;
 
+  g_list_free_full (priv->finished_frames,
+      (GDestroyNotify) gst_video_codec_frame_unref);
+  priv->finished_frames = NULL;
   g_list_free_full (priv->frames, (GDestroyNotify) gst_video_codec_frame_unref);
   priv->frames = NULL;
 
@@ -1768,15 +1932,185 @@ gst_video_decoder_chain_forward (GstVideoDecoder * decoder,
   return ret;
 }
 
+/* push the decoded frames queued for reverse playback downstream, the most
+ * recent one first */
+static GstFlowReturn
+gst_video_decoder_push_output_queued (GstVideoDecoder * dec)
+{
+  GstVideoDecoderPrivate *priv = dec->priv;
+  GstFlowReturn res = GST_FLOW_OK;
+  GList *walk;
+
+  walk = priv->output_queued;
+  while (walk) {
+    GstBuffer *buf = GST_BUFFER_CAST (walk->data);
+
+    if (G_LIKELY (res == GST_FLOW_OK)) {
+      /* avoid stray DISCONT from forward processing,
+       * which have no meaning in reverse pushing */
+      GST_BUFFER_FLAG_UNSET (buf, GST_BUFFER_FLAG_DISCONT);
+
+      /* Last chance to calculate a timestamp as we loop backwards
+       * through the list */
+      if (GST_BUFFER_TIMESTAMP (buf) != GST_CLOCK_TIME_NONE)
+        priv->last_timestamp_out = GST_BUFFER_TIMESTAMP (buf);
+      else if (priv->last_timestamp_out != GST_CLOCK_TIME_NONE &&
+          GST_BUFFER_DURATION (buf) != GST_CLOCK_TIME_NONE) {
+        GST_BUFFER_TIMESTAMP (buf) =
+            priv->last_timestamp_out - GST_BUFFER_DURATION (buf);
+        priv->last_timestamp_out = GST_BUFFER_TIMESTAMP (buf);
+        GST_LOG_OBJECT (dec,
+            "Calculated TS %" GST_TIME_FORMAT " working backwards",
+            GST_TIME_ARGS (priv->last_timestamp_out));
+      }
+
+      res = gst_video_decoder_clip_and_push_buf (dec, buf);
+    } else {
+      gst_buffer_unref (buf);
+    }
+
+    priv->output_queued =
+        g_list_delete_link (priv->output_queued, priv->output_queued);
+    walk = priv->output_queued;
+  }
+
+  return res;
+}
+
+/* the number of decoded frames that fit in the reverse playback memory
+ * limit, 0 when there is no limit or the frame size is not known yet */
+static guint
+gst_video_decoder_get_reverse_max_frames (GstVideoDecoder * dec)
+{
+  GstVideoDecoderPrivate *priv = dec->priv;
+  guint64 limit;
+  gsize size = 0;
+
+  GST_OBJECT_LOCK (dec);
+  limit = priv->reverse_memory_limit;
+  if (priv->output_state)
+    size = GST_VIDEO_INFO_SIZE (&priv->output_state->info);
+  GST_OBJECT_UNLOCK (dec);
+
+  if (limit == 0 || size == 0)
+    return 0;
+
+  return MAX (1, MIN (limit / size, G_MAXUINT));
+}
+
+/* make a frame to decode @buf again, it does not take the events that are
+ * waiting for the next parsed frame */
+static GstVideoCodecFrame *
+gst_video_decoder_new_frame_for_buffer (GstVideoDecoder * dec, GstBuffer * buf,
+    GstVideoCodecFrameFlags flags)
+{
+  GstVideoDecoderPrivate *priv = dec->priv;
+  GstVideoCodecFrame *frame;
+  GList *events;
+
+  events = priv->current_frame_events;
+  priv->current_frame_events = NULL;
+  frame = gst_video_decoder_new_frame (dec);
+  priv->current_frame_events = events;
+
+  frame->input_buffer = gst_buffer_ref (buf);
+  frame->flags = flags;
+
+  return frame;
+}
+
+/* decode the frames of priv->decode, which start with a keyframe, in
+ * windows of @max_frames frames, starting with the last window. Each pass
+ * decodes from the keyframe up to the end of its window but only outputs the
+ * frames of the window, which are pushed before the next pass starts. */
+static GstFlowReturn
+gst_video_decoder_flush_decode_bounded (GstVideoDecoder * dec,
+    guint max_frames)
+{
+  GstVideoDecoderPrivate *priv = dec->priv;
+  GstVideoDecoderClass *decoder_class = GST_VIDEO_DECODER_GET_CLASS (dec);
+  GstFlowReturn res;
+  GstVideoCodecFrame *frame;
+  GstVideoCodecFrameFlags *flags;
+  GstBuffer **inputs;
+  GList *walk;
+  guint i, n, start, end;
+
+  n = g_list_length (priv->decode);
+
+  GST_DEBUG_OBJECT (dec, "decoding %u frames in windows of %u frames", n,
+      max_frames);
+
+  /* the queued frames come after the ones we are going to decode */
+  res = gst_video_decoder_push_output_queued (dec);
+  if (res != GST_FLOW_OK)
+    return res;
+
+  /* keep the input to decode it again in the next passes */
+  inputs = g_new (GstBuffer *, n);
+  flags = g_new (GstVideoCodecFrameFlags, n);
+  for (i = 0, walk = priv->decode; walk; i++, walk = walk->next) {
+    frame = walk->data;
+    inputs[i] = gst_buffer_ref (frame->input_buffer);
+    flags[i] = frame->flags;
+  }
+
+  for (end = n; end > 0 && res == GST_FLOW_OK; end = start) {
+    start = (end > max_frames) ? end - max_frames : 0;
+
+    GST_DEBUG_OBJECT (dec, "decoding window %u-%u", start, end);
+
+    /* restart from the keyframe */
+    gst_video_decoder_flush (dec, FALSE);
+
+    for (i = 0; i < end && res == GST_FLOW_OK; i++) {
+      if (end == n) {
+        /* the first pass decodes the parsed frames, with their events */
+        frame = priv->decode->data;
+        priv->decode = g_list_delete_link (priv->decode, priv->decode);
+      } else {
+        frame = gst_video_decoder_new_frame_for_buffer (dec, inputs[i],
+            flags[i]);
+      }
+      /* frames before the window are only needed as reference */
+      if (i < start)
+        GST_VIDEO_CODEC_FRAME_SET_DECODE_ONLY (frame);
+
+      res = gst_video_decoder_decode_frame (dec, frame);
+    }
+
+    /* get the frames of the window that the subclass still holds */
+    if (res == GST_FLOW_OK && decoder_class->finish)
+      res = decoder_class->finish (dec);
+    if (res == GST_FLOW_OK && priv->finished_frames)
+      res = gst_video_decoder_push_finished_frames (dec, TRUE);
+
+    if (res == GST_FLOW_OK)
+      res = gst_video_decoder_push_output_queued (dec);
+  }
+
+  for (i = 0; i < n; i++)
+    gst_buffer_unref (inputs[i]);
+  g_free (inputs);
+  g_free (flags);
+
+  return res;
+}
+
 static GstFlowReturn
 gst_video_decoder_flush_decode (GstVideoDecoder * dec)
 {
   GstVideoDecoderPrivate *priv = dec->priv;
   GstFlowReturn res = GST_FLOW_OK;
   GList *walk;
+  guint max_frames;
 
   GST_DEBUG_OBJECT (dec, "flushing buffers to decode");
 
+  max_frames = gst_video_decoder_get_reverse_max_frames (dec);
+  if (max_frames > 0 && g_list_length (priv->decode) > max_frames)
+    return gst_video_decoder_flush_decode_bounded (dec, max_frames);
+
   /* clear buffer and decoder state */
   gst_video_decoder_flush (dec, FALSE);
 
@@ -1884,37 +2218,12 @@ gst_video_decoder_flush_parse (GstVideoDecoder * dec, gboolean at_eos)
   }
 
   /* now send queued data downstream */
-  walk = priv->output_queued;
-  while (walk) {
-    GstBuffer *buf = GST_BUFFER_CAST (walk->data);
-
-    if (G_LIKELY (res == GST_FLOW_OK)) {
-      /* avoid stray DISCONT from forward processing,
-       * which have no meaning in reverse pushing */
-      GST_BUFFER_FLAG_UNSET (buf, GST_BUFFER_FLAG_DISCONT);
-
-      /* Last chance to calculate a timestamp as we loop backwards
-       * through the list */
-      if (GST_BUFFER_TIMESTAMP (buf) != GST_CLOCK_TIME_NONE)
-        priv->last_timestamp_out = GST_BUFFER_TIMESTAMP (buf);
-      else if (priv->last_timestamp_out != GST_CLOCK_TIME_NONE &&
-          GST_BUFFER_DURATION (buf) != GST_CLOCK_TIME_NONE) {
-        GST_BUFFER_TIMESTAMP (buf) =
-            priv->last_timestamp_out - GST_BUFFER_DURATION (buf);
-        priv->last_timestamp_out = GST_BUFFER_TIMESTAMP (buf);
-        GST_LOG_OBJECT (dec,
-            "Calculated TS %" GST_TIME_FORMAT " working backwards",
-            GST_TIME_ARGS (priv->last_timestamp_out));
-      }
-
-      res = gst_video_decoder_clip_and_push_buf (dec, buf);
-    } else {
-      gst_buffer_unref (buf);
-    }
-
-    priv->output_queued =
-        g_list_delete_link (priv->output_queued, priv->output_queued);
-    walk = priv->output_queued;
+  if (G_LIKELY (res == GST_FLOW_OK)) {
+    res = gst_video_decoder_push_output_queued (dec);
+  } else {
+    g_list_free_full (priv->output_queued,
+        (GDestroyNotify) gst_mini_object_unref);
+    priv->output_queued = NULL;
   }
 
 done:
@@ -2034,6 +2343,9 @@ gst_video_decoder_change_state (GstElement * element, GstStateChange transition)
         goto open_failed;
       break;
     case GST_STATE_CHANGE_READY_TO_PAUSED:
+      GST_OBJECT_LOCK (decoder);
+      video_codec_stats_reset (&decoder->priv->stats);
+      GST_OBJECT_UNLOCK (decoder);
       /* Initialize device/library if needed */
       if (decoder_class->start && !decoder_class->start (decoder))
         goto start_failed;
@@ -2123,6 +2435,8 @@ gst_video_decoder_new_frame (GstVideoDecoder * decoder)
   priv->current_frame_events = NULL;
   GST_VIDEO_DECODER_STREAM_UNLOCK (decoder);
 
+  frame->abidata.ABI.arrival = g_get_monotonic_time ();
+
   GST_LOG_OBJECT (decoder, "Created new frame %p (sfn:%d)",
       frame, frame->system_frame_number);
 
@@ -2358,6 +2672,7 @@ gst_video_decoder_drop_frame (GstVideoDecoder * dec, GstVideoCodecFrame * frame)
   GstSegment *segment;
   GstMessage *qos_msg;
   gdouble proportion;
+  GstFlowReturn ret = GST_FLOW_OK;
 
   GST_LOG_OBJECT (dec, "drop frame %p", frame);
 
@@ -2372,6 +2687,7 @@ gst_video_decoder_drop_frame (GstVideoDecoder * dec, GstVideoCodecFrame * frame)
 
   /* post QoS message */
   GST_OBJECT_LOCK (dec);
+  dec->priv->stats.dropped++;
   proportion = dec->priv->proportion;
   earliest_time = dec->priv->earliest_time;
   GST_OBJECT_UNLOCK (dec);
@@ -2395,9 +2711,13 @@ gst_video_decoder_drop_frame (GstVideoDecoder * dec, GstVideoCodecFrame * frame)
   /* now free the frame */
   gst_video_decoder_release_frame (dec, frame);
 
+  /* finished frames might only have been waiting for this one */
+  if (dec->priv->finished_frames)
+    ret = gst_video_decoder_push_finished_frames (dec, FALSE);
+
   GST_VIDEO_DECODER_STREAM_UNLOCK (dec);
 
-  return GST_FLOW_OK;
+  return ret;
 }
 
 /**
@@ -2420,13 +2740,105 @@ GstFlowReturn
 gst_video_decoder_finish_frame (GstVideoDecoder * decoder,
     GstVideoCodecFrame * frame)
 {
-  GstFlowReturn ret = GST_FLOW_OK;
+  GstFlowReturn ret;
   GstVideoDecoderPrivate *priv = decoder->priv;
-  GstBuffer *output_buffer;
+  guint max_concurrent_frames;
 
   GST_LOG_OBJECT (decoder, "finish frame %p", frame);
 
+  max_concurrent_frames = gst_video_decoder_get_max_concurrent_frames (decoder);
+
   GST_VIDEO_DECODER_STREAM_LOCK (decoder);
+  if (max_concurrent_frames > 1 || priv->finished_frames) {
+    priv->finished_frames = g_list_insert_sorted (priv->finished_frames, frame,
+        (GCompareFunc) gst_video_decoder_compare_frame_order);
+    ret = gst_video_decoder_push_finished_frames (decoder, FALSE);
+  } else {
+    ret = gst_video_decoder_finish_frame_internal (decoder, frame);
+  }
+  GST_VIDEO_DECODER_STREAM_UNLOCK (decoder);
+
+  return ret;
+}
+
+/* The time a frame is ordered by: its PTS, or its DTS without PTS. Frames
+ * without either go after all others */
+static GstClockTime
+gst_video_decoder_frame_order_time (GstVideoCodecFrame * frame)
+{
+  if (GST_CLOCK_TIME_IS_VALID (frame->pts))
+    return frame->pts;
+  if (GST_CLOCK_TIME_IS_VALID (frame->dts))
+    return frame->dts;
+  return GST_CLOCK_TIME_NONE;
+}
+
+/* Orders frames by their order time and then by decoding order. Every
+ * frame has a single key so this is a total order, which also puts frames
+ * without any timestamps in decoding order */
+static gint
+gst_video_decoder_compare_frame_order (GstVideoCodecFrame * a,
+    GstVideoCodecFrame * b)
+{
+  GstClockTime ta = gst_video_decoder_frame_order_time (a);
+  GstClockTime tb = gst_video_decoder_frame_order_time (b);
+
+  if (ta != tb)
+    return ta < tb ? -1 : 1;
+
+  if (a->system_frame_number == b->system_frame_number)
+    return 0;
+
+  return a->system_frame_number < b->system_frame_number ? -1 : 1;
+}
+
+/* With stream lock. Pushes the finished frames that no pending frame has to
+ * be output before, or all finished frames if @force is TRUE */
+static GstFlowReturn
+gst_video_decoder_push_finished_frames (GstVideoDecoder * decoder,
+    gboolean force)
+{
+  GstVideoDecoderPrivate *priv = decoder->priv;
+  GstFlowReturn ret = GST_FLOW_OK;
+
+  while (priv->finished_frames && ret == GST_FLOW_OK) {
+    GstVideoCodecFrame *frame = priv->finished_frames->data;
+
+    if (!force) {
+      GList *l;
+
+      for (l = priv->frames; l; l = l->next) {
+        GstVideoCodecFrame *tmp = l->data;
+
+        if (tmp != frame && !g_list_find (priv->finished_frames, tmp) &&
+            gst_video_decoder_compare_frame_order (tmp, frame) < 0)
+          break;
+      }
+      if (l) {
+        GST_LOG_OBJECT (decoder, "frame %p (#%d) waits for frame #%d", frame,
+            frame->system_frame_number,
+            ((GstVideoCodecFrame *) l->data)->system_frame_number);
+        break;
+      }
+    }
+
+    priv->finished_frames =
+        g_list_delete_link (priv->finished_frames, priv->finished_frames);
+    ret = gst_video_decoder_finish_frame_internal (decoder, frame);
+  }
+
+  return ret;
+}
+
+/* With stream lock, takes the frame reference */
+static GstFlowReturn
+gst_video_decoder_finish_frame_internal (GstVideoDecoder * decoder,
+    GstVideoCodecFrame * frame)
+{
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstVideoDecoderPrivate *priv = decoder->priv;
+  GstBuffer *output_buffer;
+  GstStructure *stats = NULL;
 
   if (G_UNLIKELY (priv->output_state_changed || (priv->output_state
               && gst_pad_check_reconfigure (decoder->srcpad)))) {
@@ -2479,6 +2891,17 @@ gst_video_decoder_finish_frame (GstVideoDecoder * decoder,
    * might have a refcount > 1 */
   output_buffer = gst_buffer_ref (output_buffer);
 
+  GST_OBJECT_LOCK (decoder);
+  video_codec_stats_add_pushed (&priv->stats, frame->abidata.ABI.arrival);
+  if (video_codec_stats_need_post (&priv->stats))
+    stats = video_codec_stats_to_structure (&priv->stats,
+        "GstVideoDecoderStats", g_list_length (priv->frames));
+  GST_OBJECT_UNLOCK (decoder);
+
+  if (stats)
+    gst_element_post_message (GST_ELEMENT_CAST (decoder),
+        gst_message_new_element (GST_OBJECT_CAST (decoder), stats));
+
   /* Release frame so the buffer is writable when we push it downstream
    * if possible, i.e. if the subclass does not hold additional references
    * to the frame
@@ -2496,7 +2919,6 @@ gst_video_decoder_finish_frame (GstVideoDecoder * decoder,
 done:
   if (frame)
     gst_video_decoder_release_frame (decoder, frame);
-  GST_VIDEO_DECODER_STREAM_UNLOCK (decoder);
   return ret;
 }
 
@@ -2511,6 +2933,7 @@ gst_video_decoder_clip_and_push_buf (GstVideoDecoder * decoder, GstBuffer * buf)
   guint64 cstart, cstop;
   GstSegment *segment;
   GstClockTime duration;
+  gint64 push_start;
 
   /* Check for clipping */
   start = GST_BUFFER_PTS (buf);
@@ -2575,7 +2998,9 @@ gst_video_decoder_clip_and_push_buf (GstVideoDecoder * decoder, GstBuffer * buf)
   if (G_UNLIKELY (priv->error_count))
     priv->error_count = 0;
 
+  push_start = g_get_monotonic_time ();
   ret = gst_pad_push (decoder->srcpad, buf);
+  priv->push_time += g_get_monotonic_time () - push_start;
 
 done:
   return ret;
@@ -2592,7 +3017,7 @@ void
 gst_video_decoder_add_to_frame (GstVideoDecoder * decoder, int n_bytes)
 {
   GstVideoDecoderPrivate *priv = decoder->priv;
-  GstBuffer *buf;
+  GList *buffers, *walk;
 
   GST_LOG_OBJECT (decoder, "add %d bytes to frame", n_bytes);
 
@@ -2604,12 +3029,32 @@ gst_video_decoder_add_to_frame (GstVideoDecoder * decoder, int n_bytes)
     priv->frame_offset =
         priv->input_offset - gst_adapter_available (priv->input_adapter);
   }
-  buf = gst_adapter_take_buffer (priv->input_adapter, n_bytes);
-
-  gst_adapter_push (priv->output_adapter, buf);
+  /* move the input buffers over as they are, taking the bytes as one buffer
+   * would copy them when they span several input buffers */
+  buffers = gst_adapter_take_list (priv->input_adapter, n_bytes);
+  for (walk = buffers; walk; walk = walk->next)
+    gst_adapter_push (priv->output_adapter, walk->data);
+  g_list_free (buffers);
   GST_VIDEO_DECODER_STREAM_UNLOCK (decoder);
 }
 
+/* take @n_bytes from @adapter in one buffer that refers to the memory of the
+ * buffers in the adapter instead of copying it into a new block */
+static GstBuffer *
+gst_video_decoder_take_frame_data (GstAdapter * adapter, gsize n_bytes)
+{
+  GList *buffers, *walk;
+  GstBuffer *buffer;
+
+  buffers = gst_adapter_take_list (adapter, n_bytes);
+  buffer = buffers->data;
+  for (walk = buffers->next; walk; walk = walk->next)
+    buffer = gst_buffer_append (buffer, walk->data);
+  g_list_free (buffers);
+
+  return buffer;
+}
+
 static guint64
 gst_video_decoder_get_frame_duration (GstVideoDecoder * decoder,
     GstVideoCodecFrame * frame)
@@ -2657,9 +3102,10 @@ gst_video_decoder_have_frame (GstVideoDecoder * decoder)
 
   n_available = gst_adapter_available (priv->output_adapter);
   if (n_available) {
-    buffer = gst_adapter_take_buffer (priv->output_adapter, n_available);
+    buffer = gst_video_decoder_take_frame_data (priv->output_adapter,
+        n_available);
   } else {
-    buffer = gst_buffer_new_and_alloc (0);
+    buffer = gst_buffer_new ();
   }
 
   priv->current_frame->input_buffer = buffer;
@@ -2702,6 +3148,8 @@ gst_video_decoder_decode_frame (GstVideoDecoder * decoder,
   GstVideoDecoderPrivate *priv = decoder->priv;
   GstVideoDecoderClass *decoder_class;
   GstFlowReturn ret = GST_FLOW_OK;
+  gint64 start;
+  guint max_concurrent_frames;
 
   decoder_class = GST_VIDEO_DECODER_GET_CLASS (decoder);
 
@@ -2740,7 +3188,8 @@ gst_video_decoder_decode_frame (GstVideoDecoder * decoder,
   gst_video_codec_frame_ref (frame);
   priv->frames = g_list_append (priv->frames, frame);
 
-  if (g_list_length (priv->frames) > 10) {
+  max_concurrent_frames = gst_video_decoder_get_max_concurrent_frames (decoder);
+  if (g_list_length (priv->frames) > 10 + max_concurrent_frames) {
     GST_DEBUG_OBJECT (decoder, "decoder frame list getting long: %d frames,"
         "possible internal leaking?", g_list_length (priv->frames));
   }
@@ -2749,8 +3198,31 @@ gst_video_decoder_decode_frame (GstVideoDecoder * decoder,
       gst_segment_to_running_time (&decoder->input_segment, GST_FORMAT_TIME,
       frame->pts);
 
+  /* tell the subclass what it may skip in trick modes and when late */
+  GST_VIDEO_CODEC_FRAME_FLAG_UNSET (frame,
+      GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_REF |
+      GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_KEY);
+  if (decoder->input_segment.flags & GST_SEGMENT_FLAG_SKIP)
+    GST_VIDEO_CODEC_FRAME_FLAG_SET (frame,
+        GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_KEY);
+  if (gst_video_decoder_get_max_decode_time (decoder, frame) < 0)
+    GST_VIDEO_CODEC_FRAME_FLAG_SET (frame,
+        GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_REF);
+  if (GST_VIDEO_CODEC_FRAME_FLAGS (frame) &
+      (GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_REF |
+          GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_KEY))
+    GST_LOG_OBJECT (decoder, "frame may be skipped, flags 0x%x",
+        GST_VIDEO_CODEC_FRAME_FLAGS (frame));
+
   /* do something with frame */
+  priv->push_time = 0;
+  start = g_get_monotonic_time ();
   ret = decoder_class->handle_frame (decoder, frame);
+
+  GST_OBJECT_LOCK (decoder);
+  video_codec_stats_add_processed (&priv->stats, start + priv->push_time);
+  GST_OBJECT_UNLOCK (decoder);
+
   if (ret != GST_FLOW_OK)
     GST_DEBUG_OBJECT (decoder, "flow error %s", gst_flow_get_name (ret));
 
@@ -2929,6 +3401,7 @@ gst_video_decoder_decide_allocation_default (GstVideoDecoder * decoder,
   GstStructure *config;
   gboolean update_pool, update_allocator;
   GstVideoInfo vinfo;
+  guint max_concurrent_frames;
 
   gst_query_parse_allocation (query, &outcaps, NULL);
   gst_video_info_init (&vinfo);
@@ -2958,6 +3431,14 @@ gst_video_decoder_decide_allocation_default (GstVideoDecoder * decoder,
     update_pool = FALSE;
   }
 
+  /* every frame in flight holds on to an output buffer */
+  max_concurrent_frames = gst_video_decoder_get_max_concurrent_frames (decoder);
+  if (max_concurrent_frames > 1) {
+    min += max_concurrent_frames - 1;
+    if (max != 0)
+      max += max_concurrent_frames - 1;
+  }
+
   if (pool == NULL) {
     /* no pool, we can make our own */
     GST_DEBUG_OBJECT (decoder, "no pool, making new pool");
@@ -3001,7 +3482,7 @@ gst_video_decoder_negotiate_default (GstVideoDecoder * decoder)
   GstVideoCodecState *state = decoder->priv->output_state;
   GstVideoDecoderClass *klass;
   GstQuery *query = NULL;
-  GstBufferPool *pool = NULL;
+  GstBufferPool *pool = NULL, *old_pool;
   GstAllocator *allocator;
   GstAllocationParams params;
   gboolean ret = TRUE;
@@ -3093,11 +3574,16 @@ gst_video_decoder_negotiate_default (GstVideoDecoder * decoder)
   decoder->priv->allocator = allocator;
   decoder->priv->params = params;
 
-  if (decoder->priv->pool) {
-    gst_buffer_pool_set_active (decoder->priv->pool, FALSE);
-    gst_object_unref (decoder->priv->pool);
-  }
+  /* worker threads of the subclass pick up the pool with the object lock */
+  GST_OBJECT_LOCK (decoder);
+  old_pool = decoder->priv->pool;
   decoder->priv->pool = pool;
+  GST_OBJECT_UNLOCK (decoder);
+
+  if (old_pool) {
+    gst_buffer_pool_set_active (old_pool, FALSE);
+    gst_object_unref (old_pool);
+  }
 
   /* and activate */
   gst_buffer_pool_set_active (pool, TRUE);
@@ -3216,40 +3702,61 @@ gst_video_decoder_allocate_output_frame (GstVideoDecoder *
 {
   GstFlowReturn flow_ret;
   GstVideoCodecState *state;
+  GstBufferPool *pool;
   int num_bytes;
 
   g_return_val_if_fail (decoder->priv->output_state, GST_FLOW_NOT_NEGOTIATED);
   g_return_val_if_fail (frame->output_buffer == NULL, GST_FLOW_ERROR);
 
-  GST_VIDEO_DECODER_STREAM_LOCK (decoder);
-
-  state = decoder->priv->output_state;
+  /* this can be called from the worker threads of subclasses that decode
+   * frames concurrently, so only take the stream lock to negotiate */
+  state = gst_video_decoder_get_output_state (decoder);
   if (state == NULL) {
     g_warning ("Output state should be set before allocating frame");
-    goto error;
+    return GST_FLOW_ERROR;
   }
   num_bytes = GST_VIDEO_INFO_SIZE (&state->info);
+  gst_video_codec_state_unref (state);
   if (num_bytes == 0) {
     g_warning ("Frame size should not be 0");
-    goto error;
+    return GST_FLOW_ERROR;
   }
 
   if (G_UNLIKELY (decoder->priv->output_state_changed
-          || gst_pad_check_reconfigure (decoder->srcpad)))
+          || gst_pad_check_reconfigure (decoder->srcpad))) {
+    GST_VIDEO_DECODER_STREAM_LOCK (decoder);
     gst_video_decoder_negotiate (decoder);
+    GST_VIDEO_DECODER_STREAM_UNLOCK (decoder);
+  }
 
-  GST_LOG_OBJECT (decoder, "alloc buffer size %d", num_bytes);
+  GST_OBJECT_LOCK (decoder);
+  pool = decoder->priv->pool ? gst_object_ref (decoder->priv->pool) : NULL;
+  GST_OBJECT_UNLOCK (decoder);
 
-  flow_ret = gst_buffer_pool_acquire_buffer (decoder->priv->pool,
-      &frame->output_buffer, NULL);
+  if (pool == NULL) {
+    GST_INFO_OBJECT (decoder, "no buffer pool to allocate from");
+    return GST_FLOW_NOT_NEGOTIATED;
+  }
 
-  GST_VIDEO_DECODER_STREAM_UNLOCK (decoder);
+  GST_LOG_OBJECT (decoder, "alloc buffer size %d", num_bytes);
+
+  flow_ret = gst_buffer_pool_acquire_buffer (pool, &frame->output_buffer, NULL);
+  gst_object_unref (pool);
 
   return flow_ret;
+}
 
-error:
-  GST_VIDEO_DECODER_STREAM_UNLOCK (decoder);
-  return GST_FLOW_ERROR;
+/* With OBJECT_LOCK. Time the frames decoded concurrently with a frame can
+ * delay its output by */
+static GstClockTime
+gst_video_decoder_get_in_flight_duration (GstVideoDecoder * decoder)
+{
+  GstVideoDecoderPrivate *priv = decoder->priv;
+
+  if (priv->max_concurrent_frames <= 1)
+    return 0;
+
+  return (priv->max_concurrent_frames - 1) * priv->qos_frame_duration;
 }
 
 /**
@@ -3274,10 +3781,14 @@ gst_video_decoder_get_max_decode_time (GstVideoDecoder *
   GST_OBJECT_LOCK (decoder);
   earliest_time = decoder->priv->earliest_time;
   if (GST_CLOCK_TIME_IS_VALID (earliest_time)
-      && GST_CLOCK_TIME_IS_VALID (frame->deadline))
+      && GST_CLOCK_TIME_IS_VALID (frame->deadline)) {
     deadline = GST_CLOCK_DIFF (earliest_time, frame->deadline);
-  else
+    /* the frame can only go out after the ones decoded alongside it */
+    deadline -= (GstClockTimeDiff)
+        gst_video_decoder_get_in_flight_duration (decoder);
+  } else {
     deadline = G_MAXINT64;
+  }
 
   GST_LOG_OBJECT (decoder, "earliest %" GST_TIME_FORMAT
       ", frame deadline %" GST_TIME_FORMAT ", deadline %" GST_TIME_FORMAT,
@@ -3365,6 +3876,122 @@ gst_video_decoder_get_max_errors (GstVideoDecoder * dec)
   return dec->priv->max_errors;
 }
 
+/**
+ * gst_video_decoder_set_max_concurrent_frames:
+ * @decoder: a #GstVideoDecoder
+ * @n_frames: number of frames the subclass decodes at the same time
+ *
+ * Lets #GstVideoDecoder sub-classes that decode several frames concurrently,
+ * e.g. in a pool of worker threads, tell the baseclass how many frames can
+ * be in flight at once.  Default is 1.
+ *
+ * With more than one frame in flight, gst_video_decoder_finish_frame() may be
+ * called from any thread and in any order.  Finished frames are held back
+ * until all frames that come before them in presentation order (or decoding
+ * order, if there are no timestamps) are finished as well, and are then
+ * pushed downstream in that order.  Frames that are held back are still
+ * returned by gst_video_decoder_get_frames().
+ * gst_video_decoder_allocate_output_frame() may be called from the worker
+ * threads too.  The subclass must not hold the stream lock while it waits
+ * for its worker threads.
+ *
+ * The baseclass makes room for the frames in flight in the output buffer
+ * pool, and adds their duration to the reported latency and subtracts it
+ * from the result of gst_video_decoder_get_max_decode_time().
+ *
+ * Since: 1.2
+ */
+void
+gst_video_decoder_set_max_concurrent_frames (GstVideoDecoder * decoder,
+    guint n_frames)
+{
+  gboolean changed;
+
+  g_return_if_fail (GST_IS_VIDEO_DECODER (decoder));
+  g_return_if_fail (n_frames > 0);
+
+  GST_OBJECT_LOCK (decoder);
+  changed = decoder->priv->max_concurrent_frames != n_frames;
+  decoder->priv->max_concurrent_frames = n_frames;
+  GST_OBJECT_UNLOCK (decoder);
+
+  if (changed)
+    gst_element_post_message (GST_ELEMENT_CAST (decoder),
+        gst_message_new_latency (GST_OBJECT_CAST (decoder)));
+}
+
+/**
+ * gst_video_decoder_get_max_concurrent_frames:
+ * @decoder: a #GstVideoDecoder
+ *
+ * Returns: number of frames the subclass decodes at the same time, as set
+ *     with gst_video_decoder_set_max_concurrent_frames()
+ *
+ * Since: 1.2
+ */
+guint
+gst_video_decoder_get_max_concurrent_frames (GstVideoDecoder * decoder)
+{
+  guint n_frames;
+
+  g_return_val_if_fail (GST_IS_VIDEO_DECODER (decoder), 1);
+
+  GST_OBJECT_LOCK (decoder);
+  n_frames = decoder->priv->max_concurrent_frames;
+  GST_OBJECT_UNLOCK (decoder);
+
+  return n_frames;
+}
+
+/**
+ * gst_video_decoder_set_reverse_memory_limit:
+ * @decoder: a #GstVideoDecoder
+ * @limit: maximum number of bytes of decoded frames to queue, 0 for no limit
+ *
+ * In reverse playback, all the frames from a keyframe up to the next one
+ * are decoded and queued before they are pushed downstream in reverse order.
+ * With long distances between keyframes this takes a lot of memory.
+ *
+ * When @limit is not 0, at most @limit bytes of decoded frames are queued.
+ * The frames are then decoded from the keyframe again for each part that
+ * fits in the limit, trading decoding time for memory. Default is 0.
+ *
+ * Since: 1.2
+ */
+void
+gst_video_decoder_set_reverse_memory_limit (GstVideoDecoder * decoder,
+    guint64 limit)
+{
+  g_return_if_fail (GST_IS_VIDEO_DECODER (decoder));
+
+  GST_OBJECT_LOCK (decoder);
+  decoder->priv->reverse_memory_limit = limit;
+  GST_OBJECT_UNLOCK (decoder);
+}
+
+/**
+ * gst_video_decoder_get_reverse_memory_limit:
+ * @decoder: a #GstVideoDecoder
+ *
+ * Returns: the maximum number of bytes of decoded frames queued in reverse
+ *     playback, as set with gst_video_decoder_set_reverse_memory_limit()
+ *
+ * Since: 1.2
+ */
+guint64
+gst_video_decoder_get_reverse_memory_limit (GstVideoDecoder * decoder)
+{
+  guint64 limit;
+
+  g_return_val_if_fail (GST_IS_VIDEO_DECODER (decoder), 0);
+
+  GST_OBJECT_LOCK (decoder);
+  limit = decoder->priv->reverse_memory_limit;
+  GST_OBJECT_UNLOCK (decoder);
+
+  return limit;
+}
+
 /**
  * gst_video_decoder_set_packetized:
  * @decoder: a #GstVideoDecoder
@@ -311,6 +311,16 @@ void     gst_video_decoder_set_max_errors (GstVideoDecoder * dec,
 
 gint     gst_video_decoder_get_max_errors (GstVideoDecoder * dec);
 
+void     gst_video_decoder_set_max_concurrent_frames (GstVideoDecoder * decoder,
+						      guint             n_frames);
+
+guint    gst_video_decoder_get_max_concurrent_frames (GstVideoDecoder * decoder);
+
+void     gst_video_decoder_set_reverse_memory_limit (GstVideoDecoder * decoder,
+						     guint64           limit);
+
+guint64  gst_video_decoder_get_reverse_memory_limit (GstVideoDecoder * decoder);
+
 void     gst_video_decoder_set_latency (GstVideoDecoder *decoder,
 					GstClockTime min_latency,
 					GstClockTime max_latency);
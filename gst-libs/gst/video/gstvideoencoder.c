@@ -102,6 +102,11 @@
  *   </para></listitem>
  * </itemizedlist>
  *
+ * Normally @handle_frame runs on the upstream streaming thread, which is
+ * blocked while a frame is encoded.  A subclass can instead have the base
+ * class queue incoming frames and hand them to @handle_frame from a thread
+ * of its own by calling @gst_video_encoder_set_input_queue, so that upstream
+ * processing and encoding can run on different cores.
  */
 
 #ifdef HAVE_CONFIG_H
@@ -117,6 +122,7 @@
 #include <gst/video/video.h>
 #include "gstvideoencoder.h"
 #include "gstvideoutils.h"
+#include "video-codec-stats.h"
 
 #include <gst/video/gstvideometa.h>
 #include <gst/video/gstvideopool.h>
@@ -130,6 +136,15 @@ GST_DEBUG_CATEGORY (videoencoder_debug);
     (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GST_TYPE_VIDEO_ENCODER, \
         GstVideoEncoderPrivate))
 
+#define DEFAULT_STATS_INTERVAL 0
+
+enum
+{
+  PROP_0,
+  PROP_STATS,
+  PROP_STATS_INTERVAL
+};
+
 struct _GstVideoEncoderPrivate
 {
   guint64 presentation_frame_number;
@@ -138,7 +153,8 @@ struct _GstVideoEncoderPrivate
   /* FIXME : (and introduce a context ?) */
   gboolean drained;
   gboolean at_eos;
-  gboolean do_caps;
+  /* caps of the last CAPS event, to be configured with the next frame */
+  GstCaps *pending_caps;
 
   gint64 min_latency;
   gint64 max_latency;
@@ -165,6 +181,22 @@ struct _GstVideoEncoderPrivate
 
   GstTagList *tags;
   gboolean tags_changed;
+
+  /* input queue and encode thread, see gst_video_encoder_set_input_queue() */
+  guint queue_max_frames;
+  guint64 queue_max_bytes;
+  GMutex queue_lock;
+  GCond queue_cond;
+  GQueue queue;                 /* buffers and serialized events */
+  guint queue_frames;
+  guint64 queue_bytes;
+  GstFlowReturn queue_flow;     /* last result of the encode thread */
+  GstClockTime frame_duration;  /* OBJECT_LOCK */
+
+  /* OBJECT_LOCK */
+  VideoCodecStats stats;
+  /* time spent pushing downstream from within handle_frame, in us */
+  gint64 push_time;
 };
 
 typedef struct _ForcedKeyUnitEvent ForcedKeyUnitEvent;
@@ -201,6 +233,10 @@ static void gst_video_encoder_init (GstVideoEncoder * enc,
     GstVideoEncoderClass * klass);
 
 static void gst_video_encoder_finalize (GObject * object);
+static void gst_video_encoder_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_video_encoder_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
 
 static gboolean gst_video_encoder_setcaps (GstVideoEncoder * enc,
     GstCaps * caps);
@@ -221,6 +257,12 @@ static gboolean gst_video_encoder_src_query (GstPad * pad, GstObject * parent,
 static GstVideoCodecFrame *gst_video_encoder_new_frame (GstVideoEncoder *
     encoder, GstBuffer * buf, GstClockTime pts, GstClockTime dts,
     GstClockTime duration);
+static GstFlowReturn gst_video_encoder_chain_internal (GstVideoEncoder *
+    encoder, GstBuffer * buf);
+static void gst_video_encoder_queue_clear (GstVideoEncoder * encoder,
+    GstFlowReturn flow);
+static gboolean gst_video_encoder_queue_event (GstVideoEncoder * encoder,
+    GstEvent * event);
 
 static gboolean gst_video_encoder_sink_event_default (GstVideoEncoder * encoder,
     GstEvent * event);
@@ -284,6 +326,60 @@ gst_video_encoder_class_init (GstVideoEncoderClass * klass)
   g_type_class_add_private (klass, sizeof (GstVideoEncoderPrivate));
 
   gobject_class->finalize = gst_video_encoder_finalize;
+  gobject_class->set_property = gst_video_encoder_set_property;
+  gobject_class->get_property = gst_video_encoder_get_property;
+
+  /**
+   * GstVideoEncoder:stats:
+   *
+   * Statistics of the encoder since it was started, in a structure named
+   * "GstVideoEncoderStats" with the following fields:
+   *
+   * "processed" G_TYPE_UINT64: frames handed to the subclass
+   *
+   * "pushed" G_TYPE_UINT64: encoded frames that were pushed downstream
+   *
+   * "dropped" G_TYPE_UINT64: frames the subclass finished without output
+   *
+   * "in-flight" G_TYPE_UINT: frames currently being encoded
+   *
+   * "processing-time" G_TYPE_UINT64: total time spent in the handle_frame
+   * vmethod in nanoseconds, without the time spent pushing downstream
+   *
+   * "max-processing-time" G_TYPE_UINT64: longest handle_frame call in
+   * nanoseconds
+   *
+   * "processing-histogram" #GstValueArray of G_TYPE_UINT64: number of
+   * handle_frame calls that took less than 1, 2, 4, 8, 16, 32 and 64
+   * milliseconds and longer
+   *
+   * "average-latency" G_TYPE_UINT64: average time between the creation of
+   * a frame and pushing its encoded data in nanoseconds
+   *
+   * "max-latency" G_TYPE_UINT64: longest time between the creation of a
+   * frame and pushing its encoded data in nanoseconds
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS,
+      g_param_spec_boxed ("stats", "Statistics",
+          "Statistics of the encoder since it was started",
+          GST_TYPE_STRUCTURE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstVideoEncoder:stats-interval:
+   *
+   * Interval in nanoseconds at which the #GstVideoEncoder:stats are posted
+   * as an element message on the bus while frames are pushed, 0 disables
+   * the messages.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS_INTERVAL,
+      g_param_spec_uint64 ("stats-interval", "Stats Interval",
+          "Interval for posting the stats on the bus in nanoseconds "
+          "(0 = disabled)", 0, G_MAXUINT64, DEFAULT_STATS_INTERVAL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_video_encoder_change_state);
@@ -345,6 +441,12 @@ gst_video_encoder_reset (GstVideoEncoder * encoder)
   priv->tags = NULL;
   priv->tags_changed = FALSE;
 
+  GST_OBJECT_LOCK (encoder);
+  priv->frame_duration = GST_CLOCK_TIME_NONE;
+  GST_OBJECT_UNLOCK (encoder);
+
+  gst_video_encoder_queue_clear (encoder, GST_FLOW_OK);
+
   GST_VIDEO_ENCODER_STREAM_UNLOCK (encoder);
 }
 
@@ -393,6 +495,10 @@ gst_video_encoder_init (GstVideoEncoder * encoder, GstVideoEncoderClass * klass)
   priv->headers = NULL;
   priv->new_headers = FALSE;
 
+  g_mutex_init (&priv->queue_lock);
+  g_cond_init (&priv->queue_cond);
+  g_queue_init (&priv->queue);
+
   gst_video_encoder_reset (encoder);
 }
 
@@ -604,6 +710,15 @@ gst_video_encoder_setcaps (GstVideoEncoder * encoder, GstCaps * caps)
     if (encoder->priv->input_state)
       gst_video_codec_state_unref (encoder->priv->input_state);
     encoder->priv->input_state = state;
+
+    GST_OBJECT_LOCK (encoder);
+    if (state->info.fps_n > 0)
+      encoder->priv->frame_duration =
+          gst_util_uint64_scale (GST_SECOND, state->info.fps_d,
+          state->info.fps_n);
+    else
+      encoder->priv->frame_duration = GST_CLOCK_TIME_NONE;
+    GST_OBJECT_UNLOCK (encoder);
   } else {
     gst_video_codec_state_unref (state);
   }
@@ -867,6 +982,10 @@ gst_video_encoder_finalize (GObject * object)
   }
   g_rec_mutex_clear (&encoder->stream_lock);
 
+  gst_caps_replace (&encoder->priv->pending_caps, NULL);
+  g_mutex_clear (&encoder->priv->queue_lock);
+  g_cond_clear (&encoder->priv->queue_cond);
+
   if (encoder->priv->allocator) {
     gst_object_unref (encoder->priv->allocator);
     encoder->priv->allocator = NULL;
@@ -875,6 +994,49 @@ gst_video_encoder_finalize (GObject * object)
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
+static void
+gst_video_encoder_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstVideoEncoder *enc = GST_VIDEO_ENCODER (object);
+
+  switch (prop_id) {
+    case PROP_STATS_INTERVAL:
+      GST_OBJECT_LOCK (enc);
+      enc->priv->stats.interval = g_value_get_uint64 (value);
+      GST_OBJECT_UNLOCK (enc);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_video_encoder_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstVideoEncoder *enc = GST_VIDEO_ENCODER (object);
+  GstVideoEncoderPrivate *priv = enc->priv;
+
+  switch (prop_id) {
+    case PROP_STATS:
+      GST_OBJECT_LOCK (enc);
+      g_value_take_boxed (value, video_codec_stats_to_structure (&priv->stats,
+              "GstVideoEncoderStats", g_list_length (priv->frames)));
+      GST_OBJECT_UNLOCK (enc);
+      break;
+    case PROP_STATS_INTERVAL:
+      GST_OBJECT_LOCK (enc);
+      g_value_set_uint64 (value, priv->stats.interval);
+      GST_OBJECT_UNLOCK (enc);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
 static gboolean
 gst_video_encoder_push_event (GstVideoEncoder * encoder, GstEvent * event)
 {
@@ -922,7 +1084,9 @@ gst_video_encoder_sink_event_default (GstVideoEncoder * encoder,
 
       gst_event_parse_caps (event, &caps);
       ret = TRUE;
-      encoder->priv->do_caps = TRUE;
+      /* not the current caps of the pad, with an input queue those can
+       * already be newer than the frames that are encoded now */
+      gst_caps_replace (&encoder->priv->pending_caps, caps);
       gst_event_unref (event);
       event = NULL;
       break;
@@ -1062,17 +1226,41 @@ gst_video_encoder_sink_event (GstPad * pad, GstObject * parent,
 {
   GstVideoEncoder *enc;
   GstVideoEncoderClass *klass;
+  GstEventType type;
   gboolean ret = TRUE;
 
   enc = GST_VIDEO_ENCODER (parent);
   klass = GST_VIDEO_ENCODER_GET_CLASS (enc);
+  type = GST_EVENT_TYPE (event);
 
   GST_DEBUG_OBJECT (enc, "received event %d, %s", GST_EVENT_TYPE (event),
       GST_EVENT_TYPE_NAME (event));
 
+  if (enc->priv->queue_max_frames > 0) {
+    switch (type) {
+      case GST_EVENT_FLUSH_START:
+        gst_video_encoder_queue_clear (enc, GST_FLOW_FLUSHING);
+        break;
+      case GST_EVENT_FLUSH_STOP:
+        gst_video_encoder_queue_clear (enc, GST_FLOW_OK);
+        gst_video_encoder_start_encode_task (enc);
+        break;
+      default:
+        /* keep serialized events in order with the queued frames */
+        if (GST_EVENT_IS_SERIALIZED (event)
+            && gst_video_encoder_queue_event (enc, event))
+          return TRUE;
+        break;
+    }
+  }
+
   if (klass->sink_event)
     ret = klass->sink_event (enc, event);
 
+  /* the encode thread is unblocked now that downstream is flushing too */
+  if (enc->priv->queue_max_frames > 0 && type == GST_EVENT_FLUSH_START)
+    gst_pad_pause_task (enc->srcpad);
+
   return ret;
 }
 
@@ -1187,6 +1375,14 @@ gst_video_encoder_src_query (GstPad * pad, GstObject * parent, GstQuery * query)
         } else if (max_latency != GST_CLOCK_TIME_NONE) {
           max_latency += enc->priv->max_latency;
         }
+        /* the input queue can buffer this much more without blocking
+         * upstream */
+        if (priv->queue_max_frames > 0 && max_latency != GST_CLOCK_TIME_NONE) {
+          if (GST_CLOCK_TIME_IS_VALID (priv->frame_duration))
+            max_latency += priv->queue_max_frames * priv->frame_duration;
+          else
+            max_latency = GST_CLOCK_TIME_NONE;
+        }
         GST_OBJECT_UNLOCK (enc);
 
         gst_query_set_latency (query, live, min_latency, max_latency);
@@ -1229,38 +1425,207 @@ gst_video_encoder_new_frame (GstVideoEncoder * encoder, GstBuffer * buf,
   frame->dts = dts;
   frame->duration = duration;
   frame->abidata.ABI.ts = pts;
+  frame->abidata.ABI.arrival = g_get_monotonic_time ();
 
   return frame;
 }
 
 
+/* Drops everything that is queued and sets the result the streaming thread
+ * gets for the next frames: GST_FLOW_FLUSHING also stops the encode thread,
+ * GST_FLOW_OK makes it accept frames again */
+static void
+gst_video_encoder_queue_clear (GstVideoEncoder * encoder, GstFlowReturn flow)
+{
+  GstVideoEncoderPrivate *priv = encoder->priv;
+  GstMiniObject *item;
+
+  g_mutex_lock (&priv->queue_lock);
+  while ((item = g_queue_pop_head (&priv->queue)))
+    gst_mini_object_unref (item);
+  priv->queue_frames = 0;
+  priv->queue_bytes = 0;
+  priv->queue_flow = flow;
+  g_cond_broadcast (&priv->queue_cond);
+  g_mutex_unlock (&priv->queue_lock);
+}
+
+static void
+gst_video_encoder_loop (GstVideoEncoder * encoder)
+{
+  GstVideoEncoderPrivate *priv = encoder->priv;
+  GstVideoEncoderClass *klass = GST_VIDEO_ENCODER_GET_CLASS (encoder);
+  GstMiniObject *item;
+  GstFlowReturn ret;
+
+  g_mutex_lock (&priv->queue_lock);
+  while (g_queue_is_empty (&priv->queue) && priv->queue_flow == GST_FLOW_OK)
+    g_cond_wait (&priv->queue_cond, &priv->queue_lock);
+  ret = priv->queue_flow;
+  if (ret != GST_FLOW_OK) {
+    g_mutex_unlock (&priv->queue_lock);
+    goto pause;
+  }
+
+  item = g_queue_pop_head (&priv->queue);
+  if (GST_IS_BUFFER (item)) {
+    priv->queue_frames--;
+    priv->queue_bytes -= gst_buffer_get_size (GST_BUFFER_CAST (item));
+    g_cond_broadcast (&priv->queue_cond);
+  }
+  g_mutex_unlock (&priv->queue_lock);
+
+  if (GST_IS_BUFFER (item)) {
+    ret = gst_video_encoder_chain_internal (encoder, GST_BUFFER_CAST (item));
+  } else if (klass->sink_event) {
+    klass->sink_event (encoder, GST_EVENT_CAST (item));
+  } else {
+    gst_mini_object_unref (item);
+  }
+
+  if (ret != GST_FLOW_OK) {
+    /* the streaming thread picks this up with the next frame or event */
+    g_mutex_lock (&priv->queue_lock);
+    if (priv->queue_flow == GST_FLOW_OK)
+      priv->queue_flow = ret;
+    g_cond_broadcast (&priv->queue_cond);
+    g_mutex_unlock (&priv->queue_lock);
+    goto pause;
+  }
+
+  return;
+
+pause:
+  {
+    /* a flush stop might have reset the queue and restarted the thread
+     * meanwhile, only pause if that didn't happen yet */
+    g_mutex_lock (&priv->queue_lock);
+    if (priv->queue_flow != GST_FLOW_OK) {
+      GST_DEBUG_OBJECT (encoder, "pausing encode thread, reason %s",
+          gst_flow_get_name (priv->queue_flow));
+      gst_pad_pause_task (encoder->srcpad);
+    }
+    g_mutex_unlock (&priv->queue_lock);
+  }
+}
+
+/* Starts the encode thread if the input queue is enabled. Done once the
+ * pads are active and again after a flush, the thread pauses itself when
+ * flushing or when downstream returns an error */
+static void
+gst_video_encoder_start_encode_task (GstVideoEncoder * encoder)
+{
+  if (encoder->priv->queue_max_frames == 0)
+    return;
+
+  GST_DEBUG_OBJECT (encoder, "starting encode thread");
+  gst_pad_start_task (encoder->srcpad,
+      (GstTaskFunction) gst_video_encoder_loop, encoder, NULL);
+}
+
+static GstFlowReturn
+gst_video_encoder_queue_buffer (GstVideoEncoder * encoder, GstBuffer * buf)
+{
+  GstVideoEncoderPrivate *priv = encoder->priv;
+  gsize size = gst_buffer_get_size (buf);
+  GstFlowReturn ret;
+
+  g_mutex_lock (&priv->queue_lock);
+  while (priv->queue_flow == GST_FLOW_OK && !g_queue_is_empty (&priv->queue)
+      && (priv->queue_frames >= priv->queue_max_frames
+          || (priv->queue_max_bytes > 0
+              && priv->queue_bytes + size > priv->queue_max_bytes)))
+    g_cond_wait (&priv->queue_cond, &priv->queue_lock);
+
+  ret = priv->queue_flow;
+  if (ret == GST_FLOW_OK) {
+    g_queue_push_tail (&priv->queue, buf);
+    priv->queue_frames++;
+    priv->queue_bytes += size;
+    g_cond_broadcast (&priv->queue_cond);
+  }
+  g_mutex_unlock (&priv->queue_lock);
+
+  if (ret != GST_FLOW_OK) {
+    GST_DEBUG_OBJECT (encoder, "not queueing frame, reason %s",
+        gst_flow_get_name (ret));
+    gst_buffer_unref (buf);
+  }
+
+  return ret;
+}
+
+/* Returns FALSE if the encode thread has stopped and the event should be
+ * handled right away. The events that were still queued are handled first
+ * then, so EOS and the like still make it downstream. */
+static gboolean
+gst_video_encoder_queue_event (GstVideoEncoder * encoder, GstEvent * event)
+{
+  GstVideoEncoderPrivate *priv = encoder->priv;
+  GstVideoEncoderClass *klass = GST_VIDEO_ENCODER_GET_CLASS (encoder);
+  GQueue pending = G_QUEUE_INIT;
+  GstMiniObject *item;
+  gboolean queued;
+
+  g_mutex_lock (&priv->queue_lock);
+  queued = (priv->queue_flow == GST_FLOW_OK);
+  if (queued) {
+    g_queue_push_tail (&priv->queue, event);
+    g_cond_broadcast (&priv->queue_cond);
+  } else {
+    pending = priv->queue;
+    g_queue_init (&priv->queue);
+    priv->queue_frames = 0;
+    priv->queue_bytes = 0;
+  }
+  g_mutex_unlock (&priv->queue_lock);
+
+  while ((item = g_queue_pop_head (&pending))) {
+    if (GST_IS_EVENT (item) && klass->sink_event)
+      klass->sink_event (encoder, GST_EVENT_CAST (item));
+    else
+      gst_mini_object_unref (item);
+  }
+
+  return queued;
+}
+
 static GstFlowReturn
 gst_video_encoder_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 {
-  GstVideoEncoder *encoder;
+  GstVideoEncoder *encoder = GST_VIDEO_ENCODER (parent);
+
+  if (encoder->priv->queue_max_frames > 0)
+    return gst_video_encoder_queue_buffer (encoder, buf);
+
+  return gst_video_encoder_chain_internal (encoder, buf);
+}
+
+static GstFlowReturn
+gst_video_encoder_chain_internal (GstVideoEncoder * encoder, GstBuffer * buf)
+{
   GstVideoEncoderPrivate *priv;
   GstVideoEncoderClass *klass;
   GstVideoCodecFrame *frame;
   GstClockTime pts, duration;
   GstFlowReturn ret = GST_FLOW_OK;
   guint64 start, stop, cstart, cstop;
+  gint64 handle_start;
 
-  encoder = GST_VIDEO_ENCODER (parent);
   priv = encoder->priv;
   klass = GST_VIDEO_ENCODER_GET_CLASS (encoder);
 
   g_return_val_if_fail (klass->handle_frame != NULL, GST_FLOW_ERROR);
 
-  if (G_UNLIKELY (encoder->priv->do_caps)) {
-    GstCaps *caps = gst_pad_get_current_caps (encoder->sinkpad);
-    if (!caps)
-      goto not_negotiated;
+  if (G_UNLIKELY (priv->pending_caps)) {
+    GstCaps *caps = priv->pending_caps;
+
+    priv->pending_caps = NULL;
     if (!gst_video_encoder_setcaps (encoder, caps)) {
       gst_caps_unref (caps);
       goto not_negotiated;
     }
     gst_caps_unref (caps);
-    encoder->priv->do_caps = FALSE;
   }
 
   GST_VIDEO_ENCODER_STREAM_LOCK (encoder);
@@ -1349,8 +1714,15 @@ gst_video_encoder_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
   GST_LOG_OBJECT (encoder, "passing frame pfn %d to subclass",
       frame->presentation_frame_number);
 
+  priv->push_time = 0;
+  handle_start = g_get_monotonic_time ();
   ret = klass->handle_frame (encoder, frame);
 
+  GST_OBJECT_LOCK (encoder);
+  video_codec_stats_add_processed (&priv->stats,
+      handle_start + priv->push_time);
+  GST_OBJECT_UNLOCK (encoder);
+
 done:
   GST_VIDEO_ENCODER_STREAM_UNLOCK (encoder);
 
@@ -1383,6 +1755,9 @@ gst_video_encoder_change_state (GstElement * element, GstStateChange transition)
         goto open_failed;
       break;
     case GST_STATE_CHANGE_READY_TO_PAUSED:
+      GST_OBJECT_LOCK (encoder);
+      video_codec_stats_reset (&encoder->priv->stats);
+      GST_OBJECT_UNLOCK (encoder);
       /* Initialize device/library if needed */
       if (encoder_class->start && !encoder_class->start (encoder))
         goto start_failed;
@@ -1391,9 +1766,24 @@ gst_video_encoder_change_state (GstElement * element, GstStateChange transition)
       break;
   }
 
+  switch (transition) {
+    case GST_STATE_CHANGE_PAUSED_TO_READY:
+      /* wake up and stop the encode thread before the pads get
+       * deactivated */
+      gst_video_encoder_queue_clear (encoder, GST_FLOW_FLUSHING);
+      gst_pad_stop_task (encoder->srcpad);
+      break;
+    default:
+      break;
+  }
+
   ret = GST_ELEMENT_CLASS (parent_class)->change_state (element, transition);
 
   switch (transition) {
+    case GST_STATE_CHANGE_READY_TO_PAUSED:
+      if (ret != GST_STATE_CHANGE_FAILURE)
+        gst_video_encoder_start_encode_task (encoder);
+      break;
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       gst_video_encoder_reset (encoder);
       if (encoder_class->stop && !encoder_class->stop (encoder))
@@ -1710,6 +2100,8 @@ gst_video_encoder_finish_frame (GstVideoEncoder * encoder,
   gboolean send_headers = FALSE;
   gboolean discont = (frame->presentation_frame_number == 0);
   GstBuffer *buffer;
+  GstStructure *stats = NULL;
+  gint64 push_start;
 
   encoder_class = GST_VIDEO_ENCODER_GET_CLASS (encoder);
 
@@ -1763,6 +2155,9 @@ gst_video_encoder_finish_frame (GstVideoEncoder * encoder,
   if (!frame->output_buffer) {
     GST_DEBUG_OBJECT (encoder, "skipping frame %" GST_TIME_FORMAT,
         GST_TIME_ARGS (frame->pts));
+    GST_OBJECT_LOCK (encoder);
+    priv->stats.dropped++;
+    GST_OBJECT_UNLOCK (encoder);
     goto done;
   }
 
@@ -1912,7 +2307,9 @@ gst_video_encoder_finish_frame (GstVideoEncoder * encoder,
         discont = FALSE;
       }
 
+      push_start = g_get_monotonic_time ();
       gst_pad_push (encoder->srcpad, gst_buffer_ref (tmpbuf));
+      priv->push_time += g_get_monotonic_time () - push_start;
     }
     priv->new_headers = FALSE;
   }
@@ -1929,6 +2326,17 @@ gst_video_encoder_finish_frame (GstVideoEncoder * encoder,
    * downstream, the original ref is owned by the frame */
   buffer = gst_buffer_ref (frame->output_buffer);
 
+  GST_OBJECT_LOCK (encoder);
+  video_codec_stats_add_pushed (&priv->stats, frame->abidata.ABI.arrival);
+  if (video_codec_stats_need_post (&priv->stats))
+    stats = video_codec_stats_to_structure (&priv->stats,
+        "GstVideoEncoderStats", g_list_length (priv->frames));
+  GST_OBJECT_UNLOCK (encoder);
+
+  if (stats)
+    gst_element_post_message (GST_ELEMENT_CAST (encoder),
+        gst_message_new_element (GST_OBJECT_CAST (encoder), stats));
+
   /* Release frame so the buffer is writable when we push it downstream
    * if possible, i.e. if the subclass does not hold additional references
    * to the frame
@@ -1936,8 +2344,11 @@ gst_video_encoder_finish_frame (GstVideoEncoder * encoder,
   gst_video_encoder_release_frame (encoder, frame);
   frame = NULL;
 
-  if (ret == GST_FLOW_OK)
+  if (ret == GST_FLOW_OK) {
+    push_start = g_get_monotonic_time ();
     ret = gst_pad_push (encoder->srcpad, buffer);
+    priv->push_time += g_get_monotonic_time () - push_start;
+  }
 
 done:
   /* handed out */
@@ -2073,6 +2484,67 @@ gst_video_encoder_get_latency (GstVideoEncoder * encoder,
   GST_OBJECT_UNLOCK (encoder);
 }
 
+/**
+ * gst_video_encoder_set_input_queue:
+ * @encoder: a #GstVideoEncoder
+ * @max_frames: maximum number of queued frames, or 0 to disable the queue
+ * @max_bytes: maximum number of queued bytes, or 0 for no limit
+ *
+ * Makes the baseclass queue incoming frames and call @handle_frame from an
+ * encode thread of its own, instead of on the upstream streaming thread.
+ * Upstream then only blocks when @max_frames frames, or at least
+ * @max_bytes bytes of them, are waiting to be encoded.  Serialized events
+ * are queued along with the frames, so subclass' @sink_event is called on
+ * the encode thread as well.
+ *
+ * The queue adds up to @max_frames frame durations to the maximum latency
+ * reported upstream.
+ *
+ * Must be called from @open or @start.  The queue is disabled by default.
+ *
+ * Since: 1.2
+ */
+void
+gst_video_encoder_set_input_queue (GstVideoEncoder * encoder,
+    guint max_frames, guint64 max_bytes)
+{
+  g_return_if_fail (GST_IS_VIDEO_ENCODER (encoder));
+
+  GST_OBJECT_LOCK (encoder);
+  encoder->priv->queue_max_frames = max_frames;
+  encoder->priv->queue_max_bytes = max_bytes;
+  GST_OBJECT_UNLOCK (encoder);
+
+  gst_element_post_message (GST_ELEMENT_CAST (encoder),
+      gst_message_new_latency (GST_OBJECT_CAST (encoder)));
+}
+
+/**
+ * gst_video_encoder_get_input_queue:
+ * @encoder: a #GstVideoEncoder
+ * @max_frames: (out) (allow-none): address of variable in which to store the
+ *     maximum number of queued frames, or %NULL
+ * @max_bytes: (out) (allow-none): address of variable in which to store the
+ *     maximum number of queued bytes, or %NULL
+ *
+ * Query the input queue limits set with gst_video_encoder_set_input_queue().
+ *
+ * Since: 1.2
+ */
+void
+gst_video_encoder_get_input_queue (GstVideoEncoder * encoder,
+    guint * max_frames, guint64 * max_bytes)
+{
+  g_return_if_fail (GST_IS_VIDEO_ENCODER (encoder));
+
+  GST_OBJECT_LOCK (encoder);
+  if (max_frames)
+    *max_frames = encoder->priv->queue_max_frames;
+  if (max_bytes)
+    *max_bytes = encoder->priv->queue_max_bytes;
+  GST_OBJECT_UNLOCK (encoder);
+}
+
 /**
  * gst_video_encoder_get_oldest_frame:
  * @encoder: a #GstVideoEncoder
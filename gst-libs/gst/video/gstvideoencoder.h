@@ -303,6 +303,13 @@ void		     gst_video_encoder_get_latency (GstVideoEncoder *encoder,
 						    GstClockTime *min_latency,
 						    GstClockTime *max_latency);
 
+void                 gst_video_encoder_set_input_queue (GstVideoEncoder *encoder,
+                                                        guint max_frames,
+                                                        guint64 max_bytes);
+void                 gst_video_encoder_get_input_queue (GstVideoEncoder *encoder,
+                                                        guint *max_frames,
+                                                        guint64 *max_bytes);
+
 void                 gst_video_encoder_set_headers (GstVideoEncoder *encoder,
 						    GList *headers);
 
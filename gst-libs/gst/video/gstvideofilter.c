@@ -30,6 +30,13 @@
  * The videofilter will by default enable QoS on the parent GstBaseTransform
  * to implement frame dropping.
  * </para>
+ * <para>
+ * Subclasses that implement both transform_frame and transform_frame_ip
+ * and have the same input and output format get writable buffers in
+ * transform_frame_ip, and the other buffers in transform_frame with an
+ * output buffer from the pool, so that buffers that are still used
+ * elsewhere in the pipeline don't have to be copied first.
+ * </para>
  * </refsect2>
  */
 
@@ -201,6 +208,22 @@ gst_video_filter_get_unit_size (GstBaseTransform * btrans, GstCaps * caps,
   return TRUE;
 }
 
+/* if both transforms are implemented, and the frames can be processed in
+ * place, the transform is picked for each buffer */
+static gboolean
+gst_video_filter_can_transform_ip (GstVideoFilter * filter)
+{
+  GstVideoFilterClass *fclass = GST_VIDEO_FILTER_GET_CLASS (filter);
+
+  return fclass->transform_frame && fclass->transform_frame_ip &&
+      GST_VIDEO_INFO_FORMAT (&filter->in_info) ==
+      GST_VIDEO_INFO_FORMAT (&filter->out_info) &&
+      GST_VIDEO_INFO_WIDTH (&filter->in_info) ==
+      GST_VIDEO_INFO_WIDTH (&filter->out_info) &&
+      GST_VIDEO_INFO_HEIGHT (&filter->in_info) ==
+      GST_VIDEO_INFO_HEIGHT (&filter->out_info);
+}
+
 static gboolean
 gst_video_filter_set_caps (GstBaseTransform * trans, GstCaps * incaps,
     GstCaps * outcaps)
@@ -229,6 +252,10 @@ gst_video_filter_set_caps (GstBaseTransform * trans, GstCaps * incaps,
     filter->out_info = out_info;
     if (fclass->transform_frame == NULL)
       gst_base_transform_set_in_place (trans, TRUE);
+    else if (gst_video_filter_can_transform_ip (filter))
+      /* always negotiate a pool, prepare_output_buffer() still works in
+       * place on writable buffers */
+      gst_base_transform_set_in_place (trans, FALSE);
     if (fclass->transform_frame_ip == NULL)
       GST_BASE_TRANSFORM_CLASS (fclass)->transform_ip_on_passthrough = FALSE;
   }
@@ -245,6 +272,28 @@ invalid_caps:
   }
 }
 
+static GstFlowReturn gst_video_filter_transform_ip (GstBaseTransform * trans,
+    GstBuffer * buf);
+
+static GstFlowReturn
+gst_video_filter_prepare_output_buffer (GstBaseTransform * trans,
+    GstBuffer * inbuf, GstBuffer ** outbuf)
+{
+  GstVideoFilter *filter = GST_VIDEO_FILTER_CAST (trans);
+
+  /* transform() passes the buffer on to transform_frame_ip() then */
+  if (filter->negotiated && !gst_base_transform_is_passthrough (trans) &&
+      gst_video_filter_can_transform_ip (filter) &&
+      gst_buffer_is_writable (inbuf)) {
+    GST_LOG_OBJECT (trans, "transforming writable buffer in place");
+    *outbuf = inbuf;
+    return GST_FLOW_OK;
+  }
+
+  return GST_BASE_TRANSFORM_CLASS (parent_class)->prepare_output_buffer (trans,
+      inbuf, outbuf);
+}
+
 static GstFlowReturn
 gst_video_filter_transform (GstBaseTransform * trans, GstBuffer * inbuf,
     GstBuffer * outbuf)
@@ -256,6 +305,10 @@ gst_video_filter_transform (GstBaseTransform * trans, GstBuffer * inbuf,
   if (G_UNLIKELY (!filter->negotiated))
     goto unknown_format;
 
+  /* picked by prepare_output_buffer() */
+  if (inbuf == outbuf)
+    return gst_video_filter_transform_ip (trans, outbuf);
+
   fclass = GST_VIDEO_FILTER_GET_CLASS (filter);
   if (fclass->transform_frame) {
     GstVideoFrame in_frame, out_frame;
@@ -359,6 +412,8 @@ gst_video_filter_class_init (GstVideoFilterClass * g_class)
       GST_DEBUG_FUNCPTR (gst_video_filter_transform_size);
   trans_class->get_unit_size =
       GST_DEBUG_FUNCPTR (gst_video_filter_get_unit_size);
+  trans_class->prepare_output_buffer =
+      GST_DEBUG_FUNCPTR (gst_video_filter_prepare_output_buffer);
   trans_class->transform = GST_DEBUG_FUNCPTR (gst_video_filter_transform);
   trans_class->transform_ip = GST_DEBUG_FUNCPTR (gst_video_filter_transform_ip);
 
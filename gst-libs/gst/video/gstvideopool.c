@@ -17,6 +17,18 @@
  * Boston, MA 02110-1301, USA.
  */
 
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#endif
+
 #include "gst/video/gstvideometa.h"
 #include "gst/video/gstvideopool.h"
 
@@ -74,6 +86,132 @@ gst_buffer_pool_config_get_video_alignment (GstStructure * config,
       "stride-align3", G_TYPE_UINT, &align->stride_align[3], NULL);
 }
 
+/**
+ * gst_buffer_pool_config_set_video_numa_node:
+ * @config: a #GstStructure
+ * @node: a NUMA node or -1
+ *
+ * Set the NUMA node whose memory should be used for the buffers of a pool
+ * with the #GST_BUFFER_POOL_OPTION_VIDEO_HUGE_PAGES option in @config. -1
+ * uses the default policy of the system.
+ *
+ * Since: 1.2
+ */
+void
+gst_buffer_pool_config_set_video_numa_node (GstStructure * config, gint node)
+{
+  g_return_if_fail (config != NULL);
+  g_return_if_fail (node >= -1);
+
+  gst_structure_set (config, "numa-node", G_TYPE_INT, node, NULL);
+}
+
+/**
+ * gst_buffer_pool_config_get_video_numa_node:
+ * @config: a #GstStructure
+ * @node: (out): a NUMA node
+ *
+ * Get the NUMA node from the bufferpool configuration @config in @node.
+ *
+ * Returns: %TRUE if @config contained a NUMA node.
+ *
+ * Since: 1.2
+ */
+gboolean
+gst_buffer_pool_config_get_video_numa_node (GstStructure * config, gint * node)
+{
+  g_return_val_if_fail (config != NULL, FALSE);
+  g_return_val_if_fail (node != NULL, FALSE);
+
+  return gst_structure_get_int (config, "numa-node", node);
+}
+
+/* huge pages */
+#if defined (HAVE_MMAP) && defined (MADV_HUGEPAGE)
+#define HAVE_HUGE_PAGES 1
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+typedef struct
+{
+  gpointer data;
+  gsize size;
+} HugePageMem;
+
+static void
+huge_page_mem_free (HugePageMem * hp)
+{
+  munmap (hp->data, hp->size);
+  g_slice_free (HugePageMem, hp);
+}
+
+/* prefer the memory of @node for the untouched mapping in @data */
+static void
+huge_page_mem_bind (gpointer data, gsize size, gint node)
+{
+#if defined (__linux__) && defined (SYS_mbind)
+  gulong mask[16] = { 0, };
+  const guint bits = sizeof (gulong) * 8;
+
+  if (node < 0 || node >= G_N_ELEMENTS (mask) * bits)
+    return;
+
+  mask[node / bits] = 1UL << (node % bits);
+  /* 1 is MPOL_PREFERRED */
+  if (syscall (SYS_mbind, data, size, 1, mask, G_N_ELEMENTS (mask) * bits,
+          0) != 0)
+    GST_DEBUG ("could not bind memory to NUMA node %d", node);
+#endif
+}
+
+static GstMemory *
+huge_page_mem_new (gsize size, const GstAllocationParams * params, gint node)
+{
+  HugePageMem *hp;
+  gsize maxsize, len;
+  guint8 *data, *aligned;
+
+  maxsize = params->prefix + size + params->padding;
+  len = GST_ROUND_UP_N (maxsize, HUGE_PAGE_SIZE);
+
+#ifdef MAP_HUGETLB
+  /* explicit huge pages, only works when the administrator reserved them */
+  data = mmap (NULL, len, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (data != MAP_FAILED) {
+    aligned = data;
+    goto done;
+  }
+#endif
+
+  /* transparent huge pages need a mapping aligned to the huge page size, map
+   * one huge page more and trim the unaligned head and tail */
+  data = mmap (NULL, len + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED)
+    return NULL;
+
+  aligned = (guint8 *) GST_ROUND_UP_N ((guintptr) data, HUGE_PAGE_SIZE);
+  if (aligned > data)
+    munmap (data, aligned - data);
+  munmap (aligned + len, data + HUGE_PAGE_SIZE - aligned);
+
+  madvise (aligned, len, MADV_HUGEPAGE);
+
+#ifdef MAP_HUGETLB
+done:
+#endif
+  if (node >= 0)
+    huge_page_mem_bind (aligned, len, node);
+
+  hp = g_slice_new (HugePageMem);
+  hp->data = aligned;
+  hp->size = len;
+
+  return gst_memory_new_wrapped (0, aligned, maxsize, params->prefix, size,
+      hp, (GDestroyNotify) huge_page_mem_free);
+}
+#endif
+
 /* bufferpool */
 struct _GstVideoBufferPoolPrivate
 {
@@ -84,9 +222,26 @@ struct _GstVideoBufferPoolPrivate
   gboolean need_alignment;
   GstAllocator *allocator;
   GstAllocationParams params;
+  gboolean huge_pages;
+  gint numa_node;
+
+  /* statistics, protected with the object lock */
+  guint n_allocated;
+  guint n_acquired;
+  guint n_reused;
+  GstClockTime alloc_time;
+  GstClockTime wait_time;
+};
+
+enum
+{
+  PROP_0,
+  PROP_STATS
 };
 
 static void gst_video_buffer_pool_finalize (GObject * object);
+static void gst_video_buffer_pool_get_property (GObject * object,
+    guint prop_id, GValue * value, GParamSpec * pspec);
 
 #define GST_VIDEO_BUFFER_POOL_GET_PRIVATE(obj)  \
    (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GST_TYPE_VIDEO_BUFFER_POOL, GstVideoBufferPoolPrivate))
@@ -98,7 +253,11 @@ static const gchar **
 video_buffer_pool_get_options (GstBufferPool * pool)
 {
   static const gchar *options[] = { GST_BUFFER_POOL_OPTION_VIDEO_META,
-    GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT, NULL
+    GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT,
+#ifdef HAVE_HUGE_PAGES
+    GST_BUFFER_POOL_OPTION_VIDEO_HUGE_PAGES,
+#endif
+    NULL
   };
   return options;
 }
@@ -152,12 +311,23 @@ video_buffer_pool_set_config (GstBufferPool * pool, GstStructure * config)
       GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT);
 
   if (priv->need_alignment && priv->add_videometa) {
+    guint i;
+
     /* get an apply the alignment to the info */
     gst_buffer_pool_config_get_video_alignment (config, &priv->video_align);
     gst_video_info_align (&info, &priv->video_align);
+
+    /* the planes can only be aligned when the memory is aligned as well */
+    for (i = 0; i < GST_VIDEO_MAX_PLANES; i++)
+      priv->params.align |= priv->video_align.stride_align[i];
   }
   priv->info = info;
 
+  priv->huge_pages = gst_buffer_pool_config_has_option (config,
+      GST_BUFFER_POOL_OPTION_VIDEO_HUGE_PAGES);
+  if (!gst_buffer_pool_config_get_video_numa_node (config, &priv->numa_node))
+    priv->numa_node = -1;
+
   return GST_BUFFER_POOL_CLASS (parent_class)->set_config (pool, config);
 
   /* ERRORS */
@@ -186,16 +356,38 @@ video_buffer_pool_alloc (GstBufferPool * pool, GstBuffer ** buffer,
   GstVideoBufferPool *vpool = GST_VIDEO_BUFFER_POOL_CAST (pool);
   GstVideoBufferPoolPrivate *priv = vpool->priv;
   GstVideoInfo *info;
+  GstClockTime start;
 
   info = &priv->info;
 
   GST_DEBUG_OBJECT (pool, "alloc %" G_GSIZE_FORMAT, info->size);
 
-  *buffer =
-      gst_buffer_new_allocate (priv->allocator, info->size, &priv->params);
+  start = gst_util_get_timestamp ();
+  *buffer = NULL;
+#ifdef HAVE_HUGE_PAGES
+  if (priv->huge_pages) {
+    GstMemory *mem;
+
+    mem = huge_page_mem_new (info->size, &priv->params, priv->numa_node);
+    if (mem) {
+      *buffer = gst_buffer_new ();
+      gst_buffer_append_memory (*buffer, mem);
+    } else {
+      GST_WARNING_OBJECT (pool, "can't map huge pages, using the allocator");
+    }
+  }
+#endif
+  if (*buffer == NULL)
+    *buffer =
+        gst_buffer_new_allocate (priv->allocator, info->size, &priv->params);
   if (*buffer == NULL)
     goto no_memory;
 
+  GST_OBJECT_LOCK (pool);
+  priv->n_allocated++;
+  priv->alloc_time += gst_util_get_timestamp () - start;
+  GST_OBJECT_UNLOCK (pool);
+
   if (priv->add_videometa) {
     GST_DEBUG_OBJECT (pool, "adding GstVideoMeta");
 
@@ -215,6 +407,53 @@ no_memory:
   }
 }
 
+static gboolean
+video_buffer_pool_start (GstBufferPool * pool)
+{
+  GstVideoBufferPoolPrivate *priv = GST_VIDEO_BUFFER_POOL_CAST (pool)->priv;
+
+  /* statistics are per activation, the parent preallocates min-buffers */
+  GST_OBJECT_LOCK (pool);
+  priv->n_allocated = 0;
+  priv->n_acquired = 0;
+  priv->n_reused = 0;
+  priv->alloc_time = 0;
+  priv->wait_time = 0;
+  GST_OBJECT_UNLOCK (pool);
+
+  return GST_BUFFER_POOL_CLASS (parent_class)->start (pool);
+}
+
+static GstFlowReturn
+video_buffer_pool_acquire (GstBufferPool * pool, GstBuffer ** buffer,
+    GstBufferPoolAcquireParams * params)
+{
+  GstVideoBufferPoolPrivate *priv = GST_VIDEO_BUFFER_POOL_CAST (pool)->priv;
+  GstFlowReturn ret;
+  GstClockTime start;
+  guint n_allocated;
+
+  GST_OBJECT_LOCK (pool);
+  n_allocated = priv->n_allocated;
+  GST_OBJECT_UNLOCK (pool);
+
+  start = gst_util_get_timestamp ();
+  ret = GST_BUFFER_POOL_CLASS (parent_class)->acquire_buffer (pool, buffer,
+      params);
+
+  GST_OBJECT_LOCK (pool);
+  if (ret == GST_FLOW_OK) {
+    priv->n_acquired++;
+    /* approximate when buffers are acquired from multiple threads */
+    if (priv->n_allocated == n_allocated)
+      priv->n_reused++;
+  }
+  priv->wait_time += gst_util_get_timestamp () - start;
+  GST_OBJECT_UNLOCK (pool);
+
+  return ret;
+}
+
 /**
  * gst_video_buffer_pool_new:
  *
@@ -244,9 +483,39 @@ gst_video_buffer_pool_class_init (GstVideoBufferPoolClass * klass)
   g_type_class_add_private (klass, sizeof (GstVideoBufferPoolPrivate));
 
   gobject_class->finalize = gst_video_buffer_pool_finalize;
+  gobject_class->get_property = gst_video_buffer_pool_get_property;
+
+  /**
+   * GstVideoBufferPool:stats:
+   *
+   * Statistics of the pool since it was last activated, in a structure with
+   * the following fields:
+   *
+   * "allocated" G_TYPE_UINT: buffers allocated, including the min-buffers
+   * that were allocated when activating the pool
+   *
+   * "acquired" G_TYPE_UINT: buffers acquired from the pool
+   *
+   * "reused" G_TYPE_UINT: acquired buffers that were reused instead of
+   * allocated
+   *
+   * "alloc-time" G_TYPE_UINT64: total time spent allocating buffers in
+   * nanoseconds
+   *
+   * "wait-time" G_TYPE_UINT64: total time spent in acquiring buffers in
+   * nanoseconds, including waiting for a free buffer and allocating
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS,
+      g_param_spec_boxed ("stats", "Statistics",
+          "Statistics of the pool since the last activation",
+          GST_TYPE_STRUCTURE, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
 
   gstbufferpool_class->get_options = video_buffer_pool_get_options;
   gstbufferpool_class->set_config = video_buffer_pool_set_config;
+  gstbufferpool_class->start = video_buffer_pool_start;
+  gstbufferpool_class->acquire_buffer = video_buffer_pool_acquire;
   gstbufferpool_class->alloc_buffer = video_buffer_pool_alloc;
 }
 
@@ -272,3 +541,26 @@ gst_video_buffer_pool_finalize (GObject * object)
 
   G_OBJECT_CLASS (gst_video_buffer_pool_parent_class)->finalize (object);
 }
+
+static void
+gst_video_buffer_pool_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstVideoBufferPoolPrivate *priv = GST_VIDEO_BUFFER_POOL_CAST (object)->priv;
+
+  switch (prop_id) {
+    case PROP_STATS:
+      GST_OBJECT_LOCK (object);
+      g_value_take_boxed (value, gst_structure_new ("application/x-gst-stats",
+              "allocated", G_TYPE_UINT, priv->n_allocated,
+              "acquired", G_TYPE_UINT, priv->n_acquired,
+              "reused", G_TYPE_UINT, priv->n_reused,
+              "alloc-time", G_TYPE_UINT64, priv->alloc_time,
+              "wait-time", G_TYPE_UINT64, priv->wait_time, NULL));
+      GST_OBJECT_UNLOCK (object);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
@@ -45,9 +45,26 @@ G_BEGIN_DECLS
  */
 #define GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT "GstBufferPoolOptionVideoAlignment"
 
+/**
+ * GST_BUFFER_POOL_OPTION_VIDEO_HUGE_PAGES:
+ *
+ * A bufferpool option to back the frames with huge pages. Explicit huge pages
+ * are used when the system has them reserved, transparent huge pages
+ * otherwise. The memory of these buffers is mapped directly and does not come
+ * from the configured allocator.
+ *
+ * With this option, gst_buffer_pool_config_set_video_numa_node() can be used
+ * to prefer the memory of a NUMA node.
+ *
+ * Since: 1.2
+ */
+#define GST_BUFFER_POOL_OPTION_VIDEO_HUGE_PAGES "GstBufferPoolOptionVideoHugePages"
+
 /* setting a bufferpool config */
 void             gst_buffer_pool_config_set_video_alignment  (GstStructure *config, GstVideoAlignment *align);
 gboolean         gst_buffer_pool_config_get_video_alignment  (GstStructure *config, GstVideoAlignment *align);
+void             gst_buffer_pool_config_set_video_numa_node  (GstStructure *config, gint node);
+gboolean         gst_buffer_pool_config_get_video_numa_node  (GstStructure *config, gint *node);
 
 /* video bufferpool */
 typedef struct _GstVideoBufferPool GstVideoBufferPool;
@@ -74,6 +74,10 @@ struct _GstVideoCodecState
  * @GST_VIDEO_CODEC_FRAME_FLAG_SYNC_POINT: is the frame a synchronization point (keyframe)
  * @GST_VIDEO_CODEC_FRAME_FLAG_FORCE_KEYFRAME: should the output frame be made a keyframe
  * @GST_VIDEO_CODEC_FRAME_FLAG_FORCE_KEYFRAME_HEADERS: should the encoder output stream headers
+ * @GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_REF: the decoder may skip decoding the
+ *     frame when no other frame references it (Since: 1.2)
+ * @GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_KEY: the decoder may skip decoding the
+ *     frame when it is not a keyframe (Since: 1.2)
  *
  * Flags for #GstVideoCodecFrame
  */
@@ -82,7 +86,9 @@ typedef enum
   GST_VIDEO_CODEC_FRAME_FLAG_DECODE_ONLY            = (1<<0),
   GST_VIDEO_CODEC_FRAME_FLAG_SYNC_POINT             = (1<<1),
   GST_VIDEO_CODEC_FRAME_FLAG_FORCE_KEYFRAME         = (1<<2),
-  GST_VIDEO_CODEC_FRAME_FLAG_FORCE_KEYFRAME_HEADERS = (1<<3)
+  GST_VIDEO_CODEC_FRAME_FLAG_FORCE_KEYFRAME_HEADERS = (1<<3),
+  GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_REF           = (1<<4),
+  GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_KEY           = (1<<5)
 } GstVideoCodecFrameFlags;
 
 /**
@@ -191,6 +197,38 @@ typedef enum
 #define GST_VIDEO_CODEC_FRAME_SET_FORCE_KEYFRAME_HEADERS(frame)     (GST_VIDEO_CODEC_FRAME_FLAG_SET(frame, GST_VIDEO_CODEC_FRAME_FLAG_FORCE_KEYFRAME_HEADERS))
 #define GST_VIDEO_CODEC_FRAME_UNSET_FORCE_KEYFRAME_HEADERS(frame)   (GST_VIDEO_CODEC_FRAME_FLAG_UNSET(frame, GST_VIDEO_CODEC_FRAME_FLAG_FORCE_KEYFRAME_HEADERS))
 
+/**
+ * GST_VIDEO_CODEC_FRAME_IS_SKIP_NON_REF:
+ * @frame: a #GstVideoCodecFrame
+ *
+ * Tests if the decoder may skip decoding @frame when it is not used as a
+ * reference by other frames. The base class sets this when the frame can no
+ * longer be decoded in time according to the QoS events.
+ *
+ * Applies only to frames provided to decoders. Encoders can safely ignore
+ * this field.
+ *
+ * Since: 1.2
+ */
+#define GST_VIDEO_CODEC_FRAME_IS_SKIP_NON_REF(frame)    (GST_VIDEO_CODEC_FRAME_FLAG_IS_SET(frame, GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_REF))
+
+/**
+ * GST_VIDEO_CODEC_FRAME_IS_SKIP_NON_KEY:
+ * @frame: a #GstVideoCodecFrame
+ *
+ * Tests if the decoder may skip decoding @frame when it is not a keyframe.
+ * The base class sets this for all frames of a segment with the
+ * %GST_SEGMENT_FLAG_SKIP flag, as used for fast trick mode playback.
+ * Decoders that skip a frame must drop it with gst_video_decoder_drop_frame()
+ * and restart decoding at the next keyframe.
+ *
+ * Applies only to frames provided to decoders. Encoders can safely ignore
+ * this field.
+ *
+ * Since: 1.2
+ */
+#define GST_VIDEO_CODEC_FRAME_IS_SKIP_NON_KEY(frame)    (GST_VIDEO_CODEC_FRAME_FLAG_IS_SET(frame, GST_VIDEO_CODEC_FRAME_FLAG_SKIP_NON_KEY))
+
 /**
  * GstVideoCodecFrame:
  * @pts: Presentation timestamp
@@ -250,6 +288,7 @@ struct _GstVideoCodecFrame
     struct {
       GstClockTime ts;
       GstClockTime ts2;
+      gint64 arrival;
     } ABI;
     void         *padding[GST_PADDING_LARGE];
   } abidata;
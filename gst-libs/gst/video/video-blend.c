@@ -232,6 +232,108 @@ gst_video_blend_scale_linear_RGBA (GstVideoInfo * src, GstBuffer * src_buffer,
   g_free (tmpbuf);
 }
 
+/* amount of lines unpacked and packed at once when blending */
+#define BLEND_LINES 16
+
+/* finds the first and last pixel with a non-zero alpha value in @n_lines
+ * lines of @width pixels of @src, which must have the alpha in a packed
+ * 4 byte pixel. Returns FALSE when all pixels are transparent. */
+static gboolean
+get_visible_span (GstVideoFrame * src, gint x, gint y, gint width,
+    gint n_lines, gint * first, gint * last)
+{
+  const guint8 *line;
+  gint i, j, stride, f = width, l = -1;
+
+  stride = GST_VIDEO_FRAME_PLANE_STRIDE (src, 0);
+  line = GST_VIDEO_FRAME_PLANE_DATA (src, 0);
+  line += y * stride + x * 4 + GST_VIDEO_FRAME_COMP_POFFSET (src,
+      GST_VIDEO_COMP_A);
+
+  for (i = 0; i < n_lines; i++, line += stride) {
+    for (j = 0; j < f; j++) {
+      if (line[j * 4]) {
+        f = j;
+        break;
+      }
+    }
+    for (j = width - 1; j > l; j--) {
+      if (line[j * 4]) {
+        l = j;
+        break;
+      }
+    }
+  }
+  *first = f;
+  *last = l;
+
+  return l >= f;
+}
+
+/* blends AYUV @src directly onto the planes of a 4:2:0 @dest, without
+ * unpacking and packing whole lines. Chroma is blended once per sample,
+ * with the left pixel of each pair on the last line of each pair that
+ * @src covers, which for even @y is also what the generic code ends up
+ * with. */
+static void
+blend_ayuv_420 (GstVideoFrame * dest, GstVideoFrame * src, gint x, gint y,
+    gint xoff, gint yoff, gint width, gint height, guint alpha_val)
+{
+  const guint8 *s;
+  guint8 *d, *u, *v;
+  gint i, j, sstride, ystride, ustride, vstride, upstride, vpstride;
+  gint cx0, cx1, cy;
+
+  sstride = GST_VIDEO_FRAME_PLANE_STRIDE (src, 0);
+  ystride = GST_VIDEO_FRAME_COMP_STRIDE (dest, GST_VIDEO_COMP_Y);
+  ustride = GST_VIDEO_FRAME_COMP_STRIDE (dest, GST_VIDEO_COMP_U);
+  vstride = GST_VIDEO_FRAME_COMP_STRIDE (dest, GST_VIDEO_COMP_V);
+  upstride = GST_VIDEO_FRAME_COMP_PSTRIDE (dest, GST_VIDEO_COMP_U);
+  vpstride = GST_VIDEO_FRAME_COMP_PSTRIDE (dest, GST_VIDEO_COMP_V);
+
+  /* luma, every pixel */
+  for (i = 0; i < height; i++) {
+    s = GST_VIDEO_FRAME_PLANE_DATA (src, 0);
+    s += (yoff + i) * sstride + xoff * 4;
+    d = GST_VIDEO_FRAME_COMP_DATA (dest, GST_VIDEO_COMP_Y);
+    d += (y + i) * ystride + x;
+
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+    video_orc_blend_ayuv_y (d, s, alpha_val, width);
+#else
+    for (j = 0; j < width; j++) {
+      guint8 alpha = (s[j * 4] * alpha_val) >> 8;
+
+      BLEND00 (d[j], alpha, s[j * 4 + 1], d[j]);
+    }
+#endif
+  }
+
+  /* chroma, the pixels with an even x in dest */
+  cx0 = (x + 1) >> 1;
+  cx1 = (x + width + 1) >> 1;
+  for (cy = y >> 1; cy <= (y + height - 1) >> 1; cy++) {
+    i = MIN (2 * cy + 1, y + height - 1) - y;
+
+    s = GST_VIDEO_FRAME_PLANE_DATA (src, 0);
+    s += (yoff + i) * sstride + (xoff + 2 * cx0 - x) * 4;
+    u = GST_VIDEO_FRAME_COMP_DATA (dest, GST_VIDEO_COMP_U);
+    u += cy * ustride + cx0 * upstride;
+    v = GST_VIDEO_FRAME_COMP_DATA (dest, GST_VIDEO_COMP_V);
+    v += cy * vstride + cx0 * vpstride;
+
+    for (j = cx0; j < cx1; j++) {
+      guint8 alpha = (s[0] * alpha_val) >> 8;
+
+      BLEND00 (*u, alpha, s[2], *u);
+      BLEND00 (*v, alpha, s[3], *v);
+      s += 8;
+      u += upstride;
+      v += vpstride;
+    }
+  }
+}
+
 /* video_blend:
  * @dest: The #GstVideoFrame where to blend @src in
  * @src: the #GstVideoFrame that we want to blend into
@@ -246,10 +348,13 @@ gboolean
 gst_video_blend (GstVideoFrame * dest,
     GstVideoFrame * src, gint x, gint y, gfloat global_alpha)
 {
-  guint i, j, global_alpha_val, src_width, src_height, dest_width, dest_height;
-  gint xoff;
+  guint i, j, k, global_alpha_val, src_width, src_height, dest_width,
+      dest_height, n_lines;
+  gint xoff, yoff, lstride, first, last, span_width;
   guint8 *tmpdestline = NULL, *tmpsrcline = NULL;
   gboolean src_premultiplied_alpha, dest_premultiplied_alpha;
+  gboolean packed_src, use_spans;
+  gpointer sdata[GST_VIDEO_MAX_PLANES];
   void (*matrix) (guint8 * tmpline, guint width);
   const GstVideoFormatInfo *sinfo, *dinfo, *dunpackinfo, *sunpackinfo;
 
@@ -292,9 +397,6 @@ gst_video_blend (GstVideoFrame * dest,
   if (GST_VIDEO_FORMAT_INFO_BITS (dunpackinfo) != 8)
     goto unpack_format_not_supported;
 
-  tmpdestline = g_malloc (sizeof (guint8) * (dest_width + 8) * 4);
-  tmpsrcline = g_malloc (sizeof (guint8) * (dest_width + 8) * 4);
-
   matrix = matrix_identity;
   if (GST_VIDEO_INFO_IS_RGB (&src->info) != GST_VIDEO_INFO_IS_RGB (&dest->info)) {
     if (GST_VIDEO_INFO_IS_RGB (&src->info)) {
@@ -310,16 +412,18 @@ gst_video_blend (GstVideoFrame * dest,
   }
 
   xoff = 0;
+  yoff = 0;
 
   /* adjust src pointers for negative sizes */
   if (x < 0) {
-    src_width -= -x;
-    x = 0;
     xoff = -x;
+    src_width -= xoff;
+    x = 0;
   }
 
   if (y < 0) {
-    src_height -= -y;
+    yoff = -y;
+    src_height -= yoff;
     y = 0;
   }
 
@@ -330,69 +434,117 @@ gst_video_blend (GstVideoFrame * dest,
   if (y + src_height > dest_height)
     src_height = dest_height - y;
 
+  if ((gint) src_width <= 0 || (gint) src_height <= 0)
+    return TRUE;
+
+  /* AYUV onto 4:2:0 can be blended in place */
+  if (GST_VIDEO_FRAME_FORMAT (src) == GST_VIDEO_FORMAT_AYUV &&
+      !src_premultiplied_alpha &&
+      (GST_VIDEO_FRAME_FORMAT (dest) == GST_VIDEO_FORMAT_I420 ||
+          GST_VIDEO_FRAME_FORMAT (dest) == GST_VIDEO_FORMAT_YV12 ||
+          GST_VIDEO_FRAME_FORMAT (dest) == GST_VIDEO_FORMAT_NV12 ||
+          GST_VIDEO_FRAME_FORMAT (dest) == GST_VIDEO_FORMAT_NV21)) {
+    blend_ayuv_420 (dest, src, x, y, xoff, yoff, src_width, src_height,
+        G_LIKELY (global_alpha == 1.0) ? 256 : global_alpha_val);
+    return TRUE;
+  }
+
+  /* with the alpha in a packed 4 byte pixel we can find the parts of the
+   * lines that are not transparent and only blend those. The premultiplied
+   * blender also adds the color of transparent pixels, so not for that. */
+  packed_src = GST_VIDEO_FORMAT_INFO_N_PLANES (sinfo) == 1 &&
+      GST_VIDEO_FORMAT_INFO_PSTRIDE (sinfo, 0) == 4;
+  use_spans = packed_src && GST_VIDEO_FORMAT_INFO_HAS_ALPHA (sinfo) &&
+      GST_VIDEO_FORMAT_INFO_DEPTH (sinfo, GST_VIDEO_COMP_A) == 8 &&
+      !src_premultiplied_alpha;
+  memcpy (sdata, src->data, sizeof (sdata));
+
+  /* unpack, blend and pack blocks of lines at a time */
+  lstride = (dest_width + 8) * 4;
+  tmpdestline = g_malloc (sizeof (guint8) * lstride * BLEND_LINES);
+  tmpsrcline = g_malloc (sizeof (guint8) * lstride * BLEND_LINES);
+
   /* Mainloop doing the needed conversions, and blending */
-  for (i = y; i < y + src_height; i++) {
-
-    dinfo->unpack_func (dinfo, 0, tmpdestline, dest->data, dest->info.stride,
-        0, i, dest_width);
-    sinfo->unpack_func (sinfo, 0, tmpsrcline, src->data, src->info.stride,
-        xoff, i - y, src_width - xoff);
-
-    matrix (tmpsrcline, src_width);
-
-    tmpdestline += 4 * x;
-
-    /* Here dest and src are both either in AYUV or ARGB
-     * TODO: Make the orc version working properly*/
-#define BLENDLOOP(blender,alpha_val,alpha_scale)                                  \
-  do {                                                                            \
-    for (j = 0; j < src_width * 4; j += 4) {                                      \
-      guint8 alpha;                                                               \
-                                                                                  \
-      alpha = (tmpsrcline[j] * alpha_val) / alpha_scale;                          \
-                                                                                  \
-      blender (tmpdestline[j + 1], alpha, tmpsrcline[j + 1], tmpdestline[j + 1]); \
-      blender (tmpdestline[j + 2], alpha, tmpsrcline[j + 2], tmpdestline[j + 2]); \
-      blender (tmpdestline[j + 3], alpha, tmpsrcline[j + 3], tmpdestline[j + 3]); \
-    }                                                                             \
+  for (i = y; i < y + src_height; i += n_lines) {
+    n_lines = MIN (BLEND_LINES, y + src_height - i);
+
+    first = 0;
+    last = src_width - 1;
+    if (use_spans && !get_visible_span (src, xoff, i - y + yoff, src_width,
+            n_lines, &first, &last))
+      continue;
+    span_width = last - first + 1;
+
+    gst_video_format_info_unpack_lines (dinfo, 0, tmpdestline, lstride,
+        dest->data, dest->info.stride, 0, i, dest_width, n_lines);
+    /* the unpack functions don't all handle an x offset, for the packed
+     * formats we can just offset the pointer */
+    if (packed_src) {
+      sdata[0] = (guint8 *) src->data[0] + (xoff + first) * 4;
+      gst_video_format_info_unpack_lines (sinfo, 0, tmpsrcline, lstride,
+          sdata, src->info.stride, 0, i - y + yoff, span_width, n_lines);
+    } else {
+      gst_video_format_info_unpack_lines (sinfo, 0, tmpsrcline, lstride,
+          sdata, src->info.stride, xoff, i - y + yoff, span_width, n_lines);
+    }
+
+    for (k = 0; k < n_lines; k++) {
+      guint8 *destline = tmpdestline + k * lstride + 4 * (x + first);
+      guint8 *srcline = tmpsrcline + k * lstride;
+
+      matrix (srcline, span_width);
+
+      /* Here dest and src are both either in AYUV or ARGB
+       * TODO: Make the orc version working properly*/
+#define BLENDLOOP(blender,alpha_val,alpha_scale)                            \
+  do {                                                                      \
+    for (j = 0; j < span_width * 4; j += 4) {                               \
+      guint8 alpha;                                                         \
+                                                                            \
+      alpha = (srcline[j] * alpha_val) / alpha_scale;                       \
+                                                                            \
+      blender (destline[j + 1], alpha, srcline[j + 1], destline[j + 1]);    \
+      blender (destline[j + 2], alpha, srcline[j + 2], destline[j + 2]);    \
+      blender (destline[j + 3], alpha, srcline[j + 3], destline[j + 3]);    \
+    }                                                                       \
   } while(0)
 
-    if (G_LIKELY (global_alpha == 1.0)) {
-      if (src_premultiplied_alpha && dest_premultiplied_alpha) {
-        /* BLENDLOOP (BLEND11, 1, 1); */
-      } else if (!src_premultiplied_alpha && dest_premultiplied_alpha) {
-        /* BLENDLOOP (BLEND01, 1, 1); */
-      } else if (src_premultiplied_alpha && !dest_premultiplied_alpha) {
-        BLENDLOOP (BLEND10, 1, 1);
+      if (G_LIKELY (global_alpha == 1.0)) {
+        if (src_premultiplied_alpha && dest_premultiplied_alpha) {
+          /* BLENDLOOP (BLEND11, 1, 1); */
+        } else if (!src_premultiplied_alpha && dest_premultiplied_alpha) {
+          /* BLENDLOOP (BLEND01, 1, 1); */
+        } else if (src_premultiplied_alpha && !dest_premultiplied_alpha) {
+          BLENDLOOP (BLEND10, 1, 1);
+        } else {
+          BLENDLOOP (BLEND00, 1, 1);
+        }
       } else {
-        BLENDLOOP (BLEND00, 1, 1);
+        if (src_premultiplied_alpha && dest_premultiplied_alpha) {
+          /* BLENDLOOP (BLEND11, global_alpha_val, 256); */
+        } else if (!src_premultiplied_alpha && dest_premultiplied_alpha) {
+          /* BLENDLOOP (BLEND01, global_alpha_val, 256); */
+        } else if (src_premultiplied_alpha && !dest_premultiplied_alpha) {
+          BLENDLOOP (BLEND10, global_alpha_val, 256);
+        } else {
+          BLENDLOOP (BLEND00, global_alpha_val, 256);
+        }
       }
-    } else {
-      if (src_premultiplied_alpha && dest_premultiplied_alpha) {
-        /* BLENDLOOP (BLEND11, global_alpha_val, 256); */
-      } else if (!src_premultiplied_alpha && dest_premultiplied_alpha) {
-        /* BLENDLOOP (BLEND01, global_alpha_val, 256); */
-      } else if (src_premultiplied_alpha && !dest_premultiplied_alpha) {
-        BLENDLOOP (BLEND10, global_alpha_val, 256);
-      } else {
-        BLENDLOOP (BLEND00, global_alpha_val, 256);
-      }
-    }
 
 #undef BLENDLOOP
 
-    tmpdestline -= 4 * x;
-
-    /* FIXME
-     * #if G_BYTE_ORDER == LITTLE_ENDIAN
-     * video_orc_blend_little (tmpdestline, tmpsrcline, dest->width);
-     * #else
-     * video_orc_blend_big (tmpdestline, tmpsrcline, src->width);
-     * #endif
-     */
+      /* FIXME
+       * #if G_BYTE_ORDER == LITTLE_ENDIAN
+       * video_orc_blend_little (tmpdestline, tmpsrcline, dest->width);
+       * #else
+       * video_orc_blend_big (tmpdestline, tmpsrcline, src->width);
+       * #endif
+       */
+    }
 
-    dinfo->pack_func (dinfo, 0, tmpdestline, dest_width,
-        dest->data, dest->info.stride, dest->info.chroma_site, i, dest_width);
+    gst_video_format_info_pack_lines (dinfo, 0, tmpdestline, lstride,
+        dest->data, dest->info.stride, dest->info.chroma_site, i, dest_width,
+        n_lines);
   }
 
   g_free (tmpdestline);
@@ -25,6 +25,7 @@
 #include <stdio.h>
 
 #include "video-format.h"
+#include "video-orc.h"
 
 typedef struct
 {
@@ -122,6 +123,72 @@ struct _GstVideoChromaResample
 #define FILT_1_2_3_10(a,b,c,d)      ((a) + 2*(b) + 3*(c) + 10*(d) + 8) >> 16
 #define FILT_1_2_3_4_3_2_1(a,b,c,d,e,f,g) ((a) + 2*(b) + 3*(c) + 4*(d) + 3*(e) + 2*(f) + (g) + 8) >> 16
 
+/* ORC versions of the inner loops of the most used resamplers. The ORC
+ * functions handle the pixels as native endian integers with the chroma in
+ * the upper half, so they are only used on little endian. They return FALSE
+ * when the C loop should be used. */
+static inline gboolean
+orc_up_v2_guint8 (gpointer l0, gpointer l1, gint width)
+{
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_chroma_up_v2_u8 (l0, l1, width);
+  return TRUE;
+#else
+  return FALSE;
+#endif
+}
+
+static inline gboolean
+orc_up_v2_guint16 (gpointer l0, gpointer l1, gint width)
+{
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_chroma_up_v2_u16 (l0, l1, width);
+  return TRUE;
+#else
+  return FALSE;
+#endif
+}
+
+static inline gboolean
+orc_down_v2_guint8 (gpointer l0, gpointer l1, gint width)
+{
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_chroma_down_v2_u8 (l0, l1, width);
+  return TRUE;
+#else
+  return FALSE;
+#endif
+}
+
+static inline gboolean
+orc_down_v2_guint16 (gpointer l0, gpointer l1, gint width)
+{
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_chroma_down_v2_u16 (l0, l1, width);
+  return TRUE;
+#else
+  return FALSE;
+#endif
+}
+
+static inline gboolean
+orc_down_h2_guint8 (gpointer p, gint width)
+{
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_chroma_down_h2_u8 (p, width / 2);
+  return TRUE;
+#else
+  return FALSE;
+#endif
+}
+
+static inline gboolean
+orc_down_h2_guint16 (gpointer p, gint width)
+{
+  /* pairs of AYUV64 pixels don't fit in an ORC element */
+  return FALSE;
+}
+
 /* 2x horizontal upsampling without cositing
  *
  * +----------    a
@@ -180,7 +247,7 @@ video_chroma_up_v2_##type (GstVideoChromaResample *resample,            \
     if (l0 != l1)                                                       \
       resample->h_resample (resample, l1, width);                       \
   }                                                                     \
-  if (l0 != l1) {                                                       \
+  if (l0 != l1 && !orc_up_v2_##type (l0, l1, width)) {                  \
     for (i = 0; i < width; i++) {                                       \
       tr0 = PR0(i), tr1 = PR1(i);                                       \
       tb0 = PB0(i), tb1 = PB1(i);                                       \
@@ -268,6 +335,9 @@ video_chroma_down_h2_##type (GstVideoChromaResample *resample,         \
   type *p = pixels;                                                     \
   gint i;                                                               \
                                                                         \
+  if (orc_down_h2_##type (p, width))                                    \
+    return;                                                             \
+                                                                        \
   for (i = 0; i < width - 1; i += 2) {                                  \
     type tr0 = PR(i), tr1 = PR(i+1);                                    \
     type tb0 = PB(i), tb1 = PB(i+1);                                    \
@@ -299,7 +369,7 @@ video_chroma_down_v2_##type (GstVideoChromaResample *resample,          \
     if (l0 != l1)                                                       \
       resample->h_resample (resample, l1, width);                       \
   }                                                                     \
-  if (l0 != l1) {                                                       \
+  if (l0 != l1 && !orc_down_v2_##type (l0, l1, width)) {                \
     for (i = 0; i < width; i++) {                                       \
       type tr0 = PR0(i), tr1 = PR1(i);                                  \
       type tb0 = PB0(i), tb1 = PB1(i);                                  \
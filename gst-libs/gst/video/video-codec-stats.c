@@ -0,0 +1,126 @@
+/* GStreamer
+ *
+ * video-codec-stats.c: statistics kept by the video codec base classes
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "video-codec-stats.h"
+
+/* Times are taken from the monotonic clock in microseconds, which is cheap
+ * to read on every frame and is not affected by the pipeline clock */
+
+void
+video_codec_stats_reset (VideoCodecStats * stats)
+{
+  GstClockTime interval = stats->interval;
+
+  memset (stats, 0, sizeof (VideoCodecStats));
+  stats->interval = interval;
+  stats->last_post = g_get_monotonic_time ();
+}
+
+/* @start is the monotonic time before the subclass was called */
+void
+video_codec_stats_add_processed (VideoCodecStats * stats, gint64 start)
+{
+  GstClockTime elapsed;
+  guint bucket;
+
+  elapsed = (g_get_monotonic_time () - start) * GST_USECOND;
+
+  stats->processed++;
+  stats->proc_time += elapsed;
+  if (elapsed > stats->max_proc_time)
+    stats->max_proc_time = elapsed;
+
+  bucket = g_bit_storage (elapsed / GST_MSECOND);
+  if (elapsed < GST_MSECOND)
+    bucket = 0;
+  stats->proc_hist[MIN (bucket, VIDEO_CODEC_STATS_N_BUCKETS - 1)]++;
+}
+
+/* @arrival is the monotonic time the frame arrived, or 0 when unknown */
+void
+video_codec_stats_add_pushed (VideoCodecStats * stats, gint64 arrival)
+{
+  GstClockTime latency;
+
+  stats->pushed++;
+  if (arrival == 0)
+    return;
+
+  latency = (g_get_monotonic_time () - arrival) * GST_USECOND;
+  stats->latency += latency;
+  stats->n_latency++;
+  if (latency > stats->max_latency)
+    stats->max_latency = latency;
+}
+
+GstStructure *
+video_codec_stats_to_structure (VideoCodecStats * stats, const gchar * name,
+    guint in_flight)
+{
+  GstStructure *s;
+  GValue hist = G_VALUE_INIT;
+  GValue val = G_VALUE_INIT;
+  guint i;
+
+  s = gst_structure_new (name,
+      "processed", G_TYPE_UINT64, stats->processed,
+      "pushed", G_TYPE_UINT64, stats->pushed,
+      "dropped", G_TYPE_UINT64, stats->dropped,
+      "in-flight", G_TYPE_UINT, in_flight,
+      "processing-time", G_TYPE_UINT64, stats->proc_time,
+      "max-processing-time", G_TYPE_UINT64, stats->max_proc_time,
+      "average-latency", G_TYPE_UINT64,
+      stats->n_latency ? stats->latency / stats->n_latency : 0,
+      "max-latency", G_TYPE_UINT64, stats->max_latency, NULL);
+
+  g_value_init (&hist, GST_TYPE_ARRAY);
+  g_value_init (&val, G_TYPE_UINT64);
+  for (i = 0; i < VIDEO_CODEC_STATS_N_BUCKETS; i++) {
+    g_value_set_uint64 (&val, stats->proc_hist[i]);
+    gst_value_array_append_value (&hist, &val);
+  }
+  g_value_unset (&val);
+  gst_structure_take_value (s, "processing-histogram", &hist);
+
+  return s;
+}
+
+/* TRUE when the stats are due to be posted on the bus again */
+gboolean
+video_codec_stats_need_post (VideoCodecStats * stats)
+{
+  gint64 now;
+
+  if (stats->interval == 0)
+    return FALSE;
+
+  now = g_get_monotonic_time ();
+  if ((now - stats->last_post) * GST_USECOND < stats->interval)
+    return FALSE;
+
+  stats->last_post = now;
+  return TRUE;
+}
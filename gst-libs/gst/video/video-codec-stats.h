@@ -0,0 +1,74 @@
+/* GStreamer
+ *
+ * video-codec-stats.h: statistics kept by the video codec base classes
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_VIDEO_CODEC_STATS_H__
+#define __GST_VIDEO_CODEC_STATS_H__
+
+#include <gst/gst.h>
+
+G_BEGIN_DECLS
+
+/* processing times are counted in power of two buckets of milliseconds,
+ * the first bucket holds times below 1ms and the last one everything from
+ * 64ms up */
+#define VIDEO_CODEC_STATS_N_BUCKETS 8
+
+typedef struct _VideoCodecStats VideoCodecStats;
+
+/* all fields are protected by the object lock of the element */
+struct _VideoCodecStats
+{
+  /* frames handed to the subclass */
+  guint64 processed;
+  /* frames pushed downstream */
+  guint64 pushed;
+  /* frames dropped because of QoS */
+  guint64 dropped;
+
+  /* time spent in handle_frame */
+  GstClockTime proc_time;
+  GstClockTime max_proc_time;
+  guint64 proc_hist[VIDEO_CODEC_STATS_N_BUCKETS];
+
+  /* time between the arrival of a frame and pushing it */
+  GstClockTime latency;
+  GstClockTime max_latency;
+  guint64 n_latency;
+
+  /* interval for posting the stats on the bus, 0 disables */
+  GstClockTime interval;
+  gint64 last_post;
+};
+
+void           video_codec_stats_reset        (VideoCodecStats * stats);
+
+void           video_codec_stats_add_processed (VideoCodecStats * stats,
+                                                gint64 start);
+void           video_codec_stats_add_pushed   (VideoCodecStats * stats,
+                                               gint64 arrival);
+
+GstStructure * video_codec_stats_to_structure (VideoCodecStats * stats,
+                                               const gchar * name,
+                                               guint in_flight);
+gboolean       video_codec_stats_need_post    (VideoCodecStats * stats);
+
+G_END_DECLS
+
+#endif /* __GST_VIDEO_CODEC_STATS_H__ */
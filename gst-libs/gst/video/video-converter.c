@@ -0,0 +1,2583 @@
+/* GStreamer
+ * Copyright (C) 2010 David Schleef <ds@schleef.org>
+ * Copyright (C) 2010 Sebastian Dröge <sebastian.droege@collabora.co.uk>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:gstvideoconverter
+ * @short_description: Convert video frames between formats
+ *
+ * #GstVideoConverter converts raw video frames between the formats,
+ * colorimetry and chroma siting described by two #GstVideoInfo of the same
+ * size. It uses optimized code for the common format pairs and falls back
+ * to a generic unpack, convert and pack path for the others.
+ *
+ * The conversion can be tuned with a #GstStructure holding the
+ * GST_VIDEO_CONVERTER_OPT_* options, passed to gst_video_converter_new()
+ * or gst_video_converter_set_config().
+ *
+ * Since: 1.2
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "video-converter.h"
+
+#include <glib.h>
+#include <string.h>
+#include <math.h>
+
+#include "video-orc.h"
+
+#ifndef GST_DISABLE_GST_DEBUG
+
+#define GST_CAT_DEFAULT ensure_debug_category()
+
+static GstDebugCategory *
+ensure_debug_category (void)
+{
+  static gsize cat_gonce = 0;
+
+  if (g_once_init_enter (&cat_gonce)) {
+    gsize cat_done;
+
+    cat_done = (gsize) _gst_debug_category_new ("video-converter", 0,
+        "video-converter object");
+
+    g_once_init_leave (&cat_gonce, cat_done);
+  }
+
+  return (GstDebugCategory *) cat_gonce;
+}
+
+#else
+
+#define ensure_debug_category() /* NOOP */
+
+#endif /* GST_DISABLE_GST_DEBUG */
+
+typedef struct _VideoConverterTask VideoConverterTask;
+
+/* Number of pixels we run through the 16 bits stages at a time. 256 ARGB64
+ * pixels are 2KB so the tile stays in L1 between the stages instead of
+ * pushing a complete line through the cache for each of them. This must be a
+ * multiple of 8 to keep the ordered dither patterns aligned. */
+#define TILE_WIDTH 256
+
+struct _GstVideoConverter
+{
+  GstVideoInfo in_info;
+  GstVideoInfo out_info;
+
+  GstStructure *config;
+
+  gint width;
+  gint height;
+
+  gint in_bits;
+  gint out_bits;
+  gint cmatrix[4][4];
+  guint64 orc_p1;
+  guint64 orc_p2;
+  guint64 orc_p3;
+  guint64 orc_p4;
+
+  guint n_tmplines;
+  gpointer *tmplines;
+  guint16 *errline;
+
+  /* per component mask of the bits lost when packing, for verterr */
+  guint64 dither_mask;
+  /* dither_n_lines lines of TILE_WIDTH pixels of the ordered dither pattern */
+  guint16 *dither_lines;
+  guint dither_n_lines;
+
+  guint n_threads;
+  guint slice_align;
+  VideoConverterTask *tasks;
+  GThreadPool *pool;
+  GMutex lock;
+  GCond cond;
+  guint n_pending;
+
+  GstVideoChromaResample *upsample;
+  guint up_n_lines;
+  gint up_offset;
+  GstVideoChromaResample *downsample;
+  guint down_n_lines;
+  gint down_offset;
+
+  void (*convert) (GstVideoConverter * convert, GstVideoFrame * dest,
+      const GstVideoFrame * src);
+  void (*matrix) (GstVideoConverter * convert, gpointer pixels, gint width);
+  void (*dither16) (GstVideoConverter * convert, guint16 * pixels,
+      guint16 * errline, gint width, int j);
+};
+
+static void video_converter_generic (GstVideoConverter * convert,
+    GstVideoFrame * dest, const GstVideoFrame * src);
+static void video_converter_matrix8 (GstVideoConverter * convert,
+    gpointer pixels, gint width);
+static void video_converter_matrix8_orc (GstVideoConverter * convert,
+    gpointer pixels, gint width);
+static void video_converter_matrix16 (GstVideoConverter * convert,
+    gpointer pixels, gint width);
+static gboolean video_converter_lookup_fastpath (GstVideoConverter * convert);
+static gboolean video_converter_compute_matrix (GstVideoConverter * convert);
+static gboolean video_converter_compute_resample (GstVideoConverter * convert);
+static void video_converter_dither_verterr (GstVideoConverter * convert,
+    guint16 * pixels, guint16 * errline, gint width, int j);
+static void video_converter_dither_ordered (GstVideoConverter * convert,
+    guint16 * pixels, guint16 * errline, gint width, int j);
+static void video_converter_line16 (GstVideoConverter * convert,
+    gpointer line, guint16 * errline, gint y);
+static void video_converter_task (VideoConverterTask * task);
+static void video_converter_copy_palette (GstVideoFrame * dest);
+
+
+struct _VideoConverterTask
+{
+  GstVideoConverter *convert;
+  GstVideoFrame *dest;
+  const GstVideoFrame *src;
+  gint y_start;
+  gint y_end;
+  gpointer *tmplines;
+  guint16 *errline;
+};
+
+static gpointer *
+video_converter_alloc_tmplines (guint n_lines, gint width)
+{
+  gpointer *tmplines;
+  guint i;
+
+  tmplines = g_malloc (n_lines * sizeof (gpointer));
+  for (i = 0; i < n_lines; i++)
+    tmplines[i] = g_malloc (sizeof (guint16) * (width + 8) * 4);
+
+  return tmplines;
+}
+
+static void
+video_converter_free_tmplines (gpointer * tmplines, guint n_lines)
+{
+  guint i;
+
+  for (i = 0; i < n_lines; i++)
+    g_free (tmplines[i]);
+  g_free (tmplines);
+}
+
+static void video_converter_apply_config (GstVideoConverter * convert);
+
+/**
+ * gst_video_converter_new:
+ * @in_info: a #GstVideoInfo
+ * @out_info: a #GstVideoInfo
+ * @config: (transfer full) (allow-none): a #GstStructure with configuration
+ *    options or %NULL
+ *
+ * Create a new converter object to convert between @in_info and @out_info
+ * with @config. @in_info and @out_info must have the same size, framerate,
+ * pixel-aspect-ratio and interlace mode.
+ *
+ * Returns: a #GstVideoConverter or %NULL if conversion is not possible.
+ *
+ * Since: 1.2
+ */
+GstVideoConverter *
+gst_video_converter_new (GstVideoInfo * in_info, GstVideoInfo * out_info,
+    GstStructure * config)
+{
+  GstVideoConverter *convert;
+  gint width;
+  guint align;
+
+  g_return_val_if_fail (in_info != NULL, NULL);
+  g_return_val_if_fail (out_info != NULL, NULL);
+  /* we won't ever do framerate conversion */
+  g_return_val_if_fail (in_info->fps_n == out_info->fps_n, NULL);
+  g_return_val_if_fail (in_info->fps_d == out_info->fps_d, NULL);
+  /* we won't ever do deinterlace */
+  g_return_val_if_fail (in_info->interlace_mode == out_info->interlace_mode,
+      NULL);
+  /* we don't scale */
+  g_return_val_if_fail (in_info->width == out_info->width, NULL);
+  g_return_val_if_fail (in_info->height == out_info->height, NULL);
+  /* the generic path and the slices pack one line at a time */
+  g_return_val_if_fail (out_info->finfo->pack_lines == 1, NULL);
+
+  convert = g_slice_new0 (GstVideoConverter);
+
+  convert->in_info = *in_info;
+  convert->out_info = *out_info;
+  convert->dither16 = NULL;
+  convert->n_threads = 1;
+  g_mutex_init (&convert->lock);
+  g_cond_init (&convert->cond);
+
+  convert->width = GST_VIDEO_INFO_WIDTH (in_info);
+  convert->height = GST_VIDEO_INFO_HEIGHT (in_info);
+
+  width = convert->width;
+
+  /* gst_video_converter_line() uses the matrix, also with a fastpath */
+  if (!video_converter_compute_matrix (convert))
+    goto no_convert;
+
+  if (!video_converter_lookup_fastpath (convert)) {
+    convert->convert = video_converter_generic;
+    if (!video_converter_compute_resample (convert))
+      goto no_convert;
+  } else {
+    /* fastpaths use a temp line for the odd last line */
+    convert->n_tmplines = 1;
+    convert->tmplines = video_converter_alloc_tmplines (1, width);
+  }
+
+  /* slices must start on a line where the vertical chroma subsampling and
+   * the resampler line groups restart, for interlaced content we also need
+   * to keep the two fields apart */
+  align = 1 << MAX (in_info->finfo->h_sub[1], out_info->finfo->h_sub[1]);
+  align = MAX (align, convert->up_n_lines);
+  align = MAX (align, convert->down_n_lines);
+  /* slices of tiled frames start on a pair of tile rows in all planes */
+  if (GST_VIDEO_FORMAT_INFO_IS_TILED (in_info->finfo))
+    align = MAX (align, 2 << (GST_VIDEO_FORMAT_INFO_TILE_HS (in_info->finfo) +
+            in_info->finfo->h_sub[1]));
+  if (GST_VIDEO_FORMAT_INFO_IS_TILED (out_info->finfo))
+    align = MAX (align, 2 << (GST_VIDEO_FORMAT_INFO_TILE_HS (out_info->finfo) +
+            out_info->finfo->h_sub[1]));
+  if (GST_VIDEO_INFO_IS_INTERLACED (in_info))
+    align *= 2;
+  convert->slice_align = align;
+
+  convert->errline = g_malloc0 (sizeof (guint16) * width * 4);
+
+  convert->config = gst_structure_new_empty ("GstVideoConverter");
+  if (config)
+    gst_video_converter_set_config (convert, config);
+  else
+    video_converter_apply_config (convert);
+
+  return convert;
+
+  /* ERRORS */
+no_convert:
+  {
+    if (config)
+      gst_structure_free (config);
+    gst_video_converter_free (convert);
+    return NULL;
+  }
+}
+
+static void
+video_converter_free_tasks (GstVideoConverter * convert)
+{
+  guint i;
+
+  if (convert->pool) {
+    g_thread_pool_free (convert->pool, FALSE, TRUE);
+    convert->pool = NULL;
+  }
+  if (convert->tasks) {
+    /* the first task uses the lines of the converter */
+    for (i = 1; i < convert->n_threads; i++) {
+      video_converter_free_tmplines (convert->tasks[i].tmplines,
+          convert->n_tmplines);
+      g_free (convert->tasks[i].errline);
+    }
+    g_free (convert->tasks);
+    convert->tasks = NULL;
+  }
+  convert->n_threads = 1;
+}
+
+/**
+ * gst_video_converter_free:
+ * @convert: a #GstVideoConverter
+ *
+ * Free @convert
+ *
+ * Since: 1.2
+ */
+void
+gst_video_converter_free (GstVideoConverter * convert)
+{
+  g_return_if_fail (convert != NULL);
+
+  video_converter_free_tasks (convert);
+
+  if (convert->upsample)
+    gst_video_chroma_resample_free (convert->upsample);
+  if (convert->downsample)
+    gst_video_chroma_resample_free (convert->downsample);
+
+  if (convert->tmplines)
+    video_converter_free_tmplines (convert->tmplines, convert->n_tmplines);
+  g_free (convert->errline);
+  g_free (convert->dither_lines);
+
+  if (convert->config)
+    gst_structure_free (convert->config);
+
+  g_mutex_clear (&convert->lock);
+  g_cond_clear (&convert->cond);
+
+  g_slice_free (GstVideoConverter, convert);
+}
+
+/* indexed by x and y, in 1/256 of a quantization step */
+static const guint8 halftone_matrix[8][8] = {
+  {0, 128, 32, 160, 8, 136, 40, 168},
+  {192, 64, 224, 96, 200, 72, 232, 104},
+  {48, 176, 16, 144, 56, 184, 24, 152},
+  {240, 112, 208, 80, 248, 120, 216, 88},
+  {12, 240, 44, 172, 4, 132, 36, 164},
+  {204, 76, 236, 108, 196, 68, 228, 100},
+  {60, 188, 28, 156, 52, 180, 20, 148},
+  {252, 142, 220, 92, 244, 116, 212, 84}
+};
+
+/* indexed by y and x, in 1/16 of a quantization step */
+static const guint8 bayer_matrix[4][4] = {
+  {0, 8, 2, 10},
+  {12, 4, 14, 6},
+  {3, 11, 1, 9},
+  {15, 7, 13, 5}
+};
+
+/* get the number of bits that the A and the three color components of the
+ * unpacked pixels lose when they are packed into the output format */
+static void
+video_converter_get_dither_bits (GstVideoConverter * convert, guint bits[4])
+{
+  const GstVideoFormatInfo *finfo = convert->out_info.finfo;
+  gint i, comp, depth;
+
+  for (i = 0; i < 4; i++) {
+    comp = (i == 0) ? GST_VIDEO_COMP_A : i - 1;
+    if (comp < GST_VIDEO_FORMAT_INFO_N_COMPONENTS (finfo))
+      depth = MIN (GST_VIDEO_FORMAT_INFO_DEPTH (finfo, comp), 16);
+    else
+      depth = 16;
+    bits[i] = 16 - depth;
+  }
+}
+
+static void
+video_converter_set_dither (GstVideoConverter * convert,
+    GstVideoDitherMethod method)
+{
+  guint16 mask[4], *line;
+  guint bits[4];
+  guint i, x, y, n_lines;
+
+  g_free (convert->dither_lines);
+  convert->dither_lines = NULL;
+  convert->dither_n_lines = 0;
+
+  video_converter_get_dither_bits (convert, bits);
+
+  switch (method) {
+    case GST_VIDEO_DITHER_NONE:
+    default:
+      convert->dither16 = NULL;
+      break;
+    case GST_VIDEO_DITHER_VERTERR:
+      /* the orc function takes the mask of the 4 components in memory order */
+      for (i = 0; i < 4; i++)
+        mask[i] = (1 << bits[i]) - 1;
+      memcpy (&convert->dither_mask, mask, sizeof (mask));
+      convert->dither16 = video_converter_dither_verterr;
+      break;
+    case GST_VIDEO_DITHER_HALFTONE:
+    case GST_VIDEO_DITHER_BAYER:
+      /* precompute the pattern for a complete tile so that applying it is a
+       * single saturating add of two lines */
+      n_lines = (method == GST_VIDEO_DITHER_HALFTONE) ? 8 : 4;
+      convert->dither_lines =
+          g_malloc (sizeof (guint16) * n_lines * TILE_WIDTH * 4);
+      for (y = 0; y < n_lines; y++) {
+        line = convert->dither_lines + y * TILE_WIDTH * 4;
+        for (x = 0; x < TILE_WIDTH; x++) {
+          for (i = 0; i < 4; i++) {
+            if (method == GST_VIDEO_DITHER_HALFTONE)
+              line[x * 4 + i] = (halftone_matrix[x & 7][y] << bits[i]) >> 8;
+            else
+              line[x * 4 + i] = (bayer_matrix[y][x & 3] << bits[i]) >> 4;
+          }
+        }
+      }
+      convert->dither_n_lines = n_lines;
+      convert->dither16 = video_converter_dither_ordered;
+      break;
+  }
+}
+
+static void
+video_converter_pool_func (gpointer data, gpointer user_data)
+{
+  VideoConverterTask *task = data;
+  GstVideoConverter *convert = user_data;
+
+  video_converter_task (task);
+
+  g_mutex_lock (&convert->lock);
+  if (--convert->n_pending == 0)
+    g_cond_signal (&convert->cond);
+  g_mutex_unlock (&convert->lock);
+}
+
+/* split the frames in @n_threads horizontal slices and convert them in
+ * parallel, 0 uses the number of processors. The calling thread converts the
+ * first slice. */
+static void
+video_converter_set_threads (GstVideoConverter * convert, guint n_threads)
+{
+  guint i;
+
+  if (n_threads == 0) {
+#if GLIB_CHECK_VERSION(2,36,0)
+    n_threads = g_get_num_processors ();
+#else
+    n_threads = 1;
+#endif
+  }
+  /* no point in making slices smaller than the alignment */
+  n_threads = CLAMP (n_threads, 1,
+      MAX (1, convert->height / convert->slice_align));
+  /* error diffusion carries the rounding errors of a line to the next one,
+   * the generic path must then convert all the lines in order */
+  if (convert->convert == video_converter_generic &&
+      convert->dither16 == video_converter_dither_verterr)
+    n_threads = 1;
+
+  if (n_threads == convert->n_threads)
+    return;
+
+  video_converter_free_tasks (convert);
+
+  if (n_threads == 1)
+    return;
+
+  convert->pool = g_thread_pool_new (video_converter_pool_func, convert,
+      n_threads - 1, FALSE, NULL);
+  if (convert->pool == NULL) {
+    GST_WARNING ("could not create thread pool, using 1 thread");
+    return;
+  }
+
+  convert->n_threads = n_threads;
+  convert->tasks = g_new0 (VideoConverterTask, n_threads);
+  for (i = 0; i < n_threads; i++) {
+    VideoConverterTask *task = &convert->tasks[i];
+
+    task->convert = convert;
+    if (i == 0) {
+      task->tmplines = convert->tmplines;
+      task->errline = convert->errline;
+    } else {
+      task->tmplines =
+          video_converter_alloc_tmplines (convert->n_tmplines, convert->width);
+      task->errline = g_malloc0 (sizeof (guint16) * convert->width * 4);
+    }
+  }
+  GST_DEBUG ("using %u threads, slice alignment %u", n_threads,
+      convert->slice_align);
+}
+
+static void
+video_converter_apply_config (GstVideoConverter * convert)
+{
+  gint method;
+  guint n_threads;
+
+  if (!gst_structure_get_enum (convert->config,
+          GST_VIDEO_CONVERTER_OPT_DITHER_METHOD, GST_TYPE_VIDEO_DITHER_METHOD,
+          &method))
+    method = GST_VIDEO_DITHER_NONE;
+  video_converter_set_dither (convert, method);
+
+  if (!gst_structure_get_uint (convert->config, GST_VIDEO_CONVERTER_OPT_THREADS,
+          &n_threads))
+    n_threads = 1;
+  video_converter_set_threads (convert, n_threads);
+}
+
+static gboolean
+copy_config (GQuark field_id, const GValue * value, gpointer user_data)
+{
+  GstVideoConverter *convert = user_data;
+
+  gst_structure_id_set_value (convert->config, field_id, value);
+
+  return TRUE;
+}
+
+/**
+ * gst_video_converter_set_config:
+ * @convert: a #GstVideoConverter
+ * @config: (transfer full): a #GstStructure
+ *
+ * Set @config as extra configuration for @convert.
+ *
+ * If the parameters in @config can not be set exactly, this function returns
+ * %FALSE and will try to update as much state as possible. The new state can
+ * then be retrieved and refined with gst_video_converter_get_config().
+ *
+ * Look at the #GST_VIDEO_CONVERTER_OPT_* fields to check valid configuration
+ * option and values.
+ *
+ * This function must not be called while a frame is being converted.
+ *
+ * Returns: %TRUE when @config could be set.
+ *
+ * Since: 1.2
+ */
+gboolean
+gst_video_converter_set_config (GstVideoConverter * convert,
+    GstStructure * config)
+{
+  guint n_threads;
+  gboolean res = TRUE;
+
+  g_return_val_if_fail (convert != NULL, FALSE);
+  g_return_val_if_fail (config != NULL, FALSE);
+
+  gst_structure_foreach (config, copy_config, convert);
+  gst_structure_free (config);
+
+  video_converter_apply_config (convert);
+
+  /* the number of threads is limited by the frame height, report back
+   * what was actually configured */
+  if (gst_structure_get_uint (convert->config,
+          GST_VIDEO_CONVERTER_OPT_THREADS, &n_threads) && n_threads != 0
+      && n_threads != convert->n_threads) {
+    gst_structure_set (convert->config, GST_VIDEO_CONVERTER_OPT_THREADS,
+        G_TYPE_UINT, convert->n_threads, NULL);
+    res = FALSE;
+  }
+
+  return res;
+}
+
+/**
+ * gst_video_converter_get_config:
+ * @convert: a #GstVideoConverter
+ *
+ * Get the current configuration of @convert.
+ *
+ * Returns: a #GstStructure that remains valid for as long as @convert is valid
+ *   or until gst_video_converter_set_config() is called.
+ *
+ * Since: 1.2
+ */
+const GstStructure *
+gst_video_converter_get_config (GstVideoConverter * convert)
+{
+  g_return_val_if_fail (convert != NULL, NULL);
+
+  return convert->config;
+}
+
+/**
+ * gst_video_converter_frame:
+ * @convert: a #GstVideoConverter
+ * @src: a #GstVideoFrame
+ * @dest: a #GstVideoFrame
+ *
+ * Convert the pixels of @src into @dest using @convert. The frames must
+ * match the input and output #GstVideoInfo of @convert.
+ *
+ * Since: 1.2
+ */
+void
+gst_video_converter_frame (GstVideoConverter * convert,
+    const GstVideoFrame * src, GstVideoFrame * dest)
+{
+  guint i, n_tasks, align;
+  gint y, lines, height;
+
+  g_return_if_fail (convert != NULL);
+  g_return_if_fail (src != NULL);
+  g_return_if_fail (dest != NULL);
+
+  if (convert->n_threads <= 1) {
+    convert->convert (convert, dest, src);
+    return;
+  }
+
+  height = convert->height;
+  align = convert->slice_align;
+
+  lines = (height + convert->n_threads - 1) / convert->n_threads;
+  lines = ((lines + align - 1) / align) * align;
+
+  for (i = 0, y = 0; i < convert->n_threads && y < height; i++, y += lines) {
+    VideoConverterTask *task = &convert->tasks[i];
+
+    task->dest = dest;
+    task->src = src;
+    task->y_start = y;
+    task->y_end = MIN (y + lines, height);
+  }
+  n_tasks = i;
+
+  convert->n_pending = n_tasks - 1;
+  for (i = 1; i < n_tasks; i++)
+    g_thread_pool_push (convert->pool, &convert->tasks[i], NULL);
+
+  video_converter_task (&convert->tasks[0]);
+
+  g_mutex_lock (&convert->lock);
+  while (convert->n_pending > 0)
+    g_cond_wait (&convert->cond, &convert->lock);
+  g_mutex_unlock (&convert->lock);
+
+  if (convert->convert == video_converter_generic)
+    video_converter_copy_palette (dest);
+}
+
+/**
+ * gst_video_converter_line:
+ * @convert: a #GstVideoConverter
+ * @line: a line of unpacked pixels
+ * @y: the number of the line in the output frame
+ *
+ * Convert the colors of one line of pixels in place with @convert, for
+ * callers that unpack and pack the frames themselves. @line contains as
+ * many pixels as the width of the #GstVideoInfo of @convert, in the unpack
+ * format of the input #GstVideoInfo, and contains the same pixels in the
+ * unpack format of the output #GstVideoInfo afterwards. It must have room
+ * for 8 bytes per pixel.
+ *
+ * Only the color matrix and the dithering are applied, the chroma planes
+ * are not resampled. @y selects the line of the ordered dither patterns,
+ * the lines of a frame must be converted in order for error diffusion.
+ *
+ * Since: 1.2
+ */
+void
+gst_video_converter_line (GstVideoConverter * convert, gpointer line, gint y)
+{
+  g_return_if_fail (convert != NULL);
+  g_return_if_fail (line != NULL);
+
+  if (convert->in_bits == 16 || convert->out_bits == 16)
+    video_converter_line16 (convert, line, convert->errline, y);
+  else if (convert->matrix)
+    convert->matrix (convert, line, convert->width);
+}
+
+#define SCALE    (8)
+#define SCALE_F  ((float) (1 << SCALE))
+
+static void
+video_converter_matrix8 (GstVideoConverter * convert, gpointer pixels,
+    gint width)
+{
+  int i;
+  int r, g, b;
+  int y, u, v;
+  guint8 *p = pixels;
+
+  for (i = 0; i < width; i++) {
+    r = p[i * 4 + 1];
+    g = p[i * 4 + 2];
+    b = p[i * 4 + 3];
+
+    y = (convert->cmatrix[0][0] * r + convert->cmatrix[0][1] * g +
+        convert->cmatrix[0][2] * b + convert->cmatrix[0][3]) >> SCALE;
+    u = (convert->cmatrix[1][0] * r + convert->cmatrix[1][1] * g +
+        convert->cmatrix[1][2] * b + convert->cmatrix[1][3]) >> SCALE;
+    v = (convert->cmatrix[2][0] * r + convert->cmatrix[2][1] * g +
+        convert->cmatrix[2][2] * b + convert->cmatrix[2][3]) >> SCALE;
+
+    p[i * 4 + 1] = CLAMP (y, 0, 255);
+    p[i * 4 + 2] = CLAMP (u, 0, 255);
+    p[i * 4 + 3] = CLAMP (v, 0, 255);
+  }
+}
+
+static void
+video_converter_matrix8_orc (GstVideoConverter * convert, gpointer pixels,
+    gint width)
+{
+  video_orc_matrix8 (pixels, pixels, convert->orc_p1, convert->orc_p2,
+      convert->orc_p3, convert->orc_p4, width);
+}
+
+/* The orc matrix works on 16 bits words: the components are scaled up by 7
+ * bits and multiplied with the coefficients in 4.12 fixed point, keeping the
+ * high word, which leaves the products in 13.3 fixed point. Make sure that
+ * the coefficients and the intermediate sums fit, else we keep using the C
+ * version. */
+static gboolean
+video_converter_prepare_matrix8_orc (GstVideoConverter * convert)
+{
+  gint i, j, sum, coef[3][4];
+
+  for (i = 0; i < 3; i++) {
+    sum = ABS (convert->cmatrix[i][3] >> 5);
+    for (j = 0; j < 3; j++) {
+      if (convert->cmatrix[i][j] < -2048 || convert->cmatrix[i][j] > 2047)
+        return FALSE;
+
+      coef[i][j] = convert->cmatrix[i][j] << 4;
+      sum += ((255 << 7) * ABS (coef[i][j])) >> 16;
+    }
+    if (sum > G_MAXINT16)
+      return FALSE;
+
+    coef[i][3] = convert->cmatrix[i][3] >> 5;
+  }
+
+  /* one lane per ARGB component, the alpha lane is not used */
+  convert->orc_p1 = (((guint64) (guint16) coef[0][2]) << 48) |
+      (((guint64) (guint16) coef[0][1]) << 32) |
+      (((guint64) (guint16) coef[0][0]) << 16);
+  convert->orc_p2 = (((guint64) (guint16) coef[1][2]) << 48) |
+      (((guint64) (guint16) coef[1][1]) << 32) |
+      (((guint64) (guint16) coef[1][0]) << 16);
+  convert->orc_p3 = (((guint64) (guint16) coef[2][2]) << 48) |
+      (((guint64) (guint16) coef[2][1]) << 32) |
+      (((guint64) (guint16) coef[2][0]) << 16);
+  convert->orc_p4 = (((guint64) (guint16) coef[2][3]) << 48) |
+      (((guint64) (guint16) coef[1][3]) << 32) |
+      (((guint64) (guint16) coef[0][3]) << 16);
+
+  return TRUE;
+}
+
+static void
+video_converter_matrix16 (GstVideoConverter * convert, gpointer pixels,
+    gint width)
+{
+  int i;
+  int r, g, b;
+  int y, u, v;
+  guint16 *p = pixels;
+
+  for (i = 0; i < width; i++) {
+    r = p[i * 4 + 1];
+    g = p[i * 4 + 2];
+    b = p[i * 4 + 3];
+
+    y = (convert->cmatrix[0][0] * r + convert->cmatrix[0][1] * g +
+        convert->cmatrix[0][2] * b + convert->cmatrix[0][3]) >> SCALE;
+    u = (convert->cmatrix[1][0] * r + convert->cmatrix[1][1] * g +
+        convert->cmatrix[1][2] * b + convert->cmatrix[1][3]) >> SCALE;
+    v = (convert->cmatrix[2][0] * r + convert->cmatrix[2][1] * g +
+        convert->cmatrix[2][2] * b + convert->cmatrix[2][3]) >> SCALE;
+
+    p[i * 4 + 1] = CLAMP (y, 0, 65535);
+    p[i * 4 + 2] = CLAMP (u, 0, 65535);
+    p[i * 4 + 3] = CLAMP (v, 0, 65535);
+  }
+}
+
+/* Simple 4x4 color matrix helpers */
+typedef struct
+{
+  gdouble m[4][4];
+} ColorMatrix;
+
+static void
+color_matrix_set_identity (ColorMatrix * m)
+{
+  gint i, j;
+
+  for (i = 0; i < 4; i++) {
+    for (j = 0; j < 4; j++) {
+      m->m[i][j] = (i == j);
+    }
+  }
+}
+
+/* Perform 4x4 matrix multiplication:
+ *  - @dst@ = @a@ * @b@
+ *  - @dst@ may be a pointer to @a@ andor @b@
+ */
+static void
+color_matrix_multiply (ColorMatrix * dst, ColorMatrix * a, ColorMatrix * b)
+{
+  ColorMatrix tmp;
+  gint i, j, k;
+
+  for (i = 0; i < 4; i++) {
+    for (j = 0; j < 4; j++) {
+      gdouble x = 0;
+      for (k = 0; k < 4; k++) {
+        x += a->m[i][k] * b->m[k][j];
+      }
+      tmp.m[i][j] = x;
+    }
+  }
+
+  memcpy (dst, &tmp, sizeof (ColorMatrix));
+}
+
+static void
+color_matrix_offset_components (ColorMatrix * m, gdouble a1, gdouble a2,
+    gdouble a3)
+{
+  ColorMatrix a;
+
+  color_matrix_set_identity (&a);
+  a.m[0][3] = a1;
+  a.m[1][3] = a2;
+  a.m[2][3] = a3;
+  color_matrix_multiply (m, &a, m);
+}
+
+static void
+color_matrix_scale_components (ColorMatrix * m, gdouble a1, gdouble a2,
+    gdouble a3)
+{
+  ColorMatrix a;
+
+  color_matrix_set_identity (&a);
+  a.m[0][0] = a1;
+  a.m[1][1] = a2;
+  a.m[2][2] = a3;
+  color_matrix_multiply (m, &a, m);
+}
+
+static void
+color_matrix_YCbCr_to_RGB (ColorMatrix * m, gdouble Kr, gdouble Kb)
+{
+  gdouble Kg = 1.0 - Kr - Kb;
+  ColorMatrix k = {
+    {
+          {1., 0., 2 * (1 - Kr), 0.},
+          {1., -2 * Kb * (1 - Kb) / Kg, -2 * Kr * (1 - Kr) / Kg, 0.},
+          {1., 2 * (1 - Kb), 0., 0.},
+          {0., 0., 0., 1.},
+        }
+  };
+
+  color_matrix_multiply (m, &k, m);
+}
+
+static void
+color_matrix_RGB_to_YCbCr (ColorMatrix * m, gdouble Kr, gdouble Kb)
+{
+  gdouble Kg = 1.0 - Kr - Kb;
+  ColorMatrix k;
+  gdouble x;
+
+  k.m[0][0] = Kr;
+  k.m[0][1] = Kg;
+  k.m[0][2] = Kb;
+  k.m[0][3] = 0;
+
+  x = 1 / (2 * (1 - Kb));
+  k.m[1][0] = -x * Kr;
+  k.m[1][1] = -x * Kg;
+  k.m[1][2] = x * (1 - Kb);
+  k.m[1][3] = 0;
+
+  x = 1 / (2 * (1 - Kr));
+  k.m[2][0] = x * (1 - Kr);
+  k.m[2][1] = -x * Kg;
+  k.m[2][2] = -x * Kb;
+  k.m[2][3] = 0;
+
+  k.m[3][0] = 0;
+  k.m[3][1] = 0;
+  k.m[3][2] = 0;
+  k.m[3][3] = 1;
+
+  color_matrix_multiply (m, &k, m);
+}
+
+static gboolean
+get_Kr_Kb (GstVideoColorMatrix matrix, gdouble * Kr, gdouble * Kb)
+{
+  gboolean res = TRUE;
+
+  switch (matrix) {
+      /* RGB */
+    default:
+    case GST_VIDEO_COLOR_MATRIX_RGB:
+      res = FALSE;
+      break;
+      /* YUV */
+    case GST_VIDEO_COLOR_MATRIX_FCC:
+      *Kr = 0.30;
+      *Kb = 0.11;
+      break;
+    case GST_VIDEO_COLOR_MATRIX_BT709:
+      *Kr = 0.2126;
+      *Kb = 0.0722;
+      break;
+    case GST_VIDEO_COLOR_MATRIX_BT601:
+      *Kr = 0.2990;
+      *Kb = 0.1140;
+      break;
+    case GST_VIDEO_COLOR_MATRIX_SMPTE240M:
+      *Kr = 0.212;
+      *Kb = 0.087;
+      break;
+  }
+  GST_DEBUG ("matrix: %d, Kr %f, Kb %f", matrix, *Kr, *Kb);
+  return res;
+}
+
+static gboolean
+video_converter_compute_matrix (GstVideoConverter * convert)
+{
+  GstVideoInfo *in_info, *out_info;
+  ColorMatrix dst;
+  gint i, j;
+  const GstVideoFormatInfo *sfinfo, *dfinfo;
+  const GstVideoFormatInfo *suinfo, *duinfo;
+  gint offset[4], scale[4];
+  gdouble Kr = 0, Kb = 0;
+
+  in_info = &convert->in_info;
+  out_info = &convert->out_info;
+
+  sfinfo = in_info->finfo;
+  dfinfo = out_info->finfo;
+
+  if (sfinfo->unpack_func == NULL)
+    goto no_unpack_func;
+
+  if (dfinfo->pack_func == NULL)
+    goto no_pack_func;
+
+  suinfo = gst_video_format_get_info (sfinfo->unpack_format);
+  duinfo = gst_video_format_get_info (dfinfo->unpack_format);
+
+  convert->in_bits = GST_VIDEO_FORMAT_INFO_DEPTH (suinfo, 0);
+  convert->out_bits = GST_VIDEO_FORMAT_INFO_DEPTH (duinfo, 0);
+
+  GST_DEBUG ("in bits %d, out bits %d", convert->in_bits, convert->out_bits);
+
+  if (in_info->colorimetry.range == out_info->colorimetry.range &&
+      in_info->colorimetry.matrix == out_info->colorimetry.matrix) {
+    GST_DEBUG ("using identity color transform");
+    convert->matrix = NULL;
+    return TRUE;
+  }
+
+  /* calculate intermediate format for the matrix. When unpacking, we expand
+   * input to 16 when one of the inputs is 16 bits */
+  if (convert->in_bits == 16 || convert->out_bits == 16) {
+    convert->matrix = video_converter_matrix16;
+
+    if (GST_VIDEO_FORMAT_INFO_IS_RGB (suinfo))
+      suinfo = gst_video_format_get_info (GST_VIDEO_FORMAT_ARGB64);
+    else
+      suinfo = gst_video_format_get_info (GST_VIDEO_FORMAT_AYUV64);
+
+    if (GST_VIDEO_FORMAT_INFO_IS_RGB (duinfo))
+      duinfo = gst_video_format_get_info (GST_VIDEO_FORMAT_ARGB64);
+    else
+      duinfo = gst_video_format_get_info (GST_VIDEO_FORMAT_AYUV64);
+  } else {
+    convert->matrix = video_converter_matrix8;
+  }
+
+  color_matrix_set_identity (&dst);
+
+  /* 1, bring color components to [0..1.0] range */
+  gst_video_color_range_offsets (in_info->colorimetry.range, suinfo, offset,
+      scale);
+  color_matrix_offset_components (&dst, -offset[0], -offset[1], -offset[2]);
+
+  color_matrix_scale_components (&dst, 1 / ((float) scale[0]),
+      1 / ((float) scale[1]), 1 / ((float) scale[2]));
+
+  /* 2. bring components to R'G'B' space */
+  if (get_Kr_Kb (in_info->colorimetry.matrix, &Kr, &Kb))
+    color_matrix_YCbCr_to_RGB (&dst, Kr, Kb);
+
+  /* 3. inverse transfer function. R'G'B' to linear RGB */
+
+  /* 4. from RGB to XYZ using the primaries */
+
+  /* 5. from XYZ to RGB using the primaries */
+
+  /* 6. transfer function. linear RGB to R'G'B' */
+
+  /* 7. bring components to YCbCr space */
+  if (get_Kr_Kb (out_info->colorimetry.matrix, &Kr, &Kb))
+    color_matrix_RGB_to_YCbCr (&dst, Kr, Kb);
+
+  /* 8, bring color components to nominal range */
+  gst_video_color_range_offsets (out_info->colorimetry.range, duinfo, offset,
+      scale);
+  color_matrix_scale_components (&dst, (float) scale[0], (float) scale[1],
+      (float) scale[2]);
+
+  color_matrix_offset_components (&dst, offset[0], offset[1], offset[2]);
+
+  /* because we're doing fixed point matrix coefficients */
+  color_matrix_scale_components (&dst, SCALE_F, SCALE_F, SCALE_F);
+
+  for (i = 0; i < 4; i++)
+    for (j = 0; j < 4; j++)
+      convert->cmatrix[i][j] = rint (dst.m[i][j]);
+
+  GST_DEBUG ("[%6d %6d %6d %6d]", convert->cmatrix[0][0],
+      convert->cmatrix[0][1], convert->cmatrix[0][2], convert->cmatrix[0][3]);
+  GST_DEBUG ("[%6d %6d %6d %6d]", convert->cmatrix[1][0],
+      convert->cmatrix[1][1], convert->cmatrix[1][2], convert->cmatrix[1][3]);
+  GST_DEBUG ("[%6d %6d %6d %6d]", convert->cmatrix[2][0],
+      convert->cmatrix[2][1], convert->cmatrix[2][2], convert->cmatrix[2][3]);
+  GST_DEBUG ("[%6d %6d %6d %6d]", convert->cmatrix[3][0],
+      convert->cmatrix[3][1], convert->cmatrix[3][2], convert->cmatrix[3][3]);
+
+  if (convert->matrix == video_converter_matrix8 &&
+      video_converter_prepare_matrix8_orc (convert)) {
+    GST_DEBUG ("using orc 8 bits matrix");
+    convert->matrix = video_converter_matrix8_orc;
+  }
+
+  return TRUE;
+
+  /* ERRORS */
+no_unpack_func:
+  {
+    GST_ERROR ("no unpack_func for format %s",
+        gst_video_format_to_string (GST_VIDEO_INFO_FORMAT (in_info)));
+    return FALSE;
+  }
+no_pack_func:
+  {
+    GST_ERROR ("no pack_func for format %s",
+        gst_video_format_to_string (GST_VIDEO_INFO_FORMAT (out_info)));
+    return FALSE;
+  }
+}
+
+static void
+video_converter_dither_verterr (GstVideoConverter * convert, guint16 * pixels,
+    guint16 * errline, gint width, int j)
+{
+  video_orc_dither_verterr_4u16 (pixels, errline, convert->dither_mask, width);
+}
+
+/* the pattern lines start at the first pixel of a tile, which is fine because
+ * TILE_WIDTH is a multiple of the pattern width */
+static void
+video_converter_dither_ordered (GstVideoConverter * convert, guint16 * pixels,
+    guint16 * errline, gint width, int j)
+{
+  guint16 *line;
+
+  line = convert->dither_lines +
+      (j & (convert->dither_n_lines - 1)) * TILE_WIDTH * 4;
+  video_orc_dither_ordered_4u16 (pixels, line, width);
+}
+
+static gboolean
+video_converter_compute_resample (GstVideoConverter * convert)
+{
+  GstVideoInfo *in_info, *out_info;
+  const GstVideoFormatInfo *sfinfo, *dfinfo;
+  gint lines;
+  gint width;
+
+  in_info = &convert->in_info;
+  out_info = &convert->out_info;
+
+  sfinfo = in_info->finfo;
+  dfinfo = out_info->finfo;
+
+  width = convert->width;
+
+  convert->upsample = gst_video_chroma_resample_new (0,
+      in_info->chroma_site, 0, sfinfo->unpack_format, sfinfo->w_sub[2],
+      sfinfo->h_sub[2]);
+  if (convert->upsample) {
+    gst_video_chroma_resample_get_info (convert->upsample,
+        &convert->up_n_lines, &convert->up_offset);
+  } else {
+    convert->up_n_lines = 1;
+    convert->up_offset = 0;
+  }
+  GST_DEBUG ("upsample: %p, offset %d, n_lines %d", convert->upsample,
+      convert->up_offset, convert->up_n_lines);
+
+  convert->downsample = gst_video_chroma_resample_new (0,
+      out_info->chroma_site, 0, dfinfo->unpack_format, -dfinfo->w_sub[2],
+      -dfinfo->h_sub[2]);
+  if (convert->downsample) {
+    gst_video_chroma_resample_get_info (convert->downsample,
+        &convert->down_n_lines, &convert->down_offset);
+  } else {
+    convert->down_n_lines = 1;
+    convert->down_offset = 0;
+  }
+
+  GST_DEBUG ("downsample: %p, offset %d, n_lines %d", convert->downsample,
+      convert->down_offset, convert->down_n_lines);
+
+  lines = MAX (convert->down_n_lines, convert->up_n_lines);
+
+  convert->n_tmplines = lines;
+  convert->tmplines = video_converter_alloc_tmplines (lines, width);
+
+  return TRUE;
+}
+
+#define TO_16(x) (((x)<<8) | (x))
+
+/* both can work in place, to16 goes backwards and to8 forwards */
+static void
+convert_to16 (guint16 * line16, const guint8 * line8, gint width)
+{
+  gint i;
+
+  for (i = width * 4 - 1; i >= 0; i--)
+    line16[i] = TO_16 (line8[i]);
+}
+
+static void
+convert_to8 (guint8 * line8, const guint16 * line16, gint width)
+{
+  gint i;
+
+  for (i = 0; i < width * 4; i++)
+    line8[i] = line16[i] >> 8;
+}
+
+/* expands @line to 16 bits when needed, applies the matrix and dither and
+ * packs back to 8 bits when needed, all in place and one tile at a time */
+static void
+video_converter_line16 (GstVideoConverter * convert, gpointer line,
+    guint16 * errline, gint y)
+{
+  guint8 *line8 = line;
+  guint16 *line16 = line;
+  gint t, i, x, w, width, n_tiles;
+  guint in_bits, out_bits;
+
+  width = convert->width;
+  in_bits = convert->in_bits;
+  out_bits = convert->out_bits;
+
+  n_tiles = (width + TILE_WIDTH - 1) / TILE_WIDTH;
+
+  for (i = 0; i < n_tiles; i++) {
+    /* when expanding to 16 bits we must go backwards so that we never
+     * overwrite the 8 bits pixels of a tile that was not handled yet, when
+     * packing to 8 bits we must go forwards for the same reason */
+    t = (in_bits == 8) ? n_tiles - 1 - i : i;
+    x = t * TILE_WIDTH;
+    w = MIN (TILE_WIDTH, width - x);
+
+    /* FIXME, we can scale in the conversion matrix */
+    if (in_bits == 8)
+      convert_to16 (line16 + x * 4, line8 + x * 4, w);
+
+    if (convert->matrix)
+      convert->matrix (convert, line16 + x * 4, w);
+    if (convert->dither16)
+      convert->dither16 (convert, line16 + x * 4, errline + x * 4, w, y);
+
+    if (out_bits == 8)
+      convert_to8 (line8 + x * 4, line16 + x * 4, w);
+  }
+}
+
+#define UNPACK_FRAME(frame,dest,line,width)          \
+  frame->info.finfo->unpack_func (frame->info.finfo, \
+      (GST_VIDEO_FRAME_IS_INTERLACED (frame) ?       \
+        GST_VIDEO_PACK_FLAG_INTERLACED :             \
+        GST_VIDEO_PACK_FLAG_NONE),                   \
+      dest, frame->data, frame->info.stride, 0,      \
+      line, width)
+#define PACK_FRAME(frame,dest,line,width)            \
+  frame->info.finfo->pack_func (frame->info.finfo,   \
+      (GST_VIDEO_FRAME_IS_INTERLACED (frame) ?       \
+        GST_VIDEO_PACK_FLAG_INTERLACED :             \
+        GST_VIDEO_PACK_FLAG_NONE),                   \
+      dest, 0, frame->data, frame->info.stride,      \
+      frame->info.chroma_site, line, width);
+
+/* converts the lines from @y_start to @y_end. Lines outside of this range are
+ * unpacked when the chroma resampler needs them but they are never packed,
+ * @y_start must be a multiple of slice_align */
+static void
+video_converter_generic_lines (GstVideoConverter * convert,
+    GstVideoFrame * dest, const GstVideoFrame * src, gint y_start, gint y_end,
+    gpointer * tmplines, guint16 * errline)
+{
+  int j, k;
+  gint width, height, max_lines;
+  guint in_bits, out_bits;
+  guint up_n_lines, down_n_lines;
+  gint up_offset, down_offset;
+  gint in_lines, out_lines;
+  gint up_line, down_line;
+  gint start_offset, stop_offset;
+  gpointer in_tmplines[8];
+  gpointer out_tmplines[8];
+
+  height = convert->height;
+  width = convert->width;
+
+  in_bits = convert->in_bits;
+  out_bits = convert->out_bits;
+
+  up_n_lines = convert->up_n_lines;
+  up_offset = convert->up_offset + y_start;
+  down_n_lines = convert->down_n_lines;
+  down_offset = convert->down_offset + y_start;
+  max_lines = MAX (down_n_lines, up_n_lines);
+
+  in_lines = 0;
+  out_lines = 0;
+
+  GST_DEBUG ("up_offset %d, up_n_lines %u", up_offset, up_n_lines);
+
+  start_offset = MIN (up_offset, down_offset);
+  stop_offset = y_end + MIN (convert->up_offset, convert->down_offset) +
+      MAX (up_n_lines, down_n_lines);
+
+  for (; start_offset < stop_offset; start_offset++) {
+    guint idx, start;
+
+    idx = CLAMP (start_offset, 0, height);
+    in_tmplines[in_lines] = tmplines[idx % max_lines];
+    out_tmplines[out_lines] = in_tmplines[in_lines];
+    GST_DEBUG ("start_offset %d, %d, idx %u, in %d, out %d", start_offset,
+        up_offset, idx, in_lines, out_lines);
+
+    up_line = up_offset + in_lines;
+
+    /* extract the next line */
+    if (up_line >= 0 && up_line < height) {
+      GST_DEBUG ("unpack line %d", up_line);
+      UNPACK_FRAME (src, in_tmplines[in_lines], up_line, width);
+    }
+
+    if (start_offset >= up_offset)
+      in_lines++;
+
+    if (start_offset >= down_offset)
+      out_lines++;
+
+    if (in_lines < up_n_lines)
+      continue;
+
+    in_lines = 0;
+
+    /* we have enough lines to upsample */
+    if (convert->upsample) {
+      GST_DEBUG ("doing upsample");
+      gst_video_chroma_resample (convert->upsample, in_tmplines, width);
+    }
+
+    /* convert upsampled lines */
+    for (k = 0; k < up_n_lines; k++) {
+      down_line = up_offset + k;
+
+      /* only takes lines with valid output */
+      if (down_line < y_start || down_line >= y_end)
+        continue;
+
+      GST_DEBUG ("handle line %d, %d/%d, down_line %d", k, out_lines,
+          down_n_lines, down_line);
+
+      if (out_bits == 16 || in_bits == 16) {
+        video_converter_line16 (convert, in_tmplines[k], errline,
+            down_line);
+      } else {
+        if (convert->matrix)
+          convert->matrix (convert, in_tmplines[k], width);
+      }
+    }
+
+    start = 0;
+    while (out_lines >= down_n_lines) {
+      GST_DEBUG ("doing downsample %u", start);
+      if (convert->downsample)
+        gst_video_chroma_resample (convert->downsample,
+            &out_tmplines[start], width);
+
+      for (j = 0; j < down_n_lines; j++) {
+        idx = down_offset + j;
+
+        if (idx >= y_start && idx < y_end) {
+          GST_DEBUG ("packing line %d %d %d", j + start, down_offset, idx);
+          PACK_FRAME (dest, out_tmplines[j + start], idx, width);
+        }
+      }
+      down_offset += down_n_lines;
+      start += down_n_lines;
+      out_lines -= down_n_lines;
+    }
+    up_offset += up_n_lines;
+  }
+}
+
+static void
+video_converter_copy_palette (GstVideoFrame * dest)
+{
+  gconstpointer pal;
+  gsize palsize;
+
+  if ((pal =
+          gst_video_format_get_palette (GST_VIDEO_FRAME_FORMAT (dest),
+              &palsize))) {
+    memcpy (GST_VIDEO_FRAME_PLANE_DATA (dest, 1), pal, palsize);
+  }
+}
+
+static void
+video_converter_generic (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  video_converter_generic_lines (convert, dest, src, 0, convert->height,
+      convert->tmplines, convert->errline);
+  video_converter_copy_palette (dest);
+}
+
+/* makes @sub point to the lines of @frame starting at @line */
+static void
+video_converter_get_sub_frame (GstVideoFrame * sub, const GstVideoFrame * frame,
+    gint line)
+{
+  const GstVideoFormatInfo *finfo = frame->info.finfo;
+  gboolean done[GST_VIDEO_MAX_PLANES] = { FALSE, };
+  gint i, plane;
+
+  *sub = *frame;
+
+  for (i = 0; i < GST_VIDEO_FORMAT_INFO_N_COMPONENTS (finfo); i++) {
+    plane = GST_VIDEO_FORMAT_INFO_PLANE (finfo, i);
+    if (done[plane])
+      continue;
+
+    if (GST_VIDEO_FORMAT_INFO_IS_TILED (finfo)) {
+      gint stride = GST_VIDEO_FRAME_PLANE_STRIDE (frame, plane);
+      gint ws = GST_VIDEO_FORMAT_INFO_TILE_WS (finfo);
+      gint hs = GST_VIDEO_FORMAT_INFO_TILE_HS (finfo);
+      gint rows = GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (finfo, i, line) >> hs;
+
+      /* skip complete rows of tiles, the slice alignment makes sure that we
+       * skip an even number of rows so that the tile order of the remaining
+       * rows does not change */
+      sub->data[plane] = (guint8 *) frame->data[plane] +
+          ((gsize) rows * GST_VIDEO_TILE_X_TILES (stride) << (ws + hs));
+      sub->info.stride[plane] =
+          GST_VIDEO_TILE_MAKE_STRIDE (GST_VIDEO_TILE_X_TILES (stride),
+          GST_VIDEO_TILE_Y_TILES (stride) - rows);
+    } else {
+      sub->data[plane] = (guint8 *) frame->data[plane] +
+          GST_VIDEO_FRAME_PLANE_STRIDE (frame, plane) *
+          GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (finfo, i, line);
+    }
+    done[plane] = TRUE;
+  }
+}
+
+static void
+video_converter_task (VideoConverterTask * task)
+{
+  GstVideoConverter *convert = task->convert;
+
+  if (convert->convert == video_converter_generic) {
+    video_converter_generic_lines (convert, task->dest, task->src,
+        task->y_start, task->y_end, task->tmplines, task->errline);
+  } else {
+    GstVideoFrame src, dest;
+    GstVideoConverter slice;
+
+    /* fastpaths don't look at neighbouring lines outside of the chroma
+     * subsampling so we can run them on a frame with only the lines of
+     * the slice. The copy of the converter is only used for the size and
+     * the temp lines. */
+    video_converter_get_sub_frame (&src, task->src, task->y_start);
+    video_converter_get_sub_frame (&dest, task->dest, task->y_start);
+
+    slice = *convert;
+    slice.height = task->y_end - task->y_start;
+    slice.tmplines = task->tmplines;
+    slice.errline = task->errline;
+
+    convert->convert (&slice, &dest, &src);
+  }
+}
+
+#define FRAME_GET_PLANE_STRIDE(frame, plane) \
+  GST_VIDEO_FRAME_PLANE_STRIDE (frame, plane)
+#define FRAME_GET_PLANE_LINE(frame, plane, line) \
+  (gpointer)(((guint8*)(GST_VIDEO_FRAME_PLANE_DATA (frame, plane))) + \
+      FRAME_GET_PLANE_STRIDE (frame, plane) * (line))
+
+#define FRAME_GET_COMP_STRIDE(frame, comp) \
+  GST_VIDEO_FRAME_COMP_STRIDE (frame, comp)
+#define FRAME_GET_COMP_LINE(frame, comp, line) \
+  (gpointer)(((guint8*)(GST_VIDEO_FRAME_COMP_DATA (frame, comp))) + \
+      FRAME_GET_COMP_STRIDE (frame, comp) * (line))
+
+#define FRAME_GET_STRIDE(frame)      FRAME_GET_PLANE_STRIDE (frame, 0)
+#define FRAME_GET_LINE(frame,line)   FRAME_GET_PLANE_LINE (frame, 0, line)
+
+#define FRAME_GET_Y_LINE(frame,line) FRAME_GET_COMP_LINE(frame, GST_VIDEO_COMP_Y, line)
+#define FRAME_GET_U_LINE(frame,line) FRAME_GET_COMP_LINE(frame, GST_VIDEO_COMP_U, line)
+#define FRAME_GET_V_LINE(frame,line) FRAME_GET_COMP_LINE(frame, GST_VIDEO_COMP_V, line)
+#define FRAME_GET_A_LINE(frame,line) FRAME_GET_COMP_LINE(frame, GST_VIDEO_COMP_A, line)
+
+#define FRAME_GET_Y_STRIDE(frame)    FRAME_GET_COMP_STRIDE(frame, GST_VIDEO_COMP_Y)
+#define FRAME_GET_U_STRIDE(frame)    FRAME_GET_COMP_STRIDE(frame, GST_VIDEO_COMP_U)
+#define FRAME_GET_V_STRIDE(frame)    FRAME_GET_COMP_STRIDE(frame, GST_VIDEO_COMP_V)
+#define FRAME_GET_A_STRIDE(frame)    FRAME_GET_COMP_STRIDE(frame, GST_VIDEO_COMP_A)
+
+/* Fast paths */
+
+#define GET_LINE_OFFSETS(interlaced,line,l1,l2) \
+    if (interlaced) {                           \
+      l1 = (line & 2 ? line - 1 : line);        \
+      l2 = l1 + 2;                              \
+    } else {                                    \
+      l1 = line;                                \
+      l2 = l1 + 1;                              \
+    }
+
+
+static void
+convert_I420_YUY2 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i;
+  gint width = convert->width;
+  gint height = convert->height;
+  gboolean interlaced = GST_VIDEO_FRAME_IS_INTERLACED (src);
+  gint l1, l2;
+
+  for (i = 0; i < GST_ROUND_DOWN_2 (height); i += 2) {
+    GET_LINE_OFFSETS (interlaced, i, l1, l2);
+
+    video_orc_convert_I420_YUY2 (FRAME_GET_LINE (dest, l1),
+        FRAME_GET_LINE (dest, l2),
+        FRAME_GET_Y_LINE (src, l1),
+        FRAME_GET_Y_LINE (src, l2),
+        FRAME_GET_U_LINE (src, i >> 1),
+        FRAME_GET_V_LINE (src, i >> 1), (width + 1) / 2);
+  }
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_I420_UYVY (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i;
+  gint width = convert->width;
+  gint height = convert->height;
+  gboolean interlaced = GST_VIDEO_FRAME_IS_INTERLACED (src);
+  gint l1, l2;
+
+  for (i = 0; i < GST_ROUND_DOWN_2 (height); i += 2) {
+    GET_LINE_OFFSETS (interlaced, i, l1, l2);
+
+    video_orc_convert_I420_UYVY (FRAME_GET_LINE (dest, l1),
+        FRAME_GET_LINE (dest, l2),
+        FRAME_GET_Y_LINE (src, l1),
+        FRAME_GET_Y_LINE (src, l2),
+        FRAME_GET_U_LINE (src, i >> 1),
+        FRAME_GET_V_LINE (src, i >> 1), (width + 1) / 2);
+  }
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_I420_AYUV (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i;
+  gint width = convert->width;
+  gint height = convert->height;
+  gboolean interlaced = GST_VIDEO_FRAME_IS_INTERLACED (src);
+  gint l1, l2;
+
+  for (i = 0; i < GST_ROUND_DOWN_2 (height); i += 2) {
+    GET_LINE_OFFSETS (interlaced, i, l1, l2);
+
+    video_orc_convert_I420_AYUV (FRAME_GET_LINE (dest, l1),
+        FRAME_GET_LINE (dest, l2),
+        FRAME_GET_Y_LINE (src, l1),
+        FRAME_GET_Y_LINE (src, l2),
+        FRAME_GET_U_LINE (src, i >> 1), FRAME_GET_V_LINE (src, i >> 1), width);
+  }
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_I420_Y42B (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_memcpy_2d (FRAME_GET_Y_LINE (dest, 0),
+      FRAME_GET_Y_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), width, height);
+
+  video_orc_planar_chroma_420_422 (FRAME_GET_U_LINE (dest, 0),
+      2 * FRAME_GET_U_STRIDE (dest), FRAME_GET_U_LINE (dest, 1),
+      2 * FRAME_GET_U_STRIDE (dest), FRAME_GET_U_LINE (src, 0),
+      FRAME_GET_U_STRIDE (src), (width + 1) / 2, height / 2);
+
+  video_orc_planar_chroma_420_422 (FRAME_GET_V_LINE (dest, 0),
+      2 * FRAME_GET_V_STRIDE (dest), FRAME_GET_V_LINE (dest, 1),
+      2 * FRAME_GET_V_STRIDE (dest), FRAME_GET_V_LINE (src, 0),
+      FRAME_GET_V_STRIDE (src), (width + 1) / 2, height / 2);
+}
+
+static void
+convert_I420_Y444 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_memcpy_2d (FRAME_GET_Y_LINE (dest, 0),
+      FRAME_GET_Y_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), width, height);
+
+  video_orc_planar_chroma_420_444 (FRAME_GET_U_LINE (dest, 0),
+      2 * FRAME_GET_U_STRIDE (dest), FRAME_GET_U_LINE (dest, 1),
+      2 * FRAME_GET_U_STRIDE (dest), FRAME_GET_U_LINE (src, 0),
+      FRAME_GET_U_STRIDE (src), (width + 1) / 2, height / 2);
+
+  video_orc_planar_chroma_420_444 (FRAME_GET_V_LINE (dest, 0),
+      2 * FRAME_GET_V_STRIDE (dest), FRAME_GET_V_LINE (dest, 1),
+      2 * FRAME_GET_V_STRIDE (dest), FRAME_GET_V_LINE (src, 0),
+      FRAME_GET_V_STRIDE (src), (width + 1) / 2, height / 2);
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_YUY2_I420 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i, h;
+  gint width = convert->width;
+  gint height = convert->height;
+  gboolean interlaced = GST_VIDEO_FRAME_IS_INTERLACED (src);
+  gint l1, l2;
+
+  h = height;
+  if (width & 1)
+    h--;
+
+  for (i = 0; i < h; i += 2) {
+    GET_LINE_OFFSETS (interlaced, i, l1, l2);
+
+    video_orc_convert_YUY2_I420 (FRAME_GET_Y_LINE (dest, l1),
+        FRAME_GET_Y_LINE (dest, l2),
+        FRAME_GET_U_LINE (dest, i >> 1),
+        FRAME_GET_V_LINE (dest, i >> 1),
+        FRAME_GET_LINE (src, l1), FRAME_GET_LINE (src, l2), (width + 1) / 2);
+  }
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_YUY2_AYUV (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_YUY2_AYUV (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), (width + 1) / 2,
+      height & 1 ? height - 1 : height);
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_YUY2_Y42B (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_YUY2_Y42B (FRAME_GET_Y_LINE (dest, 0),
+      FRAME_GET_Y_STRIDE (dest), FRAME_GET_U_LINE (dest, 0),
+      FRAME_GET_U_STRIDE (dest), FRAME_GET_V_LINE (dest, 0),
+      FRAME_GET_V_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), (width + 1) / 2, height);
+}
+
+static void
+convert_YUY2_Y444 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_YUY2_Y444 (FRAME_GET_COMP_LINE (dest, 0, 0),
+      FRAME_GET_COMP_STRIDE (dest, 0), FRAME_GET_COMP_LINE (dest, 1, 0),
+      FRAME_GET_COMP_STRIDE (dest, 1), FRAME_GET_COMP_LINE (dest, 2, 0),
+      FRAME_GET_COMP_STRIDE (dest, 2), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), (width + 1) / 2, height);
+}
+
+
+static void
+convert_UYVY_I420 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i;
+  gint width = convert->width;
+  gint height = convert->height;
+  gboolean interlaced = GST_VIDEO_FRAME_IS_INTERLACED (src);
+  gint l1, l2;
+
+  for (i = 0; i < GST_ROUND_DOWN_2 (height); i += 2) {
+    GET_LINE_OFFSETS (interlaced, i, l1, l2);
+
+    video_orc_convert_UYVY_I420 (FRAME_GET_COMP_LINE (dest, 0, l1),
+        FRAME_GET_COMP_LINE (dest, 0, l2),
+        FRAME_GET_COMP_LINE (dest, 1, i >> 1),
+        FRAME_GET_COMP_LINE (dest, 2, i >> 1),
+        FRAME_GET_LINE (src, l1), FRAME_GET_LINE (src, l2), (width + 1) / 2);
+  }
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_UYVY_AYUV (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_UYVY_AYUV (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), (width + 1) / 2,
+      height & 1 ? height - 1 : height);
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_UYVY_YUY2 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_UYVY_YUY2 (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), (width + 1) / 2, height);
+}
+
+static void
+convert_UYVY_Y42B (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_UYVY_Y42B (FRAME_GET_Y_LINE (dest, 0),
+      FRAME_GET_Y_STRIDE (dest), FRAME_GET_U_LINE (dest, 0),
+      FRAME_GET_U_STRIDE (dest), FRAME_GET_V_LINE (dest, 0),
+      FRAME_GET_V_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), (width + 1) / 2, height);
+}
+
+static void
+convert_UYVY_Y444 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_UYVY_Y444 (FRAME_GET_Y_LINE (dest, 0),
+      FRAME_GET_Y_STRIDE (dest), FRAME_GET_U_LINE (dest, 0),
+      FRAME_GET_U_STRIDE (dest), FRAME_GET_V_LINE (dest, 0),
+      FRAME_GET_V_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), (width + 1) / 2, height);
+}
+
+static void
+convert_AYUV_I420 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_AYUV_I420 (FRAME_GET_Y_LINE (dest, 0),
+      2 * FRAME_GET_Y_STRIDE (dest), FRAME_GET_Y_LINE (dest, 1),
+      2 * FRAME_GET_Y_STRIDE (dest), FRAME_GET_U_LINE (dest, 0),
+      FRAME_GET_U_STRIDE (dest), FRAME_GET_V_LINE (dest, 0),
+      FRAME_GET_V_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      2 * FRAME_GET_STRIDE (src), FRAME_GET_LINE (src, 1),
+      2 * FRAME_GET_STRIDE (src), width / 2, height / 2);
+}
+
+static void
+convert_AYUV_YUY2 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_AYUV_YUY2 (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), width / 2, height);
+}
+
+static void
+convert_AYUV_UYVY (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_AYUV_UYVY (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), width / 2, height);
+}
+
+static void
+convert_AYUV_Y42B (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_AYUV_Y42B (FRAME_GET_Y_LINE (dest, 0),
+      FRAME_GET_Y_STRIDE (dest), FRAME_GET_U_LINE (dest, 0),
+      FRAME_GET_U_STRIDE (dest), FRAME_GET_V_LINE (dest, 0),
+      FRAME_GET_V_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), (width + 1) / 2,
+      height & 1 ? height - 1 : height);
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_AYUV_Y444 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_AYUV_Y444 (FRAME_GET_Y_LINE (dest, 0),
+      FRAME_GET_Y_STRIDE (dest), FRAME_GET_U_LINE (dest, 0),
+      FRAME_GET_U_STRIDE (dest), FRAME_GET_V_LINE (dest, 0),
+      FRAME_GET_V_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), width, height);
+}
+
+static void
+convert_Y42B_I420 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_memcpy_2d (FRAME_GET_Y_LINE (dest, 0),
+      FRAME_GET_Y_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), width, height);
+
+  video_orc_planar_chroma_422_420 (FRAME_GET_U_LINE (dest, 0),
+      FRAME_GET_U_STRIDE (dest), FRAME_GET_U_LINE (src, 0),
+      2 * FRAME_GET_U_STRIDE (src), FRAME_GET_U_LINE (src, 1),
+      2 * FRAME_GET_U_STRIDE (src), (width + 1) / 2, height / 2);
+
+  video_orc_planar_chroma_422_420 (FRAME_GET_V_LINE (dest, 0),
+      FRAME_GET_V_STRIDE (dest), FRAME_GET_V_LINE (src, 0),
+      2 * FRAME_GET_V_STRIDE (src), FRAME_GET_V_LINE (src, 1),
+      2 * FRAME_GET_V_STRIDE (src), (width + 1) / 2, height / 2);
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_Y42B_Y444 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_memcpy_2d (FRAME_GET_Y_LINE (dest, 0),
+      FRAME_GET_Y_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), width, height);
+
+  video_orc_planar_chroma_422_444 (FRAME_GET_U_LINE (dest, 0),
+      FRAME_GET_U_STRIDE (dest), FRAME_GET_U_LINE (src, 0),
+      FRAME_GET_U_STRIDE (src), (width + 1) / 2, height);
+
+  video_orc_planar_chroma_422_444 (FRAME_GET_V_LINE (dest, 0),
+      FRAME_GET_V_STRIDE (dest), FRAME_GET_V_LINE (src, 0),
+      FRAME_GET_V_STRIDE (src), (width + 1) / 2, height);
+}
+
+static void
+convert_Y42B_YUY2 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_Y42B_YUY2 (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), FRAME_GET_U_LINE (src, 0),
+      FRAME_GET_U_STRIDE (src), FRAME_GET_V_LINE (src, 0),
+      FRAME_GET_V_STRIDE (src), (width + 1) / 2, height);
+}
+
+static void
+convert_Y42B_UYVY (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_Y42B_UYVY (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), FRAME_GET_U_LINE (src, 0),
+      FRAME_GET_U_STRIDE (src), FRAME_GET_V_LINE (src, 0),
+      FRAME_GET_V_STRIDE (src), (width + 1) / 2, height);
+}
+
+static void
+convert_Y42B_AYUV (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_Y42B_AYUV (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), FRAME_GET_U_LINE (src, 0),
+      FRAME_GET_U_STRIDE (src), FRAME_GET_V_LINE (src, 0),
+      FRAME_GET_V_STRIDE (src), (width) / 2, height);
+}
+
+static void
+convert_Y444_I420 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_memcpy_2d (FRAME_GET_Y_LINE (dest, 0),
+      FRAME_GET_Y_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), width, height);
+
+  video_orc_planar_chroma_444_420 (FRAME_GET_U_LINE (dest, 0),
+      FRAME_GET_U_STRIDE (dest), FRAME_GET_U_LINE (src, 0),
+      2 * FRAME_GET_U_STRIDE (src), FRAME_GET_U_LINE (src, 1),
+      2 * FRAME_GET_U_STRIDE (src), (width + 1) / 2, height / 2);
+
+  video_orc_planar_chroma_444_420 (FRAME_GET_V_LINE (dest, 0),
+      FRAME_GET_V_STRIDE (dest), FRAME_GET_V_LINE (src, 0),
+      2 * FRAME_GET_V_STRIDE (src), FRAME_GET_V_LINE (src, 1),
+      2 * FRAME_GET_V_STRIDE (src), (width + 1) / 2, height / 2);
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_Y444_Y42B (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_memcpy_2d (FRAME_GET_Y_LINE (dest, 0),
+      FRAME_GET_Y_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), width, height);
+
+  video_orc_planar_chroma_444_422 (FRAME_GET_U_LINE (dest, 0),
+      FRAME_GET_U_STRIDE (dest), FRAME_GET_U_LINE (src, 0),
+      FRAME_GET_U_STRIDE (src), (width + 1) / 2, height);
+
+  video_orc_planar_chroma_444_422 (FRAME_GET_V_LINE (dest, 0),
+      FRAME_GET_V_STRIDE (dest), FRAME_GET_V_LINE (src, 0),
+      FRAME_GET_V_STRIDE (src), (width + 1) / 2, height);
+}
+
+static void
+convert_Y444_YUY2 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_Y444_YUY2 (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), FRAME_GET_U_LINE (src, 0),
+      FRAME_GET_U_STRIDE (src), FRAME_GET_V_LINE (src, 0),
+      FRAME_GET_V_STRIDE (src), (width + 1) / 2, height);
+}
+
+static void
+convert_Y444_UYVY (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_Y444_UYVY (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), FRAME_GET_U_LINE (src, 0),
+      FRAME_GET_U_STRIDE (src), FRAME_GET_V_LINE (src, 0),
+      FRAME_GET_V_STRIDE (src), (width + 1) / 2, height);
+}
+
+static void
+convert_Y444_AYUV (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_Y444_AYUV (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_Y_LINE (src, 0),
+      FRAME_GET_Y_STRIDE (src), FRAME_GET_U_LINE (src, 0),
+      FRAME_GET_U_STRIDE (src), FRAME_GET_V_LINE (src, 0),
+      FRAME_GET_V_STRIDE (src), width, height);
+}
+
+static void
+convert_NV12_UYVY (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i;
+  gint width = convert->width;
+  gint height = convert->height;
+  gboolean interlaced = GST_VIDEO_FRAME_IS_INTERLACED (src);
+  gint l1, l2;
+
+  for (i = 0; i < GST_ROUND_DOWN_2 (height); i += 2) {
+    GET_LINE_OFFSETS (interlaced, i, l1, l2);
+
+    video_orc_convert_NV12_UYVY (FRAME_GET_LINE (dest, l1),
+        FRAME_GET_LINE (dest, l2),
+        FRAME_GET_Y_LINE (src, l1),
+        FRAME_GET_Y_LINE (src, l2),
+        FRAME_GET_U_LINE (src, i >> 1), (width + 1) / 2);
+  }
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+static void
+convert_UYVY_NV12 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i;
+  gint width = convert->width;
+  gint height = convert->height;
+  gboolean interlaced = GST_VIDEO_FRAME_IS_INTERLACED (src);
+  gint l1, l2;
+
+  for (i = 0; i < GST_ROUND_DOWN_2 (height); i += 2) {
+    GET_LINE_OFFSETS (interlaced, i, l1, l2);
+
+    video_orc_convert_UYVY_NV12 (FRAME_GET_Y_LINE (dest, l1),
+        FRAME_GET_Y_LINE (dest, l2),
+        FRAME_GET_U_LINE (dest, i >> 1),
+        FRAME_GET_LINE (src, l1), FRAME_GET_LINE (src, l2), (width + 1) / 2);
+  }
+
+  /* now handle last line */
+  if (height & 1) {
+    UNPACK_FRAME (src, convert->tmplines[0], height - 1, width);
+    PACK_FRAME (dest, convert->tmplines[0], height - 1, width);
+  }
+}
+
+/* copies the tiles of an NV12_64Z32 frame to the linear planes of @dest, the
+ * UV tiles are split into the U and V planes for I420 */
+static void
+convert_NV12_64Z32_planes (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src, gboolean split_uv)
+{
+  const GstVideoFormatInfo *finfo = src->info.finfo;
+  GstVideoTileMode mode = GST_VIDEO_FORMAT_INFO_TILE_MODE (finfo);
+  gint ws = GST_VIDEO_FORMAT_INFO_TILE_WS (finfo);
+  gint hs = GST_VIDEO_FORMAT_INFO_TILE_HS (finfo);
+  gint tile_width = 1 << ws;
+  gint tile_height = 1 << hs;
+  gint i, tx, ty, w, h, pw, ph, stride;
+  const guint8 *s;
+
+  for (i = 0; i < 2; i++) {
+    /* width in bytes and height of the plane, the UV plane has one U and V
+     * byte for every two pixels */
+    if (i == 0)
+      pw = convert->width;
+    else
+      pw = GST_ROUND_UP_2 (convert->width);
+    ph = GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (finfo, i, convert->height);
+    stride = FRAME_GET_PLANE_STRIDE (src, i);
+
+    for (ty = 0; ty << hs < ph; ty++) {
+      h = MIN (tile_height, ph - (ty << hs));
+
+      for (tx = 0; tx << ws < pw; tx++) {
+        w = MIN (tile_width, pw - (tx << ws));
+
+        s = (const guint8 *) GST_VIDEO_FRAME_PLANE_DATA (src, i) +
+            (gst_video_tile_get_index (mode, tx, ty,
+                GST_VIDEO_TILE_X_TILES (stride),
+                GST_VIDEO_TILE_Y_TILES (stride)) << (ws + hs));
+
+        if (i == 1 && split_uv) {
+          video_orc_split_uv_2d ((guint8 *) FRAME_GET_U_LINE (dest,
+                  ty << hs) + ((tx << ws) >> 1), FRAME_GET_U_STRIDE (dest),
+              (guint8 *) FRAME_GET_V_LINE (dest,
+                  ty << hs) + ((tx << ws) >> 1), FRAME_GET_V_STRIDE (dest),
+              s, tile_width, w / 2, h);
+        } else {
+          video_orc_memcpy_2d ((guint8 *) FRAME_GET_PLANE_LINE (dest, i,
+                  ty << hs) + (tx << ws), FRAME_GET_PLANE_STRIDE (dest, i),
+              s, tile_width, w, h);
+        }
+      }
+    }
+  }
+}
+
+static void
+convert_NV12_64Z32_NV12 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  convert_NV12_64Z32_planes (convert, dest, src, FALSE);
+}
+
+static void
+convert_NV12_64Z32_I420 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  convert_NV12_64Z32_planes (convert, dest, src, TRUE);
+}
+
+/* v210 packs groups of 6 pixels in 4 little endian words of 3 10 bits
+ * samples each. The samples are in the same U Y V Y order as UYVY. */
+#define EXPAND_8_10(v) (((v) << 2) | ((v) >> 6))
+
+static inline void
+v210_read_group (const guint8 * s, guint16 c[12])
+{
+  int k;
+  guint32 a;
+
+  for (k = 0; k < 4; k++) {
+    a = GST_READ_UINT32_LE (s + k * 4);
+    c[k * 3 + 0] = a & 0x3ff;
+    c[k * 3 + 1] = (a >> 10) & 0x3ff;
+    c[k * 3 + 2] = (a >> 20) & 0x3ff;
+  }
+}
+
+static inline void
+v210_write_group (guint8 * d, const guint16 c[12])
+{
+  int k;
+
+  for (k = 0; k < 4; k++)
+    GST_WRITE_UINT32_LE (d + k * 4,
+        c[k * 3 + 0] | (c[k * 3 + 1] << 10) | (c[k * 3 + 2] << 20));
+}
+
+static void
+convert_v210_UYVY (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i, j, k;
+  gint width = convert->width;
+  gint height = convert->height;
+  gint n = GST_ROUND_UP_2 (width) * 2;
+  const guint8 *s;
+  guint8 *d;
+  guint16 c[12];
+
+  for (j = 0; j < height; j++) {
+    s = FRAME_GET_LINE (src, j);
+    d = FRAME_GET_LINE (dest, j);
+
+    for (i = 0; i < n; i += 12) {
+      v210_read_group (s + (i / 12) * 16, c);
+      for (k = 0; k < MIN (12, n - i); k++)
+        d[i + k] = c[k] >> 2;
+    }
+  }
+}
+
+static void
+convert_UYVY_v210 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i, j, k;
+  gint width = convert->width;
+  gint height = convert->height;
+  gint n = GST_ROUND_UP_2 (width) * 2;
+  const guint8 *s;
+  guint8 *d;
+  guint16 c[12];
+
+  for (j = 0; j < height; j++) {
+    s = FRAME_GET_LINE (src, j);
+    d = FRAME_GET_LINE (dest, j);
+
+    for (i = 0; i < n; i += 12) {
+      for (k = 0; k < 12; k++)
+        c[k] = i + k < n ? EXPAND_8_10 (s[i + k]) : 0;
+      v210_write_group (d + (i / 12) * 16, c);
+    }
+  }
+}
+
+static void
+convert_v210_I420_lines (guint8 * y1, guint8 * y2, guint8 * u, guint8 * v,
+    const guint8 * s1, const guint8 * s2, gint width)
+{
+  int i, k;
+  guint16 c1[12], c2[12];
+
+  for (i = 0; i < width; i += 6) {
+    v210_read_group (s1 + (i / 6) * 16, c1);
+    v210_read_group (s2 + (i / 6) * 16, c2);
+
+    for (k = 0; k < MIN (6, width - i); k++) {
+      y1[i + k] = c1[k * 2 + 1] >> 2;
+      y2[i + k] = c2[k * 2 + 1] >> 2;
+    }
+    for (k = 0; k < MIN (3, (width - i + 1) / 2); k++) {
+      u[i / 2 + k] = (c1[k * 4 + 0] + c2[k * 4 + 0] + 4) >> 3;
+      v[i / 2 + k] = (c1[k * 4 + 2] + c2[k * 4 + 2] + 4) >> 3;
+    }
+  }
+}
+
+static void
+convert_v210_I420 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i;
+  gint width = convert->width;
+  gint height = convert->height;
+  gboolean interlaced = GST_VIDEO_FRAME_IS_INTERLACED (src);
+  gint l1, l2;
+
+  for (i = 0; i < GST_ROUND_DOWN_2 (height); i += 2) {
+    GET_LINE_OFFSETS (interlaced, i, l1, l2);
+
+    convert_v210_I420_lines (FRAME_GET_Y_LINE (dest, l1),
+        FRAME_GET_Y_LINE (dest, l2),
+        FRAME_GET_U_LINE (dest, i >> 1),
+        FRAME_GET_V_LINE (dest, i >> 1),
+        FRAME_GET_LINE (src, l1), FRAME_GET_LINE (src, l2), width);
+  }
+
+  /* now handle last line, the tmplines can't be used because the unpack
+   * formats differ */
+  if (height & 1) {
+    convert_v210_I420_lines (FRAME_GET_Y_LINE (dest, height - 1),
+        FRAME_GET_Y_LINE (dest, height - 1),
+        FRAME_GET_U_LINE (dest, height >> 1),
+        FRAME_GET_V_LINE (dest, height >> 1),
+        FRAME_GET_LINE (src, height - 1),
+        FRAME_GET_LINE (src, height - 1), width);
+  }
+}
+
+static void
+convert_I420_v210 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i, j, k, uv;
+  gint width = convert->width;
+  gint height = convert->height;
+  gboolean interlaced = GST_VIDEO_FRAME_IS_INTERLACED (src);
+  const guint8 *sy, *su, *sv;
+  guint8 *d;
+  guint16 c[12];
+
+  for (j = 0; j < height; j++) {
+    uv = interlaced ? ((j & ~3) >> 1) + (j & 1) : j >> 1;
+    sy = FRAME_GET_Y_LINE (src, j);
+    su = FRAME_GET_U_LINE (src, uv);
+    sv = FRAME_GET_V_LINE (src, uv);
+    d = FRAME_GET_LINE (dest, j);
+
+    for (i = 0; i < width; i += 6) {
+      for (k = 0; k < 6; k++)
+        c[k * 2 + 1] = EXPAND_8_10 (sy[MIN (i + k, width - 1)]);
+      for (k = 0; k < 3; k++) {
+        c[k * 4 + 0] = EXPAND_8_10 (su[MIN (i / 2 + k, (width - 1) / 2)]);
+        c[k * 4 + 2] = EXPAND_8_10 (sv[MIN (i / 2 + k, (width - 1) / 2)]);
+      }
+      v210_write_group (d + (i / 6) * 16, c);
+    }
+  }
+}
+
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+static void
+convert_AYUV_ARGB (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_AYUV_ARGB (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), width, height);
+}
+
+static void
+convert_AYUV_BGRA (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_AYUV_BGRA (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), width, height);
+}
+
+static void
+convert_AYUV_ABGR (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_AYUV_ABGR (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), width, height);
+}
+
+static void
+convert_AYUV_RGBA (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  gint width = convert->width;
+  gint height = convert->height;
+
+  video_orc_convert_AYUV_RGBA (FRAME_GET_LINE (dest, 0),
+      FRAME_GET_STRIDE (dest), FRAME_GET_LINE (src, 0),
+      FRAME_GET_STRIDE (src), width, height);
+}
+
+static void
+convert_I420_BGRA (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i;
+  int quality = 0;
+  gint width = convert->width;
+  gint height = convert->height;
+
+  if (quality > 3) {
+    for (i = 0; i < height; i++) {
+      if (i & 1) {
+        video_orc_convert_I420_BGRA_avg (FRAME_GET_LINE (dest, i),
+            FRAME_GET_Y_LINE (src, i),
+            FRAME_GET_U_LINE (src, i >> 1),
+            FRAME_GET_U_LINE (src, (i >> 1) + 1),
+            FRAME_GET_V_LINE (src, i >> 1),
+            FRAME_GET_V_LINE (src, (i >> 1) + 1), width);
+      } else {
+        video_orc_convert_I420_BGRA (FRAME_GET_LINE (dest, i),
+            FRAME_GET_Y_LINE (src, i),
+            FRAME_GET_U_LINE (src, i >> 1),
+            FRAME_GET_V_LINE (src, i >> 1), width);
+      }
+    }
+  } else {
+    for (i = 0; i < height; i++) {
+      video_orc_convert_I420_BGRA (FRAME_GET_LINE (dest, i),
+          FRAME_GET_Y_LINE (src, i),
+          FRAME_GET_U_LINE (src, i >> 1),
+          FRAME_GET_V_LINE (src, i >> 1), width);
+    }
+  }
+}
+static void
+convert_I420_10LE_I420 (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i;
+  gint width = convert->width;
+  gint height = convert->height;
+  const GstVideoFormatInfo *finfo = dest->info.finfo;
+
+  for (i = 0; i < 3; i++) {
+    video_orc_planar_10_8 (FRAME_GET_COMP_LINE (dest, i, 0),
+        FRAME_GET_COMP_STRIDE (dest, i), FRAME_GET_COMP_LINE (src, i, 0),
+        FRAME_GET_COMP_STRIDE (src, i),
+        GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (finfo, i, width),
+        GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (finfo, i, height));
+  }
+}
+
+static void
+convert_I420_I420_10LE (GstVideoConverter * convert, GstVideoFrame * dest,
+    const GstVideoFrame * src)
+{
+  int i;
+  gint width = convert->width;
+  gint height = convert->height;
+  const GstVideoFormatInfo *finfo = dest->info.finfo;
+
+  for (i = 0; i < 3; i++) {
+    video_orc_planar_8_10 (FRAME_GET_COMP_LINE (dest, i, 0),
+        FRAME_GET_COMP_STRIDE (dest, i), FRAME_GET_COMP_LINE (src, i, 0),
+        FRAME_GET_COMP_STRIDE (src, i),
+        GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (finfo, i, width),
+        GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (finfo, i, height));
+  }
+}
+#endif
+
+
+
+/* Fast paths */
+
+typedef struct
+{
+  GstVideoFormat in_format;
+  GstVideoColorMatrix in_matrix;
+  GstVideoFormat out_format;
+  GstVideoColorMatrix out_matrix;
+  gboolean keeps_color_matrix;
+  gboolean keeps_interlaced;
+  void (*convert) (GstVideoConverter * convert, GstVideoFrame * dest,
+      const GstVideoFrame * src);
+} VideoTransform;
+
+static const VideoTransform transforms[] = {
+  {GST_VIDEO_FORMAT_I420, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_YUY2,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_I420_YUY2},
+  {GST_VIDEO_FORMAT_I420, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_UYVY,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_I420_UYVY},
+  {GST_VIDEO_FORMAT_I420, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_AYUV,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_I420_AYUV},
+  {GST_VIDEO_FORMAT_I420, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_Y42B,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, FALSE, convert_I420_Y42B},
+  {GST_VIDEO_FORMAT_I420, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_Y444,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, FALSE, convert_I420_Y444},
+
+  {GST_VIDEO_FORMAT_YUY2, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_I420,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_YUY2_I420},
+  {GST_VIDEO_FORMAT_YUY2, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_UYVY,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_UYVY_YUY2},   /* alias */
+  {GST_VIDEO_FORMAT_YUY2, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_AYUV,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_YUY2_AYUV},
+  {GST_VIDEO_FORMAT_YUY2, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_Y42B,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_YUY2_Y42B},
+  {GST_VIDEO_FORMAT_YUY2, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_Y444,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_YUY2_Y444},
+
+  {GST_VIDEO_FORMAT_UYVY, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_I420,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_UYVY_I420},
+  {GST_VIDEO_FORMAT_UYVY, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_YUY2,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_UYVY_YUY2},
+  {GST_VIDEO_FORMAT_UYVY, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_AYUV,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_UYVY_AYUV},
+  {GST_VIDEO_FORMAT_UYVY, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_Y42B,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_UYVY_Y42B},
+  {GST_VIDEO_FORMAT_UYVY, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_Y444,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_UYVY_Y444},
+
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_I420,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, FALSE, convert_AYUV_I420},
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_YUY2,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_AYUV_YUY2},
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_UYVY,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_AYUV_UYVY},
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_Y42B,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_AYUV_Y42B},
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_Y444,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_AYUV_Y444},
+
+  {GST_VIDEO_FORMAT_Y42B, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_I420,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, FALSE, convert_Y42B_I420},
+  {GST_VIDEO_FORMAT_Y42B, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_YUY2,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_Y42B_YUY2},
+  {GST_VIDEO_FORMAT_Y42B, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_UYVY,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_Y42B_UYVY},
+  {GST_VIDEO_FORMAT_Y42B, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_AYUV,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_Y42B_AYUV},
+  {GST_VIDEO_FORMAT_Y42B, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_Y444,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_Y42B_Y444},
+
+  {GST_VIDEO_FORMAT_Y444, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_I420,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, FALSE, convert_Y444_I420},
+  {GST_VIDEO_FORMAT_Y444, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_YUY2,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_Y444_YUY2},
+  {GST_VIDEO_FORMAT_Y444, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_UYVY,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_Y444_UYVY},
+  {GST_VIDEO_FORMAT_Y444, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_AYUV,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_Y444_AYUV},
+  {GST_VIDEO_FORMAT_Y444, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_Y42B,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_Y444_Y42B},
+
+  {GST_VIDEO_FORMAT_NV12, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_UYVY,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_NV12_UYVY},
+  {GST_VIDEO_FORMAT_UYVY, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_NV12,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_UYVY_NV12},
+
+  {GST_VIDEO_FORMAT_NV12_64Z32, GST_VIDEO_COLOR_MATRIX_UNKNOWN,
+        GST_VIDEO_FORMAT_NV12, GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE,
+      convert_NV12_64Z32_NV12},
+  {GST_VIDEO_FORMAT_NV12_64Z32, GST_VIDEO_COLOR_MATRIX_UNKNOWN,
+        GST_VIDEO_FORMAT_I420, GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE,
+      convert_NV12_64Z32_I420},
+
+  {GST_VIDEO_FORMAT_v210, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_UYVY,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_v210_UYVY},
+  {GST_VIDEO_FORMAT_UYVY, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_v210,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_UYVY_v210},
+  {GST_VIDEO_FORMAT_v210, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_I420,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_v210_I420},
+  {GST_VIDEO_FORMAT_I420, GST_VIDEO_COLOR_MATRIX_UNKNOWN, GST_VIDEO_FORMAT_v210,
+      GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE, convert_I420_v210},
+
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_BT601, GST_VIDEO_FORMAT_ARGB,
+      GST_VIDEO_COLOR_MATRIX_RGB, FALSE, TRUE, convert_AYUV_ARGB},
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_BT601, GST_VIDEO_FORMAT_BGRA,
+      GST_VIDEO_COLOR_MATRIX_RGB, FALSE, TRUE, convert_AYUV_BGRA},
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_BT601, GST_VIDEO_FORMAT_xRGB,
+      GST_VIDEO_COLOR_MATRIX_RGB, FALSE, TRUE, convert_AYUV_ARGB},      /* alias */
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_BT601, GST_VIDEO_FORMAT_BGRx,
+      GST_VIDEO_COLOR_MATRIX_RGB, FALSE, TRUE, convert_AYUV_BGRA},      /* alias */
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_BT601, GST_VIDEO_FORMAT_ABGR,
+      GST_VIDEO_COLOR_MATRIX_RGB, FALSE, TRUE, convert_AYUV_ABGR},
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_BT601, GST_VIDEO_FORMAT_RGBA,
+      GST_VIDEO_COLOR_MATRIX_RGB, FALSE, TRUE, convert_AYUV_RGBA},
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_BT601, GST_VIDEO_FORMAT_xBGR,
+      GST_VIDEO_COLOR_MATRIX_RGB, FALSE, TRUE, convert_AYUV_ABGR},      /* alias */
+  {GST_VIDEO_FORMAT_AYUV, GST_VIDEO_COLOR_MATRIX_BT601, GST_VIDEO_FORMAT_RGBx,
+      GST_VIDEO_COLOR_MATRIX_RGB, FALSE, TRUE, convert_AYUV_RGBA},      /* alias */
+
+  {GST_VIDEO_FORMAT_I420, GST_VIDEO_COLOR_MATRIX_BT601, GST_VIDEO_FORMAT_BGRA,
+      GST_VIDEO_COLOR_MATRIX_RGB, FALSE, FALSE, convert_I420_BGRA},
+
+  {GST_VIDEO_FORMAT_I420_10LE, GST_VIDEO_COLOR_MATRIX_UNKNOWN,
+        GST_VIDEO_FORMAT_I420, GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE,
+      convert_I420_10LE_I420},
+  {GST_VIDEO_FORMAT_I420, GST_VIDEO_COLOR_MATRIX_UNKNOWN,
+        GST_VIDEO_FORMAT_I420_10LE, GST_VIDEO_COLOR_MATRIX_UNKNOWN, TRUE, TRUE,
+      convert_I420_I420_10LE},
+#endif
+};
+
+static gboolean
+video_converter_lookup_fastpath (GstVideoConverter * convert)
+{
+  int i;
+  GstVideoFormat in_format, out_format;
+  GstVideoColorMatrix in_matrix, out_matrix;
+  gboolean interlaced;
+
+  in_format = GST_VIDEO_INFO_FORMAT (&convert->in_info);
+  out_format = GST_VIDEO_INFO_FORMAT (&convert->out_info);
+
+  in_matrix = convert->in_info.colorimetry.matrix;
+  out_matrix = convert->out_info.colorimetry.matrix;
+
+  interlaced = GST_VIDEO_INFO_IS_INTERLACED (&convert->in_info);
+  interlaced |= GST_VIDEO_INFO_IS_INTERLACED (&convert->out_info);
+
+  for (i = 0; i < sizeof (transforms) / sizeof (transforms[0]); i++) {
+    if (transforms[i].in_format == in_format &&
+        transforms[i].out_format == out_format &&
+        (transforms[i].keeps_color_matrix ||
+            (transforms[i].in_matrix == in_matrix &&
+                transforms[i].out_matrix == out_matrix)) &&
+        (transforms[i].keeps_interlaced || !interlaced)) {
+      GST_DEBUG ("using fastpath");
+      convert->convert = transforms[i].convert;
+      return TRUE;
+    }
+  }
+  return FALSE;
+}
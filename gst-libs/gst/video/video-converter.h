@@ -0,0 +1,97 @@
+/* Video conversion api function
+ * Copyright (C) 2010 David Schleef <ds@schleef.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_VIDEO_CONVERTER_H__
+#define __GST_VIDEO_CONVERTER_H__
+
+#include <gst/gst.h>
+#include <gst/video/video-frame.h>
+
+G_BEGIN_DECLS
+
+/**
+ * GstVideoDitherMethod:
+ * @GST_VIDEO_DITHER_NONE: no dithering
+ * @GST_VIDEO_DITHER_VERTERR: propagate rounding errors to the next line
+ * @GST_VIDEO_DITHER_HALFTONE: add an ordered 8x8 halftone pattern
+ * @GST_VIDEO_DITHER_BAYER: add an ordered 4x4 bayer pattern
+ *
+ * Different dithering methods to use when reducing the depth of the
+ * components.
+ *
+ * Since: 1.2
+ */
+typedef enum {
+  GST_VIDEO_DITHER_NONE,
+  GST_VIDEO_DITHER_VERTERR,
+  GST_VIDEO_DITHER_HALFTONE,
+  GST_VIDEO_DITHER_BAYER
+} GstVideoDitherMethod;
+
+/**
+ * GST_VIDEO_CONVERTER_OPT_DITHER_METHOD:
+ *
+ * #GstVideoDitherMethod, The dither method to use when
+ * changing bit depth.
+ * Default is #GST_VIDEO_DITHER_NONE.
+ *
+ * Since: 1.2
+ */
+#define GST_VIDEO_CONVERTER_OPT_DITHER_METHOD   "GstVideoConverter.dither-method"
+
+/**
+ * GST_VIDEO_CONVERTER_OPT_THREADS:
+ *
+ * #G_TYPE_UINT, maximum number of threads to use for the conversion,
+ * 0 uses the number of processors. Conversions that use
+ * #GST_VIDEO_DITHER_VERTERR dithering always run in one thread.
+ * Default 1
+ *
+ * Since: 1.2
+ */
+#define GST_VIDEO_CONVERTER_OPT_THREADS   "GstVideoConverter.threads"
+
+/**
+ * GstVideoConverter:
+ *
+ * Opaque video conversion object.
+ *
+ * Since: 1.2
+ */
+typedef struct _GstVideoConverter GstVideoConverter;
+
+GstVideoConverter *  gst_video_converter_new            (GstVideoInfo *in_info,
+                                                         GstVideoInfo *out_info,
+                                                         GstStructure *config);
+void                 gst_video_converter_free           (GstVideoConverter * convert);
+
+gboolean             gst_video_converter_set_config     (GstVideoConverter * convert,
+                                                         GstStructure *config);
+const GstStructure * gst_video_converter_get_config     (GstVideoConverter * convert);
+
+void                 gst_video_converter_frame          (GstVideoConverter * convert,
+                                                         const GstVideoFrame *src,
+                                                         GstVideoFrame *dest);
+
+void                 gst_video_converter_line           (GstVideoConverter * convert,
+                                                         gpointer line, gint y);
+
+G_END_DECLS
+
+#endif /* __GST_VIDEO_CONVERTER_H__ */
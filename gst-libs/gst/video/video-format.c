@@ -219,6 +219,11 @@ unpack_v210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
   int i;
   const guint8 *s = GET_LINE (y);
   guint16 *d = dest;
+  guint16 rmask;
+
+  /* mask for replicating the 6 most significant bits into the lower bits,
+   * avoids a branch per sample */
+  rmask = (flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE) ? 0 : 0x3f;
 
   for (i = 0; i < width; i += 6) {
     guint32 a0, a1, a2, a3;
@@ -226,10 +231,11 @@ unpack_v210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     guint16 u0, u2, u4;
     guint16 v0, v2, v4;
 
-    a0 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 0);
-    a1 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 4);
-    a2 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 8);
-    a3 = GST_READ_UINT32_LE (s + (i / 6) * 16 + 12);
+    a0 = GST_READ_UINT32_LE (s + 0);
+    a1 = GST_READ_UINT32_LE (s + 4);
+    a2 = GST_READ_UINT32_LE (s + 8);
+    a3 = GST_READ_UINT32_LE (s + 12);
+    s += 16;
 
     u0 = ((a0 >> 0) & 0x3ff) << 6;
     y0 = ((a0 >> 10) & 0x3ff) << 6;
@@ -246,52 +252,51 @@ unpack_v210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     v4 = ((a3 >> 10) & 0x3ff) << 6;
     y5 = ((a3 >> 20) & 0x3ff) << 6;
 
-    if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
-      y0 |= (y0 >> 10);
-      y1 |= (y1 >> 10);
-      u0 |= (u0 >> 10);
-      v0 |= (v0 >> 10);
-
-      y2 |= (y2 >> 10);
-      y3 |= (y3 >> 10);
-      u2 |= (u2 >> 10);
-      v2 |= (v2 >> 10);
-
-      y4 |= (y4 >> 10);
-      y5 |= (y5 >> 10);
-      u4 |= (u4 >> 10);
-      v4 |= (v4 >> 10);
-    }
+    y0 |= (y0 >> 10) & rmask;
+    y1 |= (y1 >> 10) & rmask;
+    u0 |= (u0 >> 10) & rmask;
+    v0 |= (v0 >> 10) & rmask;
+
+    y2 |= (y2 >> 10) & rmask;
+    y3 |= (y3 >> 10) & rmask;
+    u2 |= (u2 >> 10) & rmask;
+    v2 |= (v2 >> 10) & rmask;
 
-    d[4 * (i + 0) + 0] = 0xffff;
-    d[4 * (i + 0) + 1] = y0;
-    d[4 * (i + 0) + 2] = u0;
-    d[4 * (i + 0) + 3] = v0;
+    y4 |= (y4 >> 10) & rmask;
+    y5 |= (y5 >> 10) & rmask;
+    u4 |= (u4 >> 10) & rmask;
+    v4 |= (v4 >> 10) & rmask;
 
-    d[4 * (i + 1) + 0] = 0xffff;
-    d[4 * (i + 1) + 1] = y1;
-    d[4 * (i + 1) + 2] = u0;
-    d[4 * (i + 1) + 3] = v0;
+    d[0] = 0xffff;
+    d[1] = y0;
+    d[2] = u0;
+    d[3] = v0;
 
-    d[4 * (i + 2) + 0] = 0xffff;
-    d[4 * (i + 2) + 1] = y2;
-    d[4 * (i + 2) + 2] = u2;
-    d[4 * (i + 2) + 3] = v2;
+    d[4] = 0xffff;
+    d[5] = y1;
+    d[6] = u0;
+    d[7] = v0;
 
-    d[4 * (i + 3) + 0] = 0xffff;
-    d[4 * (i + 3) + 1] = y3;
-    d[4 * (i + 3) + 2] = u2;
-    d[4 * (i + 3) + 3] = v2;
+    d[8] = 0xffff;
+    d[9] = y2;
+    d[10] = u2;
+    d[11] = v2;
 
-    d[4 * (i + 4) + 0] = 0xffff;
-    d[4 * (i + 4) + 1] = y4;
-    d[4 * (i + 4) + 2] = u4;
-    d[4 * (i + 4) + 3] = v4;
+    d[12] = 0xffff;
+    d[13] = y3;
+    d[14] = u2;
+    d[15] = v2;
 
-    d[4 * (i + 5) + 0] = 0xffff;
-    d[4 * (i + 5) + 1] = y5;
-    d[4 * (i + 5) + 2] = u4;
-    d[4 * (i + 5) + 3] = v4;
+    d[16] = 0xffff;
+    d[17] = y4;
+    d[18] = u4;
+    d[19] = v4;
+
+    d[20] = 0xffff;
+    d[21] = y5;
+    d[22] = u4;
+    d[23] = v4;
+    d += 24;
   }
 }
 
@@ -311,30 +316,32 @@ pack_v210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     guint16 u0, u1, u2;
     guint16 v0, v1, v2;
 
-    y0 = s[4 * (i + 0) + 1] >> 6;
-    y1 = s[4 * (i + 1) + 1] >> 6;
-    y2 = s[4 * (i + 2) + 1] >> 6;
-    y3 = s[4 * (i + 3) + 1] >> 6;
-    y4 = s[4 * (i + 4) + 1] >> 6;
-    y5 = s[4 * (i + 5) + 1] >> 6;
+    y0 = s[1] >> 6;
+    y1 = s[5] >> 6;
+    y2 = s[9] >> 6;
+    y3 = s[13] >> 6;
+    y4 = s[17] >> 6;
+    y5 = s[21] >> 6;
 
-    u0 = s[4 * (i + 0) + 2] >> 6;
-    u1 = s[4 * (i + 2) + 2] >> 6;
-    u2 = s[4 * (i + 4) + 2] >> 6;
+    u0 = s[2] >> 6;
+    u1 = s[10] >> 6;
+    u2 = s[18] >> 6;
 
-    v0 = s[4 * (i + 0) + 3] >> 6;
-    v1 = s[4 * (i + 2) + 3] >> 6;
-    v2 = s[4 * (i + 4) + 3] >> 6;
+    v0 = s[3] >> 6;
+    v1 = s[11] >> 6;
+    v2 = s[19] >> 6;
+    s += 24;
 
     a0 = u0 | (y0 << 10) | (v0 << 20);
     a1 = y1 | (u1 << 10) | (y2 << 20);
     a2 = v1 | (y3 << 10) | (u2 << 20);
     a3 = y4 | (v2 << 10) | (y5 << 20);
 
-    GST_WRITE_UINT32_LE (d + (i / 6) * 16 + 0, a0);
-    GST_WRITE_UINT32_LE (d + (i / 6) * 16 + 4, a1);
-    GST_WRITE_UINT32_LE (d + (i / 6) * 16 + 8, a2);
-    GST_WRITE_UINT32_LE (d + (i / 6) * 16 + 12, a3);
+    GST_WRITE_UINT32_LE (d + 0, a0);
+    GST_WRITE_UINT32_LE (d + 4, a1);
+    GST_WRITE_UINT32_LE (d + 8, a2);
+    GST_WRITE_UINT32_LE (d + 12, a3);
+    d += 16;
   }
 }
 
@@ -347,12 +354,31 @@ unpack_v216 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
   int i;
   const guint8 *s = GET_LINE (y);
   guint16 *d = dest;
+  guint16 u, v;
 
-  for (i = 0; i < width; i++) {
-    d[i * 4 + 0] = 0xffff;
-    d[i * 4 + 1] = GST_READ_UINT16_LE (s + i * 4 + 2);
-    d[i * 4 + 2] = GST_READ_UINT16_LE (s + (i >> 1) * 8 + 0);
-    d[i * 4 + 3] = GST_READ_UINT16_LE (s + (i >> 1) * 8 + 4);
+  /* read the shared chroma samples only once per pixel pair */
+  for (i = 0; i < width - 1; i += 2) {
+    u = GST_READ_UINT16_LE (s + 0);
+    v = GST_READ_UINT16_LE (s + 4);
+
+    d[0] = 0xffff;
+    d[1] = GST_READ_UINT16_LE (s + 2);
+    d[2] = u;
+    d[3] = v;
+
+    d[4] = 0xffff;
+    d[5] = GST_READ_UINT16_LE (s + 6);
+    d[6] = u;
+    d[7] = v;
+
+    s += 8;
+    d += 8;
+  }
+  if (i < width) {
+    d[0] = 0xffff;
+    d[1] = GST_READ_UINT16_LE (s + 2);
+    d[2] = GST_READ_UINT16_LE (s + 0);
+    d[3] = GST_READ_UINT16_LE (s + 4);
   }
 }
 
@@ -367,10 +393,12 @@ pack_v216 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
   const guint16 *s = src;
 
   for (i = 0; i < width / 2; i++) {
-    GST_WRITE_UINT16_LE (d + i * 8 + 0, s[(i * 2 + 0) * 4 + 2]);
-    GST_WRITE_UINT16_LE (d + i * 8 + 2, s[(i * 2 + 0) * 4 + 1]);
-    GST_WRITE_UINT16_LE (d + i * 8 + 4, s[(i * 2 + 0) * 4 + 3]);
-    GST_WRITE_UINT16_LE (d + i * 8 + 6, s[(i * 2 + 1) * 4 + 1]);
+    GST_WRITE_UINT16_LE (d + 0, s[2]);
+    GST_WRITE_UINT16_LE (d + 2, s[1]);
+    GST_WRITE_UINT16_LE (d + 4, s[3]);
+    GST_WRITE_UINT16_LE (d + 6, s[5]);
+    s += 8;
+    d += 8;
   }
 }
 
@@ -939,6 +967,79 @@ pack_NV16 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
       GET_PLANE_LINE (1, y), src, width / 2);
 }
 
+/* get the line @y of the Y tile and the line @uv of the UV tile that
+ * contain pixel @x */
+static void
+get_tile_lines_NV12 (const GstVideoFormatInfo * info,
+    const gpointer data[GST_VIDEO_MAX_PLANES],
+    const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint uv,
+    guint8 ** line_y, guint8 ** line_uv)
+{
+  GstVideoTileMode mode = GST_VIDEO_FORMAT_INFO_TILE_MODE (info);
+  gint ws = GST_VIDEO_FORMAT_INFO_TILE_WS (info);
+  gint hs = GST_VIDEO_FORMAT_INFO_TILE_HS (info);
+  gsize offset;
+
+  offset = gst_video_tile_get_index (mode, x >> ws, y >> hs,
+      GST_VIDEO_TILE_X_TILES (stride[0]), GST_VIDEO_TILE_Y_TILES (stride[0]));
+  *line_y = (guint8 *) data[0] + (offset << (ws + hs)) +
+      ((y & ((1 << hs) - 1)) << ws);
+
+  /* a UV tile covers the same width as a Y tile and twice the height */
+  offset = gst_video_tile_get_index (mode, x >> ws, uv >> hs,
+      GST_VIDEO_TILE_X_TILES (stride[1]), GST_VIDEO_TILE_Y_TILES (stride[1]));
+  *line_uv = (guint8 *) data[1] + (offset << (ws + hs)) +
+      ((uv & ((1 << hs) - 1)) << ws);
+}
+
+#define PACK_NV12_64Z32 GST_VIDEO_FORMAT_AYUV, unpack_NV12_64Z32, 1, pack_NV12_64Z32
+static void
+unpack_NV12_64Z32 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
+    gpointer dest, const gpointer data[GST_VIDEO_MAX_PLANES],
+    const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
+{
+  guint8 *d = dest;
+  gint uv = GET_UV_420 (y, flags);
+  gint tile_width = 1 << GST_VIDEO_FORMAT_INFO_TILE_WS (info);
+  gint tx, w;
+  guint8 *sy, *suv;
+
+  /* unpack the part of the line in each tile with the NV12 function */
+  while (width > 0) {
+    get_tile_lines_NV12 (info, data, stride, x, y, uv, &sy, &suv);
+
+    tx = x & (tile_width - 1);
+    w = MIN (width, tile_width - tx);
+
+    video_orc_unpack_NV12 (d, sy + tx, suv + tx, w / 2);
+
+    d += w * 4;
+    x += w;
+    width -= w;
+  }
+}
+
+static void
+pack_NV12_64Z32 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
+    const gpointer src, gint sstride, gpointer data[GST_VIDEO_MAX_PLANES],
+    const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
+    gint y, gint width)
+{
+  const guint8 *s = src;
+  gint uv = GET_UV_420 (y, flags);
+  gint tile_width = 1 << GST_VIDEO_FORMAT_INFO_TILE_WS (info);
+  gint x, w;
+  guint8 *dy, *duv;
+
+  for (x = 0; x < width; x += w) {
+    get_tile_lines_NV12 (info, data, stride, x, y, uv, &dy, &duv);
+
+    w = MIN (width - x, tile_width);
+
+    video_orc_pack_NV12 (dy, duv, s + x * 4, w / 2);
+  }
+}
+
 #define PACK_UYVP GST_VIDEO_FORMAT_AYUV64, unpack_UYVP, 1, pack_UYVP
 static void
 unpack_UYVP (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
@@ -1125,9 +1226,21 @@ unpack_410 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width)
 {
   gint uv = GET_UV_410 (y, flags);
+  const guint8 *sy = GET_Y_LINE (y);
+  const guint8 *su = GET_U_LINE (uv);
+  const guint8 *sv = GET_V_LINE (uv);
+  guint8 *d = dest;
 
-  video_orc_unpack_YUV9 (dest,
-      GET_Y_LINE (y), GET_U_LINE (uv), GET_V_LINE (uv), width / 2);
+  video_orc_unpack_YUV9 (dest, sy, su, sv, width / 2);
+
+  if (width & 1) {
+    gint i = width - 1;
+
+    d[i * 4 + 0] = 0xff;
+    d[i * 4 + 1] = sy[i];
+    d[i * 4 + 2] = su[i >> 2];
+    d[i * 4 + 3] = sv[i >> 2];
+  }
 }
 
 static void
@@ -1138,41 +1251,20 @@ pack_410 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
 {
   int i;
   gint uv = GET_UV_410 (y, flags);
-  guint8 *destY = GET_Y_LINE (y);
   guint8 *destU = GET_U_LINE (uv);
   guint8 *destV = GET_V_LINE (uv);
   const guint8 *s = src;
 
-  for (i = 0; i < width - 3; i += 4) {
-    destY[i] = s[i * 4 + 1];
-    destY[i + 1] = s[i * 4 + 5];
-    destY[i + 2] = s[i * 4 + 9];
-    destY[i + 3] = s[i * 4 + 13];
-    if (y % 4 == 0) {
-      destU[i >> 2] = s[i * 4 + 2];
-      destV[i >> 2] = s[i * 4 + 3];
-    }
-  }
+  /* the luma plane is a plain AYUV to GRAY8 conversion */
+  video_orc_pack_GRAY8 (GET_Y_LINE (y), src, width);
 
-  if (i == width - 3) {
-    destY[i] = s[i * 4 + 1];
-    destY[i + 1] = s[i * 4 + 5];
-    destY[i + 2] = s[i * 4 + 9];
-    if (y % 4 == 0) {
+  /* chroma is only stored on every fourth line, take the first pixel of
+   * each group of 4 */
+  if (y % 4 == 0) {
+    for (i = 0; i < width; i += 4) {
       destU[i >> 2] = s[i * 4 + 2];
       destV[i >> 2] = s[i * 4 + 3];
     }
-  } else if (i == width - 2) {
-    destY[i] = s[i * 4 + 1];
-    destY[i + 1] = s[i * 4 + 5];
-    if (y % 4 == 0) {
-      destU[i >> 2] = s[i * 4 + 2];
-      destV[i >> 2] = s[i * 4 + 3];
-    }
-  } else if (i == width - 1) {
-    destY[i] = s[i * 4 + 1];
-    destU[i >> 2] = s[i * 4 + 2];
-    destV[i >> 2] = s[i * 4 + 3];
   }
 }
 
@@ -1291,6 +1383,13 @@ unpack_r210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
   const guint8 *s = GET_LINE (y);
   guint16 *d = dest, R, G, B;
 
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  if (!(flags & GST_VIDEO_PACK_FLAG_TRUNCATE_RANGE)) {
+    video_orc_unpack_r210 (dest, s, width);
+    return;
+  }
+#endif
+
   for (i = 0; i < width; i++) {
     guint32 x = GST_READ_UINT32_BE (s + i * 4);
 
@@ -1317,6 +1416,9 @@ pack_r210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
     gint y, gint width)
 {
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  video_orc_pack_r210 (GET_LINE (y), src, width);
+#else
   int i;
   guint8 *d = GET_LINE (y);
   const guint16 *s = src;
@@ -1328,6 +1430,7 @@ pack_r210 (const GstVideoFormatInfo * info, GstVideoPackFlags flags,
     x |= (s[i * 4 + 3] & 0xffc0) >> 6;
     GST_WRITE_UINT32_BE (d + i * 4, x);
   }
+#endif
 }
 
 #define PACK_GBR_10LE GST_VIDEO_FORMAT_ARGB64, unpack_GBR_10LE, 1, pack_GBR_10LE
@@ -1873,6 +1976,9 @@ typedef struct
 #define SUB4444           { 0, 0, 0, 0 }, { 0, 0, 0, 0 }
 #define SUB4204           { 0, 1, 1, 0 }, { 0, 1, 1, 0 }
 
+/* tile_mode, tile_ws, tile_hs: the tile size as a shift of the bytes */
+#define TILE_64x32(mode) GST_VIDEO_TILE_MODE_ ##mode, 6, 5
+
 #define MAKE_YUV_FORMAT(name, desc, fourcc, depth, pstride, plane, offs, sub, pack ) \
  { fourcc, {GST_VIDEO_FORMAT_ ##name, G_STRINGIFY(name), desc, GST_VIDEO_FORMAT_FLAG_YUV, depth, pstride, plane, offs, sub, pack } }
 #define MAKE_YUV_LE_FORMAT(name, desc, fourcc, depth, pstride, plane, offs, sub, pack ) \
@@ -1885,6 +1991,8 @@ typedef struct
  { fourcc, {GST_VIDEO_FORMAT_ ##name, G_STRINGIFY(name), desc, GST_VIDEO_FORMAT_FLAG_YUV | GST_VIDEO_FORMAT_FLAG_ALPHA | GST_VIDEO_FORMAT_FLAG_UNPACK | GST_VIDEO_FORMAT_FLAG_LE, depth, pstride, plane, offs, sub, pack } }
 #define MAKE_YUV_C_FORMAT(name, desc, fourcc, depth, pstride, plane, offs, sub, pack) \
  { fourcc, {GST_VIDEO_FORMAT_ ##name, G_STRINGIFY(name), desc, GST_VIDEO_FORMAT_FLAG_YUV | GST_VIDEO_FORMAT_FLAG_COMPLEX, depth, pstride, plane, offs, sub, pack } }
+#define MAKE_YUV_T_FORMAT(name, desc, fourcc, depth, pstride, plane, offs, sub, pack, tile) \
+ { fourcc, {GST_VIDEO_FORMAT_ ##name, G_STRINGIFY(name), desc, GST_VIDEO_FORMAT_FLAG_YUV | GST_VIDEO_FORMAT_FLAG_COMPLEX | GST_VIDEO_FORMAT_FLAG_TILED, depth, pstride, plane, offs, sub, pack, tile } }
 
 #define MAKE_RGB_FORMAT(name, desc, depth, pstride, plane, offs, sub, pack) \
  { 0x00000000, {GST_VIDEO_FORMAT_ ##name, G_STRINGIFY(name), desc, GST_VIDEO_FORMAT_FLAG_RGB, depth, pstride, plane, offs, sub, pack } }
@@ -2037,6 +2145,9 @@ static VideoFormat formats[] = {
 
   MAKE_YUV_FORMAT (NV16, "raw video", GST_MAKE_FOURCC ('N', 'V', '1', '6'),
       DPTH888, PSTR111, PLANE011, OFFS001, SUB422, PACK_NV16),
+  MAKE_YUV_T_FORMAT (NV12_64Z32, "raw video",
+      GST_MAKE_FOURCC ('T', 'M', '1', '2'), DPTH888, PSTR122, PLANE011,
+      OFFS001, SUB420, PACK_NV12_64Z32, TILE_64x32 (ZFLIPZ_2X2)),
 };
 
 static GstVideoFormat
@@ -2241,6 +2352,8 @@ gst_video_format_from_fourcc (guint32 fourcc)
       return GST_VIDEO_FORMAT_NV21;
     case GST_MAKE_FOURCC ('N', 'V', '1', '6'):
       return GST_VIDEO_FORMAT_NV16;
+    case GST_MAKE_FOURCC ('T', 'M', '1', '2'):
+      return GST_VIDEO_FORMAT_NV12_64Z32;
     case GST_MAKE_FOURCC ('v', '3', '0', '8'):
       return GST_VIDEO_FORMAT_v308;
     case GST_MAKE_FOURCC ('Y', '8', '0', '0'):
@@ -2338,6 +2451,111 @@ gst_video_format_get_info (GstVideoFormat format)
   return &formats[format].info;
 }
 
+/**
+ * gst_video_format_info_unpack_lines:
+ * @info: a #GstVideoFormatInfo
+ * @flags: flags to control the unpacking
+ * @dest: a destination array
+ * @dstride: the stride of the lines in @dest
+ * @data: pointers to the data planes
+ * @stride: strides of the planes
+ * @x: the x position in the image to start from
+ * @y: the y position of the first line to unpack
+ * @width: the amount of pixels to unpack per line
+ * @n_lines: the amount of lines to unpack
+ *
+ * Unpacks @n_lines lines of @width pixels, starting from line @y, into
+ * @dest. Each line is written @dstride bytes after the previous one.
+ *
+ * The result is the same as calling the unpack function of @info for each
+ * of the lines but formats can process all the lines in one go.
+ *
+ * Since: 1.2
+ */
+void
+gst_video_format_info_unpack_lines (const GstVideoFormatInfo * info,
+    GstVideoPackFlags flags, gpointer dest, gint dstride,
+    const gpointer data[GST_VIDEO_MAX_PLANES],
+    const gint stride[GST_VIDEO_MAX_PLANES], gint x, gint y, gint width,
+    gint n_lines)
+{
+  gint i;
+
+  g_return_if_fail (info != NULL);
+  g_return_if_fail (info->unpack_func != NULL);
+
+  if (info->unpack_func == unpack_copy4 || info->unpack_func == unpack_copy8) {
+    gsize size = width * (info->unpack_func == unpack_copy4 ? 4 : 8);
+
+    /* contiguous lines can be copied at once */
+    if (dstride == stride[0] && size == (gsize) dstride) {
+      memcpy (dest, GET_LINE (y), size * n_lines);
+    } else {
+      for (i = 0; i < n_lines; i++)
+        memcpy ((guint8 *) dest + i * dstride, GET_LINE (y + i), size);
+    }
+    return;
+  }
+
+  for (i = 0; i < n_lines; i++)
+    info->unpack_func (info, flags, (guint8 *) dest + i * dstride, data,
+        stride, x, y + i, width);
+}
+
+/**
+ * gst_video_format_info_pack_lines:
+ * @info: a #GstVideoFormatInfo
+ * @flags: flags to control the packing
+ * @src: a source array
+ * @sstride: the stride of the lines in @src
+ * @data: pointers to the destination data planes
+ * @stride: strides of the destination planes
+ * @chroma_site: the chroma siting of the target when subsampled (not used)
+ * @y: the y position of the first line to pack to
+ * @width: the amount of pixels to pack per line
+ * @n_lines: the amount of lines to pack
+ *
+ * Packs @n_lines lines of @width pixels from @src, where each line is
+ * @sstride bytes after the previous one, to the planes in @data starting
+ * from line @y.
+ *
+ * @y and @n_lines should be a multiple of the pack_lines of @info. The
+ * result is the same as calling the pack function of @info for each group
+ * of pack_lines lines but formats can process all the lines in one go.
+ *
+ * Since: 1.2
+ */
+void
+gst_video_format_info_pack_lines (const GstVideoFormatInfo * info,
+    GstVideoPackFlags flags, const gpointer src, gint sstride,
+    gpointer data[GST_VIDEO_MAX_PLANES],
+    const gint stride[GST_VIDEO_MAX_PLANES], GstVideoChromaSite chroma_site,
+    gint y, gint width, gint n_lines)
+{
+  gint i;
+
+  g_return_if_fail (info != NULL);
+  g_return_if_fail (info->pack_func != NULL);
+  g_return_if_fail (y % info->pack_lines == 0);
+  g_return_if_fail (n_lines % info->pack_lines == 0);
+
+  if (info->pack_func == pack_copy4 || info->pack_func == pack_copy8) {
+    gsize size = width * (info->pack_func == pack_copy4 ? 4 : 8);
+
+    if (sstride == stride[0] && size == (gsize) sstride) {
+      memcpy (GET_LINE (y), src, size * n_lines);
+    } else {
+      for (i = 0; i < n_lines; i++)
+        memcpy (GET_LINE (y + i), (guint8 *) src + i * sstride, size);
+    }
+    return;
+  }
+
+  for (i = 0; i < n_lines; i += info->pack_lines)
+    info->pack_func (info, flags, (guint8 *) src + i * sstride, sstride, data,
+        stride, chroma_site, y + i, width);
+}
+
 /**
  * gst_video_format_get_palette:
  * @format: a #GstVideoFormat
@@ -80,6 +80,7 @@ G_BEGIN_DECLS
  * @GST_VIDEO_FORMAT_GBR_10BE: planar 4:4:4 RGB, 10 bits per channel
  * @GST_VIDEO_FORMAT_GBR_10LE: planar 4:4:4 RGB, 10 bits per channel
  * @GST_VIDEO_FORMAT_NV16: planar 4:2:2 YUV with interleaved UV plane
+ * @GST_VIDEO_FORMAT_NV12_64Z32: NV12 with 64x32 tiling in zigzag pattern
  *
  * Enum value describing the most common video formats.
  */
@@ -136,6 +137,7 @@ typedef enum {
   GST_VIDEO_FORMAT_GBR_10BE,
   GST_VIDEO_FORMAT_GBR_10LE,
   GST_VIDEO_FORMAT_NV16,
+  GST_VIDEO_FORMAT_NV12_64Z32,
 } GstVideoFormat;
 
 #define GST_VIDEO_MAX_PLANES 4
@@ -161,6 +163,8 @@ typedef struct _GstVideoFormatInfo GstVideoFormatInfo;
  *   can't be described with the usual information in the #GstVideoFormatInfo.
  * @GST_VIDEO_FORMAT_FLAG_UNPACK: This format can be used in a
  *   #GstVideoFormatUnpack and #GstVideoFormatPack function.
+ * @GST_VIDEO_FORMAT_FLAG_TILED: The format is tiled, the stride of the planes
+ *   contains the number of tiles in X and Y. Since: 1.2
  *
  * The different video flags that a format info can have.
  */
@@ -173,7 +177,8 @@ typedef enum
   GST_VIDEO_FORMAT_FLAG_LE       = (1 << 4),
   GST_VIDEO_FORMAT_FLAG_PALETTE  = (1 << 5),
   GST_VIDEO_FORMAT_FLAG_COMPLEX  = (1 << 6),
-  GST_VIDEO_FORMAT_FLAG_UNPACK   = (1 << 7)
+  GST_VIDEO_FORMAT_FLAG_UNPACK   = (1 << 7),
+  GST_VIDEO_FORMAT_FLAG_TILED    = (1 << 8)
 } GstVideoFormatFlags;
 
 /* YUV components */
@@ -194,6 +199,7 @@ typedef enum
 #define GST_VIDEO_COMP_PALETTE  1
 
 #include <gst/video/video-chroma.h>
+#include <gst/video/video-tile.h>
 
 /**
  * GstVideoPackFlags:
@@ -304,6 +310,9 @@ typedef void (*GstVideoFormatPack)           (const GstVideoFormatInfo *info,
  * @unpack_func: an unpack function for this format
  * @pack_lines: the amount of lines that will be packed
  * @pack_func: an pack function for this format
+ * @tile_mode: The tiling mode, Since: 1.2
+ * @tile_ws: The width of a tile, in bytes, represented as a shift, Since: 1.2
+ * @tile_hs: The height of a tile, in bytes, represented as a shift, Since: 1.2
  *
  * Information for a video format.
  */
@@ -328,6 +337,10 @@ struct _GstVideoFormatInfo {
   gint pack_lines;
   GstVideoFormatPack pack_func;
 
+  GstVideoTileMode tile_mode;
+  guint tile_ws;
+  guint tile_hs;
+
   gpointer _gst_reserved[GST_PADDING];
 };
 
@@ -342,6 +355,7 @@ struct _GstVideoFormatInfo {
 #define GST_VIDEO_FORMAT_INFO_IS_LE(info)        ((info)->flags & GST_VIDEO_FORMAT_FLAG_LE)
 #define GST_VIDEO_FORMAT_INFO_HAS_PALETTE(info)  ((info)->flags & GST_VIDEO_FORMAT_FLAG_PALETTE)
 #define GST_VIDEO_FORMAT_INFO_IS_COMPLEX(info)   ((info)->flags & GST_VIDEO_FORMAT_FLAG_COMPLEX)
+#define GST_VIDEO_FORMAT_INFO_IS_TILED(info)     ((info)->flags & GST_VIDEO_FORMAT_FLAG_TILED)
 
 #define GST_VIDEO_FORMAT_INFO_BITS(info)         ((info)->bits)
 #define GST_VIDEO_FORMAT_INFO_N_COMPONENTS(info) ((info)->n_components)
@@ -403,6 +417,20 @@ struct _GstVideoFormatInfo {
 #define GST_VIDEO_FORMAT_INFO_OFFSET(info,offsets,comp) \
   (((offsets)[(info)->plane[comp]]) + (info)->poffset[comp])
 
+/**
+ * GST_VIDEO_FORMAT_INFO_TILE_MODE:
+ *
+ * The #GstVideoTileMode of a tiled format. For tiled formats the stride
+ * of a plane does not contain a number of bytes but the number of tiles
+ * in X and Y, use GST_VIDEO_TILE_X_TILES() and GST_VIDEO_TILE_Y_TILES()
+ * to get them.
+ *
+ * Since: 1.2
+ */
+#define GST_VIDEO_FORMAT_INFO_TILE_MODE(info) ((info)->tile_mode)
+#define GST_VIDEO_FORMAT_INFO_TILE_WS(info) ((info)->tile_ws)
+#define GST_VIDEO_FORMAT_INFO_TILE_HS(info) ((info)->tile_hs)
+
 /* format properties */
 GstVideoFormat gst_video_format_from_masks           (gint depth, gint bpp, gint endianness,
                                                       guint red_mask, guint green_mask,
@@ -419,6 +447,22 @@ const GstVideoFormatInfo *
 
 gconstpointer  gst_video_format_get_palette          (GstVideoFormat format, gsize *size);
 
+/* multi-line packing */
+void           gst_video_format_info_unpack_lines    (const GstVideoFormatInfo *info,
+                                                      GstVideoPackFlags flags,
+                                                      gpointer dest, gint dstride,
+                                                      const gpointer data[GST_VIDEO_MAX_PLANES],
+                                                      const gint stride[GST_VIDEO_MAX_PLANES],
+                                                      gint x, gint y, gint width,
+                                                      gint n_lines);
+void           gst_video_format_info_pack_lines      (const GstVideoFormatInfo *info,
+                                                      GstVideoPackFlags flags,
+                                                      const gpointer src, gint sstride,
+                                                      gpointer data[GST_VIDEO_MAX_PLANES],
+                                                      const gint stride[GST_VIDEO_MAX_PLANES],
+                                                      GstVideoChromaSite chroma_site,
+                                                      gint y, gint width, gint n_lines);
+
 #define GST_VIDEO_SIZE_RANGE "(int) [ 1, max ]"
 #define GST_VIDEO_FPS_RANGE "(fraction) [ 0, max ]"
 
@@ -435,7 +479,7 @@ gconstpointer  gst_video_format_get_palette          (GstVideoFormat format, gsi
     "YVYU, Y444, v210, v216, NV12, NV21, NV16, GRAY8, GRAY16_BE, GRAY16_LE, " \
     "v308, RGB16, BGR16, RGB15, BGR15, UYVP, A420, RGB8P, YUV9, YVU9, " \
     "IYU1, ARGB64, AYUV64, r210, I420_10LE, I420_10BE, I422_10LE, I422_10BE, " \
-    " Y444_10LE, Y444_10BE, GBR, GBR_10LE, GBR_10BE }"
+    " Y444_10LE, Y444_10BE, GBR, GBR_10LE, GBR_10BE, NV12_64Z32 }"
 
 /**
  * GST_VIDEO_CAPS_MAKE:
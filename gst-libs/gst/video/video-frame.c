@@ -26,12 +26,96 @@
 #include <string.h>
 #include <stdio.h>
 
+#if defined (HAVE_EMMINTRIN_H) && defined (__SSE2__)
+#include <emmintrin.h>
+#define HAVE_STREAM_COPY 1
+#endif
+
 #include <gst/video/video.h>
 #include "video-frame.h"
 #include "gstvideometa.h"
 
 GST_DEBUG_CATEGORY_EXTERN (GST_CAT_PERFORMANCE);
 
+/* planes of at least this size are copied with non-temporal stores, they
+ * will not fit in the cache anyway and the destination is often uncached
+ * or write-combined memory */
+#define STREAM_COPY_MIN_SIZE (4 * 1024 * 1024)
+
+/* size of @plane in @info, the lines of all components in the plane */
+static gsize
+video_frame_plane_size (GstVideoInfo * info, guint plane)
+{
+  guint c;
+
+  if (GST_VIDEO_FORMAT_INFO_IS_TILED (info->finfo)) {
+    gint stride = info->stride[plane];
+
+    return (gsize) (GST_VIDEO_TILE_X_TILES (stride) *
+        GST_VIDEO_TILE_Y_TILES (stride)) <<
+        (GST_VIDEO_FORMAT_INFO_TILE_WS (info->finfo) +
+        GST_VIDEO_FORMAT_INFO_TILE_HS (info->finfo));
+  }
+
+  for (c = 0; c < GST_VIDEO_INFO_N_COMPONENTS (info); c++) {
+    if (GST_VIDEO_FORMAT_INFO_PLANE (info->finfo, c) == plane)
+      return info->stride[plane] * GST_VIDEO_INFO_COMP_HEIGHT (info, c);
+  }
+  return 0;
+}
+
+/* map the memory of each plane of @buffer on its own, so that buffers with
+ * the planes in separate memory blocks can be mapped without merging, and
+ * thus copying, the memory. Planes in the same memory block share the
+ * mapping of the first of them. Returns %FALSE when a plane is not contained
+ * in a single memory block. */
+static gboolean
+video_frame_map_planes (GstVideoFrame * frame, GstVideoInfo * info,
+    GstBuffer * buffer, GstMapFlags flags)
+{
+  guint idx[GST_VIDEO_MAX_PLANES];
+  guint i, j, length;
+  gsize size, skip;
+
+  memset (frame->map, 0, sizeof (frame->map));
+
+  for (i = 0; i < GST_VIDEO_INFO_N_PLANES (info); i++) {
+    size = video_frame_plane_size (info, i);
+
+    if (!gst_buffer_find_memory (buffer, info->offset[i], MAX (size, 1),
+            &idx[i], &length, &skip) || length != 1)
+      goto no_plane_memory;
+
+    for (j = 0; j < i; j++) {
+      if (idx[j] == idx[i])
+        break;
+    }
+    if (j < i) {
+      frame->data[i] = (guint8 *) frame->data[j] +
+          (info->offset[i] - info->offset[j]);
+      continue;
+    }
+
+    if (!gst_buffer_map_range (buffer, idx[i], 1, &frame->map[i], flags))
+      goto no_plane_memory;
+
+    frame->data[i] = (guint8 *) frame->map[i].data + skip;
+  }
+  return TRUE;
+
+  /* ERRORS */
+no_plane_memory:
+  {
+    GST_DEBUG ("plane %u is not in a single mappable memory block", i);
+    while (i-- > 0) {
+      if (frame->map[i].memory)
+        gst_buffer_unmap (buffer, &frame->map[i]);
+    }
+    memset (frame->map, 0, sizeof (frame->map));
+    return FALSE;
+  }
+}
+
 /**
  * gst_video_frame_map_id:
  * @frame: pointer to #GstVideoFrame
@@ -90,16 +174,25 @@ gst_video_frame_map_id (GstVideoFrame * frame, GstVideoInfo * info,
     frame->id = id;
     frame->flags = 0;
 
-    if (!gst_buffer_map (buffer, &frame->map[0], flags))
-      goto map_failed;
-
-    /* do some sanity checks */
-    if (frame->map[0].size < info->size)
-      goto invalid_size;
-
-    /* set up pointers */
-    for (i = 0; i < info->finfo->n_planes; i++) {
-      frame->data[i] = frame->map[0].data + info->offset[i];
+    if (gst_buffer_n_memory (buffer) > 1 && info->finfo->n_planes > 1 &&
+        gst_buffer_get_size (buffer) >= info->size &&
+        video_frame_map_planes (frame, info, buffer, flags)) {
+      GST_LOG ("mapped %u planes without merging memory",
+          info->finfo->n_planes);
+    } else {
+      if (!gst_buffer_map (buffer, &frame->map[0], flags))
+        goto map_failed;
+
+      /* do some sanity checks */
+      if (frame->map[0].size < info->size)
+        goto invalid_size;
+
+      /* set up pointers */
+      for (i = 0; i < info->finfo->n_planes; i++) {
+        frame->data[i] = frame->map[0].data + info->offset[i];
+      }
+      /* all planes use the first mapping */
+      memset (&frame->map[1], 0, sizeof (frame->map) - sizeof (frame->map[0]));
     }
   }
   frame->buffer = gst_buffer_ref (buffer);
@@ -194,11 +287,185 @@ gst_video_frame_unmap (GstVideoFrame * frame)
       gst_video_meta_unmap (meta, i, &frame->map[i]);
     }
   } else {
-    gst_buffer_unmap (buffer, &frame->map[0]);
+    /* planes in separately mapped memory blocks have their own mapping */
+    for (i = 0; i < GST_VIDEO_MAX_PLANES; i++) {
+      if (frame->map[i].memory)
+        gst_buffer_unmap (buffer, &frame->map[i]);
+    }
   }
   gst_buffer_unref (buffer);
 }
 
+#ifdef HAVE_STREAM_COPY
+static void
+stream_copy (guint8 * dp, const guint8 * sp, gsize size)
+{
+  gsize head;
+
+  /* align the destination for the streaming stores */
+  head = MIN ((16 - ((guintptr) dp & 15)) & 15, size);
+  memcpy (dp, sp, head);
+  dp += head;
+  sp += head;
+  size -= head;
+
+  for (; size >= 64; size -= 64) {
+    __m128i t0, t1, t2, t3;
+
+    t0 = _mm_loadu_si128 ((const __m128i *) (sp + 0));
+    t1 = _mm_loadu_si128 ((const __m128i *) (sp + 16));
+    t2 = _mm_loadu_si128 ((const __m128i *) (sp + 32));
+    t3 = _mm_loadu_si128 ((const __m128i *) (sp + 48));
+    _mm_stream_si128 ((__m128i *) (dp + 0), t0);
+    _mm_stream_si128 ((__m128i *) (dp + 16), t1);
+    _mm_stream_si128 ((__m128i *) (dp + 32), t2);
+    _mm_stream_si128 ((__m128i *) (dp + 48), t3);
+    dp += 64;
+    sp += 64;
+  }
+  for (; size >= 16; size -= 16) {
+    _mm_stream_si128 ((__m128i *) dp, _mm_loadu_si128 ((const __m128i *) sp));
+    dp += 16;
+    sp += 16;
+  }
+  memcpy (dp, sp, size);
+}
+#endif
+
+/* copy @h lines of @w bytes */
+static void
+copy_lines (guint8 * dp, gint ds, const guint8 * sp, gint ss, guint w,
+    guint h, gboolean streaming)
+{
+  guint j;
+
+  if (h == 0)
+    return;
+
+#ifdef HAVE_STREAM_COPY
+  if (streaming) {
+    if (ds == ss && ss > 0) {
+      stream_copy (dp, sp, (gsize) ss * (h - 1) + w);
+    } else {
+      for (j = 0; j < h; j++) {
+        stream_copy (dp, sp, w);
+        dp += ds;
+        sp += ss;
+      }
+    }
+    /* make the streaming stores visible to other threads */
+    _mm_sfence ();
+    return;
+  }
+#endif
+
+  if (ds == ss && ss > 0) {
+    /* equal strides, the padding can be copied along with the lines */
+    memcpy (dp, sp, (gsize) ss * (h - 1) + w);
+  } else {
+    for (j = 0; j < h; j++) {
+      memcpy (dp, sp, w);
+      dp += ds;
+      sp += ss;
+    }
+  }
+}
+
+typedef struct _CopyJob CopyJob;
+
+typedef struct
+{
+  CopyJob *job;
+  guint8 *dp;
+  const guint8 *sp;
+  gint ds, ss;
+  guint w, h;
+  gboolean streaming;
+} CopyTask;
+
+struct _CopyJob
+{
+  GMutex lock;
+  GCond cond;
+  guint n_pending;
+};
+
+static void
+copy_pool_func (gpointer data, gpointer user_data)
+{
+  CopyTask *task = data;
+  CopyJob *job = task->job;
+
+  copy_lines (task->dp, task->ds, task->sp, task->ss, task->w, task->h,
+      task->streaming);
+
+  g_mutex_lock (&job->lock);
+  if (--job->n_pending == 0)
+    g_cond_signal (&job->cond);
+  g_mutex_unlock (&job->lock);
+}
+
+static GThreadPool *
+get_copy_pool (void)
+{
+  static volatile gsize pool = 0;
+
+  if (g_once_init_enter (&pool)) {
+    GThreadPool *p;
+    gint n_threads;
+
+#if GLIB_CHECK_VERSION(2,36,0)
+    n_threads = g_get_num_processors ();
+#else
+    n_threads = 4;
+#endif
+    p = g_thread_pool_new (copy_pool_func, NULL, n_threads, FALSE, NULL);
+    g_once_init_leave (&pool, (gsize) p);
+  }
+  return (GThreadPool *) pool;
+}
+
+/* fill in a task for @band of @n_bands of @plane */
+static void
+setup_copy_task (CopyTask * task, GstVideoFrame * dest,
+    const GstVideoFrame * src, guint plane, guint band, guint n_bands)
+{
+  guint w, h, start, end;
+  gint ss, ds;
+
+  ss = src->info.stride[plane];
+  ds = dest->info.stride[plane];
+
+  if (GST_VIDEO_FORMAT_INFO_IS_TILED (dest->info.finfo)) {
+    const GstVideoFormatInfo *finfo = dest->info.finfo;
+
+    /* the tiles are copied as they are, one row of tiles per line */
+    w = GST_VIDEO_TILE_X_TILES (ds) << (GST_VIDEO_FORMAT_INFO_TILE_WS (finfo)
+        + GST_VIDEO_FORMAT_INFO_TILE_HS (finfo));
+    h = GST_VIDEO_TILE_Y_TILES (ds);
+    ss = ds = w;
+  } else {
+    /* FIXME. assumes subsampling of component N is the same as plane N, which
+     * is currently true for all formats we have but it might not be in the
+     * future. */
+    w = GST_VIDEO_FRAME_COMP_WIDTH (dest,
+        plane) * GST_VIDEO_FRAME_COMP_PSTRIDE (dest, plane);
+    h = GST_VIDEO_FRAME_COMP_HEIGHT (dest, plane);
+  }
+
+  start = h * band / n_bands;
+  end = h * (band + 1) / n_bands;
+
+  task->dp = (guint8 *) dest->data[plane] + (gsize) ds * start;
+  task->sp = (const guint8 *) src->data[plane] + (gsize) ss * start;
+  task->ds = ds;
+  task->ss = ss;
+  task->w = w;
+  task->h = end - start;
+  /* decide on the size of the complete plane so that all bands agree */
+  task->streaming = (gsize) w * h >= STREAM_COPY_MIN_SIZE;
+}
+
 /**
  * gst_video_frame_copy_plane:
  * @dest: a #GstVideoFrame
@@ -215,9 +482,7 @@ gst_video_frame_copy_plane (GstVideoFrame * dest, const GstVideoFrame * src,
 {
   const GstVideoInfo *sinfo;
   GstVideoInfo *dinfo;
-  guint w, h, j;
-  guint8 *sp, *dp;
-  gint ss, ds;
+  CopyTask task;
 
   g_return_val_if_fail (dest != NULL, FALSE);
   g_return_val_if_fail (src != NULL, FALSE);
@@ -229,26 +494,18 @@ gst_video_frame_copy_plane (GstVideoFrame * dest, const GstVideoFrame * src,
   g_return_val_if_fail (dinfo->width == sinfo->width
       && dinfo->height == sinfo->height, FALSE);
   g_return_val_if_fail (dinfo->finfo->n_planes > plane, FALSE);
+  /* tiled planes are copied as a whole and need the same layout */
+  g_return_val_if_fail (!GST_VIDEO_FORMAT_INFO_IS_TILED (dinfo->finfo)
+      || dinfo->stride[plane] == sinfo->stride[plane], FALSE);
 
-  sp = src->data[plane];
-  dp = dest->data[plane];
+  setup_copy_task (&task, dest, src, plane, 0, 1);
 
-  ss = sinfo->stride[plane];
-  ds = dinfo->stride[plane];
+  GST_CAT_DEBUG (GST_CAT_PERFORMANCE, "copy plane %d, w:%d h:%d ", plane,
+      task.w, task.h);
 
-  /* FIXME. assumes subsampling of component N is the same as plane N, which is
-   * currently true for all formats we have but it might not be in the future. */
-  w = GST_VIDEO_FRAME_COMP_WIDTH (dest,
-      plane) * GST_VIDEO_FRAME_COMP_PSTRIDE (dest, plane);
-  h = GST_VIDEO_FRAME_COMP_HEIGHT (dest, plane);
+  copy_lines (task.dp, task.ds, task.sp, task.ss, task.w, task.h,
+      task.streaming);
 
-  GST_CAT_DEBUG (GST_CAT_PERFORMANCE, "copy plane %d, w:%d h:%d ", plane, w, h);
-
-  for (j = 0; j < h; j++) {
-    memcpy (dp, sp, w);
-    dp += ds;
-    sp += ss;
-  }
   return TRUE;
 }
 
@@ -264,9 +521,33 @@ gst_video_frame_copy_plane (GstVideoFrame * dest, const GstVideoFrame * src,
 gboolean
 gst_video_frame_copy (GstVideoFrame * dest, const GstVideoFrame * src)
 {
-  guint i, n_planes;
+  return gst_video_frame_copy_threaded (dest, src, 1);
+}
+
+/**
+ * gst_video_frame_copy_threaded:
+ * @dest: a #GstVideoFrame
+ * @src: a #GstVideoFrame
+ * @n_threads: the number of threads to use, 0 uses the number of processors
+ *
+ * Copy the contents from @src to @dest like gst_video_frame_copy() but split
+ * the lines of each plane over @n_threads threads. The calling thread copies
+ * one of the parts and this function returns when all of them are copied.
+ *
+ * Returns: TRUE if the contents could be copied.
+ *
+ * Since: 1.2
+ */
+gboolean
+gst_video_frame_copy_threaded (GstVideoFrame * dest, const GstVideoFrame * src,
+    guint n_threads)
+{
+  guint i, j, n_planes;
   const GstVideoInfo *sinfo;
   GstVideoInfo *dinfo;
+  GThreadPool *pool = NULL;
+  CopyTask *tasks;
+  CopyJob job;
 
   g_return_val_if_fail (dest != NULL, FALSE);
   g_return_val_if_fail (src != NULL, FALSE);
@@ -279,13 +560,64 @@ gst_video_frame_copy (GstVideoFrame * dest, const GstVideoFrame * src)
       && dinfo->height == sinfo->height, FALSE);
 
   n_planes = dinfo->finfo->n_planes;
+  if (GST_VIDEO_FORMAT_INFO_IS_TILED (dinfo->finfo)) {
+    for (i = 0; i < n_planes; i++)
+      g_return_val_if_fail (dinfo->stride[i] == sinfo->stride[i], FALSE);
+  }
   if (GST_VIDEO_FORMAT_INFO_HAS_PALETTE (sinfo->finfo)) {
     memcpy (dest->data[1], src->data[1], 256 * 4);
     n_planes = 1;
   }
 
-  for (i = 0; i < n_planes; i++)
-    gst_video_frame_copy_plane (dest, src, i);
+  if (n_threads == 0) {
+#if GLIB_CHECK_VERSION(2,36,0)
+    n_threads = g_get_num_processors ();
+#else
+    n_threads = 1;
+#endif
+  }
+  /* keep a few lines in each part */
+  n_threads = CLAMP (n_threads, 1, MAX (1, dinfo->height / 16));
+
+  if (n_threads > 1)
+    pool = get_copy_pool ();
+
+  if (pool == NULL) {
+    for (i = 0; i < n_planes; i++)
+      gst_video_frame_copy_plane (dest, src, i);
+    return TRUE;
+  }
+
+  GST_CAT_DEBUG (GST_CAT_PERFORMANCE, "copy frame with %u threads", n_threads);
+
+  tasks = g_newa (CopyTask, n_planes * n_threads);
+
+  g_mutex_init (&job.lock);
+  g_cond_init (&job.cond);
+  job.n_pending = n_planes * n_threads - 1;
+
+  for (i = 0; i < n_planes; i++) {
+    for (j = 0; j < n_threads; j++) {
+      CopyTask *task = &tasks[i * n_threads + j];
+
+      setup_copy_task (task, dest, src, i, j, n_threads);
+      task->job = &job;
+    }
+  }
+  /* the first part is copied from this thread */
+  for (i = 1; i < n_planes * n_threads; i++)
+    g_thread_pool_push (pool, &tasks[i], NULL);
+
+  copy_lines (tasks[0].dp, tasks[0].ds, tasks[0].sp, tasks[0].ss, tasks[0].w,
+      tasks[0].h, tasks[0].streaming);
+
+  g_mutex_lock (&job.lock);
+  while (job.n_pending > 0)
+    g_cond_wait (&job.cond, &job.lock);
+  g_mutex_unlock (&job.lock);
+
+  g_cond_clear (&job.cond);
+  g_mutex_clear (&job.lock);
 
   return TRUE;
 }
@@ -139,6 +139,45 @@ gst_interlace_mode_from_string (const gchar * mode)
   return GST_VIDEO_INTERLACE_MODE_PROGRESSIVE;
 }
 
+/* per thread, the last few caps that were parsed successfully.
+ * Negotiation and allocation queries parse the same caps over and over. An
+ * entry is found by the caps pointer and only used if its structure is still
+ * equal to the one that was parsed, so caps that were changed in place or
+ * freed and replaced at the same address are parsed again. Comparing the
+ * structure needs no field name lookups and no format string search. */
+#define VIDEO_INFO_CACHE_SIZE 4
+
+static gboolean video_info_parse_caps (GstVideoInfo * info,
+    const GstCaps * caps);
+
+typedef struct
+{
+  const GstCaps *caps;
+  GstStructure *structure;
+  GstVideoInfo info;
+} VideoInfoCacheEntry;
+
+typedef struct
+{
+  VideoInfoCacheEntry entries[VIDEO_INFO_CACHE_SIZE];
+  guint next;
+} VideoInfoCache;
+
+static void
+video_info_cache_free (VideoInfoCache * cache)
+{
+  guint i;
+
+  for (i = 0; i < VIDEO_INFO_CACHE_SIZE; i++) {
+    if (cache->entries[i].structure)
+      gst_structure_free (cache->entries[i].structure);
+  }
+  g_free (cache);
+}
+
+static GPrivate video_info_cache =
+G_PRIVATE_INIT ((GDestroyNotify) video_info_cache_free);
+
 /**
  * gst_video_info_from_caps:
  * @info: a #GstVideoInfo
@@ -151,12 +190,10 @@ gst_interlace_mode_from_string (const gchar * mode)
 gboolean
 gst_video_info_from_caps (GstVideoInfo * info, const GstCaps * caps)
 {
+  VideoInfoCache *cache;
+  VideoInfoCacheEntry *entry;
   GstStructure *structure;
-  const gchar *s;
-  GstVideoFormat format = GST_VIDEO_FORMAT_UNKNOWN;
-  gint width = 0, height = 0, views;
-  gint fps_n, fps_d;
-  gint par_n, par_d;
+  guint i;
 
   g_return_val_if_fail (info != NULL, FALSE);
   g_return_val_if_fail (caps != NULL, FALSE);
@@ -166,6 +203,48 @@ gst_video_info_from_caps (GstVideoInfo * info, const GstCaps * caps)
 
   structure = gst_caps_get_structure (caps, 0);
 
+  cache = g_private_get (&video_info_cache);
+  if (cache) {
+    for (i = 0; i < VIDEO_INFO_CACHE_SIZE; i++) {
+      entry = &cache->entries[i];
+      if (entry->caps == caps &&
+          gst_structure_is_equal (entry->structure, structure)) {
+        *info = entry->info;
+        return TRUE;
+      }
+    }
+  }
+
+  if (!video_info_parse_caps (info, caps))
+    return FALSE;
+
+  if (cache == NULL) {
+    cache = g_new0 (VideoInfoCache, 1);
+    g_private_set (&video_info_cache, cache);
+  }
+  entry = &cache->entries[cache->next];
+  if (entry->structure)
+    gst_structure_free (entry->structure);
+  entry->caps = caps;
+  entry->structure = gst_structure_copy (structure);
+  entry->info = *info;
+  cache->next = (cache->next + 1) % VIDEO_INFO_CACHE_SIZE;
+
+  return TRUE;
+}
+
+static gboolean
+video_info_parse_caps (GstVideoInfo * info, const GstCaps * caps)
+{
+  GstStructure *structure;
+  const gchar *s;
+  GstVideoFormat format = GST_VIDEO_FORMAT_UNKNOWN;
+  gint width = 0, height = 0, views;
+  gint fps_n, fps_d;
+  gint par_n, par_d;
+
+  structure = gst_caps_get_structure (caps, 0);
+
   if (gst_structure_has_name (structure, "video/x-raw")) {
     if (!(s = gst_structure_get_string (structure, "format")))
       goto no_format;
@@ -502,6 +581,20 @@ fill_planes (GstVideoInfo * info)
       info->offset[1] = info->stride[0] * height;
       info->size = info->stride[0] * height * 2;
       break;
+    case GST_VIDEO_FORMAT_NV12_64Z32:
+      /* the strides contain the number of 64x32 tiles, the UV plane has
+       * half the height so it uses tiles of twice the height in lines */
+      info->stride[0] =
+          GST_VIDEO_TILE_MAKE_STRIDE (GST_ROUND_UP_128 (width) / 64,
+          GST_ROUND_UP_32 (height) / 32);
+      info->stride[1] =
+          GST_VIDEO_TILE_MAKE_STRIDE (GST_ROUND_UP_128 (width) / 64,
+          GST_ROUND_UP_64 (height) / 64);
+      info->offset[0] = 0;
+      info->offset[1] = GST_ROUND_UP_128 (width) * GST_ROUND_UP_32 (height);
+      info->size = info->offset[1] +
+          GST_ROUND_UP_128 (width) * GST_ROUND_UP_64 (height) / 2;
+      break;
     case GST_VIDEO_FORMAT_A420:
       info->stride[0] = GST_ROUND_UP_4 (width);
       info->stride[1] = GST_ROUND_UP_4 (GST_ROUND_UP_2 (width) / 2);
@@ -741,9 +834,16 @@ gst_video_info_align (GstVideoInfo * info, GstVideoAlignment * align)
     /* check alignment */
     aligned = TRUE;
     for (i = 0; i < n_planes; i++) {
-      GST_LOG ("plane %d, stride %d, alignment %u", i, info->stride[i],
+      gint stride = info->stride[i];
+
+      /* for tiled formats, align the bytes in a row of tiles */
+      if (GST_VIDEO_FORMAT_INFO_IS_TILED (vinfo))
+        stride = GST_VIDEO_TILE_X_TILES (stride) <<
+            GST_VIDEO_FORMAT_INFO_TILE_WS (vinfo);
+
+      GST_LOG ("plane %d, stride %d, alignment %u", i, stride,
           align->stride_align[i]);
-      aligned &= (info->stride[i] & align->stride_align[i]) == 0;
+      aligned &= (stride & align->stride_align[i]) == 0;
     }
     if (aligned)
       break;
@@ -758,6 +858,11 @@ gst_video_info_align (GstVideoInfo * info, GstVideoAlignment * align)
   info->width = width;
   info->height = height;
 
+  /* the data of a tiled plane starts with the first tile, the padding can
+   * only be on the right and bottom side */
+  if (GST_VIDEO_FORMAT_INFO_IS_TILED (vinfo))
+    return;
+
   for (i = 0; i < n_planes; i++) {
     gint vedge, hedge, comp;
 
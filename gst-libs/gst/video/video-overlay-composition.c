@@ -422,12 +422,10 @@ gst_video_overlay_composition_get_rectangle (GstVideoOverlayComposition * comp,
   return comp->rectangles[n];
 }
 
-static gboolean
-gst_video_overlay_rectangle_needs_scaling (GstVideoOverlayRectangle * r)
-{
-  return (GST_VIDEO_INFO_WIDTH (&r->info) != r->render_width ||
-      GST_VIDEO_INFO_HEIGHT (&r->info) != r->render_height);
-}
+static GstVideoOverlayRectangle
+    * gst_video_overlay_rectangle_get_variant (GstVideoOverlayRectangle *
+    rectangle, GstVideoOverlayFormatFlags flags, gboolean unscaled,
+    GstVideoFormat wanted_format);
 
 /**
  * gst_video_overlay_composition_blend:
@@ -446,11 +444,8 @@ gboolean
 gst_video_overlay_composition_blend (GstVideoOverlayComposition * comp,
     GstVideoFrame * video_buf)
 {
-  GstVideoInfo scaled_info;
-  GstVideoInfo *vinfo;
   GstVideoFrame rectangle_frame;
   GstVideoFormat fmt;
-  GstBuffer *pixels = NULL;
   gboolean ret = TRUE;
   guint n, num;
   int w, h;
@@ -467,8 +462,8 @@ gst_video_overlay_composition_blend (GstVideoOverlayComposition * comp,
       "(%ux%u, format %u)", comp, num, video_buf, w, h, fmt);
 
   for (n = 0; n < num; ++n) {
-    GstVideoOverlayRectangle *rect;
-    gboolean needs_scaling;
+    GstVideoOverlayRectangle *rect, *scaled_rect;
+    GstVideoOverlayFormatFlags flags;
 
     rect = comp->rectangles[n];
 
@@ -476,17 +471,16 @@ gst_video_overlay_composition_blend (GstVideoOverlayComposition * comp,
         GST_VIDEO_INFO_WIDTH (&rect->info), GST_VIDEO_INFO_HEIGHT (&rect->info),
         GST_VIDEO_INFO_FORMAT (&rect->info));
 
-    needs_scaling = gst_video_overlay_rectangle_needs_scaling (rect);
-    if (needs_scaling) {
-      gst_video_blend_scale_linear_RGBA (&rect->info, rect->pixels,
-          rect->render_height, rect->render_width, &scaled_info, &pixels);
-      vinfo = &scaled_info;
-    } else {
-      pixels = gst_buffer_ref (rect->pixels);
-      vinfo = &rect->info;
-    }
+    /* get the scaled pixels from the cache of the rectangle so that we only
+     * scale once and not for every frame, gst_video_blend() applies the
+     * global alpha itself */
+    flags = (rect->flags & GST_VIDEO_OVERLAY_FORMAT_FLAG_PREMULTIPLIED_ALPHA) |
+        GST_VIDEO_OVERLAY_FORMAT_FLAG_GLOBAL_ALPHA;
+    scaled_rect = gst_video_overlay_rectangle_get_variant (rect, flags, FALSE,
+        GST_VIDEO_INFO_FORMAT (&rect->info));
 
-    gst_video_frame_map (&rectangle_frame, vinfo, pixels, GST_MAP_READ);
+    gst_video_frame_map (&rectangle_frame, &scaled_rect->info,
+        scaled_rect->pixels, GST_MAP_READ);
 
     ret = gst_video_blend (video_buf, &rectangle_frame, rect->x, rect->y,
         rect->global_alpha);
@@ -494,9 +488,6 @@ gst_video_overlay_composition_blend (GstVideoOverlayComposition * comp,
     if (!ret) {
       GST_WARNING ("Could not blend overlay rectangle onto video buffer");
     }
-
-    /* FIXME: should cache scaled pixels in the rectangle struct */
-    gst_buffer_unref (pixels);
   }
 
   return ret;
@@ -1105,9 +1096,11 @@ gst_video_overlay_rectangle_convert (GstVideoInfo * src, GstBuffer * src_buffer,
   gst_video_frame_unmap (&dest_frame);
 }
 
-static GstBuffer *
-gst_video_overlay_rectangle_get_pixels_raw_internal (GstVideoOverlayRectangle *
-    rectangle, GstVideoOverlayFormatFlags flags, gboolean unscaled,
+/* returns @rectangle or the variant from its cache with the pixels in the
+ * wanted format, size and alpha type, creating and caching it if needed */
+static GstVideoOverlayRectangle *
+gst_video_overlay_rectangle_get_variant (GstVideoOverlayRectangle * rectangle,
+    GstVideoOverlayFormatFlags flags, gboolean unscaled,
     GstVideoFormat wanted_format)
 {
   GstVideoOverlayFormatFlags new_flags;
@@ -1149,7 +1142,7 @@ gst_video_overlay_rectangle_get_pixels_raw_internal (GstVideoOverlayRectangle *
     if ((!apply_global_alpha
             || rectangle->applied_global_alpha == rectangle->global_alpha)
         && (!revert_global_alpha || rectangle->applied_global_alpha == 1.0)) {
-      return rectangle->pixels;
+      return rectangle;
     } else {
       /* only apply/revert global-alpha */
       scaled_rect = rectangle;
@@ -1177,14 +1170,18 @@ gst_video_overlay_rectangle_get_pixels_raw_internal (GstVideoOverlayRectangle *
   if (scaled_rect != NULL)
     goto done;
 
-  /* maybe have one in the right format though */
+  /* maybe have one in the right format though, only unscaled ones with the
+   * original alpha type, we scale and (un)premultiply from there */
   if (format != wanted_format) {
     GST_RECTANGLE_LOCK (rectangle);
     for (l = rectangle->scaled_rectangles; l != NULL; l = l->next) {
       GstVideoOverlayRectangle *r = l->data;
 
       if (GST_VIDEO_INFO_FORMAT (&r->info) == wanted_format &&
-          gst_video_overlay_rectangle_is_same_alpha_type (r->flags, flags)) {
+          GST_VIDEO_INFO_WIDTH (&r->info) == width &&
+          GST_VIDEO_INFO_HEIGHT (&r->info) == height &&
+          gst_video_overlay_rectangle_is_same_alpha_type (r->flags,
+              rectangle->flags)) {
         /* we'll keep these rectangles around until finalize, so it's ok not
          * to take our own ref here */
         conv_rect = r;
@@ -1206,7 +1203,7 @@ gst_video_overlay_rectangle_get_pixels_raw_internal (GstVideoOverlayRectangle *
     conv_rect = gst_video_overlay_rectangle_new_raw (buf,
         0, 0, width, height, rectangle->flags);
     if (rectangle->global_alpha != 1.0)
-      gst_video_overlay_rectangle_set_global_alpha (scaled_rect,
+      gst_video_overlay_rectangle_set_global_alpha (conv_rect,
           rectangle->global_alpha);
     gst_buffer_unref (buf);
     /* keep this converted one around as well in any case */
@@ -1282,7 +1279,22 @@ done:
   }
   GST_RECTANGLE_UNLOCK (rectangle);
 
-  return scaled_rect->pixels;
+  return scaled_rect;
+}
+
+static GstBuffer *
+gst_video_overlay_rectangle_get_pixels_raw_internal (GstVideoOverlayRectangle *
+    rectangle, GstVideoOverlayFormatFlags flags, gboolean unscaled,
+    GstVideoFormat wanted_format)
+{
+  GstVideoOverlayRectangle *variant;
+
+  variant = gst_video_overlay_rectangle_get_variant (rectangle, flags,
+      unscaled, wanted_format);
+  if (variant == NULL)
+    return NULL;
+
+  return variant->pixels;
 }
 
 
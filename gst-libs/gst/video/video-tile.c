@@ -0,0 +1,70 @@
+/* GStreamer
+ * Copyright (C) 2013 Wim Taymans <wim.taymans@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "video-tile.h"
+
+/**
+ * gst_video_tile_get_index:
+ * @mode: a #GstVideoTileMode
+ * @x: x coordinate
+ * @y: y coordinate
+ * @x_tiles: number of horizontal tiles
+ * @y_tiles: number of vertical tiles
+ *
+ * Get the tile index of the tile at coordinates @x and @y in the tiled
+ * image of @x_tiles by @y_tiles.
+ *
+ * Use this method when @mode is of type %GST_VIDEO_TILE_TYPE_INDEXED.
+ *
+ * Returns: the index of the tile at @x and @y in the tiled image of
+ *   @x_tiles by @y_tiles.
+ *
+ * Since: 1.2
+ */
+guint
+gst_video_tile_get_index (GstVideoTileMode mode, gint x, gint y,
+    gint x_tiles, gint y_tiles)
+{
+  gsize offset;
+
+  g_return_val_if_fail (GST_VIDEO_TILE_MODE_IS_INDEXED (mode), 0);
+
+  switch (mode) {
+    case GST_VIDEO_TILE_MODE_ZFLIPZ_2X2:
+      /* Common cases */
+      offset = (y & ~1) * x_tiles + x;
+
+      if (y & 1) {
+        /* For odd rows */
+        offset += (x & ~3) + 2;
+      } else if ((y_tiles & 1) == 0 || y != (y_tiles - 1)) {
+        /* For even rows except for the last row when odd height */
+        offset += ((x + 2) & ~3);
+      }
+      break;
+    default:
+      offset = 0;
+      break;
+  }
+  return offset;
+}
@@ -95,6 +95,7 @@ G_END_DECLS
 #include <gst/video/gstvideoutils.h>
 #include <gst/video/navigation.h>
 #include <gst/video/video-blend.h>
+#include <gst/video/video-converter.h>
 #include <gst/video/video-event.h>
 #include <gst/video/videoorientation.h>
 #include <gst/video/video-overlay-composition.h>
@@ -29,6 +29,11 @@
  * The adder currently mixes all data received on the sinkpads as soon as
  * possible without trying to synchronize the streams.
  *
+ * Each sinkpad has a volume and a mute property, so no separate volume element
+ * is needed per stream. For signed and floating point formats, changes of
+ * these properties are ramped over the next buffer and controlled values are
+ * applied per sample.
+ *
  * <refsect2>
  * <title>Example launch line</title>
  * |[
@@ -122,6 +127,17 @@ gst_adder_pad_set_property (GObject * object, guint prop_id,
   }
 }
 
+static void
+gst_adder_pad_finalize (GObject * object)
+{
+  GstAdderPad *pad = GST_ADDER_PAD (object);
+
+  g_free (pad->volumes);
+  g_free (pad->mutes);
+
+  G_OBJECT_CLASS (gst_adder_pad_parent_class)->finalize (object);
+}
+
 static void
 gst_adder_pad_class_init (GstAdderPadClass * klass)
 {
@@ -129,6 +145,7 @@ gst_adder_pad_class_init (GstAdderPadClass * klass)
 
   gobject_class->set_property = gst_adder_pad_set_property;
   gobject_class->get_property = gst_adder_pad_get_property;
+  gobject_class->finalize = gst_adder_pad_finalize;
 
   g_object_class_install_property (gobject_class, PROP_PAD_VOLUME,
       g_param_spec_double ("volume", "Volume", "Volume of this pad",
@@ -145,6 +162,7 @@ gst_adder_pad_init (GstAdderPad * pad)
 {
   pad->volume = DEFAULT_PAD_VOLUME;
   pad->mute = DEFAULT_PAD_MUTE;
+  pad->last_volume = -1.0;
 }
 
 enum
@@ -945,6 +963,7 @@ gst_adder_init (GstAdder * adder)
   adder->padcount = 0;
 
   adder->filter_caps = NULL;
+  adder->mix_inputs = g_array_new (FALSE, FALSE, sizeof (GstAdderMixInput));
 
   /* keep track of the sinkpads requested */
   adder->collect = gst_collect_pads_new ();
@@ -970,6 +989,11 @@ gst_adder_dispose (GObject * object)
   gst_caps_replace (&adder->filter_caps, NULL);
   gst_caps_replace (&adder->current_caps, NULL);
 
+  if (adder->mix_inputs) {
+    g_array_free (adder->mix_inputs, TRUE);
+    adder->mix_inputs = NULL;
+  }
+
   if (adder->pending_events) {
     g_list_foreach (adder->pending_events, (GFunc) gst_event_unref, NULL);
     g_list_free (adder->pending_events);
@@ -1114,6 +1138,420 @@ gst_adder_do_clip (GstCollectPads * pads, GstCollectData * data,
   return GST_FLOW_OK;
 }
 
+/* With at least this many inputs, including the first one that is already in
+ * the output buffer, all inputs are summed in one pass over blocks of samples
+ * in a wider accumulator and clipped once at the end. Fewer inputs are added
+ * to the output one after another, unless one of them has per-frame
+ * volumes. */
+#define MIX_MIN_INPUTS 3
+#define MIX_BLOCK_SIZE 512
+
+#define MAKE_MIX_INT_FUNC(name, type, acctype, volume, unity, shift, min, max) \
+static void                                                                 \
+adder_mix_##name (type * out, const GstAdderMixInput * inputs,             \
+    guint n_inputs, guint channels, guint n_samples)                        \
+{                                                                           \
+  acctype acc[MIX_BLOCK_SIZE];                                              \
+  guint n_frames = n_samples / channels;                                    \
+  guint s, i, j, n;                                                         \
+                                                                            \
+  for (s = 0; s < n_samples; s += n) {                                      \
+    n = MIN (MIX_BLOCK_SIZE, n_samples - s);                                \
+                                                                            \
+    for (i = 0; i < n; i++)                                                 \
+      acc[i] = out[s + i];                                                  \
+    for (j = 0; j < n_inputs; j++) {                                        \
+      const type *in = ((const type *) inputs[j].map.data) + s;             \
+      const gdouble *volumes = inputs[j].volumes;                           \
+      acctype vol = inputs[j].volume;                                       \
+                                                                            \
+      if (volumes) {                                                        \
+        guint f = s / channels, c = s % channels;                           \
+                                                                            \
+        vol = volumes[f] * unity;                                           \
+        for (i = 0; i < n; i++) {                                           \
+          acc[i] += (in[i] * vol) >> shift;                                 \
+          if (++c == channels) {                                            \
+            c = 0;                                                          \
+            if (++f < n_frames)                                             \
+              vol = volumes[f] * unity;                                     \
+          }                                                                 \
+        }                                                                   \
+      } else if (vol == unity) {                                            \
+        for (i = 0; i < n; i++)                                             \
+          acc[i] += in[i];                                                  \
+      } else {                                                              \
+        for (i = 0; i < n; i++)                                             \
+          acc[i] += (in[i] * vol) >> shift;                                 \
+      }                                                                     \
+    }                                                                       \
+    for (i = 0; i < n; i++)                                                 \
+      out[s + i] = CLAMP (acc[i], min, max);                                \
+  }                                                                         \
+}                                                                           \
+                                                                            \
+static void                                                                 \
+adder_apply_volumes_##name (type * data, const gdouble * volumes,          \
+    guint channels, guint n_frames)                                         \
+{                                                                           \
+  guint f, c;                                                               \
+                                                                            \
+  for (f = 0; f < n_frames; f++) {                                          \
+    acctype vol = volumes[f] * unity;                                       \
+                                                                            \
+    for (c = 0; c < channels; c++, data++)                                  \
+      *data = CLAMP ((*data * vol) >> shift, min, max);                     \
+  }                                                                         \
+}
+
+#define MAKE_MIX_FLOAT_FUNC(name, type)                                     \
+static void                                                                 \
+adder_mix_##name (type * out, const GstAdderMixInput * inputs,             \
+    guint n_inputs, guint channels, guint n_samples)                        \
+{                                                                           \
+  type acc[MIX_BLOCK_SIZE];                                                 \
+  guint n_frames = n_samples / channels;                                    \
+  guint s, i, j, n;                                                         \
+                                                                            \
+  for (s = 0; s < n_samples; s += n) {                                      \
+    n = MIN (MIX_BLOCK_SIZE, n_samples - s);                                \
+                                                                            \
+    for (i = 0; i < n; i++)                                                 \
+      acc[i] = out[s + i];                                                  \
+    for (j = 0; j < n_inputs; j++) {                                        \
+      const type *in = ((const type *) inputs[j].map.data) + s;             \
+      const gdouble *volumes = inputs[j].volumes;                           \
+      type vol = inputs[j].volume;                                          \
+                                                                            \
+      if (volumes) {                                                        \
+        guint f = s / channels, c = s % channels;                           \
+                                                                            \
+        vol = volumes[f];                                                   \
+        for (i = 0; i < n; i++) {                                           \
+          acc[i] += in[i] * vol;                                            \
+          if (++c == channels) {                                            \
+            c = 0;                                                          \
+            if (++f < n_frames)                                             \
+              vol = volumes[f];                                             \
+          }                                                                 \
+        }                                                                   \
+      } else if (inputs[j].volume == 1.0) {                                 \
+        for (i = 0; i < n; i++)                                             \
+          acc[i] += in[i];                                                  \
+      } else {                                                              \
+        for (i = 0; i < n; i++)                                             \
+          acc[i] += in[i] * vol;                                            \
+      }                                                                     \
+    }                                                                       \
+    for (i = 0; i < n; i++)                                                 \
+      out[s + i] = acc[i];                                                  \
+  }                                                                         \
+}                                                                           \
+                                                                            \
+static void                                                                 \
+adder_apply_volumes_##name (type * data, const gdouble * volumes,          \
+    guint channels, guint n_frames)                                         \
+{                                                                           \
+  guint f, c;                                                               \
+                                                                            \
+  for (f = 0; f < n_frames; f++) {                                          \
+    type vol = volumes[f];                                                  \
+                                                                            \
+    for (c = 0; c < channels; c++, data++)                                  \
+      *data *= vol;                                                         \
+  }                                                                         \
+}
+
+MAKE_MIX_INT_FUNC (s8, gint8, gint32, volume_i8, VOLUME_UNITY_INT8,
+    VOLUME_UNITY_INT8_BIT_SHIFT, G_MININT8, G_MAXINT8);
+MAKE_MIX_INT_FUNC (s16, gint16, gint32, volume_i16, VOLUME_UNITY_INT16,
+    VOLUME_UNITY_INT16_BIT_SHIFT, G_MININT16, G_MAXINT16);
+MAKE_MIX_INT_FUNC (s32, gint32, gint64, volume_i32, VOLUME_UNITY_INT32,
+    VOLUME_UNITY_INT32_BIT_SHIFT, G_MININT32, G_MAXINT32);
+MAKE_MIX_FLOAT_FUNC (f32, gfloat);
+MAKE_MIX_FLOAT_FUNC (f64, gdouble);
+
+/* Per-frame volumes are only applied for the formats that have a mixing
+ * function above, unsigned formats change their volume once per buffer. */
+static gboolean
+gst_adder_has_frame_volumes (GstAdder * adder)
+{
+  switch (adder->info.finfo->format) {
+    case GST_AUDIO_FORMAT_S8:
+    case GST_AUDIO_FORMAT_S16:
+    case GST_AUDIO_FORMAT_S32:
+    case GST_AUDIO_FORMAT_F32:
+    case GST_AUDIO_FORMAT_F64:
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+enum
+{
+  ADDER_CONTROLLED_VOLUME = (1 << 0),
+  ADDER_CONTROLLED_MUTE = (1 << 1)
+};
+
+/* Get the controlled volumes and mutes for the @n_frames frames starting at
+ * @stream_time into pad->volumes and pad->mutes. Must be called without the
+ * pad lock, the values are combined with the pad properties in
+ * gst_adder_pad_get_volumes() afterwards. Returns the ADDER_CONTROLLED_*
+ * flags of the arrays that were filled. */
+
+static guint
+gst_adder_pad_get_controlled_volumes (GstAdderPad * pad,
+    GstClockTime stream_time, gint rate, guint n_frames)
+{
+  GstControlBinding *volume_cb, *mute_cb;
+  GstClockTime interval;
+  guint controlled = 0;
+
+  if (!GST_CLOCK_TIME_IS_VALID (stream_time))
+    return 0;
+
+  volume_cb = gst_object_get_control_binding (GST_OBJECT (pad), "volume");
+  mute_cb = gst_object_get_control_binding (GST_OBJECT (pad), "mute");
+  if (volume_cb == NULL && mute_cb == NULL)
+    return 0;
+
+  interval = gst_util_uint64_scale_int (1, GST_SECOND, rate);
+
+  if (pad->volumes_count < n_frames) {
+    pad->volumes = g_realloc (pad->volumes, sizeof (gdouble) * n_frames);
+    pad->volumes_count = n_frames;
+  }
+  if (volume_cb) {
+    if (gst_control_binding_get_value_array (volume_cb, stream_time, interval,
+            n_frames, (gpointer) pad->volumes))
+      controlled |= ADDER_CONTROLLED_VOLUME;
+    gst_object_unref (volume_cb);
+  }
+
+  if (mute_cb) {
+    if (pad->mutes_count < n_frames) {
+      pad->mutes = g_realloc (pad->mutes, sizeof (gboolean) * n_frames);
+      pad->mutes_count = n_frames;
+    }
+    if (gst_control_binding_get_value_array (mute_cb, stream_time, interval,
+            n_frames, (gpointer) pad->mutes))
+      controlled |= ADDER_CONTROLLED_MUTE;
+    gst_object_unref (mute_cb);
+  }
+
+  return controlled;
+}
+
+/* Returns the per-frame volumes of @pad for a buffer of @n_frames frames, or
+ * NULL when the volume stays at pad->volume (or 0.0 when muted) for the whole
+ * buffer. When the volume or mute property changed since the previous buffer
+ * the volume is ramped linearly over the buffer instead of jumping, which
+ * would be audible as a click. Called with the pad lock. */
+static const gdouble *
+gst_adder_pad_get_volumes (GstAdderPad * pad, guint controlled,
+    guint n_frames)
+{
+  gdouble target = pad->mute ? 0.0 : pad->volume;
+  gdouble start = pad->last_volume;
+  guint i;
+
+  if (n_frames == 0)
+    return NULL;
+
+  if (controlled) {
+    if (!(controlled & ADDER_CONTROLLED_VOLUME)) {
+      for (i = 0; i < n_frames; i++)
+        pad->volumes[i] = pad->volume;
+    }
+    if (controlled & ADDER_CONTROLLED_MUTE) {
+      for (i = 0; i < n_frames; i++) {
+        if (pad->mutes[i])
+          pad->volumes[i] = 0.0;
+      }
+    } else if (pad->mute) {
+      for (i = 0; i < n_frames; i++)
+        pad->volumes[i] = 0.0;
+    }
+    pad->last_volume = pad->volumes[n_frames - 1];
+    return pad->volumes;
+  }
+
+  pad->last_volume = target;
+  if (start < 0.0 || start == target)
+    return NULL;
+
+  if (pad->volumes_count < n_frames) {
+    pad->volumes = g_realloc (pad->volumes, sizeof (gdouble) * n_frames);
+    pad->volumes_count = n_frames;
+  }
+  for (i = 0; i < n_frames; i++)
+    pad->volumes[i] = start + (target - start) * (i + 1) / n_frames;
+
+  return pad->volumes;
+}
+
+static void
+gst_adder_apply_volumes (GstAdder * adder, GstMapInfo * map,
+    const gdouble * volumes)
+{
+  gint channels = GST_AUDIO_INFO_CHANNELS (&adder->info);
+  guint n_frames = map->size / GST_AUDIO_INFO_BPF (&adder->info);
+
+  switch (adder->info.finfo->format) {
+    case GST_AUDIO_FORMAT_S8:
+      adder_apply_volumes_s8 ((gint8 *) map->data, volumes, channels,
+          n_frames);
+      break;
+    case GST_AUDIO_FORMAT_S16:
+      adder_apply_volumes_s16 ((gint16 *) map->data, volumes, channels,
+          n_frames);
+      break;
+    case GST_AUDIO_FORMAT_S32:
+      adder_apply_volumes_s32 ((gint32 *) map->data, volumes, channels,
+          n_frames);
+      break;
+    case GST_AUDIO_FORMAT_F32:
+      adder_apply_volumes_f32 ((gfloat *) map->data, volumes, channels,
+          n_frames);
+      break;
+    case GST_AUDIO_FORMAT_F64:
+      adder_apply_volumes_f64 ((gdouble *) map->data, volumes, channels,
+          n_frames);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+}
+
+/* add the non-GAP inputs collected in adder->mix_inputs to the output */
+static void
+gst_adder_mix_inputs (GstAdder * adder, GstMapInfo * outmap)
+{
+  const GstAdderMixInput *inputs =
+      (const GstAdderMixInput *) adder->mix_inputs->data;
+  guint n_inputs = adder->mix_inputs->len;
+  gint bps = GST_AUDIO_INFO_BPS (&adder->info);
+  gint channels = GST_AUDIO_INFO_CHANNELS (&adder->info);
+  guint n_samples = outmap->size / bps;
+  gboolean have_volumes = FALSE;
+  guint j;
+
+  for (j = 0; j < n_inputs && !have_volumes; j++)
+    have_volumes = inputs[j].volumes != NULL;
+
+  if (n_inputs + 1 >= MIX_MIN_INPUTS || have_volumes) {
+    switch (adder->info.finfo->format) {
+      case GST_AUDIO_FORMAT_S8:
+        adder_mix_s8 ((gint8 *) outmap->data, inputs, n_inputs, channels,
+            n_samples);
+        return;
+      case GST_AUDIO_FORMAT_S16:
+        adder_mix_s16 ((gint16 *) outmap->data, inputs, n_inputs, channels,
+            n_samples);
+        return;
+      case GST_AUDIO_FORMAT_S32:
+        adder_mix_s32 ((gint32 *) outmap->data, inputs, n_inputs, channels,
+            n_samples);
+        return;
+      case GST_AUDIO_FORMAT_F32:
+        adder_mix_f32 ((gfloat *) outmap->data, inputs, n_inputs, channels,
+            n_samples);
+        return;
+      case GST_AUDIO_FORMAT_F64:
+        adder_mix_f64 ((gdouble *) outmap->data, inputs, n_inputs, channels,
+            n_samples);
+        return;
+      default:
+        /* unsigned formats are added one after another */
+        break;
+    }
+  }
+
+  for (j = 0; j < n_inputs; j++) {
+    const GstAdderMixInput *input = &inputs[j];
+
+    if (input->volume == 1.0) {
+      switch (adder->info.finfo->format) {
+        case GST_AUDIO_FORMAT_U8:
+          adder_orc_add_u8 ((gpointer) outmap->data,
+              (gpointer) input->map.data, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_S8:
+          adder_orc_add_s8 ((gpointer) outmap->data,
+              (gpointer) input->map.data, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_U16:
+          adder_orc_add_u16 ((gpointer) outmap->data,
+              (gpointer) input->map.data, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_S16:
+          adder_orc_add_s16 ((gpointer) outmap->data,
+              (gpointer) input->map.data, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_U32:
+          adder_orc_add_u32 ((gpointer) outmap->data,
+              (gpointer) input->map.data, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_S32:
+          adder_orc_add_s32 ((gpointer) outmap->data,
+              (gpointer) input->map.data, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_F32:
+          adder_orc_add_f32 ((gpointer) outmap->data,
+              (gpointer) input->map.data, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_F64:
+          adder_orc_add_f64 ((gpointer) outmap->data,
+              (gpointer) input->map.data, n_samples);
+          break;
+        default:
+          g_assert_not_reached ();
+          break;
+      }
+    } else {
+      switch (adder->info.finfo->format) {
+        case GST_AUDIO_FORMAT_U8:
+          adder_orc_add_volume_u8 ((gpointer) outmap->data,
+              (gpointer) input->map.data, input->volume_i8, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_S8:
+          adder_orc_add_volume_s8 ((gpointer) outmap->data,
+              (gpointer) input->map.data, input->volume_i8, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_U16:
+          adder_orc_add_volume_u16 ((gpointer) outmap->data,
+              (gpointer) input->map.data, input->volume_i16, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_S16:
+          adder_orc_add_volume_s16 ((gpointer) outmap->data,
+              (gpointer) input->map.data, input->volume_i16, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_U32:
+          adder_orc_add_volume_u32 ((gpointer) outmap->data,
+              (gpointer) input->map.data, input->volume_i32, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_S32:
+          adder_orc_add_volume_s32 ((gpointer) outmap->data,
+              (gpointer) input->map.data, input->volume_i32, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_F32:
+          adder_orc_add_volume_f32 ((gpointer) outmap->data,
+              (gpointer) input->map.data, input->volume, n_samples);
+          break;
+        case GST_AUDIO_FORMAT_F64:
+          adder_orc_add_volume_f64 ((gpointer) outmap->data,
+              (gpointer) input->map.data, input->volume, n_samples);
+          break;
+        default:
+          g_assert_not_reached ();
+          break;
+      }
+    }
+  }
+}
+
 static GstFlowReturn
 gst_adder_collected (GstCollectPads * pads, gpointer user_data)
 {
@@ -1143,6 +1581,7 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
   gint64 next_timestamp;
   gint rate, bps, bpf;
   gboolean had_mute = FALSE;
+  gboolean frame_volumes;
 
   adder = GST_ADDER (user_data);
 
@@ -1193,6 +1632,7 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
   rate = GST_AUDIO_INFO_RATE (&adder->info);
   bps = GST_AUDIO_INFO_BPS (&adder->info);
   bpf = GST_AUDIO_INFO_BPF (&adder->info);
+  frame_volumes = gst_adder_has_frame_volumes (adder);
 
   GST_LOG_OBJECT (adder,
       "starting to cycle through channels, %d bytes available (bps = %d, bpf = %d)",
@@ -1204,6 +1644,8 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
     gboolean is_gap;
     GstAdderPad *pad;
     GstClockTime timestamp, stream_time;
+    const gdouble *volumes;
+    guint controlled, n_frames;
 
     /* take next to see if this is the last collectdata */
     next = g_slist_next (collected);
@@ -1230,8 +1672,19 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
     if (GST_CLOCK_TIME_IS_VALID (stream_time))
       gst_object_sync_values (GST_OBJECT (pad), stream_time);
 
+    n_frames = gst_buffer_get_size (inbuf) / bpf;
+    controlled = 0;
+    if (frame_volumes)
+      controlled = gst_adder_pad_get_controlled_volumes (pad, stream_time,
+          rate, n_frames);
+
     GST_OBJECT_LOCK (pad);
-    if (pad->mute || pad->volume < G_MINDOUBLE) {
+    volumes = NULL;
+    if (frame_volumes)
+      volumes = gst_adder_pad_get_volumes (pad, controlled, n_frames);
+
+    /* keep mixing a pad that was just muted while its volume ramps down */
+    if (volumes == NULL && (pad->mute || pad->volume < G_MINDOUBLE)) {
       had_mute = TRUE;
       GST_DEBUG_OBJECT (adder, "channel %p: skipping muted pad", collect_data);
       gst_buffer_unref (inbuf);
@@ -1267,7 +1720,9 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
       outbuf = gst_buffer_make_writable (inbuf);
       gst_buffer_map (outbuf, &outmap, GST_MAP_READWRITE);
 
-      if (pad->volume != 1.0) {
+      if (volumes) {
+        gst_adder_apply_volumes (adder, &outmap, volumes);
+      } else if (pad->volume != 1.0) {
         switch (adder->info.finfo->format) {
           case GST_AUDIO_FORMAT_U8:
             adder_orc_volume_u8 ((gpointer) outmap.data, pad->volume_i8,
@@ -1308,105 +1763,48 @@ gst_adder_collected (GstCollectPads * pads, gpointer user_data)
       }
     } else {
       if (!is_gap) {
-        /* we had a previous output buffer, mix this non-GAP buffer */
-        GstMapInfo inmap;
+        /* we had a previous output buffer, keep this non-GAP buffer to mix
+         * all of them at once below */
+        GstAdderMixInput input;
 
-        gst_buffer_map (inbuf, &inmap, GST_MAP_READ);
+        input.buffer = inbuf;
+        gst_buffer_map (inbuf, &input.map, GST_MAP_READ);
 
         /* all buffers should have outsize, there are no short buffers because we
          * asked for the max size above */
-        g_assert (inmap.size == outmap.size);
+        g_assert (input.map.size == outmap.size);
 
         GST_LOG_OBJECT (adder, "channel %p: mixing %" G_GSIZE_FORMAT " bytes"
-            " from data %p", collect_data, inmap.size, inmap.data);
-
-        /* further buffers, need to add them */
-        if (pad->volume == 1.0) {
-          switch (adder->info.finfo->format) {
-            case GST_AUDIO_FORMAT_U8:
-              adder_orc_add_u8 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S8:
-              adder_orc_add_s8 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_U16:
-              adder_orc_add_u16 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S16:
-              adder_orc_add_s16 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_U32:
-              adder_orc_add_u32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S32:
-              adder_orc_add_s32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_F32:
-              adder_orc_add_f32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_F64:
-              adder_orc_add_f64 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, inmap.size / bps);
-              break;
-            default:
-              g_assert_not_reached ();
-              break;
-          }
-        } else {
-          switch (adder->info.finfo->format) {
-            case GST_AUDIO_FORMAT_U8:
-              adder_orc_add_volume_u8 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i8, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S8:
-              adder_orc_add_volume_s8 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i8, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_U16:
-              adder_orc_add_volume_u16 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i16, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S16:
-              adder_orc_add_volume_s16 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i16, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_U32:
-              adder_orc_add_volume_u32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i32, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_S32:
-              adder_orc_add_volume_s32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume_i32, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_F32:
-              adder_orc_add_volume_f32 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume, inmap.size / bps);
-              break;
-            case GST_AUDIO_FORMAT_F64:
-              adder_orc_add_volume_f64 ((gpointer) outmap.data,
-                  (gpointer) inmap.data, pad->volume, inmap.size / bps);
-              break;
-            default:
-              g_assert_not_reached ();
-              break;
-          }
-        }
-        gst_buffer_unmap (inbuf, &inmap);
+            " from data %p", collect_data, input.map.size, input.map.data);
+
+        input.volume = pad->volume;
+        input.volume_i8 = pad->volume_i8;
+        input.volume_i16 = pad->volume_i16;
+        input.volume_i32 = pad->volume_i32;
+        input.volumes = volumes;
+        g_array_append_val (adder->mix_inputs, input);
       } else {
         /* skip gap buffer */
         GST_LOG_OBJECT (adder, "channel %p: skipping GAP buffer", collect_data);
+        gst_buffer_unref (inbuf);
       }
-      gst_buffer_unref (inbuf);
     }
     GST_OBJECT_UNLOCK (pad);
   }
+  if (adder->mix_inputs->len > 0) {
+    guint i;
+
+    gst_adder_mix_inputs (adder, &outmap);
+
+    for (i = 0; i < adder->mix_inputs->len; i++) {
+      GstAdderMixInput *input =
+          &g_array_index (adder->mix_inputs, GstAdderMixInput, i);
+
+      gst_buffer_unmap (input->buffer, &input->map);
+      gst_buffer_unref (input->buffer);
+    }
+    g_array_set_size (adder->mix_inputs, 0);
+  }
   if (outbuf)
     gst_buffer_unmap (outbuf, &outmap);
 
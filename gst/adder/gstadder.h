@@ -42,6 +42,19 @@ typedef struct _GstAdderClass        GstAdderClass;
 typedef struct _GstAdderPad GstAdderPad;
 typedef struct _GstAdderPadClass GstAdderPadClass;
 
+/* a mapped input buffer and the volume of its pad, for mixing all inputs
+ * at once */
+typedef struct {
+  GstBuffer *buffer;
+  GstMapInfo map;
+  gdouble volume;
+  gint volume_i32;
+  gint volume_i16;
+  gint volume_i8;
+  /* per-frame volumes while the pad volume ramps or is controlled, or NULL */
+  const gdouble *volumes;
+} GstAdderMixInput;
+
 /**
  * GstAdder:
  *
@@ -77,6 +90,9 @@ struct _GstAdder {
   
   gboolean send_stream_start;
   gboolean send_caps;
+
+  /* non-GAP input buffers to mix into the output, GstAdderMixInput */
+  GArray *mix_inputs;
 };
 
 struct _GstAdderClass {
@@ -100,6 +116,14 @@ struct _GstAdderPad {
   gint volume_i16;
   gint volume_i8;
   gboolean mute;
+
+  /* volume at the end of the previous buffer, negative before the first */
+  gdouble last_volume;
+  /* per-frame volumes and mutes of the current buffer */
+  gdouble *volumes;
+  guint volumes_count;
+  gboolean *mutes;
+  guint mutes_count;
 };
 
 struct _GstAdderPadClass {
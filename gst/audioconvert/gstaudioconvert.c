@@ -62,12 +62,11 @@
 #include <string.h>
 
 #include "gstaudioconvert.h"
-#include "gstchannelmix.h"
-#include "gstaudioquantize.h"
 #include "plugin.h"
 
-GST_DEBUG_CATEGORY (audio_convert_debug);
+GST_DEBUG_CATEGORY_STATIC (audio_convert_debug);
 GST_DEBUG_CATEGORY_STATIC (GST_CAT_PERFORMANCE);
+#define GST_CAT_DEFAULT (audio_convert_debug)
 
 /*** DEFINITIONS **************************************************************/
 
@@ -102,6 +101,7 @@ enum
   ARG_0,
   ARG_DITHERING,
   ARG_NOISE_SHAPING,
+  ARG_N_THREADS,
 };
 
 #define DEBUG_INIT \
@@ -137,11 +137,12 @@ gst_audio_convert_dithering_get_type (void)
 
   if (gtype == 0) {
     static const GEnumValue values[] = {
-      {DITHER_NONE, "No dithering",
+      {GST_AUDIO_DITHER_NONE, "No dithering",
           "none"},
-      {DITHER_RPDF, "Rectangular dithering", "rpdf"},
-      {DITHER_TPDF, "Triangular dithering (default)", "tpdf"},
-      {DITHER_TPDF_HF, "High frequency triangular dithering", "tpdf-hf"},
+      {GST_AUDIO_DITHER_RPDF, "Rectangular dithering", "rpdf"},
+      {GST_AUDIO_DITHER_TPDF, "Triangular dithering (default)", "tpdf"},
+      {GST_AUDIO_DITHER_TPDF_HF, "High frequency triangular dithering",
+          "tpdf-hf"},
       {0, NULL, NULL}
     };
 
@@ -158,12 +159,15 @@ gst_audio_convert_ns_get_type (void)
 
   if (gtype == 0) {
     static const GEnumValue values[] = {
-      {NOISE_SHAPING_NONE, "No noise shaping (default)",
+      {GST_AUDIO_NOISE_SHAPING_NONE, "No noise shaping (default)",
           "none"},
-      {NOISE_SHAPING_ERROR_FEEDBACK, "Error feedback", "error-feedback"},
-      {NOISE_SHAPING_SIMPLE, "Simple 2-pole noise shaping", "simple"},
-      {NOISE_SHAPING_MEDIUM, "Medium 5-pole noise shaping", "medium"},
-      {NOISE_SHAPING_HIGH, "High 8-pole noise shaping", "high"},
+      {GST_AUDIO_NOISE_SHAPING_ERROR_FEEDBACK, "Error feedback",
+          "error-feedback"},
+      {GST_AUDIO_NOISE_SHAPING_SIMPLE, "Simple 2-pole noise shaping",
+          "simple"},
+      {GST_AUDIO_NOISE_SHAPING_MEDIUM, "Medium 5-pole noise shaping",
+          "medium"},
+      {GST_AUDIO_NOISE_SHAPING_HIGH, "High 8-pole noise shaping", "high"},
       {0, NULL, NULL}
     };
 
@@ -188,13 +192,20 @@ gst_audio_convert_class_init (GstAudioConvertClass * klass)
   g_object_class_install_property (gobject_class, ARG_DITHERING,
       g_param_spec_enum ("dithering", "Dithering",
           "Selects between different dithering methods.",
-          GST_TYPE_AUDIO_CONVERT_DITHERING, DITHER_TPDF,
+          GST_TYPE_AUDIO_CONVERT_DITHERING, GST_AUDIO_DITHER_TPDF,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   g_object_class_install_property (gobject_class, ARG_NOISE_SHAPING,
       g_param_spec_enum ("noise-shaping", "Noise shaping",
           "Selects between different noise shaping methods.",
-          GST_TYPE_AUDIO_CONVERT_NOISE_SHAPING, NOISE_SHAPING_NONE,
+          GST_TYPE_AUDIO_CONVERT_NOISE_SHAPING,
+          GST_AUDIO_NOISE_SHAPING_NONE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  g_object_class_install_property (gobject_class, ARG_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Maximum number of threads to use for large buffers "
+          "(0 = number of processors)", 0, G_MAXUINT, 1,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gst_element_class_add_pad_template (element_class,
@@ -222,9 +233,9 @@ gst_audio_convert_class_init (GstAudioConvertClass * klass)
 static void
 gst_audio_convert_init (GstAudioConvert * this)
 {
-  this->dither = DITHER_TPDF;
-  this->ns = NOISE_SHAPING_NONE;
-  memset (&this->ctx, 0, sizeof (AudioConvertCtx));
+  this->dither = GST_AUDIO_DITHER_TPDF;
+  this->ns = GST_AUDIO_NOISE_SHAPING_NONE;
+  this->n_threads = 1;
 
   gst_base_transform_set_gap_aware (GST_BASE_TRANSFORM (this), TRUE);
 }
@@ -234,13 +245,26 @@ gst_audio_convert_dispose (GObject * obj)
 {
   GstAudioConvert *this = GST_AUDIO_CONVERT (obj);
 
-  audio_convert_clean_context (&this->ctx);
+  if (this->convert) {
+    gst_audio_converter_free (this->convert);
+    this->convert = NULL;
+  }
 
   G_OBJECT_CLASS (parent_class)->dispose (obj);
 }
 
 /*** GSTREAMER FUNCTIONS ******************************************************/
 
+static GstStructure *
+gst_audio_convert_make_config (GstAudioConvert * this)
+{
+  return gst_structure_new ("GstAudioConvertConfig",
+      GST_AUDIO_CONVERTER_OPT_DITHER_METHOD, GST_TYPE_AUDIO_DITHER_METHOD,
+      this->dither, GST_AUDIO_CONVERTER_OPT_NOISE_SHAPING_METHOD,
+      GST_TYPE_AUDIO_NOISE_SHAPING_METHOD, this->ns,
+      GST_AUDIO_CONVERTER_OPT_THREADS, G_TYPE_UINT, this->n_threads, NULL);
+}
+
 /* BaseTransform vmethods */
 static gboolean
 gst_audio_convert_get_unit_size (GstBaseTransform * base, GstCaps * caps,
@@ -731,6 +755,7 @@ gst_audio_convert_set_caps (GstBaseTransform * base, GstCaps * incaps,
   GstAudioConvert *this = GST_AUDIO_CONVERT (base);
   GstAudioInfo in_info;
   GstAudioInfo out_info;
+  GstStructure *config;
 
   GST_DEBUG_OBJECT (base, "incaps %" GST_PTR_FORMAT ", outcaps %"
       GST_PTR_FORMAT, incaps, outcaps);
@@ -740,10 +765,22 @@ gst_audio_convert_set_caps (GstBaseTransform * base, GstCaps * incaps,
   if (!gst_audio_info_from_caps (&out_info, outcaps))
     goto invalid_out;
 
-  if (!audio_convert_prepare_context (&this->ctx, &in_info, &out_info,
-          this->dither, this->ns))
+  if (this->convert)
+    gst_audio_converter_free (this->convert);
+
+  GST_OBJECT_LOCK (this);
+  config = gst_audio_convert_make_config (this);
+  this->config_changed = FALSE;
+  GST_OBJECT_UNLOCK (this);
+
+  this->convert = gst_audio_converter_new (&in_info, &out_info, config);
+
+  if (this->convert == NULL)
     goto no_converter;
 
+  this->in_info = in_info;
+  this->out_info = out_info;
+
   return TRUE;
 
   /* ERRORS */
@@ -776,12 +813,12 @@ gst_audio_convert_transform (GstBaseTransform * base, GstBuffer * inbuf,
   gint samples;
 
   /* get amount of samples to convert. */
-  samples = gst_buffer_get_size (inbuf) / this->ctx.in.bpf;
+  samples = gst_buffer_get_size (inbuf) / this->in_info.bpf;
 
   /* get in/output sizes, to see if the buffers we got are of correct
    * sizes */
-  if (!audio_convert_get_sizes (&this->ctx, samples, &insize, &outsize))
-    goto error;
+  insize = samples * this->in_info.bpf;
+  outsize = samples * this->out_info.bpf;
 
   if (insize == 0 || outsize == 0)
     return GST_FLOW_OK;
@@ -798,12 +835,26 @@ gst_audio_convert_transform (GstBaseTransform * base, GstBuffer * inbuf,
 
   /* and convert the samples */
   if (!GST_BUFFER_FLAG_IS_SET (inbuf, GST_BUFFER_FLAG_GAP)) {
-    if (!audio_convert_convert (&this->ctx, srcmap.data, dstmap.data,
-            samples, gst_buffer_is_writable (inbuf)))
+    GstStructure *config = NULL;
+
+    /* apply property changes made since the last buffer, outside of the
+     * lock because the converter may have to start or stop threads */
+    GST_OBJECT_LOCK (this);
+    if (G_UNLIKELY (this->config_changed)) {
+      config = gst_audio_convert_make_config (this);
+      this->config_changed = FALSE;
+    }
+    GST_OBJECT_UNLOCK (this);
+
+    if (config)
+      gst_audio_converter_set_config (this->convert, config);
+
+    if (!gst_audio_converter_samples (this->convert, srcmap.data,
+            dstmap.data, samples, gst_buffer_is_writable (inbuf)))
       goto convert_error;
   } else {
     /* Create silence buffer */
-    gst_audio_format_fill_silence (this->ctx.out.finfo, dstmap.data, outsize);
+    gst_audio_format_fill_silence (this->out_info.finfo, dstmap.data, outsize);
   }
   ret = GST_FLOW_OK;
 
@@ -814,12 +865,6 @@ done:
   return ret;
 
   /* ERRORS */
-error:
-  {
-    GST_ELEMENT_ERROR (this, STREAM, FORMAT,
-        (NULL), ("cannot get input/output sizes for %d samples", samples));
-    return GST_FLOW_ERROR;
-  }
 wrong_size:
   {
     GST_ELEMENT_ERROR (this, STREAM, FORMAT,
@@ -847,10 +892,22 @@ gst_audio_convert_set_property (GObject * object, guint prop_id,
 
   switch (prop_id) {
     case ARG_DITHERING:
+      GST_OBJECT_LOCK (this);
       this->dither = g_value_get_enum (value);
+      this->config_changed = TRUE;
+      GST_OBJECT_UNLOCK (this);
       break;
     case ARG_NOISE_SHAPING:
+      GST_OBJECT_LOCK (this);
       this->ns = g_value_get_enum (value);
+      this->config_changed = TRUE;
+      GST_OBJECT_UNLOCK (this);
+      break;
+    case ARG_N_THREADS:
+      GST_OBJECT_LOCK (this);
+      this->n_threads = g_value_get_uint (value);
+      this->config_changed = TRUE;
+      GST_OBJECT_UNLOCK (this);
       break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -866,10 +923,19 @@ gst_audio_convert_get_property (GObject * object, guint prop_id,
 
   switch (prop_id) {
     case ARG_DITHERING:
+      GST_OBJECT_LOCK (this);
       g_value_set_enum (value, this->dither);
+      GST_OBJECT_UNLOCK (this);
       break;
     case ARG_NOISE_SHAPING:
+      GST_OBJECT_LOCK (this);
       g_value_set_enum (value, this->ns);
+      GST_OBJECT_UNLOCK (this);
+      break;
+    case ARG_N_THREADS:
+      GST_OBJECT_LOCK (this);
+      g_value_set_uint (value, this->n_threads);
+      GST_OBJECT_UNLOCK (this);
       break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
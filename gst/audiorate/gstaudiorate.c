@@ -208,6 +208,39 @@ gst_audio_rate_reset (GstAudioRate * audiorate)
   GST_DEBUG_OBJECT (audiorate, "handle reset");
 }
 
+static void
+gst_audio_rate_clear_silence (GstAudioRate * audiorate)
+{
+  if (audiorate->silence) {
+    gst_memory_unref (audiorate->silence);
+    audiorate->silence = NULL;
+  }
+}
+
+/* make one second of silence in the negotiated format, fill buffers share
+ * parts of it instead of allocating and clearing their own memory */
+static GstMemory *
+gst_audio_rate_get_silence (GstAudioRate * audiorate)
+{
+  if (audiorate->silence == NULL) {
+    GstMemory *mem;
+    GstMapInfo map;
+    gsize size;
+
+    size = GST_AUDIO_INFO_RATE (&audiorate->info) *
+        GST_AUDIO_INFO_BPF (&audiorate->info);
+
+    mem = gst_allocator_alloc (NULL, size, NULL);
+    gst_memory_map (mem, &map, GST_MAP_WRITE);
+    gst_audio_format_fill_silence (audiorate->info.finfo, map.data, map.size);
+    gst_memory_unmap (mem, &map);
+
+    GST_MINI_OBJECT_FLAG_SET (mem, GST_MEMORY_FLAG_READONLY);
+    audiorate->silence = mem;
+  }
+  return audiorate->silence;
+}
+
 static gboolean
 gst_audio_rate_setcaps (GstAudioRate * audiorate, GstCaps * caps)
 {
@@ -217,6 +250,7 @@ gst_audio_rate_setcaps (GstAudioRate * audiorate, GstCaps * caps)
     goto wrong_caps;
 
   audiorate->info = info;
+  gst_audio_rate_clear_silence (audiorate);
 
   return TRUE;
 
@@ -522,10 +556,12 @@ gst_audio_rate_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
       fillsamples -= cursamples;
       fillsize = cursamples * bpf;
 
-      fill = gst_buffer_new_and_alloc (fillsize);
-
-      /* FIXME, 0 might not be the silence byte for the negotiated format. */
-      gst_buffer_memset (fill, 0, 0, fillsize);
+      /* cursamples is at most one second, which is the size of the silence
+       * memory */
+      fill = gst_buffer_new ();
+      gst_buffer_append_memory (fill,
+          gst_memory_share (gst_audio_rate_get_silence (audiorate), 0,
+              fillsize));
 
       GST_DEBUG_OBJECT (audiorate, "inserting %" G_GUINT64_FORMAT " samples",
           cursamples);
@@ -721,6 +757,7 @@ static GstStateChangeReturn
 gst_audio_rate_change_state (GstElement * element, GstStateChange transition)
 {
   GstAudioRate *audiorate = GST_AUDIO_RATE (element);
+  GstStateChangeReturn ret;
 
   switch (transition) {
     case GST_STATE_CHANGE_PAUSED_TO_READY:
@@ -737,7 +774,18 @@ gst_audio_rate_change_state (GstElement * element, GstStateChange transition)
       break;
   }
 
-  return GST_ELEMENT_CLASS (parent_class)->change_state (element, transition);
+  ret = GST_ELEMENT_CLASS (parent_class)->change_state (element, transition);
+
+  switch (transition) {
+    case GST_STATE_CHANGE_PAUSED_TO_READY:
+      /* streaming has stopped, nothing shares the silence anymore */
+      gst_audio_rate_clear_silence (audiorate);
+      break;
+    default:
+      break;
+  }
+
+  return ret;
 }
 
 static gboolean
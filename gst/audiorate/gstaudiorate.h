@@ -65,6 +65,10 @@ struct _GstAudioRate
 
   gboolean discont;
 
+  /* read-only silence for the negotiated format, shared by all fill
+   * buffers */
+  GstMemory *silence;
+
   gboolean new_segment;
   /* we accept all formats on the sink */
   GstSegment sink_segment;
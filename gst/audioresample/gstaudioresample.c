@@ -77,7 +77,9 @@ enum
   PROP_0,
   PROP_QUALITY,
   PROP_SINC_FILTER_MODE,
-  PROP_SINC_FILTER_AUTO_THRESHOLD
+  PROP_SINC_FILTER_AUTO_THRESHOLD,
+  PROP_N_THREADS,
+  PROP_LOW_LATENCY
 };
 
 #if G_BYTE_ORDER == G_LITTLE_ENDIAN
@@ -137,6 +139,7 @@ static gboolean gst_audio_resample_sink_event (GstBaseTransform * base,
     GstEvent * event);
 static gboolean gst_audio_resample_start (GstBaseTransform * base);
 static gboolean gst_audio_resample_stop (GstBaseTransform * base);
+static void gst_audio_resample_free_tasks (GstAudioResample * resample);
 static gboolean gst_audio_resample_query (GstPad * pad, GstObject * parent,
     GstQuery * query);
 
@@ -173,6 +176,27 @@ gst_audio_resample_class_init (GstAudioResampleClass * klass)
           SPEEX_RESAMPLER_SINC_FILTER_AUTO_THRESHOLD_DEFAULT,
            G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  g_object_class_install_property (gobject_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Maximum number of threads to use for resampling groups of channels "
+          "(0 = number of processors)", 0, G_MAXUINT, 1,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAudioResample:low-latency:
+   *
+   * Keep the filter length of the quality level when downsampling instead of
+   * growing it with the ratio. This lowers the latency, at the cost of a
+   * softer cutoff. Rate changes, e.g. to follow a drifting clock, keep the
+   * filter history in either mode.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_LOW_LATENCY,
+      g_param_spec_boolean ("low-latency", "Low latency",
+          "Use shorter filters when downsampling to reduce the latency",
+          FALSE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&gst_audio_resample_src_template));
   gst_element_class_add_pad_template (gstelement_class,
@@ -212,6 +236,7 @@ gst_audio_resample_init (GstAudioResample * resample)
   resample->quality = SPEEX_RESAMPLER_QUALITY_DEFAULT;
   resample->sinc_filter_mode = SPEEX_RESAMPLER_SINC_FILTER_DEFAULT;
   resample->sinc_filter_auto_threshold = SPEEX_RESAMPLER_SINC_FILTER_AUTO_THRESHOLD_DEFAULT;
+  resample->n_threads = 1;
 
   gst_base_transform_set_gap_aware (trans, TRUE);
   gst_pad_set_query_function (trans->srcpad, gst_audio_resample_query);
@@ -261,6 +286,8 @@ gst_audio_resample_stop (GstBaseTransform * base)
   resample->tmp_out = NULL;
   resample->tmp_out_size = 0;
 
+  gst_audio_resample_free_tasks (resample);
+
   return TRUE;
 }
 
@@ -402,8 +429,18 @@ gst_audio_resample_init_state (GstAudioResample * resample, gint width,
         funcs->get_sinc_filter_mode(ret) ? "full" : "interpolated");
   }
 
+  /* changes the filter length, so do this before skipping the zeros */
+  GST_OBJECT_LOCK (resample);
+  funcs->set_low_latency (ret, resample->low_latency);
+  resample->low_latency_changed = FALSE;
+  GST_OBJECT_UNLOCK (resample);
   funcs->skip_zeros (ret);
 
+  /* the channel groups are processed with the interleaved strides, set them
+   * once here so that processing a group does not change the state */
+  funcs->set_input_stride (ret, channels);
+  funcs->set_output_stride (ret, channels);
+
   return ret;
 }
 
@@ -766,6 +803,144 @@ gst_audio_resample_workspace_realloc (guint8 ** workspace, guint * size,
   return *workspace;
 }
 
+/* don't split buffers in channel groups of fewer values than this */
+#define MIN_TASK_VALUES 8192
+
+struct _GstAudioResampleTask
+{
+  guint32 first_channel;
+  guint32 n_channels;
+  const guint8 *in;
+  guint8 *out;
+  guint32 in_len;
+  guint32 out_len;
+  gint err;
+};
+
+static void
+gst_audio_resample_free_tasks (GstAudioResample * resample)
+{
+  if (resample->pool) {
+    g_thread_pool_free (resample->pool, FALSE, TRUE);
+    resample->pool = NULL;
+    g_mutex_clear (&resample->lock);
+    g_cond_clear (&resample->cond);
+  }
+  g_free (resample->tasks);
+  resample->tasks = NULL;
+  resample->n_tasks = 0;
+}
+
+static void
+gst_audio_resample_run_task (GstAudioResample * resample,
+    GstAudioResampleTask * task)
+{
+  task->err = resample->funcs->process_channels (resample->state,
+      task->first_channel, task->n_channels, task->in, &task->in_len,
+      task->out, &task->out_len);
+}
+
+static void
+gst_audio_resample_pool_func (gpointer data, gpointer user_data)
+{
+  GstAudioResample *resample = user_data;
+
+  gst_audio_resample_run_task (resample, data);
+
+  g_mutex_lock (&resample->lock);
+  if (--resample->n_pending == 0)
+    g_cond_signal (&resample->cond);
+  g_mutex_unlock (&resample->lock);
+}
+
+/* use up to @n_threads threads for resampling groups of channels, 0 uses the
+ * number of processors. The streaming thread resamples the first group. */
+static void
+gst_audio_resample_set_threads (GstAudioResample * resample, guint n_threads)
+{
+  if (n_threads == 0) {
+#if GLIB_CHECK_VERSION(2,36,0)
+    n_threads = g_get_num_processors ();
+#else
+    n_threads = 1;
+#endif
+  }
+
+  if (n_threads == MAX (resample->n_tasks, 1))
+    return;
+
+  gst_audio_resample_free_tasks (resample);
+
+  if (n_threads == 1)
+    return;
+
+  resample->pool = g_thread_pool_new (gst_audio_resample_pool_func, resample,
+      n_threads - 1, FALSE, NULL);
+  if (resample->pool == NULL) {
+    GST_WARNING_OBJECT (resample, "could not create thread pool, using 1 "
+        "thread");
+    return;
+  }
+  g_mutex_init (&resample->lock);
+  g_cond_init (&resample->cond);
+
+  resample->n_tasks = n_threads;
+  resample->tasks = g_new0 (GstAudioResampleTask, n_threads);
+  GST_DEBUG_OBJECT (resample, "using %u threads", n_threads);
+}
+
+/* Resample the interleaved @in into @out. Buffers with enough channels and
+ * samples are split in groups of channels that are resampled in parallel,
+ * each channel reads and writes the interleaved data directly. */
+static gint
+gst_audio_resample_process_channels (GstAudioResample * resample,
+    const guint8 * in, guint32 * in_len, guint8 * out, guint32 * out_len)
+{
+  guint i, n_tasks = 1;
+  guint32 c, group;
+  gint err = RESAMPLER_ERR_SUCCESS;
+
+  if (resample->n_tasks > 1 &&
+      (guint64) * in_len * resample->channels >= MIN_TASK_VALUES)
+    n_tasks = MIN (resample->n_tasks, resample->channels);
+
+  if (n_tasks <= 1)
+    return resample->funcs->process (resample->state, in, in_len, out,
+        out_len);
+
+  group = (resample->channels + n_tasks - 1) / n_tasks;
+  for (i = 0, c = 0; c < resample->channels; i++, c += group) {
+    GstAudioResampleTask *task = &resample->tasks[i];
+
+    task->first_channel = c;
+    task->n_channels = MIN (group, resample->channels - c);
+    task->in = in;
+    task->out = out;
+    task->in_len = *in_len;
+    task->out_len = *out_len;
+  }
+  n_tasks = i;
+
+  resample->n_pending = n_tasks - 1;
+  for (i = 1; i < n_tasks; i++)
+    g_thread_pool_push (resample->pool, &resample->tasks[i], NULL);
+
+  gst_audio_resample_run_task (resample, &resample->tasks[0]);
+
+  g_mutex_lock (&resample->lock);
+  while (resample->n_pending > 0)
+    g_cond_wait (&resample->cond, &resample->lock);
+  g_mutex_unlock (&resample->lock);
+
+  /* all channels consume and produce the same number of samples */
+  *in_len = resample->tasks[0].in_len;
+  *out_len = resample->tasks[0].out_len;
+  for (i = 0; i < n_tasks && err == RESAMPLER_ERR_SUCCESS; i++)
+    err = resample->tasks[i].err;
+
+  return err;
+}
+
 /* Push history_len zeros into the filter, but discard the output. */
 static void
 gst_audio_resample_dump_drain (GstAudioResample * resample, guint history_len)
@@ -1088,7 +1263,7 @@ gst_audio_resample_process (GstAudioResample * resample, GstBuffer * inbuf,
           resample->tmp_in, in_len, FALSE);
 
       /* process */
-      err = resample->funcs->process (resample->state,
+      err = gst_audio_resample_process_channels (resample,
           resample->tmp_in, &in_processed, resample->tmp_out, &out_processed);
 
       /* convert output */
@@ -1096,7 +1271,7 @@ gst_audio_resample_process (GstAudioResample * resample, GstBuffer * inbuf,
           out_map.data, out_processed, TRUE);
     } else {
       /* no format conversion required;  process */
-      err = resample->funcs->process (resample->state,
+      err = gst_audio_resample_process_channels (resample,
           in_map.data, &in_processed, out_map.data, &out_processed);
     }
 
@@ -1179,6 +1354,20 @@ gst_audio_resample_transform (GstBaseTransform * base, GstBuffer * inbuf,
         gst_audio_resample_get_funcs (resample->width, resample->fp);
   }
 
+  /* apply a low-latency change here, the channel groups may be processed in
+   * the thread pool and must not see the filter change under them */
+  GST_OBJECT_LOCK (resample);
+  if (G_UNLIKELY (resample->low_latency_changed)) {
+    resample->funcs->set_low_latency (resample->state, resample->low_latency);
+    resample->low_latency_changed = FALSE;
+    GST_OBJECT_UNLOCK (resample);
+
+    gst_element_post_message (GST_ELEMENT (resample),
+        gst_message_new_latency (GST_OBJECT (resample)));
+  } else {
+    GST_OBJECT_UNLOCK (resample);
+  }
+
   GST_LOG_OBJECT (resample, "transforming buffer of %" G_GSIZE_FORMAT " bytes,"
       " ts %" GST_TIME_FORMAT ", duration %" GST_TIME_FORMAT ", offset %"
       G_GINT64_FORMAT ", offset_end %" G_GINT64_FORMAT,
@@ -1226,6 +1415,8 @@ gst_audio_resample_transform (GstBaseTransform * base, GstBuffer * inbuf,
     resample->need_discont = FALSE;
   }
 
+  gst_audio_resample_set_threads (resample, resample->n_threads);
+
   ret = gst_audio_resample_process (resample, inbuf, outbuf);
   if (G_UNLIKELY (ret != GST_FLOW_OK))
     return ret;
@@ -1350,6 +1541,16 @@ gst_audio_resample_set_property (GObject * object, guint prop_id,
 
       break;
     }
+    case PROP_N_THREADS:
+      resample->n_threads = g_value_get_uint (value);
+      break;
+    case PROP_LOW_LATENCY:
+      /* applied by the streaming thread with the next buffer */
+      GST_OBJECT_LOCK (resample);
+      resample->low_latency = g_value_get_boolean (value);
+      resample->low_latency_changed = TRUE;
+      GST_OBJECT_UNLOCK (resample);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1374,6 +1575,14 @@ gst_audio_resample_get_property (GObject * object, guint prop_id,
     case PROP_SINC_FILTER_AUTO_THRESHOLD:
       g_value_set_uint(value, resample->sinc_filter_auto_threshold);
       break;
+    case PROP_N_THREADS:
+      g_value_set_uint (value, resample->n_threads);
+      break;
+    case PROP_LOW_LATENCY:
+      GST_OBJECT_LOCK (resample);
+      g_value_set_boolean (value, resample->low_latency);
+      GST_OBJECT_UNLOCK (resample);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
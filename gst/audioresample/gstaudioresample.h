@@ -43,6 +43,7 @@ G_BEGIN_DECLS
 
 typedef struct _GstAudioResample GstAudioResample;
 typedef struct _GstAudioResampleClass GstAudioResampleClass;
+typedef struct _GstAudioResampleTask GstAudioResampleTask;
 
 /**
  * GstAudioResample:
@@ -69,6 +70,9 @@ struct _GstAudioResample {
 
   /* properties */
   gint quality;
+  guint n_threads;
+  gboolean low_latency;
+  gboolean low_latency_changed;
 
   /* state */
   gboolean fp;
@@ -88,6 +92,14 @@ struct _GstAudioResample {
 
   SpeexResamplerState *state;
   const SpeexResampleFuncs *funcs;
+
+  /* channel groups processed in parallel */
+  GThreadPool *pool;
+  GstAudioResampleTask *tasks;
+  guint n_tasks;
+  gint n_pending;
+  GMutex lock;
+  GCond cond;
 };
 
 struct _GstAudioResampleClass {
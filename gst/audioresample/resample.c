@@ -172,6 +172,22 @@ speex_free (void *ptr)
 #define SSE2_FALLBACK(macro)
 #endif
 
+/* The single precision functions use SSE for floats, and SSE2 for the
+ * 16 bit integers of the fixed point version */
+#if defined(FIXED_POINT) && defined(_USE_SSE2)
+#define _USE_SSE_SINGLE
+#define SSE_SINGLE_FALLBACK SSE2_FALLBACK
+#define SSE_SINGLE_IMPLEMENTATION SSE2_IMPLEMENTATION
+#define SSE_SINGLE_END SSE2_END
+#elif !defined(FIXED_POINT) && defined(_USE_SSE)
+#define _USE_SSE_SINGLE
+#define SSE_SINGLE_FALLBACK SSE_FALLBACK
+#define SSE_SINGLE_IMPLEMENTATION SSE_IMPLEMENTATION
+#define SSE_SINGLE_END SSE_END
+#else
+#define SSE_SINGLE_FALLBACK(macro)
+#endif
+
 #ifdef _USE_NEON
 #define NEON_FALLBACK(macro) \
   if (st->use_neon) goto neon_##macro##_neon; {
@@ -186,6 +202,8 @@ speex_free (void *ptr)
 typedef int (*resampler_basic_func) (SpeexResamplerState *, spx_uint32_t,
     const spx_word16_t *, spx_uint32_t *, spx_word16_t *, spx_uint32_t *);
 
+typedef struct SincTable_ SincTable;
+
 struct SpeexResamplerState_
 {
   spx_uint32_t in_rate;
@@ -205,6 +223,7 @@ struct SpeexResamplerState_
   int initialised;
   int started;
   int use_full_sinc_table;
+  int low_latency;
 
   /* These are per-channel */
   spx_int32_t *last_sample;
@@ -212,7 +231,9 @@ struct SpeexResamplerState_
   spx_uint32_t *magic_samples;
 
   spx_word16_t *mem;
-  spx_word16_t *sinc_table;
+  /* shared between all states with the same table, read-only */
+  const spx_word16_t *sinc_table;
+  SincTable *sinc_table_entry;
   spx_uint32_t sinc_table_length;
   resampler_basic_func resampler_ptr;
 
@@ -477,7 +498,7 @@ resampler_basic_direct_single (SpeexResamplerState * st,
     const spx_word16_t *sinc = &sinc_table[samp_frac_num * N];
     const spx_word16_t *iptr = &in[last_sample];
 
-    SSE_FALLBACK (INNER_PRODUCT_SINGLE)
+    SSE_SINGLE_FALLBACK (INNER_PRODUCT_SINGLE)
     NEON_FALLBACK (INNER_PRODUCT_SINGLE)
         sum = 0;
     for (j = 0; j < N; j++)
@@ -499,10 +520,10 @@ resampler_basic_direct_single (SpeexResamplerState * st,
     NEON_IMPLEMENTATION (INNER_PRODUCT_SINGLE)
     sum = inner_product_single (sinc, iptr, N);
     NEON_END(INNER_PRODUCT_SINGLE)
-#elif defined(OVERRIDE_INNER_PRODUCT_SINGLE) && defined(_USE_SSE)
-    SSE_IMPLEMENTATION (INNER_PRODUCT_SINGLE)
+#elif defined(OVERRIDE_INNER_PRODUCT_SINGLE) && defined(_USE_SSE_SINGLE)
+    SSE_SINGLE_IMPLEMENTATION (INNER_PRODUCT_SINGLE)
         sum = inner_product_single (sinc, iptr, N);
-    SSE_END (INNER_PRODUCT_SINGLE)
+    SSE_SINGLE_END (INNER_PRODUCT_SINGLE)
 #endif
     out[out_stride * out_sample++] = SATURATE32PSHR(sum, 15, 32767);
     last_sample += int_advance;
@@ -608,7 +629,10 @@ resampler_basic_interpolate_single (SpeexResamplerState * st,
     spx_word16_t interp[4];
 
 
-    SSE_FALLBACK (INTERPOLATE_PRODUCT_SINGLE)
+    SSE_SINGLE_FALLBACK (INTERPOLATE_PRODUCT_SINGLE)
+#if defined(OVERRIDE_INTERPOLATE_PRODUCT_SINGLE) && defined(_USE_NEON)
+    NEON_FALLBACK (INTERPOLATE_PRODUCT_SINGLE)
+#endif
     spx_word32_t accum[4] = { 0, 0, 0, 0 };
 
     for (j = 0; j < N; j++) {
@@ -633,14 +657,22 @@ resampler_basic_interpolate_single (SpeexResamplerState * st,
             1)) + MULT16_32_Q15 (interp[1], SHR32 (accum[1],
             1)) + MULT16_32_Q15 (interp[2], SHR32 (accum[2],
             1)) + MULT16_32_Q15 (interp[3], SHR32 (accum[3], 1));
-#if defined(OVERRIDE_INTERPOLATE_PRODUCT_SINGLE) && defined(_USE_SSE)
-    SSE_IMPLEMENTATION (INTERPOLATE_PRODUCT_SINGLE)
+#if defined(OVERRIDE_INTERPOLATE_PRODUCT_SINGLE) && defined(_USE_NEON)
+    NEON_IMPLEMENTATION (INTERPOLATE_PRODUCT_SINGLE)
+        cubic_coef (frac, interp);
+    sum =
+        interpolate_product_single (iptr,
+        st->sinc_table + st->oversample + 4 - offset - 2, N, st->oversample,
+        interp);
+    NEON_END (INTERPOLATE_PRODUCT_SINGLE)
+#elif defined(OVERRIDE_INTERPOLATE_PRODUCT_SINGLE) && defined(_USE_SSE_SINGLE)
+    SSE_SINGLE_IMPLEMENTATION (INTERPOLATE_PRODUCT_SINGLE)
         cubic_coef (frac, interp);
     sum =
         interpolate_product_single (iptr,
         st->sinc_table + st->oversample + 4 - offset - 2, N, st->oversample,
         interp);
-    SSE_END (INTERPOLATE_PRODUCT_SINGLE)
+    SSE_SINGLE_END (INTERPOLATE_PRODUCT_SINGLE)
 #endif
     out[out_stride * out_sample++] = SATURATE32PSHR(sum, 14, 32767);
     last_sample += int_advance;
@@ -747,6 +779,152 @@ resampler_basic_interpolate_double (SpeexResamplerState * st,
 }
 #endif
 
+/* A sinc table only depends on the filter parameters and whether it is the
+ * full or the interpolated table, so tables are shared between all states of
+ * the same precision. The interpolated table does not depend on the exact
+ * resampling ratio, small rate changes to follow a drifting clock can reuse
+ * it. */
+struct SincTable_
+{
+  int refcount;
+
+  int quality;
+  int direct;
+  spx_uint32_t filt_len;
+  float cutoff;
+  /* only for the full table */
+  spx_uint32_t den_rate;
+  /* only for the interpolated table */
+  spx_uint32_t oversample;
+
+  spx_uint32_t length;
+  spx_word16_t *table;
+};
+
+#ifdef OUTSIDE_SPEEX
+static GMutex sinc_table_cache_lock;
+static GList *sinc_table_cache;
+#endif
+
+static void
+sinc_table_compute (SpeexResamplerState * st, int direct, spx_word16_t * table)
+{
+  if (direct) {
+    spx_uint32_t i;
+    for (i = 0; i < st->den_rate; i++) {
+      spx_int32_t j;
+      for (j = 0; j < st->filt_len; j++) {
+        table[i * st->filt_len + j] =
+            sinc (st->cutoff, ((j - (spx_int32_t) st->filt_len / 2 + 1) -
+#ifdef DOUBLE_PRECISION
+                ((double) i) / st->den_rate), st->filt_len,
+#else
+                ((float) i) / st->den_rate), st->filt_len,
+#endif
+            quality_map[st->quality].window_func);
+      }
+    }
+  } else {
+    spx_int32_t i;
+    for (i = -4; i < (spx_int32_t) (st->oversample * st->filt_len + 4); i++)
+      table[i + 4] =
+#ifdef DOUBLE_PRECISION
+          sinc (st->cutoff, (i / (double) st->oversample - st->filt_len / 2),
+#else
+          sinc (st->cutoff, (i / (float) st->oversample - st->filt_len / 2),
+#endif
+          st->filt_len, quality_map[st->quality].window_func);
+  }
+}
+
+static void
+sinc_table_release (SpeexResamplerState * st)
+{
+  SincTable *entry = st->sinc_table_entry;
+
+  if (entry == NULL)
+    return;
+
+#ifdef OUTSIDE_SPEEX
+  g_mutex_lock (&sinc_table_cache_lock);
+  if (--entry->refcount == 0)
+    sinc_table_cache = g_list_remove (sinc_table_cache, entry);
+  else
+    entry = NULL;
+  g_mutex_unlock (&sinc_table_cache_lock);
+#endif
+
+  if (entry) {
+    speex_free (entry->table);
+    speex_free (entry);
+  }
+  st->sinc_table_entry = NULL;
+  st->sinc_table = NULL;
+  st->sinc_table_length = 0;
+}
+
+/* Looks up or calculates the sinc table for the current ratio and quality of
+ * @st, the table must not be modified */
+static void
+sinc_table_acquire (SpeexResamplerState * st, int direct)
+{
+  SincTable *entry = NULL;
+  spx_uint32_t length;
+
+  if (direct)
+    length = st->filt_len * st->den_rate;
+  else
+    length = st->filt_len * st->oversample + 8;
+
+#ifdef OUTSIDE_SPEEX
+  {
+    GList *l;
+
+    g_mutex_lock (&sinc_table_cache_lock);
+    for (l = sinc_table_cache; l; l = l->next) {
+      SincTable *e = l->data;
+
+      if (e->quality == st->quality && e->direct == direct &&
+          e->filt_len == st->filt_len && e->cutoff == st->cutoff &&
+          (direct ? e->den_rate == st->den_rate :
+              e->oversample == st->oversample)) {
+        e->refcount++;
+        entry = e;
+        break;
+      }
+    }
+    g_mutex_unlock (&sinc_table_cache_lock);
+  }
+#endif
+
+  if (entry == NULL) {
+    entry = (SincTable *) speex_alloc (sizeof (SincTable));
+    entry->refcount = 1;
+    entry->quality = st->quality;
+    entry->direct = direct;
+    entry->filt_len = st->filt_len;
+    entry->cutoff = st->cutoff;
+    entry->den_rate = st->den_rate;
+    entry->oversample = st->oversample;
+    entry->length = length;
+    entry->table =
+        (spx_word16_t *) speex_alloc (length * sizeof (spx_word16_t));
+    sinc_table_compute (st, direct, entry->table);
+
+#ifdef OUTSIDE_SPEEX
+    /* another thread might have added the same table in the meantime, this
+     * only costs a duplicate entry until both are released */
+    g_mutex_lock (&sinc_table_cache_lock);
+    sinc_table_cache = g_list_prepend (sinc_table_cache, entry);
+    g_mutex_unlock (&sinc_table_cache_lock);
+#endif
+  }
+
+  st->sinc_table_entry = entry;
+  st->sinc_table = entry->table;
+  st->sinc_table_length = entry->length;
+}
+
 static void
 update_filter (SpeexResamplerState * st)
 {
@@ -762,9 +940,12 @@ update_filter (SpeexResamplerState * st)
         quality_map[st->quality].downsample_bandwidth * st->den_rate /
         st->num_rate;
     /* FIXME: divide the numerator and denominator by a certain amount if they're too large */
-    st->filt_len = st->filt_len * st->num_rate / st->den_rate;
-    /* Round down to make sure we have a multiple of 4 */
-    st->filt_len &= (~0x3);
+    /* In low latency mode keep the filter length of the quality level */
+    if (!st->low_latency) {
+      st->filt_len = st->filt_len * st->num_rate / st->den_rate;
+      /* Round down to make sure we have a multiple of 4 */
+      st->filt_len &= (~0x3);
+    }
     if (2 * st->den_rate < st->num_rate)
       st->oversample >>= 1;
     if (4 * st->den_rate < st->num_rate)
@@ -782,31 +963,10 @@ update_filter (SpeexResamplerState * st)
 
   /* Choose the resampling type that requires the least amount of memory */
   /* Or if the full sinc table is explicitely requested, use that */
+  sinc_table_release (st);
+
   if (st->use_full_sinc_table || (st->den_rate <= st->oversample)) {
-    spx_uint32_t i;
-    if (!st->sinc_table)
-      st->sinc_table =
-          (spx_word16_t *) speex_alloc (st->filt_len * st->den_rate *
-          sizeof (spx_word16_t));
-    else if (st->sinc_table_length < st->filt_len * st->den_rate) {
-      st->sinc_table =
-          (spx_word16_t *) speex_realloc (st->sinc_table,
-          st->filt_len * st->den_rate * sizeof (spx_word16_t));
-      st->sinc_table_length = st->filt_len * st->den_rate;
-    }
-    for (i = 0; i < st->den_rate; i++) {
-      spx_int32_t j;
-      for (j = 0; j < st->filt_len; j++) {
-        st->sinc_table[i * st->filt_len + j] =
-            sinc (st->cutoff, ((j - (spx_int32_t) st->filt_len / 2 + 1) -
-#ifdef DOUBLE_PRECISION
-                ((double) i) / st->den_rate), st->filt_len,
-#else
-                ((float) i) / st->den_rate), st->filt_len,
-#endif
-            quality_map[st->quality].window_func);
-      }
-    }
+    sinc_table_acquire (st, 1);
 #ifdef FIXED_POINT
     st->resampler_ptr = resampler_basic_direct_single;
 #else
@@ -821,25 +981,7 @@ update_filter (SpeexResamplerState * st)
 #endif
     /*fprintf (stderr, "resampler uses direct sinc table and normalised cutoff %f\n", cutoff); */
   } else {
-    spx_int32_t i;
-    if (!st->sinc_table)
-      st->sinc_table =
-          (spx_word16_t *) speex_alloc ((st->filt_len * st->oversample +
-              8) * sizeof (spx_word16_t));
-    else if (st->sinc_table_length < st->filt_len * st->oversample + 8) {
-      st->sinc_table =
-          (spx_word16_t *) speex_realloc (st->sinc_table,
-          (st->filt_len * st->oversample + 8) * sizeof (spx_word16_t));
-      st->sinc_table_length = st->filt_len * st->oversample + 8;
-    }
-    for (i = -4; i < (spx_int32_t) (st->oversample * st->filt_len + 4); i++)
-      st->sinc_table[i + 4] =
-#ifdef DOUBLE_PRECISION
-          sinc (st->cutoff, (i / (double) st->oversample - st->filt_len / 2),
-#else
-          sinc (st->cutoff, (i / (float) st->oversample - st->filt_len / 2),
-#endif
-          st->filt_len, quality_map[st->quality].window_func);
+    sinc_table_acquire (st, 0);
 #ifdef FIXED_POINT
     st->resampler_ptr = resampler_basic_interpolate_single;
 #else
@@ -1012,12 +1154,15 @@ speex_resampler_init_frac (spx_uint32_t nb_channels, spx_uint32_t ratio_num,
   st->num_rate = 0;
   st->den_rate = 0;
   st->quality = -1;
+  st->sinc_table = NULL;
+  st->sinc_table_entry = NULL;
   st->sinc_table_length = 0;
   st->mem_alloc_size = 0;
   st->filt_len = 0;
   st->mem = 0;
   st->resampler_ptr = 0;
   st->use_full_sinc_table = use_full_sinc_table;
+  st->low_latency = 0;
 
   st->cutoff = 1.f;
   st->nb_channels = nb_channels;
@@ -1085,7 +1230,7 @@ EXPORT void
 speex_resampler_destroy (SpeexResamplerState * st)
 {
   speex_free (st->mem);
-  speex_free (st->sinc_table);
+  sinc_table_release (st);
   speex_free (st->last_sample);
   speex_free (st->magic_samples);
   speex_free (st->samp_frac_num);
@@ -1331,6 +1476,56 @@ speex_resampler_process_interleaved_int (SpeexResamplerState * st,
   return RESAMPLER_ERR_SUCCESS;
 }
 
+#ifdef DOUBLE_PRECISION
+EXPORT int
+speex_resampler_process_interleaved_channels_float (SpeexResamplerState * st,
+    spx_uint32_t first_channel, spx_uint32_t n_channels, const double *in,
+    spx_uint32_t * in_len, double *out, spx_uint32_t * out_len)
+#else
+EXPORT int
+speex_resampler_process_interleaved_channels_float (SpeexResamplerState * st,
+    spx_uint32_t first_channel, spx_uint32_t n_channels, const float *in,
+    spx_uint32_t * in_len, float *out, spx_uint32_t * out_len)
+#endif
+{
+  spx_uint32_t i;
+  spx_uint32_t bak_len = *out_len;
+
+  if (first_channel + n_channels > st->nb_channels)
+    return RESAMPLER_ERR_INVALID_ARG;
+
+  for (i = first_channel; i < first_channel + n_channels; i++) {
+    *out_len = bak_len;
+    if (in != NULL)
+      speex_resampler_process_float (st, i, in + i, in_len, out + i, out_len);
+    else
+      speex_resampler_process_float (st, i, NULL, in_len, out + i, out_len);
+  }
+  return RESAMPLER_ERR_SUCCESS;
+}
+
+EXPORT int
+speex_resampler_process_interleaved_channels_int (SpeexResamplerState * st,
+    spx_uint32_t first_channel, spx_uint32_t n_channels,
+    const spx_int16_t * in, spx_uint32_t * in_len, spx_int16_t * out,
+    spx_uint32_t * out_len)
+{
+  spx_uint32_t i;
+  spx_uint32_t bak_len = *out_len;
+
+  if (first_channel + n_channels > st->nb_channels)
+    return RESAMPLER_ERR_INVALID_ARG;
+
+  for (i = first_channel; i < first_channel + n_channels; i++) {
+    *out_len = bak_len;
+    if (in != NULL)
+      speex_resampler_process_int (st, i, in + i, in_len, out + i, out_len);
+    else
+      speex_resampler_process_int (st, i, NULL, in_len, out + i, out_len);
+  }
+  return RESAMPLER_ERR_SUCCESS;
+}
+
 EXPORT int
 speex_resampler_set_rate (SpeexResamplerState * st, spx_uint32_t in_rate,
     spx_uint32_t out_rate)
@@ -1412,6 +1607,18 @@ speex_resampler_get_quality (SpeexResamplerState * st, int *quality)
   *quality = st->quality;
 }
 
+EXPORT int
+speex_resampler_set_low_latency (SpeexResamplerState * st, int low_latency)
+{
+  low_latency = (low_latency != 0);
+  if (st->low_latency == low_latency)
+    return RESAMPLER_ERR_SUCCESS;
+  st->low_latency = low_latency;
+  if (st->initialised)
+    update_filter (st);
+  return RESAMPLER_ERR_SUCCESS;
+}
+
 EXPORT void
 speex_resampler_set_input_stride (SpeexResamplerState * st, spx_uint32_t stride)
 {
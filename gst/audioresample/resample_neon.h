@@ -198,5 +198,21 @@ static inline float inner_product_single(const float *a, const float *b, unsigne
                     "q9", "q10", "q11");
     return ret;
 }
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+static inline float interpolate_product_single(const float *a, const float *b, unsigned int len, const spx_uint32_t oversample, float *frac)
+{
+    unsigned int i;
+    float32x4_t sum = vdupq_n_f32(0);
+    float32x2_t sum2;
+
+    for (i = 0; i < len; i++)
+        sum = vmlaq_n_f32(sum, vld1q_f32(b + i * oversample), a[i]);
+
+    sum = vmulq_f32(sum, vld1q_f32(frac));
+    sum2 = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    sum2 = vpadd_f32(sum2, sum2);
+    return vget_lane_f32(sum2, 0);
+}
 #endif
 
@@ -38,6 +38,53 @@
 #include <xmmintrin.h>
 #endif
 
+#ifdef FIXED_POINT
+#ifdef HAVE_EMMINTRIN_H
+#include <emmintrin.h>
+#endif
+
+/* 16 bit integer versions, these need SSE2. len is a multiple of 4 */
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+static inline spx_word32_t inner_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len)
+{
+   unsigned int i;
+   spx_word32_t ret[4];
+   __m128i sum = _mm_setzero_si128();
+   for (i=0;i+8<=len;i+=8)
+   {
+      sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_loadu_si128((const __m128i *) (a+i)), _mm_loadu_si128((const __m128i *) (b+i))));
+   }
+   if (i<len)
+   {
+      sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_loadl_epi64((const __m128i *) (a+i)), _mm_loadl_epi64((const __m128i *) (b+i))));
+   }
+   _mm_storeu_si128((__m128i *) ret, sum);
+   return ret[0] + ret[1] + ret[2] + ret[3];
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+static inline spx_word32_t interpolate_product_single(const spx_word16_t *a, const spx_word16_t *b, unsigned int len, const spx_uint32_t oversample, spx_word16_t *frac) {
+  unsigned int i;
+  spx_word32_t accum[4];
+  __m128i sum = _mm_setzero_si128();
+  __m128i t, f;
+  for(i=0;i<len;i+=2)
+  {
+    /* interleave the 4 coefficients of two taps, so that each 32 bit
+     * lane of madd sums the products of those two taps */
+    t = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *) (b+i*oversample)), _mm_loadl_epi64((const __m128i *) (b+(i+1)*oversample)));
+    f = _mm_set1_epi32((a[i] & 0xffff) | ((spx_uint32_t) a[i+1] << 16));
+    sum = _mm_add_epi32(sum, _mm_madd_epi16(f, t));
+  }
+  _mm_storeu_si128((__m128i *) accum, sum);
+  return MULT16_32_Q15(frac[0], SHR32(accum[0], 1)) +
+      MULT16_32_Q15(frac[1], SHR32(accum[1], 1)) +
+      MULT16_32_Q15(frac[2], SHR32(accum[2], 1)) +
+      MULT16_32_Q15(frac[3], SHR32(accum[3], 1));
+}
+
+#else /* FIXED_POINT */
+
 #define OVERRIDE_INNER_PRODUCT_SINGLE
 static inline float inner_product_single(const float *a, const float *b, unsigned int len)
 {
@@ -178,3 +225,5 @@ static inline double interpolate_product_double(const float *a, const float *b,
 #endif
 
 #endif
+
+#endif /* FIXED_POINT */
@@ -61,12 +61,15 @@
 #define speex_resampler_process_int CAT_PREFIX(RANDOM_PREFIX,_resampler_process_int)
 #define speex_resampler_process_interleaved_float CAT_PREFIX(RANDOM_PREFIX,_resampler_process_interleaved_float)
 #define speex_resampler_process_interleaved_int CAT_PREFIX(RANDOM_PREFIX,_resampler_process_interleaved_int)
+#define speex_resampler_process_interleaved_channels_float CAT_PREFIX(RANDOM_PREFIX,_resampler_process_interleaved_channels_float)
+#define speex_resampler_process_interleaved_channels_int CAT_PREFIX(RANDOM_PREFIX,_resampler_process_interleaved_channels_int)
 #define speex_resampler_set_rate CAT_PREFIX(RANDOM_PREFIX,_resampler_set_rate)
 #define speex_resampler_get_rate CAT_PREFIX(RANDOM_PREFIX,_resampler_get_rate)
 #define speex_resampler_set_rate_frac CAT_PREFIX(RANDOM_PREFIX,_resampler_set_rate_frac)
 #define speex_resampler_get_ratio CAT_PREFIX(RANDOM_PREFIX,_resampler_get_ratio)
 #define speex_resampler_set_quality CAT_PREFIX(RANDOM_PREFIX,_resampler_set_quality)
 #define speex_resampler_get_quality CAT_PREFIX(RANDOM_PREFIX,_resampler_get_quality)
+#define speex_resampler_set_low_latency CAT_PREFIX(RANDOM_PREFIX,_resampler_set_low_latency)
 #define speex_resampler_set_input_stride CAT_PREFIX(RANDOM_PREFIX,_resampler_set_input_stride)
 #define speex_resampler_get_input_stride CAT_PREFIX(RANDOM_PREFIX,_resampler_get_input_stride)
 #define speex_resampler_set_output_stride CAT_PREFIX(RANDOM_PREFIX,_resampler_set_output_stride)
@@ -268,6 +271,59 @@ int speex_resampler_process_interleaved_int(SpeexResamplerState *st,
                                              spx_int16_t *out, 
                                              spx_uint32_t *out_len);
 
+/** Resample a range of channels of an interleaved float array. Unlike
+ * speex_resampler_process_interleaved_float() this does not change the
+ * strides, they must already be set to the number of channels. Distinct
+ * channel ranges can be processed from different threads at the same time
+ * when using the native sample type of the resampler.
+ * @param st Resampler state
+ * @param first_channel Index of the first channel to process
+ * @param n_channels Number of channels to process
+ * @param in Interleaved input buffer with all channels
+ * @param in_len Number of input samples in the input buffer. Returns the number
+ * of samples processed. This is all per-channel.
+ * @param out Interleaved output buffer with all channels
+ * @param out_len Size of the output buffer. Returns the number of samples written.
+ * This is all per-channel.
+ */
+#ifdef DOUBLE_PRECISION
+int speex_resampler_process_interleaved_channels_float(SpeexResamplerState *st, 
+                                               spx_uint32_t first_channel, 
+                                               spx_uint32_t n_channels, 
+                                               const double *in, 
+                                               spx_uint32_t *in_len, 
+                                               double *out, 
+                                               spx_uint32_t *out_len);
+#else
+int speex_resampler_process_interleaved_channels_float(SpeexResamplerState *st, 
+                                               spx_uint32_t first_channel, 
+                                               spx_uint32_t n_channels, 
+                                               const float *in, 
+                                               spx_uint32_t *in_len, 
+                                               float *out, 
+                                               spx_uint32_t *out_len);
+#endif
+
+/** Resample a range of channels of an interleaved int array. See
+ * speex_resampler_process_interleaved_channels_float().
+ * @param st Resampler state
+ * @param first_channel Index of the first channel to process
+ * @param n_channels Number of channels to process
+ * @param in Interleaved input buffer with all channels
+ * @param in_len Number of input samples in the input buffer. Returns the number
+ * of samples processed. This is all per-channel.
+ * @param out Interleaved output buffer with all channels
+ * @param out_len Size of the output buffer. Returns the number of samples written.
+ * This is all per-channel.
+ */
+int speex_resampler_process_interleaved_channels_int(SpeexResamplerState *st, 
+                                             spx_uint32_t first_channel, 
+                                             spx_uint32_t n_channels, 
+                                             const spx_int16_t *in, 
+                                             spx_uint32_t *in_len, 
+                                             spx_int16_t *out, 
+                                             spx_uint32_t *out_len);
+
 /** Set (change) the input/output sampling rates (integer value).
  * @param st Resampler state
  * @param in_rate Input sampling rate (integer number of Hz).
@@ -326,6 +382,16 @@ int speex_resampler_set_quality(SpeexResamplerState *st,
 void speex_resampler_get_quality(SpeexResamplerState *st, 
                                  int *quality);
 
+/** Enable or disable the low latency mode. When downsampling, the filter
+ * length normally grows with the ratio to keep the transition band narrow.
+ * In low latency mode the filter keeps the length of the quality level,
+ * which lowers the latency at the cost of a softer cutoff.
+ * @param st Resampler state
+ * @param low_latency Non-zero to enable the low latency mode
+ */
+int speex_resampler_set_low_latency(SpeexResamplerState *st, 
+                                     int low_latency);
+
 /** Set (change) the input stride.
  * @param st Resampler state
  * @param stride Input stride
@@ -17,6 +17,7 @@
  * Boston, MA 02110-1301, USA.
  */
 
+#define _USE_SSE2
 #define FIXED_POINT 1
 #define OUTSIDE_SPEEX 1
 /* disabled, 16-bit integer NEON support seems broken */
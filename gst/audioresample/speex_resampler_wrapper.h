@@ -56,6 +56,11 @@ typedef struct {
   void (*destroy) (SpeexResamplerState * st);
   int (*process) (SpeexResamplerState *
     st, const guint8 * in, guint32 * in_len, guint8 * out, guint32 * out_len);
+  int (*process_channels) (SpeexResamplerState * st, guint32 first_channel,
+    guint32 n_channels, const guint8 * in, guint32 * in_len, guint8 * out,
+    guint32 * out_len);
+  void (*set_input_stride) (SpeexResamplerState * st, guint32 stride);
+  void (*set_output_stride) (SpeexResamplerState * st, guint32 stride);
   int (*set_rate) (SpeexResamplerState * st,
     guint32 in_rate, guint32 out_rate);
   void (*get_rate) (SpeexResamplerState * st,
@@ -66,6 +71,7 @@ typedef struct {
   int (*get_filt_len) (SpeexResamplerState * st);
   int (*get_sinc_filter_mode) (SpeexResamplerState * st);
   int (*set_quality) (SpeexResamplerState * st, gint quality);
+  int (*set_low_latency) (SpeexResamplerState * st, gint low_latency);
   int (*reset_mem) (SpeexResamplerState * st);
   int (*skip_zeros) (SpeexResamplerState * st);
   const char * (*strerror) (gint err);
@@ -79,6 +85,13 @@ SpeexResamplerState *resample_float_resampler_init (guint32 nb_channels,
 void resample_float_resampler_destroy (SpeexResamplerState * st);
 int resample_float_resampler_process_interleaved_float (SpeexResamplerState *
     st, const guint8 * in, guint32 * in_len, guint8 * out, guint32 * out_len);
+int resample_float_resampler_process_interleaved_channels_float (SpeexResamplerState *
+    st, guint32 first_channel, guint32 n_channels, const guint8 * in,
+    guint32 * in_len, guint8 * out, guint32 * out_len);
+void resample_float_resampler_set_input_stride (SpeexResamplerState * st,
+    guint32 stride);
+void resample_float_resampler_set_output_stride (SpeexResamplerState * st,
+    guint32 stride);
 int resample_float_resampler_set_rate (SpeexResamplerState * st,
     guint32 in_rate, guint32 out_rate);
 void resample_float_resampler_get_rate (SpeexResamplerState * st,
@@ -89,6 +102,8 @@ int resample_float_resampler_get_input_latency (SpeexResamplerState * st);
 int resample_float_resampler_get_filt_len (SpeexResamplerState * st);
 int resample_float_resampler_get_sinc_filter_mode (SpeexResamplerState * st);
 int resample_float_resampler_set_quality (SpeexResamplerState * st, gint quality);
+int resample_float_resampler_set_low_latency (SpeexResamplerState * st,
+    gint low_latency);
 int resample_float_resampler_reset_mem (SpeexResamplerState * st);
 int resample_float_resampler_skip_zeros (SpeexResamplerState * st);
 const char * resample_float_resampler_strerror (gint err);
@@ -98,6 +113,9 @@ static const SpeexResampleFuncs float_funcs =
   resample_float_resampler_init,
   resample_float_resampler_destroy,
   resample_float_resampler_process_interleaved_float,
+  resample_float_resampler_process_interleaved_channels_float,
+  resample_float_resampler_set_input_stride,
+  resample_float_resampler_set_output_stride,
   resample_float_resampler_set_rate,
   resample_float_resampler_get_rate,
   resample_float_resampler_get_ratio,
@@ -105,6 +123,7 @@ static const SpeexResampleFuncs float_funcs =
   resample_float_resampler_get_filt_len,
   resample_float_resampler_get_sinc_filter_mode,
   resample_float_resampler_set_quality,
+  resample_float_resampler_set_low_latency,
   resample_float_resampler_reset_mem,
   resample_float_resampler_skip_zeros,
   resample_float_resampler_strerror,
@@ -118,6 +137,13 @@ SpeexResamplerState *resample_double_resampler_init (guint32 nb_channels,
 void resample_double_resampler_destroy (SpeexResamplerState * st);
 int resample_double_resampler_process_interleaved_float (SpeexResamplerState *
     st, const guint8 * in, guint32 * in_len, guint8 * out, guint32 * out_len);
+int resample_double_resampler_process_interleaved_channels_float (SpeexResamplerState *
+    st, guint32 first_channel, guint32 n_channels, const guint8 * in,
+    guint32 * in_len, guint8 * out, guint32 * out_len);
+void resample_double_resampler_set_input_stride (SpeexResamplerState * st,
+    guint32 stride);
+void resample_double_resampler_set_output_stride (SpeexResamplerState * st,
+    guint32 stride);
 int resample_double_resampler_set_rate (SpeexResamplerState * st,
     guint32 in_rate, guint32 out_rate);
 void resample_double_resampler_get_rate (SpeexResamplerState * st,
@@ -128,6 +154,8 @@ int resample_double_resampler_get_input_latency (SpeexResamplerState * st);
 int resample_double_resampler_get_filt_len (SpeexResamplerState * st);
 int resample_double_resampler_get_sinc_filter_mode (SpeexResamplerState * st);
 int resample_double_resampler_set_quality (SpeexResamplerState * st, gint quality);
+int resample_double_resampler_set_low_latency (SpeexResamplerState * st,
+    gint low_latency);
 int resample_double_resampler_reset_mem (SpeexResamplerState * st);
 int resample_double_resampler_skip_zeros (SpeexResamplerState * st);
 const char * resample_double_resampler_strerror (gint err);
@@ -137,6 +165,9 @@ static const SpeexResampleFuncs double_funcs =
   resample_double_resampler_init,
   resample_double_resampler_destroy,
   resample_double_resampler_process_interleaved_float,
+  resample_double_resampler_process_interleaved_channels_float,
+  resample_double_resampler_set_input_stride,
+  resample_double_resampler_set_output_stride,
   resample_double_resampler_set_rate,
   resample_double_resampler_get_rate,
   resample_double_resampler_get_ratio,
@@ -144,6 +175,7 @@ static const SpeexResampleFuncs double_funcs =
   resample_double_resampler_get_filt_len,
   resample_double_resampler_get_sinc_filter_mode,
   resample_double_resampler_set_quality,
+  resample_double_resampler_set_low_latency,
   resample_double_resampler_reset_mem,
   resample_double_resampler_skip_zeros,
   resample_double_resampler_strerror,
@@ -157,6 +189,13 @@ SpeexResamplerState *resample_int_resampler_init (guint32 nb_channels,
 void resample_int_resampler_destroy (SpeexResamplerState * st);
 int resample_int_resampler_process_interleaved_int (SpeexResamplerState *
     st, const guint8 * in, guint32 * in_len, guint8 * out, guint32 * out_len);
+int resample_int_resampler_process_interleaved_channels_int (SpeexResamplerState *
+    st, guint32 first_channel, guint32 n_channels, const guint8 * in,
+    guint32 * in_len, guint8 * out, guint32 * out_len);
+void resample_int_resampler_set_input_stride (SpeexResamplerState * st,
+    guint32 stride);
+void resample_int_resampler_set_output_stride (SpeexResamplerState * st,
+    guint32 stride);
 int resample_int_resampler_set_rate (SpeexResamplerState * st,
     guint32 in_rate, guint32 out_rate);
 void resample_int_resampler_get_rate (SpeexResamplerState * st,
@@ -167,6 +206,8 @@ int resample_int_resampler_get_input_latency (SpeexResamplerState * st);
 int resample_int_resampler_get_filt_len (SpeexResamplerState * st);
 int resample_int_resampler_get_sinc_filter_mode (SpeexResamplerState * st);
 int resample_int_resampler_set_quality (SpeexResamplerState * st, gint quality);
+int resample_int_resampler_set_low_latency (SpeexResamplerState * st,
+    gint low_latency);
 int resample_int_resampler_reset_mem (SpeexResamplerState * st);
 int resample_int_resampler_skip_zeros (SpeexResamplerState * st);
 const char * resample_int_resampler_strerror (gint err);
@@ -176,6 +217,9 @@ static const SpeexResampleFuncs int_funcs =
   resample_int_resampler_init,
   resample_int_resampler_destroy,
   resample_int_resampler_process_interleaved_int,
+  resample_int_resampler_process_interleaved_channels_int,
+  resample_int_resampler_set_input_stride,
+  resample_int_resampler_set_output_stride,
   resample_int_resampler_set_rate,
   resample_int_resampler_get_rate,
   resample_int_resampler_get_ratio,
@@ -183,6 +227,7 @@ static const SpeexResampleFuncs int_funcs =
   resample_int_resampler_get_filt_len,
   resample_int_resampler_get_sinc_filter_mode,
   resample_int_resampler_set_quality,
+  resample_int_resampler_set_low_latency,
   resample_int_resampler_reset_mem,
   resample_int_resampler_skip_zeros,
   resample_int_resampler_strerror,
@@ -355,25 +355,39 @@ error:
   }
 }
 
+/* Instead of calling sin() for every frame, the oscillator rotates a
+ * (sin, cos) pair by the phase step. The pair is recalculated from the
+ * accumulator at the start of each buffer so rounding errors can't build
+ * up. */
 #define DEFINE_SINE(type,scale) \
 static void \
 gst_audio_test_src_create_sine_##type (GstAudioTestSrc * src, g##type * samples) \
 { \
   gint i, c, channels; \
   gdouble step, amp; \
+  gdouble s, co, step_s, step_c, tmp; \
   \
   channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
   step = M_PI_M2 * src->freq / GST_AUDIO_INFO_RATE (&src->info); \
   amp = src->volume * scale; \
   \
+  s = sin (src->accumulator); \
+  co = cos (src->accumulator); \
+  step_s = sin (step); \
+  step_c = cos (step); \
+  \
   i = 0; \
   while (i < (src->generate_samples_per_buffer * channels)) { \
     src->accumulator += step; \
     if (src->accumulator >= M_PI_M2) \
       src->accumulator -= M_PI_M2; \
     \
+    tmp = s * step_c + co * step_s; \
+    co = co * step_c - s * step_s; \
+    s = tmp; \
+    \
     for (c = 0; c < channels; ++c) { \
-      samples[i++] = (g##type) (sin (src->accumulator) * amp); \
+      samples[i++] = (g##type) (s * amp); \
     } \
   } \
 }
@@ -533,10 +547,14 @@ gst_audio_test_src_create_white_noise_##type (GstAudioTestSrc * src, g##type * s
   gdouble amp = (src->volume * scale); \
   gint channels = GST_AUDIO_INFO_CHANNELS (&src->info); \
   \
+  /* one random integer per sample is enough for the precision of the \
+   * output formats, g_rand_double_range() would need two */ \
+  amp /= 2147483648.0; \
+  \
   i = 0; \
   while (i < (src->generate_samples_per_buffer * channels)) { \
     for (c = 0; c < channels; ++c) \
-      samples[i++] = (g##type) (amp * g_rand_double_range (src->gen, -1.0, 1.0)); \
+      samples[i++] = (g##type) (amp * (gint32) g_rand_int (src->gen)); \
   } \
 }
 
@@ -589,15 +607,9 @@ gst_audio_test_src_generate_pink_noise_value (GstAudioTestSrc * src)
 
   /* If index is zero, don't update any random values. */
   if (pink->index != 0) {
-    /* Determine how many trailing zeros in PinkIndex. */
-    /* This algorithm will hang if n==0 so test first. */
-    gint num_zeros = 0;
-    gint n = pink->index;
-
-    while ((n & 1) == 0) {
-      n = n >> 1;
-      num_zeros++;
-    }
+    /* Determine how many trailing zeros in PinkIndex, index is not 0
+     * here. */
+    gint num_zeros = g_bit_nth_lsf (pink->index, -1);
 
     /* Replace the indexed ROWS random value.
      * Subtract and add back to RunningSum instead of adding all the random
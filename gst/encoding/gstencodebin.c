@@ -95,6 +95,13 @@
  * that fits exactly within the request GstSegment.
  * </listitem>
  * <listitem>
+ * Multiple renditions from a single input. With the share-video-input flag
+ * set on #GstEncodeBin:flags, one video sink pad feeds every video stream
+ * profile of the #GstEncodingContainerProfile (for example the same content
+ * at several resolutions and bitrates). The input is converted once and
+ * each rendition is scaled and encoded in its own thread.
+ * </listitem>
+ * <listitem>
  * Missing plugin support. If a #GstElement is missing to encode/mux to the
  * request profile formats, a missing-plugin #GstMessage will be posted on the
  * #GstBus, allowing systems that support the missing-plugin system to offer the
@@ -121,7 +128,8 @@
 typedef enum
 {
   GST_ENCODEBIN_FLAG_NO_AUDIO_CONVERSION = (1 << 0),
-  GST_ENCODEBIN_FLAG_NO_VIDEO_CONVERSION = (1 << 1)
+  GST_ENCODEBIN_FLAG_NO_VIDEO_CONVERSION = (1 << 1),
+  GST_ENCODEBIN_FLAG_SHARE_VIDEO_INPUT = (1 << 2)
 } GstEncodeBinFlags;
 
 #define GST_TYPE_ENCODEBIN_FLAGS (gst_encodebin_flags_get_type())
@@ -169,12 +177,6 @@ struct _GstEncodeBin
   /* TRUE if in PAUSED/PLAYING */
   gboolean active;
 
-  /* available muxers, encoders and parsers */
-  GList *muxers;
-  GList *formatters;
-  GList *encoders;
-  GList *parsers;
-
   /* Increasing counter for unique pad name */
   guint last_pad_id;
 
@@ -191,6 +193,11 @@ struct _GstEncodeBin
   gboolean avoid_reencoding;
 
   GstEncodeBinFlags flags;
+
+  /* Shared video input (GST_ENCODEBIN_FLAG_SHARE_VIDEO_INPUT) */
+  GstPad *video_pad;            /* Sink ghostpad */
+  GstElement *video_convert;    /* Converter shared by all renditions */
+  GstElement *video_tee;        /* Fans out to each rendition's inqueue */
 };
 
 struct _GstEncodeBinClass
@@ -210,6 +217,7 @@ struct _StreamGroup
   GstEncodeBin *ebin;
   GstEncodingProfile *profile;
   GstPad *ghostpad;             /* Sink ghostpad */
+  GstPad *teepad;               /* Shared video input tee pad (can be NULL) */
   GstElement *inqueue;          /* Queue just after the ghostpad */
   GstElement *splitter;
   GList *converters;            /* List of conversion GstElement */
@@ -270,6 +278,8 @@ gst_encodebin_flags_get_type (void)
           "conversion elements", "no-audio-conversion"},
     {C_FLAGS (GST_ENCODEBIN_FLAG_NO_VIDEO_CONVERSION), "Do not use video "
           "conversion elements", "no-video-conversion"},
+    {C_FLAGS (GST_ENCODEBIN_FLAG_SHARE_VIDEO_INPUT), "Feed all video "
+          "streams from a single input", "share-video-input"},
     {0, NULL, NULL}
   };
   static volatile GType id = 0;
@@ -313,8 +323,12 @@ static gboolean gst_encode_bin_setup_profile (GstEncodeBin * ebin,
     GstEncodingProfile * profile);
 
 static StreamGroup *_create_stream_group (GstEncodeBin * ebin,
-    GstEncodingProfile * sprof, const gchar * sinkpadname, GstCaps * sinkcaps);
+    GstEncodingProfile * sprof, const gchar * sinkpadname, GstCaps * sinkcaps,
+    GstElement * tee);
 static void stream_group_remove (GstEncodeBin * ebin, StreamGroup * sgroup);
+static GstPad *_create_video_renditions (GstEncodeBin * ebin,
+    const gchar * sinkpadname);
+static void _remove_video_renditions (GstEncodeBin * ebin);
 static GstPad *gst_encode_bin_request_pad_signal (GstEncodeBin * encodebin,
     GstCaps * caps);
 static GstPad *gst_encode_bin_request_profile_pad_signal (GstEncodeBin *
@@ -458,18 +472,6 @@ gst_encode_bin_dispose (GObject * object)
 {
   GstEncodeBin *ebin = (GstEncodeBin *) object;
 
-  if (ebin->muxers)
-    gst_plugin_feature_list_free (ebin->muxers);
-
-  if (ebin->formatters)
-    gst_plugin_feature_list_free (ebin->formatters);
-
-  if (ebin->encoders)
-    gst_plugin_feature_list_free (ebin->encoders);
-
-  if (ebin->parsers)
-    gst_plugin_feature_list_free (ebin->parsers);
-
   gst_encode_bin_tear_down_profile (ebin);
 
   if (ebin->raw_video_caps)
@@ -487,22 +489,6 @@ gst_encode_bin_init (GstEncodeBin * encode_bin)
 {
   GstPadTemplate *tmpl;
 
-  encode_bin->muxers =
-      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_MUXER,
-      GST_RANK_MARGINAL);
-
-  encode_bin->formatters =
-      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_FORMATTER,
-      GST_RANK_SECONDARY);
-
-  encode_bin->encoders =
-      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_ENCODER,
-      GST_RANK_MARGINAL);
-
-  encode_bin->parsers =
-      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_PARSER,
-      GST_RANK_MARGINAL);
-
   encode_bin->raw_video_caps = gst_caps_from_string ("video/x-raw");
   encode_bin->raw_audio_caps = gst_caps_from_string ("audio/x-raw");
   /* encode_bin->raw_text_caps = */
@@ -721,7 +707,11 @@ request_pad_for_stream (GstEncodeBin * encodebin, GType ptype,
   if (G_UNLIKELY (sprof == NULL))
     goto no_stream_profile;
 
-  sgroup = _create_stream_group (encodebin, sprof, name, caps);
+  if ((encodebin->flags & GST_ENCODEBIN_FLAG_SHARE_VIDEO_INPUT)
+      && GST_IS_ENCODING_VIDEO_PROFILE (sprof) && encodebin->muxer)
+    return _create_video_renditions (encodebin, name);
+
+  sgroup = _create_stream_group (encodebin, sprof, name, caps, NULL);
   if (G_UNLIKELY (sgroup == NULL))
     goto no_stream_group;
 
@@ -813,6 +803,12 @@ gst_encode_bin_release_pad (GstElement * element, GstPad * pad)
   GstEncodeBin *ebin = (GstEncodeBin *) element;
   StreamGroup *sgroup;
 
+  /* Releasing the shared video input releases all its renditions */
+  if (ebin->video_pad && pad == ebin->video_pad) {
+    _remove_video_renditions (ebin);
+    return;
+  }
+
   /* Find the associated StreamGroup */
 
   sgroup = find_stream_group_from_pad (ebin, pad);
@@ -831,11 +827,123 @@ no_stream_group:
   }
 }
 
+/* Process-wide cache of the available muxers, formatters, encoders and
+ * parsers and of the factories compatible with a given format. Encodebins
+ * are usually set up again and again with the same few profiles, this avoids
+ * scanning the registry and intersecting caps each time. The cache is
+ * dropped when the registry changes. */
+typedef enum
+{
+  FACTORY_MUXER,
+  FACTORY_FORMATTER,
+  FACTORY_ENCODER,
+  FACTORY_PARSER,
+  FACTORY_N_KINDS
+} FactoryKind;
+
+/* keep the cache from growing without bounds */
+#define FACTORY_CACHE_MAX_ENTRIES 256
+
+G_LOCK_DEFINE_STATIC (factory_cache);
+static guint32 factory_cache_cookie;
+static GList *factory_cache_lists[FACTORY_N_KINDS];
+static GHashTable *factory_cache_filtered;
+
+static gint compare_elements (gconstpointer a, gconstpointer b,
+    gpointer udata);
+
+/* call with the factory_cache lock */
+static void
+_factory_cache_update (void)
+{
+  guint32 cookie;
+  gint i;
+
+  cookie = gst_registry_get_feature_list_cookie (gst_registry_get ());
+  if (factory_cache_filtered && cookie == factory_cache_cookie)
+    return;
+
+  GST_DEBUG ("registry changed, updating factory cache");
+
+  for (i = 0; i < FACTORY_N_KINDS; i++) {
+    if (factory_cache_lists[i])
+      gst_plugin_feature_list_free (factory_cache_lists[i]);
+  }
+
+  factory_cache_lists[FACTORY_MUXER] =
+      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_MUXER,
+      GST_RANK_MARGINAL);
+  factory_cache_lists[FACTORY_FORMATTER] =
+      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_FORMATTER,
+      GST_RANK_SECONDARY);
+  factory_cache_lists[FACTORY_ENCODER] =
+      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_ENCODER,
+      GST_RANK_MARGINAL);
+  factory_cache_lists[FACTORY_PARSER] =
+      gst_element_factory_list_get_elements (GST_ELEMENT_FACTORY_TYPE_PARSER,
+      GST_RANK_MARGINAL);
+
+  if (factory_cache_filtered)
+    g_hash_table_remove_all (factory_cache_filtered);
+  else
+    factory_cache_filtered = g_hash_table_new_full (g_str_hash, g_str_equal,
+        g_free, (GDestroyNotify) gst_plugin_feature_list_free);
+
+  factory_cache_cookie = cookie;
+}
+
+/* Get the factories of @kind that can handle @caps in @direction, parsers
+ * are filtered on both directions. If @sort is set, the result is ordered
+ * with compare_elements(). Free the result with
+ * gst_plugin_feature_list_free(). */
+static GList *
+_get_compatible_factories (FactoryKind kind, GstCaps * caps,
+    GstPadDirection direction, gboolean subsetonly, gboolean sort)
+{
+  GList *res, *tmp;
+  gchar *caps_str, *key;
+
+  caps_str = gst_caps_to_string (caps);
+  key = g_strdup_printf ("%d:%d:%d:%d:%s", kind, direction, subsetonly, sort,
+      caps_str);
+  g_free (caps_str);
+
+  G_LOCK (factory_cache);
+  _factory_cache_update ();
+
+  if (g_hash_table_lookup_extended (factory_cache_filtered, key, NULL,
+          (gpointer *) & res)) {
+    res = gst_plugin_feature_list_copy (res);
+    G_UNLOCK (factory_cache);
+    g_free (key);
+    return res;
+  }
+
+  res = gst_element_factory_list_filter (factory_cache_lists[kind], caps,
+      direction, subsetonly);
+  if (kind == FACTORY_PARSER) {
+    tmp = res;
+    res = gst_element_factory_list_filter (tmp, caps, GST_PAD_SINK,
+        subsetonly);
+    gst_plugin_feature_list_free (tmp);
+  }
+  if (sort)
+    res = g_list_sort_with_data (res, compare_elements, caps);
+
+  if (g_hash_table_size (factory_cache_filtered) >= FACTORY_CACHE_MAX_ENTRIES)
+    g_hash_table_remove_all (factory_cache_filtered);
+  g_hash_table_insert (factory_cache_filtered, key,
+      gst_plugin_feature_list_copy (res));
+  G_UNLOCK (factory_cache);
+
+  return res;
+}
+
 /* Create a parser for the given stream profile */
 static inline GstElement *
 _get_parser (GstEncodeBin * ebin, GstEncodingProfile * sprof)
 {
-  GList *parsers1, *parsers, *tmp;
+  GList *parsers, *tmp;
   GstElement *parser = NULL;
   GstElementFactory *parserfact = NULL;
   GstCaps *format;
@@ -844,14 +952,9 @@ _get_parser (GstEncodeBin * ebin, GstEncodingProfile * sprof)
 
   GST_DEBUG ("Getting list of parsers for format %" GST_PTR_FORMAT, format);
 
-  /* FIXME : requesting twice the parsers twice is a bit ugly, we should
-   * have a method to request on more than one condition */
-  parsers1 =
-      gst_element_factory_list_filter (ebin->parsers, format,
-      GST_PAD_SRC, FALSE);
   parsers =
-      gst_element_factory_list_filter (parsers1, format, GST_PAD_SINK, FALSE);
-  gst_plugin_feature_list_free (parsers1);
+      _get_compatible_factories (FACTORY_PARSER, format, GST_PAD_SRC, FALSE,
+      FALSE);
 
   if (G_UNLIKELY (parsers == NULL)) {
     GST_DEBUG ("Couldn't find any compatible parsers");
@@ -935,8 +1038,8 @@ _get_encoder (GstEncodeBin * ebin, GstEncodingProfile * sprof)
   }
 
   encoders =
-      gst_element_factory_list_filter (ebin->encoders, format,
-      GST_PAD_SRC, FALSE);
+      _get_compatible_factories (FACTORY_ENCODER, format, GST_PAD_SRC, FALSE,
+      FALSE);
 
   if (G_UNLIKELY (encoders == NULL)) {
     GST_DEBUG ("Couldn't find any compatible encoders");
@@ -1070,10 +1173,12 @@ _has_class (GstElement * element, const gchar * classname)
  * Create the elements, StreamGroup, add the sink pad, link it to the muxer
  *
  * sinkpadname: If non-NULL, that name will be assigned to the sink ghost pad
- * sinkcaps: If non-NULL will be used to figure out how to setup the group */
+ * sinkcaps: If non-NULL will be used to figure out how to setup the group
+ * tee: If non-NULL, the group is fed from a request pad of that tee instead
+ *   of getting its own sink ghost pad */
 static StreamGroup *
 _create_stream_group (GstEncodeBin * ebin, GstEncodingProfile * sprof,
-    const gchar * sinkpadname, GstCaps * sinkcaps)
+    const gchar * sinkpadname, GstCaps * sinkcaps, GstElement * tee)
 {
   StreamGroup *sgroup = NULL;
   GstPad *sinkpad, *srcpad, *muxerpad = NULL;
@@ -1214,9 +1319,21 @@ _create_stream_group (GstEncodeBin * ebin, GstEncodingProfile * sprof,
   if (G_UNLIKELY (!fast_element_link (sgroup->inqueue, sgroup->splitter)))
     goto splitter_link_failure;
 
-  /* Expose input queue sink pad as ghostpad */
+  /* Expose input queue sink pad as ghostpad, or feed it from the shared
+   * video input */
   sinkpad = gst_element_get_static_pad (sgroup->inqueue, "sink");
-  if (sinkpadname == NULL) {
+  if (tee) {
+    sgroup->teepad = gst_element_get_request_pad (tee, "src_%u");
+    if (G_UNLIKELY (sgroup->teepad == NULL)) {
+      gst_object_unref (sinkpad);
+      goto no_tee_srcpad;
+    }
+    if (G_UNLIKELY (fast_pad_link (sgroup->teepad, sinkpad) !=
+            GST_PAD_LINK_OK)) {
+      gst_object_unref (sinkpad);
+      goto tee_link_failure;
+    }
+  } else if (sinkpadname == NULL) {
     gchar *pname =
         g_strdup_printf ("%s_%u", gst_encoding_profile_get_type_nick (sprof),
         ebin->last_pad_id++);
@@ -1313,7 +1430,6 @@ _create_stream_group (GstEncodeBin * ebin, GstEncodingProfile * sprof,
     GST_LOG ("Adding conversion elements for video stream");
 
     if (!native_video) {
-      cspace = gst_element_factory_make ("videoconvert", NULL);
       scale = gst_element_factory_make ("videoscale", NULL);
       if (!scale) {
         missing_element_name = "videoscale";
@@ -1323,23 +1439,39 @@ _create_stream_group (GstEncodeBin * ebin, GstEncodingProfile * sprof,
       g_object_set (scale, "method", 2, "add-borders", TRUE, NULL);
       cspace2 = gst_element_factory_make ("videoconvert", NULL);
 
-      if (!cspace || !cspace2) {
+      if (!cspace2) {
         missing_element_name = "videoconvert";
         goto missing_element;
       }
 
-      gst_bin_add_many ((GstBin *) ebin, cspace, scale, cspace2, NULL);
-      tosync = g_list_append (tosync, cspace);
+      gst_bin_add_many ((GstBin *) ebin, scale, cspace2, NULL);
       tosync = g_list_append (tosync, scale);
       tosync = g_list_append (tosync, cspace2);
 
-      sgroup->converters = g_list_prepend (sgroup->converters, cspace);
       sgroup->converters = g_list_prepend (sgroup->converters, scale);
       sgroup->converters = g_list_prepend (sgroup->converters, cspace2);
 
-      if (!fast_element_link (cspace, scale) ||
-          !fast_element_link (scale, cspace2))
+      if (!fast_element_link (scale, cspace2))
         goto converter_link_failure;
+
+      /* When fed from the shared video input, the input conversion has
+       * already been done once for all renditions */
+      if (tee) {
+        cspace = scale;
+      } else {
+        cspace = gst_element_factory_make ("videoconvert", NULL);
+        if (!cspace) {
+          missing_element_name = "videoconvert";
+          goto missing_element;
+        }
+
+        gst_bin_add ((GstBin *) ebin, cspace);
+        tosync = g_list_append (tosync, cspace);
+        sgroup->converters = g_list_prepend (sgroup->converters, cspace);
+
+        if (!fast_element_link (cspace, scale))
+          goto converter_link_failure;
+      }
     }
 
     if (!gst_encoding_video_profile_get_variableframerate
@@ -1429,9 +1561,11 @@ _create_stream_group (GstEncodeBin * ebin, GstEncodingProfile * sprof,
   g_list_free (tosync);
 
   /* Add ghostpad */
-  GST_DEBUG ("Adding ghostpad %s:%s", GST_DEBUG_PAD_NAME (sgroup->ghostpad));
-  gst_pad_set_active (sgroup->ghostpad, TRUE);
-  gst_element_add_pad ((GstElement *) ebin, sgroup->ghostpad);
+  if (sgroup->ghostpad) {
+    GST_DEBUG ("Adding ghostpad %s:%s", GST_DEBUG_PAD_NAME (sgroup->ghostpad));
+    gst_pad_set_active (sgroup->ghostpad, TRUE);
+    gst_element_add_pad ((GstElement *) ebin, sgroup->ghostpad);
+  }
 
   /* Add StreamGroup to our list of streams */
 
@@ -1508,6 +1642,14 @@ splitter_link_failure:
   GST_ERROR_OBJECT (ebin, "Failure linking to the splitter");
   goto cleanup;
 
+no_tee_srcpad:
+  GST_ERROR_OBJECT (ebin, "Couldn't get a source pad from the shared tee");
+  goto cleanup;
+
+tee_link_failure:
+  GST_ERROR_OBJECT (ebin, "Failure linking the shared tee");
+  goto cleanup;
+
 combiner_link_failure:
   GST_ERROR_OBJECT (ebin, "Failure linking to the combiner");
   goto cleanup;
@@ -1530,6 +1672,151 @@ cleanup:
   return NULL;
 }
 
+/*
+ * Create the shared video input: a single sink ghost pad, converted once and
+ * fanned out by a tee to one StreamGroup per video stream profile of the
+ * container profile. Each rendition then scales and encodes in the
+ * streaming thread of its own input queue.
+ *
+ * sinkpadname: If non-NULL, that name will be assigned to the sink ghost pad
+ */
+static GstPad *
+_create_video_renditions (GstEncodeBin * ebin, const gchar * sinkpadname)
+{
+  const GList *tmp;
+  GstElement *first;
+  GstPad *sinkpad;
+  const gchar *missing_element_name;
+  guint nbrenditions = 0;
+
+  if (G_UNLIKELY (ebin->video_pad != NULL))
+    goto already_shared;
+
+  ebin->video_tee = gst_element_factory_make ("tee", NULL);
+  if (G_UNLIKELY (ebin->video_tee == NULL)) {
+    missing_element_name = "tee";
+    goto missing_element;
+  }
+  gst_bin_add ((GstBin *) ebin, ebin->video_tee);
+  first = ebin->video_tee;
+
+  if (!(ebin->flags & GST_ENCODEBIN_FLAG_NO_VIDEO_CONVERSION)) {
+    ebin->video_convert = gst_element_factory_make ("videoconvert", NULL);
+    if (G_UNLIKELY (ebin->video_convert == NULL)) {
+      missing_element_name = "videoconvert";
+      goto missing_element;
+    }
+    gst_bin_add ((GstBin *) ebin, ebin->video_convert);
+    if (G_UNLIKELY (!fast_element_link (ebin->video_convert, ebin->video_tee)))
+      goto converter_link_failure;
+    first = ebin->video_convert;
+  }
+
+  for (tmp =
+      gst_encoding_container_profile_get_profiles
+      (GST_ENCODING_CONTAINER_PROFILE (ebin->profile)); tmp;
+      tmp = tmp->next) {
+    GstEncodingProfile *sprof = (GstEncodingProfile *) tmp->data;
+    guint presence = gst_encoding_profile_get_presence (sprof);
+
+    if (!GST_IS_ENCODING_VIDEO_PROFILE (sprof))
+      continue;
+    if (presence != 0 && presence <= stream_profile_used_count (ebin, sprof))
+      continue;
+
+    GST_DEBUG ("Adding rendition for %s",
+        gst_encoding_profile_get_name (sprof));
+    if (G_UNLIKELY (_create_stream_group (ebin, sprof, NULL, NULL,
+                ebin->video_tee) == NULL))
+      goto rendition_failure;
+    nbrenditions++;
+  }
+
+  if (G_UNLIKELY (nbrenditions == 0))
+    goto no_renditions;
+
+  sinkpad = gst_element_get_static_pad (first, "sink");
+  if (sinkpadname == NULL) {
+    gchar *pname = g_strdup_printf ("video_%u", ebin->last_pad_id++);
+    ebin->video_pad = gst_ghost_pad_new (pname, sinkpad);
+    g_free (pname);
+  } else
+    ebin->video_pad = gst_ghost_pad_new (sinkpadname, sinkpad);
+  gst_object_unref (sinkpad);
+
+  gst_element_sync_state_with_parent (ebin->video_tee);
+  if (ebin->video_convert)
+    gst_element_sync_state_with_parent (ebin->video_convert);
+
+  GST_DEBUG ("Adding shared video ghostpad %s:%s for %u renditions",
+      GST_DEBUG_PAD_NAME (ebin->video_pad), nbrenditions);
+  gst_pad_set_active (ebin->video_pad, TRUE);
+  gst_element_add_pad ((GstElement *) ebin, ebin->video_pad);
+
+  return ebin->video_pad;
+
+already_shared:
+  GST_WARNING_OBJECT (ebin, "Shared video input already requested");
+  return NULL;
+
+missing_element:
+  gst_element_post_message (GST_ELEMENT_CAST (ebin),
+      gst_missing_element_message_new (GST_ELEMENT_CAST (ebin),
+          missing_element_name));
+  GST_ELEMENT_ERROR (ebin, CORE, MISSING_PLUGIN,
+      (_("Missing element '%s' - check your GStreamer installation."),
+          missing_element_name), (NULL));
+  goto cleanup;
+
+converter_link_failure:
+  GST_ERROR_OBJECT (ebin, "Failure linking the shared video converter");
+  goto cleanup;
+
+rendition_failure:
+  GST_ERROR_OBJECT (ebin, "Couldn't create a rendition StreamGroup");
+  goto cleanup;
+
+no_renditions:
+  GST_WARNING_OBJECT (ebin, "No video stream profile available");
+  goto cleanup;
+
+cleanup:
+  _remove_video_renditions (ebin);
+  return NULL;
+}
+
+/* Remove the shared video input and all the renditions it feeds */
+static void
+_remove_video_renditions (GstEncodeBin * ebin)
+{
+  GList *tmp, *next;
+
+  for (tmp = ebin->streams; tmp; tmp = next) {
+    StreamGroup *sgroup = (StreamGroup *) tmp->data;
+
+    next = tmp->next;
+    if (sgroup->teepad)
+      stream_group_remove (ebin, sgroup);
+  }
+
+  if (ebin->video_pad) {
+    gst_element_remove_pad (GST_ELEMENT_CAST (ebin), ebin->video_pad);
+    ebin->video_pad = NULL;
+  }
+
+  if (ebin->video_convert) {
+    gst_element_set_state (ebin->video_convert, GST_STATE_NULL);
+    gst_bin_remove ((GstBin *) ebin, ebin->video_convert);
+    ebin->video_convert = NULL;
+  }
+
+  if (ebin->video_tee) {
+    gst_element_set_state (ebin->video_tee, GST_STATE_NULL);
+    gst_bin_remove ((GstBin *) ebin, ebin->video_tee);
+    ebin->video_tee = NULL;
+  }
+}
+
 static gboolean
 _gst_caps_match_foreach (GQuark field_id, const GValue * value, gpointer data)
 {
@@ -1612,8 +1899,8 @@ _get_formatter (GstEncodeBin * ebin, GstEncodingProfile * sprof)
   GST_DEBUG ("Getting list of formatters for format %" GST_PTR_FORMAT, format);
 
   formatters =
-      gst_element_factory_list_filter (ebin->formatters, format, GST_PAD_SRC,
-      FALSE);
+      _get_compatible_factories (FACTORY_FORMATTER, format, GST_PAD_SRC,
+      FALSE, FALSE);
 
   if (formatters == NULL)
     goto beach;
@@ -1681,15 +1968,11 @@ _get_muxer (GstEncodeBin * ebin)
   GST_DEBUG ("Getting list of muxers for format %" GST_PTR_FORMAT, format);
 
   muxers =
-      gst_element_factory_list_filter (ebin->muxers, format, GST_PAD_SRC, TRUE);
-
-  formatters =
-      gst_element_factory_list_filter (ebin->formatters, format, GST_PAD_SRC,
+      _get_compatible_factories (FACTORY_MUXER, format, GST_PAD_SRC, TRUE,
       TRUE);
-
-  muxers = g_list_sort_with_data (muxers, compare_elements, (gpointer) format);
   formatters =
-      g_list_sort_with_data (formatters, compare_elements, (gpointer) format);
+      _get_compatible_factories (FACTORY_FORMATTER, format, GST_PAD_SRC, TRUE,
+      TRUE);
 
   muxers = g_list_concat (muxers, formatters);
 
@@ -1748,6 +2031,7 @@ create_elements_and_pads (GstEncodeBin * ebin)
   GstPad *muxerpad;
   const GList *tmp, *profiles;
   GstEncodingProfile *sprof;
+  gboolean share_video = FALSE;
 
   GST_DEBUG ("Current profile : %s",
       gst_encoding_profile_get_name (ebin->profile));
@@ -1785,14 +2069,24 @@ create_elements_and_pads (GstEncodeBin * ebin)
           gst_encoding_profile_get_presence (sprof));
 
       if (gst_encoding_profile_get_presence (sprof) != 0) {
-        if (G_UNLIKELY (_create_stream_group (ebin, sprof, NULL, NULL) == NULL))
+        /* Video streams are all fed from the shared input, created below */
+        if ((ebin->flags & GST_ENCODEBIN_FLAG_SHARE_VIDEO_INPUT)
+            && GST_IS_ENCODING_VIDEO_PROFILE (sprof)) {
+          share_video = TRUE;
+          continue;
+        }
+        if (G_UNLIKELY (_create_stream_group (ebin, sprof, NULL, NULL,
+                    NULL) == NULL))
           goto stream_error;
       }
     }
+    if (share_video
+        && G_UNLIKELY (_create_video_renditions (ebin, NULL) == NULL))
+      goto stream_error;
     gst_element_sync_state_with_parent (muxer);
   } else {
     if (G_UNLIKELY (_create_stream_group (ebin, ebin->profile, NULL,
-                NULL) == NULL))
+                NULL, NULL) == NULL))
       goto stream_error;
   }
 
@@ -1912,6 +2206,12 @@ stream_group_free (GstEncodeBin * ebin, StreamGroup * sgroup)
   if (sgroup->ghostpad)
     gst_element_remove_pad (GST_ELEMENT_CAST (ebin), sgroup->ghostpad);
 
+  /* Shared video input tee pad */
+  if (sgroup->teepad) {
+    gst_element_release_request_pad (ebin->video_tee, sgroup->teepad);
+    gst_object_unref (sgroup->teepad);
+  }
+
   if (sgroup->inqueue)
     gst_element_set_state (sgroup->inqueue, GST_STATE_NULL);
 
@@ -1999,6 +2299,8 @@ gst_encode_bin_tear_down_profile (GstEncodeBin * ebin)
   GST_DEBUG ("Tearing down profile %s",
       gst_encoding_profile_get_name (ebin->profile));
 
+  _remove_video_renditions (ebin);
+
   while (ebin->streams)
     stream_group_remove (ebin, (StreamGroup *) ebin->streams->data);
 
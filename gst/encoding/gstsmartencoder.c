@@ -194,7 +194,8 @@ gst_smart_encoder_reencode_gop (GstSmartEncoder * smart_encoder)
   }
 
   /* Activate elements */
-  /* Set elements to PAUSED */
+  /* Set elements to PAUSED. They stay there between GOPs so that the codecs
+   * are only opened once, the flush below resets them for the new GOP. */
   gst_element_set_state (smart_encoder->encoder, GST_STATE_PAUSED);
   gst_element_set_state (smart_encoder->decoder, GST_STATE_PAUSED);
 
@@ -222,8 +223,9 @@ gst_smart_encoder_reencode_gop (GstSmartEncoder * smart_encoder)
 
   if (G_UNLIKELY (res != GST_FLOW_OK)) {
     GST_WARNING ("Error pushing pending buffers : %s", gst_flow_get_name (res));
-    /* Remove pending bfufers */
-    for (tmp = smart_encoder->pending_gop; tmp; tmp = tmp->next) {
+    /* Remove pending buffers, the ones up to the failed one were consumed
+     * by the push */
+    for (tmp = tmp->next; tmp; tmp = tmp->next) {
       gst_buffer_unref ((GstBuffer *) tmp->data);
     }
   } else {
@@ -231,11 +233,6 @@ gst_smart_encoder_reencode_gop (GstSmartEncoder * smart_encoder)
     gst_pad_push_event (smart_encoder->internal_srcpad, gst_event_new_eos ());
   }
 
-  /* Activate elements */
-  /* Set elements to PAUSED */
-  gst_element_set_state (smart_encoder->encoder, GST_STATE_NULL);
-  gst_element_set_state (smart_encoder->decoder, GST_STATE_NULL);
-
   g_list_free (smart_encoder->pending_gop);
   smart_encoder->pending_gop = NULL;
 
@@ -253,6 +250,8 @@ gst_smart_encoder_push_pending_gop (GstSmartEncoder * smart_encoder)
       ")", GST_TIME_ARGS (smart_encoder->gop_start),
       GST_TIME_ARGS (smart_encoder->gop_stop));
 
+  smart_encoder->pending_gop = g_list_reverse (smart_encoder->pending_gop);
+
   /* If GOP is entirely within segment, just push downstream */
   if (gst_segment_clip (smart_encoder->segment, GST_FORMAT_TIME,
           smart_encoder->gop_start, smart_encoder->gop_stop, &cstart, &cstop)) {
@@ -262,14 +261,16 @@ gst_smart_encoder_push_pending_gop (GstSmartEncoder * smart_encoder)
           GST_TIME_FORMAT, GST_TIME_ARGS (cstart), GST_TIME_ARGS (cstop));
       res = gst_smart_encoder_reencode_gop (smart_encoder);
     } else {
-      /* The whole GOP is within the segment, push all pending buffers downstream */
+      GstBufferList *list;
+
+      /* The whole GOP is within the segment, push all pending buffers
+       * downstream in one go */
       GST_DEBUG ("GOP doesn't need to be modified, pushing downstream");
-      for (tmp = smart_encoder->pending_gop; tmp; tmp = tmp->next) {
-        GstBuffer *buf = (GstBuffer *) tmp->data;
-        res = gst_pad_push (smart_encoder->srcpad, buf);
-        if (G_UNLIKELY (res != GST_FLOW_OK))
-          break;
-      }
+      list = gst_buffer_list_sized_new (g_list_length (smart_encoder->
+              pending_gop));
+      for (tmp = smart_encoder->pending_gop; tmp; tmp = tmp->next)
+        gst_buffer_list_add (list, (GstBuffer *) tmp->data);
+      res = gst_pad_push_list (smart_encoder->srcpad, list);
     }
   } else {
     /* The whole GOP is outside the segment, there's most likely
@@ -325,8 +326,9 @@ gst_smart_encoder_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
     smart_encoder->gop_start = GST_BUFFER_TIMESTAMP (buf);
   }
 
-  /* Store buffer */
-  smart_encoder->pending_gop = g_list_append (smart_encoder->pending_gop, buf);
+  /* Store buffer, the list is kept in reverse order until the GOP is
+   * complete */
+  smart_encoder->pending_gop = g_list_prepend (smart_encoder->pending_gop, buf);
   /* Update GOP stop position */
   if (GST_BUFFER_TIMESTAMP_IS_VALID (buf)) {
     smart_encoder->gop_stop = GST_BUFFER_TIMESTAMP (buf);
@@ -92,6 +92,11 @@ gst_stream_splitter_dispose (GObject * object)
   g_list_free (stream_splitter->pending_events);
   stream_splitter->pending_events = NULL;
 
+  if (stream_splitter->chain_pad) {
+    gst_object_unref (stream_splitter->chain_pad);
+    stream_splitter->chain_pad = NULL;
+  }
+
   G_OBJECT_CLASS (gst_stream_splitter_parent_class)->dispose (object);
 }
 
@@ -110,12 +115,24 @@ gst_stream_splitter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 {
   GstStreamSplitter *stream_splitter = (GstStreamSplitter *) parent;
   GstFlowReturn res;
-  GstPad *srcpad = NULL;
+  GstPad *srcpad;
 
-  STREAMS_LOCK (stream_splitter);
-  if (stream_splitter->current)
-    srcpad = gst_object_ref (stream_splitter->current);
-  STREAMS_UNLOCK (stream_splitter);
+  /* Only take the lock when the current pad changed since the last buffer,
+   * otherwise keep pushing on the pad we hold a reference to */
+  if (G_UNLIKELY (g_atomic_int_get (&stream_splitter->current_cookie) !=
+          stream_splitter->chain_cookie)) {
+    GstPad *oldpad = stream_splitter->chain_pad;
+
+    STREAMS_LOCK (stream_splitter);
+    stream_splitter->chain_pad = stream_splitter->current ?
+        gst_object_ref (stream_splitter->current) : NULL;
+    stream_splitter->chain_cookie = stream_splitter->current_cookie;
+    STREAMS_UNLOCK (stream_splitter);
+
+    if (oldpad)
+      gst_object_unref (oldpad);
+  }
+  srcpad = stream_splitter->chain_pad;
 
   if (G_UNLIKELY (srcpad == NULL))
     goto nopad;
@@ -134,7 +151,6 @@ gst_stream_splitter_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 
   /* Forward to currently activated stream */
   res = gst_pad_push (srcpad, buf);
-  gst_object_unref (srcpad);
 
   return res;
 
@@ -379,6 +395,7 @@ resync:
       /* FIXME : we need to switch properly */
       GST_DEBUG_OBJECT (srcpad, "Setting caps on this pad was successful");
       stream_splitter->current = srcpad;
+      g_atomic_int_inc (&stream_splitter->current_cookie);
       goto beach;
     }
     tmp = tmp->next;
@@ -469,6 +486,7 @@ gst_stream_splitter_release_pad (GstElement * element, GstPad * pad)
       /* Deactivate current flow */
       GST_DEBUG_OBJECT (element, "Removed pad was the current one");
       stream_splitter->current = NULL;
+      g_atomic_int_inc (&stream_splitter->current_cookie);
     }
 
     gst_element_remove_pad (element, pad);
@@ -46,6 +46,13 @@ struct _GstStreamSplitter {
   GstPad *current;
   GList *srcpads;
   guint32 cookie;
+  /* Bumped atomically (with the lock taken) whenever current changes */
+  volatile gint current_cookie;
+
+  /* Streaming thread only: reference to the pad buffers are pushed on,
+   * refreshed from current when current_cookie changed */
+  GstPad *chain_pad;
+  gint chain_cookie;
 
   /* List of pending in-band events */
   GList *pending_events;
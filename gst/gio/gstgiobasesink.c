@@ -33,10 +33,22 @@ static GstStaticPadTemplate sink_factory = GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_ALWAYS,
     GST_STATIC_CAPS_ANY);
 
+enum
+{
+  PROP_0,
+  PROP_BUFFER_SIZE
+};
+
+#define DEFAULT_BUFFER_SIZE 0
+
 #define gst_gio_base_sink_parent_class parent_class
 G_DEFINE_TYPE (GstGioBaseSink, gst_gio_base_sink, GST_TYPE_BASE_SINK);
 
 static void gst_gio_base_sink_finalize (GObject * object);
+static void gst_gio_base_sink_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_gio_base_sink_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
 static gboolean gst_gio_base_sink_start (GstBaseSink * base_sink);
 static gboolean gst_gio_base_sink_stop (GstBaseSink * base_sink);
 static gboolean gst_gio_base_sink_unlock (GstBaseSink * base_sink);
@@ -58,6 +70,22 @@ gst_gio_base_sink_class_init (GstGioBaseSinkClass * klass)
       "GIO base sink");
 
   gobject_class->finalize = gst_gio_base_sink_finalize;
+  gobject_class->set_property = gst_gio_base_sink_set_property;
+  gobject_class->get_property = gst_gio_base_sink_get_property;
+
+  /**
+   * GstGioBaseSink:buffer-size
+   *
+   * Size of the buffer used to collect small writes before passing them
+   * on to the stream, or 0 to write every buffer directly. Useful for
+   * network locations, where every write is a round trip.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_BUFFER_SIZE,
+      g_param_spec_uint ("buffer-size", "Buffer size",
+          "Size of the write buffer in bytes (0 = unbuffered)", 0, G_MAXUINT,
+          DEFAULT_BUFFER_SIZE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&sink_factory));
@@ -78,6 +106,7 @@ gst_gio_base_sink_init (GstGioBaseSink * sink)
   gst_base_sink_set_sync (GST_BASE_SINK (sink), FALSE);
 
   sink->cancel = g_cancellable_new ();
+  sink->buffer_size = DEFAULT_BUFFER_SIZE;
 }
 
 static void
@@ -98,11 +127,48 @@ gst_gio_base_sink_finalize (GObject * object)
   GST_CALL_PARENT (G_OBJECT_CLASS, finalize, (object));
 }
 
+static void
+gst_gio_base_sink_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstGioBaseSink *sink = GST_GIO_BASE_SINK (object);
+
+  switch (prop_id) {
+    case PROP_BUFFER_SIZE:
+      GST_OBJECT_LOCK (sink);
+      sink->buffer_size = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (sink);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_gio_base_sink_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstGioBaseSink *sink = GST_GIO_BASE_SINK (object);
+
+  switch (prop_id) {
+    case PROP_BUFFER_SIZE:
+      GST_OBJECT_LOCK (sink);
+      g_value_set_uint (value, sink->buffer_size);
+      GST_OBJECT_UNLOCK (sink);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
 static gboolean
 gst_gio_base_sink_start (GstBaseSink * base_sink)
 {
   GstGioBaseSink *sink = GST_GIO_BASE_SINK (base_sink);
   GstGioBaseSinkClass *gbsink_class = GST_GIO_BASE_SINK_GET_CLASS (sink);
+  guint buffer_size;
 
   sink->position = 0;
 
@@ -118,6 +184,24 @@ gst_gio_base_sink_start (GstBaseSink * base_sink)
     return FALSE;
   }
 
+  GST_OBJECT_LOCK (sink);
+  buffer_size = sink->buffer_size;
+  GST_OBJECT_UNLOCK (sink);
+
+  /* The buffered stream is flushed when seeking and on EOS like any other
+   * stream, but must only close the stream if we own it */
+  if (buffer_size > 0) {
+    GOutputStream *buffered;
+
+    GST_DEBUG_OBJECT (sink, "buffering writes in %u bytes", buffer_size);
+
+    buffered = g_buffered_output_stream_new_sized (sink->stream, buffer_size);
+    g_filter_output_stream_set_close_base_stream (G_FILTER_OUTPUT_STREAM
+        (buffered), gbsink_class->close_on_stop);
+    g_object_unref (sink->stream);
+    sink->stream = buffered;
+  }
+
   GST_DEBUG_OBJECT (sink, "started sink");
 
   return TRUE;
@@ -30,6 +30,11 @@
 GST_DEBUG_CATEGORY_STATIC (gst_gio_base_src_debug);
 #define GST_CAT_DEFAULT gst_gio_base_src_debug
 
+/* Reads start at MIN_READ_SIZE and double while the stream is read
+ * sequentially, up to MAX_READ_SIZE */
+#define MIN_READ_SIZE 4096
+#define MAX_READ_SIZE (1024 * 1024)
+
 static GstStaticPadTemplate src_factory = GST_STATIC_PAD_TEMPLATE ("src",
     GST_PAD_SRC,
     GST_PAD_ALWAYS,
@@ -115,6 +120,7 @@ gst_gio_base_src_start (GstBaseSrc * base_src)
   GstGioBaseSrcClass *gbsrc_class = GST_GIO_BASE_SRC_GET_CLASS (src);
 
   src->position = 0;
+  src->read_size = MIN_READ_SIZE;
 
   /* FIXME: This will likely block */
   src->stream = gbsrc_class->get_stream (src);
@@ -306,7 +312,9 @@ gst_gio_base_src_create (GstBaseSrc * base_src, guint64 offset, guint size,
    * requested offset and return a subbuffer of that.
    *
    * We need caching because every read/seek operation will need to go
-   * over DBus if our backend is GVfs and this is painfully slow. */
+   * over DBus if our backend is GVfs and this is painfully slow. For the
+   * same reason the cache grows while the stream is read sequentially, so
+   * that playback from network shares needs only few round trips. */
   if (src->cache && offset >= GST_BUFFER_OFFSET (src->cache) &&
       offset + size <= GST_BUFFER_OFFSET_END (src->cache)) {
     GST_DEBUG_OBJECT (src, "Creating subbuffer from cached buffer: offset %"
@@ -318,7 +326,7 @@ gst_gio_base_src_create (GstBaseSrc * base_src, guint64 offset, guint size,
     GST_BUFFER_OFFSET (buf) = offset;
     GST_BUFFER_OFFSET_END (buf) = offset + size;
   } else {
-    guint cachesize = MAX (4096, size);
+    guint cachesize;
     GstMapInfo map;
     gssize read, res;
     gboolean success, eos;
@@ -340,8 +348,14 @@ gst_gio_base_src_create (GstBaseSrc * base_src, guint64 offset, guint size,
         src->position = offset;
       else
         return ret;
+
+      src->read_size = MIN_READ_SIZE;
+    } else if (src->position > 0 && src->read_size < MAX_READ_SIZE) {
+      src->read_size *= 2;
     }
 
+    cachesize = MAX (src->read_size, size);
+
     src->cache = gst_buffer_new_and_alloc (cachesize);
     if (G_UNLIKELY (src->cache == NULL)) {
       GST_ERROR_OBJECT (src, "Failed to allocate %u bytes", cachesize);
@@ -55,6 +55,7 @@ struct _GstGioBaseSrc
   /* < private > */
   GInputStream *stream;
   GstBuffer *cache;
+  guint read_size;
 };
 
 struct _GstGioBaseSrcClass 
@@ -73,6 +73,10 @@
 #include "gstgiosrc.h"
 #include <string.h>
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+
 GST_DEBUG_CATEGORY_STATIC (gst_gio_src_debug);
 #define GST_CAT_DEFAULT gst_gio_src_debug
 
@@ -80,9 +84,12 @@ enum
 {
   PROP_0,
   PROP_LOCATION,
-  PROP_FILE
+  PROP_FILE,
+  PROP_USE_MMAP
 };
 
+#define DEFAULT_USE_MMAP FALSE
+
 #define gst_gio_src_parent_class parent_class
 G_DEFINE_TYPE_WITH_CODE (GstGioSrc, gst_gio_src,
     GST_TYPE_GIO_BASE_SRC, gst_gio_uri_handler_do_init (g_define_type_id));
@@ -96,6 +103,10 @@ static void gst_gio_src_get_property (GObject * object, guint prop_id,
 
 static GInputStream *gst_gio_src_get_stream (GstGioBaseSrc * bsrc);
 
+static gboolean gst_gio_src_start (GstBaseSrc * base_src);
+static gboolean gst_gio_src_stop (GstBaseSrc * base_src);
+static GstFlowReturn gst_gio_src_create (GstBaseSrc * base_src,
+    guint64 offset, guint size, GstBuffer ** buf);
 static gboolean gst_gio_src_query (GstBaseSrc * base_src, GstQuery * query);
 
 static void
@@ -127,12 +138,31 @@ gst_gio_src_class_init (GstGioSrcClass * klass)
       g_param_spec_object ("file", "File", "GFile to read from",
           G_TYPE_FILE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstGioSrc:use-mmap
+   *
+   * Map local files into memory and push buffers that point into the
+   * mapping instead of copying the data out of the file.
+   *
+   * Note that the element will crash if the file is truncated while it is
+   * being read with this enabled.
+   *
+   * Since: 1.2
+   **/
+  g_object_class_install_property (gobject_class, PROP_USE_MMAP,
+      g_param_spec_boolean ("use-mmap", "Use mmap",
+          "Map local files into memory instead of reading them",
+          DEFAULT_USE_MMAP, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (gstelement_class, "GIO source",
       "Source/File",
       "Read from any GIO-supported location",
       "Ren\xc3\xa9 Stadler <mail@renestadler.de>, "
       "Sebastian Dröge <sebastian.droege@collabora.co.uk>");
 
+  gstbasesrc_class->start = GST_DEBUG_FUNCPTR (gst_gio_src_start);
+  gstbasesrc_class->stop = GST_DEBUG_FUNCPTR (gst_gio_src_stop);
+  gstbasesrc_class->create = GST_DEBUG_FUNCPTR (gst_gio_src_create);
   gstbasesrc_class->query = GST_DEBUG_FUNCPTR (gst_gio_src_query);
 
   gstgiobasesrc_class->get_stream = GST_DEBUG_FUNCPTR (gst_gio_src_get_stream);
@@ -142,6 +172,7 @@ gst_gio_src_class_init (GstGioSrcClass * klass)
 static void
 gst_gio_src_init (GstGioSrc * src)
 {
+  src->use_mmap = DEFAULT_USE_MMAP;
 }
 
 static void
@@ -206,6 +237,11 @@ gst_gio_src_set_property (GObject * object, guint prop_id,
 
       src->file = g_value_dup_object (value);
 
+      GST_OBJECT_UNLOCK (GST_OBJECT (src));
+      break;
+    case PROP_USE_MMAP:
+      GST_OBJECT_LOCK (GST_OBJECT (src));
+      src->use_mmap = g_value_get_boolean (value);
       GST_OBJECT_UNLOCK (GST_OBJECT (src));
       break;
     default:
@@ -240,12 +276,131 @@ gst_gio_src_get_property (GObject * object, guint prop_id,
       g_value_set_object (value, src->file);
       GST_OBJECT_UNLOCK (GST_OBJECT (src));
       break;
+    case PROP_USE_MMAP:
+      GST_OBJECT_LOCK (GST_OBJECT (src));
+      g_value_set_boolean (value, src->use_mmap);
+      GST_OBJECT_UNLOCK (GST_OBJECT (src));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
   }
 }
 
+static gboolean
+gst_gio_src_start (GstBaseSrc * base_src)
+{
+  GstGioSrc *src = GST_GIO_SRC (base_src);
+  GError *err = NULL;
+  gchar *path;
+  gboolean use_mmap;
+
+  if (!GST_CALL_PARENT_WITH_DEFAULT (GST_BASE_SRC_CLASS, start, (base_src),
+          TRUE))
+    return FALSE;
+
+  GST_OBJECT_LOCK (src);
+  use_mmap = src->use_mmap;
+  GST_OBJECT_UNLOCK (src);
+
+  if (!use_mmap || !g_file_is_native (src->file))
+    return TRUE;
+
+  path = g_file_get_path (src->file);
+  if (path == NULL)
+    return TRUE;
+
+  src->mapped = g_mapped_file_new (path, FALSE, &err);
+  if (src->mapped == NULL) {
+    GST_DEBUG_OBJECT (src, "could not map %s, reading it instead: %s", path,
+        err->message);
+    g_clear_error (&err);
+  } else if (g_mapped_file_get_length (src->mapped) == 0) {
+    g_mapped_file_unref (src->mapped);
+    src->mapped = NULL;
+  } else {
+    GST_DEBUG_OBJECT (src, "mapped %" G_GSIZE_FORMAT " bytes of %s",
+        g_mapped_file_get_length (src->mapped), path);
+
+    src->mapped_next = 0;
+    src->mapped_sequential = TRUE;
+#if defined (HAVE_MMAP) && defined (MADV_SEQUENTIAL)
+    madvise (g_mapped_file_get_contents (src->mapped),
+        g_mapped_file_get_length (src->mapped), MADV_SEQUENTIAL);
+#endif
+  }
+  g_free (path);
+
+  return TRUE;
+}
+
+static gboolean
+gst_gio_src_stop (GstBaseSrc * base_src)
+{
+  GstGioSrc *src = GST_GIO_SRC (base_src);
+
+  if (src->mapped) {
+    g_mapped_file_unref (src->mapped);
+    src->mapped = NULL;
+  }
+
+  return GST_CALL_PARENT_WITH_DEFAULT (GST_BASE_SRC_CLASS, stop, (base_src),
+      TRUE);
+}
+
+static GstFlowReturn
+gst_gio_src_create (GstBaseSrc * base_src, guint64 offset, guint size,
+    GstBuffer ** buf_return)
+{
+  GstGioSrc *src = GST_GIO_SRC (base_src);
+  GstBuffer *buf;
+  gchar *data;
+  gsize length;
+
+  if (src->mapped == NULL)
+    goto read;
+
+  /* the file might have grown since it was mapped, anything after the
+   * mapping is read from the stream */
+  length = g_mapped_file_get_length (src->mapped);
+  if (offset >= length)
+    goto read;
+
+  size = MIN (size, length - offset);
+  data = g_mapped_file_get_contents (src->mapped);
+
+  /* once we are seeking around, let the kernel do its default read-ahead
+   * again instead of the aggressive sequential one */
+  if (src->mapped_sequential && offset != src->mapped_next) {
+    GST_DEBUG_OBJECT (src, "not reading sequentially anymore");
+    src->mapped_sequential = FALSE;
+#if defined (HAVE_MMAP) && defined (MADV_NORMAL)
+    madvise (data, length, MADV_NORMAL);
+#endif
+  }
+  src->mapped_next = offset + size;
+
+  GST_LOG_OBJECT (src, "Mapping %u bytes at offset %" G_GUINT64_FORMAT, size,
+      offset);
+
+  buf = gst_buffer_new ();
+  gst_buffer_append_memory (buf,
+      gst_memory_new_wrapped (GST_MEMORY_FLAG_READONLY, data, length, offset,
+          size, g_mapped_file_ref (src->mapped),
+          (GDestroyNotify) g_mapped_file_unref));
+
+  GST_BUFFER_OFFSET (buf) = offset;
+  GST_BUFFER_OFFSET_END (buf) = offset + size;
+
+  *buf_return = buf;
+
+  return GST_FLOW_OK;
+
+read:
+  return GST_CALL_PARENT_WITH_DEFAULT (GST_BASE_SRC_CLASS, create,
+      (base_src, offset, size, buf_return), GST_FLOW_ERROR);
+}
+
 static gboolean
 gst_gio_src_query (GstBaseSrc * base_src, GstQuery * query)
 {
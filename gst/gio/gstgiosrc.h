@@ -54,6 +54,11 @@ struct _GstGioSrc
   
   /*< private >*/
   GFile *file;
+
+  gboolean use_mmap;
+  GMappedFile *mapped;
+  guint64 mapped_next;
+  gboolean mapped_sequential;
 };
 
 struct _GstGioSrcClass 
@@ -121,6 +121,7 @@ GST_DEBUG_CATEGORY_STATIC (gst_decode_bin_debug);
 #define GST_CAT_DEFAULT gst_decode_bin_debug
 
 typedef struct _GstPendingPad GstPendingPad;
+typedef struct _GstConnectJob GstConnectJob;
 typedef struct _GstDecodeElement GstDecodeElement;
 typedef struct _GstDecodeChain GstDecodeChain;
 typedef struct _GstDecodeGroup GstDecodeGroup;
@@ -156,6 +157,7 @@ struct _GstDecodeBin
   guint64 max_size_time;
   gboolean post_stream_topology;
   guint64 connection_speed;
+  GstTaskPool *task_pool;       /* pool for the streaming threads; OBJECT_LOCK */
 
   GstElement *typefind;         /* this holds the typefind object */
 
@@ -163,10 +165,6 @@ struct _GstDecodeBin
   GstDecodeChain *decode_chain; /* Top level decode chain */
   guint nbpads;                 /* unique identifier for source pads */
 
-  GMutex factories_lock;
-  guint32 factories_cookie;     /* Cookie from last time when factories was updated */
-  GList *factories;             /* factories we can use for selecting elements */
-
   GMutex subtitle_lock;         /* Protects changes to subtitles and encoding */
   GList *subtitles;             /* List of elements with subtitle-encoding,
                                  * protected by above mutex! */
@@ -183,6 +181,11 @@ struct _GstDecodeBin
   gboolean expose_allstreams;   /* Whether to expose unknow type streams or not */
 
   GList *filtered;              /* elements for which error messages are filtered */
+
+  GList *reusable_decoders;     /* decoders in READY from freed chains,
+                                 * protected by the object lock */
+
+  GThreadPool *connect_pool;    /* autoplugs the chains of demuxer pads */
 };
 
 struct _GstDecodeBinClass
@@ -267,6 +270,7 @@ enum
   PROP_POST_STREAM_TOPOLOGY,
   PROP_EXPOSE_ALL_STREAMS,
   PROP_CONNECTION_SPEED,
+  PROP_TASK_POOL,
   PROP_LAST
 };
 
@@ -370,6 +374,29 @@ struct _GstPendingPad
   gulong notify_caps_id;
 };
 
+/* maximum number of idle decoders kept around for the next stream */
+#define MAX_REUSABLE_DECODERS 8
+
+/* Autoplugging of a demuxer pad that runs in the connect pool, so that
+ * the chains of all streams of a demuxer are created and prerolled in
+ * parallel instead of one after the other in the demuxer thread.
+ *
+ * The multiqueue srcpad stays blocked until the job is done, so no data
+ * reaches the unlinked pad, and the job holds a ref on its chain. */
+struct _GstConnectJob
+{
+  GstDecodeChain *chain;
+  GstDecodePad *dpad;
+  GstElement *src;
+  GstPad *pad;
+  gulong block_id;
+  GstCaps *caps;
+  GValueArray *factories;
+};
+
+/* maximum number of demuxer pads that are autoplugged at the same time */
+#define MAX_CONNECT_THREADS 4
+
 struct _GstDecodeElement
 {
   GstElement *element;
@@ -410,6 +437,9 @@ struct _GstDecodeChain
   GstDecodeGroup *parent;
   GstDecodeBin *dbin;
 
+  gint refs;                    /* Number of references on this chain,
+                                 * the owning group and pending connect
+                                 * jobs each hold one */
   GMutex lock;                  /* Protects this chain and its groups */
 
   GstPad *pad;                  /* srcpad that caused creation of this chain */
@@ -449,6 +479,8 @@ struct _GstDecodeChain
 };
 
 static void gst_decode_chain_free (GstDecodeChain * chain);
+static GstDecodeChain *gst_decode_chain_ref (GstDecodeChain * chain);
+static void gst_decode_chain_unref (GstDecodeChain * chain);
 static GstDecodeChain *gst_decode_chain_new (GstDecodeBin * dbin,
     GstDecodeGroup * group, GstPad * pad);
 static void gst_decode_group_hide (GstDecodeGroup * group);
@@ -964,6 +996,22 @@ gst_decode_bin_class_init (GstDecodeBinClass * klass)
           0, G_MAXUINT64 / 1000, DEFAULT_CONNECTION_SPEED,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstDecodeBin2::task-pool
+   *
+   * #GstTaskPool in which the streaming threads of the elements inside the
+   * bin are run, such as the multiqueues. %NULL uses the default pool,
+   * which creates a thread per task. The pool has to be prepared with
+   * gst_task_pool_prepare() by the application. Changing it only affects
+   * tasks that are created afterwards.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_klass, PROP_TASK_POOL,
+      g_param_spec_object ("task-pool", "Task Pool",
+          "Pool for the streaming threads of the inner elements "
+          "(NULL = default)", GST_TYPE_TASK_POOL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
 
   klass->autoplug_continue =
@@ -1021,31 +1069,81 @@ _decode_bin_compare_factories_func (gconstpointer p1, gconstpointer p2)
   return gst_plugin_feature_rank_compare_func (p1, p2);
 }
 
+/* The sorted factory list and the result of filtering it for a given caps
+ * only depend on the registry, so they are shared between all decodebin
+ * instances and thrown away when the registry feature list changes. */
+#define MAX_FACTORIES_CACHE_ENTRIES 256
+
+static GMutex factories_lock;
+static guint32 factories_cookie;        /* Cookie from last time when factories was updated */
+static GList *factories;        /* factories we can use for selecting elements */
+static GHashTable *factories_cache;     /* caps string -> filtered factories */
+
+static void
+free_factories_cache_entry (gpointer data)
+{
+  gst_plugin_feature_list_free ((GList *) data);
+}
+
 /* Must be called with factories lock! */
 static void
-gst_decode_bin_update_factories_list (GstDecodeBin * dbin)
+gst_decode_bin_update_factories_list (void)
 {
   guint cookie;
 
   cookie = gst_registry_get_feature_list_cookie (gst_registry_get ());
-  if (!dbin->factories || dbin->factories_cookie != cookie) {
-    if (dbin->factories)
-      gst_plugin_feature_list_free (dbin->factories);
-    dbin->factories =
+  if (!factories || factories_cookie != cookie) {
+    if (factories)
+      gst_plugin_feature_list_free (factories);
+    factories =
         gst_element_factory_list_get_elements
         (GST_ELEMENT_FACTORY_TYPE_DECODABLE, GST_RANK_MARGINAL);
-    dbin->factories =
-        g_list_sort (dbin->factories, _decode_bin_compare_factories_func);
-    dbin->factories_cookie = cookie;
+    factories = g_list_sort (factories, _decode_bin_compare_factories_func);
+    factories_cookie = cookie;
+
+    if (factories_cache)
+      g_hash_table_remove_all (factories_cache);
+    else
+      factories_cache = g_hash_table_new_full (g_str_hash, g_str_equal,
+          g_free, free_factories_cache_entry);
+  }
+}
+
+/* returns a new list of all factories compatible with @caps, sorted by
+ * parsers first and then rank */
+static GList *
+gst_decode_bin_get_factories (GstCaps * caps)
+{
+  GList *list;
+  gchar *key;
+
+  key = gst_caps_to_string (caps);
+
+  g_mutex_lock (&factories_lock);
+  gst_decode_bin_update_factories_list ();
+
+  list = g_hash_table_lookup (factories_cache, key);
+  if (list == NULL && !g_hash_table_contains (factories_cache, key)) {
+    list = gst_element_factory_list_filter (factories, caps, GST_PAD_SINK,
+        gst_caps_is_fixed (caps));
+    /* keep the cache bounded when caps keep changing */
+    if (g_hash_table_size (factories_cache) >= MAX_FACTORIES_CACHE_ENTRIES)
+      g_hash_table_remove_all (factories_cache);
+    g_hash_table_insert (factories_cache, key, list);
+    key = NULL;
   }
+  list = g_list_copy (list);
+  g_list_foreach (list, (GFunc) gst_object_ref, NULL);
+  g_mutex_unlock (&factories_lock);
+
+  g_free (key);
+
+  return list;
 }
 
 static void
 gst_decode_bin_init (GstDecodeBin * decode_bin)
 {
-  /* first filter out the interesting element factories */
-  g_mutex_init (&decode_bin->factories_lock);
-
   /* we create the typefind element only once */
   decode_bin->typefind = gst_element_factory_make ("typefind", "typefind");
   if (!decode_bin->typefind) {
@@ -1107,14 +1205,16 @@ gst_decode_bin_dispose (GObject * object)
 
   decode_bin = GST_DECODE_BIN (object);
 
-  if (decode_bin->factories)
-    gst_plugin_feature_list_free (decode_bin->factories);
-  decode_bin->factories = NULL;
+  if (decode_bin->connect_pool)
+    g_thread_pool_free (decode_bin->connect_pool, FALSE, TRUE);
+  decode_bin->connect_pool = NULL;
 
   if (decode_bin->decode_chain)
     gst_decode_chain_free (decode_bin->decode_chain);
   decode_bin->decode_chain = NULL;
 
+  clear_reusable_decoders (decode_bin);
+
   if (decode_bin->caps)
     gst_caps_unref (decode_bin->caps);
   decode_bin->caps = NULL;
@@ -1125,6 +1225,10 @@ gst_decode_bin_dispose (GObject * object)
   g_list_free (decode_bin->subtitles);
   decode_bin->subtitles = NULL;
 
+  if (decode_bin->task_pool)
+    gst_object_unref (decode_bin->task_pool);
+  decode_bin->task_pool = NULL;
+
   G_OBJECT_CLASS (parent_class)->dispose (object);
 }
 
@@ -1138,7 +1242,6 @@ gst_decode_bin_finalize (GObject * object)
   g_mutex_clear (&decode_bin->expose_lock);
   g_mutex_clear (&decode_bin->dyn_lock);
   g_mutex_clear (&decode_bin->subtitle_lock);
-  g_mutex_clear (&decode_bin->factories_lock);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -1283,6 +1386,13 @@ gst_decode_bin_set_property (GObject * object, guint prop_id,
       dbin->connection_speed = g_value_get_uint64 (value) * 1000;
       GST_OBJECT_UNLOCK (dbin);
       break;
+    case PROP_TASK_POOL:
+      GST_OBJECT_LOCK (dbin);
+      if (dbin->task_pool)
+        gst_object_unref (dbin->task_pool);
+      dbin->task_pool = g_value_dup_object (value);
+      GST_OBJECT_UNLOCK (dbin);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1335,6 +1445,11 @@ gst_decode_bin_get_property (GObject * object, guint prop_id,
       g_value_set_uint64 (value, dbin->connection_speed / 1000);
       GST_OBJECT_UNLOCK (dbin);
       break;
+    case PROP_TASK_POOL:
+      GST_OBJECT_LOCK (dbin);
+      g_value_set_object (value, dbin->task_pool);
+      GST_OBJECT_UNLOCK (dbin);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1361,17 +1476,11 @@ gst_decode_bin_autoplug_factories (GstElement * element, GstPad * pad,
 {
   GList *list, *tmp;
   GValueArray *result;
-  GstDecodeBin *dbin = GST_DECODE_BIN_CAST (element);
 
   GST_DEBUG_OBJECT (element, "finding factories");
 
   /* return all compatible factories for caps */
-  g_mutex_lock (&dbin->factories_lock);
-  gst_decode_bin_update_factories_list (dbin);
-  list =
-      gst_element_factory_list_filter (dbin->factories, caps, GST_PAD_SINK,
-      gst_caps_is_fixed (caps));
-  g_mutex_unlock (&dbin->factories_lock);
+  list = gst_decode_bin_get_factories (caps);
 
   result = g_value_array_new (g_list_length (list));
   for (tmp = list; tmp; tmp = tmp->next) {
@@ -1425,6 +1534,12 @@ static gboolean is_demuxer_element (GstElement * srcelement);
 static gboolean connect_pad (GstDecodeBin * dbin, GstElement * src,
     GstDecodePad * dpad, GstPad * pad, GstCaps * caps, GValueArray * factories,
     GstDecodeChain * chain);
+static gboolean connect_pad_elements (GstDecodeBin * dbin, GstElement * src,
+    GstDecodePad * dpad, GstPad * pad, GstCaps * caps, GValueArray * factories,
+    GstDecodeChain * chain);
+static GstPadProbeReturn connect_job_block_cb (GstPad * pad,
+    GstPadProbeInfo * info, gpointer user_data);
+static void connect_job_func (GstConnectJob * job, GstDecodeBin * dbin);
 static gboolean connect_element (GstDecodeBin * dbin, GstDecodeElement * delem,
     GstDecodeChain * chain);
 static void expose_pad (GstDecodeBin * dbin, GstElement * src,
@@ -1842,6 +1957,83 @@ remove_error_filter (GstDecodeBin * dbin, GstElement * element)
   GST_OBJECT_UNLOCK (dbin);
 }
 
+/* returns a decoder created from @factory by an earlier chain, or NULL */
+static GstElement *
+take_reusable_decoder (GstDecodeBin * dbin, GstElementFactory * factory)
+{
+  GstElement *element = NULL;
+  GList *l;
+
+  GST_OBJECT_LOCK (dbin);
+  for (l = dbin->reusable_decoders; l; l = l->next) {
+    if (gst_element_get_factory (l->data) == factory) {
+      element = l->data;
+      dbin->reusable_decoders =
+          g_list_delete_link (dbin->reusable_decoders, l);
+      break;
+    }
+  }
+  GST_OBJECT_UNLOCK (dbin);
+
+  if (element)
+    GST_DEBUG_OBJECT (dbin, "reusing decoder %s", GST_ELEMENT_NAME (element));
+
+  return element;
+}
+
+/* Keeps a decoder that was removed from the bin so that a later chain with
+ * the same caps doesn't need to create and open a new one. Takes ownership
+ * of @element when TRUE is returned. */
+static gboolean
+keep_reusable_decoder (GstDecodeBin * dbin, GstElement * element)
+{
+  GstElementFactory *factory;
+
+  factory = gst_element_get_factory (element);
+  if (!factory || !strstr (gst_element_factory_get_metadata (factory,
+              GST_ELEMENT_METADATA_KLASS), "Decoder"))
+    return FALSE;
+
+  GST_OBJECT_LOCK (dbin);
+  if (g_list_length (dbin->reusable_decoders) >= MAX_REUSABLE_DECODERS) {
+    GST_OBJECT_UNLOCK (dbin);
+    return FALSE;
+  }
+  GST_OBJECT_UNLOCK (dbin);
+
+  /* READY resets the stream state but keeps the element opened */
+  if (gst_element_set_state (element,
+          GST_STATE_READY) == GST_STATE_CHANGE_FAILURE)
+    return FALSE;
+  /* make it freshly floating again */
+  g_object_force_floating (G_OBJECT (element));
+
+  GST_DEBUG_OBJECT (dbin, "keeping decoder %s", GST_ELEMENT_NAME (element));
+
+  GST_OBJECT_LOCK (dbin);
+  dbin->reusable_decoders = g_list_prepend (dbin->reusable_decoders, element);
+  GST_OBJECT_UNLOCK (dbin);
+
+  return TRUE;
+}
+
+static void
+clear_reusable_decoders (GstDecodeBin * dbin)
+{
+  GList *decoders, *l;
+
+  GST_OBJECT_LOCK (dbin);
+  decoders = dbin->reusable_decoders;
+  dbin->reusable_decoders = NULL;
+  GST_OBJECT_UNLOCK (dbin);
+
+  for (l = decoders; l; l = l->next) {
+    gst_element_set_state (l->data, GST_STATE_NULL);
+    gst_object_unref (l->data);
+  }
+  g_list_free (decoders);
+}
+
 /* connect_pad:
  *
  * Try to connect the given pad to an element created from one of the factories,
@@ -1880,8 +2072,110 @@ connect_pad (GstDecodeBin * dbin, GstElement * src, GstDecodePad * dpad,
     src = chain->parent->multiqueue;
     pad = mqpad;
     gst_ghost_pad_set_target (GST_GHOST_PAD_CAST (dpad), pad);
+
+    /* the multiqueue keeps the data of this stream while the rest of the
+     * chain is autoplugged in the connect pool. Its srcpad is blocked
+     * until then, so the first buffers don't come back NOT_LINKED */
+    if (dbin->connect_pool) {
+      GstConnectJob *job;
+
+      job = g_slice_new (GstConnectJob);
+      job->chain = gst_decode_chain_ref (chain);
+      job->dpad = gst_object_ref (dpad);
+      job->src = gst_object_ref (src);
+      job->pad = gst_object_ref (pad);
+      job->block_id = gst_pad_add_probe (pad,
+          GST_PAD_PROBE_TYPE_BLOCK_DOWNSTREAM, connect_job_block_cb, NULL,
+          NULL);
+      job->caps = gst_caps_ref (caps);
+      job->factories = g_value_array_copy (factories);
+
+      GST_LOG_OBJECT (dbin, "autoplugging chain %p in the connect pool", chain);
+      g_thread_pool_push (dbin->connect_pool, job, NULL);
+      res = TRUE;
+      goto beach;
+    }
+  }
+
+  res = connect_pad_elements (dbin, src, dpad, pad, caps, factories, chain);
+
+beach:
+  if (mqpad)
+    gst_object_unref (mqpad);
+
+  return res;
+}
+
+static GstPadProbeReturn
+connect_job_block_cb (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
+{
+  GST_LOG_OBJECT (pad, "holding data until the chain is autoplugged");
+
+  return GST_PAD_PROBE_OK;
+}
+
+static void
+connect_job_func (GstConnectJob * job, GstDecodeBin * dbin)
+{
+  GstDecodeChain *chain = job->chain;
+  gboolean shutdown;
+
+  DYN_LOCK (dbin);
+  shutdown = dbin->shutdown;
+  DYN_UNLOCK (dbin);
+
+  if (shutdown) {
+    GST_DEBUG_OBJECT (dbin, "shutting down, not autoplugging chain %p", chain);
+    goto done;
+  }
+
+  if (!connect_pad_elements (dbin, job->src, job->dpad, job->pad, job->caps,
+          job->factories, chain)) {
+    GST_LOG_OBJECT (job->pad, "Unknown type, posting message and firing "
+        "signal");
+
+    chain->deadend = TRUE;
+    chain->endcaps = gst_caps_ref (job->caps);
+    gst_object_replace ((GstObject **) & chain->current_pad, NULL);
+
+    gst_element_post_message (GST_ELEMENT_CAST (dbin),
+        gst_missing_decoder_message_new (GST_ELEMENT_CAST (dbin), job->caps));
+
+    g_signal_emit (G_OBJECT (dbin),
+        gst_decode_bin_signals[SIGNAL_UNKNOWN_TYPE], 0, job->pad, job->caps);
+
+    /* Try to expose anything */
+    EXPOSE_LOCK (dbin);
+    if (gst_decode_chain_is_complete (dbin->decode_chain)) {
+      gst_decode_bin_expose (dbin);
+    }
+    EXPOSE_UNLOCK (dbin);
   }
 
+done:
+  /* the decoder is linked now, or the chain is a dead end */
+  gst_pad_remove_probe (job->pad, job->block_id);
+  gst_decode_chain_unref (chain);
+  gst_object_unref (job->dpad);
+  gst_object_unref (job->src);
+  gst_object_unref (job->pad);
+  gst_caps_unref (job->caps);
+  g_value_array_free (job->factories);
+  g_slice_free (GstConnectJob, job);
+}
+
+/* connect_pad_elements:
+ *
+ * Try to create an element from one of the factories, link it to pad and
+ * continue autoplugging its pads.
+ */
+static gboolean
+connect_pad_elements (GstDecodeBin * dbin, GstElement * src,
+    GstDecodePad * dpad, GstPad * pad, GstCaps * caps, GValueArray * factories,
+    GstDecodeChain * chain)
+{
+  gboolean res = FALSE;
+
   /* 2. Try to create an element and link to it */
   while (factories->n_values > 0) {
     GstAutoplugSelectResult ret;
@@ -2006,8 +2300,9 @@ connect_pad (GstDecodeBin * dbin, GstElement * src, GstDecodePad * dpad,
     /* 2.0. Unlink pad */
     gst_ghost_pad_set_target (GST_GHOST_PAD_CAST (dpad), NULL);
 
-    /* 2.1. Try to create an element */
-    if ((element = gst_element_factory_create (factory, NULL)) == NULL) {
+    /* 2.1. Try to reuse or create an element */
+    if (!(element = take_reusable_decoder (dbin, factory)) &&
+        !(element = gst_element_factory_create (factory, NULL))) {
       GST_WARNING_OBJECT (dbin, "Could not create an element from %s",
           gst_plugin_feature_get_name (GST_PLUGIN_FEATURE (factory)));
       continue;
@@ -2224,9 +2519,6 @@ connect_pad (GstDecodeBin * dbin, GstElement * src, GstDecodePad * dpad,
   }
 
 beach:
-  if (mqpad)
-    gst_object_unref (mqpad);
-
   return res;
 }
 
@@ -2876,8 +3168,10 @@ gst_decode_chain_free_internal (GstDecodeChain * chain, gboolean hide)
 
     if (GST_OBJECT_PARENT (element) == GST_OBJECT_CAST (chain->dbin))
       gst_bin_remove (GST_BIN_CAST (chain->dbin), element);
-    if (!hide) {
+    /* the reusable decoders own the reference of a kept element */
+    if (!hide && !keep_reusable_decoder (chain->dbin, element)) {
       gst_element_set_state (element, GST_STATE_NULL);
+      gst_object_unref (element);
     }
 
     SUBTITLE_LOCK (chain->dbin);
@@ -2891,7 +3185,6 @@ gst_decode_chain_free_internal (GstDecodeChain * chain, gboolean hide)
         delem->capsfilter = NULL;
       }
 
-      gst_object_unref (element);
       l->data = NULL;
 
       g_slice_free (GstDecodeElement, delem);
@@ -2934,7 +3227,21 @@ gst_decode_chain_free_internal (GstDecodeChain * chain, gboolean hide)
   GST_DEBUG_OBJECT (chain->dbin, "%s chain %p", (hide ? "Hidden" : "Freed"),
       chain);
   CHAIN_MUTEX_UNLOCK (chain);
-  if (!hide) {
+  if (!hide)
+    gst_decode_chain_unref (chain);
+}
+
+static GstDecodeChain *
+gst_decode_chain_ref (GstDecodeChain * chain)
+{
+  g_atomic_int_inc (&chain->refs);
+  return chain;
+}
+
+static void
+gst_decode_chain_unref (GstDecodeChain * chain)
+{
+  if (g_atomic_int_dec_and_test (&chain->refs)) {
     g_mutex_clear (&chain->lock);
     g_slice_free (GstDecodeChain, chain);
   }
@@ -2972,6 +3279,7 @@ gst_decode_chain_new (GstDecodeBin * dbin, GstDecodeGroup * parent,
 
   chain->dbin = dbin;
   chain->parent = parent;
+  chain->refs = 1;
   g_mutex_init (&chain->lock);
   chain->pad = gst_object_ref (pad);
 
@@ -4444,6 +4752,9 @@ gst_decode_bin_change_state (GstElement * element, GstStateChange transition)
       dbin->shutdown = FALSE;
       DYN_UNLOCK (dbin);
       dbin->have_type = FALSE;
+      if (!dbin->connect_pool)
+        dbin->connect_pool = g_thread_pool_new ((GFunc) connect_job_func,
+            dbin, MAX_CONNECT_THREADS, FALSE, NULL);
       ret = GST_STATE_CHANGE_ASYNC;
       do_async_start (dbin);
 
@@ -4481,6 +4792,11 @@ gst_decode_bin_change_state (GstElement * element, GstStateChange transition)
   switch (transition) {
     case GST_STATE_CHANGE_PAUSED_TO_READY:
       do_async_done (dbin);
+      /* wait until no job uses the chains anymore */
+      if (dbin->connect_pool) {
+        g_thread_pool_free (dbin->connect_pool, FALSE, TRUE);
+        dbin->connect_pool = NULL;
+      }
       EXPOSE_LOCK (dbin);
       if (dbin->decode_chain) {
         gst_decode_chain_free (dbin->decode_chain);
@@ -4489,6 +4805,8 @@ gst_decode_bin_change_state (GstElement * element, GstStateChange transition)
       EXPOSE_UNLOCK (dbin);
       break;
     case GST_STATE_CHANGE_READY_TO_NULL:
+      clear_reusable_decoders (dbin);
+      break;
     default:
       break;
   }
@@ -4521,6 +4839,17 @@ gst_decode_bin_handle_message (GstBin * bin, GstMessage * msg)
     GST_OBJECT_LOCK (dbin);
     drop = (g_list_find (dbin->filtered, GST_MESSAGE_SRC (msg)) != NULL);
     GST_OBJECT_UNLOCK (dbin);
+  } else if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_STREAM_STATUS) {
+    GstTaskPool *pool;
+
+    GST_OBJECT_LOCK (dbin);
+    pool = dbin->task_pool ? gst_object_ref (dbin->task_pool) : NULL;
+    GST_OBJECT_UNLOCK (dbin);
+
+    if (pool) {
+      gst_play_set_task_pool (msg, pool);
+      gst_object_unref (pool);
+    }
   }
 
   if (drop)
@@ -32,6 +32,30 @@
 #include "gstsubtitleoverlay.h"
 #include "gststreamsynchronizer.h"
 
+/* Makes the task announced by a stream-status CREATE message use @pool for
+ * its thread. Bins handle the messages of their children synchronously, in
+ * the thread that creates the task and before the task is started, so this
+ * can be called from the handle_message vmethod. */
+void
+gst_play_set_task_pool (GstMessage * msg, GstTaskPool * pool)
+{
+  GstStreamStatusType type;
+  const GValue *val;
+
+  if (pool == NULL || GST_MESSAGE_TYPE (msg) != GST_MESSAGE_STREAM_STATUS)
+    return;
+
+  gst_message_parse_stream_status (msg, &type, NULL);
+  if (type != GST_STREAM_STATUS_TYPE_CREATE)
+    return;
+
+  val = gst_message_get_stream_status_object (msg);
+  if (val == NULL || G_VALUE_TYPE (val) != GST_TYPE_TASK)
+    return;
+
+  gst_task_set_pool (g_value_get_object (val), pool);
+}
+
 static gboolean
 plugin_init (GstPlugin * plugin)
 {
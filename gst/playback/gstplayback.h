@@ -29,5 +29,7 @@ gboolean gst_uri_decode_bin_plugin_init (GstPlugin * plugin);
 gboolean gst_play_bin_plugin_init (GstPlugin * plugin);
 gboolean gst_play_bin2_plugin_init (GstPlugin * plugin);
 
+void gst_play_set_task_pool (GstMessage * msg, GstTaskPool * pool);
+
 
 #endif /* __GST_PLAY_BACK_H__ */
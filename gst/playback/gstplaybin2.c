@@ -315,6 +315,14 @@ struct _GstSourceGroup
   gboolean valid;               /* the group has valid info to start playback */
   gboolean active;              /* the group is active */
 
+  /* preroll-ahead */
+  gint about_to_finish;         /* about-to-finish was emitted, atomic */
+  gboolean preroll;             /* activated ahead, not linked to the sinks */
+  gboolean uri_no_more_pads;    /* no-more-pads deferred while prerolling */
+  gboolean sub_no_more_pads;
+  guint64 preroll_ahead;        /* playbin property when activated */
+  gint64 preroll_duration;      /* cached duration, -1 when unknown */
+
   /* properties */
   gchar *uri;
   gchar *suburi;
@@ -461,6 +469,10 @@ struct _GstPlayBin
   } duration[5];                /* cached durations */
 
   guint64 ring_buffer_max_size; /* 0 means disabled */
+
+  GstTaskPool *task_pool;       /* pool for the streaming threads; OBJECT_LOCK */
+
+  guint64 preroll_ahead;        /* 0 means disabled; PLAY_BIN_LOCK */
 };
 
 struct _GstPlayBinClass
@@ -521,6 +533,7 @@ struct _GstPlayBinClass
 #define DEFAULT_BUFFER_DURATION   -1
 #define DEFAULT_BUFFER_SIZE       -1
 #define DEFAULT_RING_BUFFER_MAX_SIZE 0
+#define DEFAULT_PREROLL_AHEAD     0
 
 enum
 {
@@ -555,6 +568,8 @@ enum
   PROP_AV_OFFSET,
   PROP_RING_BUFFER_MAX_SIZE,
   PROP_FORCE_ASPECT_RATIO,
+  PROP_TASK_POOL,
+  PROP_PREROLL_AHEAD,
   PROP_LAST
 };
 
@@ -611,6 +626,9 @@ static GstPad *gst_play_bin_get_audio_pad (GstPlayBin * playbin, gint stream);
 static GstPad *gst_play_bin_get_text_pad (GstPlayBin * playbin, gint stream);
 
 static gboolean setup_next_source (GstPlayBin * playbin, GstState target);
+static void preroll_next_source (GstPlayBin * playbin);
+static void discard_prerolled_group (GstPlayBin * playbin,
+    GstSourceGroup * group);
 
 static void no_more_pads_cb (GstElement * decodebin, GstSourceGroup * group);
 static void pad_removed_cb (GstElement * decodebin, GstPad * pad,
@@ -964,12 +982,53 @@ gst_play_bin_class_init (GstPlayBinClass * klass)
           "When enabled, scaling will respect original aspect ratio", TRUE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstPlayBin::task-pool:
+   *
+   * #GstTaskPool in which the streaming threads of all elements inside
+   * playbin are run, such as the sources, the queues of the decodebins and
+   * the sinks. Several playbins can share one pool to bound the number of
+   * threads. %NULL uses the default pool, which creates a thread per task.
+   * The pool has to be prepared with gst_task_pool_prepare() by the
+   * application. Changing it only affects tasks that are created afterwards.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_klass, PROP_TASK_POOL,
+      g_param_spec_object ("task-pool", "Task Pool",
+          "Pool for the streaming threads of the inner elements "
+          "(NULL = default)", GST_TYPE_TASK_POOL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstPlayBin::preroll-ahead:
+   *
+   * Time in nanoseconds before the end of the current uri at which the
+   * #GstPlayBin::about-to-finish signal is emitted. The uri set from the
+   * signal handler is then opened, typefound and its decoders are set up
+   * while the current uri is still playing, and it is linked to the sinks
+   * as soon as the current uri is drained. This hides the time needed to
+   * open network sources in gapless playback.
+   *
+   * When 0, the signal is emitted when the current uri is drained and the
+   * next uri is only opened at that point. Preroll-ahead is not done when
+   * custom stream combiners are configured.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_klass, PROP_PREROLL_AHEAD,
+      g_param_spec_uint64 ("preroll-ahead", "Preroll Ahead",
+          "Time before the end of the stream at which the next uri is "
+          "prerolled (ns, 0 = when drained)", 0, G_MAXINT64,
+          DEFAULT_PREROLL_AHEAD, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstPlayBin::about-to-finish
    * @playbin: a #GstPlayBin
    *
    * This signal is emitted when the current uri is about to finish. You can
    * set the uri and suburi to make sure that playback continues.
+   * See #GstPlayBin:preroll-ahead for emitting it earlier.
    *
    * This signal is emitted from the context of a GStreamer streaming thread.
    */
@@ -1480,6 +1539,7 @@ gst_play_bin_init (GstPlayBin * playbin)
   playbin->buffer_duration = DEFAULT_BUFFER_DURATION;
   playbin->buffer_size = DEFAULT_BUFFER_SIZE;
   playbin->ring_buffer_max_size = DEFAULT_RING_BUFFER_MAX_SIZE;
+  playbin->preroll_ahead = DEFAULT_PREROLL_AHEAD;
 
   playbin->force_aspect_ratio = TRUE;
 }
@@ -1522,6 +1582,9 @@ gst_play_bin_finalize (GObject * object)
     gst_object_unref (playbin->text_stream_combiner);
   }
 
+  if (playbin->task_pool)
+    gst_object_unref (playbin->task_pool);
+
   if (playbin->elements)
     gst_plugin_feature_list_free (playbin->elements);
 
@@ -1590,6 +1653,10 @@ gst_play_bin_set_uri (GstPlayBin * playbin, const gchar * uri)
   GST_PLAY_BIN_LOCK (playbin);
   group = playbin->next_group;
 
+  /* the next group might already be prerolled with the previous uri */
+  if (group->active)
+    discard_prerolled_group (playbin, group);
+
   GST_SOURCE_GROUP_LOCK (group);
   /* store the uri in the next group we will play */
   g_free (group->uri);
@@ -1609,6 +1676,9 @@ gst_play_bin_set_suburi (GstPlayBin * playbin, const gchar * suburi)
   GST_PLAY_BIN_LOCK (playbin);
   group = playbin->next_group;
 
+  if (group->active)
+    discard_prerolled_group (playbin, group);
+
   GST_SOURCE_GROUP_LOCK (group);
   g_free (group->suburi);
   group->suburi = g_strdup (suburi);
@@ -2318,6 +2388,18 @@ gst_play_bin_set_property (GObject * object, guint prop_id,
       g_object_set (playbin->playsink, "force-aspect-ratio",
           g_value_get_boolean (value), NULL);
       break;
+    case PROP_TASK_POOL:
+      GST_OBJECT_LOCK (playbin);
+      if (playbin->task_pool)
+        gst_object_unref (playbin->task_pool);
+      playbin->task_pool = g_value_dup_object (value);
+      GST_OBJECT_UNLOCK (playbin);
+      break;
+    case PROP_PREROLL_AHEAD:
+      GST_PLAY_BIN_LOCK (playbin);
+      playbin->preroll_ahead = g_value_get_uint64 (value);
+      GST_PLAY_BIN_UNLOCK (playbin);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2552,6 +2634,16 @@ gst_play_bin_get_property (GObject * object, guint prop_id, GValue * value,
       g_value_set_boolean (value, v);
       break;
     }
+    case PROP_TASK_POOL:
+      GST_OBJECT_LOCK (playbin);
+      g_value_set_object (value, playbin->task_pool);
+      GST_OBJECT_UNLOCK (playbin);
+      break;
+    case PROP_PREROLL_AHEAD:
+      GST_PLAY_BIN_LOCK (playbin);
+      g_value_set_uint64 (value, playbin->preroll_ahead);
+      GST_PLAY_BIN_UNLOCK (playbin);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -2676,7 +2768,18 @@ gst_play_bin_handle_message (GstBin * bin, GstMessage * msg)
   GstPlayBin *playbin = GST_PLAY_BIN (bin);
   GstSourceGroup *group;
 
-  if (gst_is_missing_plugin_message (msg)) {
+  if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_STREAM_STATUS) {
+    GstTaskPool *pool;
+
+    GST_OBJECT_LOCK (playbin);
+    pool = playbin->task_pool ? gst_object_ref (playbin->task_pool) : NULL;
+    GST_OBJECT_UNLOCK (playbin);
+
+    if (pool) {
+      gst_play_set_task_pool (msg, pool);
+      gst_object_unref (pool);
+    }
+  } else if (gst_is_missing_plugin_message (msg)) {
     gchar *detail;
     guint i;
 
@@ -2885,6 +2988,77 @@ _suburidecodebin_event_probe (GstPad * pad, GstPadProbeInfo * info,
   return ret;
 }
 
+/* emits about-to-finish and prerolls the next uri when the buffers of the
+ * current uri get within preroll-ahead of the end of the stream */
+static GstPadProbeReturn
+_uridecodebin_buffer_probe (GstPad * pad, GstPadProbeInfo * info,
+    gpointer udata)
+{
+  GstSourceGroup *group = udata;
+  GstPlayBin *playbin = group->playbin;
+  GstBuffer *buffer = GST_PAD_PROBE_INFO_BUFFER (info);
+  const GstSegment *segment;
+  GstEvent *event;
+  GstClockTime ts;
+  gint64 position = -1, duration;
+
+  if (g_atomic_int_get (&group->about_to_finish))
+    return GST_PAD_PROBE_REMOVE;
+
+  ts = GST_BUFFER_TIMESTAMP (buffer);
+  if (!GST_CLOCK_TIME_IS_VALID (ts))
+    return GST_PAD_PROBE_OK;
+  if (GST_BUFFER_DURATION_IS_VALID (buffer))
+    ts += GST_BUFFER_DURATION (buffer);
+
+  event = gst_pad_get_sticky_event (pad, GST_EVENT_SEGMENT, 0);
+  if (event == NULL)
+    return GST_PAD_PROBE_OK;
+  gst_event_parse_segment (event, &segment);
+  if (segment->format == GST_FORMAT_TIME && segment->rate > 0.0)
+    position = gst_segment_to_stream_time (segment, GST_FORMAT_TIME, ts);
+  gst_event_unref (event);
+
+  if (position == -1)
+    return GST_PAD_PROBE_OK;
+
+  GST_SOURCE_GROUP_LOCK (group);
+  duration = group->preroll_duration;
+  GST_SOURCE_GROUP_UNLOCK (group);
+
+  if (duration != -1 && position + (gint64) group->preroll_ahead < duration)
+    return GST_PAD_PROBE_OK;
+
+  /* close to the end, query again because the duration can grow while
+   * playing. Streams without a duration are only switched when drained. */
+  if (!gst_pad_query_duration (pad, GST_FORMAT_TIME, &duration)
+      || duration == -1) {
+    GST_DEBUG_OBJECT (playbin, "unknown duration, not prerolling ahead");
+    return GST_PAD_PROBE_REMOVE;
+  }
+
+  GST_SOURCE_GROUP_LOCK (group);
+  group->preroll_duration = duration;
+  GST_SOURCE_GROUP_UNLOCK (group);
+
+  if (position + (gint64) group->preroll_ahead < duration)
+    return GST_PAD_PROBE_OK;
+
+  if (!g_atomic_int_compare_and_exchange (&group->about_to_finish, 0, 1))
+    return GST_PAD_PROBE_REMOVE;
+
+  GST_DEBUG_OBJECT (playbin, "about to finish in group %p at %"
+      GST_TIME_FORMAT " of %" GST_TIME_FORMAT, group,
+      GST_TIME_ARGS (position), GST_TIME_ARGS (duration));
+
+  g_signal_emit (G_OBJECT (playbin),
+      gst_play_bin_signals[SIGNAL_ABOUT_TO_FINISH], 0, NULL);
+
+  preroll_next_source (playbin);
+
+  return GST_PAD_PROBE_REMOVE;
+}
+
 /* helper function to lookup stuff in lists */
 static gboolean
 array_has_value (const gchar * values[], const gchar * value, gboolean exact)
@@ -3134,6 +3308,9 @@ pad_added_cb (GstElement * decodebin, GstPad * pad, GstSourceGroup * group)
     /* to avoid propagating flushes from suburi specific seeks */
     gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM,
         _suburidecodebin_event_probe, group, NULL);
+  } else if (group->preroll_ahead > 0) {
+    gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_BUFFER,
+        _uridecodebin_buffer_probe, group, NULL);
   }
 
   if (changed) {
@@ -3332,6 +3509,18 @@ no_more_pads_cb (GstElement * decodebin, GstSourceGroup * group)
   GST_PLAY_BIN_SHUTDOWN_LOCK (playbin, shutdown);
 
   GST_SOURCE_GROUP_LOCK (group);
+  if (group->preroll) {
+    /* the current group is still linked to the sinks, we link this one when
+     * the current group is drained */
+    GST_DEBUG_OBJECT (playbin, "group %p is prerolling, deferring", group);
+    if (decodebin == group->suburidecodebin)
+      group->sub_no_more_pads = TRUE;
+    else
+      group->uri_no_more_pads = TRUE;
+    GST_SOURCE_GROUP_UNLOCK (group);
+    GST_PLAY_BIN_SHUTDOWN_UNLOCK (playbin);
+    return;
+  }
   for (i = 0; i < PLAYBIN_STREAM_LAST; i++) {
     GstSourceCombine *combine = &group->combiner[i];
 
@@ -3476,9 +3665,11 @@ drained_cb (GstElement * decodebin, GstSourceGroup * group)
 
   GST_DEBUG_OBJECT (playbin, "about to finish in group %p", group);
 
-  /* after this call, we should have a next group to activate or we EOS */
-  g_signal_emit (G_OBJECT (playbin),
-      gst_play_bin_signals[SIGNAL_ABOUT_TO_FINISH], 0, NULL);
+  /* after this call, we should have a next group to activate or we EOS. With
+   * preroll-ahead the signal was already emitted from the buffer probe. */
+  if (g_atomic_int_compare_and_exchange (&group->about_to_finish, 0, 1))
+    g_signal_emit (G_OBJECT (playbin),
+        gst_play_bin_signals[SIGNAL_ABOUT_TO_FINISH], 0, NULL);
 
   /* now activate the next group. If the app did not set a uri, this will
    * fail and we can do EOS */
@@ -4814,6 +5005,16 @@ activate_group (GstPlayBin * playbin, GstSourceGroup * group, GstState target)
   if (!group->suburi_flushes_to_drop_lock.p)
     g_mutex_init (&group->suburi_flushes_to_drop_lock);
 
+  g_atomic_int_set (&group->about_to_finish, 0);
+  group->preroll_duration = -1;
+  /* custom stream combiners are shared by the groups, so we can't have two
+   * groups using them at the same time */
+  if (playbin->audio_stream_combiner || playbin->video_stream_combiner ||
+      playbin->text_stream_combiner)
+    group->preroll_ahead = 0;
+  else
+    group->preroll_ahead = playbin->preroll_ahead;
+
   if (group->uridecodebin) {
     GST_DEBUG_OBJECT (playbin, "reusing existing uridecodebin");
     uridecodebin = group->uridecodebin;
@@ -5043,6 +5244,9 @@ deactivate_group (GstPlayBin * playbin, GstSourceGroup * group)
 
   GST_SOURCE_GROUP_LOCK (group);
   group->active = FALSE;
+  group->preroll = FALSE;
+  group->uri_no_more_pads = FALSE;
+  group->sub_no_more_pads = FALSE;
   for (i = 0; i < PLAYBIN_STREAM_LAST; i++) {
     GstSourceCombine *combine = &group->combiner[i];
 
@@ -5128,6 +5332,78 @@ deactivate_group (GstPlayBin * playbin, GstSourceGroup * group)
   return TRUE;
 }
 
+/* activate the next group while the current one is still playing. Its
+ * combiners stay blocked until setup_next_source() links it to the sinks
+ * when the current group is drained. */
+static void
+preroll_next_source (GstPlayBin * playbin)
+{
+  GstSourceGroup *group;
+
+  if (g_atomic_int_get (&playbin->shutdown))
+    return;
+
+  GST_PLAY_BIN_LOCK (playbin);
+  group = playbin->next_group;
+  if (group && group->valid && !group->active) {
+    GST_DEBUG_OBJECT (playbin, "prerolling next group %p", group);
+
+    GST_SOURCE_GROUP_LOCK (group);
+    group->preroll = TRUE;
+    GST_SOURCE_GROUP_UNLOCK (group);
+
+    if (!activate_group (playbin, group, GST_STATE_PAUSED)) {
+      GST_SOURCE_GROUP_LOCK (group);
+      group->preroll = FALSE;
+      GST_SOURCE_GROUP_UNLOCK (group);
+    }
+  } else {
+    GST_DEBUG_OBJECT (playbin, "no next group to preroll");
+  }
+  GST_PLAY_BIN_UNLOCK (playbin);
+}
+
+/* link a group that was activated by preroll_next_source() to the sinks.
+ * must be called with PLAY_BIN_LOCK */
+static void
+link_prerolled_group (GstPlayBin * playbin, GstSourceGroup * group)
+{
+  gboolean uri_no_more_pads, sub_no_more_pads;
+
+  GST_DEBUG_OBJECT (playbin, "linking prerolled group %p", group);
+
+  GST_SOURCE_GROUP_LOCK (group);
+  group->preroll = FALSE;
+  uri_no_more_pads = group->uri_no_more_pads;
+  sub_no_more_pads = group->sub_no_more_pads;
+  group->uri_no_more_pads = FALSE;
+  group->sub_no_more_pads = FALSE;
+  GST_SOURCE_GROUP_UNLOCK (group);
+
+  /* replay the deferred no-more-pads, the ones that did not arrive yet will
+   * link the group themselves */
+  if (sub_no_more_pads)
+    no_more_pads_cb (group->suburidecodebin, group);
+  if (uri_no_more_pads)
+    no_more_pads_cb (group->uridecodebin, group);
+}
+
+/* throw away a group that was activated by preroll_next_source(), it will be
+ * activated again from scratch.
+ * must be called with PLAY_BIN_LOCK */
+static void
+discard_prerolled_group (GstPlayBin * playbin, GstSourceGroup * group)
+{
+  GST_DEBUG_OBJECT (playbin, "discarding prerolled group %p", group);
+
+  deactivate_group (playbin, group);
+
+  if (group->uridecodebin)
+    gst_element_set_state (group->uridecodebin, GST_STATE_READY);
+  if (group->suburidecodebin)
+    gst_element_set_state (group->suburidecodebin, GST_STATE_READY);
+}
+
 /* setup the next group to play, this assumes the next_group is valid and
  * configured. It swaps out the current_group and activates the valid
  * next_group. */
@@ -5157,8 +5433,10 @@ setup_next_source (GstPlayBin * playbin, GstState target)
   playbin->curr_group = new_group;
   playbin->next_group = old_group;
 
-  /* activate the new group */
-  if (!activate_group (playbin, new_group, target))
+  /* activate the new group, or link it if it was already prerolled */
+  if (new_group->active)
+    link_prerolled_group (playbin, new_group);
+  else if (!activate_group (playbin, new_group, target))
     goto activate_failed;
 
   GST_PLAY_BIN_UNLOCK (playbin);
@@ -5199,6 +5477,10 @@ save_current_group (GstPlayBin * playbin)
     /* unlink our pads with the sink */
     deactivate_group (playbin, curr_group);
   }
+  /* a prerolled next group is started from scratch */
+  if (playbin->next_group && playbin->next_group->valid &&
+      playbin->next_group->active)
+    deactivate_group (playbin, playbin->next_group);
   /* swap old and new */
   playbin->curr_group = playbin->next_group;
   playbin->next_group = curr_group;
@@ -1142,6 +1142,34 @@ activate_chain (GstPlayChain * chain, gboolean activate)
   return TRUE;
 }
 
+/* Links @srcpad to @sinkpad, unlinking them from their current peers first.
+ * Nothing is done if they are already linked to each other, so that chains
+ * which are kept during a reconfiguration don't see their sticky events
+ * again and keep running undisturbed. */
+static void
+relink_pads (GstPad * srcpad, GstPad * sinkpad)
+{
+  GstPad *peer;
+
+  peer = gst_pad_get_peer (srcpad);
+  if (peer == sinkpad) {
+    gst_object_unref (peer);
+    return;
+  }
+  if (peer) {
+    gst_pad_unlink (srcpad, peer);
+    gst_object_unref (peer);
+  }
+
+  peer = gst_pad_get_peer (sinkpad);
+  if (peer) {
+    gst_pad_unlink (peer, sinkpad);
+    gst_object_unref (peer);
+  }
+
+  gst_pad_link_full (srcpad, sinkpad, GST_PAD_LINK_CHECK_NOTHING);
+}
+
 static gboolean
 element_is_sink (GstElement * element)
 {
@@ -2850,11 +2878,15 @@ gen_vis_chain (GstPlaySink * playsink)
   gst_object_ref_sink (bin);
 
   /* we're queuing raw audio here, we can remove this queue when we can disable
-   * async behaviour in the video sink. */
+   * async behaviour in the video sink. The queue also runs the vis in its own
+   * thread; when the vis can't keep up, the queue drops the oldest audio
+   * instead of blocking the audio branch on the tee, the vis skips frames
+   * based on the QoS events from the video sink. */
   chain->queue = gst_element_factory_make ("queue", "visqueue");
   if (chain->queue == NULL)
     goto no_queue;
-  g_object_set (chain->queue, "silent", TRUE, NULL);
+  g_object_set (chain->queue, "silent", TRUE, "leaky", 2 /* downstream */ ,
+      NULL);
   gst_bin_add (bin, chain->queue);
 
   chain->conv = gst_element_factory_make ("audioconvert", "aconv");
@@ -2965,13 +2997,23 @@ link_failed:
  * have to construct the final pipeline. Based on the flags we construct the
  * final output pipelines.
  */
+/* logs the time spent on a step of the reconfiguration */
+#define RECONFIGURE_STEP_DONE(playsink,step,name) G_STMT_START {        \
+  GstClockTime __now = gst_util_get_timestamp ();                       \
+  GST_DEBUG_OBJECT (playsink, "reconfigured " name " in %"              \
+      GST_TIME_FORMAT, GST_TIME_ARGS (__now - (step)));                 \
+  (step) = __now;                                                       \
+} G_STMT_END
+
 static gboolean
 gst_play_sink_do_reconfigure (GstPlaySink * playsink)
 {
   GstPlayFlags flags;
   gboolean need_audio, need_video, need_deinterlace, need_vis, need_text;
+  GstClockTime start, step;
 
   GST_DEBUG_OBJECT (playsink, "reconfiguring");
+  start = step = gst_util_get_timestamp ();
 
   /* assume we need nothing */
   need_audio = need_video = need_deinterlace = need_vis = need_text = FALSE;
@@ -3134,10 +3176,8 @@ gst_play_sink_do_reconfigure (GstPlaySink * playsink)
       add_chain (GST_PLAY_CHAIN (playsink->videodeinterlacechain), TRUE);
       activate_chain (GST_PLAY_CHAIN (playsink->videodeinterlacechain), TRUE);
 
-      gst_pad_unlink (playsink->video_srcpad_stream_synchronizer,
-          playsink->videochain->sinkpad);
-      gst_pad_link_full (playsink->video_srcpad_stream_synchronizer,
-          playsink->videodeinterlacechain->sinkpad, GST_PAD_LINK_CHECK_NOTHING);
+      relink_pads (playsink->video_srcpad_stream_synchronizer,
+          playsink->videodeinterlacechain->sinkpad);
     } else {
       if (playsink->videodeinterlacechain) {
         add_chain (GST_PLAY_CHAIN (playsink->videodeinterlacechain), FALSE);
@@ -3153,18 +3193,12 @@ gst_play_sink_do_reconfigure (GstPlaySink * playsink)
     if (!need_vis && !need_text && (!playsink->textchain
             || !playsink->text_pad)) {
       GST_DEBUG_OBJECT (playsink, "ghosting video sinkpad");
-      gst_pad_unlink (playsink->video_srcpad_stream_synchronizer,
-          playsink->videochain->sinkpad);
-      if (playsink->videodeinterlacechain
-          && playsink->videodeinterlacechain->srcpad)
-        gst_pad_unlink (playsink->videodeinterlacechain->srcpad,
-            playsink->videochain->sinkpad);
       if (need_deinterlace)
-        gst_pad_link_full (playsink->videodeinterlacechain->srcpad,
-            playsink->videochain->sinkpad, GST_PAD_LINK_CHECK_NOTHING);
+        relink_pads (playsink->videodeinterlacechain->srcpad,
+            playsink->videochain->sinkpad);
       else
-        gst_pad_link_full (playsink->video_srcpad_stream_synchronizer,
-            playsink->videochain->sinkpad, GST_PAD_LINK_CHECK_NOTHING);
+        relink_pads (playsink->video_srcpad_stream_synchronizer,
+            playsink->videochain->sinkpad);
     }
   } else {
     GST_DEBUG_OBJECT (playsink, "no video needed");
@@ -3227,6 +3261,7 @@ gst_play_sink_do_reconfigure (GstPlaySink * playsink)
     GST_OBJECT_UNLOCK (playsink);
 
   }
+  RECONFIGURE_STEP_DONE (playsink, step, "video");
 
   if (need_audio) {
     gboolean raw;
@@ -3313,11 +3348,10 @@ gst_play_sink_do_reconfigure (GstPlaySink * playsink)
       }
       add_chain (GST_PLAY_CHAIN (playsink->audiochain), TRUE);
       activate_chain (GST_PLAY_CHAIN (playsink->audiochain), TRUE);
-      gst_pad_link_full (playsink->audio_tee_asrc,
-          playsink->audio_sinkpad_stream_synchronizer,
-          GST_PAD_LINK_CHECK_NOTHING);
-      gst_pad_link_full (playsink->audio_srcpad_stream_synchronizer,
-          playsink->audiochain->sinkpad, GST_PAD_LINK_CHECK_NOTHING);
+      relink_pads (playsink->audio_tee_asrc,
+          playsink->audio_sinkpad_stream_synchronizer);
+      relink_pads (playsink->audio_srcpad_stream_synchronizer,
+          playsink->audiochain->sinkpad);
     }
   } else {
     GST_DEBUG_OBJECT (playsink, "no audio needed");
@@ -3354,6 +3388,7 @@ gst_play_sink_do_reconfigure (GstPlaySink * playsink)
       activate_chain (GST_PLAY_CHAIN (playsink->audiochain), FALSE);
     }
   }
+  RECONFIGURE_STEP_DONE (playsink, step, "audio");
 
   if (need_vis) {
     GstPad *srcpad;
@@ -3373,12 +3408,10 @@ gst_play_sink_do_reconfigure (GstPlaySink * playsink)
         playsink->audio_tee_vissrc =
             gst_element_get_request_pad (playsink->audio_tee, "src_%u");
       }
-      gst_pad_link_full (playsink->audio_tee_vissrc,
-          playsink->vischain->sinkpad, GST_PAD_LINK_CHECK_NOTHING);
-      gst_pad_link_full (srcpad, playsink->video_sinkpad_stream_synchronizer,
-          GST_PAD_LINK_CHECK_NOTHING);
-      gst_pad_link_full (playsink->video_srcpad_stream_synchronizer,
-          playsink->videochain->sinkpad, GST_PAD_LINK_CHECK_NOTHING);
+      relink_pads (playsink->audio_tee_vissrc, playsink->vischain->sinkpad);
+      relink_pads (srcpad, playsink->video_sinkpad_stream_synchronizer);
+      relink_pads (playsink->video_srcpad_stream_synchronizer,
+          playsink->videochain->sinkpad);
       gst_object_unref (srcpad);
     }
   } else {
@@ -3395,6 +3428,7 @@ gst_play_sink_do_reconfigure (GstPlaySink * playsink)
       activate_chain (GST_PLAY_CHAIN (playsink->vischain), FALSE);
     }
   }
+  RECONFIGURE_STEP_DONE (playsink, step, "vis");
 
   if (need_text) {
     GST_DEBUG_OBJECT (playsink, "adding text");
@@ -3438,20 +3472,18 @@ gst_play_sink_do_reconfigure (GstPlaySink * playsink)
 
           srcpad =
               gst_element_get_static_pad (playsink->vischain->chain.bin, "src");
-          gst_pad_unlink (srcpad, playsink->videochain->sinkpad);
-          gst_pad_link_full (srcpad, playsink->textchain->videosinkpad,
-              GST_PAD_LINK_CHECK_NOTHING);
+          relink_pads (srcpad, playsink->textchain->videosinkpad);
           gst_object_unref (srcpad);
         } else {
           if (need_deinterlace)
-            gst_pad_link_full (playsink->videodeinterlacechain->srcpad,
-                playsink->textchain->videosinkpad, GST_PAD_LINK_CHECK_NOTHING);
+            relink_pads (playsink->videodeinterlacechain->srcpad,
+                playsink->textchain->videosinkpad);
           else
-            gst_pad_link_full (playsink->video_srcpad_stream_synchronizer,
-                playsink->textchain->videosinkpad, GST_PAD_LINK_CHECK_NOTHING);
+            relink_pads (playsink->video_srcpad_stream_synchronizer,
+                playsink->textchain->videosinkpad);
         }
-        gst_pad_link_full (playsink->textchain->srcpad,
-            playsink->videochain->sinkpad, GST_PAD_LINK_CHECK_NOTHING);
+        relink_pads (playsink->textchain->srcpad,
+            playsink->videochain->sinkpad);
       }
 
       activate_chain (GST_PLAY_CHAIN (playsink->textchain), TRUE);
@@ -3501,10 +3533,14 @@ gst_play_sink_do_reconfigure (GstPlaySink * playsink)
     if (playsink->text_pad && !playsink->textchain)
       gst_ghost_pad_set_target (GST_GHOST_PAD_CAST (playsink->text_pad), NULL);
   }
+  RECONFIGURE_STEP_DONE (playsink, step, "text");
   update_av_offset (playsink);
   do_async_done (playsink);
   GST_PLAY_SINK_UNLOCK (playsink);
 
+  GST_DEBUG_OBJECT (playsink, "reconfigured in %" GST_TIME_FORMAT,
+      GST_TIME_ARGS (gst_util_get_timestamp () - start));
+
   return TRUE;
 
   /* ERRORS */
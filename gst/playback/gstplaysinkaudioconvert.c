@@ -54,6 +54,9 @@ gst_play_sink_audio_convert_add_conversion_elements (GstPlaySinkAudioConvert *
       "Building audio conversion with use-converters %d, use-volume %d",
       self->use_converters, self->use_volume);
 
+  /* the volume has to be applied even if no conversion is needed */
+  cbin->can_bypass = !(self->use_volume && self->volume);
+
   if (self->use_converters) {
     el = gst_play_sink_convert_bin_add_conversion_element_factory (cbin,
         "audioconvert", "conv");
@@ -66,6 +66,24 @@ is_raw_caps (GstCaps * caps, gboolean audio)
   return FALSE;
 }
 
+/* Whether the conversion elements are needed for raw @caps, they are left
+ * out if they only convert and downstream can handle @caps directly */
+static gboolean
+needs_conversion (GstPlaySinkConvertBin * self, GstCaps * caps)
+{
+  if (self->conversion_elements == NULL)
+    return FALSE;
+
+  if (self->can_bypass
+      && gst_pad_peer_query_accept_caps (self->srcpad, caps)) {
+    GST_DEBUG_OBJECT (self, "Downstream accepts %" GST_PTR_FORMAT
+        ", bypassing the converters", caps);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 static void
 gst_play_sink_convert_bin_post_missing_element_message (GstPlaySinkConvertBin *
     self, const gchar * name)
@@ -206,7 +224,7 @@ pad_blocked_cb (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
   GstPlaySinkConvertBin *self = user_data;
   GstPad *peer;
   GstCaps *caps;
-  gboolean raw;
+  gboolean raw, converting;
 
   GST_PLAY_SINK_CONVERT_BIN_LOCK (self);
   GST_DEBUG_OBJECT (self, "Pad blocked");
@@ -219,22 +237,24 @@ pad_blocked_cb (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
   gst_object_unref (peer);
 
   raw = is_raw_caps (caps, self->audio);
-  GST_DEBUG_OBJECT (self, "Caps %" GST_PTR_FORMAT " are raw: %d", caps, raw);
+  converting = raw && needs_conversion (self, caps);
+  GST_DEBUG_OBJECT (self, "Caps %" GST_PTR_FORMAT " are raw: %d, need "
+      "conversion: %d", caps, raw, converting);
   gst_caps_unref (caps);
 
-  if (raw == self->raw)
+  if (raw == self->raw && converting == self->converting)
     goto unblock;
   self->raw = raw;
+  self->converting = converting;
 
   gst_ghost_pad_set_target (GST_GHOST_PAD_CAST (self->sinkpad), NULL);
   gst_ghost_pad_set_target (GST_GHOST_PAD_CAST (self->srcpad), NULL);
 
-  if (raw) {
+  if (converting) {
     GST_DEBUG_OBJECT (self, "Switching to raw conversion pipeline");
 
-    if (self->conversion_elements)
-      g_list_foreach (self->conversion_elements,
-          (GFunc) gst_play_sink_convert_bin_on_element_added, self);
+    g_list_foreach (self->conversion_elements,
+        (GFunc) gst_play_sink_convert_bin_on_element_added, self);
   } else {
 
     GST_DEBUG_OBJECT (self, "Switch to passthrough pipeline");
@@ -242,7 +262,7 @@ pad_blocked_cb (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
     gst_play_sink_convert_bin_on_element_added (self->identity, self);
   }
 
-  gst_play_sink_convert_bin_set_targets (self, !raw);
+  gst_play_sink_convert_bin_set_targets (self, !converting);
 
 unblock:
   self->sink_proxypad_block_id = 0;
@@ -343,9 +363,12 @@ gst_play_sink_convert_bin_sink_setcaps (GstPlaySinkConvertBin * self,
     if (!gst_pad_is_blocked (self->sink_proxypad)) {
       GstPad *target = gst_ghost_pad_get_target (GST_GHOST_PAD (self->sinkpad));
 
-      if (!self->raw || (target && !gst_pad_query_accept_caps (target, caps))) {
+      if (!self->raw || (target && !gst_pad_query_accept_caps (target, caps))
+          || (self->converting && !needs_conversion (self, caps))) {
         if (!self->raw)
           GST_DEBUG_OBJECT (self, "Changing caps from non-raw to raw");
+        else if (self->converting)
+          GST_DEBUG_OBJECT (self, "Conversion not needed anymore");
         else
           GST_DEBUG_OBJECT (self, "Changing caps in an incompatible way");
 
@@ -575,6 +598,7 @@ gst_play_sink_convert_bin_change_state (GstElement * element,
       gst_segment_init (&self->segment, GST_FORMAT_UNDEFINED);
       gst_play_sink_convert_bin_set_targets (self, TRUE);
       self->raw = FALSE;
+      self->converting = FALSE;
       GST_PLAY_SINK_CONVERT_BIN_UNLOCK (self);
       break;
     default:
@@ -591,6 +615,7 @@ gst_play_sink_convert_bin_change_state (GstElement * element,
       gst_segment_init (&self->segment, GST_FORMAT_UNDEFINED);
       gst_play_sink_convert_bin_set_targets (self, TRUE);
       self->raw = FALSE;
+      self->converting = FALSE;
       GST_PLAY_SINK_CONVERT_BIN_UNLOCK (self);
       break;
     case GST_STATE_CHANGE_READY_TO_PAUSED:
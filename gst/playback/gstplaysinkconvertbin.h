@@ -74,6 +74,12 @@ struct _GstPlaySinkConvertBin
   GList *conversion_elements;
   GstElement *identity;
 
+  /* TRUE if the conversion elements are currently linked */
+  gboolean converting;
+  /* TRUE if the conversion elements only convert and can be left out when
+   * downstream accepts the raw caps as they are, set by derived classes */
+  gboolean can_bypass;
+
   GstCaps *converter_caps;
 
   /* configuration for derived classes */
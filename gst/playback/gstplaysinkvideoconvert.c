@@ -54,6 +54,9 @@ gst_play_sink_video_convert_add_conversion_elements (GstPlaySinkVideoConvert *
       "Building video conversion with use-converters %d, use-balance %d",
       self->use_converters, self->use_balance);
 
+  /* the balance has to be applied even if no conversion is needed */
+  cbin->can_bypass = !(self->use_balance && self->balance);
+
   if (self->use_converters) {
     el = gst_play_sink_convert_bin_add_conversion_element_factory (cbin,
         COLORSPACE, "conv");
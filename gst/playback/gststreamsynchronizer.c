@@ -72,12 +72,33 @@ typedef struct
 
   GCond stream_finish_cond;
 
+  /* The buffer path only takes this lock to update segment.position, other
+   * threads have to take it (after the synchronizer lock) when accessing the
+   * position of another stream. Everything else accessed from the buffer
+   * path is only modified by serialized events on the same pad. */
+  GMutex position_lock;
+
   /* seqnum of the previously received STREAM_START
    * default: G_MAXUINT32 */
   guint32 stream_start_seqnum;
   guint32 segment_seqnum;
 } GstStream;
 
+/* Must be called with lock! */
+static void
+gst_stream_set_eos (GstStreamSynchronizer * self, GstStream * stream,
+    gboolean eos)
+{
+  if (stream->is_eos == eos)
+    return;
+
+  stream->is_eos = eos;
+  if (eos)
+    g_atomic_int_inc (&self->n_eos_streams);
+  else
+    g_atomic_int_add (&self->n_eos_streams, -1);
+}
+
 /* Must be called with lock! */
 static inline GstPad *
 gst_stream_get_other_pad (GstStream * stream, GstPad * pad)
@@ -250,7 +271,7 @@ gst_stream_synchronizer_sink_event (GstPad * pad, GstObject * parent,
       GST_STREAM_SYNCHRONIZER_LOCK (self);
       stream = gst_pad_get_element_private (pad);
       if (stream && stream->stream_start_seqnum != seqnum) {
-        stream->is_eos = FALSE;
+        gst_stream_set_eos (self, stream, FALSE);
         stream->stream_start_seqnum = seqnum;
         stream->drop_discont = TRUE;
 
@@ -301,9 +322,11 @@ gst_stream_synchronizer_sink_event (GstPad * pad, GstObject * parent,
                 stop_running_time =
                     gst_segment_to_running_time (&ostream->segment,
                     GST_FORMAT_TIME, ostream->segment.stop);
+                g_mutex_lock (&ostream->position_lock);
                 position_running_time =
                     gst_segment_to_running_time (&ostream->segment,
                     GST_FORMAT_TIME, ostream->segment.position);
+                g_mutex_unlock (&ostream->position_lock);
                 position =
                     MAX (position, MAX (stop_running_time,
                         position_running_time));
@@ -409,7 +432,7 @@ gst_stream_synchronizer_sink_event (GstPad * pad, GstObject * parent,
             stream->stream_number);
         gst_segment_init (&stream->segment, GST_FORMAT_UNDEFINED);
 
-        stream->is_eos = FALSE;
+        gst_stream_set_eos (self, stream, FALSE);
         stream->wait = FALSE;
         stream->new_stream = FALSE;
         stream->drop_discont = FALSE;
@@ -437,7 +460,7 @@ gst_stream_synchronizer_sink_event (GstPad * pad, GstObject * parent,
       }
 
       GST_DEBUG_OBJECT (pad, "Have EOS for stream %d", stream->stream_number);
-      stream->is_eos = TRUE;
+      gst_stream_set_eos (self, stream, TRUE);
 
       seen_data = stream->seen_data;
       srcpad = gst_object_ref (stream->srcpad);
@@ -544,46 +567,47 @@ gst_stream_synchronizer_sink_chain (GstPad * pad, GstObject * parent,
       && GST_CLOCK_TIME_IS_VALID (duration))
     timestamp_end = timestamp + duration;
 
-  GST_STREAM_SYNCHRONIZER_LOCK (self);
+  /* The stream can't be freed while we're streaming, releasing it
+   * deactivates the pad first, so no need for the lock here */
   stream = gst_pad_get_element_private (pad);
+  if (!stream) {
+    GST_WARNING_OBJECT (pad, "Buffer for released stream");
+    gst_buffer_unref (buffer);
+    return GST_FLOW_ERROR;
+  }
 
-  if (stream) {
-    stream->seen_data = TRUE;
-    if (stream->drop_discont) {
-      if (GST_BUFFER_IS_DISCONT (buffer)) {
-        GST_DEBUG_OBJECT (pad, "removing DISCONT from buffer %p", buffer);
-        buffer = gst_buffer_make_writable (buffer);
-        GST_BUFFER_FLAG_UNSET (buffer, GST_BUFFER_FLAG_DISCONT);
-      }
-      stream->drop_discont = FALSE;
-    }
-
-    if (stream->segment.format == GST_FORMAT_TIME
-        && GST_CLOCK_TIME_IS_VALID (timestamp)) {
-      GST_LOG_OBJECT (pad,
-          "Updating position from %" GST_TIME_FORMAT " to %" GST_TIME_FORMAT,
-          GST_TIME_ARGS (stream->segment.position), GST_TIME_ARGS (timestamp));
-      if (stream->segment.rate > 0.0)
-        stream->segment.position = timestamp;
-      else
-        stream->segment.position = timestamp_end;
+  stream->seen_data = TRUE;
+  if (stream->drop_discont) {
+    if (GST_BUFFER_IS_DISCONT (buffer)) {
+      GST_DEBUG_OBJECT (pad, "removing DISCONT from buffer %p", buffer);
+      buffer = gst_buffer_make_writable (buffer);
+      GST_BUFFER_FLAG_UNSET (buffer, GST_BUFFER_FLAG_DISCONT);
     }
+    stream->drop_discont = FALSE;
   }
-  GST_STREAM_SYNCHRONIZER_UNLOCK (self);
 
-  opad = gst_stream_get_other_pad_from_pad (self, pad);
-  if (opad) {
-    ret = gst_pad_push (opad, buffer);
-    gst_object_unref (opad);
+  if (stream->segment.format == GST_FORMAT_TIME
+      && GST_CLOCK_TIME_IS_VALID (timestamp)) {
+    g_mutex_lock (&stream->position_lock);
+    GST_LOG_OBJECT (pad,
+        "Updating position from %" GST_TIME_FORMAT " to %" GST_TIME_FORMAT,
+        GST_TIME_ARGS (stream->segment.position), GST_TIME_ARGS (timestamp));
+    if (stream->segment.rate > 0.0)
+      stream->segment.position = timestamp;
+    else
+      stream->segment.position = timestamp_end;
+    g_mutex_unlock (&stream->position_lock);
   }
 
+  opad = gst_object_ref (stream->srcpad);
+  ret = gst_pad_push (opad, buffer);
+  gst_object_unref (opad);
+
   GST_LOG_OBJECT (pad, "Push returned: %s", gst_flow_get_name (ret));
   if (ret == GST_FLOW_OK) {
     GList *l;
 
-    GST_STREAM_SYNCHRONIZER_LOCK (self);
-    stream = gst_pad_get_element_private (pad);
-    if (stream && stream->segment.format == GST_FORMAT_TIME) {
+    if (stream->segment.format == GST_FORMAT_TIME) {
       GstClockTime position;
 
       if (stream->segment.rate > 0.0)
@@ -592,13 +616,19 @@ gst_stream_synchronizer_sink_chain (GstPad * pad, GstObject * parent,
         position = timestamp;
 
       if (GST_CLOCK_TIME_IS_VALID (position)) {
+        g_mutex_lock (&stream->position_lock);
         GST_LOG_OBJECT (pad,
             "Updating position from %" GST_TIME_FORMAT " to %" GST_TIME_FORMAT,
             GST_TIME_ARGS (stream->segment.position), GST_TIME_ARGS (position));
         stream->segment.position = position;
+        g_mutex_unlock (&stream->position_lock);
       }
     }
 
+    /* Only EOS streams need the synchronizer lock below */
+    if (g_atomic_int_get (&self->n_eos_streams) == 0)
+      return ret;
+
     /* Advance EOS streams if necessary. For non-EOS
      * streams the demuxers should already do this! */
     if (!GST_CLOCK_TIME_IS_VALID (timestamp_end) &&
@@ -606,6 +636,7 @@ gst_stream_synchronizer_sink_chain (GstPad * pad, GstObject * parent,
       timestamp_end = timestamp + GST_SECOND;
     }
 
+    GST_STREAM_SYNCHRONIZER_LOCK (self);
     for (l = self->streams; l; l = l->next) {
       GstStream *ostream = l->data;
       gint64 position;
@@ -613,6 +644,7 @@ gst_stream_synchronizer_sink_chain (GstPad * pad, GstObject * parent,
       if (!ostream->is_eos || ostream->segment.format != GST_FORMAT_TIME)
         continue;
 
+      g_mutex_lock (&ostream->position_lock);
       if (ostream->segment.position != -1)
         position = ostream->segment.position;
       else
@@ -631,9 +663,12 @@ gst_stream_synchronizer_sink_chain (GstPad * pad, GstObject * parent,
             GST_TIME_ARGS (new_start));
 
         ostream->segment.position = new_start;
+        g_mutex_unlock (&ostream->position_lock);
 
         gst_pad_push_event (ostream->srcpad,
             gst_event_new_gap (position, new_start - position));
+      } else {
+        g_mutex_unlock (&ostream->position_lock);
       }
     }
     GST_STREAM_SYNCHRONIZER_UNLOCK (self);
@@ -659,6 +694,7 @@ gst_stream_synchronizer_request_new_pad (GstElement * element,
   stream->transform = self;
   stream->stream_number = self->current_stream_number;
   g_cond_init (&stream->stream_finish_cond);
+  g_mutex_init (&stream->position_lock);
   stream->stream_start_seqnum = G_MAXUINT32;
   stream->segment_seqnum = G_MAXUINT32;
 
@@ -721,6 +757,7 @@ gst_stream_synchronizer_release_stream (GstStreamSynchronizer * self,
     }
   }
   g_assert (l != NULL);
+  gst_stream_set_eos (self, stream, FALSE);
 
   /* we can drop the lock, since stream exists now only local.
    * Moreover, we should drop, to prevent deadlock with STREAM_LOCK
@@ -757,6 +794,7 @@ gst_stream_synchronizer_release_stream (GstStreamSynchronizer * self,
   }
 
   g_cond_clear (&stream->stream_finish_cond);
+  g_mutex_clear (&stream->position_lock);
   g_slice_free (GstStream, stream);
 
   /* NOTE: In theory we have to check here if all streams
@@ -842,7 +880,7 @@ gst_stream_synchronizer_change_state (GstElement * element,
         stream->wait = FALSE;
         stream->new_stream = FALSE;
         stream->drop_discont = FALSE;
-        stream->is_eos = FALSE;
+        gst_stream_set_eos (self, stream, FALSE);
       }
       GST_STREAM_SYNCHRONIZER_UNLOCK (self);
       break;
@@ -51,6 +51,9 @@ struct _GstStreamSynchronizer
   GList *streams;
   guint current_stream_number;
 
+  /* number of EOS streams, can be read without the lock */
+  gint n_eos_streams;
+
   GstClockTime group_start_time;
 };
 
@@ -897,6 +897,50 @@ _setup_renderer (GstSubtitleOverlay * self, GstElement * renderer)
   return TRUE;
 }
 
+/* If downstream supports the GstVideoOverlayCompositionMeta, renderers like
+ * textoverlay attach the subtitles to the video buffers instead of blending
+ * them. If the renderer then also accepts the video caps as they are, it can
+ * be linked without the colorspace converters. */
+static gboolean
+_can_attach_composition (GstSubtitleOverlay * self, GstElement * renderer)
+{
+  GstPad *video_peer, *sink;
+  GstCaps *video_caps = NULL;
+  GstQuery *query;
+  gboolean ret = FALSE;
+
+  video_peer = gst_pad_get_peer (self->video_sinkpad);
+  if (video_peer) {
+    video_caps = gst_pad_get_current_caps (video_peer);
+    gst_object_unref (video_peer);
+  }
+  if (!video_caps)
+    return FALSE;
+
+  sink = _get_video_pad (renderer);
+  if (sink) {
+    ret = gst_pad_query_accept_caps (sink, video_caps);
+    gst_object_unref (sink);
+  }
+
+  if (ret)
+    ret = gst_pad_peer_query_accept_caps (self->srcpad, video_caps);
+
+  if (ret) {
+    query = gst_query_new_allocation (video_caps, FALSE);
+    ret = gst_pad_peer_query (self->srcpad, query)
+        && gst_query_find_allocation_meta (query,
+        GST_VIDEO_OVERLAY_COMPOSITION_META_API_TYPE, NULL);
+    gst_query_unref (query);
+  }
+  gst_caps_unref (video_caps);
+
+  GST_DEBUG_OBJECT (self, "can%s attach the overlay composition",
+      ret ? "" : "not");
+
+  return ret;
+}
+
 /* subtitle_src==NULL means: use subtitle_sink ghostpad */
 static gboolean
 _link_renderer (GstSubtitleOverlay * self, GstElement * renderer,
@@ -926,7 +970,7 @@ _link_renderer (GstSubtitleOverlay * self, GstElement * renderer,
     }
     gst_object_unref (sink);
 
-    if (!is_hw) {
+    if (!is_hw && !_can_attach_composition (self, renderer)) {
       /* First link everything internally */
       if (G_UNLIKELY (!_create_element (self, &self->post_colorspace,
                   COLORSPACE, NULL, "post-colorspace", FALSE))) {
@@ -988,7 +1032,8 @@ _link_renderer (GstSubtitleOverlay * self, GstElement * renderer,
         return FALSE;
       }
     } else {
-      /* Set src ghostpad target in the harware accelerated case */
+      /* Set src ghostpad target in the harware accelerated case, or when
+       * the renderer attaches the subtitles as meta */
 
       src = gst_element_get_static_pad (renderer, "src");
       if (G_UNLIKELY (!src)) {
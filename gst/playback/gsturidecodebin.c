@@ -116,6 +116,12 @@ struct _GstURIDecodeBin
   gboolean expose_allstreams;   /* Whether to expose unknow type streams or not */
 
   guint64 ring_buffer_max_size; /* 0 means disabled */
+
+  gboolean adaptive_buffering;  /* adapt the queue thresholds to the rates */
+  gint low_percent;             /* current queue thresholds */
+  gint high_percent;
+
+  GstTaskPool *task_pool;       /* pool for the streaming threads; OBJECT_LOCK */
 };
 
 struct _GstURIDecodeBinClass
@@ -182,6 +188,9 @@ enum
 #define DEFAULT_USE_BUFFERING       FALSE
 #define DEFAULT_EXPOSE_ALL_STREAMS  TRUE
 #define DEFAULT_RING_BUFFER_MAX_SIZE 0
+#define DEFAULT_ADAPTIVE_BUFFERING  FALSE
+#define DEFAULT_LOW_PERCENT         10
+#define DEFAULT_HIGH_PERCENT        99
 
 enum
 {
@@ -197,6 +206,8 @@ enum
   PROP_USE_BUFFERING,
   PROP_EXPOSE_ALL_STREAMS,
   PROP_RING_BUFFER_MAX_SIZE,
+  PROP_ADAPTIVE_BUFFERING,
+  PROP_TASK_POOL,
   PROP_LAST
 };
 
@@ -490,6 +501,43 @@ gst_uri_decode_bin_class_init (GstURIDecodeBinClass * klass)
           0, G_MAXUINT, DEFAULT_RING_BUFFER_MAX_SIZE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstURIDecodeBin::adaptive-buffering
+   *
+   * Adapt the buffering thresholds of network streams to the measured input
+   * rate and the bitrate of the streams. When data comes in faster than it is
+   * played, playback starts before the buffer is full.
+   *
+   * The BUFFERING messages of the stream buffering then also contain the
+   * combined bitrate of the streams in bits per second as "stream-bitrate"
+   * and the current thresholds as "low-percent" and "high-percent", next to
+   * the measured input rate in the buffering stats.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_ADAPTIVE_BUFFERING,
+      g_param_spec_boolean ("adaptive-buffering", "Adaptive buffering",
+          "Adapt the buffering thresholds to the measured input rate",
+          DEFAULT_ADAPTIVE_BUFFERING,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstURIDecodeBin::task-pool
+   *
+   * #GstTaskPool in which the streaming threads of the source, the
+   * buffering queue and the elements of the decodebins are run. %NULL uses
+   * the default pool, which creates a thread per task. The pool has to be
+   * prepared with gst_task_pool_prepare() by the application. Changing it
+   * only affects tasks that are created afterwards.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_TASK_POOL,
+      g_param_spec_object ("task-pool", "Task Pool",
+          "Pool for the streaming threads of the inner elements "
+          "(NULL = default)", GST_TYPE_TASK_POOL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstURIDecodeBin::unknown-type:
    * @bin: The uridecodebin.
@@ -732,6 +780,9 @@ gst_uri_decode_bin_init (GstURIDecodeBin * dec)
   dec->use_buffering = DEFAULT_USE_BUFFERING;
   dec->expose_allstreams = DEFAULT_EXPOSE_ALL_STREAMS;
   dec->ring_buffer_max_size = DEFAULT_RING_BUFFER_MAX_SIZE;
+  dec->adaptive_buffering = DEFAULT_ADAPTIVE_BUFFERING;
+  dec->low_percent = DEFAULT_LOW_PERCENT;
+  dec->high_percent = DEFAULT_HIGH_PERCENT;
 
   GST_OBJECT_FLAG_SET (dec, GST_ELEMENT_FLAG_SOURCE);
 }
@@ -750,6 +801,8 @@ gst_uri_decode_bin_finalize (GObject * obj)
     gst_plugin_feature_list_free (dec->factories);
   if (dec->caps)
     gst_caps_unref (dec->caps);
+  if (dec->task_pool)
+    gst_object_unref (dec->task_pool);
 
   G_OBJECT_CLASS (parent_class)->finalize (obj);
 }
@@ -822,6 +875,16 @@ gst_uri_decode_bin_set_property (GObject * object, guint prop_id,
     case PROP_RING_BUFFER_MAX_SIZE:
       dec->ring_buffer_max_size = g_value_get_uint64 (value);
       break;
+    case PROP_ADAPTIVE_BUFFERING:
+      dec->adaptive_buffering = g_value_get_boolean (value);
+      break;
+    case PROP_TASK_POOL:
+      GST_OBJECT_LOCK (dec);
+      if (dec->task_pool)
+        gst_object_unref (dec->task_pool);
+      dec->task_pool = g_value_dup_object (value);
+      GST_OBJECT_UNLOCK (dec);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -882,6 +945,14 @@ gst_uri_decode_bin_get_property (GObject * object, guint prop_id,
     case PROP_RING_BUFFER_MAX_SIZE:
       g_value_set_uint64 (value, dec->ring_buffer_max_size);
       break;
+    case PROP_ADAPTIVE_BUFFERING:
+      g_value_set_boolean (value, dec->adaptive_buffering);
+      break;
+    case PROP_TASK_POOL:
+      GST_OBJECT_LOCK (dec);
+      g_value_set_object (value, dec->task_pool);
+      GST_OBJECT_UNLOCK (dec);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -998,22 +1069,15 @@ source_no_more_pads (GstElement * element, GstURIDecodeBin * bin)
   no_more_pads_full (element, FALSE, bin);
 }
 
-static void
-configure_stream_buffering (GstURIDecodeBin * decoder)
+/* combined bitrate of all streams, -1 if not all of them have one yet.
+ * Call with the lock. */
+static gint
+get_streams_bitrate (GstURIDecodeBin * decoder)
 {
-  GstElement *queue = NULL;
   GHashTableIter iter;
   gpointer key, value;
   gint bitrate = 0;
 
-  /* automatic configuration enabled ? */
-  if (decoder->buffer_size != -1)
-    return;
-
-  GST_URI_DECODE_BIN_LOCK (decoder);
-  if (decoder->queue)
-    queue = gst_object_ref (decoder->queue);
-
   g_hash_table_iter_init (&iter, decoder->streams);
   while (g_hash_table_iter_next (&iter, &key, &value)) {
     GstURIDecodeBinStream *stream = value;
@@ -1023,6 +1087,24 @@ configure_stream_buffering (GstURIDecodeBin * decoder)
     else
       bitrate = -1;
   }
+
+  return bitrate;
+}
+
+static void
+configure_stream_buffering (GstURIDecodeBin * decoder)
+{
+  GstElement *queue = NULL;
+  gint bitrate;
+
+  /* automatic configuration enabled ? */
+  if (decoder->buffer_size != -1)
+    return;
+
+  GST_URI_DECODE_BIN_LOCK (decoder);
+  if (decoder->queue)
+    queue = gst_object_ref (decoder->queue);
+  bitrate = get_streams_bitrate (decoder);
   GST_URI_DECODE_BIN_UNLOCK (decoder);
 
   GST_DEBUG_OBJECT (decoder, "overall bitrate %d", bitrate);
@@ -1882,6 +1964,10 @@ type_found (GstElement * typefind, guint probability,
   g_object_set (queue, "use-buffering", TRUE, NULL);
   g_object_set (queue, "ring-buffer-max-size", decoder->ring_buffer_max_size,
       NULL);
+  g_object_set (queue, "low-percent", DEFAULT_LOW_PERCENT, "high-percent",
+      DEFAULT_HIGH_PERCENT, NULL);
+  decoder->low_percent = DEFAULT_LOW_PERCENT;
+  decoder->high_percent = DEFAULT_HIGH_PERCENT;
   decoder->queue = queue;
 
   GST_DEBUG_OBJECT (decoder, "check media-type %s, %d", media_type,
@@ -2345,6 +2431,87 @@ handle_redirect_message (GstURIDecodeBin * dec, GstMessage * msg)
   return new_msg;
 }
 
+/* don't go lower than this, the rate estimates are not precise */
+#define ADAPTIVE_MIN_HIGH_PERCENT 20
+/* don't touch the queue for smaller changes */
+#define ADAPTIVE_PERCENT_STEP 5
+
+/* When data comes in faster than it is played, the queue keeps filling
+ * during playback, so buffering only needs to reach the fraction of the
+ * queue given by the ratio of the two rates. Otherwise it needs to fill the
+ * whole queue to play for as long as possible before running out again. */
+static void
+update_buffering_thresholds (GstURIDecodeBin * dec, GstElement * queue,
+    gint avg_in, gint bitrate)
+{
+  guint64 in_bitrate = (guint64) avg_in * 8;
+  gint low, high;
+
+  if (in_bitrate > bitrate) {
+    high = gst_util_uint64_scale (100, bitrate, in_bitrate);
+    high = CLAMP (high, ADAPTIVE_MIN_HIGH_PERCENT, DEFAULT_HIGH_PERCENT);
+    low = MIN (DEFAULT_LOW_PERCENT, high / 2);
+  } else {
+    high = DEFAULT_HIGH_PERCENT;
+    low = DEFAULT_LOW_PERCENT;
+  }
+
+  GST_URI_DECODE_BIN_LOCK (dec);
+  if (ABS (high - dec->high_percent) < ADAPTIVE_PERCENT_STEP
+      && low == dec->low_percent) {
+    GST_URI_DECODE_BIN_UNLOCK (dec);
+    return;
+  }
+  dec->low_percent = low;
+  dec->high_percent = high;
+  GST_URI_DECODE_BIN_UNLOCK (dec);
+
+  GST_DEBUG_OBJECT (dec, "input rate %" G_GUINT64_FORMAT " bit/s, stream "
+      "bitrate %d bit/s, thresholds now %d-%d%%", in_bitrate, bitrate, low,
+      high);
+  g_object_set (queue, "low-percent", low, "high-percent", high, NULL);
+}
+
+static GstMessage *
+handle_buffering_message (GstURIDecodeBin * dec, GstMessage * msg)
+{
+  GstElement *queue = NULL;
+  GstStructure *structure;
+  GstMessage *new_msg;
+  gint avg_in, bitrate, low, high;
+
+  GST_URI_DECODE_BIN_LOCK (dec);
+  if (dec->adaptive_buffering && dec->queue
+      && GST_MESSAGE_SRC (msg) == GST_OBJECT_CAST (dec->queue))
+    queue = gst_object_ref (dec->queue);
+  bitrate = get_streams_bitrate (dec);
+  GST_URI_DECODE_BIN_UNLOCK (dec);
+
+  if (queue == NULL)
+    return msg;
+
+  gst_message_parse_buffering_stats (msg, NULL, &avg_in, NULL, NULL);
+  if (bitrate > 0 && avg_in > 0)
+    update_buffering_thresholds (dec, queue, avg_in, bitrate);
+  gst_object_unref (queue);
+
+  GST_URI_DECODE_BIN_LOCK (dec);
+  low = dec->low_percent;
+  high = dec->high_percent;
+  GST_URI_DECODE_BIN_UNLOCK (dec);
+
+  /* add our measurements for monitoring purposes */
+  structure = gst_structure_copy (gst_message_get_structure (msg));
+  gst_structure_set (structure, "stream-bitrate", G_TYPE_INT, MAX (bitrate, 0),
+      "low-percent", G_TYPE_INT, low, "high-percent", G_TYPE_INT, high, NULL);
+  new_msg = gst_message_new_custom (GST_MESSAGE_BUFFERING,
+      GST_MESSAGE_SRC (msg), structure);
+  gst_message_set_seqnum (new_msg, gst_message_get_seqnum (msg));
+  gst_message_unref (msg);
+
+  return new_msg;
+}
+
 static void
 handle_message (GstBin * bin, GstMessage * msg)
 {
@@ -2355,6 +2522,20 @@ handle_message (GstBin * bin, GstMessage * msg)
      * of the sorted list as a good redirection candidate. It can of course
      * choose something else from the list if it has a better way. */
     msg = handle_redirect_message (GST_URI_DECODE_BIN (bin), msg);
+  } else if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_BUFFERING) {
+    msg = handle_buffering_message (GST_URI_DECODE_BIN (bin), msg);
+  } else if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_STREAM_STATUS) {
+    GstURIDecodeBin *dec = GST_URI_DECODE_BIN (bin);
+    GstTaskPool *pool;
+
+    GST_OBJECT_LOCK (dec);
+    pool = dec->task_pool ? gst_object_ref (dec->task_pool) : NULL;
+    GST_OBJECT_UNLOCK (dec);
+
+    if (pool) {
+      gst_play_set_task_pool (msg, pool);
+      gst_object_unref (pool);
+    }
   }
   GST_BIN_CLASS (parent_class)->handle_message (bin, msg);
 }
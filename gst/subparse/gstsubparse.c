@@ -136,6 +136,11 @@ gst_sub_parse_dispose (GObject * object)
     subparse->textbuf = NULL;
   }
 
+  if (subparse->index) {
+    g_array_free (subparse->index, TRUE);
+    subparse->index = NULL;
+  }
+
   GST_CALL_PARENT (G_OBJECT_CLASS, dispose, (object));
 }
 
@@ -196,6 +201,7 @@ gst_sub_parse_init (GstSubParse * subparse)
   gst_element_add_pad (GST_ELEMENT (subparse), subparse->srcpad);
 
   subparse->textbuf = g_string_new (NULL);
+  subparse->index = g_array_new (FALSE, FALSE, sizeof (GstSubParseIndexEntry));
   subparse->parser_type = GST_SUB_PARSE_FORMAT_UNKNOWN;
   subparse->flushing = FALSE;
   gst_segment_init (&subparse->segment, GST_FORMAT_TIME);
@@ -212,6 +218,70 @@ gst_sub_parse_init (GstSubParse * subparse)
  * Source pad functions.
  */
 
+/* Cues can only be indexed if the input isn't converted, so that offsets in
+ * the text are offsets in the input, and if the parser doesn't carry any
+ * state from one cue to the next */
+static gboolean
+gst_sub_parse_can_index (GstSubParse * self)
+{
+  if (self->detected_encoding != NULL || !self->valid_utf8)
+    return FALSE;
+
+  switch (self->parser_type) {
+    case GST_SUB_PARSE_FORMAT_MDVDSUB:
+    case GST_SUB_PARSE_FORMAT_SUBRIP:
+    case GST_SUB_PARSE_FORMAT_MPL2:
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+static void
+gst_sub_parse_index_add (GstSubParse * self, GstClockTime time,
+    guint64 offset)
+{
+  GstSubParseIndexEntry entry;
+
+  if (!GST_CLOCK_TIME_IS_VALID (time) || !gst_sub_parse_can_index (self))
+    return;
+
+  GST_OBJECT_LOCK (self);
+  /* only extend the index, cues we've already seen are in it */
+  if (self->index->len == 0 || time > g_array_index (self->index,
+          GstSubParseIndexEntry, self->index->len - 1).time) {
+    entry.time = time;
+    entry.offset = offset;
+    g_array_append_val (self->index, entry);
+  }
+  GST_OBJECT_UNLOCK (self);
+}
+
+/* Returns the offset of the last indexed cue that starts at or before
+ * @time, or 0 */
+static guint64
+gst_sub_parse_index_lookup (GstSubParse * self, GstClockTime time)
+{
+  guint64 offset = 0;
+  guint lo, hi, mid;
+
+  GST_OBJECT_LOCK (self);
+  lo = 0;
+  hi = self->index->len;
+  while (lo < hi) {
+    mid = lo + (hi - lo) / 2;
+    if (g_array_index (self->index, GstSubParseIndexEntry, mid).time <= time)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (lo > 0)
+    offset = g_array_index (self->index, GstSubParseIndexEntry, lo - 1).offset;
+  GST_OBJECT_UNLOCK (self);
+
+  return offset;
+}
+
 static gboolean
 gst_sub_parse_src_query (GstPad * pad, GstObject * parent, GstQuery * query)
 {
@@ -278,6 +348,7 @@ gst_sub_parse_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
       gint64 start, stop;
       gdouble rate;
       gboolean update;
+      guint64 offset = 0;
 
       gst_event_parse_seek (event, &rate, &format, &flags,
           &start_type, &start, &stop_type, &stop);
@@ -288,11 +359,17 @@ gst_sub_parse_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
         goto beach;
       }
 
-      /* Convert that seek to a seeking in bytes at position 0,
-         FIXME: could use an index */
+      /* Convert that seek to a seeking in bytes, at the start of the last
+       * cue we know of before the requested position or at position 0 */
+      if (start_type == GST_SEEK_TYPE_SET && start > 0)
+        offset = gst_sub_parse_index_lookup (self, start);
+
+      GST_DEBUG_OBJECT (self, "seeking to byte offset %" G_GUINT64_FORMAT,
+          offset);
+
       ret = gst_pad_push_event (self->sinkpad,
           gst_event_new_seek (rate, GST_FORMAT_BYTES, flags,
-              GST_SEEK_TYPE_SET, 0, GST_SEEK_TYPE_NONE, 0));
+              GST_SEEK_TYPE_SET, offset, GST_SEEK_TYPE_NONE, 0));
 
       if (ret) {
         /* Apply the seek to our segment */
@@ -304,7 +381,8 @@ gst_sub_parse_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
 
         self->need_segment = TRUE;
       } else {
-        GST_WARNING_OBJECT (self, "seek to 0 bytes failed");
+        GST_WARNING_OBJECT (self, "seek to %" G_GUINT64_FORMAT " bytes failed",
+            offset);
       }
 
       gst_event_unref (event);
@@ -521,11 +599,14 @@ static gchar *
 get_next_line (GstSubParse * self)
 {
   char *line = NULL;
-  const char *line_end;
+  const char *line_start, *line_end;
   int line_len;
   gboolean have_r = FALSE;
 
-  line_end = strchr (self->textbuf->str, '\n');
+  /* lines are only consumed by moving textbuf_pos forward, the text
+   * before it is dropped in one go when more data is added */
+  line_start = self->textbuf->str + self->textbuf_pos;
+  line_end = strchr (line_start, '\n');
 
   if (!line_end) {
     /* end-of-line not found; return for more data */
@@ -533,15 +614,15 @@ get_next_line (GstSubParse * self)
   }
 
   /* get rid of '\r' */
-  if (line_end != self->textbuf->str && *(line_end - 1) == '\r') {
+  if (line_end != line_start && *(line_end - 1) == '\r') {
     line_end--;
     have_r = TRUE;
   }
 
-  line_len = line_end - self->textbuf->str;
-  line = g_strndup (self->textbuf->str, line_len);
-  self->textbuf = g_string_erase (self->textbuf, 0,
-      line_len + (have_r ? 2 : 1));
+  line_len = line_end - line_start;
+  line = g_strndup (line_start, line_len);
+  self->textbuf_pos += line_len + (have_r ? 2 : 1);
+  self->text_offset += line_len + (have_r ? 2 : 1);
   return line;
 }
 
@@ -1322,7 +1403,7 @@ gst_sub_parse_format_autodetect (GstSubParse * self)
   gchar *data;
   GstSubParseFormat format;
 
-  if (strlen (self->textbuf->str) < 30) {
+  if (self->textbuf->len < 30) {
     GST_DEBUG ("File too small to be a subtitles file");
     return NULL;
   }
@@ -1408,6 +1489,8 @@ feed_textbuf (GstSubParse * self, GstBuffer * buf)
     /* flush the parser state */
     parser_state_init (&self->state);
     g_string_truncate (self->textbuf, 0);
+    self->textbuf_pos = 0;
+    self->text_offset = self->cue_offset = self->offset;
     gst_adapter_clear (self->adapter);
 #ifndef GST_DISABLE_XML
     if (self->parser_type == GST_SUB_PARSE_FORMAT_SAMI)
@@ -1427,6 +1510,12 @@ feed_textbuf (GstSubParse * self, GstBuffer * buf)
   input = convert_encoding (self, (const gchar *) data, avail, &consumed);
 
   if (input && consumed > 0) {
+    /* drop the lines that were already parsed, this leaves at most a
+     * partial line to move */
+    if (self->textbuf_pos > 0) {
+      self->textbuf = g_string_erase (self->textbuf, 0, self->textbuf_pos);
+      self->textbuf_pos = 0;
+    }
     self->textbuf = g_string_append (self->textbuf, input);
     gst_adapter_unmap (self->adapter);
     gst_adapter_flush (self->adapter, consumed);
@@ -1514,6 +1603,10 @@ handle_buffer (GstSubParse * self, GstBuffer * buf)
       GST_BUFFER_TIMESTAMP (buf) = self->state.start_time;
       GST_BUFFER_DURATION (buf) = self->state.duration;
 
+      /* the next cue starts after the line that completed this one */
+      gst_sub_parse_index_add (self, self->state.start_time, self->cue_offset);
+      self->cue_offset = self->text_offset;
+
       /* in some cases (e.g. tmplayer) we can only determine the duration
        * of a text chunk from the timestamp of the next text chunk; in those
        * cases, we probably want to limit the duration to something
@@ -1651,7 +1744,12 @@ gst_sub_parse_change_state (GstElement * element, GstStateChange transition)
       g_free (self->detected_encoding);
       self->detected_encoding = NULL;
       g_string_truncate (self->textbuf, 0);
+      self->textbuf_pos = 0;
+      self->text_offset = self->cue_offset = 0;
       gst_adapter_clear (self->adapter);
+      GST_OBJECT_LOCK (self);
+      g_array_set_size (self->index, 0);
+      GST_OBJECT_UNLOCK (self);
       break;
     default:
       break;
@@ -72,6 +72,11 @@ typedef struct {
 
 typedef gchar* (*Parser) (ParserState *state, const gchar *line);
 
+typedef struct {
+  GstClockTime time;
+  guint64      offset;
+} GstSubParseIndexEntry;
+
 struct _GstSubParse {
   GstElement element;
 
@@ -81,6 +86,10 @@ struct _GstSubParse {
   GstAdapter *adapter;
   /* contains the UTF-8 decoded input */
   GString *textbuf;
+  /* start of the text in textbuf that wasn't split into lines yet */
+  gsize textbuf_pos;
+  /* input offset of textbuf_pos, only meaningful for unconverted input */
+  guint64 text_offset;
 
   GstSubParseFormat parser_type;
   gboolean parser_detected;
@@ -91,6 +100,12 @@ struct _GstSubParse {
 
   /* seek */
   guint64 offset;
+
+  /* cue start times and their input offsets, built while parsing and
+   * protected by the object lock */
+  GArray *index;
+  /* input offset where the cue being parsed started */
+  guint64 cue_offset;
   
   /* Segment */
   GstSegment    segment;
@@ -114,9 +114,11 @@
 #endif
 
 #include <string.h>
+#include <limits.h>
 #include <fcntl.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/stat.h>
 #include <netinet/in.h>
 
@@ -124,8 +126,23 @@
 #include <sys/filio.h>
 #endif
 
+#ifdef HAVE_SYS_SENDFILE_H
+#include <sys/sendfile.h>
+#include <signal.h>
+#include <pthread.h>
+#endif
+
+#include <gst/allocators/allocators.h>
+
 #include "gstmultifdsink.h"
 
+/* buffers written with one writev() or sendmsg() */
+#if defined(IOV_MAX) && IOV_MAX < GST_MULTI_HANDLE_SINK_MAX_VECTORS
+#define MAX_VECTORS IOV_MAX
+#else
+#define MAX_VECTORS GST_MULTI_HANDLE_SINK_MAX_VECTORS
+#endif
+
 #define NOT_IMPLEMENTED 0
 
 GST_DEBUG_CATEGORY_STATIC (multifdsink_debug);
@@ -541,6 +558,7 @@ gst_multi_fd_sink_new_client (GstMultiHandleSink * mhsink,
   if (fstat (handle.fd, &statbuf) == 0 && S_ISSOCK (statbuf.st_mode)) {
     client->is_socket = TRUE;
     gst_multi_handle_sink_setup_dscp_client (mhsink, mhclient);
+    gst_multi_handle_sink_setup_tcp_client (mhsink, mhclient);
   }
 
   return mhclient;
@@ -620,10 +638,12 @@ gst_multi_fd_sink_handle_client_read (GstMultiFdSink * sink,
           mhclient->debug, to_read);
 
       nread = read (fd, dummy, to_read);
-      if (nread < -1) {
+      if (nread < 0) {
         GST_WARNING_OBJECT (sink, "%s could not read %d bytes: %s (%d)",
             mhclient->debug, to_read, g_strerror (errno), errno);
-        mhclient->status = GST_CLIENT_STATUS_ERROR;
+        /* kernel TLS fails reads of the close_notify alert of the peer */
+        mhclient->status = mhclient->ktls ? GST_CLIENT_STATUS_CLOSED :
+            GST_CLIENT_STATUS_ERROR;
         ret = FALSE;
         break;
       } else if (nread == 0) {
@@ -649,6 +669,152 @@ ioctl_failed:
   }
 }
 
+/* Writes as many of the buffers that are waiting for @client as the batch
+ * size and the pacing @budget allow with one system call. Returns what
+ * write() returns and sets @maxsize to the number of bytes that were tried. */
+static ssize_t
+gst_multi_fd_sink_send_vectors (GstMultiFdSink * sink, GstTCPClient * client,
+    gssize budget, gssize * maxsize)
+{
+  GstMultiHandleSink *mhsink = GST_MULTI_HANDLE_SINK (sink);
+  GstMultiHandleClient *mhclient = (GstMultiHandleClient *) client;
+  int fd = mhclient->handle.fd;
+  struct iovec vecs[MAX_VECTORS];
+  GstBuffer *bufs[MAX_VECTORS];
+  GstMapInfo maps[MAX_VECTORS];
+  guint n_bufs;
+  gint i, n_vecs, errsv, flags;
+  ssize_t wrote;
+
+  n_bufs =
+      gst_multi_handle_sink_client_get_buffers (mhsink, mhclient, bufs,
+      MAX_VECTORS);
+
+  *maxsize = 0;
+  for (n_vecs = 0; n_vecs < (gint) n_bufs;) {
+    gsize offset = n_vecs == 0 ? mhclient->bufoffset : 0;
+
+    if (!gst_buffer_map (bufs[n_vecs], &maps[n_vecs], GST_MAP_READ))
+      break;
+
+    vecs[n_vecs].iov_base = maps[n_vecs].data + offset;
+    vecs[n_vecs].iov_len = maps[n_vecs].size - offset;
+    *maxsize += vecs[n_vecs].iov_len;
+    n_vecs++;
+
+    if (*maxsize >= budget) {
+      vecs[n_vecs - 1].iov_len -= *maxsize - budget;
+      *maxsize = budget;
+      break;
+    }
+  }
+  if (n_vecs == 0) {
+    errno = EFAULT;
+    g_return_val_if_reached (-1);
+  }
+
+  /* FIXME: specific */
+  /* try to write all of the buffers */
+#ifdef MSG_NOSIGNAL
+#define FLAGS MSG_NOSIGNAL
+#else
+#define FLAGS 0
+#endif
+  if (client->is_socket) {
+    struct msghdr msg = { 0, };
+
+    flags = FLAGS;
+#ifdef MSG_MORE
+    /* paced clients have to send what they can right away */
+    if (budget == G_MAXSSIZE &&
+        gst_multi_handle_sink_client_has_more (mhsink, mhclient, n_vecs))
+      flags |= MSG_MORE;
+#endif
+
+    msg.msg_iov = vecs;
+    msg.msg_iovlen = n_vecs;
+    wrote = sendmsg (fd, &msg, flags);
+  } else {
+    wrote = writev (fd, vecs, n_vecs);
+  }
+  errsv = errno;
+
+  for (i = 0; i < n_vecs; i++)
+    gst_buffer_unmap (bufs[i], &maps[i]);
+
+  errno = errsv;
+
+  return wrote;
+}
+
+#ifdef HAVE_SYS_SENDFILE_H
+/* When the first buffer for @client is backed by a file descriptor, the
+ * data is sent with sendfile() and does not have to be copied through
+ * userspace. Returns FALSE when the buffer has to be written normally. */
+static gboolean
+gst_multi_fd_sink_send_file (GstMultiFdSink * sink, GstTCPClient * client,
+    gssize budget, gssize * maxsize, ssize_t * wrote)
+{
+  GstMultiHandleClient *mhclient = (GstMultiHandleClient *) client;
+  GstBuffer *head;
+  GstMemory *mem;
+  off_t offset;
+  sigset_t sigpipe, pending, oldmask;
+  gboolean was_pending;
+  gint errsv;
+
+  if (!sink->use_sendfile || !client->is_socket)
+    return FALSE;
+
+  if (!gst_multi_handle_sink_client_get_buffers (GST_MULTI_HANDLE_SINK (sink),
+          mhclient, &head, 1))
+    return FALSE;
+  if (gst_buffer_n_memory (head) != 1)
+    return FALSE;
+
+  mem = gst_buffer_peek_memory (head, 0);
+  if (!gst_is_dmabuf_memory (mem))
+    return FALSE;
+
+  offset = mem->offset + mhclient->bufoffset;
+  *maxsize = MIN (mem->size - mhclient->bufoffset, budget);
+
+  /* sendfile() has no MSG_NOSIGNAL, block SIGPIPE for this thread while
+   * writing to a client that went away and discard the signal it raised,
+   * unless one was already pending before */
+  sigemptyset (&sigpipe);
+  sigaddset (&sigpipe, SIGPIPE);
+  sigpending (&pending);
+  was_pending = sigismember (&pending, SIGPIPE);
+  pthread_sigmask (SIG_BLOCK, &sigpipe, &oldmask);
+
+  *wrote = sendfile (mhclient->handle.fd, gst_dmabuf_memory_get_fd (mem),
+      &offset, *maxsize);
+  errsv = errno;
+
+  if (*wrote < 0 && errsv == EPIPE && !was_pending) {
+    struct timespec nowait = { 0, 0 };
+
+    while (sigtimedwait (&sigpipe, NULL, &nowait) < 0 && errno == EINTR)
+      continue;
+  }
+  pthread_sigmask (SIG_SETMASK, &oldmask, NULL);
+  errno = errsv;
+
+  if (*wrote < 0 && (errno == EINVAL || errno == ENOSYS)) {
+    /* not all kinds of file descriptors can be used, don't try again */
+    GST_INFO_OBJECT (sink, "sendfile not possible: %s", g_strerror (errno));
+    sink->use_sendfile = FALSE;
+    return FALSE;
+  }
+
+  GST_LOG_OBJECT (sink, "%s sendfile of %" G_GSSIZE_FORMAT " bytes",
+      mhclient->debug, *maxsize);
+
+  return TRUE;
+}
+#endif
+
 /* Handle a write on a client,
  * which indicates a read request from a client.
  *
@@ -659,12 +825,12 @@ ioctl_failed:
  *
  * Then we run into the main loop that tries to send as many buffers as
  * possible. It will first exhaust the mhclient->sending queue and if the queue
- * is empty, it will pick a buffer from the global queue.
+ * is empty, it will send the buffers of the global queue from the position
+ * of the client.
  *
- * Sending the buffers from the mhclient->sending queue is basically writing
- * the bytes to the socket and maintaining a count of the bytes that were
- * sent. When the buffer is completely sent, it is removed from the
- * mhclient->sending queue and we try to pick a new buffer for sending.
+ * Sending the buffers is basically writing the bytes to the socket and
+ * maintaining a count of the bytes that were sent. When a buffer is
+ * completely sent, the client moves on to the next one.
  *
  * When the sending returns a partial buffer we stop sending more data as
  * the next send operation could block.
@@ -680,10 +846,7 @@ gst_multi_fd_sink_handle_client_write (GstMultiFdSink * sink,
   GstClockTime now;
   GTimeVal nowtv;
   GstMultiHandleSink *mhsink = GST_MULTI_HANDLE_SINK (sink);
-  GstMultiHandleSinkClass *mhsinkclass =
-      GST_MULTI_HANDLE_SINK_GET_CLASS (mhsink);
   GstMultiHandleClient *mhclient = (GstMultiHandleClient *) client;
-  int fd = mhclient->handle.fd;
 
   g_get_current_time (&nowtv);
   now = GST_TIMEVAL_TO_TIME (nowtv);
@@ -692,9 +855,9 @@ gst_multi_fd_sink_handle_client_write (GstMultiFdSink * sink,
 
   more = TRUE;
   do {
-    gint maxsize;
+    gssize maxsize;
 
-    if (!mhclient->sending) {
+    if (!mhclient->sending && mhclient->bufoffset == 0) {
       /* client is not working on a buffer */
       if (mhclient->bufpos == -1) {
         /* client is too fast, remove from write queue until new buffer is
@@ -708,10 +871,6 @@ gst_multi_fd_sink_handle_client_write (GstMultiFdSink * sink,
 
         return TRUE;
       } else {
-        /* client can pick a buffer from the global queue */
-        GstBuffer *buf;
-        GstClockTime timestamp;
-
         /* for new connections, we need to find a good spot in the
          * bufqueue to start streaming from */
         if (mhclient->new_connection && !flushing) {
@@ -733,67 +892,41 @@ gst_multi_fd_sink_handle_client_write (GstMultiFdSink * sink,
         /* we flushed all remaining buffers, no need to get a new one */
         if (mhclient->flushcount == 0)
           goto flushed;
-
-        /* grab buffer */
-        buf = g_array_index (mhsink->bufqueue, GstBuffer *, mhclient->bufpos);
-        mhclient->bufpos--;
-
-        /* update stats */
-        timestamp = GST_BUFFER_TIMESTAMP (buf);
-        if (mhclient->first_buffer_ts == GST_CLOCK_TIME_NONE)
-          mhclient->first_buffer_ts = timestamp;
-        if (timestamp != -1)
-          mhclient->last_buffer_ts = timestamp;
-
-        /* decrease flushcount */
-        if (mhclient->flushcount != -1)
-          mhclient->flushcount--;
-
-        GST_LOG_OBJECT (sink, "%s client %p at position %d",
-            mhclient->debug, client, mhclient->bufpos);
-
-        /* queueing a buffer will ref it */
-        mhsinkclass->client_queue_buffer (mhsink, mhclient, buf);
-
-        /* need to start from the first byte for this new buffer */
-        mhclient->bufoffset = 0;
       }
     }
 
-    /* see if we need to send something */
-    if (mhclient->sending) {
+    /* send the buffers that are next for the client */
+    {
       ssize_t wrote;
-      GstBuffer *head;
-      GstMapInfo info;
-      guint8 *data;
+      gssize budget;
+      GstClockTime wait;
 
-      /* pick first buffer from list */
-      head = GST_BUFFER (mhclient->sending->data);
+      budget =
+          gst_multi_handle_sink_client_pacing_budget (mhsink, mhclient, &wait);
+      if (budget == 0) {
+        /* the client sent enough for now, stop polling it for writing
+         * until it can continue */
+        gint64 wakeup = g_get_monotonic_time () + wait / GST_USECOND;
 
-      if (!gst_buffer_map (head, &info, GST_MAP_READ))
-        g_return_val_if_reached (FALSE);
-
-      data = info.data;
-      maxsize = info.size - mhclient->bufoffset;
-
-      /* FIXME: specific */
-      /* try to write the complete buffer */
-#ifdef MSG_NOSIGNAL
-#define FLAGS MSG_NOSIGNAL
-#else
-#define FLAGS 0
-#endif
-      if (client->is_socket) {
-        wrote = send (fd, data + mhclient->bufoffset, maxsize, FLAGS);
-      } else {
-        wrote = write (fd, data + mhclient->bufoffset, maxsize);
+        gst_poll_fd_ctl_write (sink->fdset, &client->gfd, FALSE);
+        client->paced = TRUE;
+        if (sink->pacing_wakeup == -1 || wakeup < sink->pacing_wakeup)
+          sink->pacing_wakeup = wakeup;
+        return TRUE;
       }
-      gst_buffer_unmap (head, &info);
+#ifdef HAVE_SYS_SENDFILE_H
+      if (!gst_multi_fd_sink_send_file (sink, client, budget, &maxsize,
+              &wrote))
+#endif
+        wrote =
+            gst_multi_fd_sink_send_vectors (sink, client, budget, &maxsize);
+      mhclient->writes++;
 
       if (wrote < 0) {
         /* hmm error.. */
         if (errno == EAGAIN) {
           /* nothing serious, resource was unavailable, try again later */
+          mhclient->writes_would_block++;
           more = FALSE;
         } else if (errno == ECONNRESET) {
           goto connection_reset;
@@ -807,15 +940,12 @@ gst_multi_fd_sink_handle_client_write (GstMultiFdSink * sink,
           GST_LOG_OBJECT (sink,
               "partial write on %s of %" G_GSSIZE_FORMAT " bytes",
               mhclient->debug, wrote);
-          mhclient->bufoffset += wrote;
           more = FALSE;
-        } else {
-          /* complete buffer was written, we can proceed to the next one */
-          mhclient->sending = g_slist_remove (mhclient->sending, head);
-          gst_buffer_unref (head);
-          /* make sure we start from byte 0 for the next buffer */
-          mhclient->bufoffset = 0;
         }
+        /* drop the buffers that were written completely */
+        gst_multi_handle_sink_client_consume (mhsink, mhclient, wrote);
+        gst_multi_handle_sink_client_pacing_sent (mhsink, mhclient, wrote);
+
         /* update stats */
         mhclient->bytes_sent += wrote;
         mhclient->last_activity_time = now;
@@ -860,6 +990,42 @@ gst_multi_fd_sink_hash_adding (GstMultiHandleSink * mhsink,
   gst_poll_fd_ctl_write (sink->fdset, &client->gfd, TRUE);
 }
 
+/* Polls the paced clients for writing again when their time has come and
+ * returns how long the poll can wait for the next paced client. */
+static GstClockTime
+gst_multi_fd_sink_resume_paced (GstMultiFdSink * sink)
+{
+  GstMultiHandleSink *mhsink = GST_MULTI_HANDLE_SINK (sink);
+  GList *clients;
+  gint64 now;
+
+  CLIENTS_LOCK (mhsink);
+  if (sink->pacing_wakeup == -1) {
+    CLIENTS_UNLOCK (mhsink);
+    return GST_CLOCK_TIME_NONE;
+  }
+
+  now = g_get_monotonic_time ();
+  if (now < sink->pacing_wakeup) {
+    CLIENTS_UNLOCK (mhsink);
+    return (sink->pacing_wakeup - now) * GST_USECOND;
+  }
+
+  /* clients that still cannot send pause themselves again */
+  sink->pacing_wakeup = -1;
+  for (clients = mhsink->clients; clients; clients = clients->next) {
+    GstTCPClient *client = clients->data;
+
+    if (client->paced) {
+      client->paced = FALSE;
+      gst_poll_fd_ctl_write (sink->fdset, &client->gfd, TRUE);
+    }
+  }
+  CLIENTS_UNLOCK (mhsink);
+
+  return GST_CLOCK_TIME_NONE;
+}
+
 static void
 gst_multi_fd_sink_hash_removing (GstMultiHandleSink * mhsink,
     GstMultiHandleClient * mhclient)
@@ -888,6 +1054,7 @@ gst_multi_fd_sink_handle_clients (GstMultiFdSink * sink)
   GstMultiFdSinkClass *fclass;
   guint cookie;
   GstMultiHandleSink *mhsink = GST_MULTI_HANDLE_SINK (sink);
+  GstClockTime timeout;
   int fd;
 
 
@@ -902,9 +1069,12 @@ gst_multi_fd_sink_handle_clients (GstMultiFdSink * sink)
      * - client socket output (ie, client reads)          */
     GST_LOG_OBJECT (sink, "waiting on action on fdset");
 
-    result =
-        gst_poll_wait (sink->fdset,
-        mhsink->timeout != 0 ? mhsink->timeout : GST_CLOCK_TIME_NONE);
+    timeout = gst_multi_fd_sink_resume_paced (sink);
+    if (mhsink->timeout != 0 && (timeout == GST_CLOCK_TIME_NONE
+            || mhsink->timeout < timeout))
+      timeout = mhsink->timeout;
+
+    result = gst_poll_wait (sink->fdset, timeout);
 
     /* Handle the special case in which the sink is not receiving more buffers
      * and will not disconnect inactive client in the streaming thread. */
@@ -1106,6 +1276,9 @@ gst_multi_fd_sink_start_pre (GstMultiHandleSink * mhsink)
   if ((mfsink->fdset = gst_poll_new (TRUE)) == NULL)
     goto socket_pair;
 
+  mfsink->use_sendfile = TRUE;
+  mfsink->pacing_wakeup = -1;
+
   return TRUE;
 
   /* ERRORS */
@@ -55,6 +55,7 @@ typedef struct {
   GstPollFD gfd;
 
   gboolean is_socket;
+  gboolean paced;       /* not polled for writing until pacing_wakeup */
 } GstTCPClient;
 
 /**
@@ -69,6 +70,9 @@ struct _GstMultiFdSink {
   GstPoll *fdset;
 
   gboolean handle_read;
+  gboolean use_sendfile;
+
+  gint64 pacing_wakeup; /* monotonic time to resume paced clients, or -1 */
 };
 
 struct _GstMultiFdSinkClass {
@@ -104,6 +104,8 @@
 #include "config.h"
 #endif
 
+#include <string.h>
+
 #include <gst/gst-i18n-plugin.h>
 
 #include "gstmultihandlesink.h"
@@ -114,6 +116,7 @@
 
 #ifndef G_OS_WIN32
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #endif
 
 #define NOT_IMPLEMENTED 0
@@ -165,6 +168,20 @@ enum
 
 #define DEFAULT_RESEND_STREAMHEADER      TRUE
 
+#define DEFAULT_SEND_BATCH_BYTES        65536
+#define DEFAULT_PACING                  FALSE
+#define DEFAULT_PACING_BITRATE          0
+#define DEFAULT_STATS_INTERVAL          0
+#define DEFAULT_NOTSENT_LOWAT           0
+#define DEFAULT_CORK                    FALSE
+
+/* amount of time a paced client can send ahead */
+#define PACING_BURST                    (20 * G_TIME_SPAN_MILLISECOND)
+/* a measured stream bitrate is increased by this factor so that clients
+ * can keep up with variations of the bitrate */
+#define PACING_HEADROOM_N               5
+#define PACING_HEADROOM_D               4
+
 enum
 {
   PROP_0,
@@ -196,6 +213,16 @@ enum
 
   PROP_RESEND_STREAMHEADER,
 
+  PROP_SEND_BATCH_BYTES,
+
+  PROP_PACING,
+  PROP_PACING_BITRATE,
+
+  PROP_STATS_INTERVAL,
+
+  PROP_NOTSENT_LOWAT,
+  PROP_CORK,
+
   PROP_NUM_HANDLES,
 
   PROP_LAST
@@ -282,10 +309,12 @@ static void gst_multi_handle_sink_clear (GstMultiHandleSink * mhsink);
 
 static GstFlowReturn gst_multi_handle_sink_render (GstBaseSink * bsink,
     GstBuffer * buf);
-static void gst_multi_handle_sink_queue_buffer (GstMultiHandleSink * mhsink,
-    GstBuffer * buffer);
-static gboolean gst_multi_handle_sink_client_queue_buffer (GstMultiHandleSink *
-    mhsink, GstMultiHandleClient * mhclient, GstBuffer * buffer);
+static GstFlowReturn gst_multi_handle_sink_render_list (GstBaseSink * bsink,
+    GstBufferList * list);
+static gboolean gst_multi_handle_sink_queue_buffer (GstMultiHandleSink *
+    mhsink, GstBuffer * buffer);
+static void gst_multi_handle_sink_client_queue_streamheader (GstMultiHandleSink
+    * mhsink, GstMultiHandleClient * mhclient);
 static GstStateChangeReturn gst_multi_handle_sink_change_state (GstElement *
     element, GstStateChange transition);
 
@@ -311,11 +340,33 @@ static gint
 gst_multi_handle_sink_recover_client (GstMultiHandleSink * sink,
     GstMultiHandleClient * client);
 static void gst_multi_handle_sink_setup_dscp (GstMultiHandleSink * mhsink);
+static void gst_multi_handle_sink_setup_tcp (GstMultiHandleSink * mhsink);
 static gboolean
 find_limits (GstMultiHandleSink * sink,
     gint * min_idx, gint bytes_min, gint buffers_min, gint64 time_min,
     gint * max_idx, gint bytes_max, gint buffers_max, gint64 time_max);
 
+/* The queue is a ring that is shared by all clients, the clients only keep
+ * their position in it. Buffers get a sequence number in the order they are
+ * queued and are stored in the ring at that sequence number, position 0 is
+ * the newest buffer. Next to the buffer, an entry keeps the amount of bytes
+ * and the timestamp at which the buffer was queued, the sequence numbers of
+ * the sync frames are kept in a sorted array. This makes it possible to find
+ * positions in the queue with a binary search. */
+struct _GstMultiHandleSinkQueueEntry
+{
+  GstBuffer *buffer;
+  guint64 offset;               /* bytes queued before this buffer */
+  GstClockTime time;            /* timestamp, or the last one before it */
+  gint64 queued;                /* monotonic time when it was queued */
+};
+
+#define POS_TO_SEQ(s,pos)       ((s)->index_seq - 1 - (pos))
+#define SEQ_TO_POS(s,seq)       ((gint) ((s)->index_seq - 1 - (seq)))
+#define QUEUE_ENTRY(s,pos) \
+    (&(s)->queue[POS_TO_SEQ (s, pos) & ((s)->queue_size - 1)])
+#define QUEUE_BUFFER(s,pos)     (QUEUE_ENTRY (s, pos)->buffer)
+
 
 static void
 gst_multi_handle_sink_class_init (GstMultiHandleSinkClass * klass)
@@ -441,6 +492,101 @@ gst_multi_handle_sink_class_init (GstMultiHandleSinkClass * klass)
           DEFAULT_RESEND_STREAMHEADER,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstMultiHandleSink:send-batch-bytes:
+   *
+   * Queued buffers are sent to a client with one system call until this
+   * amount of bytes is reached. This avoids a system call per buffer when
+   * streaming small buffers. 0 sends one buffer at a time.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_SEND_BATCH_BYTES,
+      g_param_spec_uint ("send-batch-bytes", "Send batch bytes",
+          "Maximum number of bytes to send to a client with one system call "
+          "(0 = one buffer at a time)", 0, G_MAXUINT, DEFAULT_SEND_BATCH_BYTES,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstMultiHandleSink:pacing:
+   *
+   * Spread out the data sent to each client over time at
+   * #GstMultiHandleSink:pacing-bitrate instead of sending it as fast as the
+   * network allows. This avoids bursts that overflow the buffers of routers
+   * on the path to the client. Where supported, the rate is also set on the
+   * socket with SO_MAX_PACING_RATE.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_PACING,
+      g_param_spec_boolean ("pacing", "Pacing",
+          "Pace the data sent to clients", DEFAULT_PACING,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstMultiHandleSink:pacing-bitrate:
+   *
+   * The bitrate at which the data is sent to clients when
+   * #GstMultiHandleSink:pacing is enabled. When 0, the average bitrate of the
+   * stream is measured from the buffer timestamps and clients are paced
+   * slightly above it.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_PACING_BITRATE,
+      g_param_spec_uint ("pacing-bitrate", "Pacing bitrate",
+          "Bitrate in bits per second to pace clients at "
+          "(0 = measure the stream bitrate)", 0, G_MAXUINT,
+          DEFAULT_PACING_BITRATE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstMultiHandleSink:stats-interval:
+   *
+   * When not 0, an element message named "multihandlesink-stats" is posted
+   * on the bus at this interval. It contains the number of queued buffers
+   * in "buffers-queued", the total amount of bytes sent in "bytes-served"
+   * and an array of the stats of each client in "clients", that have the
+   * same fields as the structure that the get-stats signal returns and the
+   * client in "client". The message is posted from the streaming thread
+   * when a buffer is queued.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_STATS_INTERVAL,
+      g_param_spec_uint64 ("stats-interval", "Stats interval",
+          "Interval in nanoseconds to post messages with client statistics "
+          "(0 = disabled)", 0, G_MAXUINT64, DEFAULT_STATS_INTERVAL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstMultiHandleSink:notsent-lowat:
+   *
+   * Limit the amount of unsent data in the kernel send buffer of TCP
+   * clients to this amount of bytes with TCP_NOTSENT_LOWAT. The data stays
+   * in the queue of the sink instead, where the sync and recovery methods
+   * can still act on it, which keeps the latency of live streams low.
+   * 0 uses the system default. Ignored where not supported.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_NOTSENT_LOWAT,
+      g_param_spec_uint ("notsent-lowat", "Not sent low watermark",
+          "Maximum number of unsent bytes in the send buffer of TCP clients "
+          "(0 = system default)", 0, G_MAXINT, DEFAULT_NOTSENT_LOWAT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstMultiHandleSink:cork:
+   *
+   * Tell the kernel that more data follows when the queued data for a
+   * client does not fit in one system call, so that full packets are sent
+   * (MSG_MORE). Not used for paced clients. Ignored where not supported.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_CORK,
+      g_param_spec_boolean ("cork", "Cork",
+          "Only send full packets when more data is queued for a client",
+          DEFAULT_CORK, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   g_object_class_install_property (gobject_class, PROP_NUM_HANDLES,
       g_param_spec_uint ("num-handles", "Number of handles",
           "The current number of client handles",
@@ -474,8 +620,8 @@ gst_multi_handle_sink_class_init (GstMultiHandleSinkClass * klass)
       GST_DEBUG_FUNCPTR (gst_multi_handle_sink_change_state);
 
   gstbasesink_class->render = GST_DEBUG_FUNCPTR (gst_multi_handle_sink_render);
-  klass->client_queue_buffer =
-      GST_DEBUG_FUNCPTR (gst_multi_handle_sink_client_queue_buffer);
+  gstbasesink_class->render_list =
+      GST_DEBUG_FUNCPTR (gst_multi_handle_sink_render_list);
 
 #if 0
   klass->add = GST_DEBUG_FUNCPTR (gst_multi_handle_sink_add);
@@ -496,9 +642,14 @@ gst_multi_handle_sink_init (GstMultiHandleSink * this)
   GST_OBJECT_FLAG_UNSET (this, GST_MULTI_HANDLE_SINK_OPEN);
 
   CLIENTS_LOCK_INIT (this);
+  g_mutex_init (&this->addlock);
   this->clients = NULL;
 
-  this->bufqueue = g_array_new (FALSE, TRUE, sizeof (GstBuffer *));
+  this->queue = NULL;
+  this->queue_size = 0;
+  this->queue_len = 0;
+  this->syncframes = g_array_new (FALSE, FALSE, sizeof (guint64));
+  this->index_time = GST_CLOCK_TIME_NONE;
   this->unit_format = DEFAULT_UNIT_FORMAT;
   this->units_max = DEFAULT_UNITS_MAX;
   this->units_soft_max = DEFAULT_UNITS_SOFT_MAX;
@@ -516,6 +667,13 @@ gst_multi_handle_sink_init (GstMultiHandleSink * this)
   this->qos_dscp = DEFAULT_QOS_DSCP;
 
   this->resend_streamheader = DEFAULT_RESEND_STREAMHEADER;
+  this->send_batch_bytes = DEFAULT_SEND_BATCH_BYTES;
+  this->pacing = DEFAULT_PACING;
+  this->pacing_bitrate = DEFAULT_PACING_BITRATE;
+  this->pacing_start_time = GST_CLOCK_TIME_NONE;
+  this->stats_interval = DEFAULT_STATS_INTERVAL;
+  this->notsent_lowat = DEFAULT_NOTSENT_LOWAT;
+  this->cork = DEFAULT_CORK;
 }
 
 static void
@@ -526,7 +684,9 @@ gst_multi_handle_sink_finalize (GObject * object)
   this = GST_MULTI_HANDLE_SINK (object);
 
   CLIENTS_LOCK_CLEAR (this);
-  g_array_free (this->bufqueue, TRUE);
+  g_mutex_clear (&this->addlock);
+  g_free (this->queue);
+  g_array_free (this->syncframes, TRUE);
   g_hash_table_destroy (this->handle_hash);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
@@ -612,9 +772,18 @@ gst_multi_handle_sink_client_init (GstMultiHandleClient * client,
   client->sending = NULL;
   client->bytes_sent = 0;
   client->dropped_buffers = 0;
-  client->avg_queue_size = 0;
+  client->writes = 0;
+  client->writes_would_block = 0;
+  client->queue_size_sum = 0;
+  client->queue_size_samples = 0;
+  client->max_queue_size = 0;
+  memset (client->latency, 0, sizeof (client->latency));
   client->first_buffer_ts = GST_CLOCK_TIME_NONE;
   client->last_buffer_ts = GST_CLOCK_TIME_NONE;
+  client->pacing_rate = 0;
+  client->pacing_time = 0;
+  client->pacing_socket_rate = 0;
+  client->ktls = FALSE;
   client->new_connection = TRUE;
   client->sync_method = sync_method;
   client->currently_removing = FALSE;
@@ -643,6 +812,63 @@ gst_multi_handle_sink_setup_dscp (GstMultiHandleSink * mhsink)
   CLIENTS_UNLOCK (mhsink);
 }
 
+/* Applies the TCP options to the socket of @client and checks if kernel TLS
+ * was configured on it. Sockets with kernel TLS are encrypted in the kernel
+ * when they are written to, also with sendfile(), but reads fail on TLS
+ * control records. */
+void
+gst_multi_handle_sink_setup_tcp_client (GstMultiHandleSink * sink,
+    GstMultiHandleClient * client)
+{
+#ifdef HAVE_SYS_SOCKET_H
+  GstMultiHandleSinkClass *mhsinkclass = GST_MULTI_HANDLE_SINK_GET_CLASS (sink);
+  int fd;
+
+  fd = mhsinkclass->client_get_fd (client);
+
+#ifdef TCP_NOTSENT_LOWAT
+  if (sink->notsent_lowat > 0) {
+    gint lowat = sink->notsent_lowat;
+
+    if (setsockopt (fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, &lowat,
+            sizeof (lowat)) < 0)
+      GST_DEBUG_OBJECT (sink, "%s could not set not sent low watermark: %s",
+          client->debug, g_strerror (errno));
+  }
+#endif
+
+#ifdef TCP_ULP
+  {
+    gchar ulp[16] = { 0, };
+    socklen_t len = sizeof (ulp) - 1;
+
+    if (getsockopt (fd, IPPROTO_TCP, TCP_ULP, ulp, &len) == 0 &&
+        strcmp (ulp, "tls") == 0) {
+      if (!client->ktls)
+        GST_INFO_OBJECT (sink, "%s uses kernel TLS", client->debug);
+      client->ktls = TRUE;
+    }
+  }
+#endif
+#endif
+}
+
+static void
+gst_multi_handle_sink_setup_tcp (GstMultiHandleSink * mhsink)
+{
+  GList *clients;
+
+  CLIENTS_LOCK (mhsink);
+  for (clients = mhsink->clients; clients; clients = clients->next) {
+    GstMultiHandleClient *client;
+
+    client = clients->data;
+
+    gst_multi_handle_sink_setup_tcp_client (mhsink, client);
+  }
+  CLIENTS_UNLOCK (mhsink);
+}
+
 void
 gst_multi_handle_sink_add_full (GstMultiHandleSink * sink,
     GstMultiSinkHandle handle, GstSyncMethod sync_method, GstFormat min_format,
@@ -673,32 +899,42 @@ gst_multi_handle_sink_add_full (GstMultiHandleSink * sink,
       goto wrong_limits;
   }
 
-  CLIENTS_LOCK (sink);
+  /* the client is set up without the clients lock, which is also taken for
+   * every rendered buffer. Adds are serialized so that no duplicate can be
+   * added in the meantime. */
+  g_mutex_lock (&sink->addlock);
 
   /* check the hash to find a duplicate handle */
+  CLIENTS_LOCK (sink);
   clink = g_hash_table_lookup (mhsink->handle_hash,
       mhsinkclass->handle_hash_key (handle));
+  CLIENTS_UNLOCK (sink);
   if (clink != NULL)
     goto duplicate;
 
   mhclient = mhsinkclass->new_client (mhsink, handle, sync_method);
 
+  mhclient->burst_min_format = min_format;
+  mhclient->burst_min_value = min_value;
+  mhclient->burst_max_format = max_format;
+  mhclient->burst_max_value = max_value;
+
+  CLIENTS_LOCK (sink);
+
   /* we can add the handle now */
   clink = mhsink->clients = g_list_prepend (mhsink->clients, mhclient);
   g_hash_table_insert (mhsink->handle_hash,
       mhsinkclass->handle_hash_key (mhclient->handle), clink);
   mhsink->clients_cookie++;
 
-
-  mhclient->burst_min_format = min_format;
-  mhclient->burst_min_value = min_value;
-  mhclient->burst_max_format = max_format;
-  mhclient->burst_max_value = max_value;
+  /* watch the client now that it can be found */
+  mhsinkclass->hash_adding (mhsink, mhclient);
 
   if (mhsinkclass->hash_changed)
     mhsinkclass->hash_changed (mhsink);
 
   CLIENTS_UNLOCK (sink);
+  g_mutex_unlock (&sink->addlock);
 
   mhsinkclass->emit_client_added (mhsink, handle);
 
@@ -715,7 +951,7 @@ wrong_limits:
   }
 duplicate:
   {
-    CLIENTS_UNLOCK (sink);
+    g_mutex_unlock (&sink->addlock);
     GST_WARNING_OBJECT (sink, "%s duplicate client found, refusing", debug);
     mhsinkclass->emit_client_removed (mhsink, handle,
         GST_CLIENT_STATUS_DUPLICATE);
@@ -853,6 +1089,65 @@ restart:
 }
 
 
+/* the stats of @mhclient, must be called with the clients lock */
+static GstStructure *
+gst_multi_handle_sink_client_stats (GstMultiHandleSink * sink,
+    GstMultiHandleClient * mhclient)
+{
+  GstStructure *result;
+  GValue latency = { 0, };
+  GValue bucket = { 0, };
+  guint64 interval, throughput, avg_queue_size;
+  gint i;
+
+  result = gst_structure_new_empty ("multihandlesink-stats");
+
+  if (mhclient->disconnect_time == 0) {
+    GTimeVal nowtv;
+
+    g_get_current_time (&nowtv);
+
+    interval = GST_TIMEVAL_TO_TIME (nowtv) - mhclient->connect_time;
+  } else {
+    interval = mhclient->disconnect_time - mhclient->connect_time;
+  }
+
+  throughput = interval > 0 ?
+      gst_util_uint64_scale (mhclient->bytes_sent, GST_SECOND, interval) : 0;
+  avg_queue_size = mhclient->queue_size_samples > 0 ?
+      mhclient->queue_size_sum / mhclient->queue_size_samples : 0;
+
+  g_value_init (&latency, GST_TYPE_ARRAY);
+  g_value_init (&bucket, G_TYPE_UINT64);
+  for (i = 0; i < GST_MULTI_HANDLE_SINK_LATENCY_BUCKETS; i++) {
+    g_value_set_uint64 (&bucket, mhclient->latency[i]);
+    gst_value_array_append_value (&latency, &bucket);
+  }
+  g_value_unset (&bucket);
+
+  gst_structure_set (result,
+      "bytes-sent", G_TYPE_UINT64, mhclient->bytes_sent,
+      "connect-time", G_TYPE_UINT64, mhclient->connect_time,
+      "disconnect-time", G_TYPE_UINT64, mhclient->disconnect_time,
+      "connect-duration", G_TYPE_UINT64, interval,
+      "last-activitity-time", G_TYPE_UINT64, mhclient->last_activity_time,
+      "buffers-dropped", G_TYPE_UINT64, mhclient->dropped_buffers,
+      "first-buffer-ts", G_TYPE_UINT64, mhclient->first_buffer_ts,
+      "last-buffer-ts", G_TYPE_UINT64, mhclient->last_buffer_ts,
+      "pacing-bitrate", G_TYPE_UINT64, mhclient->pacing_rate * 8,
+      "throughput", G_TYPE_UINT64, throughput,
+      "writes", G_TYPE_UINT64, mhclient->writes,
+      "writes-would-block", G_TYPE_UINT64, mhclient->writes_would_block,
+      "queue-size", G_TYPE_INT, mhclient->bufpos + 1,
+      "avg-queue-size", G_TYPE_UINT64, avg_queue_size,
+      "max-queue-size", G_TYPE_INT, mhclient->max_queue_size, NULL);
+  /* number of buffers sent within 1, 2, 4, ... milliseconds after they
+   * were queued */
+  gst_structure_take_value (result, "send-latency", &latency);
+
+  return result;
+}
+
 /* "get-stats" signal implementation
  */
 GstStructure *
@@ -876,32 +1171,8 @@ gst_multi_handle_sink_get_stats (GstMultiHandleSink * sink,
     goto noclient;
 
   client = clink->data;
-  if (client != NULL) {
-    GstMultiHandleClient *mhclient = (GstMultiHandleClient *) client;
-    guint64 interval;
-
-    result = gst_structure_new_empty ("multihandlesink-stats");
-
-    if (mhclient->disconnect_time == 0) {
-      GTimeVal nowtv;
-
-      g_get_current_time (&nowtv);
-
-      interval = GST_TIMEVAL_TO_TIME (nowtv) - mhclient->connect_time;
-    } else {
-      interval = mhclient->disconnect_time - mhclient->connect_time;
-    }
-
-    gst_structure_set (result,
-        "bytes-sent", G_TYPE_UINT64, mhclient->bytes_sent,
-        "connect-time", G_TYPE_UINT64, mhclient->connect_time,
-        "disconnect-time", G_TYPE_UINT64, mhclient->disconnect_time,
-        "connect-duration", G_TYPE_UINT64, interval,
-        "last-activitity-time", G_TYPE_UINT64, mhclient->last_activity_time,
-        "buffers-dropped", G_TYPE_UINT64, mhclient->dropped_buffers,
-        "first-buffer-ts", G_TYPE_UINT64, mhclient->first_buffer_ts,
-        "last-buffer-ts", G_TYPE_UINT64, mhclient->last_buffer_ts, NULL);
-  }
+  if (client != NULL)
+    result = gst_multi_handle_sink_client_stats (mhsink, client);
 
 noclient:
   CLIENTS_UNLOCK (sink);
@@ -1022,9 +1293,12 @@ gst_multi_handle_sink_remove_client_link (GstMultiHandleSink * sink,
   CLIENTS_LOCK (sink);
 }
 
-static gboolean
-gst_multi_handle_sink_client_queue_buffer (GstMultiHandleSink * mhsink,
-    GstMultiHandleClient * mhclient, GstBuffer * buffer)
+/* before a client starts on a new buffer of the queue, we check if we need
+ * to send streamheader buffers first (because it's a new client, or because
+ * they changed). Those are put in the sending list of the client. */
+static void
+gst_multi_handle_sink_client_queue_streamheader (GstMultiHandleSink * mhsink,
+    GstMultiHandleClient * mhclient)
 {
   GstMultiHandleSink *sink = GST_MULTI_HANDLE_SINK (mhsink);
   GstCaps *caps;
@@ -1033,8 +1307,6 @@ gst_multi_handle_sink_client_queue_buffer (GstMultiHandleSink * mhsink,
   gboolean send_streamheader = FALSE;
   GstStructure *s;
 
-  /* before we queue the buffer, we check if we need to queue streamheader
-   * buffers (because it's a new client, or because they changed) */
   caps = gst_pad_get_current_caps (GST_BASE_SINK_PAD (sink));
 
   if (!mhclient->caps) {
@@ -1128,15 +1400,278 @@ gst_multi_handle_sink_client_queue_buffer (GstMultiHandleSink * mhsink,
   }
 
   gst_caps_unref (caps);
-  caps = NULL;
+}
+
+/* Collects the buffers that are sent next to @mhclient in @buffers, at most
+ * @max and up to #GstMultiHandleSink:send-batch-bytes. These are the
+ * buffers in the sending list of the client, like stream headers, or else
+ * the buffers of the global queue from the position of the client on. The
+ * first buffer is sent from the bufoffset of the client. Returns the number
+ * of buffers. Must be called with the clients lock. */
+guint
+gst_multi_handle_sink_client_get_buffers (GstMultiHandleSink * mhsink,
+    GstMultiHandleClient * mhclient, GstBuffer ** buffers, guint max)
+{
+  GSList *walk;
+  gsize pending;
+  gint pos, end;
+  guint n;
+
+  g_return_val_if_fail (max > 0, 0);
+
+  if (!mhclient->sending && mhclient->bufpos >= 0) {
+    /* a partially sent buffer is finished on its own, the stream headers
+     * might have to be sent before the next one */
+    if (mhclient->bufoffset > 0) {
+      buffers[0] = QUEUE_BUFFER (mhsink, mhclient->bufpos);
+      return 1;
+    }
+    gst_multi_handle_sink_client_queue_streamheader (mhsink, mhclient);
+  }
 
-  GST_LOG_OBJECT (sink, "%s queueing buffer of length %" G_GSIZE_FORMAT,
-      mhclient->debug, gst_buffer_get_size (buffer));
+  n = 0;
+  pending = 0;
+  if (mhclient->sending) {
+    for (walk = mhclient->sending; walk && n < max; walk = walk->next) {
+      buffers[n++] = GST_BUFFER_CAST (walk->data);
+      pending += gst_buffer_get_size (buffers[n - 1]);
+      if (pending - mhclient->bufoffset >= mhsink->send_batch_bytes)
+        break;
+    }
+    return n;
+  }
 
-  gst_buffer_ref (buffer);
-  mhclient->sending = g_slist_append (mhclient->sending, buffer);
+  /* don't go past the buffers that a flushing client still has to send */
+  end = 0;
+  if (mhclient->flushcount != -1)
+    end = MAX (end, mhclient->bufpos - mhclient->flushcount + 1);
+  if (mhclient->new_connection)
+    max = 1;
 
-  return TRUE;
+  for (pos = mhclient->bufpos; pos >= end && n < max; pos--) {
+    buffers[n++] = QUEUE_BUFFER (mhsink, pos);
+    pending += gst_buffer_get_size (buffers[n - 1]);
+    if (pending >= mhsink->send_batch_bytes)
+      break;
+  }
+
+  return n;
+}
+
+/* Checks if more data than the @n_bufs buffers from
+ * gst_multi_handle_sink_client_get_buffers() can be sent to @mhclient right
+ * away, so that the kernel can be told that more data follows. */
+gboolean
+gst_multi_handle_sink_client_has_more (GstMultiHandleSink * mhsink,
+    GstMultiHandleClient * mhclient, guint n_bufs)
+{
+  gint end;
+
+  if (!mhsink->cork)
+    return FALSE;
+
+  if (mhclient->sending)
+    return g_slist_length (mhclient->sending) > n_bufs ||
+        mhclient->bufpos >= 0;
+
+  end = 0;
+  if (mhclient->flushcount != -1)
+    end = MAX (end, mhclient->bufpos - mhclient->flushcount + 1);
+
+  return mhclient->bufpos - (gint) n_bufs >= end;
+}
+
+/* Advances @mhclient over the first @bytes of the buffers from
+ * gst_multi_handle_sink_client_get_buffers() after they were written. */
+void
+gst_multi_handle_sink_client_consume (GstMultiHandleSink * mhsink,
+    GstMultiHandleClient * mhclient, gsize bytes)
+{
+  gint64 now;
+
+  while (mhclient->sending) {
+    GstBuffer *head = GST_BUFFER_CAST (mhclient->sending->data);
+    gsize left = gst_buffer_get_size (head) - mhclient->bufoffset;
+
+    if (bytes < left) {
+      mhclient->bufoffset += bytes;
+      return;
+    }
+
+    /* complete buffer was written, we can proceed to the next one */
+    bytes -= left;
+    mhclient->sending = g_slist_remove (mhclient->sending, head);
+    gst_buffer_unref (head);
+    /* make sure we start from byte 0 for the next buffer */
+    mhclient->bufoffset = 0;
+  }
+
+  now = -1;
+  while (mhclient->bufpos >= 0 && mhclient->flushcount != 0) {
+    GstMultiHandleSinkQueueEntry *entry =
+        QUEUE_ENTRY (mhsink, mhclient->bufpos);
+    GstBuffer *buf = entry->buffer;
+    gsize left = gst_buffer_get_size (buf) - mhclient->bufoffset;
+    GstClockTime timestamp;
+    guint64 msecs;
+
+    if (bytes < left) {
+      mhclient->bufoffset += bytes;
+      return;
+    }
+
+    /* the client moves on to the next buffer in the queue */
+    bytes -= left;
+    mhclient->bufoffset = 0;
+    mhclient->bufpos--;
+
+    /* update stats */
+    if (now == -1)
+      now = g_get_monotonic_time ();
+    msecs = MAX (now - entry->queued, 0) / G_TIME_SPAN_MILLISECOND;
+    mhclient->latency[msecs == 0 ? 0 : MIN (g_bit_storage (msecs),
+            GST_MULTI_HANDLE_SINK_LATENCY_BUCKETS - 1)]++;
+
+    timestamp = GST_BUFFER_TIMESTAMP (buf);
+    if (mhclient->first_buffer_ts == GST_CLOCK_TIME_NONE)
+      mhclient->first_buffer_ts = timestamp;
+    if (timestamp != -1)
+      mhclient->last_buffer_ts = timestamp;
+
+    /* decrease flushcount */
+    if (mhclient->flushcount != -1)
+      mhclient->flushcount--;
+
+    GST_LOG_OBJECT (mhsink, "%s client %p at position %d",
+        mhclient->debug, mhclient, mhclient->bufpos);
+  }
+}
+
+/* Makes a buffer that @mhclient has partially sent independent of its
+ * position, before the position is changed. */
+static void
+gst_multi_handle_sink_client_detach (GstMultiHandleSink * mhsink,
+    GstMultiHandleClient * mhclient)
+{
+  GstBuffer *buf;
+
+  if (mhclient->sending || mhclient->bufoffset == 0 || mhclient->bufpos < 0)
+    return;
+
+  buf = QUEUE_BUFFER (mhsink, mhclient->bufpos);
+  mhclient->sending = g_slist_append (mhclient->sending, gst_buffer_ref (buf));
+  mhclient->bufpos--;
+  if (mhclient->flushcount > 0)
+    mhclient->flushcount--;
+}
+
+/* the rate in bytes per second at which clients are paced, or 0 when the
+ * clients are not paced (yet). Must be called with the clients lock. */
+static guint64
+gst_multi_handle_sink_pacing_rate (GstMultiHandleSink * mhsink)
+{
+  GstClockTime start, end;
+
+  if (!mhsink->pacing)
+    return 0;
+
+  if (mhsink->pacing_bitrate > 0)
+    return mhsink->pacing_bitrate / 8;
+
+  /* measure the average bitrate of the stream, we need at least a second of
+   * data for a reasonable value */
+  start = mhsink->pacing_start_time;
+  end = mhsink->index_time;
+  if (!GST_CLOCK_TIME_IS_VALID (start) || !GST_CLOCK_TIME_IS_VALID (end)
+      || end < start + GST_SECOND)
+    return 0;
+
+  return gst_util_uint64_scale (mhsink->index_bytes -
+      mhsink->pacing_start_bytes, GST_SECOND * PACING_HEADROOM_N,
+      (end - start) * PACING_HEADROOM_D);
+}
+
+/* let the kernel pace the socket of @mhclient at @rate as well */
+static void
+gst_multi_handle_sink_setup_pacing_client (GstMultiHandleSink * mhsink,
+    GstMultiHandleClient * mhclient, guint64 rate)
+{
+#if defined(SO_MAX_PACING_RATE) && defined(HAVE_SYS_SOCKET_H)
+  GstMultiHandleSinkClass *mhsinkclass =
+      GST_MULTI_HANDLE_SINK_GET_CLASS (mhsink);
+  guint64 diff;
+  guint32 val;
+  int fd;
+
+  /* avoid a system call for small changes of a measured rate */
+  if (rate > mhclient->pacing_socket_rate)
+    diff = rate - mhclient->pacing_socket_rate;
+  else
+    diff = mhclient->pacing_socket_rate - rate;
+  if (diff == 0 || diff < mhclient->pacing_socket_rate / 8)
+    return;
+
+  fd = mhsinkclass->client_get_fd (mhclient);
+  /* ~0 removes the limit */
+  val = rate == 0 ? G_MAXUINT32 : MIN (rate, G_MAXUINT32 - 1);
+  if (setsockopt (fd, SOL_SOCKET, SO_MAX_PACING_RATE, &val, sizeof (val)) < 0)
+    GST_DEBUG_OBJECT (mhsink, "%s could not set pacing rate: %s",
+        mhclient->debug, g_strerror (errno));
+
+  /* not retried when it failed, the socket does not support it */
+  mhclient->pacing_socket_rate = rate;
+#endif
+}
+
+/* Returns how many bytes can be sent to @mhclient now without exceeding its
+ * pacing rate. When it returns 0, @wait is set to the time after which the
+ * client can send again. Must be called with the clients lock. */
+gssize
+gst_multi_handle_sink_client_pacing_budget (GstMultiHandleSink * mhsink,
+    GstMultiHandleClient * mhclient, GstClockTime * wait)
+{
+  guint64 rate, budget;
+  gint64 now, ahead;
+
+  *wait = 0;
+
+  rate = gst_multi_handle_sink_pacing_rate (mhsink);
+  gst_multi_handle_sink_setup_pacing_client (mhsink, mhclient, rate);
+  mhclient->pacing_rate = rate;
+
+  if (rate == 0)
+    return G_MAXSSIZE;
+
+  /* a client that could not keep up does not get to catch up with a
+   * burst */
+  now = g_get_monotonic_time ();
+  if (mhclient->pacing_time < now)
+    mhclient->pacing_time = now;
+
+  ahead = mhclient->pacing_time - now;
+  if (ahead >= PACING_BURST) {
+    /* continue when half of a burst can be sent again */
+    *wait = (ahead - PACING_BURST / 2) * GST_USECOND;
+    GST_LOG_OBJECT (mhsink, "%s paced for %" GST_TIME_FORMAT,
+        mhclient->debug, GST_TIME_ARGS (*wait));
+    return 0;
+  }
+
+  budget = gst_util_uint64_scale (PACING_BURST - ahead, rate, G_USEC_PER_SEC);
+
+  return MAX (budget, 1);
+}
+
+/* Accounts @bytes that were sent to @mhclient for its pacing */
+void
+gst_multi_handle_sink_client_pacing_sent (GstMultiHandleSink * mhsink,
+    GstMultiHandleClient * mhclient, gsize bytes)
+{
+  if (mhclient->pacing_rate == 0)
+    return;
+
+  mhclient->pacing_time +=
+      gst_util_uint64_scale (bytes, G_USEC_PER_SEC, mhclient->pacing_rate);
 }
 
 static gboolean
@@ -1151,6 +1686,150 @@ is_sync_frame (GstMultiHandleSink * sink, GstBuffer * buffer)
   return FALSE;
 }
 
+/* make room for twice as many buffers in the queue */
+static void
+gst_multi_handle_sink_queue_grow (GstMultiHandleSink * sink)
+{
+  GstMultiHandleSinkQueueEntry *queue;
+  guint64 seq;
+  guint size;
+
+  size = MAX (sink->queue_size * 2, 64);
+  queue = g_new (GstMultiHandleSinkQueueEntry, size);
+  for (seq = sink->index_seq - sink->queue_len; seq < sink->index_seq; seq++)
+    queue[seq & (size - 1)] = sink->queue[seq & (sink->queue_size - 1)];
+
+  g_free (sink->queue);
+  sink->queue = queue;
+  sink->queue_size = size;
+}
+
+/* put @buffer at the start of the queue */
+static void
+gst_multi_handle_sink_queue_push (GstMultiHandleSink * sink,
+    GstBuffer * buffer)
+{
+  GstMultiHandleSinkQueueEntry *entry;
+
+  if (sink->queue_len == sink->queue_size)
+    gst_multi_handle_sink_queue_grow (sink);
+
+  if (GST_BUFFER_TIMESTAMP_IS_VALID (buffer)) {
+    sink->index_time = GST_BUFFER_TIMESTAMP (buffer);
+
+    /* the stream bitrate for pacing is measured from here */
+    if (!GST_CLOCK_TIME_IS_VALID (sink->pacing_start_time)) {
+      sink->pacing_start_time = sink->index_time;
+      sink->pacing_start_bytes = sink->index_bytes;
+    }
+  }
+
+  entry = &sink->queue[sink->index_seq & (sink->queue_size - 1)];
+  entry->buffer = buffer;
+  entry->offset = sink->index_bytes;
+  entry->time = sink->index_time;
+  entry->queued = g_get_monotonic_time ();
+
+  if (is_sync_frame (sink, buffer))
+    g_array_append_val (sink->syncframes, sink->index_seq);
+
+  sink->index_seq++;
+  sink->queue_len++;
+  sink->index_bytes += gst_buffer_get_size (buffer);
+}
+
+/* remove the buffers after the first @len ones from the end of the queue,
+ * unreffing them */
+static void
+gst_multi_handle_sink_queue_trim (GstMultiHandleSink * sink, guint len)
+{
+  guint64 oldest;
+  guint n;
+
+  while (sink->queue_len > len) {
+    GstMultiHandleSinkQueueEntry *entry =
+        QUEUE_ENTRY (sink, sink->queue_len - 1);
+
+    GST_LOG_OBJECT (sink, "Removing buffer %p (%u) with refcount %d",
+        entry->buffer, sink->queue_len - 1,
+        GST_MINI_OBJECT_REFCOUNT (entry->buffer));
+    gst_buffer_unref (entry->buffer);
+    entry->buffer = NULL;
+    sink->queue_len--;
+  }
+
+  oldest = sink->index_seq - sink->queue_len;
+  for (n = 0; n < sink->syncframes->len; n++) {
+    if (g_array_index (sink->syncframes, guint64, n) >= oldest)
+      break;
+  }
+  g_array_remove_range (sink->syncframes, 0, n);
+}
+
+/* the number of bytes in the buffers from the start of the queue up to
+ * and including @idx */
+#define BYTES_UP_TO(s,idx) ((s)->index_bytes - QUEUE_ENTRY (s, idx)->offset)
+
+/* first position in the queue where the buffers up to and including it
+ * contain at least @bytes, or -1 */
+static gint
+find_bytes_position (GstMultiHandleSink * sink, guint64 bytes)
+{
+  gint lo = 0, hi = sink->queue_len;
+
+  while (lo < hi) {
+    gint mid = (lo + hi) / 2;
+
+    if (BYTES_UP_TO (sink, mid) >= bytes)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return lo < (gint) sink->queue_len ? lo : -1;
+}
+
+/* first position in the queue whose timestamp is at least @duration
+ * older than the most recent timestamp, or -1 */
+static gint
+find_time_position (GstMultiHandleSink * sink, gint64 duration)
+{
+  GstClockTime first;
+  gint lo, hi, n_valid;
+
+  if (sink->queue_len == 0)
+    return -1;
+
+  first = QUEUE_ENTRY (sink, 0)->time;
+  if (first == GST_CLOCK_TIME_NONE)
+    return -1;
+
+  /* the buffers before the first timestamp are at the end of the queue */
+  lo = 0;
+  hi = sink->queue_len;
+  while (lo < hi) {
+    gint mid = (lo + hi) / 2;
+
+    if (QUEUE_ENTRY (sink, mid)->time == GST_CLOCK_TIME_NONE)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  n_valid = lo;
+
+  /* timestamps decrease towards the end of the queue */
+  lo = 0;
+  hi = n_valid;
+  while (lo < hi) {
+    gint mid = (lo + hi) / 2;
+
+    if ((gint64) (first - QUEUE_ENTRY (sink, mid)->time) >= duration)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return lo < n_valid ? lo : -1;
+}
+
 /* find the keyframe in the list of buffers starting the
  * search from @idx. @direction as -1 will search backwards, 
  * 1 will search forwards.
@@ -1159,26 +1838,44 @@ is_sync_frame (GstMultiHandleSink * sink, GstBuffer * buffer)
 gint
 find_syncframe (GstMultiHandleSink * sink, gint idx, gint direction)
 {
-  gint i, len, result;
+  GArray *syncs = sink->syncframes;
+  guint64 seq;
+  guint lo, hi;
+  gint result;
 
-  /* take length of queued buffers */
-  len = sink->bufqueue->len;
+  if (idx < 0 || idx >= (gint) sink->queue_len)
+    return -1;
 
-  /* assume we don't find a keyframe */
-  result = -1;
+  /* first sync frame that was queued at or after the buffer at @idx */
+  seq = POS_TO_SEQ (sink, idx);
+  lo = 0;
+  hi = syncs->len;
+  while (lo < hi) {
+    guint mid = (lo + hi) / 2;
 
-  /* then loop over all buffers to find the first keyframe */
-  for (i = idx; i >= 0 && i < len; i += direction) {
-    GstBuffer *buf;
+    if (g_array_index (syncs, guint64, mid) >= seq)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
 
-    buf = g_array_index (sink->bufqueue, GstBuffer *, i);
-    if (is_sync_frame (sink, buf)) {
-      GST_LOG_OBJECT (sink, "found keyframe at %d from %d, direction %d",
-          i, idx, direction);
-      result = i;
-      break;
-    }
+  if (direction < 0) {
+    /* towards the newer buffers at the start of the queue */
+    result = lo < syncs->len ?
+        SEQ_TO_POS (sink, g_array_index (syncs, guint64, lo)) : -1;
+  } else {
+    /* towards the older buffers */
+    if (lo < syncs->len && g_array_index (syncs, guint64, lo) == seq)
+      result = idx;
+    else
+      result = lo > 0 ?
+          SEQ_TO_POS (sink, g_array_index (syncs, guint64, lo - 1)) : -1;
   }
+
+  if (result != -1)
+    GST_LOG_OBJECT (sink, "found keyframe at %d from %d, direction %d",
+        result, idx, direction);
+
   return result;
 }
 
@@ -1194,45 +1891,15 @@ get_buffers_max (GstMultiHandleSink * sink, gint64 max)
       return max;
     case GST_FORMAT_TIME:
     {
-      GstBuffer *buf;
-      int i;
-      int len;
-      gint64 diff;
-      GstClockTime first = GST_CLOCK_TIME_NONE;
-
-      len = sink->bufqueue->len;
-
-      for (i = 0; i < len; i++) {
-        buf = g_array_index (sink->bufqueue, GstBuffer *, i);
-        if (GST_BUFFER_TIMESTAMP_IS_VALID (buf)) {
-          if (first == -1)
-            first = GST_BUFFER_TIMESTAMP (buf);
+      gint idx = find_time_position (sink, max + 1);
 
-          diff = first - GST_BUFFER_TIMESTAMP (buf);
-
-          if (diff > max)
-            return i + 1;
-        }
-      }
-      return len + 1;
+      return idx != -1 ? idx + 1 : sink->queue_len + 1;
     }
     case GST_FORMAT_BYTES:
     {
-      GstBuffer *buf;
-      int i;
-      int len;
-      gint acc = 0;
+      gint idx = find_bytes_position (sink, max + 1);
 
-      len = sink->bufqueue->len;
-
-      for (i = 0; i < len; i++) {
-        buf = g_array_index (sink->bufqueue, GstBuffer *, i);
-        acc += gst_buffer_get_size (buf);
-
-        if (acc > max)
-          return i + 1;
-      }
-      return len + 1;
+      return idx != -1 ? idx + 1 : sink->queue_len + 1;
     }
     default:
       return max;
@@ -1256,12 +1923,11 @@ find_limits (GstMultiHandleSink * sink,
     gint * min_idx, gint bytes_min, gint buffers_min, gint64 time_min,
     gint * max_idx, gint bytes_max, gint buffers_max, gint64 time_max)
 {
-  GstClockTime first, time;
-  gint i, len, bytes;
-  gboolean result, max_hit;
+  gint len, idx, min_pos, max_pos;
+  gboolean result;
 
   /* take length of queue */
-  len = sink->bufqueue->len;
+  len = sink->queue_len;
 
   /* this must hold */
   g_assert (len > 0);
@@ -1279,73 +1945,46 @@ find_limits (GstMultiHandleSink * sink,
     return FALSE;
   }
 
-  result = FALSE;
-  /* else count bytes and time */
-  first = -1;
-  bytes = 0;
-  /* unset limits */
-  *min_idx = -1;
-  *max_idx = -1;
-  max_hit = FALSE;
-
-  i = 0;
-  /* loop through the buffers, when a limit is ok, mark it 
-   * as -1, we have at least one buffer in the queue. */
-  do {
-    GstBuffer *buf;
-
-    /* if we checked all min limits, update result */
-    if (bytes_min == -1 && time_min == -1 && *min_idx == -1) {
-      /* don't go below 0 */
-      *min_idx = MAX (i - 1, 0);
-    }
-    /* if we reached one max limit break out */
-    if (max_hit) {
-      /* i > 0 when we get here, we subtract one to get the position
-       * of the previous buffer. */
-      *max_idx = i - 1;
-      /* we have valid complete result if we found a min_idx too */
-      result = *min_idx != -1;
-      break;
-    }
-    buf = g_array_index (sink->bufqueue, GstBuffer *, i);
-
-    bytes += gst_buffer_get_size (buf);
-
-    /* take timestamp and save for the base first timestamp */
-    if ((time = GST_BUFFER_TIMESTAMP (buf)) != -1) {
-      GST_LOG_OBJECT (sink, "Ts %" GST_TIME_FORMAT " on buffer",
-          GST_TIME_ARGS (time));
-      if (first == -1)
-        first = time;
-
-      /* increase max usage if we did not fill enough. Note that
-       * buffers are sorted from new to old, so the first timestamp is
-       * bigger than the next one. */
-      if (time_min != -1 && first - time >= time_min)
-        time_min = -1;
-      if (time_max != -1 && first - time >= time_max)
-        max_hit = TRUE;
-    } else {
-      GST_LOG_OBJECT (sink, "No timestamp on buffer");
-    }
-    /* time is OK or unknown, check and increase if not enough bytes */
-    if (bytes_min != -1) {
-      if (bytes >= bytes_min)
-        bytes_min = -1;
-    }
-    if (bytes_max != -1) {
-      if (bytes >= bytes_max) {
-        max_hit = TRUE;
-      }
-    }
-    i++;
+  /* position of the first buffer where all min limits are ok, -1 when there
+   * are no min limits and len when they can't be satisfied */
+  min_pos = -1;
+  if (bytes_min != -1) {
+    idx = find_bytes_position (sink, bytes_min);
+    min_pos = MAX (min_pos, idx != -1 ? idx : len);
+  }
+  if (time_min != -1) {
+    idx = find_time_position (sink, time_min);
+    min_pos = MAX (min_pos, idx != -1 ? idx : len);
+  }
+
+  /* position of the first buffer where one of the max limits is hit */
+  max_pos = len;
+  if (bytes_max != -1) {
+    idx = find_bytes_position (sink, bytes_max);
+    if (idx != -1)
+      max_pos = MIN (max_pos, idx);
+  }
+  if (time_max != -1) {
+    idx = find_time_position (sink, time_max);
+    if (idx != -1)
+      max_pos = MIN (max_pos, idx);
   }
-  while (i < len);
 
-  /* if we did not hit the max or min limit, set to buffer size */
-  if (*max_idx == -1)
+  /* a limit is only taken when there is a buffer after it, the max limit
+   * ends the search */
+  if (max_pos < len - 1)
+    *max_idx = max_pos;
+  else
     *max_idx = len - 1;
+
+  if (min_pos <= max_pos && min_pos < len - 1)
+    *min_idx = MAX (min_pos, 0);
+  else
+    *min_idx = -1;
+
+  /* we have valid complete result if we hit a max and found a min_idx too */
+  result = max_pos < len - 1 && *min_idx != -1;
+
   /* make sure min does not exceed max */
   if (*min_idx == -1)
     *min_idx = *max_idx;
@@ -1423,8 +2062,8 @@ gst_multi_handle_sink_new_client_position (GstMultiHandleSink * sink,
 
   GST_DEBUG_OBJECT (sink,
       "%s new client, deciding where to start in queue", client->debug);
-  GST_DEBUG_OBJECT (sink, "queue is currently %d buffers long",
-      sink->bufqueue->len);
+  GST_DEBUG_OBJECT (sink, "queue is currently %u buffers long",
+      sink->queue_len);
   switch (client->sync_method) {
     case GST_SYNC_METHOD_LATEST:
       /* no syncing, we are happy with whatever the client is going to get */
@@ -1634,13 +2273,13 @@ gst_multi_handle_sink_recover_client (GstMultiHandleSink * sink,
     case GST_RECOVER_POLICY_RESYNC_KEYFRAME:
       /* find keyframe in buffers, we search backwards to find the
        * closest keyframe relative to what this client already received. */
-      newbufpos = MIN (sink->bufqueue->len - 1,
+      newbufpos = MIN ((gint) sink->queue_len - 1,
           get_buffers_max (sink, sink->units_soft_max) - 1);
 
       while (newbufpos >= 0) {
         GstBuffer *buf;
 
-        buf = g_array_index (sink->bufqueue, GstBuffer *, newbufpos);
+        buf = QUEUE_BUFFER (sink, newbufpos);
         if (is_sync_frame (sink, buf)) {
           /* found a buffer that is not a delta unit */
           break;
@@ -1656,13 +2295,55 @@ gst_multi_handle_sink_recover_client (GstMultiHandleSink * sink,
   return newbufpos;
 }
 
+/* the structure for the stats message when #GstMultiHandleSink:stats-interval
+ * passed since the last one, or NULL. Must be called with the clients lock. */
+static GstStructure *
+gst_multi_handle_sink_collect_stats (GstMultiHandleSink * sink)
+{
+  GstStructure *result;
+  GValue clients = { 0, };
+  GValue client = { 0, };
+  GList *walk;
+  gint64 now, interval;
+
+  if (sink->stats_interval == 0)
+    return NULL;
+
+  now = g_get_monotonic_time ();
+  interval = sink->stats_interval / GST_USECOND;
+  if (sink->stats_time != 0 && now - sink->stats_time < interval)
+    return NULL;
+  sink->stats_time = now;
+
+  g_value_init (&clients, GST_TYPE_ARRAY);
+  for (walk = sink->clients; walk; walk = walk->next) {
+    GstMultiHandleClient *mhclient = walk->data;
+    GstStructure *s;
+
+    s = gst_multi_handle_sink_client_stats (sink, mhclient);
+    gst_structure_set (s, "client", G_TYPE_STRING, mhclient->debug, NULL);
+
+    g_value_init (&client, GST_TYPE_STRUCTURE);
+    gst_value_set_structure (&client, s);
+    gst_structure_free (s);
+    gst_value_array_append_value (&clients, &client);
+    g_value_unset (&client);
+  }
+
+  result = gst_structure_new ("multihandlesink-stats",
+      "buffers-queued", G_TYPE_INT, sink->buffers_queued,
+      "bytes-served", G_TYPE_UINT64, sink->bytes_served, NULL);
+  gst_structure_take_value (result, "clients", &clients);
+
+  return result;
+}
+
 /* Queue a buffer on the global queue.
  *
- * This function adds the buffer to the front of a GArray. It removes the
- * tail buffer if the max queue size is exceeded, unreffing the queued buffer.
- * Note that unreffing the buffer is not a problem as clients who
- * started writing out this buffer will still have a reference to it in the
- * mhclient->sending queue.
+ * This function adds the buffer to the front of the queue. It removes the
+ * tail buffers that no client uses anymore, unreffing the queued buffers.
+ * The clients send directly from the queue, a client keeps the position
+ * of the buffer it is sending until that buffer was written completely.
  *
  * After adding the buffer, we update all client positions in the queue. If
  * a client moves over the soft max, we start the recovery procedure for this
@@ -1671,10 +2352,12 @@ gst_multi_handle_sink_recover_client (GstMultiHandleSink * sink,
  *
  * Special care is taken of clients that were waiting for a new buffer (they
  * had a position of -1) because they can proceed after adding this new buffer.
- * This is done by adding the client back into the write fd_set and signaling
- * the select thread that the fd_set changed.
+ * This is done by adding the client back into the write fd_set. Returns TRUE
+ * when the select thread has to be signaled that the fd_set changed.
+ *
+ * Must be called with the clients lock.
  */
-static void
+static gboolean
 gst_multi_handle_sink_queue_buffer (GstMultiHandleSink * mhsink,
     GstBuffer * buffer)
 {
@@ -1682,7 +2365,6 @@ gst_multi_handle_sink_queue_buffer (GstMultiHandleSink * mhsink,
   gint queuelen;
   gboolean hash_changed = FALSE;
   gint max_buffer_usage;
-  gint i;
   GTimeVal nowtv;
   GstClockTime now;
   gint max_buffers, soft_max_buffers;
@@ -1694,10 +2376,9 @@ gst_multi_handle_sink_queue_buffer (GstMultiHandleSink * mhsink,
   g_get_current_time (&nowtv);
   now = GST_TIMEVAL_TO_TIME (nowtv);
 
-  CLIENTS_LOCK (mhsink);
   /* add buffer to queue */
-  g_array_prepend_val (mhsink->bufqueue, buffer);
-  queuelen = mhsink->bufqueue->len;
+  gst_multi_handle_sink_queue_push (mhsink, buffer);
+  queuelen = mhsink->queue_len;
 
   if (mhsink->units_max > 0)
     max_buffers = get_buffers_max (mhsink, mhsink->units_max);
@@ -1729,12 +2410,19 @@ restart:
     mhclient->bufpos++;
     GST_LOG_OBJECT (sink, "%s client %p at position %d",
         mhclient->debug, mhclient, mhclient->bufpos);
+
+    mhclient->queue_size_sum += mhclient->bufpos + 1;
+    mhclient->queue_size_samples++;
+    if (mhclient->bufpos + 1 > mhclient->max_queue_size)
+      mhclient->max_queue_size = mhclient->bufpos + 1;
     /* check soft max if needed, recover client */
     if (soft_max_buffers > 0 && mhclient->bufpos >= soft_max_buffers) {
       gint newpos;
 
       newpos = gst_multi_handle_sink_recover_client (mhsink, mhclient);
       if (newpos != mhclient->bufpos) {
+        /* finish the buffer the client is in the middle of first */
+        gst_multi_handle_sink_client_detach (mhsink, mhclient);
         mhclient->dropped_buffers += mhclient->bufpos - newpos;
         mhclient->bufpos = newpos;
         mhclient->discont = TRUE;
@@ -1799,7 +2487,7 @@ restart:
       mhsink->def_sync_method == GST_SYNC_METHOD_BURST_KEYFRAME) {
     /* no point in searching beyond the queue length */
     gint limit = queuelen;
-    GstBuffer *buf;
+    gint syncframe;
 
     /* no point in searching beyond the soft-max if any. */
     if (soft_max_buffers > 0) {
@@ -1808,14 +2496,11 @@ restart:
     GST_LOG_OBJECT (sink,
         "extending queue to include sync point, now at %d, limit is %d",
         max_buffer_usage, limit);
-    for (i = 0; i < limit; i++) {
-      buf = g_array_index (mhsink->bufqueue, GstBuffer *, i);
-      if (is_sync_frame (mhsink, buf)) {
-        /* found a sync frame, now extend the buffer usage to
-         * include at least this frame. */
-        max_buffer_usage = MAX (max_buffer_usage, i);
-        break;
-      }
+    syncframe = find_next_syncframe (mhsink, 0);
+    if (syncframe != -1 && syncframe < limit) {
+      /* found a sync frame, now extend the buffer usage to
+       * include at least this frame. */
+      max_buffer_usage = MAX (max_buffer_usage, syncframe);
     }
     GST_LOG_OBJECT (sink, "max buffer usage is now %d", max_buffer_usage);
   }
@@ -1823,42 +2508,51 @@ restart:
   GST_LOG_OBJECT (sink, "len %d, usage %d", queuelen, max_buffer_usage);
 
   /* nobody is referencing units after max_buffer_usage so we can
-   * remove them from the queue. We remove them in reverse order as
-   * this is the most optimal for GArray. */
-  for (i = queuelen - 1; i > max_buffer_usage; i--) {
-    GstBuffer *old;
-
-    /* queue exceeded max size */
-    queuelen--;
-    old = g_array_index (mhsink->bufqueue, GstBuffer *, i);
-    mhsink->bufqueue = g_array_remove_index (mhsink->bufqueue, i);
-
-    /* unref tail buffer */
-    gst_buffer_unref (old);
-  }
+   * remove them from the queue. */
+  if (queuelen > max_buffer_usage + 1)
+    gst_multi_handle_sink_queue_trim (mhsink, max_buffer_usage + 1);
   /* save for stats */
   mhsink->buffers_queued = max_buffer_usage;
-  CLIENTS_UNLOCK (sink);
+
+  return hash_changed;
+}
+
+/* Called after queueing buffers, with the clients lock. Releases the lock,
+ * signals the select thread when the handle_set changed and posts the
+ * client statistics when they are due. */
+static void
+gst_multi_handle_sink_queued (GstMultiHandleSink * mhsink,
+    gboolean hash_changed)
+{
+  GstMultiHandleSinkClass *mhsinkclass =
+      GST_MULTI_HANDLE_SINK_GET_CLASS (mhsink);
+  GstStructure *stats;
+
+  stats = gst_multi_handle_sink_collect_stats (mhsink);
+  CLIENTS_UNLOCK (mhsink);
 
   /* and send a signal to thread if handle_set changed */
   if (hash_changed && mhsinkclass->hash_changed) {
     mhsinkclass->hash_changed (mhsink);
   }
+
+  if (stats)
+    gst_element_post_message (GST_ELEMENT_CAST (mhsink),
+        gst_message_new_element (GST_OBJECT_CAST (mhsink), stats));
 }
 
-static GstFlowReturn
-gst_multi_handle_sink_render (GstBaseSink * bsink, GstBuffer * buf)
+/* Adds @buf to the streamheader or queues it. Must be called with the
+ * clients lock. */
+static gboolean
+gst_multi_handle_sink_handle_buffer (GstMultiHandleSink * sink,
+    GstBuffer * buf)
 {
   gboolean in_caps;
+  gboolean hash_changed = FALSE;
 #if 0
   GstCaps *bufcaps, *padcaps;
 #endif
 
-  GstMultiHandleSink *sink = GST_MULTI_HANDLE_SINK (bsink);
-
-  g_return_val_if_fail (GST_OBJECT_FLAG_IS_SET (sink,
-          GST_MULTI_HANDLE_SINK_OPEN), GST_FLOW_FLUSHING);
-
 #if 0
   /* since we check every buffer for streamheader caps, we need to make
    * sure every buffer has caps set */
@@ -1936,11 +2630,11 @@ gst_multi_handle_sink_render (GstBaseSink * bsink, GstBuffer * buf)
     sink->streamheader = g_slist_append (sink->streamheader, buf);
   } else {
     /* queue the buffer, this is a regular data buffer. */
-    gst_multi_handle_sink_queue_buffer (sink, buf);
+    hash_changed = gst_multi_handle_sink_queue_buffer (sink, buf);
 
     sink->bytes_to_serve += gst_buffer_get_size (buf);
   }
-  return GST_FLOW_OK;
+  return hash_changed;
 
   /* ERRORS */
 #if 0
@@ -1953,6 +2647,46 @@ no_caps:
 #endif
 }
 
+static GstFlowReturn
+gst_multi_handle_sink_render (GstBaseSink * bsink, GstBuffer * buf)
+{
+  GstMultiHandleSink *sink = GST_MULTI_HANDLE_SINK (bsink);
+  gboolean hash_changed;
+
+  g_return_val_if_fail (GST_OBJECT_FLAG_IS_SET (sink,
+          GST_MULTI_HANDLE_SINK_OPEN), GST_FLOW_FLUSHING);
+
+  CLIENTS_LOCK (sink);
+  hash_changed = gst_multi_handle_sink_handle_buffer (sink, buf);
+  gst_multi_handle_sink_queued (sink, hash_changed);
+
+  return GST_FLOW_OK;
+}
+
+/* queues all buffers of @list with one lock and wakes up the clients once */
+static GstFlowReturn
+gst_multi_handle_sink_render_list (GstBaseSink * bsink, GstBufferList * list)
+{
+  GstMultiHandleSink *sink = GST_MULTI_HANDLE_SINK (bsink);
+  gboolean hash_changed = FALSE;
+  guint i, len;
+
+  g_return_val_if_fail (GST_OBJECT_FLAG_IS_SET (sink,
+          GST_MULTI_HANDLE_SINK_OPEN), GST_FLOW_FLUSHING);
+
+  len = gst_buffer_list_length (list);
+  GST_LOG_OBJECT (sink, "received buffer list of %u buffers", len);
+
+  CLIENTS_LOCK (sink);
+  for (i = 0; i < len; i++)
+    hash_changed |=
+        gst_multi_handle_sink_handle_buffer (sink, gst_buffer_list_get (list,
+            i));
+  gst_multi_handle_sink_queued (sink, hash_changed);
+
+  return GST_FLOW_OK;
+}
+
 static void
 gst_multi_handle_sink_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec)
@@ -2009,6 +2743,25 @@ gst_multi_handle_sink_set_property (GObject * object, guint prop_id,
     case PROP_RESEND_STREAMHEADER:
       multihandlesink->resend_streamheader = g_value_get_boolean (value);
       break;
+    case PROP_SEND_BATCH_BYTES:
+      multihandlesink->send_batch_bytes = g_value_get_uint (value);
+      break;
+    case PROP_PACING:
+      multihandlesink->pacing = g_value_get_boolean (value);
+      break;
+    case PROP_PACING_BITRATE:
+      multihandlesink->pacing_bitrate = g_value_get_uint (value);
+      break;
+    case PROP_STATS_INTERVAL:
+      multihandlesink->stats_interval = g_value_get_uint64 (value);
+      break;
+    case PROP_NOTSENT_LOWAT:
+      multihandlesink->notsent_lowat = g_value_get_uint (value);
+      gst_multi_handle_sink_setup_tcp (multihandlesink);
+      break;
+    case PROP_CORK:
+      multihandlesink->cork = g_value_get_boolean (value);
+      break;
 
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -2085,6 +2838,24 @@ gst_multi_handle_sink_get_property (GObject * object, guint prop_id,
     case PROP_RESEND_STREAMHEADER:
       g_value_set_boolean (value, multihandlesink->resend_streamheader);
       break;
+    case PROP_SEND_BATCH_BYTES:
+      g_value_set_uint (value, multihandlesink->send_batch_bytes);
+      break;
+    case PROP_PACING:
+      g_value_set_boolean (value, multihandlesink->pacing);
+      break;
+    case PROP_PACING_BITRATE:
+      g_value_set_uint (value, multihandlesink->pacing_bitrate);
+      break;
+    case PROP_STATS_INTERVAL:
+      g_value_set_uint64 (value, multihandlesink->stats_interval);
+      break;
+    case PROP_NOTSENT_LOWAT:
+      g_value_set_uint (value, multihandlesink->notsent_lowat);
+      break;
+    case PROP_CORK:
+      g_value_set_boolean (value, multihandlesink->cork);
+      break;
     case PROP_NUM_HANDLES:
       g_value_set_uint (value,
           g_hash_table_size (multihandlesink->handle_hash));
@@ -2133,8 +2904,6 @@ static gboolean
 gst_multi_handle_sink_stop (GstBaseSink * bsink)
 {
   GstMultiHandleSinkClass *mhclass;
-  GstBuffer *buf;
-  gint i;
   GstMultiHandleSink *mhsink = GST_MULTI_HANDLE_SINK (bsink);
 
   mhclass = GST_MULTI_HANDLE_SINK_GET_CLASS (mhsink);
@@ -2167,19 +2936,12 @@ gst_multi_handle_sink_stop (GstBaseSink * bsink)
 
   mhclass->stop_post (mhsink);
 
-  /* remove all queued buffers */
-  if (mhsink->bufqueue) {
-    GST_DEBUG_OBJECT (mhsink, "Emptying bufqueue with %d buffers",
-        mhsink->bufqueue->len);
-    for (i = mhsink->bufqueue->len - 1; i >= 0; --i) {
-      buf = g_array_index (mhsink->bufqueue, GstBuffer *, i);
-      GST_LOG_OBJECT (mhsink, "Removing buffer %p (%d) with refcount %d", buf,
-          i, GST_MINI_OBJECT_REFCOUNT (buf));
-      gst_buffer_unref (buf);
-      mhsink->bufqueue = g_array_remove_index (mhsink->bufqueue, i);
-    }
-    /* freeing the array is done in _finalize */
-  }
+  /* remove all queued buffers, freeing the ring is done in _finalize */
+  GST_DEBUG_OBJECT (mhsink, "Emptying queue with %u buffers",
+      mhsink->queue_len);
+  gst_multi_handle_sink_queue_trim (mhsink, 0);
+  mhsink->index_time = GST_CLOCK_TIME_NONE;
+  mhsink->pacing_start_time = GST_CLOCK_TIME_NONE;
   GST_OBJECT_FLAG_UNSET (mhsink, GST_MULTI_HANDLE_SINK_OPEN);
 
   return TRUE;
@@ -47,6 +47,7 @@ G_BEGIN_DECLS
 
 typedef struct _GstMultiHandleSink GstMultiHandleSink;
 typedef struct _GstMultiHandleSinkClass GstMultiHandleSinkClass;
+typedef struct _GstMultiHandleSinkQueueEntry GstMultiHandleSinkQueueEntry;
 
 typedef enum {
   GST_MULTI_HANDLE_SINK_OPEN             = (GST_ELEMENT_FLAG_LAST << 0),
@@ -129,6 +130,11 @@ typedef union
   GSocket *socket;
 } GstMultiSinkHandle;
 
+/* number of buckets of the send latency histogram, bucket 0 counts the
+ * buffers sent within a millisecond, bucket n those sent within 2^n
+ * milliseconds */
+#define GST_MULTI_HANDLE_SINK_LATENCY_BUCKETS 16
+
 /* structure for a client
  */
 typedef struct {
@@ -136,13 +142,15 @@ typedef struct {
 
   gchar debug[30];              /* a debug string used in debug calls to
                                    identify the client */
-  gint bufpos;                  /* position of this client in the global queue */
+  gint bufpos;                  /* position of the buffer that this client
+                                   sends next in the global queue */
   gint flushcount;              /* the remaining number of buffers to flush out or -1 if the 
                                    client is not flushing. */
 
   GstClientStatus status;
 
-  GSList *sending;              /* the buffers we need to send */
+  GSList *sending;              /* buffers to send before the global queue,
+                                   like stream headers */
   gint bufoffset;               /* offset in the first buffer */
 
   gboolean discont;
@@ -166,9 +174,23 @@ typedef struct {
   guint64 disconnect_time;
   guint64 last_activity_time;
   guint64 dropped_buffers;
-  guint64 avg_queue_size;
   guint64 first_buffer_ts;
   guint64 last_buffer_ts;
+  guint64 writes;               /* number of write system calls */
+  guint64 writes_would_block;   /* writes that could not send anything */
+  guint64 queue_size_sum;       /* sum of the sampled queue sizes */
+  guint64 queue_size_samples;   /* number of sampled queue sizes */
+  gint max_queue_size;
+  guint64 latency[GST_MULTI_HANDLE_SINK_LATENCY_BUCKETS]; /* histogram of the
+                                   time between queueing and sending buffers */
+
+  /* pacing */
+  guint64 pacing_rate;          /* bytes per second, 0 when not paced */
+  gint64 pacing_time;           /* monotonic time at which the data sent so
+                                   far is paced out */
+  guint64 pacing_socket_rate;   /* the rate that was set on the socket */
+
+  gboolean ktls;                /* kernel TLS is configured on the socket */
 } GstMultiHandleClient;
 
 #define CLIENTS_LOCK_INIT(mhsink)       (g_rec_mutex_init(&(mhsink)->clientslock))
@@ -177,9 +199,24 @@ typedef struct {
 #define CLIENTS_UNLOCK(mhsink)          (g_rec_mutex_unlock(&(mhsink)->clientslock))
 
 gint gst_multi_handle_sink_setup_dscp_client (GstMultiHandleSink * sink, GstMultiHandleClient * client);
+void gst_multi_handle_sink_setup_tcp_client (GstMultiHandleSink * sink,
+    GstMultiHandleClient * client);
 gint
 gst_multi_handle_sink_new_client_position (GstMultiHandleSink * sink,
     GstMultiHandleClient * client);
+guint gst_multi_handle_sink_client_get_buffers (GstMultiHandleSink * sink,
+    GstMultiHandleClient * client, GstBuffer ** buffers, guint max);
+gboolean gst_multi_handle_sink_client_has_more (GstMultiHandleSink * sink,
+    GstMultiHandleClient * client, guint n_bufs);
+void gst_multi_handle_sink_client_consume (GstMultiHandleSink * sink,
+    GstMultiHandleClient * client, gsize bytes);
+gssize gst_multi_handle_sink_client_pacing_budget (GstMultiHandleSink * sink,
+    GstMultiHandleClient * client, GstClockTime * wait);
+void gst_multi_handle_sink_client_pacing_sent (GstMultiHandleSink * sink,
+    GstMultiHandleClient * client, gsize bytes);
+
+/* maximum number of buffers that are written with one system call */
+#define GST_MULTI_HANDLE_SINK_MAX_VECTORS 64
 
 /**
  * GstMultiHandleSink:
@@ -194,6 +231,7 @@ struct _GstMultiHandleSink {
   guint64 bytes_served; /* how much bytes have we served */
 
   GRecMutex clientslock;  /* lock to protect the clients list */
+  GMutex addlock;       /* serializes adding clients, not taken by render */
   GList *clients;       /* list of clients we are serving */
   guint clients_cookie; /* Cookie to detect changes to the clients list */
 
@@ -207,7 +245,13 @@ struct _GstMultiHandleSink {
 
   gint qos_dscp;
 
-  GArray *bufqueue;     /* global queue of buffers */
+  GstMultiHandleSinkQueueEntry *queue; /* global queue of buffers */
+  guint queue_size;     /* allocated size of the queue, a power of 2 */
+  guint queue_len;      /* number of queued buffers */
+  GArray *syncframes;   /* sequence numbers of the queued sync frames */
+  guint64 index_seq;    /* sequence number of the next buffer */
+  guint64 index_bytes;  /* bytes queued so far */
+  GstClockTime index_time; /* last timestamp queued */
 
   gboolean running;     /* the thread state */
   GThread *thread;      /* the sender thread */
@@ -232,6 +276,18 @@ struct _GstMultiHandleSink {
   gint   buffers_min;   /* min number of buffers to queue */
 
   gboolean resend_streamheader; /* resend streamheader if it changes */
+  guint send_batch_bytes; /* max bytes to write with one system call */
+
+  gboolean pacing;      /* pace the data sent to clients */
+  guint pacing_bitrate; /* bits per second, 0 = measure the stream */
+  guint64 pacing_start_bytes; /* bytes queued before pacing_start_time */
+  GstClockTime pacing_start_time; /* first timestamp queued */
+
+  GstClockTime stats_interval; /* interval of the stats messages */
+  gint64 stats_time;    /* monotonic time of the last stats message */
+
+  guint notsent_lowat;  /* TCP_NOTSENT_LOWAT of the clients, 0 = default */
+  gboolean cork;        /* send with MSG_MORE when more data is queued */
 
   /* stats */
   gint buffers_queued;  /* number of queued buffers */
@@ -248,11 +304,6 @@ struct _GstMultiHandleSinkClass {
   void          (*stop_post)    (GstMultiHandleSink *sink);
   gboolean      (*start_pre)    (GstMultiHandleSink *sink);
   gpointer      (*thread)       (GstMultiHandleSink *sink);
-  /* called by subclass when it has a new buffer to queue for a client */
-  gboolean      (*client_queue_buffer)
-                                (GstMultiHandleSink *sink,
-                                 GstMultiHandleClient *client,
-                                 GstBuffer *buffer);
   int           (*client_get_fd)
                                 (GstMultiHandleClient *client);
   void          (*client_free)  (GstMultiHandleSink   *mhsink,
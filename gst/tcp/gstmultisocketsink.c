@@ -50,7 +50,9 @@
  * Multisocketsink internally keeps a queue of the incoming buffers and uses a
  * separate thread to send the buffers to the clients. This ensures that no
  * client write can block the pipeline and that clients can read with different
- * speeds.
+ * speeds. With many clients, the #GstMultiSocketSink:n-threads property can be
+ * used to spread the clients over several threads that each wait on their own
+ * set of sockets.
  *
  * When adding a client to multisocketsink, the #GstMultiSocketSink:sync-method property will define
  * which buffer in the queued buffers will be sent first to the client. Clients 
@@ -107,13 +109,24 @@
 #include <gst/gst-i18n-plugin.h>
 
 #include <string.h>
+#include <errno.h>
 
 #include "gstmultisocketsink.h"
 
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
 #ifndef G_OS_WIN32
 #include <netinet/in.h>
 #endif
 
+#if defined (HAVE_LINUX_ERRQUEUE_H) && defined (MSG_ZEROCOPY) && \
+    defined (SO_ZEROCOPY)
+#include <linux/errqueue.h>
+#define HAVE_MSG_ZEROCOPY 1
+#endif
+
 #define NOT_IMPLEMENTED 0
 
 GST_DEBUG_CATEGORY_STATIC (multisocketsink_debug);
@@ -137,13 +150,35 @@ enum
   LAST_SIGNAL
 };
 
+#define DEFAULT_N_THREADS 1
+#define DEFAULT_ZEROCOPY FALSE
+
+/* smaller sends are cheaper to copy than to pin and track */
+#define ZEROCOPY_MIN_SIZE (16 * 1024)
+
 enum
 {
   PROP_0,
-
+  PROP_N_THREADS,
+  PROP_ZEROCOPY,
   PROP_LAST
 };
 
+/* the buffers of a zerocopy send, kept until the kernel is done with them */
+typedef struct
+{
+  guint32 id;
+  guint n_bufs;
+  GstBuffer *bufs[GST_MULTI_HANDLE_SINK_MAX_VECTORS];
+} GstMultiSocketSinkZerocopy;
+
+/* data of the timeout that resumes a paced client */
+typedef struct
+{
+  GstMultiSocketSink *sink;
+  GSocket *socket;
+} GstMultiSocketSinkPacing;
+
 static void gst_multi_socket_sink_finalize (GObject * object);
 
 static void gst_multi_socket_sink_add (GstMultiSocketSink * sink,
@@ -167,6 +202,8 @@ static void gst_multi_socket_sink_stop_pre (GstMultiHandleSink * mhsink);
 static void gst_multi_socket_sink_stop_post (GstMultiHandleSink * mhsink);
 static gboolean gst_multi_socket_sink_start_pre (GstMultiHandleSink * mhsink);
 static gpointer gst_multi_socket_sink_thread (GstMultiHandleSink * mhsink);
+static gpointer gst_multi_socket_sink_worker_thread (GstMultiSocketSinkWorker *
+    worker);
 static GstMultiHandleClient
     * gst_multi_socket_sink_new_client (GstMultiHandleSink * mhsink,
     GstMultiSinkHandle handle, GstSyncMethod sync_method);
@@ -185,6 +222,8 @@ static void gst_multi_socket_sink_hash_removing (GstMultiHandleSink * mhsink,
 
 static gboolean gst_multi_socket_sink_socket_condition (GstMultiSinkHandle
     handle, GIOCondition condition, GstMultiSocketSink * sink);
+static GMainContext *gst_multi_socket_sink_client_context (GstMultiSocketSink *
+    sink, GstSocketClient * client);
 
 static gboolean gst_multi_socket_sink_unlock (GstBaseSink * bsink);
 static gboolean gst_multi_socket_sink_unlock_stop (GstBaseSink * bsink);
@@ -217,6 +256,39 @@ gst_multi_socket_sink_class_init (GstMultiSocketSinkClass * klass)
   gobject_class->get_property = gst_multi_socket_sink_get_property;
   gobject_class->finalize = gst_multi_socket_sink_finalize;
 
+  /**
+   * GstMultiSocketSink:n-threads:
+   *
+   * The number of threads used to serve the clients. Each thread waits on
+   * the sockets of its own share of the clients, new clients are handed
+   * out to the threads in turn. The value is used when the element goes
+   * to the READY state.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Number of threads used to serve the clients "
+          "(0 = number of processors)", 0, G_MAXUINT, DEFAULT_N_THREADS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstMultiSocketSink:zerocopy:
+   *
+   * Send large batches of data to the clients with MSG_ZEROCOPY, so that
+   * the kernel sends from the memory of the buffers instead of copying it.
+   * The buffers are kept until the kernel reports that it is done with
+   * them. Clients whose socket or kernel does not support it, or for which
+   * the kernel copies the data anyway, are served with normal writes. The
+   * value is used for clients that are added afterwards.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_ZEROCOPY,
+      g_param_spec_boolean ("zerocopy", "Zerocopy",
+          "Send to the clients without copying the data when possible",
+          DEFAULT_ZEROCOPY, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   /**
    * GstMultiSocketSink::add:
    * @gstmultisocketsink: the multisocketsink element to emit this signal on
@@ -405,6 +477,8 @@ gst_multi_socket_sink_init (GstMultiSocketSink * this)
   mhsink->handle_hash = g_hash_table_new (g_direct_hash, g_int_equal);
 
   this->cancellable = g_cancellable_new ();
+  this->n_threads = DEFAULT_N_THREADS;
+  this->zerocopy = DEFAULT_ZEROCOPY;
 }
 
 static void
@@ -498,6 +572,9 @@ gst_multi_socket_sink_new_client (GstMultiHandleSink * mhsink,
   GstMultiHandleClient *mhclient;
   GstMultiHandleSinkClass *mhsinkclass =
       GST_MULTI_HANDLE_SINK_GET_CLASS (mhsink);
+#ifdef HAVE_MSG_ZEROCOPY
+  gboolean zerocopy;
+#endif
 
   /* create client datastructure */
   g_assert (G_IS_SOCKET (handle.socket));
@@ -505,17 +582,36 @@ gst_multi_socket_sink_new_client (GstMultiHandleSink * mhsink,
   mhclient = (GstMultiHandleClient *) client;
 
   mhclient->handle.socket = G_SOCKET (g_object_ref (handle.socket));
+  /* clients are made without the clients lock */
+  client->shard =
+      g_atomic_int_add ((gint *) & GST_MULTI_SOCKET_SINK (mhsink)->next_shard,
+      1);
 
   gst_multi_handle_sink_client_init (mhclient, sync_method);
   mhsinkclass->handle_debug (handle, mhclient->debug);
 
-  /* set the socket to non blocking */
+  /* set the socket to non blocking, it is watched once it was added */
   g_socket_set_blocking (handle.socket, FALSE);
 
-  /* we always read from a client */
-  mhsinkclass->hash_adding (mhsink, mhclient);
-
   gst_multi_handle_sink_setup_dscp_client (mhsink, mhclient);
+  gst_multi_handle_sink_setup_tcp_client (mhsink, mhclient);
+
+#ifdef HAVE_MSG_ZEROCOPY
+  GST_OBJECT_LOCK (mhsink);
+  zerocopy = GST_MULTI_SOCKET_SINK (mhsink)->zerocopy;
+  GST_OBJECT_UNLOCK (mhsink);
+
+  /* kernel TLS does its own copy into the records */
+  if (zerocopy && !mhclient->ktls) {
+    gint one = 1;
+
+    client->zerocopy = setsockopt (g_socket_get_fd (handle.socket),
+        SOL_SOCKET, SO_ZEROCOPY, &one, sizeof (one)) == 0;
+    if (!client->zerocopy)
+      GST_DEBUG_OBJECT (mhsink, "%s does not support zerocopy: %s",
+          mhclient->debug, g_strerror (errno));
+  }
+#endif
 
   return mhclient;
 }
@@ -526,12 +622,29 @@ gst_multi_socket_sink_client_get_fd (GstMultiHandleClient * client)
   return g_socket_get_fd (client->handle.socket);
 }
 
+static void
+gst_multi_socket_sink_zerocopy_free (GstMultiSocketSinkZerocopy * zc)
+{
+  guint i;
+
+  for (i = 0; i < zc->n_bufs; i++)
+    gst_buffer_unref (zc->bufs[i]);
+  g_slice_free (GstMultiSocketSinkZerocopy, zc);
+}
+
 static void
 gst_multi_socket_sink_client_free (GstMultiHandleSink * mhsink,
     GstMultiHandleClient * client)
 {
+  GstSocketClient *sclient = (GstSocketClient *) client;
+
   g_assert (G_IS_SOCKET (client->handle.socket));
 
+  /* the socket is closed, the kernel keeps the pages it still sends from */
+  while (!g_queue_is_empty (&sclient->zerocopy_pending))
+    gst_multi_socket_sink_zerocopy_free (g_queue_pop_head
+        (&sclient->zerocopy_pending));
+
   g_signal_emit (mhsink,
       gst_multi_socket_sink_signals[SIGNAL_CLIENT_SOCKET_REMOVED], 0,
       client->handle.socket);
@@ -593,7 +706,9 @@ gst_multi_socket_sink_handle_client_read (GstMultiSocketSink * sink,
     } else if (nread < 0) {
       GST_WARNING_OBJECT (sink, "%s could not read: %s",
           mhclient->debug, err->message);
-      mhclient->status = GST_CLIENT_STATUS_ERROR;
+      /* kernel TLS fails reads of the close_notify alert of the peer */
+      mhclient->status = mhclient->ktls ? GST_CLIENT_STATUS_CLOSED :
+          GST_CLIENT_STATUS_ERROR;
       ret = FALSE;
       break;
     }
@@ -604,6 +719,156 @@ gst_multi_socket_sink_handle_client_read (GstMultiSocketSink * sink,
   return ret;
 }
 
+/* called when a paced client can send again */
+static gboolean
+gst_multi_socket_sink_pacing_timeout (GstMultiSocketSinkPacing * pacing)
+{
+  GstMultiHandleSink *mhsink = GST_MULTI_HANDLE_SINK (pacing->sink);
+  GstMultiHandleSinkClass *mhsinkclass =
+      GST_MULTI_HANDLE_SINK_GET_CLASS (mhsink);
+  GstMultiSinkHandle handle;
+  GList *clink;
+
+  handle.socket = pacing->socket;
+
+  CLIENTS_LOCK (mhsink);
+  /* the client might have been removed in the meantime */
+  clink = g_hash_table_lookup (mhsink->handle_hash,
+      mhsinkclass->handle_hash_key (handle));
+  if (clink) {
+    GstSocketClient *client = clink->data;
+
+    if (client->pacing_source == g_main_current_source ()) {
+      g_source_unref (client->pacing_source);
+      client->pacing_source = NULL;
+      mhsinkclass->hash_adding (mhsink, (GstMultiHandleClient *) client);
+    }
+  }
+  CLIENTS_UNLOCK (mhsink);
+
+  return FALSE;
+}
+
+static void
+gst_multi_socket_sink_pacing_free (GstMultiSocketSinkPacing * pacing)
+{
+  g_object_unref (pacing->socket);
+  gst_object_unref (pacing->sink);
+  g_slice_free (GstMultiSocketSinkPacing, pacing);
+}
+
+/* stop watching @client for writing and only continue after @wait */
+static void
+gst_multi_socket_sink_pace_client (GstMultiSocketSink * sink,
+    GstSocketClient * client, GstClockTime wait)
+{
+  GstMultiHandleClient *mhclient = (GstMultiHandleClient *) client;
+  GstMultiSocketSinkPacing *pacing;
+
+  if (client->source) {
+    g_source_destroy (client->source);
+    g_source_unref (client->source);
+    client->source = NULL;
+  }
+  if (client->pacing_source)
+    return;
+
+  pacing = g_slice_new (GstMultiSocketSinkPacing);
+  pacing->sink = gst_object_ref (sink);
+  pacing->socket = g_object_ref (mhclient->handle.socket);
+
+  client->pacing_source = g_timeout_source_new (MAX (wait / GST_MSECOND, 1));
+  g_source_set_callback (client->pacing_source,
+      (GSourceFunc) gst_multi_socket_sink_pacing_timeout, pacing,
+      (GDestroyNotify) gst_multi_socket_sink_pacing_free);
+  g_source_attach (client->pacing_source,
+      gst_multi_socket_sink_client_context (sink, client));
+}
+
+#ifdef HAVE_MSG_ZEROCOPY
+/* keep the buffers of a zerocopy send of @client until the kernel reports
+ * that it completed */
+static void
+gst_multi_socket_sink_client_track_zerocopy (GstSocketClient * client,
+    GstBuffer ** bufs, guint n_bufs)
+{
+  GstMultiSocketSinkZerocopy *zc;
+  guint i;
+
+  zc = g_slice_new (GstMultiSocketSinkZerocopy);
+  zc->id = client->zerocopy_next++;
+  zc->n_bufs = n_bufs;
+  for (i = 0; i < n_bufs; i++)
+    zc->bufs[i] = gst_buffer_ref (bufs[i]);
+
+  g_queue_push_tail (&client->zerocopy_pending, zc);
+}
+
+/* release the sends of @client that the kernel reported complete on the
+ * error queue of the socket, returns FALSE when the socket has a real
+ * error */
+static gboolean
+gst_multi_socket_sink_client_reap_zerocopy (GstMultiSocketSink * sink,
+    GstSocketClient * client)
+{
+  GstMultiHandleClient *mhclient = (GstMultiHandleClient *) client;
+  gint fd = g_socket_get_fd (mhclient->handle.socket);
+  gint error = 0;
+  socklen_t len = sizeof (error);
+
+  for (;;) {
+    gchar control[CMSG_SPACE (sizeof (struct sock_extended_err)) + 64];
+    struct msghdr msg = { 0, };
+    struct cmsghdr *cmsg;
+
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof (control);
+
+    if (recvmsg (fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+      break;
+
+    for (cmsg = CMSG_FIRSTHDR (&msg); cmsg; cmsg = CMSG_NXTHDR (&msg, cmsg)) {
+      struct sock_extended_err *serr;
+      GList *walk, *next;
+      guint32 lo, hi;
+
+      if (!(cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) &&
+          !(cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR))
+        continue;
+
+      serr = (struct sock_extended_err *) CMSG_DATA (cmsg);
+      if (serr->ee_errno != 0 || serr->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+        continue;
+
+      /* the range of send ids that completed, it can wrap around */
+      lo = serr->ee_info;
+      hi = serr->ee_data;
+      for (walk = client->zerocopy_pending.head; walk; walk = next) {
+        GstMultiSocketSinkZerocopy *zc = walk->data;
+
+        next = walk->next;
+        if ((guint32) (zc->id - lo) <= (guint32) (hi - lo)) {
+          gst_multi_socket_sink_zerocopy_free (zc);
+          g_queue_delete_link (&client->zerocopy_pending, walk);
+        }
+      }
+
+      /* pinning the pages was useless, like for local peers */
+      if ((serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) && client->zerocopy) {
+        GST_DEBUG_OBJECT (sink, "kernel copied zerocopy data of %s, using "
+            "normal writes", mhclient->debug);
+        client->zerocopy = FALSE;
+      }
+    }
+  }
+
+  if (getsockopt (fd, SOL_SOCKET, SO_ERROR, &error, &len) < 0)
+    return FALSE;
+
+  return error == 0;
+}
+#endif
+
 /* Handle a write on a client,
  * which indicates a read request from a client.
  *
@@ -614,12 +879,12 @@ gst_multi_socket_sink_handle_client_read (GstMultiSocketSink * sink,
  *
  * Then we run into the main loop that tries to send as many buffers as
  * possible. It will first exhaust the mhclient->sending queue and if the queue
- * is empty, it will pick a buffer from the global queue.
+ * is empty, it will send the buffers of the global queue from the position
+ * of the client.
  *
- * Sending the buffers from the mhclient->sending queue is basically writing
- * the bytes to the socket and maintaining a count of the bytes that were
- * sent. When the buffer is completely sent, it is removed from the
- * mhclient->sending queue and we try to pick a new buffer for sending.
+ * Sending the buffers is basically writing the bytes to the socket and
+ * maintaining a count of the bytes that were sent. When a buffer is
+ * completely sent, the client moves on to the next one.
  *
  * When the sending returns a partial buffer we stop sending more data as
  * the next send operation could block.
@@ -637,9 +902,6 @@ gst_multi_socket_sink_handle_client_write (GstMultiSocketSink * sink,
   GError *err = NULL;
   GstMultiHandleSink *mhsink = GST_MULTI_HANDLE_SINK (sink);
   GstMultiHandleClient *mhclient = (GstMultiHandleClient *) client;
-  GstMultiHandleSinkClass *mhsinkclass =
-      GST_MULTI_HANDLE_SINK_GET_CLASS (mhsink);
-
 
   g_get_current_time (&nowtv);
   now = GST_TIMEVAL_TO_TIME (nowtv);
@@ -648,9 +910,9 @@ gst_multi_socket_sink_handle_client_write (GstMultiSocketSink * sink,
 
   more = TRUE;
   do {
-    gint maxsize;
+    gssize maxsize;
 
-    if (!mhclient->sending) {
+    if (!mhclient->sending && mhclient->bufoffset == 0) {
       /* client is not working on a buffer */
       if (mhclient->bufpos == -1) {
         /* client is too fast, remove from write queue until new buffer is
@@ -668,10 +930,6 @@ gst_multi_socket_sink_handle_client_write (GstMultiSocketSink * sink,
 
         return TRUE;
       } else {
-        /* client can pick a buffer from the global queue */
-        GstBuffer *buf;
-        GstClockTime timestamp;
-
         /* for new connections, we need to find a good spot in the
          * bufqueue to start streaming from */
         if (mhclient->new_connection && !flushing) {
@@ -698,57 +956,96 @@ gst_multi_socket_sink_handle_client_write (GstMultiSocketSink * sink,
         /* we flushed all remaining buffers, no need to get a new one */
         if (mhclient->flushcount == 0)
           goto flushed;
+      }
+    }
 
-        /* grab buffer */
-        buf = g_array_index (mhsink->bufqueue, GstBuffer *, mhclient->bufpos);
-        mhclient->bufpos--;
+    /* send the buffers that are next for the client */
+    {
+      gssize wrote, budget;
+      GOutputVector vecs[GST_MULTI_HANDLE_SINK_MAX_VECTORS];
+      GstBuffer *bufs[GST_MULTI_HANDLE_SINK_MAX_VECTORS];
+      GstMapInfo maps[GST_MULTI_HANDLE_SINK_MAX_VECTORS];
+      guint n_bufs;
+      gint i, n_vecs, flags;
+      GstClockTime wait;
+
+      budget =
+          gst_multi_handle_sink_client_pacing_budget (mhsink, mhclient, &wait);
+      if (budget == 0) {
+        gst_multi_socket_sink_pace_client (sink, client, wait);
+        return TRUE;
+      }
 
-        /* update stats */
-        timestamp = GST_BUFFER_TIMESTAMP (buf);
-        if (mhclient->first_buffer_ts == GST_CLOCK_TIME_NONE)
-          mhclient->first_buffer_ts = timestamp;
-        if (timestamp != -1)
-          mhclient->last_buffer_ts = timestamp;
+      n_bufs =
+          gst_multi_handle_sink_client_get_buffers (mhsink, mhclient, bufs,
+          GST_MULTI_HANDLE_SINK_MAX_VECTORS);
 
-        /* decrease flushcount */
-        if (mhclient->flushcount != -1)
-          mhclient->flushcount--;
+      maxsize = 0;
+      for (n_vecs = 0; n_vecs < (gint) n_bufs;) {
+        gsize offset = n_vecs == 0 ? mhclient->bufoffset : 0;
 
-        GST_LOG_OBJECT (sink, "%s client %p at position %d",
-            mhclient->debug, client, mhclient->bufpos);
+        if (!gst_buffer_map (bufs[n_vecs], &maps[n_vecs], GST_MAP_READ))
+          break;
 
-        /* queueing a buffer will ref it */
-        mhsinkclass->client_queue_buffer (mhsink, mhclient, buf);
+        vecs[n_vecs].buffer = maps[n_vecs].data + offset;
+        vecs[n_vecs].size = maps[n_vecs].size - offset;
+        maxsize += vecs[n_vecs].size;
+        n_vecs++;
 
-        /* need to start from the first byte for this new buffer */
-        mhclient->bufoffset = 0;
+        if (maxsize >= budget) {
+          vecs[n_vecs - 1].size -= maxsize - budget;
+          maxsize = budget;
+          break;
+        }
       }
-    }
-
-    /* see if we need to send something */
-    if (mhclient->sending) {
-      gssize wrote;
-      GstBuffer *head;
-      GstMapInfo map;
-
-      /* pick first buffer from list */
-      head = GST_BUFFER (mhclient->sending->data);
-
-      gst_buffer_map (head, &map, GST_MAP_READ);
-      maxsize = map.size - mhclient->bufoffset;
+      if (n_vecs == 0)
+        g_return_val_if_reached (FALSE);
+
+      flags = 0;
+#ifdef MSG_MORE
+      /* paced clients have to send what they can right away */
+      if (budget == G_MAXSSIZE &&
+          gst_multi_handle_sink_client_has_more (mhsink, mhclient, n_vecs))
+        flags |= MSG_MORE;
+#endif
+#ifdef HAVE_MSG_ZEROCOPY
+      if (client->zerocopy && maxsize >= ZEROCOPY_MIN_SIZE)
+        flags |= MSG_ZEROCOPY;
+#endif
 
       /* FIXME: specific */
-      /* try to write the complete buffer */
-
+      /* try to write all of the buffers */
       wrote =
-          g_socket_send (mhclient->handle.socket,
-          (gchar *) map.data + mhclient->bufoffset, maxsize, sink->cancellable,
-          &err);
-      gst_buffer_unmap (head, &map);
+          g_socket_send_message (mhclient->handle.socket, NULL, vecs, n_vecs,
+          NULL, 0, flags, sink->cancellable, &err);
+#ifdef HAVE_MSG_ZEROCOPY
+      if (flags & MSG_ZEROCOPY) {
+        if (wrote >= 0) {
+          gst_multi_socket_sink_client_track_zerocopy (client, bufs, n_vecs);
+        } else if (!g_error_matches (err, G_IO_ERROR, G_IO_ERROR_WOULD_BLOCK)
+            && !g_error_matches (err, G_IO_ERROR, G_IO_ERROR_CLOSED)) {
+          /* the pages could not be pinned, copy them this time */
+          GST_DEBUG_OBJECT (sink, "zerocopy send to %s failed: %s",
+              mhclient->debug, err->message);
+          g_clear_error (&err);
+          wrote =
+              g_socket_send_message (mhclient->handle.socket, NULL, vecs,
+              n_vecs, NULL, 0, flags & ~MSG_ZEROCOPY, sink->cancellable, &err);
+        }
+      }
+#endif
+      for (i = 0; i < n_vecs; i++)
+        gst_buffer_unmap (bufs[i], &maps[i]);
+      mhclient->writes++;
 
       if (wrote < 0) {
         /* hmm error.. */
-        if (g_error_matches (err, G_IO_ERROR, G_IO_ERROR_CLOSED)) {
+        if (g_error_matches (err, G_IO_ERROR, G_IO_ERROR_WOULD_BLOCK)) {
+          /* nothing serious, resource was unavailable, try again later */
+          mhclient->writes_would_block++;
+          g_clear_error (&err);
+          more = FALSE;
+        } else if (g_error_matches (err, G_IO_ERROR, G_IO_ERROR_CLOSED)) {
           goto connection_reset;
         } else {
           goto write_error;
@@ -760,15 +1057,11 @@ gst_multi_socket_sink_handle_client_write (GstMultiSocketSink * sink,
           GST_LOG_OBJECT (sink,
               "partial write on %p of %" G_GSSIZE_FORMAT " bytes",
               mhclient->handle.socket, wrote);
-          mhclient->bufoffset += wrote;
           more = FALSE;
-        } else {
-          /* complete buffer was written, we can proceed to the next one */
-          mhclient->sending = g_slist_remove (mhclient->sending, head);
-          gst_buffer_unref (head);
-          /* make sure we start from byte 0 for the next buffer */
-          mhclient->bufoffset = 0;
         }
+        /* drop the buffers that were written completely */
+        gst_multi_handle_sink_client_consume (mhsink, mhclient, wrote);
+        gst_multi_handle_sink_client_pacing_sent (mhsink, mhclient, wrote);
         /* update stats */
         mhclient->bytes_sent += wrote;
         mhclient->last_activity_time = now;
@@ -805,6 +1098,19 @@ write_error:
   }
 }
 
+/* the context of the thread that serves @client */
+static GMainContext *
+gst_multi_socket_sink_client_context (GstMultiSocketSink * sink,
+    GstSocketClient * client)
+{
+  guint shard = client->shard % (sink->n_workers + 1);
+
+  if (shard == 0)
+    return sink->main_context;
+
+  return sink->workers[shard - 1].context;
+}
+
 static void
 gst_multi_socket_sink_hash_adding (GstMultiHandleSink * mhsink,
     GstMultiHandleClient * mhclient)
@@ -815,6 +1121,10 @@ gst_multi_socket_sink_hash_adding (GstMultiHandleSink * mhsink,
   if (!sink->main_context)
     return;
 
+  /* a paced client is watched again when its pacing is over */
+  if (client->pacing_source)
+    return;
+
   if (!client->source) {
     client->source =
         g_socket_create_source (mhclient->handle.socket,
@@ -822,7 +1132,8 @@ gst_multi_socket_sink_hash_adding (GstMultiHandleSink * mhsink,
     g_source_set_callback (client->source,
         (GSourceFunc) gst_multi_socket_sink_socket_condition,
         gst_object_ref (sink), (GDestroyNotify) gst_object_unref);
-    g_source_attach (client->source, sink->main_context);
+    g_source_attach (client->source,
+        gst_multi_socket_sink_client_context (sink, client));
   }
 }
 
@@ -837,6 +1148,11 @@ gst_multi_socket_sink_hash_removing (GstMultiHandleSink * mhsink,
     g_source_unref (client->source);
     client->source = NULL;
   }
+  if (client->pacing_source) {
+    g_source_destroy (client->pacing_source);
+    g_source_unref (client->pacing_source);
+    client->pacing_source = NULL;
+  }
 }
 
 /* Handle the clients. This is called when a socket becomes ready
@@ -873,6 +1189,15 @@ gst_multi_socket_sink_socket_condition (GstMultiSinkHandle handle,
     goto done;
   }
 
+#ifdef HAVE_MSG_ZEROCOPY
+  /* completed zerocopy sends are reported on the error queue */
+  if ((condition & G_IO_ERR) && (client->zerocopy ||
+          !g_queue_is_empty (&client->zerocopy_pending))) {
+    if (gst_multi_socket_sink_client_reap_zerocopy (sink, client))
+      condition &= ~G_IO_ERR;
+  }
+#endif
+
   if ((condition & G_IO_ERR)) {
     GST_WARNING_OBJECT (sink, "%s has error", mhclient->debug);
     mhclient->status = GST_CLIENT_STATUS_ERROR;
@@ -942,6 +1267,11 @@ gst_multi_socket_sink_thread (GstMultiHandleSink * mhsink)
 {
   GstMultiSocketSink *sink = GST_MULTI_SOCKET_SINK (mhsink);
   GSource *timeout = NULL;
+  guint i;
+
+  for (i = 0; i < sink->n_workers; i++)
+    sink->workers[i].thread = g_thread_new ("multisocketsink",
+        (GThreadFunc) gst_multi_socket_sink_worker_thread, &sink->workers[i]);
 
   while (mhsink->running) {
     if (mhsink->timeout > 0) {
@@ -965,6 +1295,24 @@ gst_multi_socket_sink_thread (GstMultiHandleSink * mhsink)
     }
   }
 
+  for (i = 0; i < sink->n_workers; i++) {
+    g_thread_join (sink->workers[i].thread);
+    sink->workers[i].thread = NULL;
+  }
+
+  return NULL;
+}
+
+/* the additional threads only serve their clients, the timeouts and the
+ * sources of subclasses are handled by the main thread above */
+static gpointer
+gst_multi_socket_sink_worker_thread (GstMultiSocketSinkWorker * worker)
+{
+  GstMultiHandleSink *mhsink = GST_MULTI_HANDLE_SINK (worker->sink);
+
+  while (mhsink->running)
+    g_main_context_iteration (worker->context, TRUE);
+
   return NULL;
 }
 
@@ -972,8 +1320,19 @@ static void
 gst_multi_socket_sink_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec)
 {
-  switch (prop_id) {
+  GstMultiSocketSink *sink = GST_MULTI_SOCKET_SINK (object);
 
+  switch (prop_id) {
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (sink);
+      sink->n_threads = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (sink);
+      break;
+    case PROP_ZEROCOPY:
+      GST_OBJECT_LOCK (sink);
+      sink->zerocopy = g_value_get_boolean (value);
+      GST_OBJECT_UNLOCK (sink);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -984,7 +1343,19 @@ static void
 gst_multi_socket_sink_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec)
 {
+  GstMultiSocketSink *sink = GST_MULTI_SOCKET_SINK (object);
+
   switch (prop_id) {
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (sink);
+      g_value_set_uint (value, sink->n_threads);
+      GST_OBJECT_UNLOCK (sink);
+      break;
+    case PROP_ZEROCOPY:
+      GST_OBJECT_LOCK (sink);
+      g_value_set_boolean (value, sink->zerocopy);
+      GST_OBJECT_UNLOCK (sink);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -998,11 +1369,33 @@ gst_multi_socket_sink_start_pre (GstMultiHandleSink * mhsink)
   GstMultiHandleSinkClass *mhsinkclass =
       GST_MULTI_HANDLE_SINK_GET_CLASS (mhsink);
   GList *clients;
+  guint i, n_threads;
 
   GST_INFO_OBJECT (mssink, "starting");
 
   mssink->main_context = g_main_context_new ();
 
+  GST_OBJECT_LOCK (mssink);
+  n_threads = mssink->n_threads;
+  GST_OBJECT_UNLOCK (mssink);
+  if (n_threads == 0) {
+#if GLIB_CHECK_VERSION(2,36,0)
+    n_threads = g_get_num_processors ();
+#else
+    n_threads = 1;
+#endif
+  }
+
+  /* the main context is served by the thread of the base class, the
+   * contexts of the other threads are created here */
+  mssink->n_workers = n_threads - 1;
+  mssink->workers = g_new0 (GstMultiSocketSinkWorker, mssink->n_workers);
+  for (i = 0; i < mssink->n_workers; i++) {
+    mssink->workers[i].sink = mssink;
+    mssink->workers[i].context = g_main_context_new ();
+  }
+  GST_DEBUG_OBJECT (mssink, "serving clients with %u threads", n_threads);
+
   CLIENTS_LOCK (mhsink);
   for (clients = mhsink->clients; clients; clients = clients->next) {
     GstSocketClient *client = clients->data;
@@ -1023,24 +1416,40 @@ multisocketsink_hash_remove (gpointer key, gpointer value, gpointer data)
   return TRUE;
 }
 
+static void
+gst_multi_socket_sink_wakeup (GstMultiSocketSink * sink)
+{
+  guint i;
+
+  if (sink->main_context)
+    g_main_context_wakeup (sink->main_context);
+  for (i = 0; i < sink->n_workers; i++)
+    g_main_context_wakeup (sink->workers[i].context);
+}
+
 static void
 gst_multi_socket_sink_stop_pre (GstMultiHandleSink * mhsink)
 {
   GstMultiSocketSink *mssink = GST_MULTI_SOCKET_SINK (mhsink);
 
-  if (mssink->main_context)
-    g_main_context_wakeup (mssink->main_context);
+  gst_multi_socket_sink_wakeup (mssink);
 }
 
 static void
 gst_multi_socket_sink_stop_post (GstMultiHandleSink * mhsink)
 {
   GstMultiSocketSink *mssink = GST_MULTI_SOCKET_SINK (mhsink);
+  guint i;
 
   if (mssink->main_context) {
     g_main_context_unref (mssink->main_context);
     mssink->main_context = NULL;
   }
+  for (i = 0; i < mssink->n_workers; i++)
+    g_main_context_unref (mssink->workers[i].context);
+  g_free (mssink->workers);
+  mssink->workers = NULL;
+  mssink->n_workers = 0;
 
   g_hash_table_foreach_remove (mhsink->handle_hash, multisocketsink_hash_remove,
       mssink);
@@ -1055,8 +1464,7 @@ gst_multi_socket_sink_unlock (GstBaseSink * bsink)
 
   GST_DEBUG_OBJECT (sink, "set to flushing");
   g_cancellable_cancel (sink->cancellable);
-  if (sink->main_context)
-    g_main_context_wakeup (sink->main_context);
+  gst_multi_socket_sink_wakeup (sink);
 
   return TRUE;
 }
@@ -56,8 +56,22 @@ typedef struct {
   GstMultiHandleClient client;
 
   GSource *source;
+  GSource *pacing_source; /* resumes the client after pacing */
+  guint shard;         /* selects the thread that serves the client */
+
+  gboolean zerocopy;   /* sends large batches with MSG_ZEROCOPY */
+  guint32 zerocopy_next; /* id the kernel gives the next zerocopy send */
+  GQueue zerocopy_pending; /* sends the kernel did not complete yet */
 } GstSocketClient;
 
+/* an additional thread serving a share of the clients */
+typedef struct {
+  GstMultiSocketSink *sink;
+
+  GMainContext *context;
+  GThread *thread;
+} GstMultiSocketSinkWorker;
+
 /**
  * GstMultiSocketSink:
  *
@@ -69,6 +83,13 @@ struct _GstMultiSocketSink {
   /*< private >*/
   GMainContext *main_context;
   GCancellable *cancellable;
+
+  guint n_threads;     /* with LOCK */
+  GstMultiSocketSinkWorker *workers;
+  guint n_workers;
+  guint next_shard;
+
+  gboolean zerocopy;    /* with LOCK */
 };
 
 struct _GstMultiSocketSinkClass {
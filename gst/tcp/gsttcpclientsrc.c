@@ -43,11 +43,18 @@
 #include "gsttcpclientsrc.h"
 #include "gsttcp.h"
 
+#include <errno.h>
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
 GST_DEBUG_CATEGORY_STATIC (tcpclientsrc_debug);
 #define GST_CAT_DEFAULT tcpclientsrc_debug
 
 #define MAX_READ_SIZE                   4 * 1024
 
+#define DEFAULT_MIN_READ_SIZE           0
+
 
 static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src",
     GST_PAD_SRC,
@@ -59,7 +66,8 @@ enum
 {
   PROP_0,
   PROP_HOST,
-  PROP_PORT
+  PROP_PORT,
+  PROP_MIN_READ_SIZE
 };
 
 #define gst_tcp_client_src_parent_class parent_class
@@ -108,6 +116,23 @@ gst_tcp_client_src_class_init (GstTCPClientSrcClass * klass)
       g_param_spec_int ("port", "Port", "The port to receive packets from", 0,
           TCP_HIGHEST_PORT, TCP_DEFAULT_PORT,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstTCPClientSrc:min-read-size:
+   *
+   * Wait until this amount of bytes is available before reading from the
+   * socket, so that high bitrate streams are read with fewer and larger
+   * reads. Where supported, this is set on the socket with SO_RCVLOWAT so
+   * that no wakeups happen before. At most #GstBaseSrc:blocksize bytes are
+   * read into a buffer. 0 reads whatever is available. Changes are applied
+   * to the next connection.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_MIN_READ_SIZE,
+      g_param_spec_uint ("min-read-size", "Minimum read size",
+          "Minimum number of bytes to wait for before reading from the socket "
+          "(0 = read what is available)", 0, G_MAXINT, DEFAULT_MIN_READ_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&srctemplate));
@@ -136,6 +161,8 @@ gst_tcp_client_src_init (GstTCPClientSrc * this)
   this->host = g_strdup (TCP_DEFAULT_HOST);
   this->socket = NULL;
   this->cancellable = g_cancellable_new ();
+  this->min_read_size = DEFAULT_MIN_READ_SIZE;
+  this->pool = NULL;
 
   GST_OBJECT_FLAG_UNSET (this, GST_TCP_CLIENT_SRC_OPEN);
 }
@@ -172,6 +199,73 @@ gst_tcp_client_src_getcaps (GstBaseSrc * bsrc, GstCaps * filter)
   return caps;
 }
 
+/* Gets a buffer of @size bytes from the buffer pool of @src, which holds
+ * buffers of the blocksize and is recreated when the blocksize changes. */
+static GstFlowReturn
+gst_tcp_client_src_alloc_buffer (GstTCPClientSrc * src,
+    gsize size, GstBuffer ** buffer)
+{
+  guint blocksize;
+  GstFlowReturn ret;
+
+  blocksize = gst_base_src_get_blocksize (GST_BASE_SRC (src));
+  if (blocksize == 0)
+    blocksize = MAX_READ_SIZE;
+
+  if (src->pool && src->pool_size != blocksize) {
+    gst_buffer_pool_set_active (src->pool, FALSE);
+    gst_object_unref (src->pool);
+    src->pool = NULL;
+  }
+
+  if (src->pool == NULL) {
+    GstStructure *config;
+
+    src->pool = gst_buffer_pool_new ();
+    config = gst_buffer_pool_get_config (src->pool);
+    gst_buffer_pool_config_set_params (config, NULL, blocksize, 0, 0);
+    if (!gst_buffer_pool_set_config (src->pool, config) ||
+        !gst_buffer_pool_set_active (src->pool, TRUE))
+      goto pool_failed;
+    src->pool_size = blocksize;
+  }
+
+  ret = gst_buffer_pool_acquire_buffer (src->pool, buffer, NULL);
+  /* the buffers come back at the size of their previous read */
+  if (ret == GST_FLOW_OK)
+    gst_buffer_resize (*buffer, 0, MIN (size, blocksize));
+
+  return ret;
+
+  /* ERRORS */
+pool_failed:
+  {
+    GST_ELEMENT_ERROR (src, RESOURCE, FAILED, (NULL),
+        ("Failed to configure the buffer pool"));
+    gst_object_unref (src->pool);
+    src->pool = NULL;
+    return GST_FLOW_ERROR;
+  }
+}
+
+/* let the kernel only wake us up when the minimum read size is available */
+static void
+gst_tcp_client_src_setup_socket (GstTCPClientSrc * src, GSocket * socket)
+{
+#if defined(SO_RCVLOWAT) && defined(HAVE_SYS_SOCKET_H)
+  gint lowat;
+
+  if (src->min_read_size == 0)
+    return;
+
+  lowat = src->min_read_size;
+  if (setsockopt (g_socket_get_fd (socket), SOL_SOCKET, SO_RCVLOWAT, &lowat,
+          sizeof (lowat)) < 0)
+    GST_DEBUG_OBJECT (src, "could not set receive low watermark: %s",
+        g_strerror (errno));
+#endif
+}
+
 static GstFlowReturn
 gst_tcp_client_src_create (GstPushSrc * psrc, GstBuffer ** outbuf)
 {
@@ -193,7 +287,7 @@ gst_tcp_client_src_create (GstPushSrc * psrc, GstBuffer ** outbuf)
   avail = g_socket_get_available_bytes (src->socket);
   if (avail < 0) {
     goto get_available_error;
-  } else if (avail == 0) {
+  } else if (avail == 0 || avail < (gssize) src->min_read_size) {
     GIOCondition condition;
 
     if (!g_socket_condition_wait (src->socket,
@@ -210,21 +304,25 @@ gst_tcp_client_src_create (GstPushSrc * psrc, GstBuffer ** outbuf)
       *outbuf = NULL;
       ret = GST_FLOW_ERROR;
       goto done;
-    } else if ((condition & G_IO_HUP)) {
+    }
+    avail = g_socket_get_available_bytes (src->socket);
+    if (avail < 0)
+      goto get_available_error;
+    /* read what is left of the data before going EOS */
+    if ((condition & G_IO_HUP) && avail == 0) {
       GST_DEBUG_OBJECT (src, "Connection closed");
       *outbuf = NULL;
       ret = GST_FLOW_EOS;
       goto done;
     }
-    avail = g_socket_get_available_bytes (src->socket);
-    if (avail < 0)
-      goto get_available_error;
   }
 
   if (avail > 0) {
-    read = MIN (avail, MAX_READ_SIZE);
-    *outbuf = gst_buffer_new_and_alloc (read);
+    ret = gst_tcp_client_src_alloc_buffer (src, avail, outbuf);
+    if (ret != GST_FLOW_OK)
+      goto done;
     gst_buffer_map (*outbuf, &map, GST_MAP_READWRITE);
+    read = map.size;
     rret =
         g_socket_receive (src->socket, (gchar *) map.data, read,
         src->cancellable, &err);
@@ -312,6 +410,9 @@ gst_tcp_client_src_set_property (GObject * object, guint prop_id,
     case PROP_PORT:
       tcpclientsrc->port = g_value_get_int (value);
       break;
+    case PROP_MIN_READ_SIZE:
+      tcpclientsrc->min_read_size = g_value_get_uint (value);
+      break;
 
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -332,6 +433,9 @@ gst_tcp_client_src_get_property (GObject * object, guint prop_id,
     case PROP_PORT:
       g_value_set_int (value, tcpclientsrc->port);
       break;
+    case PROP_MIN_READ_SIZE:
+      g_value_set_uint (value, tcpclientsrc->min_read_size);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -395,6 +499,8 @@ gst_tcp_client_src_start (GstBaseSrc * bsrc)
 
   g_object_unref (saddr);
 
+  gst_tcp_client_src_setup_socket (src, src->socket);
+
   return TRUE;
 
 no_socket:
@@ -455,6 +561,12 @@ gst_tcp_client_src_stop (GstBaseSrc * bsrc)
     src->socket = NULL;
   }
 
+  if (src->pool) {
+    gst_buffer_pool_set_active (src->pool, FALSE);
+    gst_object_unref (src->pool);
+    src->pool = NULL;
+  }
+
   GST_OBJECT_FLAG_UNSET (src, GST_TCP_CLIENT_SRC_OPEN);
 
   return TRUE;
@@ -59,6 +59,10 @@ struct _GstTCPClientSrc {
   /* socket */
   GSocket *socket;
   GCancellable *cancellable;
+
+  guint min_read_size;
+  GstBufferPool *pool;          /* pool of blocksize buffers to read into */
+  guint pool_size;
 };
 
 struct _GstTCPClientSrcClass {
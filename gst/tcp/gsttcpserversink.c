@@ -44,6 +44,9 @@
 
 #define TCP_BACKLOG             5
 
+/* clients accepted per wakeup of the server socket */
+#define TCP_MAX_ACCEPTS         64
+
 GST_DEBUG_CATEGORY_STATIC (tcpserversink_debug);
 #define GST_CAT_DEFAULT (tcpserversink_debug)
 
@@ -52,7 +55,8 @@ enum
   PROP_0,
   PROP_HOST,
   PROP_PORT,
-  PROP_CURRENT_PORT
+  PROP_CURRENT_PORT,
+  PROP_BACKLOG
 };
 
 static void gst_tcp_server_sink_finalize (GObject * gobject);
@@ -109,6 +113,20 @@ gst_tcp_server_sink_class_init (GstTCPServerSinkClass * klass)
       g_param_spec_int ("current-port", "current-port",
           "The port number the socket is currently bound to", 0,
           TCP_HIGHEST_PORT, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstTCPServerSink:backlog:
+   *
+   * The number of connections the kernel keeps pending until they are
+   * accepted. Raise it, together with the system limit, when many clients
+   * connect at once, for example after the sender restarted. The value is
+   * used when the element goes to the READY state.
+   *
+   * Since: 1.2
+   **/
+  g_object_class_install_property (gobject_class, PROP_BACKLOG,
+      g_param_spec_int ("backlog", "Backlog",
+          "Number of pending connections waiting to be accepted", 1,
+          G_MAXINT, TCP_BACKLOG, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gst_element_class_set_static_metadata (gstelement_class,
       "TCP server sink", "Sink/Network",
@@ -129,6 +147,7 @@ gst_tcp_server_sink_init (GstTCPServerSink * this)
   /* should support as minimum 576 for IPV4 and 1500 for IPV6 */
   /* this->mtu = 1500; */
   this->host = g_strdup (TCP_DEFAULT_HOST);
+  this->backlog = TCP_BACKLOG;
 
   this->server_socket = NULL;
 }
@@ -148,36 +167,48 @@ gst_tcp_server_sink_finalize (GObject * gobject)
 }
 
 /* handle a read request on the server,
- * which indicates a new client connection */
+ * which indicates new client connections. All pending connections are
+ * accepted, up to TCP_MAX_ACCEPTS so that the clients still get served */
 static gboolean
 gst_tcp_server_sink_handle_server_read (GstTCPServerSink * sink)
 {
   GSocket *client_socket;
   GError *err = NULL;
+  guint i;
+
+  for (i = 0; i < TCP_MAX_ACCEPTS; i++) {
+    client_socket =
+        g_socket_accept (sink->server_socket, sink->element.cancellable, &err);
+    if (!client_socket) {
+      /* the backlog is empty */
+      if (g_error_matches (err, G_IO_ERROR, G_IO_ERROR_WOULD_BLOCK)) {
+        g_clear_error (&err);
+        break;
+      }
+      goto accept_failed;
+    }
 
-  /* wait on server socket for connections */
-  client_socket =
-      g_socket_accept (sink->server_socket, sink->element.cancellable, &err);
-  if (!client_socket)
-    goto accept_failed;
-
-  gst_multi_handle_sink_add (GST_MULTI_HANDLE_SINK (sink),
-      (GstMultiSinkHandle) client_socket);
+    gst_multi_handle_sink_add (GST_MULTI_HANDLE_SINK (sink),
+        (GstMultiSinkHandle) client_socket);
 
 #ifndef GST_DISABLE_GST_DEBUG
-  {
-    GInetSocketAddress *addr =
-        G_INET_SOCKET_ADDRESS (g_socket_get_remote_address (client_socket,
-            NULL));
-    gchar *ip =
-        g_inet_address_to_string (g_inet_socket_address_get_address (addr));
-
-    GST_DEBUG_OBJECT (sink, "added new client ip %s:%u with socket %p",
-        ip, g_inet_socket_address_get_port (addr), client_socket);
-
-    g_free (ip);
-  }
+    {
+      GInetSocketAddress *addr =
+          G_INET_SOCKET_ADDRESS (g_socket_get_remote_address (client_socket,
+              NULL));
+      gchar *ip =
+          g_inet_address_to_string (g_inet_socket_address_get_address (addr));
+
+      GST_DEBUG_OBJECT (sink, "added new client ip %s:%u with socket %p",
+          ip, g_inet_socket_address_get_port (addr), client_socket);
+
+      g_free (ip);
+      g_object_unref (addr);
+    }
 #endif
+  }
+
+  GST_LOG_OBJECT (sink, "accepted %u clients", i);
 
   return TRUE;
 
@@ -246,6 +277,9 @@ gst_tcp_server_sink_set_property (GObject * object, guint prop_id,
     case PROP_PORT:
       sink->server_port = g_value_get_int (value);
       break;
+    case PROP_BACKLOG:
+      sink->backlog = g_value_get_int (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -270,6 +304,9 @@ gst_tcp_server_sink_get_property (GObject * object, guint prop_id,
     case PROP_CURRENT_PORT:
       g_value_set_int (value, g_atomic_int_get (&sink->current_port));
       break;
+    case PROP_BACKLOG:
+      g_value_set_int (value, sink->backlog);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -336,7 +373,7 @@ gst_tcp_server_sink_init_send (GstMultiHandleSink * parent)
   g_object_unref (saddr);
 
   GST_DEBUG_OBJECT (this, "listening on server socket");
-  g_socket_set_listen_backlog (this->server_socket, TCP_BACKLOG);
+  g_socket_set_listen_backlog (this->server_socket, this->backlog);
 
   if (!g_socket_listen (this->server_socket, &err))
     goto listen_failed;
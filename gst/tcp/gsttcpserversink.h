@@ -62,6 +62,7 @@ struct _GstTCPServerSink {
   int current_port;        /* currently bound-to port, or 0 */ /* ATOMIC */
   int server_port;         /* port property */
   gchar *host;             /* host property */
+  gint backlog;            /* backlog property */
 
   GSocket *server_socket;
   GSource *server_source;
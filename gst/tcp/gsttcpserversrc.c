@@ -43,6 +43,11 @@
 #include "gsttcp.h"
 #include "gsttcpserversrc.h"
 
+#include <errno.h>
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
 GST_DEBUG_CATEGORY_STATIC (tcpserversrc_debug);
 #define GST_CAT_DEFAULT tcpserversrc_debug
 
@@ -51,6 +56,8 @@ GST_DEBUG_CATEGORY_STATIC (tcpserversrc_debug);
 
 #define MAX_READ_SIZE                   4 * 1024
 
+#define DEFAULT_MIN_READ_SIZE           0
+
 static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src",
     GST_PAD_SRC,
     GST_PAD_ALWAYS,
@@ -61,7 +68,9 @@ enum
   PROP_0,
   PROP_HOST,
   PROP_PORT,
-  PROP_CURRENT_PORT
+  PROP_CURRENT_PORT,
+  PROP_MIN_READ_SIZE,
+  PROP_BACKLOG
 };
 
 #define gst_tcp_server_src_parent_class parent_class
@@ -121,6 +130,36 @@ gst_tcp_server_src_class_init (GstTCPServerSrcClass * klass)
       g_param_spec_int ("current-port", "current-port",
           "The port number the socket is currently bound to", 0,
           TCP_HIGHEST_PORT, 0, G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstTCPServerSrc:min-read-size:
+   *
+   * Wait until this amount of bytes is available before reading from the
+   * socket, so that high bitrate streams are read with fewer and larger
+   * reads. Where supported, this is set on the socket with SO_RCVLOWAT so
+   * that no wakeups happen before. At most #GstBaseSrc:blocksize bytes are
+   * read into a buffer. 0 reads whatever is available. Changes are applied
+   * to the next connection.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_MIN_READ_SIZE,
+      g_param_spec_uint ("min-read-size", "Minimum read size",
+          "Minimum number of bytes to wait for before reading from the socket "
+          "(0 = read what is available)", 0, G_MAXINT, DEFAULT_MIN_READ_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstTCPServerSrc:backlog:
+   *
+   * The number of connections the kernel keeps pending until they are
+   * accepted. Only one client is served, the others are accepted when the
+   * element is restarted. The value is used when the element starts.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_BACKLOG,
+      g_param_spec_int ("backlog", "Backlog",
+          "Number of pending connections waiting to be accepted", 1,
+          G_MAXINT, TCP_BACKLOG, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&srctemplate));
@@ -149,6 +188,9 @@ gst_tcp_server_src_init (GstTCPServerSrc * src)
   src->server_socket = NULL;
   src->client_socket = NULL;
   src->cancellable = g_cancellable_new ();
+  src->min_read_size = DEFAULT_MIN_READ_SIZE;
+  src->backlog = TCP_BACKLOG;
+  src->pool = NULL;
 
   GST_OBJECT_FLAG_UNSET (src, GST_TCP_SERVER_SRC_OPEN);
 }
@@ -174,6 +216,73 @@ gst_tcp_server_src_finalize (GObject * gobject)
   G_OBJECT_CLASS (parent_class)->finalize (gobject);
 }
 
+/* Gets a buffer of @size bytes from the buffer pool of @src, which holds
+ * buffers of the blocksize and is recreated when the blocksize changes. */
+static GstFlowReturn
+gst_tcp_server_src_alloc_buffer (GstTCPServerSrc * src,
+    gsize size, GstBuffer ** buffer)
+{
+  guint blocksize;
+  GstFlowReturn ret;
+
+  blocksize = gst_base_src_get_blocksize (GST_BASE_SRC (src));
+  if (blocksize == 0)
+    blocksize = MAX_READ_SIZE;
+
+  if (src->pool && src->pool_size != blocksize) {
+    gst_buffer_pool_set_active (src->pool, FALSE);
+    gst_object_unref (src->pool);
+    src->pool = NULL;
+  }
+
+  if (src->pool == NULL) {
+    GstStructure *config;
+
+    src->pool = gst_buffer_pool_new ();
+    config = gst_buffer_pool_get_config (src->pool);
+    gst_buffer_pool_config_set_params (config, NULL, blocksize, 0, 0);
+    if (!gst_buffer_pool_set_config (src->pool, config) ||
+        !gst_buffer_pool_set_active (src->pool, TRUE))
+      goto pool_failed;
+    src->pool_size = blocksize;
+  }
+
+  ret = gst_buffer_pool_acquire_buffer (src->pool, buffer, NULL);
+  /* the buffers come back at the size of their previous read */
+  if (ret == GST_FLOW_OK)
+    gst_buffer_resize (*buffer, 0, MIN (size, blocksize));
+
+  return ret;
+
+  /* ERRORS */
+pool_failed:
+  {
+    GST_ELEMENT_ERROR (src, RESOURCE, FAILED, (NULL),
+        ("Failed to configure the buffer pool"));
+    gst_object_unref (src->pool);
+    src->pool = NULL;
+    return GST_FLOW_ERROR;
+  }
+}
+
+/* let the kernel only wake us up when the minimum read size is available */
+static void
+gst_tcp_server_src_setup_socket (GstTCPServerSrc * src, GSocket * socket)
+{
+#if defined(SO_RCVLOWAT) && defined(HAVE_SYS_SOCKET_H)
+  gint lowat;
+
+  if (src->min_read_size == 0)
+    return;
+
+  lowat = src->min_read_size;
+  if (setsockopt (g_socket_get_fd (socket), SOL_SOCKET, SO_RCVLOWAT, &lowat,
+          sizeof (lowat)) < 0)
+    GST_DEBUG_OBJECT (src, "could not set receive low watermark: %s",
+        g_strerror (errno));
+#endif
+}
+
 static GstFlowReturn
 gst_tcp_server_src_create (GstPushSrc * psrc, GstBuffer ** outbuf)
 {
@@ -195,6 +304,7 @@ gst_tcp_server_src_create (GstPushSrc * psrc, GstBuffer ** outbuf)
         g_socket_accept (src->server_socket, src->cancellable, &err);
     if (!src->client_socket)
       goto accept_error;
+    gst_tcp_server_src_setup_socket (src, src->client_socket);
     /* now read from the socket. */
   }
 
@@ -205,7 +315,7 @@ gst_tcp_server_src_create (GstPushSrc * psrc, GstBuffer ** outbuf)
   avail = g_socket_get_available_bytes (src->client_socket);
   if (avail < 0) {
     goto get_available_error;
-  } else if (avail == 0) {
+  } else if (avail == 0 || avail < (gssize) src->min_read_size) {
     GIOCondition condition;
 
     if (!g_socket_condition_wait (src->client_socket,
@@ -222,21 +332,25 @@ gst_tcp_server_src_create (GstPushSrc * psrc, GstBuffer ** outbuf)
       *outbuf = NULL;
       ret = GST_FLOW_ERROR;
       goto done;
-    } else if ((condition & G_IO_HUP)) {
+    }
+    avail = g_socket_get_available_bytes (src->client_socket);
+    if (avail < 0)
+      goto get_available_error;
+    /* read what is left of the data before going EOS */
+    if ((condition & G_IO_HUP) && avail == 0) {
       GST_DEBUG_OBJECT (src, "Connection closed");
       *outbuf = NULL;
       ret = GST_FLOW_EOS;
       goto done;
     }
-    avail = g_socket_get_available_bytes (src->client_socket);
-    if (avail < 0)
-      goto get_available_error;
   }
 
   if (avail > 0) {
-    read = MIN (avail, MAX_READ_SIZE);
-    *outbuf = gst_buffer_new_and_alloc (read);
+    ret = gst_tcp_server_src_alloc_buffer (src, avail, outbuf);
+    if (ret != GST_FLOW_OK)
+      goto done;
     gst_buffer_map (*outbuf, &map, GST_MAP_READWRITE);
+    read = map.size;
     rret =
         g_socket_receive (src->client_socket, (gchar *) map.data, read,
         src->cancellable, &err);
@@ -335,6 +449,12 @@ gst_tcp_server_src_set_property (GObject * object, guint prop_id,
     case PROP_PORT:
       tcpserversrc->server_port = g_value_get_int (value);
       break;
+    case PROP_MIN_READ_SIZE:
+      tcpserversrc->min_read_size = g_value_get_uint (value);
+      break;
+    case PROP_BACKLOG:
+      tcpserversrc->backlog = g_value_get_int (value);
+      break;
 
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
@@ -358,6 +478,12 @@ gst_tcp_server_src_get_property (GObject * object, guint prop_id,
     case PROP_CURRENT_PORT:
       g_value_set_int (value, g_atomic_int_get (&tcpserversrc->current_port));
       break;
+    case PROP_MIN_READ_SIZE:
+      g_value_set_uint (value, tcpserversrc->min_read_size);
+      break;
+    case PROP_BACKLOG:
+      g_value_set_int (value, tcpserversrc->backlog);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -421,7 +547,7 @@ gst_tcp_server_src_start (GstBaseSrc * bsrc)
 
   GST_DEBUG_OBJECT (src, "listening on server socket");
 
-  g_socket_set_listen_backlog (src->server_socket, TCP_BACKLOG);
+  g_socket_set_listen_backlog (src->server_socket, src->backlog);
 
   if (!g_socket_listen (src->server_socket, &err))
     goto listen_failed;
@@ -524,6 +650,12 @@ gst_tcp_server_src_stop (GstBaseSrc * bsrc)
     g_object_notify (G_OBJECT (src), "current-port");
   }
 
+  if (src->pool) {
+    gst_buffer_pool_set_active (src->pool, FALSE);
+    gst_object_unref (src->pool);
+    src->pool = NULL;
+  }
+
   GST_OBJECT_FLAG_UNSET (src, GST_TCP_SERVER_SRC_OPEN);
 
   return TRUE;
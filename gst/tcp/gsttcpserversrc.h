@@ -57,10 +57,15 @@ struct _GstTCPServerSrc {
   int current_port;        /* currently bound-to port, or 0 */ /* ATOMIC */
   int server_port;         /* port property */
   gchar *host;             /* host property */
+  gint backlog;            /* backlog property */
 
   GCancellable *cancellable;
   GSocket *server_socket;
   GSocket *client_socket;
+
+  guint min_read_size;
+  GstBufferPool *pool;     /* pool of blocksize buffers to read into */
+  guint pool_size;
 };
 
 struct _GstTCPServerSrcClass {
@@ -98,14 +98,32 @@ data_scan_ctx_ensure_data (GstTypeFind * tf, DataScanCtx * c, gint min_len)
   len = gst_type_find_get_length (tf);
   if (len > 0) {
     len = CLAMP (len - c->offset, min_len, chunk_len);
-  } else {
-    len = min_len;
+
+    data = gst_type_find_peek (tf, c->offset, len);
+    if (data != NULL) {
+      c->data = data;
+      c->size = len;
+      return TRUE;
+    }
+    return FALSE;
+  }
+
+  /* without a length, take the largest power-of-two fraction of the chunk
+   * that is there so we don't peek again for every few bytes while scanning
+   * to the end of the data */
+  for (len = chunk_len / 2; len > min_len; len /= 2) {
+    data = gst_type_find_peek (tf, c->offset, len);
+    if (data != NULL) {
+      c->data = data;
+      c->size = len;
+      return TRUE;
+    }
   }
 
-  data = gst_type_find_peek (tf, c->offset, len);
+  data = gst_type_find_peek (tf, c->offset, min_len);
   if (data != NULL) {
     c->data = data;
-    c->size = len;
+    c->size = min_len;
     return TRUE;
   }
 
@@ -122,6 +140,64 @@ data_scan_ctx_memcmp (GstTypeFind * tf, DataScanCtx * c, guint offset,
   return (memcmp (c->data + offset, data, len) == 0);
 }
 
+/* Advances @c to the next @byte that starts before @end_offset and has at
+ * least @min_len bytes of data available. Uses memchr() on the current chunk
+ * instead of looking at every single byte. */
+static inline gboolean
+data_scan_ctx_find_byte (GstTypeFind * tf, DataScanCtx * c, guint8 byte,
+    gint min_len, guint64 end_offset)
+{
+  const guint8 *p;
+  guint avail;
+
+  while (c->offset < end_offset) {
+    if (G_UNLIKELY (!data_scan_ctx_ensure_data (tf, c, min_len)))
+      return FALSE;
+
+    /* only positions that still have min_len bytes in this chunk */
+    avail = c->size - min_len + 1;
+    if (c->offset + avail > end_offset)
+      avail = end_offset - c->offset;
+
+    p = memchr (c->data, byte, avail);
+    if (p != NULL) {
+      data_scan_ctx_advance (tf, c, p - c->data);
+      return TRUE;
+    }
+    data_scan_ctx_advance (tf, c, avail);
+  }
+  return FALSE;
+}
+
+/* Advances @c to the next 0x00 0x00 0x01 start code prefix that starts before
+ * @end_offset and has at least @min_len (>= 3) bytes of data available */
+static inline gboolean
+data_scan_ctx_find_start_code (GstTypeFind * tf, DataScanCtx * c,
+    gint min_len, guint64 end_offset)
+{
+  while (data_scan_ctx_find_byte (tf, c, 0x00, min_len, end_offset)) {
+    /* look for the 0x01 and check the two bytes before it */
+    const guint8 *p;
+    guint avail;
+
+    avail = c->size - min_len + 1;
+    if (c->offset + avail > end_offset)
+      avail = end_offset - c->offset;
+
+    p = memchr (c->data + 2, 0x01, avail);
+    if (p == NULL) {
+      data_scan_ctx_advance (tf, c, avail);
+      continue;
+    }
+    if (p[-1] == 0x00 && p[-2] == 0x00) {
+      data_scan_ctx_advance (tf, c, p - 2 - c->data);
+      return TRUE;
+    }
+    data_scan_ctx_advance (tf, c, p - 1 - c->data);
+  }
+  return FALSE;
+}
+
 /*** text/plain ***/
 static gboolean xml_check_first_element (GstTypeFind * tf,
     const gchar * element, guint elen, gboolean strict);
@@ -1306,7 +1382,18 @@ mp3_type_find_at_offset (GstTypeFind * tf, guint64 start_off,
         break;
       data_end = data + size;
     }
-    if (*data == 0xFF) {
+    if (*data != 0xFF) {
+      const guint8 *next;
+      guint skip;
+
+      /* jump straight to the next possible sync byte */
+      next = memchr (data, 0xFF, size);
+      skip = next ? next - data : size;
+      data += skip;
+      skipped += skip;
+      size -= skip;
+      continue;
+    } else {
       const guint8 *head_data = NULL;
       guint layer = 0, bitrate, samplerate, channels;
       guint found = 0;          /* number of valid headers found */
@@ -1585,10 +1672,10 @@ ac3_type_find (GstTypeFind * tf, gpointer unused)
    * frame is followed by a second frame at the expected offset.
    * We could also check the two ac3 CRCs, but we don't do that right now */
   while (c.offset < 1024) {
-    if (G_UNLIKELY (!data_scan_ctx_ensure_data (tf, &c, 5)))
+    if (G_UNLIKELY (!data_scan_ctx_find_byte (tf, &c, 0x0b, 6, 1024)))
       break;
 
-    if (c.data[0] == 0x0b && c.data[1] == 0x77) {
+    if (c.data[1] == 0x77) {
       guint bsid = c.data[5] >> 3;
 
       if (bsid <= 8) {
@@ -2325,7 +2412,20 @@ mpeg_ts_type_find (GstTypeFind * tf, gpointer unused)
       size = GST_MPEGTS_TYPEFIND_SYNC_SIZE;
     }
 
-    /* Have at least MPEGTS_HDR_SIZE bytes at this point */
+    /* Have at least MPEGTS_HDR_SIZE bytes at this point, jump straight to
+     * the next sync byte that still has a complete header in the data */
+    if (data[0] != 0x47) {
+      const guint8 *next;
+      guint skip;
+
+      next = memchr (data, 0x47, size - MPEGTS_HDR_SIZE + 1);
+      skip = next ? next - data : size - MPEGTS_HDR_SIZE + 1;
+      data += skip;
+      skipped += skip;
+      size -= skip;
+      continue;
+    }
+
     if (IS_MPEGTS_HEADER (data)) {
       gint p;
 
@@ -2368,18 +2468,12 @@ static gboolean
 mpeg_find_next_header (GstTypeFind * tf, DataScanCtx * c,
     guint64 max_extra_offset)
 {
-  guint64 extra_offset;
+  if (!data_scan_ctx_find_start_code (tf, c, 4,
+          c->offset + max_extra_offset + 1))
+    return FALSE;
 
-  for (extra_offset = 0; extra_offset <= max_extra_offset; ++extra_offset) {
-    if (!data_scan_ctx_ensure_data (tf, c, 4))
-      return FALSE;
-    if (IS_MPEG_HEADER (c->data)) {
-      data_scan_ctx_advance (tf, c, 3);
-      return TRUE;
-    }
-    data_scan_ctx_advance (tf, c, 1);
-  }
-  return FALSE;
+  data_scan_ctx_advance (tf, c, 3);
+  return TRUE;
 }
 
 /*** video/mpeg MPEG-4 elementary video stream ***/
@@ -2587,63 +2681,61 @@ h264_video_type_find (GstTypeFind * tf, gpointer unused)
   int bad = 0;
 
   while (c.offset < H264_MAX_PROBE_LENGTH) {
-    if (G_UNLIKELY (!data_scan_ctx_ensure_data (tf, &c, 4)))
+    if (G_UNLIKELY (!data_scan_ctx_find_start_code (tf, &c, 4,
+                H264_MAX_PROBE_LENGTH)))
       break;
 
-    if (IS_MPEG_HEADER (c.data)) {
-      nut = c.data[3] & 0x9f;   /* forbiden_zero_bit | nal_unit_type */
-      ref = c.data[3] & 0x60;   /* nal_ref_idc */
+    nut = c.data[3] & 0x9f;     /* forbiden_zero_bit | nal_unit_type */
+    ref = c.data[3] & 0x60;     /* nal_ref_idc */
+
+    /* if forbidden bit is different to 0 won't be h264 */
+    if (nut > 0x1f) {
+      bad++;
+      break;
+    }
 
-      /* if forbidden bit is different to 0 won't be h264 */
-      if (nut > 0x1f) {
+    /* collect statistics about the NAL types */
+    if ((nut >= 1 && nut <= 13) || nut == 19) {
+      if ((nut == 5 && ref == 0) ||
+          ((nut == 6 || (nut >= 9 && nut <= 12)) && ref != 0)) {
         bad++;
-        break;
-      }
+      } else {
+        if (nut == 7)
+          seen_sps = TRUE;
+        else if (nut == 8)
+          seen_pps = TRUE;
+        else if (nut == 5)
+          seen_idr = TRUE;
 
-      /* collect statistics about the NAL types */
-      if ((nut >= 1 && nut <= 13) || nut == 19) {
-        if ((nut == 5 && ref == 0) ||
-            ((nut == 6 || (nut >= 9 && nut <= 12)) && ref != 0)) {
-          bad++;
-        } else {
-          if (nut == 7)
-            seen_sps = TRUE;
-          else if (nut == 8)
-            seen_pps = TRUE;
-          else if (nut == 5)
-            seen_idr = TRUE;
-
-          good++;
-        }
-      } else if (nut >= 14 && nut <= 33) {
-        if (nut == 15) {
-          seen_ssps = TRUE;
-          good++;
-        } else if (seen_ssps && (nut == 14 || nut == 20)) {
-          good++;
-        } else {
-          /* reserved */
-          /* Theoretically these are good, since if they exist in the
-             stream it merely means that a newer backwards-compatible
-             h.264 stream.  But we should be identifying that separately. */
-          bad++;
-        }
+        good++;
+      }
+    } else if (nut >= 14 && nut <= 33) {
+      if (nut == 15) {
+        seen_ssps = TRUE;
+        good++;
+      } else if (seen_ssps && (nut == 14 || nut == 20)) {
+        good++;
       } else {
-        /* unspecified, application specific */
-        /* don't consider these bad */
+        /* reserved */
+        /* Theoretically these are good, since if they exist in the
+           stream it merely means that a newer backwards-compatible
+           h.264 stream.  But we should be identifying that separately. */
+        bad++;
       }
+    } else {
+      /* unspecified, application specific */
+      /* don't consider these bad */
+    }
 
-      GST_LOG ("good:%d, bad:%d, pps:%d, sps:%d, idr:%d ssps:%d", good, bad,
-          seen_pps, seen_sps, seen_idr, seen_ssps);
-
-      if (seen_sps && seen_pps && seen_idr && good >= 10 && bad < 4) {
-        gst_type_find_suggest (tf, GST_TYPE_FIND_LIKELY, H264_VIDEO_CAPS);
-        return;
-      }
+    GST_LOG ("good:%d, bad:%d, pps:%d, sps:%d, idr:%d ssps:%d", good, bad,
+        seen_pps, seen_sps, seen_idr, seen_ssps);
 
-      data_scan_ctx_advance (tf, &c, 4);
+    if (seen_sps && seen_pps && seen_idr && good >= 10 && bad < 4) {
+      gst_type_find_suggest (tf, GST_TYPE_FIND_LIKELY, H264_VIDEO_CAPS);
+      return;
     }
-    data_scan_ctx_advance (tf, &c, 1);
+
+    data_scan_ctx_advance (tf, &c, 5);
   }
 
   GST_LOG ("good:%d, bad:%d, pps:%d, sps:%d, idr:%d ssps=%d", good, bad,
@@ -2684,12 +2776,10 @@ mpeg_video_stream_type_find (GstTypeFind * tf, gpointer unused)
     if (found >= GST_MPEGVID_TYPEFIND_TRY_PICTURES)
       break;
 
-    if (!data_scan_ctx_ensure_data (tf, &c, 5))
+    if (!data_scan_ctx_find_start_code (tf, &c, 5,
+            GST_MPEGVID_TYPEFIND_TRY_SYNC))
       break;
 
-    if (!IS_MPEG_HEADER (c.data))
-      goto next;
-
     /* a pack header indicates that this isn't an elementary stream */
     if (c.data[3] == 0xBA && mpeg_sys_is_valid_pack (tf, c.data, c.size, NULL))
       return;
@@ -2727,8 +2817,6 @@ mpeg_video_stream_type_find (GstTypeFind * tf, gpointer unused)
       continue;
     }
 
-  next:
-
     data_scan_ctx_advance (tf, &c, 1);
   }
 
@@ -31,6 +31,12 @@
  * gst-launch -v videotestsrc ! video/x-raw,format=\(string\)YUY2 ! videoconvert ! ximagesink
  * ]|
  * </refsect2>
+ *
+ * When QoS is enabled and downstream reports that the frames arrive too late,
+ * the element temporarily converts without dithering and dithers again when
+ * the pipeline has caught up. Every change is reported with an element
+ * message named "GstVideoConvertQoS" holding the "dither" method that is now
+ * used and the QoS "proportion" that triggered the change.
  */
 
 #ifdef HAVE_CONFIG_H
@@ -56,10 +62,21 @@ static GQuark _colorspace_quark;
 #define gst_video_convert_parent_class parent_class
 G_DEFINE_TYPE (GstVideoConvert, gst_video_convert, GST_TYPE_VIDEO_FILTER);
 
+#define DEFAULT_PROP_N_THREADS 1
+
+/* QoS proportion at which we stop dithering and below which we dither
+ * again */
+#define QOS_NO_DITHER_PROPORTION 1.2
+#define QOS_RESTORE_PROPORTION   1.0
+
+/* number of prepared converters kept around for renegotiation */
+#define MAX_CONVERTERS 4
+
 enum
 {
   PROP_0,
-  PROP_DITHER
+  PROP_DITHER,
+  PROP_N_THREADS
 };
 
 #define CSP_VIDEO_CAPS GST_VIDEO_CAPS_MAKE (GST_VIDEO_FORMATS_ALL) ";" \
@@ -90,24 +107,6 @@ static gboolean gst_video_convert_set_info (GstVideoFilter * filter,
 static GstFlowReturn gst_video_convert_transform_frame (GstVideoFilter * filter,
     GstVideoFrame * in_frame, GstVideoFrame * out_frame);
 
-static GType
-dither_method_get_type (void)
-{
-  static GType gtype = 0;
-
-  if (gtype == 0) {
-    static const GEnumValue values[] = {
-      {DITHER_NONE, "No dithering (default)", "none"},
-      {DITHER_VERTERR, "Vertical error propogation", "verterr"},
-      {DITHER_HALFTONE, "Half-tone", "halftone"},
-      {0, NULL, NULL}
-    };
-
-    gtype = g_enum_register_static ("GstVideoConvertDitherMethod", values);
-  }
-  return gtype;
-}
-
 /* copies the given caps */
 static GstCaps *
 gst_video_convert_caps_remove_format_info (GstCaps * caps)
@@ -359,6 +358,95 @@ gst_video_convert_transform_meta (GstBaseTransform * trans, GstBuffer * outbuf,
   return ret;
 }
 
+/* a prepared converter with the formats it converts between */
+typedef struct
+{
+  GstVideoInfo in_info;
+  GstVideoInfo out_info;
+  GstVideoConverter *convert;
+} ConverterEntry;
+
+static void
+converter_entry_free (ConverterEntry * entry)
+{
+  gst_video_converter_free (entry->convert);
+  g_slice_free (ConverterEntry, entry);
+}
+
+static GstStructure *
+gst_video_convert_make_config (GstVideoConvert * space)
+{
+  return gst_structure_new ("GstVideoConvertConfig",
+      GST_VIDEO_CONVERTER_OPT_DITHER_METHOD, GST_TYPE_VIDEO_DITHER_METHOD,
+      space->qos_no_dither ? GST_VIDEO_DITHER_NONE : space->dither,
+      GST_VIDEO_CONVERTER_OPT_THREADS, G_TYPE_UINT, space->n_threads, NULL);
+}
+
+/* gst_video_info_is_equal() ignores the colorimetry and chroma siting, but
+ * the converter depends on them for the matrix and the chroma resampling */
+static gboolean
+video_info_same_conversion (const GstVideoInfo * a, const GstVideoInfo * b)
+{
+  if (!gst_video_info_is_equal (a, b))
+    return FALSE;
+  if (a->chroma_site != b->chroma_site)
+    return FALSE;
+  if (a->colorimetry.range != b->colorimetry.range ||
+      a->colorimetry.matrix != b->colorimetry.matrix ||
+      a->colorimetry.transfer != b->colorimetry.transfer ||
+      a->colorimetry.primaries != b->colorimetry.primaries)
+    return FALSE;
+
+  return TRUE;
+}
+
+/* look for a converter for @in_info -> @out_info in the cache, or make a
+ * new one. The converter is moved to the head of the cache and the least
+ * recently used ones are freed when there are too many. */
+static GstVideoConverter *
+gst_video_convert_get_converter (GstVideoConvert * space,
+    GstVideoInfo * in_info, GstVideoInfo * out_info)
+{
+  ConverterEntry *entry;
+  GList *walk;
+
+  for (walk = space->converters; walk; walk = g_list_next (walk)) {
+    entry = walk->data;
+
+    if (video_info_same_conversion (&entry->in_info, in_info) &&
+        video_info_same_conversion (&entry->out_info, out_info)) {
+      GST_DEBUG_OBJECT (space, "reusing cached converter %p", entry->convert);
+      space->converters = g_list_delete_link (space->converters, walk);
+      space->converters = g_list_prepend (space->converters, entry);
+      /* the properties might have changed since it was used */
+      gst_video_converter_set_config (entry->convert,
+          gst_video_convert_make_config (space));
+      return entry->convert;
+    }
+  }
+
+  entry = g_slice_new (ConverterEntry);
+  entry->convert = gst_video_converter_new (in_info, out_info,
+      gst_video_convert_make_config (space));
+  if (entry->convert == NULL) {
+    g_slice_free (ConverterEntry, entry);
+    return NULL;
+  }
+  entry->in_info = *in_info;
+  entry->out_info = *out_info;
+
+  space->converters = g_list_prepend (space->converters, entry);
+
+  while (g_list_length (space->converters) > MAX_CONVERTERS) {
+    walk = g_list_last (space->converters);
+    entry = walk->data;
+    GST_DEBUG_OBJECT (space, "freeing cached converter %p", entry->convert);
+    converter_entry_free (entry);
+    space->converters = g_list_delete_link (space->converters, walk);
+  }
+  return ((ConverterEntry *) space->converters->data)->convert;
+}
+
 static gboolean
 gst_video_convert_set_info (GstVideoFilter * filter,
     GstCaps * incaps, GstVideoInfo * in_info, GstCaps * outcaps,
@@ -368,10 +456,7 @@ gst_video_convert_set_info (GstVideoFilter * filter,
 
   space = GST_VIDEO_CONVERT_CAST (filter);
 
-  if (space->convert) {
-    videoconvert_convert_free (space->convert);
-    space->convert = NULL;
-  }
+  space->convert = NULL;
 
   /* these must match */
   if (in_info->width != out_info->width || in_info->height != out_info->height
@@ -386,7 +471,10 @@ gst_video_convert_set_info (GstVideoFilter * filter,
   if (in_info->interlace_mode != out_info->interlace_mode)
     goto format_mismatch;
 
-  space->convert = videoconvert_convert_new (in_info, out_info);
+  GST_OBJECT_LOCK (space);
+  space->convert = gst_video_convert_get_converter (space, in_info, out_info);
+  space->config_changed = FALSE;
+  GST_OBJECT_UNLOCK (space);
   if (space->convert == NULL)
     goto no_convert;
 
@@ -408,14 +496,32 @@ no_convert:
   }
 }
 
+static gboolean
+gst_video_convert_src_event (GstBaseTransform * trans, GstEvent * event)
+{
+  GstVideoConvert *space = GST_VIDEO_CONVERT_CAST (trans);
+
+  if (GST_EVENT_TYPE (event) == GST_EVENT_QOS &&
+      gst_base_transform_is_qos_enabled (trans)) {
+    gdouble proportion;
+
+    gst_event_parse_qos (event, NULL, &proportion, NULL, NULL);
+    GST_OBJECT_LOCK (space);
+    space->qos_proportion = proportion;
+    GST_OBJECT_UNLOCK (space);
+  }
+
+  return GST_BASE_TRANSFORM_CLASS (parent_class)->src_event (trans, event);
+}
+
 static void
 gst_video_convert_finalize (GObject * obj)
 {
   GstVideoConvert *space = GST_VIDEO_CONVERT (obj);
 
-  if (space->convert) {
-    videoconvert_convert_free (space->convert);
-  }
+  g_list_free_full (space->converters, (GDestroyNotify) converter_entry_free);
+  space->converters = NULL;
+  space->convert = NULL;
 
   G_OBJECT_CLASS (parent_class)->finalize (obj);
 }
@@ -451,6 +557,8 @@ gst_video_convert_class_init (GstVideoConvertClass * klass)
       GST_DEBUG_FUNCPTR (gst_video_convert_filter_meta);
   gstbasetransform_class->transform_meta =
       GST_DEBUG_FUNCPTR (gst_video_convert_transform_meta);
+  gstbasetransform_class->src_event =
+      GST_DEBUG_FUNCPTR (gst_video_convert_src_event);
 
   gstbasetransform_class->passthrough_on_same_caps = TRUE;
 
@@ -461,13 +569,22 @@ gst_video_convert_class_init (GstVideoConvertClass * klass)
 
   g_object_class_install_property (gobject_class, PROP_DITHER,
       g_param_spec_enum ("dither", "Dither", "Apply dithering while converting",
-          dither_method_get_type (), DITHER_NONE,
+          GST_TYPE_VIDEO_DITHER_METHOD, GST_VIDEO_DITHER_NONE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Maximum number of threads to use (0 = number of processors)",
+          0, G_MAXUINT, DEFAULT_PROP_N_THREADS,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 }
 
 static void
 gst_video_convert_init (GstVideoConvert * space)
 {
+  space->dither = GST_VIDEO_DITHER_NONE;
+  space->n_threads = DEFAULT_PROP_N_THREADS;
+  space->qos_proportion = 0.0;
+  space->qos_no_dither = FALSE;
 }
 
 void
@@ -480,7 +597,16 @@ gst_video_convert_set_property (GObject * object, guint property_id,
 
   switch (property_id) {
     case PROP_DITHER:
+      GST_OBJECT_LOCK (csp);
       csp->dither = g_value_get_enum (value);
+      csp->config_changed = TRUE;
+      GST_OBJECT_UNLOCK (csp);
+      break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (csp);
+      csp->n_threads = g_value_get_uint (value);
+      csp->config_changed = TRUE;
+      GST_OBJECT_UNLOCK (csp);
       break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
@@ -500,6 +626,9 @@ gst_video_convert_get_property (GObject * object, guint property_id,
     case PROP_DITHER:
       g_value_set_enum (value, csp->dither);
       break;
+    case PROP_N_THREADS:
+      g_value_set_uint (value, csp->n_threads);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -511,6 +640,9 @@ gst_video_convert_transform_frame (GstVideoFilter * filter,
     GstVideoFrame * in_frame, GstVideoFrame * out_frame)
 {
   GstVideoConvert *space;
+  GstVideoDitherMethod dither;
+  gboolean no_dither;
+  gdouble proportion;
 
   space = GST_VIDEO_CONVERT_CAST (filter);
 
@@ -519,9 +651,40 @@ gst_video_convert_transform_frame (GstVideoFilter * filter,
       GST_VIDEO_INFO_NAME (&filter->in_info),
       GST_VIDEO_INFO_NAME (&filter->out_info));
 
-  videoconvert_convert_set_dither (space->convert, space->dither);
+  GST_OBJECT_LOCK (space);
+  /* skip the dithering while downstream QoS reports that we are too slow */
+  proportion = space->qos_proportion;
+  no_dither = space->qos_no_dither;
+  if (space->dither == GST_VIDEO_DITHER_NONE ||
+      proportion < QOS_RESTORE_PROPORTION)
+    no_dither = FALSE;
+  else if (proportion >= QOS_NO_DITHER_PROPORTION)
+    no_dither = TRUE;
+
+  if (G_UNLIKELY (no_dither != space->qos_no_dither)) {
+    space->qos_no_dither = no_dither;
+    space->config_changed = TRUE;
+    dither = no_dither ? GST_VIDEO_DITHER_NONE : space->dither;
+    GST_OBJECT_UNLOCK (space);
+
+    GST_DEBUG_OBJECT (space, "QoS proportion %f, using dither method %d",
+        proportion, dither);
+    gst_element_post_message (GST_ELEMENT_CAST (space),
+        gst_message_new_element (GST_OBJECT_CAST (space),
+            gst_structure_new ("GstVideoConvertQoS",
+                "dither", GST_TYPE_VIDEO_DITHER_METHOD, dither,
+                "proportion", G_TYPE_DOUBLE, proportion, NULL)));
+
+    GST_OBJECT_LOCK (space);
+  }
+  if (G_UNLIKELY (space->config_changed)) {
+    gst_video_converter_set_config (space->convert,
+        gst_video_convert_make_config (space));
+    space->config_changed = FALSE;
+  }
+  GST_OBJECT_UNLOCK (space);
 
-  videoconvert_convert_convert (space->convert, out_frame, in_frame);
+  gst_video_converter_frame (space->convert, in_frame, out_frame);
 
   return GST_FLOW_OK;
 }
@@ -25,7 +25,6 @@
 #include <gst/gst.h>
 #include <gst/video/video.h>
 #include <gst/video/gstvideofilter.h>
-#include "videoconvert.h"
 
 G_BEGIN_DECLS
 
@@ -47,8 +46,15 @@ typedef struct _GstVideoConvertClass GstVideoConvertClass;
 struct _GstVideoConvert {
   GstVideoFilter element;
 
-  VideoConvert *convert;
-  gboolean dither;
+  GstVideoConverter *convert;
+  GList *converters;
+  GstVideoDitherMethod dither;
+  guint n_threads;
+  gboolean config_changed;
+
+  /* last proportion from downstream QoS and if dithering is skipped for it */
+  gdouble qos_proportion;
+  gboolean qos_no_dither;
 };
 
 struct _GstVideoConvertClass
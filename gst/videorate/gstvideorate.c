@@ -56,6 +56,11 @@
  * certain factor. It must not be confused with framerate. Think of rate as
  * speed and framerate as flow.
  *
+ * When the #GstBaseTransform:qos property is set to TRUE, frames that would
+ * arrive too late downstream according to the last QoS event are not pushed
+ * and are counted as dropped. Duplicated frames are flagged with
+ * %GST_BUFFER_FLAG_GAP so that encoders can skip them cheaply.
+ *
  * <refsect2>
  * <title>Example pipelines</title>
  * |[
@@ -129,6 +134,8 @@ static void gst_video_rate_swap_prev (GstVideoRate * videorate,
     GstBuffer * buffer, gint64 time);
 static gboolean gst_video_rate_sink_event (GstBaseTransform * trans,
     GstEvent * event);
+static gboolean gst_video_rate_src_event (GstBaseTransform * trans,
+    GstEvent * event);
 static gboolean gst_video_rate_query (GstBaseTransform * trans,
     GstPadDirection direction, GstQuery * query);
 
@@ -174,6 +181,7 @@ gst_video_rate_class_init (GstVideoRateClass * klass)
       GST_DEBUG_FUNCPTR (gst_video_rate_transform_caps);
   base_class->transform_ip = GST_DEBUG_FUNCPTR (gst_video_rate_transform_ip);
   base_class->sink_event = GST_DEBUG_FUNCPTR (gst_video_rate_sink_event);
+  base_class->src_event = GST_DEBUG_FUNCPTR (gst_video_rate_src_event);
   base_class->start = GST_DEBUG_FUNCPTR (gst_video_rate_start);
   base_class->stop = GST_DEBUG_FUNCPTR (gst_video_rate_stop);
   base_class->fixate_caps = GST_DEBUG_FUNCPTR (gst_video_rate_fixate_caps);
@@ -572,6 +580,11 @@ gst_video_rate_reset (GstVideoRate * videorate)
   videorate->average = 0;
   gst_video_rate_swap_prev (videorate, NULL, 0);
 
+  GST_OBJECT_LOCK (videorate);
+  videorate->earliest_time = GST_CLOCK_TIME_NONE;
+  videorate->proportion = 1.0;
+  GST_OBJECT_UNLOCK (videorate);
+
   gst_segment_init (&videorate->segment, GST_FORMAT_TIME);
 }
 
@@ -595,6 +608,51 @@ gst_video_rate_init (GstVideoRate * videorate)
   gst_base_transform_set_gap_aware (GST_BASE_TRANSFORM (videorate), TRUE);
 }
 
+/* check if @outbuf would arrive too late downstream according to the last
+ * QoS event. Only done when QoS is enabled on the element. */
+static gboolean
+gst_video_rate_is_late (GstVideoRate * videorate, GstBuffer * outbuf)
+{
+  GstBaseTransform *trans = GST_BASE_TRANSFORM (videorate);
+  GstClockTime running_time, earliest_time, stream_time;
+  gdouble proportion;
+  GstMessage *qos_msg;
+
+  if (!gst_base_transform_is_qos_enabled (trans))
+    return FALSE;
+
+  GST_OBJECT_LOCK (videorate);
+  earliest_time = videorate->earliest_time;
+  proportion = videorate->proportion;
+  GST_OBJECT_UNLOCK (videorate);
+
+  if (!GST_CLOCK_TIME_IS_VALID (earliest_time) ||
+      !GST_BUFFER_TIMESTAMP_IS_VALID (outbuf))
+    return FALSE;
+
+  running_time = gst_segment_to_running_time (&videorate->segment,
+      GST_FORMAT_TIME, GST_BUFFER_TIMESTAMP (outbuf));
+  if (!GST_CLOCK_TIME_IS_VALID (running_time) || running_time > earliest_time)
+    return FALSE;
+
+  GST_DEBUG_OBJECT (videorate, "frame with running time %" GST_TIME_FORMAT
+      " is later than %" GST_TIME_FORMAT ", dropping",
+      GST_TIME_ARGS (running_time), GST_TIME_ARGS (earliest_time));
+
+  stream_time = gst_segment_to_stream_time (&videorate->segment,
+      GST_FORMAT_TIME, GST_BUFFER_TIMESTAMP (outbuf));
+  qos_msg = gst_message_new_qos (GST_OBJECT_CAST (videorate), FALSE,
+      running_time, stream_time, GST_BUFFER_TIMESTAMP (outbuf),
+      GST_BUFFER_DURATION (outbuf));
+  gst_message_set_qos_values (qos_msg, earliest_time - running_time,
+      proportion, 1000000);
+  gst_message_set_qos_stats (qos_msg, GST_FORMAT_BUFFERS, videorate->out,
+      videorate->drop + 1);
+  gst_element_post_message (GST_ELEMENT_CAST (videorate), qos_msg);
+
+  return TRUE;
+}
+
 /* flush the oldest buffer */
 static GstFlowReturn
 gst_video_rate_flush_prev (GstVideoRate * videorate, gboolean duplicate)
@@ -644,6 +702,19 @@ gst_video_rate_flush_prev (GstVideoRate * videorate, gboolean duplicate)
     GST_BUFFER_TIMESTAMP (outbuf) = push_ts - videorate->segment.base;
   }
 
+  if (gst_video_rate_is_late (videorate, outbuf)) {
+    /* downstream would only throw this frame away, don't make it convert
+     * and encode it first */
+    if (GST_BUFFER_FLAG_IS_SET (outbuf, GST_BUFFER_FLAG_DISCONT))
+      videorate->discont = TRUE;
+    videorate->out--;
+    videorate->drop++;
+    if (!videorate->silent)
+      gst_video_rate_notify_drop (videorate);
+    gst_buffer_unref (outbuf);
+    return GST_FLOW_OK;
+  }
+
   GST_LOG_OBJECT (videorate,
       "old is best, dup, pushing buffer outgoing ts %" GST_TIME_FORMAT,
       GST_TIME_ARGS (push_ts));
@@ -823,6 +894,41 @@ format_error:
   }
 }
 
+static gboolean
+gst_video_rate_src_event (GstBaseTransform * trans, GstEvent * event)
+{
+  GstVideoRate *videorate = GST_VIDEO_RATE (trans);
+
+  switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_QOS:
+    {
+      GstQOSType type;
+      gdouble proportion;
+      GstClockTimeDiff diff;
+      GstClockTime timestamp;
+
+      gst_event_parse_qos (event, &type, &proportion, &diff, &timestamp);
+
+      GST_OBJECT_LOCK (videorate);
+      videorate->proportion = proportion;
+      if (G_LIKELY (GST_CLOCK_TIME_IS_VALID (timestamp))) {
+        if (G_UNLIKELY (diff > 0))
+          videorate->earliest_time = timestamp + 2 * diff;
+        else
+          videorate->earliest_time = timestamp + diff;
+      } else {
+        videorate->earliest_time = GST_CLOCK_TIME_NONE;
+      }
+      GST_OBJECT_UNLOCK (videorate);
+      break;
+    }
+    default:
+      break;
+  }
+
+  return GST_BASE_TRANSFORM_CLASS (parent_class)->src_event (trans, event);
+}
+
 static gboolean
 gst_video_rate_query (GstBaseTransform * trans, GstPadDirection direction,
     GstQuery * query)
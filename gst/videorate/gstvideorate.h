@@ -67,6 +67,10 @@ struct _GstVideoRate
   /* segment handling */
   GstSegment segment;
 
+  /* QoS, protected with the object lock */
+  GstClockTime earliest_time;
+  gdouble proportion;
+
   /* properties */
   guint64 in, out, dup, drop;
   gboolean silent;
@@ -0,0 +1,638 @@
+/* GStreamer
+ * Copyright (C) <1999> Erik Walthinsen <omega@cse.ogi.edu>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:element-videoconvertscale
+ * @see_also: videoscale, videoconvert
+ *
+ * This element resizes video frames and converts them to another format in
+ * one step. Each output line is made from input lines that are unpacked,
+ * scaled horizontally and merged vertically, then converted to the output
+ * colors with a #GstVideoConverter and packed again, so that no
+ * intermediate frame is needed.
+ *
+ * All the scaling methods of videoscale are supported. The chroma planes
+ * are not resampled when converting, they are scaled with the other
+ * components of the unpacked lines.
+ *
+ * <refsect2>
+ * <title>Example pipelines</title>
+ * |[
+ * gst-launch -v videotestsrc ! video/x-raw,format=I420,width=640,height=480 ! videoconvertscale ! video/x-raw,format=YUY2,width=320,height=240 ! xvimagesink
+ * ]| Scale I420 video to half its size and output it as YUY2.
+ * |[
+ * gst-launch -v videotestsrc ! video/x-raw,format=I420,width=640,height=480 ! videoconvertscale method=lanczos ! video/x-raw,format=BGRx,width=1280,height=720 ! ximagesink
+ * ]| Scale I420 video up with the lanczos method and output it as BGRx.
+ * </refsect2>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "gstvideoconvertscale.h"
+#include "vs_scanline.h"
+#include "vs_4tap.h"
+
+/* all formats with an unpack and pack function, except the paletted one */
+#define GST_VIDEO_CONVERT_SCALE_FORMATS "{ I420, YV12, YUY2, UYVY, AYUV, " \
+    "RGBx, BGRx, xRGB, xBGR, RGBA, BGRA, ARGB, ABGR, RGB, BGR, Y41B, Y42B, " \
+    "YVYU, Y444, v210, v216, NV12, NV21, NV16, GRAY8, GRAY16_BE, GRAY16_LE, " \
+    "v308, RGB16, BGR16, RGB15, BGR15, UYVP, A420, YUV9, YVU9, IYU1, " \
+    "ARGB64, AYUV64, r210, I420_10LE, I420_10BE, I422_10LE, I422_10BE, " \
+    "Y444_10LE, Y444_10BE, GBR, GBR_10LE, GBR_10BE }"
+
+static GstStaticCaps gst_video_convert_scale_format_caps =
+GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE (GST_VIDEO_CONVERT_SCALE_FORMATS));
+
+/* where gst_video_convert_scale_unpack_line() gets the input lines from */
+typedef struct
+{
+  GstVideoConvertScale *self;
+  GstVideoFrame *frame;
+  gint field;
+  gint n_fields;
+  gint x;
+  gint y;
+} LineSource;
+
+static GstCaps *gst_video_convert_scale_transform_caps (GstBaseTransform *
+    trans, GstPadDirection direction, GstCaps * caps, GstCaps * filter);
+static GstCaps *gst_video_convert_scale_fixate_caps (GstBaseTransform * base,
+    GstPadDirection direction, GstCaps * caps, GstCaps * othercaps);
+
+static gboolean gst_video_convert_scale_set_info (GstVideoFilter * filter,
+    GstCaps * in, GstVideoInfo * in_info, GstCaps * out,
+    GstVideoInfo * out_info);
+static GstFlowReturn gst_video_convert_scale_transform_frame (GstVideoFilter *
+    filter, GstVideoFrame * in, GstVideoFrame * out);
+static void gst_video_convert_scale_finalize (GstVideoConvertScale * self);
+
+#define gst_video_convert_scale_parent_class parent_class
+G_DEFINE_TYPE (GstVideoConvertScale, gst_video_convert_scale,
+    GST_TYPE_VIDEO_SCALE);
+
+static void
+gst_video_convert_scale_class_init (GstVideoConvertScaleClass * klass)
+{
+  GObjectClass *gobject_class = (GObjectClass *) klass;
+  GstElementClass *element_class = (GstElementClass *) klass;
+  GstBaseTransformClass *trans_class = (GstBaseTransformClass *) klass;
+  GstVideoFilterClass *filter_class = (GstVideoFilterClass *) klass;
+  GstCaps *caps;
+
+  gobject_class->finalize =
+      (GObjectFinalizeFunc) gst_video_convert_scale_finalize;
+
+  gst_element_class_set_static_metadata (element_class,
+      "Video converting scaler", "Filter/Converter/Video/Scaler",
+      "Resizes video and converts it to another format",
+      "GStreamer maintainers <gstreamer-devel@lists.sourceforge.net>");
+
+  /* these replace the templates of videoscale */
+  caps = gst_static_caps_get (&gst_video_convert_scale_format_caps);
+  gst_element_class_add_pad_template (element_class,
+      gst_pad_template_new ("sink", GST_PAD_SINK, GST_PAD_ALWAYS, caps));
+  gst_element_class_add_pad_template (element_class,
+      gst_pad_template_new ("src", GST_PAD_SRC, GST_PAD_ALWAYS, caps));
+  gst_caps_unref (caps);
+
+  trans_class->transform_caps =
+      GST_DEBUG_FUNCPTR (gst_video_convert_scale_transform_caps);
+  trans_class->fixate_caps =
+      GST_DEBUG_FUNCPTR (gst_video_convert_scale_fixate_caps);
+
+  filter_class->set_info = GST_DEBUG_FUNCPTR (gst_video_convert_scale_set_info);
+  filter_class->transform_frame =
+      GST_DEBUG_FUNCPTR (gst_video_convert_scale_transform_frame);
+}
+
+static void
+gst_video_convert_scale_init (GstVideoConvertScale * self)
+{
+}
+
+static void
+gst_video_convert_scale_reset (GstVideoConvertScale * self)
+{
+  gint i;
+
+  if (self->convert)
+    gst_video_converter_free (self->convert);
+  self->convert = NULL;
+
+  if (self->lanczos)
+    vs_lanczos_free (self->lanczos);
+  self->lanczos = NULL;
+
+  g_free (self->src_line);
+  self->src_line = NULL;
+  for (i = 0; i < 4; i++) {
+    g_free (self->lines[i]);
+    self->lines[i] = NULL;
+  }
+  g_free (self->dest_line);
+  g_free (self->black_line);
+  g_free (self->out_black_line);
+  self->dest_line = self->black_line = self->out_black_line = NULL;
+}
+
+static void
+gst_video_convert_scale_finalize (GstVideoConvertScale * self)
+{
+  gst_video_convert_scale_reset (self);
+
+  G_OBJECT_CLASS (parent_class)->finalize (G_OBJECT (self));
+}
+
+static GstCaps *
+gst_video_convert_scale_transform_caps (GstBaseTransform * trans,
+    GstPadDirection direction, GstCaps * caps, GstCaps * filter)
+{
+  GstCaps *ret;
+  GstStructure *structure;
+  gint i, n;
+
+  GST_DEBUG_OBJECT (trans,
+      "Transforming caps %" GST_PTR_FORMAT " in direction %s", caps,
+      (direction == GST_PAD_SINK) ? "sink" : "src");
+
+  ret = gst_caps_new_empty ();
+  n = gst_caps_get_size (caps);
+  for (i = 0; i < n; i++) {
+    structure = gst_caps_get_structure (caps, i);
+
+    /* If this is already expressed by the existing caps
+     * skip this structure */
+    if (i > 0 && gst_caps_is_subset_structure (ret, structure))
+      continue;
+
+    structure = gst_structure_copy (structure);
+
+    gst_structure_set (structure, "width", GST_TYPE_INT_RANGE, 1, G_MAXINT,
+        "height", GST_TYPE_INT_RANGE, 1, G_MAXINT, NULL);
+
+    /* if pixel aspect ratio, make a range of it */
+    if (gst_structure_has_field (structure, "pixel-aspect-ratio")) {
+      gst_structure_set (structure, "pixel-aspect-ratio",
+          GST_TYPE_FRACTION_RANGE, 1, G_MAXINT, G_MAXINT, 1, NULL);
+    }
+    /* we convert to any format of the template */
+    gst_structure_remove_fields (structure, "format", "colorimetry",
+        "chroma-site", NULL);
+
+    gst_caps_append_structure (ret, structure);
+  }
+
+  if (filter) {
+    GstCaps *intersection;
+
+    intersection =
+        gst_caps_intersect_full (filter, ret, GST_CAPS_INTERSECT_FIRST);
+    gst_caps_unref (ret);
+    ret = intersection;
+  }
+
+  GST_DEBUG_OBJECT (trans, "returning caps: %" GST_PTR_FORMAT, ret);
+
+  return ret;
+}
+
+static GstCaps *
+gst_video_convert_scale_fixate_caps (GstBaseTransform * base,
+    GstPadDirection direction, GstCaps * caps, GstCaps * othercaps)
+{
+  GstStructure *ins, *outs;
+  const gchar *format;
+
+  /* let videoscale pick the size */
+  othercaps = GST_BASE_TRANSFORM_CLASS (parent_class)->fixate_caps (base,
+      direction, caps, othercaps);
+
+  /* and prefer to keep the format */
+  ins = gst_caps_get_structure (caps, 0);
+  outs = gst_caps_get_structure (othercaps, 0);
+  if ((format = gst_structure_get_string (ins, "format")))
+    gst_structure_fixate_field_string (outs, "format", format);
+
+  othercaps = gst_caps_fixate (othercaps);
+
+  GST_DEBUG_OBJECT (base, "fixated othercaps to %" GST_PTR_FORMAT, othercaps);
+
+  return othercaps;
+}
+
+static void
+merge_linear_AYUV64 (uint8_t * dest, uint8_t * src1, uint8_t * src2, int n,
+    int x)
+{
+  vs_scanline_merge_linear_Y16 (dest, src1, src2, n * 4, x);
+}
+
+static void
+fill_black (gpointer line, const GstVideoFormatInfo * finfo, gint width)
+{
+  gint i;
+
+  if (finfo->format == GST_VIDEO_FORMAT_AYUV64) {
+    guint16 *p = line;
+
+    for (i = 0; i < width; i++) {
+      p[i * 4 + 0] = 0xffff;
+      p[i * 4 + 1] = 16 << 8;
+      p[i * 4 + 2] = 128 << 8;
+      p[i * 4 + 3] = 128 << 8;
+    }
+  } else if (finfo->format == GST_VIDEO_FORMAT_ARGB64) {
+    guint16 *p = line;
+
+    for (i = 0; i < width; i++) {
+      p[i * 4 + 0] = 0xffff;
+      p[i * 4 + 1] = p[i * 4 + 2] = p[i * 4 + 3] = 0;
+    }
+  } else if (finfo->format == GST_VIDEO_FORMAT_AYUV) {
+    guint8 *p = line;
+
+    for (i = 0; i < width; i++) {
+      p[i * 4 + 0] = 0xff;
+      p[i * 4 + 1] = 16;
+      p[i * 4 + 2] = p[i * 4 + 3] = 128;
+    }
+  } else {
+    guint8 *p = line;
+
+    for (i = 0; i < width; i++) {
+      p[i * 4 + 0] = 0xff;
+      p[i * 4 + 1] = p[i * 4 + 2] = p[i * 4 + 3] = 0;
+    }
+  }
+}
+
+static gboolean
+gst_video_convert_scale_set_info (GstVideoFilter * filter, GstCaps * in,
+    GstVideoInfo * in_info, GstCaps * out, GstVideoInfo * out_info)
+{
+  GstVideoConvertScale *self = GST_VIDEO_CONVERT_SCALE (filter);
+  GstVideoScale *videoscale = GST_VIDEO_SCALE (filter);
+  const GstVideoFormatInfo *ufinfo;
+  GstVideoInfo info;
+  gint in_width, out_width, dest_width, i;
+
+  /* computes the borders */
+  if (!GST_VIDEO_FILTER_CLASS (parent_class)->set_info (filter, in, in_info,
+          out, out_info))
+    return FALSE;
+
+  gst_base_transform_set_passthrough (GST_BASE_TRANSFORM (filter),
+      gst_video_info_is_equal (in_info, out_info)
+      && videoscale->borders_w == 0 && videoscale->borders_h == 0);
+
+  gst_video_convert_scale_reset (self);
+
+  GST_OBJECT_LOCK (videoscale);
+  self->method = videoscale->method;
+  GST_OBJECT_UNLOCK (videoscale);
+
+  ufinfo = gst_video_format_get_info (in_info->finfo->unpack_format);
+  self->pstride = GST_VIDEO_FORMAT_INFO_DEPTH (ufinfo, 0) > 8 ? 8 : 4;
+
+  in_width = GST_VIDEO_INFO_WIDTH (in_info);
+  out_width = GST_VIDEO_INFO_WIDTH (out_info);
+  dest_width = out_width - videoscale->borders_w;
+
+  /* the lines are scaled in the input format and its colors, the
+   * converter then works on lines of the output size */
+  gst_video_info_set_format (&info, GST_VIDEO_INFO_FORMAT (in_info),
+      out_width, GST_VIDEO_INFO_HEIGHT (out_info));
+  info.interlace_mode = in_info->interlace_mode;
+  info.par_n = in_info->par_n;
+  info.par_d = in_info->par_d;
+  info.fps_n = in_info->fps_n;
+  info.fps_d = in_info->fps_d;
+  info.chroma_site = in_info->chroma_site;
+  info.colorimetry = in_info->colorimetry;
+
+  self->convert = gst_video_converter_new (&info, out_info, NULL);
+  if (self->convert == NULL)
+    goto no_convert;
+
+  self->src_line = g_malloc ((in_width + 8) * self->pstride);
+  for (i = 0; i < 4; i++)
+    self->lines[i] = g_malloc ((dest_width + 8) * self->pstride);
+
+  /* the converted lines can have 16 bits components */
+  self->dest_line = g_malloc ((out_width + 8) * 8);
+  self->black_line = g_malloc ((out_width + 8) * self->pstride);
+  self->out_black_line = g_malloc ((out_width + 8) * 8);
+  fill_black (self->black_line, ufinfo, out_width);
+  memcpy (self->out_black_line, self->black_line, out_width * self->pstride);
+  gst_video_converter_line (self->convert, self->out_black_line, 0);
+
+  GST_DEBUG_OBJECT (self, "converting %s -> %s with method %d",
+      GST_VIDEO_INFO_NAME (in_info), GST_VIDEO_INFO_NAME (out_info),
+      self->method);
+
+  return TRUE;
+
+  /* ERRORS */
+no_convert:
+  {
+    GST_ELEMENT_ERROR (self, CORE, NEGOTIATION, (NULL),
+        ("can't convert between %s and %s", GST_VIDEO_INFO_NAME (in_info),
+            GST_VIDEO_INFO_NAME (out_info)));
+    return FALSE;
+  }
+}
+
+/* same increments as the vs_image scalers */
+static gint
+get_increment (gint src_size, gint dest_size, gboolean merge)
+{
+  gint increment;
+
+  if (dest_size == 1)
+    increment = 0;
+  else
+    increment = ((src_size - 1) << 16) / (dest_size - 1);
+  if (merge && increment > 0)
+    increment--;
+
+  return increment;
+}
+
+/* unpacks input line @line of the current field and returns its cropped
+ * pixels */
+static const uint8_t *
+gst_video_convert_scale_unpack_line (int line, void *user_data)
+{
+  LineSource *src = user_data;
+  GstVideoConvertScale *self = src->self;
+  const GstVideoFormatInfo *finfo = src->frame->info.finfo;
+
+  finfo->unpack_func (finfo, src->n_fields > 1 ?
+      GST_VIDEO_PACK_FLAG_INTERLACED : GST_VIDEO_PACK_FLAG_NONE,
+      self->src_line, src->frame->data, src->frame->info.stride, 0,
+      (src->y + line) * src->n_fields + src->field,
+      GST_VIDEO_FRAME_WIDTH (src->frame));
+
+  return (guint8 *) self->src_line + src->x * self->pstride;
+}
+
+/* returns input line @line of the current field, scaled horizontally from
+ * @width to @dest_width pixels */
+static gpointer
+gst_video_convert_scale_get_line (GstVideoConvertScale * self,
+    GstVideoScaleMethod method, LineSource * src, gint line, gint width,
+    gint x_increment, gint dest_width)
+{
+  gint slot = line & 3;
+  gint acc = 0;
+  uint8_t *pixels, *dest;
+
+  if (self->line_idx[slot] == line)
+    return self->lines[slot];
+
+  pixels = (uint8_t *) gst_video_convert_scale_unpack_line (line, src);
+  dest = self->lines[slot];
+
+  switch (method) {
+    case GST_VIDEO_SCALE_NEAREST:
+      if (self->pstride == 8)
+        vs_scanline_resample_nearest_AYUV64 (dest, pixels, width, dest_width,
+            &acc, x_increment);
+      else
+        vs_scanline_resample_nearest_RGBA (dest, pixels, width, dest_width,
+            &acc, x_increment);
+      break;
+    case GST_VIDEO_SCALE_BILINEAR:
+      if (self->pstride == 8)
+        vs_scanline_resample_linear_AYUV64 (dest, pixels, width, dest_width,
+            &acc, x_increment);
+      else
+        vs_scanline_resample_linear_RGBA (dest, pixels, width, dest_width,
+            &acc, x_increment);
+      break;
+    case GST_VIDEO_SCALE_4TAP:
+      if (self->pstride == 8)
+        vs_scanline_resample_4tap_AYUV64 ((uint16_t *) dest,
+            (uint16_t *) pixels, dest_width, width, &acc, x_increment);
+      else
+        vs_scanline_resample_4tap_RGBA (dest, pixels, dest_width, width,
+            &acc, x_increment);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+  self->line_idx[slot] = line;
+
+  return dest;
+}
+
+/* scales output line @i of the current field into @dest, @acc is the
+ * position in the input lines for the methods of vs_scanline */
+static void
+gst_video_convert_scale_scale_line (GstVideoConvertScale * self,
+    GstVideoScaleMethod method, LineSource * src, guint8 * dest, gint i,
+    gint acc, gint src_width, gint src_height, gint x_increment,
+    gint dest_width)
+{
+  guint8 *l[4];
+  gint j, k, x;
+
+  j = acc >> 16;
+  x = acc & 0xffff;
+
+  switch (method) {
+    case GST_VIDEO_SCALE_NEAREST:
+      l[0] = gst_video_convert_scale_get_line (self, method, src, j,
+          src_width, x_increment, dest_width);
+      memcpy (dest, l[0], dest_width * self->pstride);
+      break;
+    case GST_VIDEO_SCALE_BILINEAR:
+      l[0] = gst_video_convert_scale_get_line (self, method, src, j,
+          src_width, x_increment, dest_width);
+      if (x == 0 || j + 1 >= src_height) {
+        memcpy (dest, l[0], dest_width * self->pstride);
+      } else {
+        l[1] = gst_video_convert_scale_get_line (self, method, src, j + 1,
+            src_width, x_increment, dest_width);
+        if (self->pstride == 8)
+          merge_linear_AYUV64 (dest, l[0], l[1], dest_width, x);
+        else
+          vs_scanline_merge_linear_RGBA (dest, l[0], l[1], dest_width, x);
+      }
+      break;
+    case GST_VIDEO_SCALE_4TAP:
+      for (k = 0; k < 4; k++)
+        l[k] = gst_video_convert_scale_get_line (self, method, src,
+            CLAMP (j - 1 + k, 0, src_height - 1), src_width, x_increment,
+            dest_width);
+      if (self->pstride == 8)
+        vs_scanline_merge_4tap_AYUV64 ((uint16_t *) dest, (uint16_t *) l[0],
+            (uint16_t *) l[1], (uint16_t *) l[2], (uint16_t *) l[3],
+            dest_width, x);
+      else
+        vs_scanline_merge_4tap_RGBA (dest, l[0], l[1], l[2], l[3],
+            dest_width, x);
+      break;
+    case GST_VIDEO_SCALE_LANCZOS:
+      vs_lanczos_scale_line (self->lanczos, dest, i,
+          gst_video_convert_scale_unpack_line, src);
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+}
+
+static void
+gst_video_convert_scale_pack_line (GstVideoFrame * out_frame, gpointer line,
+    gint n_fields, gint y)
+{
+  const GstVideoFormatInfo *finfo = out_frame->info.finfo;
+
+  finfo->pack_func (finfo, n_fields > 1 ?
+      GST_VIDEO_PACK_FLAG_INTERLACED : GST_VIDEO_PACK_FLAG_NONE,
+      line, 0, out_frame->data, out_frame->info.stride,
+      out_frame->info.chroma_site, y, GST_VIDEO_FRAME_WIDTH (out_frame));
+}
+
+/* makes a lanczos scaler for the size of the crop region */
+static void
+gst_video_convert_scale_ensure_lanczos (GstVideoConvertScale * self,
+    gint src_width, gint src_height, gint dest_width, gint dest_height)
+{
+  GstVideoScale *videoscale = GST_VIDEO_SCALE (self);
+  gdouble sharpness, sharpen, envelope;
+  gboolean dither;
+
+  if (self->lanczos && self->lanczos_width == src_width &&
+      self->lanczos_height == src_height)
+    return;
+
+  if (self->lanczos)
+    vs_lanczos_free (self->lanczos);
+
+  GST_OBJECT_LOCK (videoscale);
+  sharpness = videoscale->sharpness;
+  sharpen = videoscale->sharpen;
+  envelope = videoscale->envelope;
+  dither = videoscale->dither;
+  GST_OBJECT_UNLOCK (videoscale);
+
+  self->lanczos = vs_lanczos_new (src_width, src_height, dest_width,
+      dest_height, self->pstride == 8, sharpness, dither, envelope, sharpen);
+  self->lanczos_width = src_width;
+  self->lanczos_height = src_height;
+}
+
+static GstFlowReturn
+gst_video_convert_scale_transform_frame (GstVideoFilter * filter,
+    GstVideoFrame * in_frame, GstVideoFrame * out_frame)
+{
+  GstVideoConvertScale *self = GST_VIDEO_CONVERT_SCALE (filter);
+  GstVideoScale *videoscale = GST_VIDEO_SCALE (filter);
+  GstVideoScaleMethod method;
+  LineSource src;
+  gint field, n_fields, i, y, acc, x_increment, y_increment;
+  gint crop_x, crop_y, crop_w, crop_h;
+  gint src_height, out_width, dest_width, dest_height, out_height;
+  gint top, left, right;
+  guint8 *dest;
+
+  n_fields = GST_VIDEO_FRAME_IS_INTERLACED (in_frame) ? 2 : 1;
+
+  if (!gst_video_scale_get_crop (videoscale, in_frame, &crop_x, &crop_y,
+          &crop_w, &crop_h)) {
+    crop_x = crop_y = 0;
+    crop_w = GST_VIDEO_FRAME_WIDTH (in_frame);
+    crop_h = GST_VIDEO_FRAME_HEIGHT (in_frame);
+  }
+
+  src_height = crop_h / n_fields;
+  out_width = GST_VIDEO_FRAME_WIDTH (out_frame);
+  out_height = GST_VIDEO_FRAME_HEIGHT (out_frame) / n_fields;
+  dest_width = out_width - videoscale->borders_w;
+  dest_height = out_height - videoscale->borders_h / n_fields;
+  top = videoscale->borders_h / (2 * n_fields);
+  left = videoscale->borders_w / 2;
+  right = out_width - dest_width - left;
+
+  /* same fallbacks as videoscale for sources that are too small */
+  method = self->method;
+  if (crop_w == 1)
+    method = GST_VIDEO_SCALE_NEAREST;
+  if (method == GST_VIDEO_SCALE_4TAP && (crop_w < 4 || src_height < 4))
+    method = GST_VIDEO_SCALE_BILINEAR;
+  if (method == GST_VIDEO_SCALE_LANCZOS)
+    gst_video_convert_scale_ensure_lanczos (self, crop_w, src_height,
+        dest_width, dest_height);
+
+  x_increment = get_increment (crop_w, dest_width,
+      method == GST_VIDEO_SCALE_BILINEAR);
+  y_increment = get_increment (src_height, dest_height,
+      method == GST_VIDEO_SCALE_BILINEAR);
+
+  /* the scaled lines go between the left and right borders */
+  dest = (guint8 *) self->dest_line + left * self->pstride;
+
+  src.self = self;
+  src.frame = in_frame;
+  src.n_fields = n_fields;
+  src.x = crop_x;
+  src.y = crop_y / n_fields;
+
+  for (field = 0; field < n_fields; field++) {
+    src.field = field;
+    for (i = 0; i < 4; i++)
+      self->line_idx[i] = -1;
+    if (self->lanczos)
+      vs_lanczos_reset (self->lanczos);
+    acc = 0;
+
+    for (i = 0; i < out_height; i++) {
+      y = i * n_fields + field;
+
+      if (i < top || i >= top + dest_height) {
+        gst_video_convert_scale_pack_line (out_frame, self->out_black_line,
+            n_fields, y);
+        continue;
+      }
+
+      gst_video_convert_scale_scale_line (self, method, &src, dest, i - top,
+          acc, crop_w, src_height, x_increment, dest_width);
+      acc += y_increment;
+
+      /* the previous line was converted in place */
+      if (left > 0)
+        memcpy (self->dest_line, self->black_line, left * self->pstride);
+      if (right > 0)
+        memcpy (dest + dest_width * self->pstride, self->black_line,
+            right * self->pstride);
+
+      gst_video_converter_line (self->convert, self->dest_line, y);
+      gst_video_convert_scale_pack_line (out_frame, self->dest_line, n_fields,
+          y);
+    }
+  }
+  return GST_FLOW_OK;
+}
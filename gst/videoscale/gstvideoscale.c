@@ -45,6 +45,13 @@
  * of 50.
  * </refsect2>
  *
+ * When QoS is enabled and downstream reports that the frames arrive too late,
+ * the element temporarily scales with the cheaper bilinear or nearest
+ * neighbour methods and goes back to the configured method when the pipeline
+ * has caught up. Every change of the method in use is reported with an
+ * element message named "GstVideoScaleQoS" holding the "method" that is now
+ * used and the QoS "proportion" that triggered the change.
+ *
  * Last reviewed on 2006-03-02 (0.10.4)
  */
 
@@ -80,6 +87,7 @@
 #include <gst/video/gstvideopool.h>
 
 #include "gstvideoscale.h"
+#include "gstvideoconvertscale.h"
 #include "gstvideoscaleorc.h"
 #include "vs_image.h"
 #include "vs_4tap.h"
@@ -96,6 +104,13 @@ GST_DEBUG_CATEGORY_STATIC (GST_CAT_PERFORMANCE);
 #define DEFAULT_PROP_DITHER       FALSE
 #define DEFAULT_PROP_SUBMETHOD    1
 #define DEFAULT_PROP_ENVELOPE     2.0
+#define DEFAULT_PROP_N_THREADS    1
+
+/* QoS proportions at which we fall back to bilinear and nearest scaling, and
+ * below which the configured method is used again */
+#define QOS_BILINEAR_PROPORTION   1.2
+#define QOS_NEAREST_PROPORTION    2.0
+#define QOS_RESTORE_PROPORTION    1.0
 
 enum
 {
@@ -106,7 +121,23 @@ enum
   PROP_SHARPEN,
   PROP_DITHER,
   PROP_SUBMETHOD,
-  PROP_ENVELOPE
+  PROP_ENVELOPE,
+  PROP_N_THREADS
+};
+
+/* first and last + 1 line of the VSImage @img that band @band of @n_bands
+ * scales */
+#define BAND_START(img,band,n_bands) ((img).height * (band) / (n_bands))
+#define BAND_END(img,band,n_bands) ((img).height * ((band) + 1) / (n_bands))
+
+struct _GstVideoScaleTask
+{
+  GstVideoScale *videoscale;
+  VSImage *dest;
+  VSImage *src;
+  guint8 *tmp_buf;
+  gint band;
+  GstFlowReturn ret;
 };
 
 #undef GST_VIDEO_SIZE_RANGE
@@ -196,6 +227,10 @@ static GstCaps *gst_video_scale_fixate_caps (GstBaseTransform * base,
 static gboolean gst_video_scale_set_info (GstVideoFilter * filter,
     GstCaps * in, GstVideoInfo * in_info, GstCaps * out,
     GstVideoInfo * out_info);
+static gboolean gst_video_scale_propose_allocation (GstBaseTransform * trans,
+    GstQuery * decide_query, GstQuery * query);
+static gboolean gst_video_scale_transform_meta (GstBaseTransform * trans,
+    GstBuffer * outbuf, GstMeta * meta, GstBuffer * inbuf);
 static GstFlowReturn gst_video_scale_transform_frame (GstVideoFilter * filter,
     GstVideoFrame * in, GstVideoFrame * out);
 
@@ -205,7 +240,8 @@ static void gst_video_scale_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec);
 
 static GstFlowReturn do_scale (GstVideoFilter * filter, VSImage dest[4],
-    VSImage src[4]);
+    VSImage src[4], guint8 * tmp_buf, gint band, gint n_bands);
+static void gst_video_scale_free_tasks (GstVideoScale * videoscale);
 
 #define gst_video_scale_parent_class parent_class
 G_DEFINE_TYPE (GstVideoScale, gst_video_scale, GST_TYPE_VIDEO_FILTER);
@@ -263,6 +299,12 @@ gst_video_scale_class_init (GstVideoScaleClass * klass)
           "Size of filter envelope", 1.0, 5.0, DEFAULT_PROP_ENVELOPE,
           G_PARAM_CONSTRUCT | G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  g_object_class_install_property (gobject_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Maximum number of threads to use for the 4-tap and lanczos methods "
+          "(0 = number of processors)", 0, G_MAXUINT, DEFAULT_PROP_N_THREADS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (element_class,
       "Video scaler", "Filter/Converter/Video/Scaler",
       "Resizes video", "Wim Taymans <wim.taymans@chello.be>");
@@ -276,6 +318,10 @@ gst_video_scale_class_init (GstVideoScaleClass * klass)
       GST_DEBUG_FUNCPTR (gst_video_scale_transform_caps);
   trans_class->fixate_caps = GST_DEBUG_FUNCPTR (gst_video_scale_fixate_caps);
   trans_class->src_event = GST_DEBUG_FUNCPTR (gst_video_scale_src_event);
+  trans_class->propose_allocation =
+      GST_DEBUG_FUNCPTR (gst_video_scale_propose_allocation);
+  trans_class->transform_meta =
+      GST_DEBUG_FUNCPTR (gst_video_scale_transform_meta);
 
   filter_class->set_info = GST_DEBUG_FUNCPTR (gst_video_scale_set_info);
   filter_class->transform_frame =
@@ -293,13 +339,22 @@ gst_video_scale_init (GstVideoScale * videoscale)
   videoscale->sharpen = DEFAULT_PROP_SHARPEN;
   videoscale->dither = DEFAULT_PROP_DITHER;
   videoscale->envelope = DEFAULT_PROP_ENVELOPE;
+  videoscale->n_threads = DEFAULT_PROP_N_THREADS;
+  videoscale->qos_proportion = 0.0;
+  videoscale->qos_method = DEFAULT_PROP_METHOD;
+  videoscale->n_tasks = 1;
+  g_mutex_init (&videoscale->lock);
+  g_cond_init (&videoscale->cond);
 }
 
 static void
 gst_video_scale_finalize (GstVideoScale * videoscale)
 {
+  gst_video_scale_free_tasks (videoscale);
   if (videoscale->tmp_buf)
     g_free (videoscale->tmp_buf);
+  g_mutex_clear (&videoscale->lock);
+  g_cond_clear (&videoscale->cond);
 
   G_OBJECT_CLASS (parent_class)->finalize (G_OBJECT (videoscale));
 }
@@ -347,6 +402,11 @@ gst_video_scale_set_property (GObject * object, guint prop_id,
       vscale->envelope = g_value_get_double (value);
       GST_OBJECT_UNLOCK (vscale);
       break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (vscale);
+      vscale->n_threads = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (vscale);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -395,6 +455,11 @@ gst_video_scale_get_property (GObject * object, guint prop_id, GValue * value,
       g_value_set_double (value, vscale->envelope);
       GST_OBJECT_UNLOCK (vscale);
       break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (vscale);
+      g_value_set_uint (value, vscale->n_threads);
+      GST_OBJECT_UNLOCK (vscale);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -511,6 +576,39 @@ gst_video_scale_transform_caps (GstBaseTransform * trans,
   return ret;
 }
 
+static gboolean
+gst_video_scale_propose_allocation (GstBaseTransform * trans,
+    GstQuery * decide_query, GstQuery * query)
+{
+  if (!GST_BASE_TRANSFORM_CLASS (parent_class)->propose_allocation (trans,
+          decide_query, query))
+    return FALSE;
+
+  /* passthrough, downstream handles the metadata */
+  if (decide_query == NULL)
+    return TRUE;
+
+  /* we scale straight from the cropped region, upstream doesn't need to
+   * copy it */
+  if (!gst_query_find_allocation_meta (query, GST_VIDEO_CROP_META_API_TYPE,
+          NULL))
+    gst_query_add_allocation_meta (query, GST_VIDEO_CROP_META_API_TYPE, NULL);
+
+  return TRUE;
+}
+
+static gboolean
+gst_video_scale_transform_meta (GstBaseTransform * trans, GstBuffer * outbuf,
+    GstMeta * meta, GstBuffer * inbuf)
+{
+  /* the crop was applied when scaling */
+  if (meta->info->api == GST_VIDEO_CROP_META_API_TYPE)
+    return FALSE;
+
+  return GST_BASE_TRANSFORM_CLASS (parent_class)->transform_meta (trans,
+      outbuf, meta, inbuf);
+}
+
 static gboolean
 gst_video_scale_set_info (GstVideoFilter * filter, GstCaps * in,
     GstVideoInfo * in_info, GstCaps * out, GstVideoInfo * out_info)
@@ -559,6 +657,8 @@ gst_video_scale_set_info (GstVideoFilter * filter, GstCaps * in,
   if (videoscale->tmp_buf)
     g_free (videoscale->tmp_buf);
   videoscale->tmp_buf = g_malloc (out_info->width * sizeof (guint64) * 4);
+  /* the temp buffers of the tasks depend on the output size */
+  gst_video_scale_free_tasks (videoscale);
 
   if (in_info->width == out_info->width && in_info->height == out_info->height
       && videoscale->borders_w == 0 && videoscale->borders_h == 0) {
@@ -1071,6 +1171,70 @@ gst_video_scale_setup_vs_image (VSImage * image, GstVideoFrame * frame,
 
 }
 
+/* gets the region of @frame to scale from its crop metadata, rounded to
+ * the chroma subsampling. Returns FALSE when there is no usable crop. */
+gboolean
+gst_video_scale_get_crop (GstVideoScale * videoscale, GstVideoFrame * frame,
+    gint * x, gint * y, gint * width, gint * height)
+{
+  const GstVideoFormatInfo *finfo = frame->info.finfo;
+  GstVideoCropMeta *meta;
+  gint i, x_align = 1, y_align = 1;
+
+  meta = gst_buffer_get_video_crop_meta (frame->buffer);
+  if (meta == NULL)
+    return FALSE;
+
+  for (i = 0; i < GST_VIDEO_FRAME_N_COMPONENTS (frame); i++) {
+    x_align = MAX (x_align, 1 << GST_VIDEO_FORMAT_INFO_W_SUB (finfo, i));
+    y_align = MAX (y_align, 1 << GST_VIDEO_FORMAT_INFO_H_SUB (finfo, i));
+  }
+  if (GST_VIDEO_FRAME_IS_INTERLACED (frame))
+    y_align *= 2;
+
+  *x = meta->x - meta->x % x_align;
+  *y = meta->y - meta->y % y_align;
+  *width = meta->width;
+  *height = meta->height;
+
+  if (*width < x_align || *height < y_align ||
+      *x + *width > GST_VIDEO_FRAME_WIDTH (frame) ||
+      *y + *height > GST_VIDEO_FRAME_HEIGHT (frame)) {
+    GST_WARNING_OBJECT (videoscale, "ignoring invalid crop %ux%u at %u,%u",
+        meta->width, meta->height, meta->x, meta->y);
+    return FALSE;
+  }
+
+  GST_LOG_OBJECT (videoscale, "scaling from %dx%d at %d,%d", *width, *height,
+      *x, *y);
+
+  return TRUE;
+}
+
+/* restricts @image, set up for a whole plane, to the crop region */
+static void
+gst_video_scale_crop_vs_image (VSImage * image, GstVideoFrame * frame,
+    gint component, gint x, gint y, gint width, gint height,
+    gboolean interlaced)
+{
+  const GstVideoFormatInfo *finfo = frame->info.finfo;
+
+  if (interlaced) {
+    y /= 2;
+    height /= 2;
+  }
+
+  x = GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (finfo, component, x);
+  y = GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (finfo, component, y);
+  image->width = MAX (1, GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (finfo, component,
+          width));
+  image->height = MAX (1, GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (finfo,
+          component, height));
+
+  image->pixels += y * image->stride +
+      x * GST_VIDEO_FRAME_COMP_PSTRIDE (frame, component);
+}
+
 static const guint8 *
 _get_black_for_format (GstVideoFormat format)
 {
@@ -1131,6 +1295,163 @@ _get_black_for_format (GstVideoFormat format)
   }
 }
 
+static void
+gst_video_scale_free_tasks (GstVideoScale * videoscale)
+{
+  guint i;
+
+  if (videoscale->pool) {
+    g_thread_pool_free (videoscale->pool, FALSE, TRUE);
+    videoscale->pool = NULL;
+  }
+  if (videoscale->tasks) {
+    /* the first task uses the temp buffer of the element */
+    for (i = 1; i < videoscale->n_tasks; i++)
+      g_free (videoscale->tasks[i].tmp_buf);
+    g_free (videoscale->tasks);
+    videoscale->tasks = NULL;
+  }
+  videoscale->n_tasks = 1;
+}
+
+static void
+gst_video_scale_pool_func (gpointer data, gpointer user_data)
+{
+  GstVideoScaleTask *task = data;
+  GstVideoScale *videoscale = user_data;
+
+  task->ret = do_scale (GST_VIDEO_FILTER_CAST (videoscale), task->dest,
+      task->src, task->tmp_buf, task->band, videoscale->n_tasks);
+
+  g_mutex_lock (&videoscale->lock);
+  if (--videoscale->n_pending == 0)
+    g_cond_signal (&videoscale->cond);
+  g_mutex_unlock (&videoscale->lock);
+}
+
+/* make @n_threads tasks that each scale a band of the output lines, 0 uses
+ * the number of processors */
+static void
+gst_video_scale_setup_tasks (GstVideoScale * videoscale, guint n_threads)
+{
+  GstVideoFilter *filter = GST_VIDEO_FILTER_CAST (videoscale);
+  guint i;
+
+  if (n_threads == 0) {
+#if GLIB_CHECK_VERSION(2,36,0)
+    n_threads = g_get_num_processors ();
+#else
+    n_threads = 1;
+#endif
+  }
+  /* keep a few lines in each band */
+  n_threads = CLAMP (n_threads, 1,
+      MAX (1, GST_VIDEO_INFO_HEIGHT (&filter->out_info) / 16));
+
+  if (n_threads == videoscale->n_tasks)
+    return;
+
+  gst_video_scale_free_tasks (videoscale);
+
+  if (n_threads == 1)
+    return;
+
+  videoscale->pool = g_thread_pool_new (gst_video_scale_pool_func, videoscale,
+      n_threads - 1, FALSE, NULL);
+  if (videoscale->pool == NULL) {
+    GST_WARNING_OBJECT (videoscale, "could not create thread pool");
+    return;
+  }
+
+  videoscale->n_tasks = n_threads;
+  videoscale->tasks = g_new0 (GstVideoScaleTask, n_threads);
+  for (i = 0; i < n_threads; i++) {
+    GstVideoScaleTask *task = &videoscale->tasks[i];
+
+    task->videoscale = videoscale;
+    task->band = i;
+    if (i == 0)
+      task->tmp_buf = videoscale->tmp_buf;
+    else
+      task->tmp_buf =
+          g_malloc (GST_VIDEO_INFO_WIDTH (&filter->out_info) *
+          sizeof (guint64) * 4);
+  }
+  GST_DEBUG_OBJECT (videoscale, "using %u threads", n_threads);
+}
+
+/* scales @src into @dest, splitting the output lines over the tasks. The
+ * calling thread scales the first band. */
+static GstFlowReturn
+gst_video_scale_scale_bands (GstVideoScale * videoscale, VSImage dest[4],
+    VSImage src[4])
+{
+  GstFlowReturn ret;
+  guint i;
+
+  if (videoscale->n_tasks <= 1)
+    return do_scale (GST_VIDEO_FILTER_CAST (videoscale), dest, src,
+        videoscale->tmp_buf, 0, 1);
+
+  videoscale->n_pending = videoscale->n_tasks - 1;
+  for (i = 0; i < videoscale->n_tasks; i++) {
+    videoscale->tasks[i].dest = dest;
+    videoscale->tasks[i].src = src;
+  }
+  for (i = 1; i < videoscale->n_tasks; i++)
+    g_thread_pool_push (videoscale->pool, &videoscale->tasks[i], NULL);
+
+  ret = do_scale (GST_VIDEO_FILTER_CAST (videoscale), dest, src,
+      videoscale->tmp_buf, 0, videoscale->n_tasks);
+
+  g_mutex_lock (&videoscale->lock);
+  while (videoscale->n_pending > 0)
+    g_cond_wait (&videoscale->cond, &videoscale->lock);
+  g_mutex_unlock (&videoscale->lock);
+
+  for (i = 1; i < videoscale->n_tasks && ret == GST_FLOW_OK; i++)
+    ret = videoscale->tasks[i].ret;
+
+  return ret;
+}
+
+/* select the method to scale the next frame with. When downstream QoS
+ * reports that we are too slow we fall back to the cheaper methods until the
+ * pipeline has caught up again, changes are posted on the bus. */
+static GstVideoScaleMethod
+gst_video_scale_update_qos_method (GstVideoScale * videoscale)
+{
+  GstVideoScaleMethod method, prev;
+  gdouble proportion;
+
+  GST_OBJECT_LOCK (videoscale);
+  proportion = videoscale->qos_proportion;
+  prev = method = videoscale->qos_method;
+
+  if (proportion >= QOS_NEAREST_PROPORTION)
+    method = GST_VIDEO_SCALE_NEAREST;
+  else if (proportion >= QOS_BILINEAR_PROPORTION)
+    method = MIN (method, GST_VIDEO_SCALE_BILINEAR);
+  else if (proportion < QOS_RESTORE_PROPORTION)
+    method = videoscale->method;
+  /* never use a more expensive method than configured */
+  method = MIN (method, videoscale->method);
+
+  videoscale->qos_method = method;
+  GST_OBJECT_UNLOCK (videoscale);
+
+  if (method != prev) {
+    GST_DEBUG_OBJECT (videoscale, "QoS proportion %f, using method %d",
+        proportion, method);
+    gst_element_post_message (GST_ELEMENT_CAST (videoscale),
+        gst_message_new_element (GST_OBJECT_CAST (videoscale),
+            gst_structure_new ("GstVideoScaleQoS",
+                "method", GST_TYPE_VIDEO_SCALE_METHOD, method,
+                "proportion", G_TYPE_DOUBLE, proportion, NULL)));
+  }
+  return method;
+}
+
 static GstFlowReturn
 gst_video_scale_transform_frame (GstVideoFilter * filter,
     GstVideoFrame * in_frame, GstVideoFrame * out_frame)
@@ -1140,31 +1461,55 @@ gst_video_scale_transform_frame (GstVideoFilter * filter,
   VSImage dest[4] = { {NULL,}, };
   VSImage src[4] = { {NULL,}, };
   gint i;
-  gboolean interlaced;
+  gboolean interlaced, crop;
+  gint crop_x, crop_y, crop_w, crop_h;
+  guint n_threads;
+  GstVideoScaleMethod method;
+
+  method = gst_video_scale_update_qos_method (videoscale);
+
+  GST_OBJECT_LOCK (videoscale);
+  /* only the 4-tap and lanczos methods are slow enough to use threads */
+  if (method == GST_VIDEO_SCALE_4TAP || method == GST_VIDEO_SCALE_LANCZOS)
+    n_threads = videoscale->n_threads;
+  else
+    n_threads = 1;
+  GST_OBJECT_UNLOCK (videoscale);
+
+  gst_video_scale_setup_tasks (videoscale, n_threads);
 
   interlaced = GST_VIDEO_FRAME_IS_INTERLACED (in_frame);
+  crop = gst_video_scale_get_crop (videoscale, in_frame, &crop_x, &crop_y,
+      &crop_w, &crop_h);
 
   for (i = 0; i < GST_VIDEO_FRAME_N_PLANES (in_frame); i++) {
     gst_video_scale_setup_vs_image (&src[i], in_frame, i, 0, 0, interlaced, 0);
+    if (crop)
+      gst_video_scale_crop_vs_image (&src[i], in_frame, i, crop_x, crop_y,
+          crop_w, crop_h, interlaced);
     gst_video_scale_setup_vs_image (&dest[i], out_frame, i,
         videoscale->borders_w, videoscale->borders_h, interlaced, 0);
   }
-  ret = do_scale (filter, dest, src);
+  ret = gst_video_scale_scale_bands (videoscale, dest, src);
 
-  if (interlaced) {
+  if (interlaced && ret == GST_FLOW_OK) {
     for (i = 0; i < GST_VIDEO_FRAME_N_PLANES (in_frame); i++) {
       gst_video_scale_setup_vs_image (&src[i], in_frame, i, 0, 0, interlaced,
           1);
+      if (crop)
+        gst_video_scale_crop_vs_image (&src[i], in_frame, i, crop_x, crop_y,
+            crop_w, crop_h, interlaced);
       gst_video_scale_setup_vs_image (&dest[i], out_frame, i,
           videoscale->borders_w, videoscale->borders_h, interlaced, 1);
     }
-    ret = do_scale (filter, dest, src);
+    ret = gst_video_scale_scale_bands (videoscale, dest, src);
   }
   return ret;
 }
 
 static GstFlowReturn
-do_scale (GstVideoFilter * filter, VSImage dest[4], VSImage src[4])
+do_scale (GstVideoFilter * filter, VSImage dest[4], VSImage src[4],
+    guint8 * tmp_buf, gint band, gint n_bands)
 {
   GstVideoScale *videoscale = GST_VIDEO_SCALE (filter);
   GstFlowReturn ret = GST_FLOW_OK;
@@ -1174,21 +1519,28 @@ do_scale (GstVideoFilter * filter, VSImage dest[4], VSImage src[4])
   gboolean add_borders;
 
   GST_OBJECT_LOCK (videoscale);
-  method = videoscale->method;
+  method = videoscale->qos_method;
   add_borders = videoscale->add_borders;
   GST_OBJECT_UNLOCK (videoscale);
 
   format = GST_VIDEO_INFO_FORMAT (&filter->in_info);
   black = _get_black_for_format (format);
 
-  if (filter->in_info.width == 1) {
+  /* the source can be smaller than the caps when it is cropped */
+  if (src[0].width == 1) {
     method = GST_VIDEO_SCALE_NEAREST;
   }
   if (method == GST_VIDEO_SCALE_4TAP &&
-      (filter->in_info.width < 4 || filter->in_info.height < 4)) {
+      (src[0].width < 4 || src[0].height < 4)) {
     method = GST_VIDEO_SCALE_BILINEAR;
   }
 
+  /* only 4-tap and lanczos can scale a band of lines, the other methods
+   * scale the whole image in the first band */
+  if (band > 0 && method != GST_VIDEO_SCALE_4TAP &&
+      method != GST_VIDEO_SCALE_LANCZOS)
+    return GST_FLOW_OK;
+
   GST_CAT_DEBUG_OBJECT (GST_CAT_PERFORMANCE, filter,
       "doing videoscale format %s", GST_VIDEO_INFO_NAME (&filter->in_info));
 
@@ -1202,22 +1554,26 @@ do_scale (GstVideoFilter * filter, VSImage dest[4], VSImage src[4])
     case GST_VIDEO_FORMAT_BGRA:
     case GST_VIDEO_FORMAT_ABGR:
     case GST_VIDEO_FORMAT_AYUV:
-      if (add_borders)
+      if (add_borders && band == 0)
         vs_fill_borders_RGBA (&dest[0], black);
       switch (method) {
         case GST_VIDEO_SCALE_NEAREST:
-          vs_image_scale_nearest_RGBA (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_nearest_RGBA (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_BILINEAR:
-          vs_image_scale_linear_RGBA (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_linear_RGBA (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_4TAP:
-          vs_image_scale_4tap_RGBA (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_4tap_RGBA (&dest[0], &src[0], tmp_buf,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
           break;
         case GST_VIDEO_SCALE_LANCZOS:
-          vs_image_scale_lanczos_AYUV (&dest[0], &src[0], videoscale->tmp_buf,
+          vs_image_scale_lanczos_AYUV (&dest[0], &src[0], tmp_buf,
               videoscale->sharpness, videoscale->dither, videoscale->submethod,
-              videoscale->envelope, videoscale->sharpen);
+              videoscale->envelope, videoscale->sharpen,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
           break;
         default:
           goto unknown_mode;
@@ -1225,23 +1581,26 @@ do_scale (GstVideoFilter * filter, VSImage dest[4], VSImage src[4])
       break;
     case GST_VIDEO_FORMAT_ARGB64:
     case GST_VIDEO_FORMAT_AYUV64:
-      if (add_borders)
+      if (add_borders && band == 0)
         vs_fill_borders_AYUV64 (&dest[0], black);
       switch (method) {
         case GST_VIDEO_SCALE_NEAREST:
-          vs_image_scale_nearest_AYUV64 (&dest[0], &src[0],
-              videoscale->tmp_buf);
+          vs_image_scale_nearest_AYUV64 (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_BILINEAR:
-          vs_image_scale_linear_AYUV64 (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_linear_AYUV64 (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_4TAP:
-          vs_image_scale_4tap_AYUV64 (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_4tap_AYUV64 (&dest[0], &src[0], tmp_buf,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
           break;
         case GST_VIDEO_SCALE_LANCZOS:
-          vs_image_scale_lanczos_AYUV64 (&dest[0], &src[0], videoscale->tmp_buf,
+          vs_image_scale_lanczos_AYUV64 (&dest[0], &src[0], tmp_buf,
               videoscale->sharpness, videoscale->dither, videoscale->submethod,
-              videoscale->envelope, videoscale->sharpen);
+              videoscale->envelope, videoscale->sharpen,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
           break;
         default:
           goto unknown_mode;
@@ -1250,17 +1609,19 @@ do_scale (GstVideoFilter * filter, VSImage dest[4], VSImage src[4])
     case GST_VIDEO_FORMAT_RGB:
     case GST_VIDEO_FORMAT_BGR:
     case GST_VIDEO_FORMAT_v308:
-      if (add_borders)
+      if (add_borders && band == 0)
         vs_fill_borders_RGB (&dest[0], black);
       switch (method) {
         case GST_VIDEO_SCALE_NEAREST:
-          vs_image_scale_nearest_RGB (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_nearest_RGB (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_BILINEAR:
-          vs_image_scale_linear_RGB (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_linear_RGB (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_4TAP:
-          vs_image_scale_4tap_RGB (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_4tap_RGB (&dest[0], &src[0], tmp_buf,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
           break;
         default:
           goto unknown_mode;
@@ -1268,51 +1629,57 @@ do_scale (GstVideoFilter * filter, VSImage dest[4], VSImage src[4])
       break;
     case GST_VIDEO_FORMAT_YUY2:
     case GST_VIDEO_FORMAT_YVYU:
-      if (add_borders)
+      if (add_borders && band == 0)
         vs_fill_borders_YUYV (&dest[0], black);
       switch (method) {
         case GST_VIDEO_SCALE_NEAREST:
-          vs_image_scale_nearest_YUYV (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_nearest_YUYV (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_BILINEAR:
-          vs_image_scale_linear_YUYV (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_linear_YUYV (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_4TAP:
-          vs_image_scale_4tap_YUYV (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_4tap_YUYV (&dest[0], &src[0], tmp_buf,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
           break;
         default:
           goto unknown_mode;
       }
       break;
     case GST_VIDEO_FORMAT_UYVY:
-      if (add_borders)
+      if (add_borders && band == 0)
         vs_fill_borders_UYVY (&dest[0], black);
       switch (method) {
         case GST_VIDEO_SCALE_NEAREST:
-          vs_image_scale_nearest_UYVY (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_nearest_UYVY (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_BILINEAR:
-          vs_image_scale_linear_UYVY (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_linear_UYVY (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_4TAP:
-          vs_image_scale_4tap_UYVY (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_4tap_UYVY (&dest[0], &src[0], tmp_buf,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
           break;
         default:
           goto unknown_mode;
       }
       break;
     case GST_VIDEO_FORMAT_GRAY8:
-      if (add_borders)
+      if (add_borders && band == 0)
         vs_fill_borders_Y (&dest[0], black);
       switch (method) {
         case GST_VIDEO_SCALE_NEAREST:
-          vs_image_scale_nearest_Y (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_nearest_Y (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_BILINEAR:
-          vs_image_scale_linear_Y (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_linear_Y (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_4TAP:
-          vs_image_scale_4tap_Y (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_4tap_Y (&dest[0], &src[0], tmp_buf,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
           break;
         default:
           goto unknown_mode;
@@ -1320,17 +1687,19 @@ do_scale (GstVideoFilter * filter, VSImage dest[4], VSImage src[4])
       break;
     case GST_VIDEO_FORMAT_GRAY16_LE:
     case GST_VIDEO_FORMAT_GRAY16_BE:
-      if (add_borders)
+      if (add_borders && band == 0)
         vs_fill_borders_Y16 (&dest[0], 0);
       switch (method) {
         case GST_VIDEO_SCALE_NEAREST:
-          vs_image_scale_nearest_Y16 (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_nearest_Y16 (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_BILINEAR:
-          vs_image_scale_linear_Y16 (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_linear_Y16 (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_4TAP:
-          vs_image_scale_4tap_Y16 (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_4tap_Y16 (&dest[0], &src[0], tmp_buf,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
           break;
         default:
           goto unknown_mode;
@@ -1341,37 +1710,49 @@ do_scale (GstVideoFilter * filter, VSImage dest[4], VSImage src[4])
     case GST_VIDEO_FORMAT_Y444:
     case GST_VIDEO_FORMAT_Y42B:
     case GST_VIDEO_FORMAT_Y41B:
-      if (add_borders) {
+      if (add_borders && band == 0) {
         vs_fill_borders_Y (&dest[0], black);
         vs_fill_borders_Y (&dest[1], black + 1);
         vs_fill_borders_Y (&dest[2], black + 2);
       }
       switch (method) {
         case GST_VIDEO_SCALE_NEAREST:
-          vs_image_scale_nearest_Y (&dest[0], &src[0], videoscale->tmp_buf);
-          vs_image_scale_nearest_Y (&dest[1], &src[1], videoscale->tmp_buf);
-          vs_image_scale_nearest_Y (&dest[2], &src[2], videoscale->tmp_buf);
+          vs_image_scale_nearest_Y (&dest[0], &src[0], tmp_buf);
+          vs_image_scale_nearest_Y (&dest[1], &src[1], tmp_buf);
+          vs_image_scale_nearest_Y (&dest[2], &src[2], tmp_buf);
           break;
         case GST_VIDEO_SCALE_BILINEAR:
-          vs_image_scale_linear_Y (&dest[0], &src[0], videoscale->tmp_buf);
-          vs_image_scale_linear_Y (&dest[1], &src[1], videoscale->tmp_buf);
-          vs_image_scale_linear_Y (&dest[2], &src[2], videoscale->tmp_buf);
+          vs_image_scale_linear_Y (&dest[0], &src[0], tmp_buf);
+          vs_image_scale_linear_Y (&dest[1], &src[1], tmp_buf);
+          vs_image_scale_linear_Y (&dest[2], &src[2], tmp_buf);
           break;
         case GST_VIDEO_SCALE_4TAP:
-          vs_image_scale_4tap_Y (&dest[0], &src[0], videoscale->tmp_buf);
-          vs_image_scale_4tap_Y (&dest[1], &src[1], videoscale->tmp_buf);
-          vs_image_scale_4tap_Y (&dest[2], &src[2], videoscale->tmp_buf);
+          vs_image_scale_4tap_Y (&dest[0], &src[0], tmp_buf,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
+          vs_image_scale_4tap_Y (&dest[1], &src[1], tmp_buf,
+              BAND_START (dest[1], band, n_bands),
+              BAND_END (dest[1], band, n_bands));
+          vs_image_scale_4tap_Y (&dest[2], &src[2], tmp_buf,
+              BAND_START (dest[2], band, n_bands),
+              BAND_END (dest[2], band, n_bands));
           break;
         case GST_VIDEO_SCALE_LANCZOS:
-          vs_image_scale_lanczos_Y (&dest[0], &src[0], videoscale->tmp_buf,
+          vs_image_scale_lanczos_Y (&dest[0], &src[0], tmp_buf,
               videoscale->sharpness, videoscale->dither, videoscale->submethod,
-              videoscale->envelope, videoscale->sharpen);
-          vs_image_scale_lanczos_Y (&dest[1], &src[1], videoscale->tmp_buf,
+              videoscale->envelope, videoscale->sharpen,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
+          vs_image_scale_lanczos_Y (&dest[1], &src[1], tmp_buf,
               videoscale->sharpness, videoscale->dither, videoscale->submethod,
-              videoscale->envelope, videoscale->sharpen);
-          vs_image_scale_lanczos_Y (&dest[2], &src[2], videoscale->tmp_buf,
+              videoscale->envelope, videoscale->sharpen,
+              BAND_START (dest[1], band, n_bands),
+              BAND_END (dest[1], band, n_bands));
+          vs_image_scale_lanczos_Y (&dest[2], &src[2], tmp_buf,
               videoscale->sharpness, videoscale->dither, videoscale->submethod,
-              videoscale->envelope, videoscale->sharpen);
+              videoscale->envelope, videoscale->sharpen,
+              BAND_START (dest[2], band, n_bands),
+              BAND_END (dest[2], band, n_bands));
           break;
         default:
           goto unknown_mode;
@@ -1380,48 +1761,50 @@ do_scale (GstVideoFilter * filter, VSImage dest[4], VSImage src[4])
     case GST_VIDEO_FORMAT_NV12:
       switch (method) {
         case GST_VIDEO_SCALE_NEAREST:
-          vs_image_scale_nearest_Y (&dest[0], &src[0], videoscale->tmp_buf);
-          vs_image_scale_nearest_NV12 (&dest[1], &src[1], videoscale->tmp_buf);
+          vs_image_scale_nearest_Y (&dest[0], &src[0], tmp_buf);
+          vs_image_scale_nearest_NV12 (&dest[1], &src[1], tmp_buf);
           break;
         case GST_VIDEO_SCALE_BILINEAR:
-          vs_image_scale_linear_Y (&dest[0], &src[0], videoscale->tmp_buf);
-          vs_image_scale_linear_NV12 (&dest[1], &src[1], videoscale->tmp_buf);
+          vs_image_scale_linear_Y (&dest[0], &src[0], tmp_buf);
+          vs_image_scale_linear_NV12 (&dest[1], &src[1], tmp_buf);
           break;
         default:
           goto unknown_mode;
       }
       break;
     case GST_VIDEO_FORMAT_RGB16:
-      if (add_borders)
+      if (add_borders && band == 0)
         vs_fill_borders_RGB565 (&dest[0], black);
       switch (method) {
         case GST_VIDEO_SCALE_NEAREST:
-          vs_image_scale_nearest_RGB565 (&dest[0], &src[0],
-              videoscale->tmp_buf);
+          vs_image_scale_nearest_RGB565 (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_BILINEAR:
-          vs_image_scale_linear_RGB565 (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_linear_RGB565 (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_4TAP:
-          vs_image_scale_4tap_RGB565 (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_4tap_RGB565 (&dest[0], &src[0], tmp_buf,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
           break;
         default:
           goto unknown_mode;
       }
       break;
     case GST_VIDEO_FORMAT_RGB15:
-      if (add_borders)
+      if (add_borders && band == 0)
         vs_fill_borders_RGB555 (&dest[0], black);
       switch (method) {
         case GST_VIDEO_SCALE_NEAREST:
-          vs_image_scale_nearest_RGB555 (&dest[0], &src[0],
-              videoscale->tmp_buf);
+          vs_image_scale_nearest_RGB555 (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_BILINEAR:
-          vs_image_scale_linear_RGB555 (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_linear_RGB555 (&dest[0], &src[0], tmp_buf);
           break;
         case GST_VIDEO_SCALE_4TAP:
-          vs_image_scale_4tap_RGB555 (&dest[0], &src[0], videoscale->tmp_buf);
+          vs_image_scale_4tap_RGB555 (&dest[0], &src[0], tmp_buf,
+              BAND_START (dest[0], band, n_bands),
+              BAND_END (dest[0], band, n_bands));
           break;
         default:
           goto unknown_mode;
@@ -1443,7 +1826,7 @@ unsupported:
 unknown_mode:
   {
     GST_ELEMENT_ERROR (videoscale, STREAM, NOT_IMPLEMENTED, (NULL),
-        ("Unknown scaling method %d", videoscale->method));
+        ("Unknown scaling method %d", method));
     return GST_FLOW_ERROR;
   }
 }
@@ -1461,6 +1844,16 @@ gst_video_scale_src_event (GstBaseTransform * trans, GstEvent * event)
       GST_EVENT_TYPE_NAME (event));
 
   switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_QOS:
+      if (gst_base_transform_is_qos_enabled (trans)) {
+        gdouble proportion;
+
+        gst_event_parse_qos (event, NULL, &proportion, NULL, NULL);
+        GST_OBJECT_LOCK (videoscale);
+        videoscale->qos_proportion = proportion;
+        GST_OBJECT_UNLOCK (videoscale);
+      }
+      break;
     case GST_EVENT_NAVIGATION:
       if (filter->in_info.width != filter->out_info.width ||
           filter->in_info.height != filter->out_info.height) {
@@ -1494,6 +1887,10 @@ plugin_init (GstPlugin * plugin)
           GST_TYPE_VIDEO_SCALE))
     return FALSE;
 
+  if (!gst_element_register (plugin, "videoconvertscale", GST_RANK_NONE,
+          GST_TYPE_VIDEO_CONVERT_SCALE))
+    return FALSE;
+
   GST_DEBUG_CATEGORY_INIT (video_scale_debug, "videoscale", 0,
       "videoscale element");
   GST_DEBUG_CATEGORY_GET (GST_CAT_PERFORMANCE, "GST_PERFORMANCE");
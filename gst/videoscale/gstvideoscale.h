@@ -62,6 +62,7 @@ typedef enum {
 
 typedef struct _GstVideoScale GstVideoScale;
 typedef struct _GstVideoScaleClass GstVideoScaleClass;
+typedef struct _GstVideoScaleTask GstVideoScaleTask;
 
 /**
  * GstVideoScale:
@@ -79,12 +80,24 @@ struct _GstVideoScale {
   gboolean dither;
   int submethod;
   double envelope;
+  guint n_threads;
 
   gint borders_h;
   gint borders_w;
 
   /*< private >*/
   guint8 *tmp_buf;
+
+  guint n_tasks;
+  GstVideoScaleTask *tasks;
+  GThreadPool *pool;
+  GMutex lock;
+  GCond cond;
+  guint n_pending;
+
+  /* last proportion from downstream QoS and the method in use for it */
+  gdouble qos_proportion;
+  GstVideoScaleMethod qos_method;
 };
 
 struct _GstVideoScaleClass {
@@ -93,6 +106,9 @@ struct _GstVideoScaleClass {
 
 G_GNUC_INTERNAL GType gst_video_scale_get_type (void);
 
+G_GNUC_INTERNAL gboolean gst_video_scale_get_crop (GstVideoScale * videoscale,
+    GstVideoFrame * frame, gint * x, gint * y, gint * width, gint * height);
+
 G_END_DECLS
 
 #endif /* __GST_VIDEO_SCALE_H__ */
@@ -124,10 +124,25 @@ void video_scale_orc_resample_bilinear_u32 (guint8 * ORC_RESTRICT d1,
 void video_scale_orc_resample_merge_bilinear_u32 (guint8 * ORC_RESTRICT d1,
     guint8 * ORC_RESTRICT d2, const guint8 * ORC_RESTRICT s1,
     const guint8 * ORC_RESTRICT s2, int p1, int p2, int p3, int n);
+void video_scale_orc_widen_u16 (guint32 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n);
+void video_scale_orc_resample_nearest_widened_u16 (guint16 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, int p1, int p2, int n);
+void video_scale_orc_resample_bilinear_widened_u16 (guint16 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, int p1, int p2, int n);
 void video_scale_orc_merge_bicubic_u8 (guint8 * ORC_RESTRICT d1,
     const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2,
     const guint8 * ORC_RESTRICT s3, const guint8 * ORC_RESTRICT s4, int p1,
     int p2, int p3, int p4, int n);
+void video_scale_orc_resample_vert_s16_init (gint32 * ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2, int p1,
+    int p2, int n);
+void video_scale_orc_resample_vert_s16_acc (gint32 * ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2, int p1,
+    int p2, int n);
+void video_scale_orc_resample_vert_s16_final (guint8 * ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2,
+    const gint16 * ORC_RESTRICT s3, int p1, int p2, int n);
 
 
 /* begin Orc C target preamble */
@@ -2286,188 +2301,62 @@ video_scale_orc_resample_merge_bilinear_u32 (guint8 * ORC_RESTRICT d1,
 #endif
 
 
-/* video_scale_orc_merge_bicubic_u8 */
+/* video_scale_orc_widen_u16 */
 #ifdef DISABLE_ORC
 void
-video_scale_orc_merge_bicubic_u8 (guint8 * ORC_RESTRICT d1,
-    const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2,
-    const guint8 * ORC_RESTRICT s3, const guint8 * ORC_RESTRICT s4, int p1,
-    int p2, int p3, int p4, int n)
+video_scale_orc_widen_u16 (guint32 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n)
 {
   int i;
-  orc_int8 *ORC_RESTRICT ptr0;
-  const orc_int8 *ORC_RESTRICT ptr4;
-  const orc_int8 *ORC_RESTRICT ptr5;
-  const orc_int8 *ORC_RESTRICT ptr6;
-  const orc_int8 *ORC_RESTRICT ptr7;
-  orc_int8 var34;
-  orc_int8 var35;
-  orc_int8 var36;
-  orc_int8 var37;
-  orc_int8 var38;
-  orc_int8 var39;
-  orc_int8 var40;
-  orc_int8 var41;
-#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
-  volatile orc_union16 var42;
-#else
-  orc_union16 var42;
-#endif
-  orc_int8 var43;
-  orc_union16 var44;
-  orc_union16 var45;
-  orc_union16 var46;
-  orc_union16 var47;
-  orc_union16 var48;
-  orc_union16 var49;
-  orc_union16 var50;
-  orc_union16 var51;
-  orc_union16 var52;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  orc_union16 var32;
+  orc_union32 var33;
 
-  ptr0 = (orc_int8 *) d1;
-  ptr4 = (orc_int8 *) s1;
-  ptr5 = (orc_int8 *) s2;
-  ptr6 = (orc_int8 *) s3;
-  ptr7 = (orc_int8 *) s4;
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union16 *) s1;
 
-  /* 1: loadpb */
-  var35 = p2;
-  /* 4: loadpb */
-  var37 = p3;
-  /* 8: loadpb */
-  var39 = p1;
-  /* 12: loadpb */
-  var41 = p4;
-  /* 15: loadpw */
-  var42.i = (int) 0x00000020;   /* 32 or 1.58101e-322f */
 
   for (i = 0; i < n; i++) {
-    /* 0: loadb */
-    var34 = ptr5[i];
-    /* 2: mulubw */
-    var44.i = ((orc_uint8) var34) * ((orc_uint8) var35);
-    /* 3: loadb */
-    var36 = ptr6[i];
-    /* 5: mulubw */
-    var45.i = ((orc_uint8) var36) * ((orc_uint8) var37);
-    /* 6: addw */
-    var46.i = var44.i + var45.i;
-    /* 7: loadb */
-    var38 = ptr4[i];
-    /* 9: mulubw */
-    var47.i = ((orc_uint8) var38) * ((orc_uint8) var39);
-    /* 10: subw */
-    var48.i = var46.i - var47.i;
-    /* 11: loadb */
-    var40 = ptr7[i];
-    /* 13: mulubw */
-    var49.i = ((orc_uint8) var40) * ((orc_uint8) var41);
-    /* 14: subw */
-    var50.i = var48.i - var49.i;
-    /* 16: addw */
-    var51.i = var50.i + var42.i;
-    /* 17: shrsw */
-    var52.i = var51.i >> 6;
-    /* 18: convsuswb */
-    var43 = ORC_CLAMP_UB (var52.i);
-    /* 19: storeb */
-    ptr0[i] = var43;
+    /* 0: loadw */
+    var32 = ptr4[i];
+    /* 1: convuwl */
+    var33.i = (orc_uint16) var32.i;
+    /* 2: storel */
+    ptr0[i] = var33;
   }
 
 }
 
 #else
 static void
-_backup_video_scale_orc_merge_bicubic_u8 (OrcExecutor * ORC_RESTRICT ex)
+_backup_video_scale_orc_widen_u16 (OrcExecutor * ORC_RESTRICT ex)
 {
   int i;
   int n = ex->n;
-  orc_int8 *ORC_RESTRICT ptr0;
-  const orc_int8 *ORC_RESTRICT ptr4;
-  const orc_int8 *ORC_RESTRICT ptr5;
-  const orc_int8 *ORC_RESTRICT ptr6;
-  const orc_int8 *ORC_RESTRICT ptr7;
-  orc_int8 var34;
-  orc_int8 var35;
-  orc_int8 var36;
-  orc_int8 var37;
-  orc_int8 var38;
-  orc_int8 var39;
-  orc_int8 var40;
-  orc_int8 var41;
-#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
-  volatile orc_union16 var42;
-#else
-  orc_union16 var42;
-#endif
-  orc_int8 var43;
-  orc_union16 var44;
-  orc_union16 var45;
-  orc_union16 var46;
-  orc_union16 var47;
-  orc_union16 var48;
-  orc_union16 var49;
-  orc_union16 var50;
-  orc_union16 var51;
-  orc_union16 var52;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  orc_union16 var32;
+  orc_union32 var33;
 
-  ptr0 = (orc_int8 *) ex->arrays[0];
-  ptr4 = (orc_int8 *) ex->arrays[4];
-  ptr5 = (orc_int8 *) ex->arrays[5];
-  ptr6 = (orc_int8 *) ex->arrays[6];
-  ptr7 = (orc_int8 *) ex->arrays[7];
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
 
-  /* 1: loadpb */
-  var35 = ex->params[25];
-  /* 4: loadpb */
-  var37 = ex->params[26];
-  /* 8: loadpb */
-  var39 = ex->params[24];
-  /* 12: loadpb */
-  var41 = ex->params[27];
-  /* 15: loadpw */
-  var42.i = (int) 0x00000020;   /* 32 or 1.58101e-322f */
 
   for (i = 0; i < n; i++) {
-    /* 0: loadb */
-    var34 = ptr5[i];
-    /* 2: mulubw */
-    var44.i = ((orc_uint8) var34) * ((orc_uint8) var35);
-    /* 3: loadb */
-    var36 = ptr6[i];
-    /* 5: mulubw */
-    var45.i = ((orc_uint8) var36) * ((orc_uint8) var37);
-    /* 6: addw */
-    var46.i = var44.i + var45.i;
-    /* 7: loadb */
-    var38 = ptr4[i];
-    /* 9: mulubw */
-    var47.i = ((orc_uint8) var38) * ((orc_uint8) var39);
-    /* 10: subw */
-    var48.i = var46.i - var47.i;
-    /* 11: loadb */
-    var40 = ptr7[i];
-    /* 13: mulubw */
-    var49.i = ((orc_uint8) var40) * ((orc_uint8) var41);
-    /* 14: subw */
-    var50.i = var48.i - var49.i;
-    /* 16: addw */
-    var51.i = var50.i + var42.i;
-    /* 17: shrsw */
-    var52.i = var51.i >> 6;
-    /* 18: convsuswb */
-    var43 = ORC_CLAMP_UB (var52.i);
-    /* 19: storeb */
-    ptr0[i] = var43;
+    /* 0: loadw */
+    var32 = ptr4[i];
+    /* 1: convuwl */
+    var33.i = (orc_uint16) var32.i;
+    /* 2: storel */
+    ptr0[i] = var33;
   }
 
 }
 
 void
-video_scale_orc_merge_bicubic_u8 (guint8 * ORC_RESTRICT d1,
-    const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2,
-    const guint8 * ORC_RESTRICT s3, const guint8 * ORC_RESTRICT s4, int p1,
-    int p2, int p3, int p4, int n)
+video_scale_orc_widen_u16 (guint32 * ORC_RESTRICT d1,
+    const guint16 * ORC_RESTRICT s1, int n)
 {
   OrcExecutor _ex, *ex = &_ex;
   static volatile int p_inited = 0;
@@ -2481,57 +2370,21 @@ video_scale_orc_merge_bicubic_u8 (guint8 * ORC_RESTRICT d1,
 
 #if 1
       static const orc_uint8 bc[] = {
-        1, 9, 32, 118, 105, 100, 101, 111, 95, 115, 99, 97, 108, 101, 95, 111,
-        114, 99, 95, 109, 101, 114, 103, 101, 95, 98, 105, 99, 117, 98, 105, 99,
-        95, 117, 56, 11, 1, 1, 12, 1, 1, 12, 1, 1, 12, 1, 1, 12,
-        1, 1, 14, 4, 32, 0, 0, 0, 14, 4, 6, 0, 0, 0, 16, 4,
-        16, 4, 16, 4, 16, 4, 20, 2, 20, 2, 175, 32, 5, 25, 175, 33,
-        6, 26, 70, 32, 32, 33, 175, 33, 4, 24, 98, 32, 32, 33, 175, 33,
-        7, 27, 98, 32, 32, 33, 70, 32, 32, 16, 94, 32, 32, 17, 160, 0,
-        32, 2, 0,
+        1, 9, 25, 118, 105, 100, 101, 111, 95, 115, 99, 97, 108, 101, 95, 111,
+        114, 99, 95, 119, 105, 100, 101, 110, 95, 117, 49, 54, 11, 4, 4, 12,
+        2, 2, 154, 0, 4, 2, 0,
       };
       p = orc_program_new_from_static_bytecode (bc);
-      orc_program_set_backup_function (p,
-          _backup_video_scale_orc_merge_bicubic_u8);
+      orc_program_set_backup_function (p, _backup_video_scale_orc_widen_u16);
 #else
       p = orc_program_new ();
-      orc_program_set_name (p, "video_scale_orc_merge_bicubic_u8");
-      orc_program_set_backup_function (p,
-          _backup_video_scale_orc_merge_bicubic_u8);
-      orc_program_add_destination (p, 1, "d1");
-      orc_program_add_source (p, 1, "s1");
-      orc_program_add_source (p, 1, "s2");
-      orc_program_add_source (p, 1, "s3");
-      orc_program_add_source (p, 1, "s4");
-      orc_program_add_constant (p, 4, 0x00000020, "c1");
-      orc_program_add_constant (p, 4, 0x00000006, "c2");
-      orc_program_add_parameter (p, 4, "p1");
-      orc_program_add_parameter (p, 4, "p2");
-      orc_program_add_parameter (p, 4, "p3");
-      orc_program_add_parameter (p, 4, "p4");
-      orc_program_add_temporary (p, 2, "t1");
-      orc_program_add_temporary (p, 2, "t2");
+      orc_program_set_name (p, "video_scale_orc_widen_u16");
+      orc_program_set_backup_function (p, _backup_video_scale_orc_widen_u16);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 2, "s1");
 
-      orc_program_append_2 (p, "mulubw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P2,
-          ORC_VAR_D1);
-      orc_program_append_2 (p, "mulubw", 0, ORC_VAR_T2, ORC_VAR_S3, ORC_VAR_P3,
-          ORC_VAR_D1);
-      orc_program_append_2 (p, "addw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_T2,
-          ORC_VAR_D1);
-      orc_program_append_2 (p, "mulubw", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_P1,
-          ORC_VAR_D1);
-      orc_program_append_2 (p, "subw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_T2,
-          ORC_VAR_D1);
-      orc_program_append_2 (p, "mulubw", 0, ORC_VAR_T2, ORC_VAR_S4, ORC_VAR_P4,
-          ORC_VAR_D1);
-      orc_program_append_2 (p, "subw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_T2,
-          ORC_VAR_D1);
-      orc_program_append_2 (p, "addw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
-          ORC_VAR_D1);
-      orc_program_append_2 (p, "shrsw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_D1,
           ORC_VAR_D1);
-      orc_program_append_2 (p, "convsuswb", 0, ORC_VAR_D1, ORC_VAR_T1,
-          ORC_VAR_D1, ORC_VAR_D1);
 #endif
 
       orc_program_compile (p);
@@ -2547,13 +2400,1115 @@ video_scale_orc_merge_bicubic_u8 (guint8 * ORC_RESTRICT d1,
   ex->n = n;
   ex->arrays[ORC_VAR_D1] = d1;
   ex->arrays[ORC_VAR_S1] = (void *) s1;
-  ex->arrays[ORC_VAR_S2] = (void *) s2;
-  ex->arrays[ORC_VAR_S3] = (void *) s3;
-  ex->arrays[ORC_VAR_S4] = (void *) s4;
-  ex->params[ORC_VAR_P1] = p1;
-  ex->params[ORC_VAR_P2] = p2;
-  ex->params[ORC_VAR_P3] = p3;
-  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_scale_orc_resample_nearest_widened_u16 */
+#ifdef DISABLE_ORC
+void
+video_scale_orc_resample_nearest_widened_u16 (guint16 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, int p1, int p2, int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union32 var34;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr4 = (orc_union32 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: ldresnearl */
+    var34 = ptr4[(p1 + i * p2) >> 16];
+    /* 1: convlw */
+    var33.i = var34.i;
+    /* 2: storew */
+    ptr0[i] = var33;
+  }
+
+}
+
+#else
+static void
+_backup_video_scale_orc_resample_nearest_widened_u16 (OrcExecutor *
+    ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union32 var34;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: ldresnearl */
+    var34 = ptr4[(ex->params[24] + i * ex->params[25]) >> 16];
+    /* 1: convlw */
+    var33.i = var34.i;
+    /* 2: storew */
+    ptr0[i] = var33;
+  }
+
+}
+
+void
+video_scale_orc_resample_nearest_widened_u16 (guint16 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, int p1, int p2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 44, 118, 105, 100, 101, 111, 95, 115, 99, 97, 108, 101, 95, 111,
+        114, 99, 95, 114, 101, 115, 97, 109, 112, 108, 101, 95, 110, 101, 97,
+        114,
+        101, 115, 116, 95, 119, 105, 100, 101, 110, 101, 100, 95, 117, 49, 54,
+        11,
+        2, 2, 12, 4, 4, 16, 4, 16, 4, 20, 4, 49, 32, 4, 24, 25,
+        163, 0, 32, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_resample_nearest_widened_u16);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_scale_orc_resample_nearest_widened_u16");
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_resample_nearest_widened_u16);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_parameter (p, 4, "p1");
+      orc_program_add_parameter (p, 4, "p2");
+      orc_program_add_temporary (p, 4, "t1");
+
+      orc_program_append_2 (p, "ldresnearl", 0, ORC_VAR_T1, ORC_VAR_S1,
+          ORC_VAR_P1, ORC_VAR_P2);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_D1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_scale_orc_resample_bilinear_widened_u16 */
+#ifdef DISABLE_ORC
+void
+video_scale_orc_resample_bilinear_widened_u16 (guint16 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, int p1, int p2, int n)
+{
+  int i;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union32 var34;
+
+  ptr0 = (orc_union16 *) d1;
+  ptr4 = (orc_union32 *) s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: ldreslinl */
+    {
+      int tmp = p1 + i * p2;
+      orc_union32 a = ptr4[tmp >> 16];
+      orc_union32 b = ptr4[(tmp >> 16) + 1];
+      var34.x4[0] =
+          ((orc_uint8) a.x4[0] * (256 - ((tmp >> 8) & 0xff)) +
+          (orc_uint8) b.x4[0] * ((tmp >> 8) & 0xff)) >> 8;
+      var34.x4[1] =
+          ((orc_uint8) a.x4[1] * (256 - ((tmp >> 8) & 0xff)) +
+          (orc_uint8) b.x4[1] * ((tmp >> 8) & 0xff)) >> 8;
+      var34.x4[2] =
+          ((orc_uint8) a.x4[2] * (256 - ((tmp >> 8) & 0xff)) +
+          (orc_uint8) b.x4[2] * ((tmp >> 8) & 0xff)) >> 8;
+      var34.x4[3] =
+          ((orc_uint8) a.x4[3] * (256 - ((tmp >> 8) & 0xff)) +
+          (orc_uint8) b.x4[3] * ((tmp >> 8) & 0xff)) >> 8;
+    }
+    /* 1: convlw */
+    var33.i = var34.i;
+    /* 2: storew */
+    ptr0[i] = var33;
+  }
+
+}
+
+#else
+static void
+_backup_video_scale_orc_resample_bilinear_widened_u16 (OrcExecutor *
+    ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union32 var34;
+
+  ptr0 = (orc_union16 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: ldreslinl */
+    {
+      int tmp = ex->params[24] + i * ex->params[25];
+      orc_union32 a = ptr4[tmp >> 16];
+      orc_union32 b = ptr4[(tmp >> 16) + 1];
+      var34.x4[0] =
+          ((orc_uint8) a.x4[0] * (256 - ((tmp >> 8) & 0xff)) +
+          (orc_uint8) b.x4[0] * ((tmp >> 8) & 0xff)) >> 8;
+      var34.x4[1] =
+          ((orc_uint8) a.x4[1] * (256 - ((tmp >> 8) & 0xff)) +
+          (orc_uint8) b.x4[1] * ((tmp >> 8) & 0xff)) >> 8;
+      var34.x4[2] =
+          ((orc_uint8) a.x4[2] * (256 - ((tmp >> 8) & 0xff)) +
+          (orc_uint8) b.x4[2] * ((tmp >> 8) & 0xff)) >> 8;
+      var34.x4[3] =
+          ((orc_uint8) a.x4[3] * (256 - ((tmp >> 8) & 0xff)) +
+          (orc_uint8) b.x4[3] * ((tmp >> 8) & 0xff)) >> 8;
+    }
+    /* 1: convlw */
+    var33.i = var34.i;
+    /* 2: storew */
+    ptr0[i] = var33;
+  }
+
+}
+
+void
+video_scale_orc_resample_bilinear_widened_u16 (guint16 * ORC_RESTRICT d1,
+    const guint32 * ORC_RESTRICT s1, int p1, int p2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 45, 118, 105, 100, 101, 111, 95, 115, 99, 97, 108, 101, 95, 111,
+        114, 99, 95, 114, 101, 115, 97, 109, 112, 108, 101, 95, 98, 105, 108,
+        105,
+        110, 101, 97, 114, 95, 119, 105, 100, 101, 110, 101, 100, 95, 117, 49,
+        54,
+        11, 2, 2, 12, 4, 4, 16, 4, 16, 4, 20, 4, 51, 32, 4, 24,
+        25, 163, 0, 32, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_resample_bilinear_widened_u16);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_scale_orc_resample_bilinear_widened_u16");
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_resample_bilinear_widened_u16);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_parameter (p, 4, "p1");
+      orc_program_add_parameter (p, 4, "p2");
+      orc_program_add_temporary (p, 4, "t1");
+
+      orc_program_append_2 (p, "ldreslinl", 0, ORC_VAR_T1, ORC_VAR_S1,
+          ORC_VAR_P1, ORC_VAR_P2);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_D1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_scale_orc_merge_bicubic_u8 */
+#ifdef DISABLE_ORC
+void
+video_scale_orc_merge_bicubic_u8 (guint8 * ORC_RESTRICT d1,
+    const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2,
+    const guint8 * ORC_RESTRICT s3, const guint8 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  int i;
+  orc_int8 *ORC_RESTRICT ptr0;
+  const orc_int8 *ORC_RESTRICT ptr4;
+  const orc_int8 *ORC_RESTRICT ptr5;
+  const orc_int8 *ORC_RESTRICT ptr6;
+  const orc_int8 *ORC_RESTRICT ptr7;
+  orc_int8 var34;
+  orc_int8 var35;
+  orc_int8 var36;
+  orc_int8 var37;
+  orc_int8 var38;
+  orc_int8 var39;
+  orc_int8 var40;
+  orc_int8 var41;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var42;
+#else
+  orc_union16 var42;
+#endif
+  orc_int8 var43;
+  orc_union16 var44;
+  orc_union16 var45;
+  orc_union16 var46;
+  orc_union16 var47;
+  orc_union16 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_union16 var51;
+  orc_union16 var52;
+
+  ptr0 = (orc_int8 *) d1;
+  ptr4 = (orc_int8 *) s1;
+  ptr5 = (orc_int8 *) s2;
+  ptr6 = (orc_int8 *) s3;
+  ptr7 = (orc_int8 *) s4;
+
+  /* 1: loadpb */
+  var35 = p2;
+  /* 4: loadpb */
+  var37 = p3;
+  /* 8: loadpb */
+  var39 = p1;
+  /* 12: loadpb */
+  var41 = p4;
+  /* 15: loadpw */
+  var42.i = (int) 0x00000020;   /* 32 or 1.58101e-322f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadb */
+    var34 = ptr5[i];
+    /* 2: mulubw */
+    var44.i = ((orc_uint8) var34) * ((orc_uint8) var35);
+    /* 3: loadb */
+    var36 = ptr6[i];
+    /* 5: mulubw */
+    var45.i = ((orc_uint8) var36) * ((orc_uint8) var37);
+    /* 6: addw */
+    var46.i = var44.i + var45.i;
+    /* 7: loadb */
+    var38 = ptr4[i];
+    /* 9: mulubw */
+    var47.i = ((orc_uint8) var38) * ((orc_uint8) var39);
+    /* 10: subw */
+    var48.i = var46.i - var47.i;
+    /* 11: loadb */
+    var40 = ptr7[i];
+    /* 13: mulubw */
+    var49.i = ((orc_uint8) var40) * ((orc_uint8) var41);
+    /* 14: subw */
+    var50.i = var48.i - var49.i;
+    /* 16: addw */
+    var51.i = var50.i + var42.i;
+    /* 17: shrsw */
+    var52.i = var51.i >> 6;
+    /* 18: convsuswb */
+    var43 = ORC_CLAMP_UB (var52.i);
+    /* 19: storeb */
+    ptr0[i] = var43;
+  }
+
+}
+
+#else
+static void
+_backup_video_scale_orc_merge_bicubic_u8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_int8 *ORC_RESTRICT ptr0;
+  const orc_int8 *ORC_RESTRICT ptr4;
+  const orc_int8 *ORC_RESTRICT ptr5;
+  const orc_int8 *ORC_RESTRICT ptr6;
+  const orc_int8 *ORC_RESTRICT ptr7;
+  orc_int8 var34;
+  orc_int8 var35;
+  orc_int8 var36;
+  orc_int8 var37;
+  orc_int8 var38;
+  orc_int8 var39;
+  orc_int8 var40;
+  orc_int8 var41;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union16 var42;
+#else
+  orc_union16 var42;
+#endif
+  orc_int8 var43;
+  orc_union16 var44;
+  orc_union16 var45;
+  orc_union16 var46;
+  orc_union16 var47;
+  orc_union16 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_union16 var51;
+  orc_union16 var52;
+
+  ptr0 = (orc_int8 *) ex->arrays[0];
+  ptr4 = (orc_int8 *) ex->arrays[4];
+  ptr5 = (orc_int8 *) ex->arrays[5];
+  ptr6 = (orc_int8 *) ex->arrays[6];
+  ptr7 = (orc_int8 *) ex->arrays[7];
+
+  /* 1: loadpb */
+  var35 = ex->params[25];
+  /* 4: loadpb */
+  var37 = ex->params[26];
+  /* 8: loadpb */
+  var39 = ex->params[24];
+  /* 12: loadpb */
+  var41 = ex->params[27];
+  /* 15: loadpw */
+  var42.i = (int) 0x00000020;   /* 32 or 1.58101e-322f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadb */
+    var34 = ptr5[i];
+    /* 2: mulubw */
+    var44.i = ((orc_uint8) var34) * ((orc_uint8) var35);
+    /* 3: loadb */
+    var36 = ptr6[i];
+    /* 5: mulubw */
+    var45.i = ((orc_uint8) var36) * ((orc_uint8) var37);
+    /* 6: addw */
+    var46.i = var44.i + var45.i;
+    /* 7: loadb */
+    var38 = ptr4[i];
+    /* 9: mulubw */
+    var47.i = ((orc_uint8) var38) * ((orc_uint8) var39);
+    /* 10: subw */
+    var48.i = var46.i - var47.i;
+    /* 11: loadb */
+    var40 = ptr7[i];
+    /* 13: mulubw */
+    var49.i = ((orc_uint8) var40) * ((orc_uint8) var41);
+    /* 14: subw */
+    var50.i = var48.i - var49.i;
+    /* 16: addw */
+    var51.i = var50.i + var42.i;
+    /* 17: shrsw */
+    var52.i = var51.i >> 6;
+    /* 18: convsuswb */
+    var43 = ORC_CLAMP_UB (var52.i);
+    /* 19: storeb */
+    ptr0[i] = var43;
+  }
+
+}
+
+void
+video_scale_orc_merge_bicubic_u8 (guint8 * ORC_RESTRICT d1,
+    const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2,
+    const guint8 * ORC_RESTRICT s3, const guint8 * ORC_RESTRICT s4, int p1,
+    int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 32, 118, 105, 100, 101, 111, 95, 115, 99, 97, 108, 101, 95, 111,
+        114, 99, 95, 109, 101, 114, 103, 101, 95, 98, 105, 99, 117, 98, 105, 99,
+        95, 117, 56, 11, 1, 1, 12, 1, 1, 12, 1, 1, 12, 1, 1, 12,
+        1, 1, 14, 4, 32, 0, 0, 0, 14, 4, 6, 0, 0, 0, 16, 4,
+        16, 4, 16, 4, 16, 4, 20, 2, 20, 2, 175, 32, 5, 25, 175, 33,
+        6, 26, 70, 32, 32, 33, 175, 33, 4, 24, 98, 32, 32, 33, 175, 33,
+        7, 27, 98, 32, 32, 33, 70, 32, 32, 16, 94, 32, 32, 17, 160, 0,
+        32, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_merge_bicubic_u8);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_scale_orc_merge_bicubic_u8");
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_merge_bicubic_u8);
+      orc_program_add_destination (p, 1, "d1");
+      orc_program_add_source (p, 1, "s1");
+      orc_program_add_source (p, 1, "s2");
+      orc_program_add_source (p, 1, "s3");
+      orc_program_add_source (p, 1, "s4");
+      orc_program_add_constant (p, 4, 0x00000020, "c1");
+      orc_program_add_constant (p, 4, 0x00000006, "c2");
+      orc_program_add_parameter (p, 4, "p1");
+      orc_program_add_parameter (p, 4, "p2");
+      orc_program_add_parameter (p, 4, "p3");
+      orc_program_add_parameter (p, 4, "p4");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+
+      orc_program_append_2 (p, "mulubw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulubw", 0, ORC_VAR_T2, ORC_VAR_S3, ORC_VAR_P3,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulubw", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "subw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulubw", 0, ORC_VAR_T2, ORC_VAR_S4, ORC_VAR_P4,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "subw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convsuswb", 0, ORC_VAR_D1, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->arrays[ORC_VAR_S4] = (void *) s4;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_scale_orc_resample_vert_s16_init */
+#ifdef DISABLE_ORC
+void
+video_scale_orc_resample_vert_s16_init (gint32 * ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2, int p1,
+    int p2, int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+
+  /* 1: loadpw */
+  var35.i = p1;
+  /* 4: loadpw */
+  var37.i = p2;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var34 = ptr4[i];
+    /* 2: mulswl */
+    var39.i = var34.i * var35.i;
+    /* 3: loadw */
+    var36 = ptr5[i];
+    /* 5: mulswl */
+    var40.i = var36.i * var37.i;
+    /* 6: addl */
+    var38.i = var39.i + var40.i;
+    /* 7: storel */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_video_scale_orc_resample_vert_s16_init (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+
+  /* 1: loadpw */
+  var35.i = ex->params[24];
+  /* 4: loadpw */
+  var37.i = ex->params[25];
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var34 = ptr4[i];
+    /* 2: mulswl */
+    var39.i = var34.i * var35.i;
+    /* 3: loadw */
+    var36 = ptr5[i];
+    /* 5: mulswl */
+    var40.i = var36.i * var37.i;
+    /* 6: addl */
+    var38.i = var39.i + var40.i;
+    /* 7: storel */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+video_scale_orc_resample_vert_s16_init (gint32 * ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2, int p1,
+    int p2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 38, 118, 105, 100, 101, 111, 95, 115, 99, 97, 108, 101, 95, 111,
+        114, 99, 95, 114, 101, 115, 97, 109, 112, 108, 101, 95, 118, 101, 114,
+        116,
+        95, 115, 49, 54, 95, 105, 110, 105, 116, 11, 4, 4, 12, 2, 2, 12,
+        2, 2, 16, 2, 16, 2, 20, 4, 20, 4, 176, 32, 4, 24, 176, 33,
+        5, 25, 103, 0, 32, 33, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_resample_vert_s16_init);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_scale_orc_resample_vert_s16_init");
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_resample_vert_s16_init);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_parameter (p, 2, "p2");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_scale_orc_resample_vert_s16_acc */
+#ifdef DISABLE_ORC
+void
+video_scale_orc_resample_vert_s16_acc (gint32 * ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2, int p1,
+    int p2, int n)
+{
+  int i;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+
+  ptr0 = (orc_union32 *) d1;
+  ptr4 = (orc_union16 *) s1;
+  ptr5 = (orc_union16 *) s2;
+
+  /* 1: loadpw */
+  var35.i = p1;
+  /* 4: loadpw */
+  var37.i = p2;
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var34 = ptr4[i];
+    /* 2: mulswl */
+    var40.i = var34.i * var35.i;
+    /* 3: loadw */
+    var36 = ptr5[i];
+    /* 5: mulswl */
+    var41.i = var36.i * var37.i;
+    /* 6: addl */
+    var42.i = var40.i + var41.i;
+    /* 7: loadl */
+    var38 = ptr0[i];
+    /* 8: addl */
+    var39.i = var38.i + var42.i;
+    /* 9: storel */
+    ptr0[i] = var39;
+  }
+
+}
+
+#else
+static void
+_backup_video_scale_orc_resample_vert_s16_acc (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 *ORC_RESTRICT ptr0;
+  const orc_union16 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+
+  ptr0 = (orc_union32 *) ex->arrays[0];
+  ptr4 = (orc_union16 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+
+  /* 1: loadpw */
+  var35.i = ex->params[24];
+  /* 4: loadpw */
+  var37.i = ex->params[25];
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var34 = ptr4[i];
+    /* 2: mulswl */
+    var40.i = var34.i * var35.i;
+    /* 3: loadw */
+    var36 = ptr5[i];
+    /* 5: mulswl */
+    var41.i = var36.i * var37.i;
+    /* 6: addl */
+    var42.i = var40.i + var41.i;
+    /* 7: loadl */
+    var38 = ptr0[i];
+    /* 8: addl */
+    var39.i = var38.i + var42.i;
+    /* 9: storel */
+    ptr0[i] = var39;
+  }
+
+}
+
+void
+video_scale_orc_resample_vert_s16_acc (gint32 * ORC_RESTRICT d1,
+    const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2, int p1,
+    int p2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 37, 118, 105, 100, 101, 111, 95, 115, 99, 97, 108, 101, 95, 111,
+        114, 99, 95, 114, 101, 115, 97, 109, 112, 108, 101, 95, 118, 101, 114,
+        116,
+        95, 115, 49, 54, 95, 97, 99, 99, 11, 4, 4, 12, 2, 2, 12, 2,
+        2, 16, 2, 16, 2, 20, 4, 20, 4, 176, 32, 4, 24, 176, 33, 5,
+        25, 103, 32, 32, 33, 103, 0, 0, 32, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_resample_vert_s16_acc);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_scale_orc_resample_vert_s16_acc");
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_resample_vert_s16_acc);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_parameter (p, 2, "p2");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_D1, ORC_VAR_D1, ORC_VAR_T1,
+          ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* video_scale_orc_resample_vert_s16_final */
+#ifdef DISABLE_ORC
+void
+video_scale_orc_resample_vert_s16_final (guint8 * ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2,
+    const gint16 * ORC_RESTRICT s3, int p1, int p2, int n)
+{
+  int i;
+  orc_int8 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union32 var39;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var40;
+#else
+  orc_union32 var40;
+#endif
+  orc_int8 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union16 var48;
+
+  ptr0 = (orc_int8 *) d1;
+  ptr4 = (orc_union32 *) s1;
+  ptr5 = (orc_union16 *) s2;
+  ptr6 = (orc_union16 *) s3;
+
+  /* 1: loadpw */
+  var36.i = p1;
+  /* 4: loadpw */
+  var38.i = p2;
+  /* 9: loadpl */
+  var40.i = (int) 0x00002000;   /* 8192 or 4.04739e-320f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr5[i];
+    /* 2: mulswl */
+    var42.i = var35.i * var36.i;
+    /* 3: loadw */
+    var37 = ptr6[i];
+    /* 5: mulswl */
+    var43.i = var37.i * var38.i;
+    /* 6: addl */
+    var44.i = var42.i + var43.i;
+    /* 7: loadl */
+    var39 = ptr4[i];
+    /* 8: addl */
+    var45.i = var44.i + var39.i;
+    /* 10: addl */
+    var46.i = var45.i + var40.i;
+    /* 11: shrsl */
+    var47.i = var46.i >> 14;
+    /* 12: convssslw */
+    var48.i = ORC_CLAMP_SW (var47.i);
+    /* 13: convsuswb */
+    var41 = ORC_CLAMP_UB (var48.i);
+    /* 14: storeb */
+    ptr0[i] = var41;
+  }
+
+}
+
+#else
+static void
+_backup_video_scale_orc_resample_vert_s16_final (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_int8 *ORC_RESTRICT ptr0;
+  const orc_union32 *ORC_RESTRICT ptr4;
+  const orc_union16 *ORC_RESTRICT ptr5;
+  const orc_union16 *ORC_RESTRICT ptr6;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union32 var39;
+#if defined(__APPLE__) && __GNUC__ == 4 && __GNUC_MINOR__ == 2 && defined (__i386__)
+  volatile orc_union32 var40;
+#else
+  orc_union32 var40;
+#endif
+  orc_int8 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union16 var48;
+
+  ptr0 = (orc_int8 *) ex->arrays[0];
+  ptr4 = (orc_union32 *) ex->arrays[4];
+  ptr5 = (orc_union16 *) ex->arrays[5];
+  ptr6 = (orc_union16 *) ex->arrays[6];
+
+  /* 1: loadpw */
+  var36.i = ex->params[24];
+  /* 4: loadpw */
+  var38.i = ex->params[25];
+  /* 9: loadpl */
+  var40.i = (int) 0x00002000;   /* 8192 or 4.04739e-320f */
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var35 = ptr5[i];
+    /* 2: mulswl */
+    var42.i = var35.i * var36.i;
+    /* 3: loadw */
+    var37 = ptr6[i];
+    /* 5: mulswl */
+    var43.i = var37.i * var38.i;
+    /* 6: addl */
+    var44.i = var42.i + var43.i;
+    /* 7: loadl */
+    var39 = ptr4[i];
+    /* 8: addl */
+    var45.i = var44.i + var39.i;
+    /* 10: addl */
+    var46.i = var45.i + var40.i;
+    /* 11: shrsl */
+    var47.i = var46.i >> 14;
+    /* 12: convssslw */
+    var48.i = ORC_CLAMP_SW (var47.i);
+    /* 13: convsuswb */
+    var41 = ORC_CLAMP_UB (var48.i);
+    /* 14: storeb */
+    ptr0[i] = var41;
+  }
+
+}
+
+void
+video_scale_orc_resample_vert_s16_final (guint8 * ORC_RESTRICT d1,
+    const gint32 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2,
+    const gint16 * ORC_RESTRICT s3, int p1, int p2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+#if 1
+      static const orc_uint8 bc[] = {
+        1, 9, 39, 118, 105, 100, 101, 111, 95, 115, 99, 97, 108, 101, 95, 111,
+        114, 99, 95, 114, 101, 115, 97, 109, 112, 108, 101, 95, 118, 101, 114,
+        116,
+        95, 115, 49, 54, 95, 102, 105, 110, 97, 108, 11, 1, 1, 12, 4, 4,
+        12, 2, 2, 12, 2, 2, 14, 4, 0, 32, 0, 0, 14, 4, 14, 0,
+        0, 0, 16, 2, 16, 2, 20, 4, 20, 4, 20, 2, 176, 32, 5, 24,
+        176, 33, 6, 25, 103, 32, 32, 33, 103, 32, 32, 4, 103, 32, 32, 16,
+        125, 32, 32, 17, 165, 34, 32, 160, 0, 34, 2, 0,
+      };
+      p = orc_program_new_from_static_bytecode (bc);
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_resample_vert_s16_final);
+#else
+      p = orc_program_new ();
+      orc_program_set_name (p, "video_scale_orc_resample_vert_s16_final");
+      orc_program_set_backup_function (p,
+          _backup_video_scale_orc_resample_vert_s16_final);
+      orc_program_add_destination (p, 1, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_constant (p, 4, 0x00002000, "c1");
+      orc_program_add_constant (p, 4, 0x0000000e, "c2");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_parameter (p, 2, "p2");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 2, "t3");
+
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "mulswl", 0, ORC_VAR_T2, ORC_VAR_S3, ORC_VAR_P2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_T2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_S1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C1,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C2,
+          ORC_VAR_D1);
+      orc_program_append_2 (p, "convssslw", 0, ORC_VAR_T3, ORC_VAR_T1,
+          ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convsuswb", 0, ORC_VAR_D1, ORC_VAR_T3,
+          ORC_VAR_D1, ORC_VAR_D1);
+#endif
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *) s1;
+  ex->arrays[ORC_VAR_S2] = (void *) s2;
+  ex->arrays[ORC_VAR_S3] = (void *) s3;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
 
   func = c->exec;
   func (ex);
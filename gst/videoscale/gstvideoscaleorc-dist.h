@@ -94,7 +94,13 @@ void video_scale_orc_resample_bilinear_u8 (guint8 * ORC_RESTRICT d1, const guint
 void video_scale_orc_resample_nearest_u32 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int p1, int p2, int n);
 void video_scale_orc_resample_bilinear_u32 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int p1, int p2, int n);
 void video_scale_orc_resample_merge_bilinear_u32 (guint8 * ORC_RESTRICT d1, guint8 * ORC_RESTRICT d2, const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2, int p1, int p2, int p3, int n);
+void video_scale_orc_widen_u16 (guint32 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n);
+void video_scale_orc_resample_nearest_widened_u16 (guint16 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, int p1, int p2, int n);
+void video_scale_orc_resample_bilinear_widened_u16 (guint16 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, int p1, int p2, int n);
 void video_scale_orc_merge_bicubic_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2, const guint8 * ORC_RESTRICT s3, const guint8 * ORC_RESTRICT s4, int p1, int p2, int p3, int p4, int n);
+void video_scale_orc_resample_vert_s16_init (gint32 * ORC_RESTRICT d1, const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2, int p1, int p2, int n);
+void video_scale_orc_resample_vert_s16_acc (gint32 * ORC_RESTRICT d1, const gint16 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2, int p1, int p2, int n);
+void video_scale_orc_resample_vert_s16_final (guint8 * ORC_RESTRICT d1, const gint32 * ORC_RESTRICT s1, const gint16 * ORC_RESTRICT s2, const gint16 * ORC_RESTRICT s3, int p1, int p2, int n);
 
 #ifdef __cplusplus
 }
@@ -46,11 +46,6 @@ static void vs_scanline_resample_4tap_Y (uint8_t * dest, uint8_t * src,
 static void vs_scanline_merge_4tap_Y (uint8_t * dest, uint8_t * src1,
     uint8_t * src2, uint8_t * src3, uint8_t * src4, int n, int acc);
 
-static void vs_scanline_resample_4tap_RGBA (uint8_t * dest, uint8_t * src,
-    int n, int src_width, int *xacc, int increment);
-static void vs_scanline_merge_4tap_RGBA (uint8_t * dest, uint8_t * src1,
-    uint8_t * src2, uint8_t * src3, uint8_t * src4, int n, int acc);
-
 static void vs_scanline_resample_4tap_RGB (uint8_t * dest, uint8_t * src,
     int n, int src_width, int *xacc, int increment);
 static void vs_scanline_merge_4tap_RGB (uint8_t * dest, uint8_t * src1,
@@ -81,10 +76,18 @@ static void vs_scanline_resample_4tap_Y16 (uint8_t * dest, uint8_t * src,
 static void vs_scanline_merge_4tap_Y16 (uint8_t * dest, uint8_t * src1,
     uint8_t * src2, uint8_t * src3, uint8_t * src4, int n, int acc);
 
-static void vs_scanline_resample_4tap_AYUV64 (uint16_t * dest, uint16_t * src,
-    int n, int src_width, int *xacc, int increment);
-static void vs_scanline_merge_4tap_AYUV64 (uint16_t * dest, uint16_t * src1,
-    uint16_t * src2, uint16_t * src3, uint16_t * src4, int n, int acc);
+
+/* returns the source line in slot @i of the 4 line ring when @k is the
+ * first line of the ring */
+static inline int
+vs_4tap_ring_line (int i, int k, int height)
+{
+  int l = MIN (k + 3, height - 1);
+
+  l -= (l - i) & 3;
+
+  return l < 0 ? MIN (i, height - 1) : l;
+}
 
 static double
 vs_4tap_func (double x)
@@ -190,7 +193,7 @@ vs_scanline_merge_4tap_Y (uint8_t * dest, uint8_t * src1, uint8_t * src2,
 
 void
 vs_image_scale_4tap_Y (const VSImage * dest, const VSImage * src,
-    uint8_t * tmpbuf)
+    uint8_t * tmpbuf, int y_start, int y_end)
 {
   int yacc;
   int y_increment;
@@ -210,16 +213,16 @@ vs_image_scale_4tap_Y (const VSImage * dest, const VSImage * src,
   else
     x_increment = ((src->width - 1) << 16) / (dest->width - 1);
 
-  k = 0;
+  k = (y_start * y_increment) >> 16;
   for (i = 0; i < 4; i++) {
     xacc = 0;
     vs_scanline_resample_4tap_Y (tmpbuf + i * dest->width,
-        src->pixels + CLAMP (i, 0, src->height - 1) * src->stride, dest->width,
-        src->width, &xacc, x_increment);
+        src->pixels + vs_4tap_ring_line (i, k, src->height) * src->stride,
+        dest->width, src->width, &xacc, x_increment);
   }
 
-  yacc = 0;
-  for (i = 0; i < dest->height; i++) {
+  yacc = y_start * y_increment;
+  for (i = y_start; i < y_end; i++) {
     uint8_t *t0, *t1, *t2, *t3;
 
     j = yacc >> 16;
@@ -307,7 +310,7 @@ vs_scanline_merge_4tap_Y16 (uint8_t * dest, uint8_t * src1, uint8_t * src2,
 
 void
 vs_image_scale_4tap_Y16 (const VSImage * dest, const VSImage * src,
-    uint8_t * tmpbuf)
+    uint8_t * tmpbuf, int y_start, int y_end)
 {
   int yacc;
   int y_increment;
@@ -327,16 +330,16 @@ vs_image_scale_4tap_Y16 (const VSImage * dest, const VSImage * src,
   else
     x_increment = ((src->width - 1) << 16) / (dest->width - 1);
 
-  k = 0;
+  k = (y_start * y_increment) >> 16;
   for (i = 0; i < 4; i++) {
     xacc = 0;
     vs_scanline_resample_4tap_Y16 (tmpbuf + i * dest->stride,
-        src->pixels + CLAMP (i, 0, src->height - 1) * src->stride, dest->width,
-        src->width, &xacc, x_increment);
+        src->pixels + vs_4tap_ring_line (i, k, src->height) * src->stride,
+        dest->width, src->width, &xacc, x_increment);
   }
 
-  yacc = 0;
-  for (i = 0; i < dest->height; i++) {
+  yacc = y_start * y_increment;
+  for (i = y_start; i < y_end; i++) {
     uint8_t *t0, *t1, *t2, *t3;
 
     j = yacc >> 16;
@@ -430,7 +433,7 @@ vs_scanline_merge_4tap_RGBA (uint8_t * dest, uint8_t * src1, uint8_t * src2,
 
 void
 vs_image_scale_4tap_RGBA (const VSImage * dest, const VSImage * src,
-    uint8_t * tmpbuf)
+    uint8_t * tmpbuf, int y_start, int y_end)
 {
   int yacc;
   int y_increment;
@@ -450,16 +453,16 @@ vs_image_scale_4tap_RGBA (const VSImage * dest, const VSImage * src,
   else
     x_increment = ((src->width - 1) << 16) / (dest->width - 1);
 
-  k = 0;
+  k = (y_start * y_increment) >> 16;
   for (i = 0; i < 4; i++) {
     xacc = 0;
     vs_scanline_resample_4tap_RGBA (tmpbuf + i * dest->stride,
-        src->pixels + CLAMP (i, 0, src->height) * src->stride,
+        src->pixels + vs_4tap_ring_line (i, k, src->height) * src->stride,
         dest->width, src->width, &xacc, x_increment);
   }
 
-  yacc = 0;
-  for (i = 0; i < dest->height; i++) {
+  yacc = y_start * y_increment;
+  for (i = y_start; i < y_end; i++) {
     uint8_t *t0, *t1, *t2, *t3;
 
     j = yacc >> 16;
@@ -553,7 +556,7 @@ vs_scanline_merge_4tap_RGB (uint8_t * dest, uint8_t * src1, uint8_t * src2,
 
 void
 vs_image_scale_4tap_RGB (const VSImage * dest, const VSImage * src,
-    uint8_t * tmpbuf)
+    uint8_t * tmpbuf, int y_start, int y_end)
 {
   int yacc;
   int y_increment;
@@ -573,16 +576,16 @@ vs_image_scale_4tap_RGB (const VSImage * dest, const VSImage * src,
   else
     x_increment = ((src->width - 1) << 16) / (dest->width - 1);
 
-  k = 0;
+  k = (y_start * y_increment) >> 16;
   for (i = 0; i < 4; i++) {
     xacc = 0;
     vs_scanline_resample_4tap_RGB (tmpbuf + i * dest->stride,
-        src->pixels + CLAMP (i, 0, src->height - 1) * src->stride, dest->width,
-        src->width, &xacc, x_increment);
+        src->pixels + vs_4tap_ring_line (i, k, src->height) * src->stride,
+        dest->width, src->width, &xacc, x_increment);
   }
 
-  yacc = 0;
-  for (i = 0; i < dest->height; i++) {
+  yacc = y_start * y_increment;
+  for (i = y_start; i < y_end; i++) {
     uint8_t *t0, *t1, *t2, *t3;
 
     j = yacc >> 16;
@@ -751,7 +754,7 @@ vs_scanline_merge_4tap_YUYV (uint8_t * dest, uint8_t * src1, uint8_t * src2,
 
 void
 vs_image_scale_4tap_YUYV (const VSImage * dest, const VSImage * src,
-    uint8_t * tmpbuf)
+    uint8_t * tmpbuf, int y_start, int y_end)
 {
   int yacc;
   int y_increment;
@@ -771,16 +774,16 @@ vs_image_scale_4tap_YUYV (const VSImage * dest, const VSImage * src,
   else
     x_increment = ((src->width - 1) << 16) / (dest->width - 1);
 
-  k = 0;
+  k = (y_start * y_increment) >> 16;
   for (i = 0; i < 4; i++) {
     xacc = 0;
     vs_scanline_resample_4tap_YUYV (tmpbuf + i * dest->stride,
-        src->pixels + CLAMP (i, 0, src->height - 1) * src->stride, dest->width,
-        src->width, &xacc, x_increment);
+        src->pixels + vs_4tap_ring_line (i, k, src->height) * src->stride,
+        dest->width, src->width, &xacc, x_increment);
   }
 
-  yacc = 0;
-  for (i = 0; i < dest->height; i++) {
+  yacc = y_start * y_increment;
+  for (i = y_start; i < y_end; i++) {
     uint8_t *t0, *t1, *t2, *t3;
 
     j = yacc >> 16;
@@ -949,7 +952,7 @@ vs_scanline_merge_4tap_UYVY (uint8_t * dest, uint8_t * src1, uint8_t * src2,
 
 void
 vs_image_scale_4tap_UYVY (const VSImage * dest, const VSImage * src,
-    uint8_t * tmpbuf)
+    uint8_t * tmpbuf, int y_start, int y_end)
 {
   int yacc;
   int y_increment;
@@ -969,16 +972,16 @@ vs_image_scale_4tap_UYVY (const VSImage * dest, const VSImage * src,
   else
     x_increment = ((src->width - 1) << 16) / (dest->width - 1);
 
-  k = 0;
+  k = (y_start * y_increment) >> 16;
   for (i = 0; i < 4; i++) {
     xacc = 0;
     vs_scanline_resample_4tap_UYVY (tmpbuf + i * dest->stride,
-        src->pixels + CLAMP (i, 0, src->height - 1) * src->stride, dest->width,
-        src->width, &xacc, x_increment);
+        src->pixels + vs_4tap_ring_line (i, k, src->height) * src->stride,
+        dest->width, src->width, &xacc, x_increment);
   }
 
-  yacc = 0;
-  for (i = 0; i < dest->height; i++) {
+  yacc = y_start * y_increment;
+  for (i = y_start; i < y_end; i++) {
     uint8_t *t0, *t1, *t2, *t3;
 
     j = yacc >> 16;
@@ -1134,7 +1137,7 @@ vs_scanline_merge_4tap_RGB565 (uint8_t * dest_u8, uint8_t * src1_u8,
 
 void
 vs_image_scale_4tap_RGB565 (const VSImage * dest, const VSImage * src,
-    uint8_t * tmpbuf)
+    uint8_t * tmpbuf, int y_start, int y_end)
 {
   int yacc;
   int y_increment;
@@ -1154,16 +1157,16 @@ vs_image_scale_4tap_RGB565 (const VSImage * dest, const VSImage * src,
   else
     x_increment = ((src->width - 1) << 16) / (dest->width - 1);
 
-  k = 0;
+  k = (y_start * y_increment) >> 16;
   for (i = 0; i < 4; i++) {
     xacc = 0;
     vs_scanline_resample_4tap_RGB565 (tmpbuf + i * dest->stride,
-        src->pixels + CLAMP (i, 0, src->height - 1) * src->stride, dest->width,
-        src->width, &xacc, x_increment);
+        src->pixels + vs_4tap_ring_line (i, k, src->height) * src->stride,
+        dest->width, src->width, &xacc, x_increment);
   }
 
-  yacc = 0;
-  for (i = 0; i < dest->height; i++) {
+  yacc = y_start * y_increment;
+  for (i = y_start; i < y_end; i++) {
     uint8_t *t0, *t1, *t2, *t3;
 
     j = yacc >> 16;
@@ -1319,7 +1322,7 @@ vs_scanline_merge_4tap_RGB555 (uint8_t * dest_u8, uint8_t * src1_u8,
 
 void
 vs_image_scale_4tap_RGB555 (const VSImage * dest, const VSImage * src,
-    uint8_t * tmpbuf)
+    uint8_t * tmpbuf, int y_start, int y_end)
 {
   int yacc;
   int y_increment;
@@ -1339,16 +1342,16 @@ vs_image_scale_4tap_RGB555 (const VSImage * dest, const VSImage * src,
   else
     x_increment = ((src->width - 1) << 16) / (dest->width - 1);
 
-  k = 0;
+  k = (y_start * y_increment) >> 16;
   for (i = 0; i < 4; i++) {
     xacc = 0;
     vs_scanline_resample_4tap_RGB555 (tmpbuf + i * dest->stride,
-        src->pixels + CLAMP (i, 0, src->height - 1) * src->stride, dest->width,
-        src->width, &xacc, x_increment);
+        src->pixels + vs_4tap_ring_line (i, k, src->height) * src->stride,
+        dest->width, src->width, &xacc, x_increment);
   }
 
-  yacc = 0;
-  for (i = 0; i < dest->height; i++) {
+  yacc = y_start * y_increment;
+  for (i = y_start; i < y_end; i++) {
     uint8_t *t0, *t1, *t2, *t3;
 
     j = yacc >> 16;
@@ -1407,7 +1410,7 @@ vs_scanline_resample_4tap_AYUV64 (uint16_t * dest, uint16_t * src,
                 4 * (src_width - 1) + off)];
       }
       y += (1 << (SHIFT - 1));
-      dest[i * 4 + off] = CLAMP (y >> SHIFT, 0, 255);
+      dest[i * 4 + off] = CLAMP (y >> SHIFT, 0, 65535);
     }
     acc += increment;
   }
@@ -1442,7 +1445,7 @@ vs_scanline_merge_4tap_AYUV64 (uint16_t * dest, uint16_t * src1,
 
 void
 vs_image_scale_4tap_AYUV64 (const VSImage * dest, const VSImage * src,
-    uint8_t * tmpbuf8)
+    uint8_t * tmpbuf8, int y_start, int y_end)
 {
   int yacc;
   int y_increment;
@@ -1465,16 +1468,17 @@ vs_image_scale_4tap_AYUV64 (const VSImage * dest, const VSImage * src,
   else
     x_increment = ((src->width - 1) << 16) / (dest->width - 1);
 
-  k = 0;
+  k = (y_start * y_increment) >> 16;
   for (i = 0; i < 4; i++) {
     xacc = 0;
     vs_scanline_resample_4tap_AYUV64 (tmpbuf + i * dest_pixstride,
-        (guint16 *) (src->pixels + CLAMP (i, 0, src->height - 1) * src->stride),
+        (guint16 *) (src->pixels +
+            vs_4tap_ring_line (i, k, src->height) * src->stride),
         dest->width, src->width, &xacc, x_increment);
   }
 
-  yacc = 0;
-  for (i = 0; i < dest->height; i++) {
+  yacc = y_start * y_increment;
+  for (i = y_start; i < y_end; i++) {
     uint16_t *t0, *t1, *t2, *t3;
 
     j = yacc >> 16;
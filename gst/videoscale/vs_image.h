@@ -60,7 +60,9 @@ G_GNUC_INTERNAL void vs_image_scale_lanczos_AYUV   (const VSImage * dest,
                                                     gboolean        dither,
                                                     int             submethod,
                                                     double          a,
-                                                    double          sharpen);
+                                                    double          sharpen,
+                                                    int             y_start,
+                                                    int             y_end);
 
 G_GNUC_INTERNAL void vs_image_scale_lanczos_AYUV64 (const VSImage * dest,
                                                     const VSImage * src,
@@ -69,7 +71,9 @@ G_GNUC_INTERNAL void vs_image_scale_lanczos_AYUV64 (const VSImage * dest,
                                                     gboolean        dither,
                                                     int             submethod,
                                                     double          a,
-                                                    double          sharpen);
+                                                    double          sharpen,
+                                                    int             y_start,
+                                                    int             y_end);
 
 
 G_GNUC_INTERNAL void vs_image_scale_nearest_RGB    (const VSImage * dest,
@@ -123,7 +127,9 @@ G_GNUC_INTERNAL void vs_image_scale_lanczos_Y      (const VSImage * dest,
                                                     gboolean        dither,
                                                     int             submethod,
                                                     double          a,
-                                                    double          sharpen);
+                                                    double          sharpen,
+                                                    int             y_start,
+                                                    int             y_end);
 
 
 G_GNUC_INTERNAL void vs_image_scale_nearest_RGB565 (const VSImage * dest,
@@ -170,5 +176,29 @@ G_GNUC_INTERNAL void vs_image_scale_linear_AYUV64  (const VSImage * dest,
                                                     const VSImage * src,
                                                     uint8_t       * tmpbuf8);
 
+typedef struct _VSLanczos VSLanczos;
+
+typedef const uint8_t * (*VSLanczosGetLineFunc) (int line, void *user_data);
+
+G_GNUC_INTERNAL VSLanczos * vs_lanczos_new        (int                  src_width,
+                                                   int                  src_height,
+                                                   int                  dest_width,
+                                                   int                  dest_height,
+                                                   gboolean             bits16,
+                                                   double               sharpness,
+                                                   gboolean             dither,
+                                                   double               a,
+                                                   double               sharpen);
+
+G_GNUC_INTERNAL void        vs_lanczos_free       (VSLanczos          * lanczos);
+
+G_GNUC_INTERNAL void        vs_lanczos_reset      (VSLanczos          * lanczos);
+
+G_GNUC_INTERNAL void        vs_lanczos_scale_line (VSLanczos          * lanczos,
+                                                   uint8_t            * dest,
+                                                   int                  j,
+                                                   VSLanczosGetLineFunc get_line,
+                                                   void               * user_data);
+
 #endif
 
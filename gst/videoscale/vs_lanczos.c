@@ -149,6 +149,16 @@
 typedef void (*HorizResampleFunc) (void *dest, const gint32 * offsets,
     const void *taps, const void *src, int n_taps, int shift, int n);
 
+typedef enum
+{
+  SCALE1D_TAPS_DOUBLE,
+  SCALE1D_TAPS_FLOAT,
+  SCALE1D_TAPS_INT32,
+  SCALE1D_TAPS_INT16
+} Scale1DTapsType;
+
+typedef struct _Scale1DCacheEntry Scale1DCacheEntry;
+
 typedef struct _Scale1D Scale1D;
 struct _Scale1D
 {
@@ -163,8 +173,37 @@ struct _Scale1D
   int n_taps;
   gint32 *offsets;
   void *taps;
+
+  /* the cache entry owning offsets and taps */
+  Scale1DCacheEntry *entry;
 };
 
+/* Filter banks only depend on the sizes and the filter parameters, they
+ * are kept in a process-wide cache so that they are not recalculated for
+ * each frame.  Entries are immutable once created and refcounted, so that
+ * they can be shared between threads and evicted while in use. */
+struct _Scale1DCacheEntry
+{
+  gint refcount;
+
+  Scale1DTapsType type;
+  int src_size;
+  int dest_size;
+  int n_taps;
+  double a;
+  double sharpness;
+  double sharpen;
+  int shift;
+
+  Scale1D scale1d;
+};
+
+#define MAX_CACHED_SCALE1D 32
+
+static GMutex scale1d_cache_lock;
+static GList *scale1d_cache;
+static guint scale1d_cache_len;
+
 typedef struct _Scale Scale;
 struct _Scale
 {
@@ -175,42 +214,48 @@ struct _Scale
   gboolean dither;
 
   void *tmpdata;
+  /* one line of vertical filter sums for the orc path */
+  gint32 *accdata;
 
   HorizResampleFunc horiz_resample_func;
 
   Scale1D x_scale1d;
   Scale1D y_scale1d;
+
+  /* the range of destination lines to scale */
+  int y_start;
+  int y_end;
 };
 
 static void
 vs_image_scale_lanczos_Y_int16 (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, double a,
-    double sharpen);
+    double sharpen, int y_start, int y_end);
 static void vs_image_scale_lanczos_Y_int32 (const VSImage * dest,
     const VSImage * src, uint8_t * tmpbuf, double sharpness, gboolean dither,
-    double a, double sharpen);
+    double a, double sharpen, int y_start, int y_end);
 static void vs_image_scale_lanczos_Y_float (const VSImage * dest,
     const VSImage * src, uint8_t * tmpbuf, double sharpness, gboolean dither,
-    double a, double sharpen);
+    double a, double sharpen, int y_start, int y_end);
 static void vs_image_scale_lanczos_Y_double (const VSImage * dest,
     const VSImage * src, uint8_t * tmpbuf, double sharpness, gboolean dither,
-    double a, double sharpen);
+    double a, double sharpen, int y_start, int y_end);
 static void
 vs_image_scale_lanczos_AYUV_int16 (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, double a,
-    double sharpen);
+    double sharpen, int y_start, int y_end);
 static void vs_image_scale_lanczos_AYUV_int32 (const VSImage * dest,
     const VSImage * src, uint8_t * tmpbuf, double sharpness, gboolean dither,
-    double a, double sharpen);
+    double a, double sharpen, int y_start, int y_end);
 static void vs_image_scale_lanczos_AYUV_float (const VSImage * dest,
     const VSImage * src, uint8_t * tmpbuf, double sharpness, gboolean dither,
-    double a, double sharpen);
+    double a, double sharpen, int y_start, int y_end);
 static void vs_image_scale_lanczos_AYUV_double (const VSImage * dest,
     const VSImage * src, uint8_t * tmpbuf, double sharpness, gboolean dither,
-    double a, double sharpen);
+    double a, double sharpen, int y_start, int y_end);
 static void vs_image_scale_lanczos_AYUV64_double (const VSImage * dest,
     const VSImage * src, uint8_t * tmpbuf, double sharpness, gboolean dither,
-    double a, double sharpen);
+    double a, double sharpen, int y_start, int y_end);
 
 static double
 sinc (double x)
@@ -246,11 +291,24 @@ scale1d_get_n_taps (int src_size, int dest_size, double a, double sharpness)
   return 2 * dx;
 }
 
+static void
+scale1d_cache_entry_unref (Scale1DCacheEntry * entry)
+{
+  if (g_atomic_int_dec_and_test (&entry->refcount)) {
+    g_free (entry->scale1d.taps);
+    g_free (entry->scale1d.offsets);
+    g_slice_free (Scale1DCacheEntry, entry);
+  }
+}
+
 static void
 scale1d_cleanup (Scale1D * scale)
 {
-  g_free (scale->taps);
-  g_free (scale->offsets);
+  if (scale->entry)
+    scale1d_cache_entry_unref (scale->entry);
+  scale->entry = NULL;
+  scale->taps = NULL;
+  scale->offsets = NULL;
 }
 
 /*
@@ -415,7 +473,6 @@ scale1d_calculate_taps_int32 (Scale1D * scale, int src_size, int dest_size,
   g_free (taps_d);
   scale->taps = taps_i;
 }
-
 /*
  * Calculates a set of taps for each destination element in gint16
  * format.  Each set of taps sums to (1<<shift).  A typical value
@@ -544,29 +601,111 @@ scale1d_calculate_taps_int16 (Scale1D * scale, int src_size, int dest_size,
   scale->taps = taps_i;
 }
 
+/*
+ * Looks up or calculates a set of taps of the given type.  The taps
+ * and offsets are shared and must not be modified, release them with
+ * scale1d_cleanup().
+ */
+static void
+scale1d_get_taps (Scale1D * scale, Scale1DTapsType type, int src_size,
+    int dest_size, int n_taps, double a, double sharpness, double sharpen,
+    int shift)
+{
+  Scale1DCacheEntry *entry = NULL;
+  GList *l;
+
+  g_mutex_lock (&scale1d_cache_lock);
+  for (l = scale1d_cache; l; l = l->next) {
+    Scale1DCacheEntry *e = l->data;
+
+    if (e->type == type && e->src_size == src_size &&
+        e->dest_size == dest_size && e->n_taps == n_taps && e->a == a &&
+        e->sharpness == sharpness && e->sharpen == sharpen &&
+        e->shift == shift) {
+      /* move to the front so that the least recently used is evicted */
+      scale1d_cache = g_list_remove_link (scale1d_cache, l);
+      scale1d_cache = g_list_concat (l, scale1d_cache);
+      entry = e;
+      break;
+    }
+  }
+  if (entry)
+    g_atomic_int_inc (&entry->refcount);
+  g_mutex_unlock (&scale1d_cache_lock);
+
+  if (entry == NULL) {
+    entry = g_slice_new0 (Scale1DCacheEntry);
+    entry->refcount = 2;
+    entry->type = type;
+    entry->src_size = src_size;
+    entry->dest_size = dest_size;
+    entry->n_taps = n_taps;
+    entry->a = a;
+    entry->sharpness = sharpness;
+    entry->sharpen = sharpen;
+    entry->shift = shift;
+
+    switch (type) {
+      case SCALE1D_TAPS_DOUBLE:
+        scale1d_calculate_taps (&entry->scale1d, src_size, dest_size, n_taps,
+            a, sharpness, sharpen);
+        break;
+      case SCALE1D_TAPS_FLOAT:
+        scale1d_calculate_taps_float (&entry->scale1d, src_size, dest_size,
+            n_taps, a, sharpness, sharpen);
+        break;
+      case SCALE1D_TAPS_INT32:
+        scale1d_calculate_taps_int32 (&entry->scale1d, src_size, dest_size,
+            n_taps, a, sharpness, sharpen, shift);
+        break;
+      case SCALE1D_TAPS_INT16:
+        scale1d_calculate_taps_int16 (&entry->scale1d, src_size, dest_size,
+            n_taps, a, sharpness, sharpen, shift);
+        break;
+    }
+
+    /* another thread might have added the same taps in the meantime, this
+     * only costs a duplicate entry that will eventually be evicted */
+    g_mutex_lock (&scale1d_cache_lock);
+    scale1d_cache = g_list_prepend (scale1d_cache, entry);
+    if (++scale1d_cache_len > MAX_CACHED_SCALE1D) {
+      l = g_list_last (scale1d_cache);
+      scale1d_cache_entry_unref (l->data);
+      scale1d_cache = g_list_delete_link (scale1d_cache, l);
+      scale1d_cache_len--;
+    }
+    g_mutex_unlock (&scale1d_cache_lock);
+  }
+
+  *scale = entry->scale1d;
+  scale->entry = entry;
+}
 
 void
 vs_image_scale_lanczos_Y (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, int submethod,
-    double a, double sharpen)
+    double a, double sharpen, int y_start, int y_end)
 {
+  if (y_start >= y_end)
+    return;
+
   switch (submethod) {
     case 0:
     default:
       vs_image_scale_lanczos_Y_int16 (dest, src, tmpbuf, sharpness, dither, a,
-          sharpen);
+          sharpen, y_start, y_end);
       break;
     case 1:
       vs_image_scale_lanczos_Y_int32 (dest, src, tmpbuf, sharpness, dither, a,
-          sharpen);
+          sharpen, y_start, y_end);
       break;
     case 2:
       vs_image_scale_lanczos_Y_float (dest, src, tmpbuf, sharpness, dither, a,
-          sharpen);
+          sharpen, y_start, y_end);
       break;
     case 3:
       vs_image_scale_lanczos_Y_double (dest, src, tmpbuf, sharpness, dither, a,
-          sharpen);
+          sharpen, y_start, y_end);
       break;
   }
 }
@@ -574,25 +713,28 @@ vs_image_scale_lanczos_Y (const VSImage * dest, const VSImage * src,
 void
 vs_image_scale_lanczos_AYUV (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, int submethod,
-    double a, double sharpen)
+    double a, double sharpen, int y_start, int y_end)
 {
+  if (y_start >= y_end)
+    return;
+
   switch (submethod) {
     case 0:
     default:
       vs_image_scale_lanczos_AYUV_int16 (dest, src, tmpbuf, sharpness, dither,
-          a, sharpen);
+          a, sharpen, y_start, y_end);
       break;
     case 1:
       vs_image_scale_lanczos_AYUV_int32 (dest, src, tmpbuf, sharpness, dither,
-          a, sharpen);
+          a, sharpen, y_start, y_end);
       break;
     case 2:
       vs_image_scale_lanczos_AYUV_float (dest, src, tmpbuf, sharpness, dither,
-          a, sharpen);
+          a, sharpen, y_start, y_end);
       break;
     case 3:
       vs_image_scale_lanczos_AYUV_double (dest, src, tmpbuf, sharpness, dither,
-          a, sharpen);
+          a, sharpen, y_start, y_end);
       break;
   }
 }
@@ -600,10 +742,13 @@ vs_image_scale_lanczos_AYUV (const VSImage * dest, const VSImage * src,
 void
 vs_image_scale_lanczos_AYUV64 (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, int submethod,
-    double a, double sharpen)
+    double a, double sharpen, int y_start, int y_end)
 {
+  if (y_start >= y_end)
+    return;
+
   vs_image_scale_lanczos_AYUV64_double (dest, src, tmpbuf, sharpness, dither,
-      a, sharpen);
+      a, sharpen, y_start, y_end);
 }
 
 
@@ -894,6 +1039,36 @@ RESAMPLE_VERT_FLOAT_DITHER (resample_vert_dither_float_generic, guint8, 255, flo
 #define S16_MIDSHIFT 0
 #define S16_POSTSHIFT (S16_SHIFT1+S16_SHIFT2-S16_MIDSHIFT)
 
+/* The int16 pathway is the default one for 8 bits formats, so its
+ * vertical filter runs with orc, two taps at a time.  The kernels round
+ * and shift by S16_POSTSHIFT, they are used for even numbers of taps
+ * only, which is all the vertical filter ever uses. */
+static void
+resample_vert_int16_orc (guint8 * dest, const gint16 * taps,
+    const gint16 * src, int stride, int n_taps, gint32 * acc, int n)
+{
+  int l;
+
+  G_STATIC_ASSERT (S16_POSTSHIFT == 14);
+
+  if (n_taps < 4 || (n_taps & 1)) {
+    resample_vert_int16_generic (dest, taps, src, stride, n_taps,
+        S16_POSTSHIFT, n);
+    return;
+  }
+
+  video_scale_orc_resample_vert_s16_init (acc, src,
+      PTR_OFFSET (src, stride), taps[0], taps[1], n);
+  for (l = 2; l < n_taps - 2; l += 2) {
+    video_scale_orc_resample_vert_s16_acc (acc,
+        PTR_OFFSET (src, stride * l), PTR_OFFSET (src, stride * (l + 1)),
+        taps[l], taps[l + 1], n);
+  }
+  video_scale_orc_resample_vert_s16_final (dest, acc,
+      PTR_OFFSET (src, stride * l), PTR_OFFSET (src, stride * (l + 1)),
+      taps[l], taps[l + 1], n);
+}
+
 static void
 vs_scale_lanczos_Y_int16 (Scale * scale)
 {
@@ -901,9 +1076,9 @@ vs_scale_lanczos_Y_int16 (Scale * scale)
   int yi;
   int tmp_yi;
 
-  tmp_yi = 0;
+  tmp_yi = scale->y_scale1d.offsets[scale->y_start];
 
-  for (j = 0; j < scale->dest->height; j++) {
+  for (j = scale->y_start; j < scale->y_end; j++) {
     guint8 *destline;
     gint16 *taps;
 
@@ -925,10 +1100,10 @@ vs_scale_lanczos_Y_int16 (Scale * scale)
           sizeof (gint16) * scale->dest->width, scale->y_scale1d.n_taps,
           S16_POSTSHIFT, scale->dest->width);
     } else {
-      resample_vert_int16_generic (destline,
+      resample_vert_int16_orc (destline,
           taps, TMP_LINE_S16 (scale->y_scale1d.offsets[j]),
           sizeof (gint16) * scale->dest->width, scale->y_scale1d.n_taps,
-          S16_POSTSHIFT, scale->dest->width);
+          scale->accdata, scale->dest->width);
     }
   }
 }
@@ -936,7 +1111,7 @@ vs_scale_lanczos_Y_int16 (Scale * scale)
 void
 vs_image_scale_lanczos_Y_int16 (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, double a,
-    double sharpen)
+    double sharpen, int y_start, int y_end)
 {
   Scale s = { 0 };
   Scale *scale = &s;
@@ -944,14 +1119,16 @@ vs_image_scale_lanczos_Y_int16 (const VSImage * dest, const VSImage * src,
 
   scale->dest = dest;
   scale->src = src;
+  scale->y_start = y_start;
+  scale->y_end = y_end;
 
   n_taps = scale1d_get_n_taps (src->width, dest->width, a, sharpness);
   n_taps = ROUND_UP_4 (n_taps);
-  scale1d_calculate_taps_int16 (&scale->x_scale1d,
+  scale1d_get_taps (&scale->x_scale1d, SCALE1D_TAPS_INT16,
       src->width, dest->width, n_taps, a, sharpness, sharpen, S16_SHIFT1);
 
   n_taps = scale1d_get_n_taps (src->height, dest->height, a, sharpness);
-  scale1d_calculate_taps_int16 (&scale->y_scale1d,
+  scale1d_get_taps (&scale->y_scale1d, SCALE1D_TAPS_INT16,
       src->height, dest->height, n_taps, a, sharpness, sharpen, S16_SHIFT2);
 
   scale->dither = dither;
@@ -981,12 +1158,14 @@ vs_image_scale_lanczos_Y_int16 (const VSImage * dest, const VSImage * src,
 
   scale->tmpdata =
       g_malloc (sizeof (gint16) * scale->dest->width * scale->src->height);
+  scale->accdata = g_malloc (sizeof (gint32) * scale->dest->width);
 
   vs_scale_lanczos_Y_int16 (scale);
 
   scale1d_cleanup (&scale->x_scale1d);
   scale1d_cleanup (&scale->y_scale1d);
   g_free (scale->tmpdata);
+  g_free (scale->accdata);
 }
 
 
@@ -1002,9 +1181,9 @@ vs_scale_lanczos_Y_int32 (Scale * scale)
   int yi;
   int tmp_yi;
 
-  tmp_yi = 0;
+  tmp_yi = scale->y_scale1d.offsets[scale->y_start];
 
-  for (j = 0; j < scale->dest->height; j++) {
+  for (j = scale->y_start; j < scale->y_end; j++) {
     guint8 *destline;
     gint32 *taps;
 
@@ -1037,7 +1216,7 @@ vs_scale_lanczos_Y_int32 (Scale * scale)
 void
 vs_image_scale_lanczos_Y_int32 (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, double a,
-    double sharpen)
+    double sharpen, int y_start, int y_end)
 {
   Scale s = { 0 };
   Scale *scale = &s;
@@ -1045,14 +1224,16 @@ vs_image_scale_lanczos_Y_int32 (const VSImage * dest, const VSImage * src,
 
   scale->dest = dest;
   scale->src = src;
+  scale->y_start = y_start;
+  scale->y_end = y_end;
 
   n_taps = scale1d_get_n_taps (src->width, dest->width, a, sharpness);
   n_taps = ROUND_UP_4 (n_taps);
-  scale1d_calculate_taps_int32 (&scale->x_scale1d,
+  scale1d_get_taps (&scale->x_scale1d, SCALE1D_TAPS_INT32,
       src->width, dest->width, n_taps, a, sharpness, sharpen, S32_SHIFT1);
 
   n_taps = scale1d_get_n_taps (src->height, dest->height, a, sharpness);
-  scale1d_calculate_taps_int32 (&scale->y_scale1d,
+  scale1d_get_taps (&scale->y_scale1d, SCALE1D_TAPS_INT32,
       src->height, dest->height, n_taps, a, sharpness, sharpen, S32_SHIFT2);
 
   scale->dither = dither;
@@ -1097,9 +1278,9 @@ vs_scale_lanczos_Y_double (Scale * scale)
   int yi;
   int tmp_yi;
 
-  tmp_yi = 0;
+  tmp_yi = scale->y_scale1d.offsets[scale->y_start];
 
-  for (j = 0; j < scale->dest->height; j++) {
+  for (j = scale->y_start; j < scale->y_end; j++) {
     guint8 *destline;
     double *taps;
 
@@ -1132,7 +1313,7 @@ vs_scale_lanczos_Y_double (Scale * scale)
 void
 vs_image_scale_lanczos_Y_double (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, double a,
-    double sharpen)
+    double sharpen, int y_start, int y_end)
 {
   Scale s = { 0 };
   Scale *scale = &s;
@@ -1140,14 +1321,16 @@ vs_image_scale_lanczos_Y_double (const VSImage * dest, const VSImage * src,
 
   scale->dest = dest;
   scale->src = src;
+  scale->y_start = y_start;
+  scale->y_end = y_end;
 
   n_taps = scale1d_get_n_taps (src->width, dest->width, a, sharpness);
-  scale1d_calculate_taps (&scale->x_scale1d,
-      src->width, dest->width, n_taps, a, sharpness, sharpen);
+  scale1d_get_taps (&scale->x_scale1d, SCALE1D_TAPS_DOUBLE,
+      src->width, dest->width, n_taps, a, sharpness, sharpen, 0);
 
   n_taps = scale1d_get_n_taps (src->height, dest->height, a, sharpness);
-  scale1d_calculate_taps (&scale->y_scale1d,
-      src->height, dest->height, n_taps, a, sharpness, sharpen);
+  scale1d_get_taps (&scale->y_scale1d, SCALE1D_TAPS_DOUBLE,
+      src->height, dest->height, n_taps, a, sharpness, sharpen, 0);
 
   scale->dither = dither;
 
@@ -1171,9 +1354,9 @@ vs_scale_lanczos_Y_float (Scale * scale)
   int yi;
   int tmp_yi;
 
-  tmp_yi = 0;
+  tmp_yi = scale->y_scale1d.offsets[scale->y_start];
 
-  for (j = 0; j < scale->dest->height; j++) {
+  for (j = scale->y_start; j < scale->y_end; j++) {
     guint8 *destline;
     float *taps;
 
@@ -1206,7 +1389,7 @@ vs_scale_lanczos_Y_float (Scale * scale)
 void
 vs_image_scale_lanczos_Y_float (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, double a,
-    double sharpen)
+    double sharpen, int y_start, int y_end)
 {
   Scale s = { 0 };
   Scale *scale = &s;
@@ -1214,14 +1397,16 @@ vs_image_scale_lanczos_Y_float (const VSImage * dest, const VSImage * src,
 
   scale->dest = dest;
   scale->src = src;
+  scale->y_start = y_start;
+  scale->y_end = y_end;
 
   n_taps = scale1d_get_n_taps (src->width, dest->width, a, sharpness);
-  scale1d_calculate_taps_float (&scale->x_scale1d,
-      src->width, dest->width, n_taps, a, sharpness, sharpen);
+  scale1d_get_taps (&scale->x_scale1d, SCALE1D_TAPS_FLOAT,
+      src->width, dest->width, n_taps, a, sharpness, sharpen, 0);
 
   n_taps = scale1d_get_n_taps (src->height, dest->height, a, sharpness);
-  scale1d_calculate_taps_float (&scale->y_scale1d,
-      src->height, dest->height, n_taps, a, sharpness, sharpen);
+  scale1d_get_taps (&scale->y_scale1d, SCALE1D_TAPS_FLOAT,
+      src->height, dest->height, n_taps, a, sharpness, sharpen, 0);
 
   scale->dither = dither;
 
@@ -1249,9 +1434,9 @@ vs_scale_lanczos_AYUV_int16 (Scale * scale)
   int yi;
   int tmp_yi;
 
-  tmp_yi = 0;
+  tmp_yi = scale->y_scale1d.offsets[scale->y_start];
 
-  for (j = 0; j < scale->dest->height; j++) {
+  for (j = scale->y_start; j < scale->y_end; j++) {
     guint8 *destline;
     gint16 *taps;
 
@@ -1273,10 +1458,10 @@ vs_scale_lanczos_AYUV_int16 (Scale * scale)
           sizeof (gint16) * 4 * scale->dest->width,
           scale->y_scale1d.n_taps, S16_POSTSHIFT, scale->dest->width * 4);
     } else {
-      resample_vert_int16_generic (destline,
+      resample_vert_int16_orc (destline,
           taps, TMP_LINE_S16_AYUV (scale->y_scale1d.offsets[j]),
           sizeof (gint16) * 4 * scale->dest->width,
-          scale->y_scale1d.n_taps, S16_POSTSHIFT, scale->dest->width * 4);
+          scale->y_scale1d.n_taps, scale->accdata, scale->dest->width * 4);
     }
   }
 }
@@ -1284,7 +1469,7 @@ vs_scale_lanczos_AYUV_int16 (Scale * scale)
 void
 vs_image_scale_lanczos_AYUV_int16 (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, double a,
-    double sharpen)
+    double sharpen, int y_start, int y_end)
 {
   Scale s = { 0 };
   Scale *scale = &s;
@@ -1292,14 +1477,16 @@ vs_image_scale_lanczos_AYUV_int16 (const VSImage * dest, const VSImage * src,
 
   scale->dest = dest;
   scale->src = src;
+  scale->y_start = y_start;
+  scale->y_end = y_end;
 
   n_taps = scale1d_get_n_taps (src->width, dest->width, a, sharpness);
   n_taps = ROUND_UP_4 (n_taps);
-  scale1d_calculate_taps_int16 (&scale->x_scale1d,
+  scale1d_get_taps (&scale->x_scale1d, SCALE1D_TAPS_INT16,
       src->width, dest->width, n_taps, a, sharpness, sharpen, S16_SHIFT1);
 
   n_taps = scale1d_get_n_taps (src->height, dest->height, a, sharpness);
-  scale1d_calculate_taps_int16 (&scale->y_scale1d,
+  scale1d_get_taps (&scale->y_scale1d, SCALE1D_TAPS_INT16,
       src->height, dest->height, n_taps, a, sharpness, sharpen, S16_SHIFT2);
 
   scale->dither = dither;
@@ -1329,12 +1516,14 @@ vs_image_scale_lanczos_AYUV_int16 (const VSImage * dest, const VSImage * src,
 
   scale->tmpdata =
       g_malloc (sizeof (gint16) * scale->dest->width * scale->src->height * 4);
+  scale->accdata = g_malloc (sizeof (gint32) * scale->dest->width * 4);
 
   vs_scale_lanczos_AYUV_int16 (scale);
 
   scale1d_cleanup (&scale->x_scale1d);
   scale1d_cleanup (&scale->y_scale1d);
   g_free (scale->tmpdata);
+  g_free (scale->accdata);
 }
 
 
@@ -1345,9 +1534,9 @@ vs_scale_lanczos_AYUV_int32 (Scale * scale)
   int yi;
   int tmp_yi;
 
-  tmp_yi = 0;
+  tmp_yi = scale->y_scale1d.offsets[scale->y_start];
 
-  for (j = 0; j < scale->dest->height; j++) {
+  for (j = scale->y_start; j < scale->y_end; j++) {
     guint8 *destline;
     gint32 *taps;
 
@@ -1380,7 +1569,7 @@ vs_scale_lanczos_AYUV_int32 (Scale * scale)
 void
 vs_image_scale_lanczos_AYUV_int32 (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, double a,
-    double sharpen)
+    double sharpen, int y_start, int y_end)
 {
   Scale s = { 0 };
   Scale *scale = &s;
@@ -1388,14 +1577,16 @@ vs_image_scale_lanczos_AYUV_int32 (const VSImage * dest, const VSImage * src,
 
   scale->dest = dest;
   scale->src = src;
+  scale->y_start = y_start;
+  scale->y_end = y_end;
 
   n_taps = scale1d_get_n_taps (src->width, dest->width, a, sharpness);
   n_taps = ROUND_UP_4 (n_taps);
-  scale1d_calculate_taps_int32 (&scale->x_scale1d,
+  scale1d_get_taps (&scale->x_scale1d, SCALE1D_TAPS_INT32,
       src->width, dest->width, n_taps, a, sharpness, sharpen, S32_SHIFT1);
 
   n_taps = scale1d_get_n_taps (src->height, dest->height, a, sharpness);
-  scale1d_calculate_taps_int32 (&scale->y_scale1d,
+  scale1d_get_taps (&scale->y_scale1d, SCALE1D_TAPS_INT32,
       src->height, dest->height, n_taps, a, sharpness, sharpen, S32_SHIFT2);
 
   scale->dither = dither;
@@ -1440,9 +1631,9 @@ vs_scale_lanczos_AYUV_double (Scale * scale)
   int yi;
   int tmp_yi;
 
-  tmp_yi = 0;
+  tmp_yi = scale->y_scale1d.offsets[scale->y_start];
 
-  for (j = 0; j < scale->dest->height; j++) {
+  for (j = scale->y_start; j < scale->y_end; j++) {
     guint8 *destline;
     double *taps;
 
@@ -1475,7 +1666,7 @@ vs_scale_lanczos_AYUV_double (Scale * scale)
 void
 vs_image_scale_lanczos_AYUV_double (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, double a,
-    double sharpen)
+    double sharpen, int y_start, int y_end)
 {
   Scale s = { 0 };
   Scale *scale = &s;
@@ -1483,14 +1674,16 @@ vs_image_scale_lanczos_AYUV_double (const VSImage * dest, const VSImage * src,
 
   scale->dest = dest;
   scale->src = src;
+  scale->y_start = y_start;
+  scale->y_end = y_end;
 
   n_taps = scale1d_get_n_taps (src->width, dest->width, a, sharpness);
-  scale1d_calculate_taps (&scale->x_scale1d,
-      src->width, dest->width, n_taps, a, sharpness, sharpen);
+  scale1d_get_taps (&scale->x_scale1d, SCALE1D_TAPS_DOUBLE,
+      src->width, dest->width, n_taps, a, sharpness, sharpen, 0);
 
   n_taps = scale1d_get_n_taps (src->height, dest->height, a, sharpness);
-  scale1d_calculate_taps (&scale->y_scale1d,
-      src->height, dest->height, n_taps, a, sharpness, sharpen);
+  scale1d_get_taps (&scale->y_scale1d, SCALE1D_TAPS_DOUBLE,
+      src->height, dest->height, n_taps, a, sharpness, sharpen, 0);
 
   scale->dither = dither;
 
@@ -1514,9 +1707,9 @@ vs_scale_lanczos_AYUV_float (Scale * scale)
   int yi;
   int tmp_yi;
 
-  tmp_yi = 0;
+  tmp_yi = scale->y_scale1d.offsets[scale->y_start];
 
-  for (j = 0; j < scale->dest->height; j++) {
+  for (j = scale->y_start; j < scale->y_end; j++) {
     guint8 *destline;
     float *taps;
 
@@ -1549,7 +1742,7 @@ vs_scale_lanczos_AYUV_float (Scale * scale)
 void
 vs_image_scale_lanczos_AYUV_float (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, double a,
-    double sharpen)
+    double sharpen, int y_start, int y_end)
 {
   Scale s = { 0 };
   Scale *scale = &s;
@@ -1557,14 +1750,16 @@ vs_image_scale_lanczos_AYUV_float (const VSImage * dest, const VSImage * src,
 
   scale->dest = dest;
   scale->src = src;
+  scale->y_start = y_start;
+  scale->y_end = y_end;
 
   n_taps = scale1d_get_n_taps (src->width, dest->width, a, sharpness);
-  scale1d_calculate_taps_float (&scale->x_scale1d,
-      src->width, dest->width, n_taps, a, sharpness, sharpen);
+  scale1d_get_taps (&scale->x_scale1d, SCALE1D_TAPS_FLOAT,
+      src->width, dest->width, n_taps, a, sharpness, sharpen, 0);
 
   n_taps = scale1d_get_n_taps (src->height, dest->height, a, sharpness);
-  scale1d_calculate_taps_float (&scale->y_scale1d,
-      src->height, dest->height, n_taps, a, sharpness, sharpen);
+  scale1d_get_taps (&scale->y_scale1d, SCALE1D_TAPS_FLOAT,
+      src->height, dest->height, n_taps, a, sharpness, sharpen, 0);
 
   scale->dither = dither;
 
@@ -1588,9 +1783,9 @@ vs_scale_lanczos_AYUV64_double (Scale * scale)
   int yi;
   int tmp_yi;
 
-  tmp_yi = 0;
+  tmp_yi = scale->y_scale1d.offsets[scale->y_start];
 
-  for (j = 0; j < scale->dest->height; j++) {
+  for (j = scale->y_start; j < scale->y_end; j++) {
     guint16 *destline;
     double *taps;
 
@@ -1623,7 +1818,7 @@ vs_scale_lanczos_AYUV64_double (Scale * scale)
 void
 vs_image_scale_lanczos_AYUV64_double (const VSImage * dest, const VSImage * src,
     uint8_t * tmpbuf, double sharpness, gboolean dither, double a,
-    double sharpen)
+    double sharpen, int y_start, int y_end)
 {
   Scale s = { 0 };
   Scale *scale = &s;
@@ -1631,14 +1826,16 @@ vs_image_scale_lanczos_AYUV64_double (const VSImage * dest, const VSImage * src,
 
   scale->dest = dest;
   scale->src = src;
+  scale->y_start = y_start;
+  scale->y_end = y_end;
 
   n_taps = scale1d_get_n_taps (src->width, dest->width, a, sharpness);
-  scale1d_calculate_taps (&scale->x_scale1d,
-      src->width, dest->width, n_taps, a, sharpness, sharpen);
+  scale1d_get_taps (&scale->x_scale1d, SCALE1D_TAPS_DOUBLE,
+      src->width, dest->width, n_taps, a, sharpness, sharpen, 0);
 
   n_taps = scale1d_get_n_taps (src->height, dest->height, a, sharpness);
-  scale1d_calculate_taps (&scale->y_scale1d,
-      src->height, dest->height, n_taps, a, sharpness, sharpen);
+  scale1d_get_taps (&scale->y_scale1d, SCALE1D_TAPS_DOUBLE,
+      src->height, dest->height, n_taps, a, sharpness, sharpen, 0);
 
   scale->dither = dither;
 
@@ -1654,3 +1851,192 @@ vs_image_scale_lanczos_AYUV64_double (const VSImage * dest, const VSImage * src,
   scale1d_cleanup (&scale->y_scale1d);
   g_free (scale->tmpdata);
 }
+
+/*
+ * Line based scaling of AYUV and AYUV64 pixels, for callers that produce
+ * the source lines one at a time.  The horizontally resampled lines are
+ * kept in a ring that stores each line twice, so that the lines of one
+ * vertical filter are always consecutive in memory.
+ */
+struct _VSLanczos
+{
+  gboolean bits16;
+  gboolean dither;
+  int src_height;
+  int dest_width;
+
+  Scale1D x_scale1d;
+  Scale1D y_scale1d;
+  HorizResampleFunc horiz_resample_func;
+
+  /* 2 * n_lines lines of tmp_stride bytes */
+  uint8_t *ring;
+  int n_lines;
+  int tmp_stride;
+  /* the ring holds the source lines from first_line to next_line - 1 */
+  int first_line;
+  int next_line;
+
+  gint32 *accdata;
+};
+
+VSLanczos *
+vs_lanczos_new (int src_width, int src_height, int dest_width,
+    int dest_height, gboolean bits16, double sharpness, gboolean dither,
+    double a, double sharpen)
+{
+  VSLanczos *lanczos;
+  int n_taps;
+
+  lanczos = g_slice_new0 (VSLanczos);
+  lanczos->bits16 = bits16;
+  lanczos->dither = dither;
+  lanczos->src_height = src_height;
+  lanczos->dest_width = dest_width;
+
+  if (bits16) {
+    n_taps = scale1d_get_n_taps (src_width, dest_width, a, sharpness);
+    scale1d_get_taps (&lanczos->x_scale1d, SCALE1D_TAPS_DOUBLE,
+        src_width, dest_width, n_taps, a, sharpness, sharpen, 0);
+
+    n_taps = scale1d_get_n_taps (src_height, dest_height, a, sharpness);
+    scale1d_get_taps (&lanczos->y_scale1d, SCALE1D_TAPS_DOUBLE,
+        src_height, dest_height, n_taps, a, sharpness, sharpen, 0);
+
+    lanczos->horiz_resample_func =
+        (HorizResampleFunc) resample_horiz_double_ayuv_generic_s16;
+    lanczos->tmp_stride = sizeof (double) * 4 * dest_width;
+  } else {
+    n_taps = scale1d_get_n_taps (src_width, dest_width, a, sharpness);
+    n_taps = ROUND_UP_4 (n_taps);
+    scale1d_get_taps (&lanczos->x_scale1d, SCALE1D_TAPS_INT16,
+        src_width, dest_width, n_taps, a, sharpness, sharpen, S16_SHIFT1);
+
+    n_taps = scale1d_get_n_taps (src_height, dest_height, a, sharpness);
+    scale1d_get_taps (&lanczos->y_scale1d, SCALE1D_TAPS_INT16,
+        src_height, dest_height, n_taps, a, sharpness, sharpen, S16_SHIFT2);
+
+    switch (lanczos->x_scale1d.n_taps) {
+      case 4:
+        lanczos->horiz_resample_func =
+            (HorizResampleFunc) resample_horiz_int16_int16_ayuv_taps4_shift0;
+        break;
+      case 8:
+        lanczos->horiz_resample_func =
+            (HorizResampleFunc) resample_horiz_int16_int16_ayuv_taps8_shift0;
+        break;
+      case 12:
+        lanczos->horiz_resample_func =
+            (HorizResampleFunc) resample_horiz_int16_int16_ayuv_taps12_shift0;
+        break;
+      case 16:
+        lanczos->horiz_resample_func =
+            (HorizResampleFunc) resample_horiz_int16_int16_ayuv_taps16_shift0;
+        break;
+      default:
+        lanczos->horiz_resample_func =
+            (HorizResampleFunc) resample_horiz_int16_int16_ayuv_generic;
+        break;
+    }
+    lanczos->tmp_stride = sizeof (gint16) * 4 * dest_width;
+    lanczos->accdata = g_malloc (sizeof (gint32) * dest_width * 4);
+  }
+
+  lanczos->n_lines = lanczos->y_scale1d.n_taps;
+  lanczos->ring = g_malloc (2 * lanczos->n_lines * lanczos->tmp_stride);
+
+  return lanczos;
+}
+
+void
+vs_lanczos_free (VSLanczos * lanczos)
+{
+  scale1d_cleanup (&lanczos->x_scale1d);
+  scale1d_cleanup (&lanczos->y_scale1d);
+  g_free (lanczos->ring);
+  g_free (lanczos->accdata);
+  g_slice_free (VSLanczos, lanczos);
+}
+
+/* forgets the source lines, call before scaling a new frame or field */
+void
+vs_lanczos_reset (VSLanczos * lanczos)
+{
+  lanczos->first_line = lanczos->next_line = 0;
+}
+
+static uint8_t *
+vs_lanczos_ring_line (VSLanczos * lanczos, int line)
+{
+  int slot = line % lanczos->n_lines;
+
+  if (slot < 0)
+    slot += lanczos->n_lines;
+
+  return lanczos->ring + slot * lanczos->tmp_stride;
+}
+
+/*
+ * Scales destination line @j into @dest.  The source lines are requested
+ * from @get_line, each one only once as long as the destination lines are
+ * scaled in order after vs_lanczos_reset().
+ */
+void
+vs_lanczos_scale_line (VSLanczos * lanczos, uint8_t * dest, int j,
+    VSLanczosGetLineFunc get_line, void *user_data)
+{
+  int yi, n_taps, shift;
+  uint8_t *tmp;
+  const uint8_t *src;
+
+  yi = lanczos->y_scale1d.offsets[j];
+  n_taps = lanczos->y_scale1d.n_taps;
+
+  /* start over when the ring is empty or lines are skipped */
+  if (lanczos->next_line == lanczos->first_line ||
+      yi < lanczos->first_line || yi > lanczos->next_line)
+    lanczos->first_line = lanczos->next_line = yi;
+
+  shift = lanczos->bits16 ? 0 : S16_MIDSHIFT;
+  while (lanczos->next_line < yi + n_taps) {
+    src = get_line (CLAMP (lanczos->next_line, 0, lanczos->src_height - 1),
+        user_data);
+    tmp = vs_lanczos_ring_line (lanczos, lanczos->next_line);
+    lanczos->horiz_resample_func (tmp, lanczos->x_scale1d.offsets,
+        lanczos->x_scale1d.taps, src, lanczos->x_scale1d.n_taps, shift,
+        lanczos->dest_width);
+    memcpy (tmp + lanczos->n_lines * lanczos->tmp_stride, tmp,
+        lanczos->tmp_stride);
+
+    lanczos->next_line++;
+    if (lanczos->next_line - lanczos->first_line > lanczos->n_lines)
+      lanczos->first_line = lanczos->next_line - lanczos->n_lines;
+  }
+
+  tmp = vs_lanczos_ring_line (lanczos, yi);
+  if (lanczos->bits16) {
+    double *taps = (double *) lanczos->y_scale1d.taps + j * n_taps;
+
+    if (lanczos->dither) {
+      resample_vert_dither_double_generic_u16 ((guint16 *) dest, taps,
+          (double *) tmp, lanczos->tmp_stride, n_taps, 0,
+          lanczos->dest_width * 4);
+    } else {
+      resample_vert_double_generic_u16 ((guint16 *) dest, taps,
+          (double *) tmp, lanczos->tmp_stride, n_taps, 0,
+          lanczos->dest_width * 4);
+    }
+  } else {
+    gint16 *taps = (gint16 *) lanczos->y_scale1d.taps + j * n_taps;
+
+    if (lanczos->dither) {
+      resample_vert_dither_int16_generic (dest, taps, (gint16 *) tmp,
+          lanczos->tmp_stride, n_taps, S16_POSTSHIFT,
+          lanczos->dest_width * 4);
+    } else {
+      resample_vert_int16_orc (dest, taps, (gint16 *) tmp,
+          lanczos->tmp_stride, n_taps, lanczos->accdata,
+          lanczos->dest_width * 4);
+    }
+  }
+}
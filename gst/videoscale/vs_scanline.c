@@ -35,6 +35,55 @@
 
 #include <string.h>
 
+/* orc can only resample 8 and 32 bits elements, so 16 bits elements are
+ * widened to 32 bits in a small buffer first.  The output is done in
+ * chunks whose source elements fit in that buffer. */
+
+#define WIDEN_SIZE 256
+
+static void
+resample_widened_u16 (uint16_t * dest, const uint16_t * src, int src_width,
+    int n, int *accumulator, int increment, gboolean linear)
+{
+  uint32_t tmp[WIDEN_SIZE];
+  int acc = *accumulator;
+  int chunk, bias;
+
+  /* orc truncates the position, nearest used to round it to the closest
+   * element, so add half an element */
+  bias = linear ? 0 : 32768;
+
+  if (increment > 0)
+    chunk = MAX (1, ((WIDEN_SIZE - 4) << 16) / increment);
+  else
+    chunk = n;
+
+  while (n > 0) {
+    int c = MIN (n, chunk);
+    int pos = acc + bias;
+    int j0 = MIN (pos >> 16, src_width - 1);
+    int j1 = MIN (((pos + (c - 1) * increment) >> 16) + 1, src_width - 1);
+
+    video_scale_orc_widen_u16 (tmp, src + j0, j1 - j0 + 1);
+    /* the last element is interpolated with itself and is the closest
+     * one for positions past it */
+    tmp[j1 - j0 + 1] = tmp[j1 - j0];
+
+    if (linear)
+      video_scale_orc_resample_bilinear_widened_u16 (dest, tmp,
+          pos - (j0 << 16), increment, c);
+    else
+      video_scale_orc_resample_nearest_widened_u16 (dest, tmp,
+          pos - (j0 << 16), increment, c);
+
+    dest += c;
+    acc += c * increment;
+    n -= c;
+  }
+
+  *accumulator = acc;
+}
+
 /* greyscale, i.e., single componenet */
 
 void
@@ -85,21 +134,8 @@ void
 vs_scanline_resample_nearest_Y16 (uint8_t * dest, uint8_t * src, int src_width,
     int n, int *accumulator, int increment)
 {
-  int acc = *accumulator;
-  int i;
-  int j;
-  int x;
-  uint16_t *d = (uint16_t *) dest, *s = (uint16_t *) src;
-
-  for (i = 0; i < n; i++) {
-    j = acc >> 16;
-    x = acc & 0xffff;
-    d[i] = (x < 32768 || j + 1 >= src_width) ? s[j] : s[j + 1];
-
-    acc += increment;
-  }
-
-  *accumulator = acc;
+  resample_widened_u16 ((uint16_t *) dest, (uint16_t *) src, src_width, n,
+      accumulator, increment, FALSE);
 }
 
 void
@@ -533,57 +569,22 @@ vs_scanline_downsample_NV12 (uint8_t * dest, uint8_t * src, int n)
   }
 }
 
+/* a pair of UV bytes is resampled as one 16 bits element, bilinear
+ * interpolates both bytes separately */
 void
 vs_scanline_resample_nearest_NV12 (uint8_t * dest, uint8_t * src, int src_width,
     int n, int *accumulator, int increment)
 {
-  int acc = *accumulator;
-  int i;
-  int j;
-  int x;
-
-  for (i = 0; i < n; i++) {
-    j = acc >> 16;
-    x = acc & 0xffff;
-
-    dest[i * 2 + 0] = (x < 32768
-        || j + 1 >= src_width) ? src[j * 2 + 0] : src[j * 2 + 2];
-    dest[i * 2 + 1] = (x < 32768
-        || j + 1 >= src_width) ? src[j * 2 + 1] : src[j * 2 + 3];
-
-    acc += increment;
-  }
-
-  *accumulator = acc;
+  resample_widened_u16 ((uint16_t *) dest, (uint16_t *) src, src_width, n,
+      accumulator, increment, FALSE);
 }
 
 void
 vs_scanline_resample_linear_NV12 (uint8_t * dest, uint8_t * src, int src_width,
     int n, int *accumulator, int increment)
 {
-  int acc = *accumulator;
-  int i;
-  int j;
-  int x;
-
-  for (i = 0; i < n; i++) {
-    j = acc >> 16;
-    x = acc & 0xffff;
-
-    if (j + 1 < src_width) {
-      dest[i * 2 + 0] =
-          (src[j * 2 + 0] * (65536 - x) + src[j * 2 + 2] * x) >> 16;
-      dest[i * 2 + 1] =
-          (src[j * 2 + 1] * (65536 - x) + src[j * 2 + 3] * x) >> 16;
-    } else {
-      dest[i * 4 + 0] = src[j * 2 + 0];
-      dest[i * 4 + 1] = src[j * 2 + 1];
-    }
-
-    acc += increment;
-  }
-
-  *accumulator = acc;
+  resample_widened_u16 ((uint16_t *) dest, (uint16_t *) src, src_width, n,
+      accumulator, increment, TRUE);
 }
 
 void
@@ -799,24 +800,18 @@ void
 vs_scanline_resample_nearest_AYUV64 (uint8_t * dest8, uint8_t * src8,
     int src_width, int n, int *accumulator, int increment)
 {
-  guint16 *dest = (guint16 *) dest8;
-  guint16 *src = (guint16 *) src8;
+  guint64 *dest = (guint64 *) dest8;
+  guint64 *src = (guint64 *) src8;
   int acc = *accumulator;
   int i;
   int j;
   int x;
 
+  /* orc has no 64 bits resampling load, copy whole pixels at once */
   for (i = 0; i < n; i++) {
     j = acc >> 16;
     x = acc & 0xffff;
-    dest[i * 4 + 0] = (x < 32768
-        || j + 1 >= src_width) ? src[j * 4 + 0] : src[j * 4 + 4];
-    dest[i * 4 + 1] = (x < 32768
-        || j + 1 >= src_width) ? src[j * 4 + 1] : src[j * 4 + 5];
-    dest[i * 4 + 2] = (x < 32768
-        || j + 1 >= src_width) ? src[j * 4 + 2] : src[j * 4 + 6];
-    dest[i * 4 + 3] = (x < 32768
-        || j + 1 >= src_width) ? src[j * 4 + 3] : src[j * 4 + 7];
+    dest[i] = (x < 32768 || j + 1 >= src_width) ? src[j] : src[j + 1];
 
     acc += increment;
   }
@@ -841,7 +836,7 @@ vs_scanline_resample_linear_AYUV64 (uint8_t * dest8, uint8_t * src8,
 
     if (j + 1 < src_width) {
       dest[i * 4 + 0] =
-          (src[j * 3 + 0] * (32768 - x) + src[j * 4 + 4] * x) >> 15;
+          (src[j * 4 + 0] * (32768 - x) + src[j * 4 + 4] * x) >> 15;
       dest[i * 4 + 1] =
           (src[j * 4 + 1] * (32768 - x) + src[j * 4 + 5] * x) >> 15;
       dest[i * 4 + 2] =
@@ -116,6 +116,8 @@ static void gst_video_test_src_get_times (GstBaseSrc * basesrc,
     GstBuffer * buffer, GstClockTime * start, GstClockTime * end);
 static gboolean gst_video_test_src_decide_allocation (GstBaseSrc * bsrc,
     GstQuery * query);
+static GstFlowReturn gst_video_test_src_create (GstBaseSrc * bsrc,
+    guint64 offset, guint size, GstBuffer ** buffer);
 static GstFlowReturn gst_video_test_src_fill (GstPushSrc * psrc,
     GstBuffer * buffer);
 static gboolean gst_video_test_src_start (GstBaseSrc * basesrc);
@@ -287,6 +289,7 @@ gst_video_test_src_class_init (GstVideoTestSrcClass * klass)
   gstbasesrc_class->start = gst_video_test_src_start;
   gstbasesrc_class->stop = gst_video_test_src_stop;
   gstbasesrc_class->decide_allocation = gst_video_test_src_decide_allocation;
+  gstbasesrc_class->create = gst_video_test_src_create;
 
   gstpushsrc_class->fill = gst_video_test_src_fill;
 }
@@ -418,6 +421,9 @@ gst_video_test_src_set_property (GObject * object, guint prop_id,
 {
   GstVideoTestSrc *src = GST_VIDEO_TEST_SRC (object);
 
+  /* any of the properties might change the picture */
+  g_atomic_int_set (&src->cache_dirty, TRUE);
+
   switch (prop_id) {
     case PROP_PATTERN:
       gst_video_test_src_set_pattern (src, g_value_get_enum (value));
@@ -734,6 +740,8 @@ gst_video_test_src_setcaps (GstBaseSrc * bsrc, GstCaps * caps)
   videotestsrc->running_time = 0;
   videotestsrc->n_frames = 0;
 
+  g_atomic_int_set (&videotestsrc->cache_dirty, TRUE);
+
   return TRUE;
 
   /* ERRORS */
@@ -835,45 +843,23 @@ gst_video_test_src_is_seekable (GstBaseSrc * psrc)
   return TRUE;
 }
 
-static GstFlowReturn
-gst_video_test_src_fill (GstPushSrc * psrc, GstBuffer * buffer)
+/* set the timestamps for the next frame and update the controlled
+ * properties */
+static void
+gst_video_test_src_stamp (GstVideoTestSrc * src, GstBuffer * buffer)
 {
-  GstVideoTestSrc *src;
-  GstClockTime next_time;
-  GstVideoFrame frame;
-  gconstpointer pal;
-  gsize palsize;
-
-  src = GST_VIDEO_TEST_SRC (psrc);
-
-  if (G_UNLIKELY (GST_VIDEO_INFO_FORMAT (&src->info) ==
-          GST_VIDEO_FORMAT_UNKNOWN))
-    goto not_negotiated;
-
-  /* 0 framerate and we are at the second frame, eos */
-  if (G_UNLIKELY (src->info.fps_n == 0 && src->n_frames == 1))
-    goto eos;
-
-  GST_LOG_OBJECT (src,
-      "creating buffer from pool for frame %d", (gint) src->n_frames);
-
-  if (!gst_video_frame_map (&frame, &src->info, buffer, GST_MAP_WRITE))
-    goto invalid_frame;
-
   GST_BUFFER_DTS (buffer) =
       src->accum_rtime + src->timestamp_offset + src->running_time;
   GST_BUFFER_PTS (buffer) = GST_BUFFER_DTS (buffer);
 
-  gst_object_sync_values (GST_OBJECT (psrc), GST_BUFFER_DTS (buffer));
-
-  src->make_image (src, &frame);
-
-  if ((pal = gst_video_format_get_palette (GST_VIDEO_FRAME_FORMAT (&frame),
-              &palsize))) {
-    memcpy (GST_VIDEO_FRAME_PLANE_DATA (&frame, 1), pal, palsize);
-  }
+  gst_object_sync_values (GST_OBJECT (src), GST_BUFFER_DTS (buffer));
+}
 
-  gst_video_frame_unmap (&frame);
+/* set offsets and duration and move to the next frame */
+static void
+gst_video_test_src_advance (GstVideoTestSrc * src, GstBuffer * buffer)
+{
+  GstClockTime next_time;
 
   GST_DEBUG_OBJECT (src, "Timestamp: %" GST_TIME_FORMAT " = accumulated %"
       GST_TIME_FORMAT " + offset: %"
@@ -895,6 +881,151 @@ gst_video_test_src_fill (GstPushSrc * psrc, GstBuffer * buffer)
   }
 
   src->running_time = next_time;
+}
+
+/* patterns that look the same in every frame */
+static gboolean
+gst_video_test_src_is_static (GstVideoTestSrc * src)
+{
+  /* moving bars */
+  if (src->horizontal_speed != 0)
+    return FALSE;
+
+  switch (src->pattern_type) {
+    case GST_VIDEO_TEST_SRC_SNOW:
+    case GST_VIDEO_TEST_SRC_BLINK:
+    case GST_VIDEO_TEST_SRC_ZONE_PLATE:
+    case GST_VIDEO_TEST_SRC_CHROMA_ZONE_PLATE:
+    case GST_VIDEO_TEST_SRC_BALL:
+      return FALSE;
+    default:
+      return TRUE;
+  }
+}
+
+/* render the pattern into @buffer */
+static gboolean
+gst_video_test_src_render (GstVideoTestSrc * src, GstBuffer * buffer)
+{
+  GstVideoFrame frame;
+  gconstpointer pal;
+  gsize palsize;
+
+  if (!gst_video_frame_map (&frame, &src->info, buffer, GST_MAP_WRITE))
+    return FALSE;
+
+  src->make_image (src, &frame);
+
+  if ((pal = gst_video_format_get_palette (GST_VIDEO_FRAME_FORMAT (&frame),
+              &palsize))) {
+    memcpy (GST_VIDEO_FRAME_PLANE_DATA (&frame, 1), pal, palsize);
+  }
+
+  gst_video_frame_unmap (&frame);
+
+  return TRUE;
+}
+
+/* static patterns are rendered once into a buffer from the negotiated pool
+ * or allocator, after that the same memory, along with its video meta, is
+ * pushed again with new timestamps */
+static GstFlowReturn
+gst_video_test_src_create (GstBaseSrc * bsrc, guint64 offset, guint size,
+    GstBuffer ** buffer)
+{
+  GstVideoTestSrc *src = GST_VIDEO_TEST_SRC (bsrc);
+  GstBuffer *outbuf = NULL;
+  GstFlowReturn ret;
+
+  if (!gst_video_test_src_is_static (src) ||
+      GST_VIDEO_INFO_FORMAT (&src->info) == GST_VIDEO_FORMAT_UNKNOWN) {
+    gst_buffer_replace (&src->cached, NULL);
+    return GST_BASE_SRC_CLASS (parent_class)->create (bsrc, offset, size,
+        buffer);
+  }
+
+  /* 0 framerate and we are at the second frame, eos */
+  if (G_UNLIKELY (src->info.fps_n == 0 && src->n_frames == 1))
+    goto eos;
+
+  if (src->cached) {
+    /* this shares the memory and copies the metadata of the cached frame */
+    outbuf = gst_buffer_copy (src->cached);
+    gst_video_test_src_stamp (src, outbuf);
+  }
+
+  /* the properties, possibly controlled ones, might have changed the
+   * picture */
+  if (g_atomic_int_compare_and_exchange (&src->cache_dirty, TRUE, FALSE) ||
+      outbuf == NULL) {
+    GST_LOG_OBJECT (src, "rendering frame %d", (gint) src->n_frames);
+
+    if (outbuf)
+      gst_buffer_unref (outbuf);
+    gst_buffer_replace (&src->cached, NULL);
+
+    ret = GST_BASE_SRC_CLASS (parent_class)->alloc (bsrc, offset,
+        src->info.size, &src->cached);
+    if (G_UNLIKELY (ret != GST_FLOW_OK))
+      goto alloc_failed;
+
+    gst_video_test_src_stamp (src, src->cached);
+    if (!gst_video_test_src_render (src, src->cached))
+      goto invalid_frame;
+
+    outbuf = gst_buffer_copy (src->cached);
+  }
+
+  gst_video_test_src_advance (src, outbuf);
+  *buffer = outbuf;
+
+  return GST_FLOW_OK;
+
+eos:
+  {
+    GST_DEBUG_OBJECT (src, "eos: 0 framerate, frame %d", (gint) src->n_frames);
+    return GST_FLOW_EOS;
+  }
+alloc_failed:
+  {
+    GST_DEBUG_OBJECT (src, "could not allocate the frame: %s",
+        gst_flow_get_name (ret));
+    src->cached = NULL;
+    return ret;
+  }
+invalid_frame:
+  {
+    GST_ELEMENT_ERROR (src, RESOURCE, FAILED, (NULL),
+        ("failed to map the frame"));
+    gst_buffer_replace (&src->cached, NULL);
+    return GST_FLOW_ERROR;
+  }
+}
+
+static GstFlowReturn
+gst_video_test_src_fill (GstPushSrc * psrc, GstBuffer * buffer)
+{
+  GstVideoTestSrc *src;
+
+  src = GST_VIDEO_TEST_SRC (psrc);
+
+  if (G_UNLIKELY (GST_VIDEO_INFO_FORMAT (&src->info) ==
+          GST_VIDEO_FORMAT_UNKNOWN))
+    goto not_negotiated;
+
+  /* 0 framerate and we are at the second frame, eos */
+  if (G_UNLIKELY (src->info.fps_n == 0 && src->n_frames == 1))
+    goto eos;
+
+  GST_LOG_OBJECT (src,
+      "creating buffer from pool for frame %d", (gint) src->n_frames);
+
+  gst_video_test_src_stamp (src, buffer);
+
+  if (!gst_video_test_src_render (src, buffer))
+    goto invalid_frame;
+
+  gst_video_test_src_advance (src, buffer);
 
   return GST_FLOW_OK;
 
@@ -946,6 +1077,7 @@ gst_video_test_src_stop (GstBaseSrc * basesrc)
   if (src->subsample)
     gst_video_chroma_resample_free (src->subsample);
   src->subsample = NULL;
+  gst_buffer_replace (&src->cached, NULL);
 
   for (i = 0; i < src->n_lines; i++)
     g_free (src->lines[i]);
@@ -164,6 +164,10 @@ struct _GstVideoTestSrc {
 
   void (*make_image) (GstVideoTestSrc *v, GstVideoFrame *frame);
 
+  /* last frame of a static pattern, pushed again by reference */
+  GstBuffer *cached;
+  volatile gint cache_dirty;
+
   /* temporary AYUV/ARGB scanline */
   guint8 *tmpline_u8;
   guint8 *tmpline;
@@ -51,11 +51,14 @@
 #include <orc/orcfunctions.h>
 #else
 #define orc_memset memset
+#define orc_memcpy memcpy
 #endif
 
 #include "gstvolumeorc.h"
 #include "gstvolume.h"
 
+#include <gst/orc-autotune-private.h>
+
 /* some defines for audio processing */
 /* the volume factor is a range from 0.0 to (arbitrary) VOLUME_MAX_DOUBLE = 10.0
  * we map 1.0 to VOLUME_UNITY_INT*
@@ -122,52 +125,306 @@ static void volume_before_transform (GstBaseTransform * base,
     GstBuffer * buffer);
 static GstFlowReturn volume_transform_ip (GstBaseTransform * base,
     GstBuffer * outbuf);
+static GstFlowReturn volume_transform (GstBaseTransform * base,
+    GstBuffer * inbuf, GstBuffer * outbuf);
 static gboolean volume_stop (GstBaseTransform * base);
 static gboolean volume_setup (GstAudioFilter * filter,
     const GstAudioInfo * info);
 
 static void volume_process_double (GstVolume * self, gpointer bytes,
     guint n_bytes);
+static void volume_process_out_double (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes);
 static void volume_process_controlled_double (GstVolume * self, gpointer bytes,
     gdouble * volume, guint channels, guint n_bytes);
 static void volume_process_float (GstVolume * self, gpointer bytes,
     guint n_bytes);
+static void volume_process_out_float (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes);
 static void volume_process_controlled_float (GstVolume * self, gpointer bytes,
     gdouble * volume, guint channels, guint n_bytes);
 static void volume_process_int32 (GstVolume * self, gpointer bytes,
     guint n_bytes);
+static void volume_process_out_int32 (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes);
 static void volume_process_int32_clamp (GstVolume * self, gpointer bytes,
     guint n_bytes);
+static void volume_process_out_int32_clamp (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes);
 static void volume_process_controlled_int32_clamp (GstVolume * self,
     gpointer bytes, gdouble * volume, guint channels, guint n_bytes);
 static void volume_process_int24 (GstVolume * self, gpointer bytes,
     guint n_bytes);
+static void volume_process_out_int24 (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes);
 static void volume_process_int24_clamp (GstVolume * self, gpointer bytes,
     guint n_bytes);
+static void volume_process_out_int24_clamp (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes);
 static void volume_process_controlled_int24_clamp (GstVolume * self,
     gpointer bytes, gdouble * volume, guint channels, guint n_bytes);
 static void volume_process_int16 (GstVolume * self, gpointer bytes,
     guint n_bytes);
+static void volume_process_out_int16 (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes);
 static void volume_process_int16_clamp (GstVolume * self, gpointer bytes,
     guint n_bytes);
+static void volume_process_out_int16_clamp (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes);
 static void volume_process_controlled_int16_clamp (GstVolume * self,
     gpointer bytes, gdouble * volume, guint channels, guint n_bytes);
 static void volume_process_int8 (GstVolume * self, gpointer bytes,
     guint n_bytes);
+static void volume_process_out_int8 (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes);
 static void volume_process_int8_clamp (GstVolume * self, gpointer bytes,
     guint n_bytes);
+static void volume_process_out_int8_clamp (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes);
 static void volume_process_controlled_int8_clamp (GstVolume * self,
     gpointer bytes, gdouble * volume, guint channels, guint n_bytes);
 
 
 /* helper functions */
 
+/* C versions of the constant volume kernels in gstvolumeorc.orc */
+static void
+volume_c_process_int8 (gint8 * d, int p, int n)
+{
+  gint i;
+
+  for (i = 0; i < n; i++)
+    d[i] = (gint8) ((d[i] * (gint8) p) >> VOLUME_UNITY_INT8_BIT_SHIFT);
+}
+
+static void
+volume_c_process_int8_clamp (gint8 * d, int p, int n)
+{
+  gint i, val;
+
+  for (i = 0; i < n; i++) {
+    val = (d[i] * (gint8) p) >> VOLUME_UNITY_INT8_BIT_SHIFT;
+    d[i] = CLAMP (val, VOLUME_MIN_INT8, VOLUME_MAX_INT8);
+  }
+}
+
+static void
+volume_c_process_int16 (gint16 * d, int p, int n)
+{
+  gint i;
+
+  for (i = 0; i < n; i++)
+    d[i] = (gint16) ((d[i] * (gint16) p) >> VOLUME_UNITY_INT16_BIT_SHIFT);
+}
+
+static void
+volume_c_process_int16_clamp (gint16 * d, int p, int n)
+{
+  gint i, val;
+
+  for (i = 0; i < n; i++) {
+    val = (d[i] * (gint16) p) >> VOLUME_UNITY_INT16_BIT_SHIFT;
+    d[i] = CLAMP (val, VOLUME_MIN_INT16, VOLUME_MAX_INT16);
+  }
+}
+
+static void
+volume_c_process_int32 (gint32 * d, int p, int n)
+{
+  gint i;
+
+  for (i = 0; i < n; i++)
+    d[i] = (gint32) ((d[i] * (gint64) p) >> VOLUME_UNITY_INT32_BIT_SHIFT);
+}
+
+static void
+volume_c_process_int32_clamp (gint32 * d, int p, int n)
+{
+  gint64 val;
+  gint i;
+
+  for (i = 0; i < n; i++) {
+    val = (d[i] * (gint64) p) >> VOLUME_UNITY_INT32_BIT_SHIFT;
+    d[i] = CLAMP (val, VOLUME_MIN_INT32, VOLUME_MAX_INT32);
+  }
+}
+
+static void
+volume_c_scalarmultiply_f32_ns (gfloat * d, gfloat p, int n)
+{
+  gint i;
+
+  for (i = 0; i < n; i++)
+    d[i] *= p;
+}
+
+static void
+volume_c_scalarmultiply_f64_ns (gdouble * d, gdouble p, int n)
+{
+  gint i;
+
+  for (i = 0; i < n; i++)
+    d[i] *= p;
+}
+
+/* The constant volume kernels, ORC or C depending on which one is faster on
+ * this machine. Set up once by volume_tune_kernels(). */
+static struct
+{
+  void (*process_int8) (gint8 * d, int p, int n);
+  void (*process_int8_clamp) (gint8 * d, int p, int n);
+  void (*process_int16) (gint16 * d, int p, int n);
+  void (*process_int16_clamp) (gint16 * d, int p, int n);
+  void (*process_int32) (gint32 * d, int p, int n);
+  void (*process_int32_clamp) (gint32 * d, int p, int n);
+  void (*scalarmultiply_f32_ns) (gfloat * d, gfloat p, int n);
+  void (*scalarmultiply_f64_ns) (gdouble * d, gdouble p, int n);
+} volume_kernels;
+
+typedef enum
+{
+  VOLUME_KERNEL_INT8,
+  VOLUME_KERNEL_INT8_CLAMP,
+  VOLUME_KERNEL_INT16,
+  VOLUME_KERNEL_INT16_CLAMP,
+  VOLUME_KERNEL_INT32,
+  VOLUME_KERNEL_INT32_CLAMP,
+  VOLUME_KERNEL_F32,
+  VOLUME_KERNEL_F64
+} VolumeKernel;
+
+#define VOLUME_TUNE_SAMPLES 4096
+
+typedef struct
+{
+  VolumeKernel kernel;
+  gpointer data;                /* VOLUME_TUNE_SAMPLES zeroed doubles */
+} VolumeTune;
+
+/* runs with unity gain so that the data can be reused */
+static void
+volume_tune_run (VolumeTune * tune, gboolean use_orc)
+{
+  gint n = VOLUME_TUNE_SAMPLES;
+
+  switch (tune->kernel) {
+    case VOLUME_KERNEL_INT8:
+      if (use_orc)
+        volume_orc_process_int8 (tune->data, VOLUME_UNITY_INT8, n);
+      else
+        volume_c_process_int8 (tune->data, VOLUME_UNITY_INT8, n);
+      break;
+    case VOLUME_KERNEL_INT8_CLAMP:
+      if (use_orc)
+        volume_orc_process_int8_clamp (tune->data, VOLUME_UNITY_INT8, n);
+      else
+        volume_c_process_int8_clamp (tune->data, VOLUME_UNITY_INT8, n);
+      break;
+    case VOLUME_KERNEL_INT16:
+      if (use_orc)
+        volume_orc_process_int16 (tune->data, VOLUME_UNITY_INT16, n);
+      else
+        volume_c_process_int16 (tune->data, VOLUME_UNITY_INT16, n);
+      break;
+    case VOLUME_KERNEL_INT16_CLAMP:
+      if (use_orc)
+        volume_orc_process_int16_clamp (tune->data, VOLUME_UNITY_INT16, n);
+      else
+        volume_c_process_int16_clamp (tune->data, VOLUME_UNITY_INT16, n);
+      break;
+    case VOLUME_KERNEL_INT32:
+      if (use_orc)
+        volume_orc_process_int32 (tune->data, VOLUME_UNITY_INT32, n);
+      else
+        volume_c_process_int32 (tune->data, VOLUME_UNITY_INT32, n);
+      break;
+    case VOLUME_KERNEL_INT32_CLAMP:
+      if (use_orc)
+        volume_orc_process_int32_clamp (tune->data, VOLUME_UNITY_INT32, n);
+      else
+        volume_c_process_int32_clamp (tune->data, VOLUME_UNITY_INT32, n);
+      break;
+    case VOLUME_KERNEL_F32:
+      if (use_orc)
+        volume_orc_scalarmultiply_f32_ns (tune->data, 1.0, n);
+      else
+        volume_c_scalarmultiply_f32_ns (tune->data, 1.0, n);
+      break;
+    case VOLUME_KERNEL_F64:
+      if (use_orc)
+        volume_orc_scalarmultiply_f64_ns (tune->data, 1.0, n);
+      else
+        volume_c_scalarmultiply_f64_ns (tune->data, 1.0, n);
+      break;
+  }
+}
+
+static gboolean
+volume_tune_use_orc (VolumeTune * tune, VolumeKernel kernel,
+    const gchar * name)
+{
+  tune->kernel = kernel;
+
+  return gst_orc_autotune_use_orc (name,
+      (GstOrcAutotuneFunc) volume_tune_run, tune);
+}
+
+static gpointer
+volume_tune_kernels (gpointer user_data)
+{
+  VolumeTune tune;
+
+  tune.data = g_malloc0 (VOLUME_TUNE_SAMPLES * sizeof (gdouble));
+
+  volume_kernels.process_int8 =
+      volume_tune_use_orc (&tune, VOLUME_KERNEL_INT8,
+      "volume_orc_process_int8") ? volume_orc_process_int8 :
+      volume_c_process_int8;
+  volume_kernels.process_int8_clamp =
+      volume_tune_use_orc (&tune, VOLUME_KERNEL_INT8_CLAMP,
+      "volume_orc_process_int8_clamp") ? volume_orc_process_int8_clamp :
+      volume_c_process_int8_clamp;
+  volume_kernels.process_int16 =
+      volume_tune_use_orc (&tune, VOLUME_KERNEL_INT16,
+      "volume_orc_process_int16") ? volume_orc_process_int16 :
+      volume_c_process_int16;
+  volume_kernels.process_int16_clamp =
+      volume_tune_use_orc (&tune, VOLUME_KERNEL_INT16_CLAMP,
+      "volume_orc_process_int16_clamp") ? volume_orc_process_int16_clamp :
+      volume_c_process_int16_clamp;
+  volume_kernels.process_int32 =
+      volume_tune_use_orc (&tune, VOLUME_KERNEL_INT32,
+      "volume_orc_process_int32") ? volume_orc_process_int32 :
+      volume_c_process_int32;
+  volume_kernels.process_int32_clamp =
+      volume_tune_use_orc (&tune, VOLUME_KERNEL_INT32_CLAMP,
+      "volume_orc_process_int32_clamp") ? volume_orc_process_int32_clamp :
+      volume_c_process_int32_clamp;
+  volume_kernels.scalarmultiply_f32_ns =
+      volume_tune_use_orc (&tune, VOLUME_KERNEL_F32,
+      "volume_orc_scalarmultiply_f32_ns") ? volume_orc_scalarmultiply_f32_ns :
+      volume_c_scalarmultiply_f32_ns;
+  volume_kernels.scalarmultiply_f64_ns =
+      volume_tune_use_orc (&tune, VOLUME_KERNEL_F64,
+      "volume_orc_scalarmultiply_f64_ns") ? volume_orc_scalarmultiply_f64_ns :
+      volume_c_scalarmultiply_f64_ns;
+
+  g_free (tune.data);
+
+  return NULL;
+}
+
 static gboolean
 volume_choose_func (GstVolume * self, const GstAudioInfo * info)
 {
   GstAudioFormat format;
 
+  static GOnce tune_once = G_ONCE_INIT;
+
+  g_once (&tune_once, volume_tune_kernels, NULL);
+
   self->process = NULL;
+  self->process_out = NULL;
   self->process_controlled = NULL;
 
   format = GST_AUDIO_INFO_FORMAT (info);
@@ -180,8 +437,10 @@ volume_choose_func (GstVolume * self, const GstAudioInfo * info)
       /* only clamp if the gain is greater than 1.0 */
       if (self->current_vol_i32 > VOLUME_UNITY_INT32) {
         self->process = volume_process_int32_clamp;
+        self->process_out = volume_process_out_int32_clamp;
       } else {
         self->process = volume_process_int32;
+        self->process_out = volume_process_out_int32;
       }
       self->process_controlled = volume_process_controlled_int32_clamp;
       break;
@@ -189,8 +448,10 @@ volume_choose_func (GstVolume * self, const GstAudioInfo * info)
       /* only clamp if the gain is greater than 1.0 */
       if (self->current_vol_i24 > VOLUME_UNITY_INT24) {
         self->process = volume_process_int24_clamp;
+        self->process_out = volume_process_out_int24_clamp;
       } else {
         self->process = volume_process_int24;
+        self->process_out = volume_process_out_int24;
       }
       self->process_controlled = volume_process_controlled_int24_clamp;
       break;
@@ -198,8 +459,10 @@ volume_choose_func (GstVolume * self, const GstAudioInfo * info)
       /* only clamp if the gain is greater than 1.0 */
       if (self->current_vol_i16 > VOLUME_UNITY_INT16) {
         self->process = volume_process_int16_clamp;
+        self->process_out = volume_process_out_int16_clamp;
       } else {
         self->process = volume_process_int16;
+        self->process_out = volume_process_out_int16;
       }
       self->process_controlled = volume_process_controlled_int16_clamp;
       break;
@@ -207,17 +470,21 @@ volume_choose_func (GstVolume * self, const GstAudioInfo * info)
       /* only clamp if the gain is greater than 1.0 */
       if (self->current_vol_i8 > VOLUME_UNITY_INT8) {
         self->process = volume_process_int8_clamp;
+        self->process_out = volume_process_out_int8_clamp;
       } else {
         self->process = volume_process_int8;
+        self->process_out = volume_process_out_int8;
       }
       self->process_controlled = volume_process_controlled_int8_clamp;
       break;
     case GST_AUDIO_FORMAT_F32:
       self->process = volume_process_float;
+      self->process_out = volume_process_out_float;
       self->process_controlled = volume_process_controlled_float;
       break;
     case GST_AUDIO_FORMAT_F64:
       self->process = volume_process_double;
+      self->process_out = volume_process_out_double;
       self->process_controlled = volume_process_controlled_double;
       break;
     default:
@@ -328,10 +595,12 @@ gst_volume_class_init (GstVolumeClass * klass)
 
   trans_class->before_transform = GST_DEBUG_FUNCPTR (volume_before_transform);
   trans_class->transform_ip = GST_DEBUG_FUNCPTR (volume_transform_ip);
+  trans_class->transform = GST_DEBUG_FUNCPTR (volume_transform);
   trans_class->stop = GST_DEBUG_FUNCPTR (volume_stop);
   trans_class->transform_ip_on_passthrough = FALSE;
 
   filter_class->setup = GST_DEBUG_FUNCPTR (volume_setup);
+  filter_class->transform_in_place_if_writable = TRUE;
 }
 
 static void
@@ -352,7 +621,35 @@ volume_process_double (GstVolume * self, gpointer bytes, guint n_bytes)
   gdouble *data = (gdouble *) bytes;
   guint num_samples = n_bytes / sizeof (gdouble);
 
-  volume_orc_scalarmultiply_f64_ns (data, self->current_volume, num_samples);
+  volume_kernels.scalarmultiply_f64_ns (data, self->current_volume,
+      num_samples);
+}
+
+static void
+volume_process_out_double (GstVolume * self, gpointer dest, gconstpointer src,
+    guint n_bytes)
+{
+  guint num_samples = n_bytes / sizeof (gdouble);
+
+  volume_orc_scale_f64 (dest, src, self->current_volume, num_samples);
+}
+
+/* Repeats each of the @num_frames volumes @channels times, in place starting
+ * from the end, so that interleaved samples with any number of channels can be
+ * processed with the 1 channel ORC functions. @volume must have room for
+ * @num_frames * @channels values. */
+static void
+volume_expand_volumes (gdouble * volume, guint channels, guint num_frames)
+{
+  gdouble *out = volume + num_frames * channels;
+  guint i, j;
+
+  for (i = num_frames; i > 0; i--) {
+    gdouble vol = volume[i - 1];
+
+    for (j = 0; j < channels; j++)
+      *--out = vol;
+  }
 }
 
 static void
@@ -361,19 +658,10 @@ volume_process_controlled_double (GstVolume * self, gpointer bytes,
 {
   gdouble *data = (gdouble *) bytes;
   guint num_samples = n_bytes / (sizeof (gdouble) * channels);
-  guint i, j;
-  gdouble vol;
 
-  if (channels == 1) {
-    volume_orc_process_controlled_f64_1ch (data, volume, num_samples);
-  } else {
-    for (i = 0; i < num_samples; i++) {
-      vol = *volume++;
-      for (j = 0; j < channels; j++) {
-        *data++ *= vol;
-      }
-    }
-  }
+  if (channels > 1)
+    volume_expand_volumes (volume, channels, num_samples);
+  volume_orc_process_controlled_f64_1ch (data, volume, num_samples * channels);
 }
 
 static void
@@ -382,7 +670,17 @@ volume_process_float (GstVolume * self, gpointer bytes, guint n_bytes)
   gfloat *data = (gfloat *) bytes;
   guint num_samples = n_bytes / sizeof (gfloat);
 
-  volume_orc_scalarmultiply_f32_ns (data, self->current_volume, num_samples);
+  volume_kernels.scalarmultiply_f32_ns (data, self->current_volume,
+      num_samples);
+}
+
+static void
+volume_process_out_float (GstVolume * self, gpointer dest, gconstpointer src,
+    guint n_bytes)
+{
+  guint num_samples = n_bytes / sizeof (gfloat);
+
+  volume_orc_scale_f32 (dest, src, self->current_volume, num_samples);
 }
 
 static void
@@ -391,20 +689,15 @@ volume_process_controlled_float (GstVolume * self, gpointer bytes,
 {
   gfloat *data = (gfloat *) bytes;
   guint num_samples = n_bytes / (sizeof (gfloat) * channels);
-  guint i, j;
-  gdouble vol;
 
   if (channels == 1) {
     volume_orc_process_controlled_f32_1ch (data, volume, num_samples);
   } else if (channels == 2) {
     volume_orc_process_controlled_f32_2ch (data, volume, num_samples);
   } else {
-    for (i = 0; i < num_samples; i++) {
-      vol = *volume++;
-      for (j = 0; j < channels; j++) {
-        *data++ *= vol;
-      }
-    }
+    volume_expand_volumes (volume, channels, num_samples);
+    volume_orc_process_controlled_f32_1ch (data, volume,
+        num_samples * channels);
   }
 }
 
@@ -416,7 +709,19 @@ volume_process_int32 (GstVolume * self, gpointer bytes, guint n_bytes)
 
   /* hard coded in volume.orc */
   g_assert (VOLUME_UNITY_INT32_BIT_SHIFT == 27);
-  volume_orc_process_int32 (data, self->current_vol_i32, num_samples);
+  volume_kernels.process_int32 (data, self->current_vol_i32, num_samples);
+}
+
+static void
+volume_process_out_int32 (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes)
+{
+  guint num_samples = n_bytes / sizeof (gint32);
+
+  /* hard coded in volume.orc */
+  g_assert (VOLUME_UNITY_INT32_BIT_SHIFT == 27);
+
+  volume_orc_scale_int32 (dest, src, self->current_vol_i32, num_samples);
 }
 
 static void
@@ -428,7 +733,19 @@ volume_process_int32_clamp (GstVolume * self, gpointer bytes, guint n_bytes)
   /* hard coded in volume.orc */
   g_assert (VOLUME_UNITY_INT32_BIT_SHIFT == 27);
 
-  volume_orc_process_int32_clamp (data, self->current_vol_i32, num_samples);
+  volume_kernels.process_int32_clamp (data, self->current_vol_i32, num_samples);
+}
+
+static void
+volume_process_out_int32_clamp (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes)
+{
+  guint num_samples = n_bytes / sizeof (gint32);
+
+  /* hard coded in volume.orc */
+  g_assert (VOLUME_UNITY_INT32_BIT_SHIFT == 27);
+
+  volume_orc_scale_int32_clamp (dest, src, self->current_vol_i32, num_samples);
 }
 
 static void
@@ -436,21 +753,12 @@ volume_process_controlled_int32_clamp (GstVolume * self, gpointer bytes,
     gdouble * volume, guint channels, guint n_bytes)
 {
   gint32 *data = (gint32 *) bytes;
-  guint i, j;
   guint num_samples = n_bytes / (sizeof (gint32) * channels);
-  gdouble vol, val;
 
-  if (channels == 1) {
-    volume_orc_process_controlled_int32_1ch (data, volume, num_samples);
-  } else {
-    for (i = 0; i < num_samples; i++) {
-      vol = *volume++;
-      for (j = 0; j < channels; j++) {
-        val = *data * vol;
-        *data++ = (gint32) CLAMP (val, VOLUME_MIN_INT32, VOLUME_MAX_INT32);
-      }
-    }
-  }
+  if (channels > 1)
+    volume_expand_volumes (volume, channels, num_samples);
+  volume_orc_process_controlled_int32_1ch (data, volume,
+      num_samples * channels);
 }
 
 #if (G_BYTE_ORDER == G_LITTLE_ENDIAN)
@@ -496,6 +804,31 @@ volume_process_int24 (GstVolume * self, gpointer bytes, guint n_bytes)
   }
 }
 
+static void
+volume_process_out_int24 (GstVolume * self, gpointer dest, gconstpointer src,
+    guint n_bytes)
+{
+  gint8 *data = (gint8 *) dest;
+  const gint8 *in = (const gint8 *) src;
+  guint i, num_samples;
+  guint32 samp;
+  gint64 val;
+
+  num_samples = n_bytes / (sizeof (gint8) * 3);
+  for (i = 0; i < num_samples; i++) {
+    samp = get_unaligned_i24 (in);
+    in += 3;
+
+    val = (gint32) samp;
+    val =
+        (((gint64) self->current_vol_i24 *
+            val) >> VOLUME_UNITY_INT24_BIT_SHIFT);
+    samp = (guint32) val;
+
+    write_unaligned_u24 (data, samp);
+  }
+}
+
 static void
 volume_process_int24_clamp (GstVolume * self, gpointer bytes, guint n_bytes)
 {
@@ -519,6 +852,31 @@ volume_process_int24_clamp (GstVolume * self, gpointer bytes, guint n_bytes)
   }
 }
 
+static void
+volume_process_out_int24_clamp (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes)
+{
+  gint8 *data = (gint8 *) dest;
+  const gint8 *in = (const gint8 *) src;
+  guint i, num_samples;
+  guint32 samp;
+  gint64 val;
+
+  num_samples = n_bytes / (sizeof (gint8) * 3);
+  for (i = 0; i < num_samples; i++) {
+    samp = get_unaligned_i24 (in);
+    in += 3;
+
+    val = (gint32) samp;
+    val =
+        (((gint64) self->current_vol_i24 *
+            val) >> VOLUME_UNITY_INT24_BIT_SHIFT);
+    samp = (guint32) CLAMP (val, VOLUME_MIN_INT24, VOLUME_MAX_INT24);
+
+    write_unaligned_u24 (data, samp);
+  }
+}
+
 static void
 volume_process_controlled_int24_clamp (GstVolume * self, gpointer bytes,
     gdouble * volume, guint channels, guint n_bytes)
@@ -547,7 +905,19 @@ volume_process_int16 (GstVolume * self, gpointer bytes, guint n_bytes)
   /* hard coded in volume.orc */
   g_assert (VOLUME_UNITY_INT16_BIT_SHIFT == 11);
 
-  volume_orc_process_int16 (data, self->current_vol_i16, num_samples);
+  volume_kernels.process_int16 (data, self->current_vol_i16, num_samples);
+}
+
+static void
+volume_process_out_int16 (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes)
+{
+  guint num_samples = n_bytes / sizeof (gint16);
+
+  /* hard coded in volume.orc */
+  g_assert (VOLUME_UNITY_INT16_BIT_SHIFT == 11);
+
+  volume_orc_scale_int16 (dest, src, self->current_vol_i16, num_samples);
 }
 
 static void
@@ -559,7 +929,19 @@ volume_process_int16_clamp (GstVolume * self, gpointer bytes, guint n_bytes)
   /* hard coded in volume.orc */
   g_assert (VOLUME_UNITY_INT16_BIT_SHIFT == 11);
 
-  volume_orc_process_int16_clamp (data, self->current_vol_i16, num_samples);
+  volume_kernels.process_int16_clamp (data, self->current_vol_i16, num_samples);
+}
+
+static void
+volume_process_out_int16_clamp (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes)
+{
+  guint num_samples = n_bytes / sizeof (gint16);
+
+  /* hard coded in volume.orc */
+  g_assert (VOLUME_UNITY_INT16_BIT_SHIFT == 11);
+
+  volume_orc_scale_int16_clamp (dest, src, self->current_vol_i16, num_samples);
 }
 
 static void
@@ -567,22 +949,16 @@ volume_process_controlled_int16_clamp (GstVolume * self, gpointer bytes,
     gdouble * volume, guint channels, guint n_bytes)
 {
   gint16 *data = (gint16 *) bytes;
-  guint i, j;
   guint num_samples = n_bytes / (sizeof (gint16) * channels);
-  gdouble vol, val;
 
   if (channels == 1) {
     volume_orc_process_controlled_int16_1ch (data, volume, num_samples);
   } else if (channels == 2) {
     volume_orc_process_controlled_int16_2ch (data, volume, num_samples);
   } else {
-    for (i = 0; i < num_samples; i++) {
-      vol = *volume++;
-      for (j = 0; j < channels; j++) {
-        val = *data * vol;
-        *data++ = (gint16) CLAMP (val, VOLUME_MIN_INT16, VOLUME_MAX_INT16);
-      }
-    }
+    volume_expand_volumes (volume, channels, num_samples);
+    volume_orc_process_controlled_int16_1ch (data, volume,
+        num_samples * channels);
   }
 }
 
@@ -595,7 +971,19 @@ volume_process_int8 (GstVolume * self, gpointer bytes, guint n_bytes)
   /* hard coded in volume.orc */
   g_assert (VOLUME_UNITY_INT8_BIT_SHIFT == 3);
 
-  volume_orc_process_int8 (data, self->current_vol_i8, num_samples);
+  volume_kernels.process_int8 (data, self->current_vol_i8, num_samples);
+}
+
+static void
+volume_process_out_int8 (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes)
+{
+  guint num_samples = n_bytes / sizeof (gint8);
+
+  /* hard coded in volume.orc */
+  g_assert (VOLUME_UNITY_INT8_BIT_SHIFT == 3);
+
+  volume_orc_scale_int8 (dest, src, self->current_vol_i8, num_samples);
 }
 
 static void
@@ -607,7 +995,19 @@ volume_process_int8_clamp (GstVolume * self, gpointer bytes, guint n_bytes)
   /* hard coded in volume.orc */
   g_assert (VOLUME_UNITY_INT8_BIT_SHIFT == 3);
 
-  volume_orc_process_int8_clamp (data, self->current_vol_i8, num_samples);
+  volume_kernels.process_int8_clamp (data, self->current_vol_i8, num_samples);
+}
+
+static void
+volume_process_out_int8_clamp (GstVolume * self, gpointer dest,
+    gconstpointer src, guint n_bytes)
+{
+  guint num_samples = n_bytes / sizeof (gint8);
+
+  /* hard coded in volume.orc */
+  g_assert (VOLUME_UNITY_INT8_BIT_SHIFT == 3);
+
+  volume_orc_scale_int8_clamp (dest, src, self->current_vol_i8, num_samples);
 }
 
 static void
@@ -615,22 +1015,16 @@ volume_process_controlled_int8_clamp (GstVolume * self, gpointer bytes,
     gdouble * volume, guint channels, guint n_bytes)
 {
   gint8 *data = (gint8 *) bytes;
-  guint i, j;
   guint num_samples = n_bytes / (sizeof (gint8) * channels);
-  gdouble val, vol;
 
   if (channels == 1) {
     volume_orc_process_controlled_int8_1ch (data, volume, num_samples);
   } else if (channels == 2) {
     volume_orc_process_controlled_int8_2ch (data, volume, num_samples);
   } else {
-    for (i = 0; i < num_samples; i++) {
-      vol = *volume++;
-      for (j = 0; j < channels; j++) {
-        val = *data * vol;
-        *data++ = (gint8) CLAMP (val, VOLUME_MIN_INT8, VOLUME_MAX_INT8);
-      }
-    }
+    volume_expand_volumes (volume, channels, num_samples);
+    volume_orc_process_controlled_int8_1ch (data, volume,
+        num_samples * channels);
   }
 }
 
@@ -708,6 +1102,74 @@ volume_before_transform (GstBaseTransform * base, GstBuffer * buffer)
   }
 }
 
+/* fill self->volumes with the controlled volumes of the @n_bytes of audio
+ * starting at stream time @ts, returns FALSE if there is no active control
+ * binding and the constant volume applies */
+static gboolean
+volume_get_controlled_volumes (GstVolume * self, GstClockTime ts,
+    gsize n_bytes)
+{
+  GstAudioFilter *filter = GST_AUDIO_FILTER_CAST (self);
+  GstControlBinding *mute_cb, *volume_cb;
+  gint rate, width, channels;
+  guint nsamples;
+  GstClockTime interval;
+  gboolean have_mutes = FALSE;
+  gboolean have_volumes = FALSE;
+
+  mute_cb = gst_object_get_control_binding (GST_OBJECT (self), "mute");
+  volume_cb = gst_object_get_control_binding (GST_OBJECT (self), "volume");
+
+  if (!mute_cb && (!volume_cb || self->current_mute)) {
+    if (volume_cb)
+      gst_object_unref (volume_cb);
+    return FALSE;
+  }
+
+  rate = GST_AUDIO_INFO_RATE (&filter->info);
+  width = GST_AUDIO_FORMAT_INFO_WIDTH (filter->info.finfo) / 8;
+  channels = GST_AUDIO_INFO_CHANNELS (&filter->info);
+  nsamples = n_bytes / (width * channels);
+  interval = gst_util_uint64_scale_int (1, GST_SECOND, rate);
+
+  if (self->mutes_count < nsamples && mute_cb) {
+    self->mutes = g_realloc (self->mutes, sizeof (gboolean) * nsamples);
+    self->mutes_count = nsamples;
+  }
+
+  /* leave room to repeat the volumes for every channel */
+  if (self->volumes_count < nsamples * channels) {
+    self->volumes =
+        g_realloc (self->volumes, sizeof (gdouble) * nsamples * channels);
+    self->volumes_count = nsamples * channels;
+  }
+
+  if (volume_cb) {
+    have_volumes =
+        gst_control_binding_get_value_array (volume_cb, ts, interval,
+        nsamples, (gpointer) self->volumes);
+    gst_object_replace ((GstObject **) & volume_cb, NULL);
+  }
+  if (!have_volumes) {
+    volume_orc_memset_f64 (self->volumes, self->current_volume, nsamples);
+  }
+
+  if (mute_cb) {
+    have_mutes = gst_control_binding_get_value_array (mute_cb, ts, interval,
+        nsamples, (gpointer) self->mutes);
+    gst_object_replace ((GstObject **) & mute_cb, NULL);
+  }
+  if (have_mutes) {
+    volume_orc_prepare_volumes (self->volumes, self->mutes, nsamples);
+  } else {
+    g_free (self->mutes);
+    self->mutes = NULL;
+    self->mutes_count = 0;
+  }
+
+  return TRUE;
+}
+
 /* call the plugged-in process function for this instance
  * needs to be done with this indirection since volume_transform is
  * a class-global method
@@ -731,72 +1193,73 @@ volume_transform_ip (GstBaseTransform * base, GstBuffer * outbuf)
   ts = GST_BUFFER_TIMESTAMP (outbuf);
   ts = gst_segment_to_stream_time (&base->segment, GST_FORMAT_TIME, ts);
 
-  if (GST_CLOCK_TIME_IS_VALID (ts)) {
-    GstControlBinding *mute_cb, *volume_cb;
-
-    mute_cb = gst_object_get_control_binding (GST_OBJECT (self), "mute");
-    volume_cb = gst_object_get_control_binding (GST_OBJECT (self), "volume");
+  if (GST_CLOCK_TIME_IS_VALID (ts) &&
+      volume_get_controlled_volumes (self, ts, map.size)) {
+    self->process_controlled (self, map.data, self->volumes,
+        GST_AUDIO_INFO_CHANNELS (&filter->info), map.size);
+  } else if (self->current_volume == 0.0 || self->current_mute) {
+    orc_memset (map.data, 0, map.size);
+    GST_BUFFER_FLAG_SET (outbuf, GST_BUFFER_FLAG_GAP);
+  } else if (self->current_volume != 1.0) {
+    self->process (self, map.data, map.size);
+  }
 
-    if (mute_cb || (volume_cb && !self->current_mute)) {
-      gint rate = GST_AUDIO_INFO_RATE (&filter->info);
-      gint width = GST_AUDIO_FORMAT_INFO_WIDTH (filter->info.finfo) / 8;
-      gint channels = GST_AUDIO_INFO_CHANNELS (&filter->info);
-      guint nsamples = map.size / (width * channels);
-      GstClockTime interval = gst_util_uint64_scale_int (1, GST_SECOND, rate);
-      gboolean have_mutes = FALSE;
-      gboolean have_volumes = FALSE;
+  gst_buffer_unmap (outbuf, &map);
 
-      if (self->mutes_count < nsamples && mute_cb) {
-        self->mutes = g_realloc (self->mutes, sizeof (gboolean) * nsamples);
-        self->mutes_count = nsamples;
-      }
+  return GST_FLOW_OK;
 
-      if (self->volumes_count < nsamples) {
-        self->volumes = g_realloc (self->volumes, sizeof (gdouble) * nsamples);
-        self->volumes_count = nsamples;
-      }
+  /* ERRORS */
+not_negotiated:
+  {
+    GST_ELEMENT_ERROR (self, CORE, NEGOTIATION,
+        ("No format was negotiated"), (NULL));
+    return GST_FLOW_NOT_NEGOTIATED;
+  }
+}
 
-      if (volume_cb) {
-        have_volumes =
-            gst_control_binding_get_value_array (volume_cb, ts, interval,
-            nsamples, (gpointer) self->volumes);
-        gst_object_replace ((GstObject **) & volume_cb, NULL);
-      }
-      if (!have_volumes) {
-        volume_orc_memset_f64 (self->volumes, self->current_volume, nsamples);
-      }
+/* the audio filter hands us the input buffer as output buffer when it is
+ * writable, and an output buffer from the pool when it is not. Transform
+ * into that one in a single pass instead of copying first. */
+static GstFlowReturn
+volume_transform (GstBaseTransform * base, GstBuffer * inbuf,
+    GstBuffer * outbuf)
+{
+  GstAudioFilter *filter = GST_AUDIO_FILTER_CAST (base);
+  GstVolume *self = GST_VOLUME (base);
+  GstMapInfo inmap, outmap;
+  GstClockTime ts;
 
-      if (mute_cb) {
-        have_mutes = gst_control_binding_get_value_array (mute_cb, ts, interval,
-            nsamples, (gpointer) self->mutes);
-        gst_object_replace ((GstObject **) & mute_cb, NULL);
-      }
-      if (have_mutes) {
-        volume_orc_prepare_volumes (self->volumes, self->mutes, nsamples);
-      } else {
-        g_free (self->mutes);
-        self->mutes = NULL;
-        self->mutes_count = 0;
-      }
+  if (inbuf == outbuf)
+    return volume_transform_ip (base, outbuf);
 
-      self->process_controlled (self, map.data, self->volumes, channels,
-          map.size);
+  if (G_UNLIKELY (!self->negotiated))
+    goto not_negotiated;
 
-      goto done;
-    } else if (volume_cb) {
-      gst_object_unref (volume_cb);
-    }
-  }
+  gst_buffer_map (inbuf, &inmap, GST_MAP_READ);
+  gst_buffer_map (outbuf, &outmap, GST_MAP_WRITE);
+  ts = GST_BUFFER_TIMESTAMP (inbuf);
+  ts = gst_segment_to_stream_time (&base->segment, GST_FORMAT_TIME, ts);
 
-  if (self->current_volume == 0.0 || self->current_mute) {
-    orc_memset (map.data, 0, map.size);
+  if (GST_BUFFER_FLAG_IS_SET (inbuf, GST_BUFFER_FLAG_GAP)) {
+    /* GAP data is silence already, no need to read it */
+    orc_memset (outmap.data, 0, outmap.size);
+  } else if (GST_CLOCK_TIME_IS_VALID (ts) &&
+      volume_get_controlled_volumes (self, ts, inmap.size)) {
+    /* the controlled kernels only work in place */
+    orc_memcpy (outmap.data, inmap.data, outmap.size);
+    self->process_controlled (self, outmap.data, self->volumes,
+        GST_AUDIO_INFO_CHANNELS (&filter->info), outmap.size);
+  } else if (self->current_volume == 0.0 || self->current_mute) {
+    orc_memset (outmap.data, 0, outmap.size);
     GST_BUFFER_FLAG_SET (outbuf, GST_BUFFER_FLAG_GAP);
   } else if (self->current_volume != 1.0) {
-    self->process (self, map.data, map.size);
+    self->process_out (self, outmap.data, inmap.data, outmap.size);
+  } else {
+    orc_memcpy (outmap.data, inmap.data, outmap.size);
   }
 
-done:
-  gst_buffer_unmap (outbuf, &map);
+  gst_buffer_unmap (outbuf, &outmap);
+  gst_buffer_unmap (inbuf, &inmap);
 
   return GST_FLOW_OK;
 
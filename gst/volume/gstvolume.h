@@ -55,6 +55,7 @@ struct _GstVolume {
   GstAudioFilter element;
 
   void (*process)(GstVolume*, gpointer, guint);
+  void (*process_out)(GstVolume*, gpointer, gconstpointer, guint);
   void (*process_controlled)(GstVolume*, gpointer, gdouble *, guint, guint);
 
   gboolean mute;
@@ -157,7 +157,8 @@ enum
   PROP_HANDLE_EVENTS,
   PROP_HANDLE_EXPOSE,
   PROP_WINDOW_WIDTH,
-  PROP_WINDOW_HEIGHT
+  PROP_WINDOW_HEIGHT,
+  PROP_REFRESH_RATE
 };
 
 /* ============================================================= */
@@ -224,6 +225,18 @@ gst_ximagesink_xwindow_draw_borders (GstXImageSink * ximagesink,
   }
 }
 
+/* XSync reads the events the server sent into the Xlib queue, after which
+ * they no longer make the connection readable. Wake up the event thread when
+ * that happened so it does not sleep on them until its timeout.
+ * Called with the x_lock */
+static void
+gst_ximagesink_wake_event_thread (GstXImageSink * ximagesink)
+{
+  if (XEventsQueued (ximagesink->xcontext->disp, QueuedAlready) > 0 &&
+      g_atomic_int_compare_and_exchange (&ximagesink->event_wakeup, 0, 1))
+    gst_poll_write_control (ximagesink->event_poll);
+}
+
 /* This function puts a GstXImageBuffer on a GstXImageSink's window */
 static gboolean
 gst_ximagesink_ximage_put (GstXImageSink * ximagesink, GstBuffer * ximage)
@@ -320,6 +333,8 @@ gst_ximagesink_ximage_put (GstXImageSink * ximagesink, GstBuffer * ximage)
 
   XSync (ximagesink->xcontext->disp, FALSE);
 
+  gst_ximagesink_wake_event_thread (ximagesink);
+
   g_mutex_unlock (&ximagesink->x_lock);
 
   g_mutex_unlock (&ximagesink->flow_lock);
@@ -704,22 +719,41 @@ gst_ximagesink_handle_xevents (GstXImageSink * ximagesink)
 static gpointer
 gst_ximagesink_event_thread (GstXImageSink * ximagesink)
 {
+  GstPollFD fd = GST_POLL_FD_INIT;
+
   g_return_val_if_fail (GST_IS_XIMAGESINK (ximagesink), NULL);
 
+  /* sleep until the X server sends us something instead of polling */
+  fd.fd = ConnectionNumber (ximagesink->xcontext->disp);
+  gst_poll_add_fd (ximagesink->event_poll, &fd);
+  gst_poll_fd_ctl_read (ximagesink->event_poll, &fd, TRUE);
+
   GST_OBJECT_LOCK (ximagesink);
   while (ximagesink->running) {
     GST_OBJECT_UNLOCK (ximagesink);
 
     if (ximagesink->xwindow) {
       gst_ximagesink_handle_xevents (ximagesink);
+    } else {
+      /* read the pending data so that the connection doesn't stay readable */
+      g_mutex_lock (&ximagesink->x_lock);
+      XPending (ximagesink->xcontext->disp);
+      g_mutex_unlock (&ximagesink->x_lock);
     }
-    /* FIXME: do we want to align this with the framerate or anything else? */
-    g_usleep (G_USEC_PER_SEC / 20);
+
+    /* events can also end up in the Xlib queue through X calls made by
+     * others without waking us up, the timeout makes sure they are handled
+     * eventually */
+    gst_poll_wait (ximagesink->event_poll, GST_SECOND);
+    if (g_atomic_int_compare_and_exchange (&ximagesink->event_wakeup, 1, 0))
+      gst_poll_read_control (ximagesink->event_poll);
 
     GST_OBJECT_LOCK (ximagesink);
   }
   GST_OBJECT_UNLOCK (ximagesink);
 
+  gst_poll_remove_fd (ximagesink->event_poll, &fd);
+
   return NULL;
 }
 
@@ -740,6 +774,7 @@ gst_ximagesink_manage_event_thread (GstXImageSink * ximagesink)
       GST_DEBUG_OBJECT (ximagesink, "run xevent thread, expose %d, events %d",
           ximagesink->handle_expose, ximagesink->handle_events);
       ximagesink->running = TRUE;
+      gst_poll_set_flushing (ximagesink->event_poll, FALSE);
       ximagesink->event_thread = g_thread_try_new ("ximagesink-events",
           (GThreadFunc) gst_ximagesink_event_thread, ximagesink, NULL);
     }
@@ -748,6 +783,7 @@ gst_ximagesink_manage_event_thread (GstXImageSink * ximagesink)
       GST_DEBUG_OBJECT (ximagesink, "stop xevent thread, expose %d, events %d",
           ximagesink->handle_expose, ximagesink->handle_events);
       ximagesink->running = FALSE;
+      gst_poll_set_flushing (ximagesink->event_poll, TRUE);
       /* grab thread and mark it as NULL */
       thread = ximagesink->event_thread;
       ximagesink->event_thread = NULL;
@@ -1243,12 +1279,15 @@ gst_ximagesink_change_state (GstElement * element, GstStateChange transition)
       gst_ximagesink_manage_event_thread (ximagesink);
       break;
     case GST_STATE_CHANGE_READY_TO_PAUSED:
+      ximagesink->last_vblank_slot = G_MAXUINT64;
       g_mutex_lock (&ximagesink->flow_lock);
       if (ximagesink->xwindow)
         gst_ximagesink_xwindow_clear (ximagesink, ximagesink->xwindow);
       g_mutex_unlock (&ximagesink->flow_lock);
       break;
     case GST_STATE_CHANGE_PAUSED_TO_PLAYING:
+      /* the base_time changes, start a new refresh grid */
+      ximagesink->last_vblank_slot = G_MAXUINT64;
       break;
     default:
       break;
@@ -1302,6 +1341,72 @@ gst_ximagesink_get_times (GstBaseSink * bsink, GstBuffer * buf,
   }
 }
 
+/* With a refresh-rate configured, check if @buf can still be scanned out
+ * before it gets replaced. The refresh grid is aligned to running time 0 as
+ * we don't get vblank timestamps from the X server. */
+static gboolean
+gst_ximagesink_frame_is_visible (GstXImageSink * ximagesink, GstBuffer * buf)
+{
+  GstBaseSink *bsink = GST_BASE_SINK (ximagesink);
+  GstClock *clock;
+  GstClockTime now, base_time, period, next_vblank;
+  GstClockTime start = GST_CLOCK_TIME_NONE, stop = GST_CLOCK_TIME_NONE;
+  guint64 slot;
+
+  if (ximagesink->refresh_n <= 0 || !gst_base_sink_get_sync (bsink))
+    return TRUE;
+
+  GST_OBJECT_LOCK (ximagesink);
+  /* always show the preroll frame */
+  if (GST_STATE (ximagesink) != GST_STATE_PLAYING ||
+      (clock = GST_ELEMENT_CLOCK (ximagesink)) == NULL) {
+    GST_OBJECT_UNLOCK (ximagesink);
+    return TRUE;
+  }
+  gst_object_ref (clock);
+  base_time = GST_ELEMENT_CAST (ximagesink)->base_time;
+  GST_OBJECT_UNLOCK (ximagesink);
+
+  now = gst_clock_get_time (clock);
+  gst_object_unref (clock);
+
+  if (now < base_time)
+    return TRUE;
+  now -= base_time;
+
+  period = gst_util_uint64_scale_int (GST_SECOND, ximagesink->refresh_d,
+      ximagesink->refresh_n);
+  slot = now / period;
+  next_vblank = (slot + 1) * period;
+
+  /* we already put a frame during this refresh, this one would overwrite it
+   * before it was ever shown */
+  if (slot == ximagesink->last_vblank_slot) {
+    GST_LOG_OBJECT (ximagesink, "dropping frame, already put one for vblank "
+        "%" G_GUINT64_FORMAT, slot);
+    return FALSE;
+  }
+
+  /* the frame ends before the next refresh, the next frame is due first */
+  gst_ximagesink_get_times (bsink, buf, &start, &stop);
+  if (GST_CLOCK_TIME_IS_VALID (stop)) {
+    stop = gst_segment_to_running_time (&bsink->segment, GST_FORMAT_TIME, stop);
+    if (GST_CLOCK_TIME_IS_VALID (stop)) {
+      stop += gst_base_sink_get_latency (bsink) +
+          gst_base_sink_get_render_delay (bsink);
+      if (stop <= next_vblank) {
+        GST_LOG_OBJECT (ximagesink, "dropping frame, it ends %" GST_TIME_FORMAT
+            " before the next vblank", GST_TIME_ARGS (next_vblank - stop));
+        return FALSE;
+      }
+    }
+  }
+
+  ximagesink->last_vblank_slot = slot;
+
+  return TRUE;
+}
+
 static GstFlowReturn
 gst_ximagesink_show_frame (GstVideoSink * vsink, GstBuffer * buf)
 {
@@ -1312,6 +1417,10 @@ gst_ximagesink_show_frame (GstVideoSink * vsink, GstBuffer * buf)
 
   ximagesink = GST_XIMAGESINK (vsink);
 
+  /* drop frames that would miss the screen before doing any copies or puts */
+  if (!gst_ximagesink_frame_is_visible (ximagesink, buf))
+    return GST_FLOW_OK;
+
   if (gst_buffer_n_memory (buf) == 1
       && (mem = (GstXImageMemory *) gst_buffer_peek_memory (buf, 0))
       && g_strcmp0 (mem->parent.allocator->mem_type, "ximage") == 0
@@ -1760,6 +1869,11 @@ gst_ximagesink_set_property (GObject * object, guint prop_id,
       ximagesink->handle_expose = g_value_get_boolean (value);
       gst_ximagesink_manage_event_thread (ximagesink);
       break;
+    case PROP_REFRESH_RATE:
+      ximagesink->refresh_n = gst_value_get_fraction_numerator (value);
+      ximagesink->refresh_d = gst_value_get_fraction_denominator (value);
+      ximagesink->last_vblank_slot = G_MAXUINT64;
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1808,6 +1922,10 @@ gst_ximagesink_get_property (GObject * object, guint prop_id,
       else
         g_value_set_uint64 (value, 0);
       break;
+    case PROP_REFRESH_RATE:
+      gst_value_set_fraction (value, ximagesink->refresh_n,
+          ximagesink->refresh_d);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1821,6 +1939,7 @@ gst_ximagesink_reset (GstXImageSink * ximagesink)
 
   GST_OBJECT_LOCK (ximagesink);
   ximagesink->running = FALSE;
+  gst_poll_set_flushing (ximagesink->event_poll, TRUE);
   /* grab thread and mark it as NULL */
   thread = ximagesink->event_thread;
   ximagesink->event_thread = NULL;
@@ -1871,6 +1990,7 @@ gst_ximagesink_finalize (GObject * object)
   }
   g_mutex_clear (&ximagesink->x_lock);
   g_mutex_clear (&ximagesink->flow_lock);
+  gst_poll_free (ximagesink->event_poll);
 
   g_free (ximagesink->media_title);
 
@@ -1887,6 +2007,12 @@ gst_ximagesink_init (GstXImageSink * ximagesink)
 
   ximagesink->event_thread = NULL;
   ximagesink->running = FALSE;
+  ximagesink->event_poll = gst_poll_new (TRUE);
+  ximagesink->event_wakeup = 0;
+
+  ximagesink->refresh_n = 0;
+  ximagesink->refresh_d = 1;
+  ximagesink->last_vblank_slot = G_MAXUINT64;
 
   ximagesink->fps_n = 0;
   ximagesink->fps_d = 1;
@@ -1972,6 +2098,21 @@ gst_ximagesink_class_init (GstXImageSinkClass * klass)
           "Height of the window", 0, G_MAXUINT64, 0,
           G_PARAM_READABLE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstXImageSink:refresh-rate
+   *
+   * The refresh rate of the display. When set, frames that would be replaced
+   * by the next frame before the display refreshes are dropped before they
+   * are copied and put. 0/1 disables the frame pacing.
+   *
+   * Since: 1.2
+   */
+  g_object_class_install_property (gobject_class, PROP_REFRESH_RATE,
+      gst_param_spec_fraction ("refresh-rate", "Refresh rate",
+          "The refresh rate of the display used to pace frames, 0/1 to put "
+          "all frames", 0, 1, 1000, 1, 0, 1,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_set_static_metadata (gstelement_class,
       "Video sink", "Sink/Video",
       "A standard X based videosink", "Julien Moutte <julien@moutte.net>");
@@ -142,6 +142,8 @@ struct _GstXWindow
  * is used when Expose events are received to redraw the latest video frame
  * @event_thread: a thread listening for events on @xwindow and handling them
  * @running: used to inform @event_thread if it should run/shutdown
+ * @event_poll: used by @event_thread to wait for data on the X connection
+ * @event_wakeup: set when a wakeup for @event_thread is pending on @event_poll
  * @fps_n: the framerate fraction numerator
  * @fps_d: the framerate fraction denominator
  * @x_lock: used to protect X calls as we are not using the XLib in threaded
@@ -157,6 +159,9 @@ struct _GstXWindow
  * @keep_aspect: used to remember if reverse negotiation scaling should respect
  * aspect ratio
  * @handle_events: used to know if we should handle select XEvents or not
+ * @refresh_n: the display refresh rate numerator, 0 disables frame pacing
+ * @refresh_d: the display refresh rate denominator
+ * @last_vblank_slot: the refresh period the last frame was put in
  *
  * The #GstXImageSink data structure.
  */
@@ -173,6 +178,8 @@ struct _GstXImageSink
 
   GThread *event_thread;
   gboolean running;
+  GstPoll *event_poll;
+  gint event_wakeup;
 
   GstVideoInfo info;
 
@@ -195,6 +202,11 @@ struct _GstXImageSink
   gboolean handle_expose;
   gboolean draw_border;
 
+  /* frame pacing */
+  gint refresh_n;
+  gint refresh_d;
+  guint64 last_vblank_slot;
+
   /* stream metadata */
   gchar *media_title;
 };
@@ -110,6 +110,8 @@ struct _GstXvImageFormat
  * @heightmm ratio
  * @use_xshm: used to known wether of not XShm extension is usable or not even
  * if the Extension is present
+ * @shm_completion_type: the event type of XShm completion events, sent when
+ * the X server is done reading an image that was put with XShm
  * @xv_port_id: the XVideo port ID
  * @im_format: used to store at least a valid format for XShm calls checks
  * @formats_list: list of supported image formats on @xv_port_id
@@ -145,6 +147,7 @@ struct _GstXvContext
   GValue *par;                  /* calculated pixel aspect ratio */
 
   gboolean use_xshm;
+  gint shm_completion_type;
 
   XvPortID xv_port_id;
   guint nb_adaptors;
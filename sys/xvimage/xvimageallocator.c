@@ -608,12 +608,16 @@ gst_xwindow_draw_borders (GstXWindow * window, GstVideoRectangle * rect)
   }
 }
 
-void
+/* Returns TRUE if the image was put with XShm. The X server then still reads
+ * from the image after this returns, and sends an XShm completion event to
+ * signal when it is done. */
+gboolean
 gst_xvimage_memory_render (GstXvImageMemory * mem, GstVideoRectangle * src_crop,
     GstXWindow * window, GstVideoRectangle * dst_crop, gboolean draw_border)
 {
   GstXvContext *context;
   XvImage *xvimage;
+  gboolean shm = FALSE;
 
   context = window->context;
 
@@ -634,7 +638,11 @@ gst_xvimage_memory_render (GstXvImageMemory * mem, GstVideoRectangle * src_crop,
         window->win,
         window->gc, xvimage,
         src_crop->x, src_crop->y, src_crop->w, src_crop->h,
-        dst_crop->x, dst_crop->y, dst_crop->w, dst_crop->h, FALSE);
+        dst_crop->x, dst_crop->y, dst_crop->w, dst_crop->h, TRUE);
+    /* don't wait for the server, the caller keeps the image alive until
+     * the completion event arrives */
+    XFlush (context->disp);
+    shm = TRUE;
   } else
 #endif /* HAVE_XSHM */
   {
@@ -644,8 +652,10 @@ gst_xvimage_memory_render (GstXvImageMemory * mem, GstVideoRectangle * src_crop,
         window->gc, xvimage,
         src_crop->x, src_crop->y, src_crop->w, src_crop->h,
         dst_crop->x, dst_crop->y, dst_crop->w, dst_crop->h);
+    XSync (context->disp, FALSE);
   }
-  XSync (context->disp, FALSE);
 
   g_mutex_unlock (&context->lock);
+
+  return shm;
 }
@@ -58,7 +58,7 @@ XvImage *             gst_xvimage_memory_get_xvimage    (GstXvImageMemory *mem);
 gboolean              gst_xvimage_memory_get_crop       (GstXvImageMemory *mem,
                                                          GstVideoRectangle *crop);
 
-void                  gst_xvimage_memory_render         (GstXvImageMemory *mem,
+gboolean              gst_xvimage_memory_render         (GstXvImageMemory *mem,
                                                          GstVideoRectangle *src_crop,
                                                          GstXWindow *window,
                                                          GstVideoRectangle *dst_crop,
@@ -118,7 +118,7 @@ xvimage_buffer_pool_set_config (GstBufferPool * pool, GstStructure * config)
     gst_buffer_pool_config_get_video_alignment (config, &priv->align);
 
     GST_LOG_OBJECT (pool, "padding %u-%ux%u-%u", priv->align.padding_top,
-        priv->align.padding_left, priv->align.padding_left,
+        priv->align.padding_left, priv->align.padding_right,
         priv->align.padding_bottom);
 
     /* do padding and alignment */
@@ -171,6 +171,57 @@ unknown_format:
   }
 }
 
+/* The X server picks the pitches and plane offsets of an XvImage, they don't
+ * necessarily match what GstVideoInfo calculated. Describe the actual layout
+ * so that upstream can write into the image directly, with the visible area
+ * starting after the padding that was asked for with the alignment. */
+static void
+xvimage_buffer_pool_get_layout (GstXvImageBufferPool * xvpool,
+    GstXvImageMemory * mem, gsize offset[GST_VIDEO_MAX_PLANES],
+    gint stride[GST_VIDEO_MAX_PLANES])
+{
+  GstXvImageBufferPoolPrivate *priv = xvpool->priv;
+  const GstVideoFormatInfo *finfo = priv->info.finfo;
+  XvImage *xvimage;
+  guint plane, comp, n_planes;
+
+  n_planes = GST_VIDEO_INFO_N_PLANES (&priv->info);
+  xvimage = gst_xvimage_memory_get_xvimage (mem);
+
+  if (xvimage->num_planes != n_planes) {
+    GST_WARNING_OBJECT (xvpool, "XvImage has %d planes, expected %u",
+        xvimage->num_planes, n_planes);
+    for (plane = 0; plane < n_planes; plane++) {
+      offset[plane] = priv->info.offset[plane];
+      stride[plane] = priv->info.stride[plane];
+    }
+    return;
+  }
+
+  for (plane = 0; plane < n_planes; plane++) {
+    offset[plane] = xvimage->offsets[plane];
+    stride[plane] = xvimage->pitches[plane];
+
+    if (priv->align.stride_align[plane] & stride[plane])
+      GST_WARNING_OBJECT (xvpool, "pitch %d of plane %u doesn't have the "
+          "requested alignment %u", stride[plane], plane,
+          priv->align.stride_align[plane] + 1);
+
+    /* skip the padding, using the first component in this plane */
+    for (comp = 0; comp < GST_VIDEO_FORMAT_INFO_N_COMPONENTS (finfo); comp++) {
+      if (GST_VIDEO_FORMAT_INFO_PLANE (finfo, comp) != plane)
+        continue;
+
+      offset[plane] += GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (finfo, comp,
+          priv->align.padding_top) * stride[plane];
+      offset[plane] += GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (finfo, comp,
+          priv->align.padding_left) * GST_VIDEO_FORMAT_INFO_PSTRIDE (finfo,
+          comp);
+      break;
+    }
+  }
+}
+
 /* This function handles GstXImageBuffer creation depending on XShm availability */
 static GstFlowReturn
 xvimage_buffer_pool_alloc (GstBufferPool * pool, GstBuffer ** buffer,
@@ -196,11 +247,17 @@ xvimage_buffer_pool_alloc (GstBufferPool * pool, GstBuffer ** buffer,
   gst_buffer_append_memory (xvimage, mem);
 
   if (priv->add_metavideo) {
+    gsize offset[GST_VIDEO_MAX_PLANES];
+    gint stride[GST_VIDEO_MAX_PLANES];
+
+    xvimage_buffer_pool_get_layout (xvpool, (GstXvImageMemory *) mem, offset,
+        stride);
+
     GST_DEBUG_OBJECT (pool, "adding GstVideoMeta");
     gst_buffer_add_video_meta_full (xvimage, GST_VIDEO_FRAME_FLAG_NONE,
         GST_VIDEO_INFO_FORMAT (info), GST_VIDEO_INFO_WIDTH (info),
         GST_VIDEO_INFO_HEIGHT (info), GST_VIDEO_INFO_N_PLANES (info),
-        info->offset, info->stride);
+        offset, stride);
   }
 
   *buffer = xvimage;
@@ -222,6 +222,75 @@ G_DEFINE_TYPE_WITH_CODE (GstXvImageSink, gst_xvimagesink, GST_TYPE_VIDEO_SINK,
 
 /* This function puts a GstXvImage on a GstXvImageSink's window. Returns FALSE
  * if no window was available  */
+/* how many images may be waiting for their XShm completion before we wait
+ * for the X server to catch up */
+#define MAX_PENDING_IMAGES 3
+
+/* called with the flow_lock and the context lock */
+static void
+gst_xvimagesink_handle_shm_completion (GstXvImageSink * xvimagesink)
+{
+  GstBuffer *done;
+
+  /* the X server processes our puts in order, so this is the oldest one */
+  done = g_queue_pop_head (&xvimagesink->pending_images);
+  if (done) {
+    GST_LOG_OBJECT (xvimagesink, "X server done with %p", done);
+    gst_buffer_unref (done);
+  }
+}
+
+/* release the images the X server is done with, called with the flow_lock */
+static void
+gst_xvimagesink_reap_pending_images (GstXvImageSink * xvimagesink)
+{
+  GstXvContext *context = xvimagesink->context;
+  XEvent e;
+
+  if (g_queue_is_empty (&xvimagesink->pending_images))
+    return;
+
+  g_mutex_lock (&context->lock);
+  if (g_queue_get_length (&xvimagesink->pending_images) >= MAX_PENDING_IMAGES) {
+    /* the server is falling behind, wait for it so we don't queue up more
+     * and more images */
+    GST_LOG_OBJECT (xvimagesink, "waiting for the X server");
+    XSync (context->disp, FALSE);
+  }
+  while (XCheckTypedEvent (context->disp, context->shm_completion_type, &e))
+    gst_xvimagesink_handle_shm_completion (xvimagesink);
+  g_mutex_unlock (&context->lock);
+}
+
+/* called with the flow_lock */
+static void
+gst_xvimagesink_clear_pending_images (GstXvImageSink * xvimagesink)
+{
+  GstBuffer *buf;
+
+  while ((buf = g_queue_pop_head (&xvimagesink->pending_images)))
+    gst_buffer_unref (buf);
+}
+
+/* XSync and friends read the events the server sent into the Xlib queue,
+ * after which they no longer make the connection readable. Wake up the event
+ * thread when that happened so it does not sleep on them until its timeout.
+ * Called with the flow_lock */
+static void
+gst_xvimagesink_wake_event_thread (GstXvImageSink * xvimagesink)
+{
+  GstXvContext *context = xvimagesink->context;
+  gint queued;
+
+  g_mutex_lock (&context->lock);
+  queued = XEventsQueued (context->disp, QueuedAlready);
+  g_mutex_unlock (&context->lock);
+
+  if (queued > 0 &&
+      g_atomic_int_compare_and_exchange (&xvimagesink->event_wakeup, 0, 1))
+    gst_poll_write_control (xvimagesink->event_poll);
+}
+
 static gboolean
 gst_xvimagesink_xvimage_put (GstXvImageSink * xvimagesink, GstBuffer * xvimage)
 {
@@ -304,7 +373,14 @@ gst_xvimagesink_xvimage_put (GstXvImageSink * xvimagesink, GstBuffer * xvimage)
     memcpy (&result, &xwindow->render_rect, sizeof (GstVideoRectangle));
   }
 
-  gst_xvimage_memory_render (mem, &src, xwindow, &result, draw_border);
+  gst_xvimagesink_reap_pending_images (xvimagesink);
+
+  /* with XShm the X server reads from the image after this returns, keep it
+   * from being reused until the server tells us it is done with it */
+  if (gst_xvimage_memory_render (mem, &src, xwindow, &result, draw_border))
+    g_queue_push_tail (&xvimagesink->pending_images, gst_buffer_ref (xvimage));
+
+  gst_xvimagesink_wake_event_thread (xvimagesink);
 
   g_mutex_unlock (&xvimagesink->flow_lock);
 
@@ -558,6 +634,9 @@ gst_xvimagesink_handle_xevents (GstXvImageSink * xvimagesink)
         break;
       }
       default:
+        if (e.type == xvimagesink->context->shm_completion_type &&
+            xvimagesink->context->use_xshm)
+          gst_xvimagesink_handle_shm_completion (xvimagesink);
         break;
     }
   }
@@ -569,22 +648,44 @@ gst_xvimagesink_handle_xevents (GstXvImageSink * xvimagesink)
 static gpointer
 gst_xvimagesink_event_thread (GstXvImageSink * xvimagesink)
 {
+  GstXvContext *context;
+  GstPollFD fd = GST_POLL_FD_INIT;
+
   g_return_val_if_fail (GST_IS_XVIMAGESINK (xvimagesink), NULL);
 
+  context = xvimagesink->context;
+
+  /* sleep until the X server sends us something instead of polling */
+  fd.fd = ConnectionNumber (context->disp);
+  gst_poll_add_fd (xvimagesink->event_poll, &fd);
+  gst_poll_fd_ctl_read (xvimagesink->event_poll, &fd, TRUE);
+
   GST_OBJECT_LOCK (xvimagesink);
   while (xvimagesink->running) {
     GST_OBJECT_UNLOCK (xvimagesink);
 
     if (xvimagesink->xwindow) {
       gst_xvimagesink_handle_xevents (xvimagesink);
+    } else {
+      /* read the pending data so that the connection doesn't stay readable */
+      g_mutex_lock (&context->lock);
+      XPending (context->disp);
+      g_mutex_unlock (&context->lock);
     }
-    /* FIXME: do we want to align this with the framerate or anything else? */
-    g_usleep (G_USEC_PER_SEC / 20);
+
+    /* events can also end up in the Xlib queue through X calls made by
+     * others without waking us up, the timeout makes sure they are handled
+     * eventually */
+    gst_poll_wait (xvimagesink->event_poll, GST_SECOND);
+    if (g_atomic_int_compare_and_exchange (&xvimagesink->event_wakeup, 1, 0))
+      gst_poll_read_control (xvimagesink->event_poll);
 
     GST_OBJECT_LOCK (xvimagesink);
   }
   GST_OBJECT_UNLOCK (xvimagesink);
 
+  gst_poll_remove_fd (xvimagesink->event_poll, &fd);
+
   return NULL;
 }
 
@@ -605,6 +706,7 @@ gst_xvimagesink_manage_event_thread (GstXvImageSink * xvimagesink)
       GST_DEBUG_OBJECT (xvimagesink, "run xevent thread, expose %d, events %d",
           xvimagesink->handle_expose, xvimagesink->handle_events);
       xvimagesink->running = TRUE;
+      gst_poll_set_flushing (xvimagesink->event_poll, FALSE);
       xvimagesink->event_thread = g_thread_try_new ("xvimagesink-events",
           (GThreadFunc) gst_xvimagesink_event_thread, xvimagesink, NULL);
     }
@@ -613,6 +715,7 @@ gst_xvimagesink_manage_event_thread (GstXvImageSink * xvimagesink)
       GST_DEBUG_OBJECT (xvimagesink, "stop xevent thread, expose %d, events %d",
           xvimagesink->handle_expose, xvimagesink->handle_events);
       xvimagesink->running = FALSE;
+      gst_poll_set_flushing (xvimagesink->event_poll, TRUE);
       /* grab thread and mark it as NULL */
       thread = xvimagesink->event_thread;
       xvimagesink->event_thread = NULL;
@@ -1089,8 +1192,9 @@ gst_xvimagesink_propose_allocation (GstBaseSink * bsink, GstQuery * query)
       goto config_failed;
   }
   if (pool) {
-    /* we need at least 2 buffer because we hold on to the last one */
-    gst_query_add_allocation_pool (query, pool, size, 2, 0);
+    /* we hold on to the last one and to the ones the X server may still be
+     * reading from, so ask for enough buffers to keep upstream going */
+    gst_query_add_allocation_pool (query, pool, size, MAX_PENDING_IMAGES, 0);
     gst_object_unref (pool);
   }
 
@@ -1772,6 +1876,7 @@ gst_xvimagesink_close (GstXvImageSink * xvimagesink)
 
   GST_OBJECT_LOCK (xvimagesink);
   xvimagesink->running = FALSE;
+  gst_poll_set_flushing (xvimagesink->event_poll, TRUE);
   /* grab thread and mark it as NULL */
   thread = xvimagesink->event_thread;
   xvimagesink->event_thread = NULL;
@@ -1788,6 +1893,8 @@ gst_xvimagesink_close (GstXvImageSink * xvimagesink)
 
   g_mutex_lock (&xvimagesink->flow_lock);
 
+  gst_xvimagesink_clear_pending_images (xvimagesink);
+
   if (xvimagesink->pool) {
     gst_object_unref (xvimagesink->pool);
     xvimagesink->pool = NULL;
@@ -1834,6 +1941,7 @@ gst_xvimagesink_finalize (GObject * object)
     xvimagesink->par = NULL;
   }
   g_mutex_clear (&xvimagesink->flow_lock);
+  gst_poll_free (xvimagesink->event_poll);
   g_free (xvimagesink->media_title);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
@@ -1857,6 +1965,7 @@ gst_xvimagesink_init (GstXvImageSink * xvimagesink)
   xvimagesink->context = NULL;
   xvimagesink->xwindow = NULL;
   xvimagesink->cur_image = NULL;
+  g_queue_init (&xvimagesink->pending_images);
 
   xvimagesink->fps_n = 0;
   xvimagesink->fps_d = 0;
@@ -1864,6 +1973,8 @@ gst_xvimagesink_init (GstXvImageSink * xvimagesink)
   xvimagesink->video_height = 0;
 
   g_mutex_init (&xvimagesink->flow_lock);
+  xvimagesink->event_poll = gst_poll_new (TRUE);
+  xvimagesink->event_wakeup = 0;
 
   xvimagesink->pool = NULL;
 
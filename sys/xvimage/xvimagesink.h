@@ -51,8 +51,12 @@ typedef struct _GstXvImageSinkClass GstXvImageSinkClass;
  * @xwindow: the #GstXWindow we are rendering to
  * @cur_image: a reference to the last #GstXvImage that was put to @xwindow. It
  * is used when Expose events are received to redraw the latest video frame
+ * @pending_images: references to the images put with XShm that the X server
+ * did not send a completion event for yet, oldest first
  * @event_thread: a thread listening for events on @xwindow and handling them
  * @running: used to inform @event_thread if it should run/shutdown
+ * @event_poll: used by @event_thread to wait for data on the X connection
+ * @event_wakeup: set when a wakeup for @event_thread is pending on @event_poll
  * @fps_n: the framerate fraction numerator
  * @fps_d: the framerate fraction denominator
  * @x_lock: used to protect X calls as we are not using the XLib in threaded
@@ -88,9 +92,12 @@ struct _GstXvImageSink
   GstXvImageAllocator *allocator;
   GstXWindow *xwindow;
   GstBuffer *cur_image;
+  GQueue pending_images;
 
   GThread *event_thread;
   gboolean running;
+  GstPoll *event_poll;
+  gint event_wakeup;
 
   GstVideoInfo info;
 
@@ -0,0 +1,84 @@
+/* GStreamer
+ *
+ * benchmark.h: timing and reporting shared by the benchmarks
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __BENCHMARK_H__
+#define __BENCHMARK_H__
+
+#include <stdio.h>
+#include <glib.h>
+
+/* Every benchmark prints one line per measurement in this CSV layout, so
+ * that the results of different runs and releases can be compared with
+ * simple scripts. @value is the cost of one unit, e.g. "ns/pixel". */
+#define BENCHMARK_HEADER "suite,name,params,iterations,value,unit"
+
+/* minimum time each measurement runs for */
+#define BENCHMARK_MIN_TIME (200 * G_TIME_SPAN_MILLISECOND)
+
+typedef void (*BenchmarkFunc) (gpointer data);
+
+static inline void
+benchmark_header (void)
+{
+  printf ("%s\n", BENCHMARK_HEADER);
+  fflush (stdout);
+}
+
+static inline void
+benchmark_report (const gchar * suite, const gchar * name,
+    const gchar * params, guint64 iterations, gdouble value,
+    const gchar * unit)
+{
+  printf ("%s,%s,%s,%" G_GUINT64_FORMAT ",%.4f,%s\n", suite, name, params,
+      iterations, value, unit);
+  fflush (stdout);
+}
+
+/* Runs @func until at least BENCHMARK_MIN_TIME passed, after one warm-up
+ * call, and reports the time per @unit when each call processes
+ * @units_per_call of them */
+static inline void
+benchmark_run (const gchar * suite, const gchar * name, const gchar * params,
+    const gchar * unit, guint64 units_per_call, BenchmarkFunc func,
+    gpointer data)
+{
+  gchar *ns_unit;
+  gint64 start, elapsed;
+  guint64 i, iterations = 0;
+  guint64 batch = 1;
+
+  func (data);
+
+  start = g_get_monotonic_time ();
+  do {
+    for (i = 0; i < batch; i++)
+      func (data);
+    iterations += batch;
+    batch *= 2;
+    elapsed = g_get_monotonic_time () - start;
+  } while (elapsed < BENCHMARK_MIN_TIME);
+
+  ns_unit = g_strdup_printf ("ns/%s", unit);
+  benchmark_report (suite, name, params, iterations,
+      (elapsed * 1000.0) / ((gdouble) iterations * units_per_call), ns_unit);
+  g_free (ns_unit);
+}
+
+#endif /* __BENCHMARK_H__ */
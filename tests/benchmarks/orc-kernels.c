@@ -0,0 +1,98 @@
+/* GStreamer
+ *
+ * orc-kernels.c: throughput of the ORC kernels of the project
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+
+/* Usage: orc-kernels FILE.orc...
+ *
+ * Parses the given .orc sources and measures every kernel in them with the
+ * default ORC target and, as a reference, with the ORC emulator. Results
+ * are printed as CSV, see benchmark.h. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+
+#include <orc/orc.h>
+#include <orc-test/orctest.h>
+
+#include "benchmark.h"
+
+static void
+benchmark_orc_file (const gchar * filename)
+{
+  OrcProgram **programs = NULL;
+  OrcTarget *target;
+  gchar *code, *basename;
+  GError *err = NULL;
+  gint i, n;
+
+  if (!g_file_get_contents (filename, &code, NULL, &err)) {
+    g_printerr ("could not read %s: %s\n", filename, err->message);
+    g_error_free (err);
+    return;
+  }
+
+  basename = g_path_get_basename (filename);
+  target = orc_target_get_default ();
+
+  n = orc_parse (code, &programs);
+  for (i = 0; i < n; i++) {
+    OrcProgram *p = programs[i];
+    gchar *name;
+    gdouble cycles;
+
+    name = g_strdup_printf ("%s:%s", basename, orc_program_get_name (p));
+
+    /* orc reports cycles, or the time in ns when it has no cycle counter */
+    cycles = orc_test_performance_full (p, 0, NULL);
+    benchmark_report ("orc", name, orc_target_get_name (target), 1, cycles,
+        "cycles/element");
+
+    cycles = orc_test_performance_full (p, ORC_TEST_FLAGS_EMULATE, NULL);
+    benchmark_report ("orc", name, "emulate", 1, cycles, "cycles/element");
+
+    g_free (name);
+    orc_program_free (p);
+  }
+
+  free (programs);
+  g_free (basename);
+  g_free (code);
+}
+
+int
+main (int argc, char **argv)
+{
+  gint i;
+
+  orc_test_init ();
+
+  if (argc < 2) {
+    g_printerr ("usage: %s FILE.orc...\n", argv[0]);
+    return 1;
+  }
+
+  benchmark_header ();
+
+  for (i = 1; i < argc; i++)
+    benchmark_orc_file (argv[i]);
+
+  return 0;
+}
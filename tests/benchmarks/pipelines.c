@@ -0,0 +1,224 @@
+/* GStreamer
+ *
+ * pipelines.c: throughput of representative pipelines
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+
+/* Runs each of the pipelines below for a fixed time and reports the
+ * buffers per second that arrive in the sink, the CPU time used per second
+ * and the peak resident memory. Every pipeline runs in its own process so
+ * that the memory numbers don't add up. Pipelines with elements that are
+ * not available are skipped. Results are printed as CSV, see benchmark.h;
+ * run with --help for the options. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include <gst/gst.h>
+
+#include "benchmark.h"
+
+static const struct
+{
+  const gchar *name;
+  const gchar *launch;
+} pipelines[] = {
+  {
+  "video-convert-scale",
+        "videotestsrc ! video/x-raw,format=I420,width=1280,height=720 ! "
+        "videoconvert ! video/x-raw,format=BGRx ! videoscale ! "
+        "video/x-raw,width=640,height=360 ! fakesink name=sink"}, {
+  "audio-convert-resample",
+        "audiotestsrc ! audio/x-raw,format=S16LE,rate=48000,channels=2 ! "
+        "audioconvert ! audio/x-raw,format=F32LE ! audioresample ! "
+        "audio/x-raw,rate=44100 ! fakesink name=sink"}, {
+  "theora-encode",
+        "videotestsrc ! video/x-raw,width=640,height=480 ! theoraenc ! "
+        "fakesink name=sink"}, {
+  "theora-decode",
+        "videotestsrc ! video/x-raw,width=640,height=480 ! theoraenc ! "
+        "theoradec ! fakesink name=sink"}, {
+  "vorbis-encode",
+        "audiotestsrc ! audioconvert ! vorbisenc ! fakesink name=sink"}, {
+  "vorbis-decode",
+        "audiotestsrc ! audioconvert ! vorbisenc ! vorbisdec ! "
+        "fakesink name=sink"}, {
+  "ogg-mux-demux",
+        "videotestsrc ! video/x-raw,width=320,height=240 ! theoraenc ! "
+        "oggmux ! oggdemux ! theoradec ! fakesink name=sink"}
+};
+
+static gint opt_duration = 5;
+static gchar *opt_pipeline = NULL;
+
+static GOptionEntry entries[] = {
+  {"duration", 'd', 0, G_OPTION_ARG_INT, &opt_duration,
+      "Seconds to run each pipeline for", "S"},
+  {"pipeline", 'p', 0, G_OPTION_ARG_STRING, &opt_pipeline,
+      "Only run this pipeline, in this process", "NAME"},
+  {NULL}
+};
+
+static GstPadProbeReturn
+count_buffer (GstPad * pad, GstPadProbeInfo * info, guint64 * count)
+{
+  if (GST_PAD_PROBE_INFO_TYPE (info) & GST_PAD_PROBE_TYPE_BUFFER_LIST)
+    *count += gst_buffer_list_length (GST_PAD_PROBE_INFO_BUFFER_LIST (info));
+  else
+    *count += 1;
+
+  return GST_PAD_PROBE_OK;
+}
+
+static gdouble
+cpu_time (const struct rusage *usage)
+{
+  return usage->ru_utime.tv_sec + usage->ru_stime.tv_sec +
+      (usage->ru_utime.tv_usec + usage->ru_stime.tv_usec) / 1e6;
+}
+
+static gint
+run_pipeline (const gchar * name, const gchar * launch)
+{
+  GstElement *pipeline, *sink;
+  GstPad *pad;
+  GstBus *bus;
+  GstMessage *msg;
+  GError *err = NULL;
+  struct rusage before, after;
+  gint64 start;
+  guint64 count = 0, frames;
+  gdouble seconds;
+
+  pipeline = gst_parse_launch (launch, &err);
+  if (pipeline == NULL || err != NULL) {
+    g_printerr ("skipping %s: %s\n", name, err ? err->message : "");
+    g_clear_error (&err);
+    if (pipeline)
+      gst_object_unref (pipeline);
+    return 0;
+  }
+
+  sink = gst_bin_get_by_name (GST_BIN (pipeline), "sink");
+  g_object_set (sink, "sync", FALSE, NULL);
+  pad = gst_element_get_static_pad (sink, "sink");
+  gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_BUFFER |
+      GST_PAD_PROBE_TYPE_BUFFER_LIST, (GstPadProbeCallback) count_buffer,
+      &count, NULL);
+  gst_object_unref (pad);
+  gst_object_unref (sink);
+
+  bus = gst_element_get_bus (pipeline);
+
+  getrusage (RUSAGE_SELF, &before);
+  start = g_get_monotonic_time ();
+  gst_element_set_state (pipeline, GST_STATE_PLAYING);
+
+  msg = gst_bus_timed_pop_filtered (bus, opt_duration * GST_SECOND,
+      GST_MESSAGE_ERROR | GST_MESSAGE_EOS);
+
+  /* stop counting before shutting down */
+  seconds = (g_get_monotonic_time () - start) / 1e6;
+  frames = count;
+  getrusage (RUSAGE_SELF, &after);
+
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+
+  if (msg && GST_MESSAGE_TYPE (msg) == GST_MESSAGE_ERROR) {
+    gst_message_parse_error (msg, &err, NULL);
+    g_printerr ("%s failed: %s\n", name, err->message);
+    g_error_free (err);
+    gst_message_unref (msg);
+    gst_object_unref (bus);
+    gst_object_unref (pipeline);
+    return 1;
+  }
+  if (msg)
+    gst_message_unref (msg);
+
+  benchmark_report ("pipelines", name, "throughput", frames,
+      frames / seconds, "buffers/s");
+  benchmark_report ("pipelines", name, "cpu", frames,
+      (cpu_time (&after) - cpu_time (&before)) / seconds, "s/s");
+  /* ru_maxrss is in KiB on Linux */
+  benchmark_report ("pipelines", name, "peak-rss", frames,
+      after.ru_maxrss, "KiB");
+
+  gst_object_unref (bus);
+  gst_object_unref (pipeline);
+
+  return 0;
+}
+
+int
+main (int argc, char **argv)
+{
+  GOptionContext *ctx;
+  GError *err = NULL;
+  guint i;
+  gint ret = 0;
+
+  ctx = g_option_context_new ("- pipeline throughput");
+  g_option_context_add_main_entries (ctx, entries, NULL);
+  g_option_context_add_group (ctx, gst_init_get_option_group ());
+  if (!g_option_context_parse (ctx, &argc, &argv, &err)) {
+    g_printerr ("%s\n", err->message);
+    return 1;
+  }
+  g_option_context_free (ctx);
+
+  if (opt_pipeline) {
+    for (i = 0; i < G_N_ELEMENTS (pipelines); i++) {
+      if (g_str_equal (opt_pipeline, pipelines[i].name))
+        return run_pipeline (pipelines[i].name, pipelines[i].launch);
+    }
+    g_printerr ("unknown pipeline %s\n", opt_pipeline);
+    return 1;
+  }
+
+  benchmark_header ();
+
+  /* one process per pipeline, they print their own results */
+  for (i = 0; i < G_N_ELEMENTS (pipelines); i++) {
+    gchar *duration, *child_argv[6];
+    gint status;
+
+    duration = g_strdup_printf ("%d", opt_duration);
+    child_argv[0] = argv[0];
+    child_argv[1] = (gchar *) "--duration";
+    child_argv[2] = duration;
+    child_argv[3] = (gchar *) "--pipeline";
+    child_argv[4] = (gchar *) pipelines[i].name;
+    child_argv[5] = NULL;
+
+    if (!g_spawn_sync (NULL, child_argv, NULL, G_SPAWN_CHILD_INHERITS_STDIN,
+            NULL, NULL, NULL, NULL, &status, &err)) {
+      g_printerr ("could not run %s: %s\n", pipelines[i].name, err->message);
+      g_clear_error (&err);
+      ret = 1;
+    } else if (!g_spawn_check_exit_status (status, NULL)) {
+      ret = 1;
+    }
+    g_free (duration);
+  }
+
+  return ret;
+}
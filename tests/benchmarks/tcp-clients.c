@@ -0,0 +1,530 @@
+/* GStreamer
+ *
+ * tcp-clients.c: many clients on multisocketsink and multifdsink
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+
+/* Streams to thousands of local clients through multisocketsink or
+ * multifdsink. A part of the clients reads slowly, clients disconnect and
+ * new ones join all the time, and every sync-method is measured in turn.
+ * Reported are the delivered bandwidth, the CPU time per delivered Gbit,
+ * the time from adding a client until it receives its first byte, the
+ * memory used and how many clients the sink removed by itself. Results are
+ * printed as CSV, see benchmark.h; run with --help for the options. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include <gio/gio.h>
+#include <gst/gst.h>
+#include <gst/app/gstappsrc.h>
+
+#include "benchmark.h"
+
+/* clients are served and churned in ticks of this length */
+#define TICK            (10 * G_TIME_SPAN_MILLISECOND)
+/* most a fast client reads per tick */
+#define READ_MAX        (256 * 1024)
+
+static const gchar *sync_methods[] = {
+  "latest", "next-keyframe", "latest-keyframe", "burst", "burst-keyframe",
+  "burst-with-keyframe"
+};
+
+static gchar *opt_element = NULL;
+static gint opt_clients = 1000;
+static gint opt_duration = 10;
+static gint opt_slow = 10;
+static gint opt_slow_rate = 64;
+static gint opt_churn = 50;
+static gint opt_bitrate = 4000;
+static gint opt_buffer_size = 4096;
+static gint opt_keyframe = 30;
+static gint opt_buffers_max = 1000;
+static gchar *opt_burst = NULL;
+static gchar *opt_sync_method = NULL;
+
+static GOptionEntry entries[] = {
+  {"element", 'e', 0, G_OPTION_ARG_STRING, &opt_element,
+      "multisocketsink (default) or multifdsink", "NAME"},
+  {"clients", 'c', 0, G_OPTION_ARG_INT, &opt_clients,
+      "Number of connected clients", "N"},
+  {"duration", 'd', 0, G_OPTION_ARG_INT, &opt_duration,
+      "Seconds to run each sync-method for", "S"},
+  {"slow", 0, 0, G_OPTION_ARG_INT, &opt_slow,
+      "Percentage of slow clients", "P"},
+  {"slow-rate", 0, 0, G_OPTION_ARG_INT, &opt_slow_rate,
+      "KiB per second a slow client reads", "KIB"},
+  {"churn", 0, 0, G_OPTION_ARG_INT, &opt_churn,
+      "Clients that leave and join per second", "N"},
+  {"bitrate", 0, 0, G_OPTION_ARG_INT, &opt_bitrate,
+      "Bitrate of the stream in kbit/s, 0 for as fast as possible", "KBPS"},
+  {"buffer-size", 0, 0, G_OPTION_ARG_INT, &opt_buffer_size,
+      "Size of the streamed buffers", "BYTES"},
+  {"keyframe-interval", 0, 0, G_OPTION_ARG_INT, &opt_keyframe,
+      "A keyframe every N buffers", "N"},
+  {"buffers-max", 0, 0, G_OPTION_ARG_INT, &opt_buffers_max,
+      "Lag in buffers after which the sink removes a client", "N"},
+  {"burst", 0, 0, G_OPTION_ARG_STRING, &opt_burst,
+      "burst-format:burst-value for the burst sync-methods, "
+        "default bytes:65536", "FORMAT:VALUE"},
+  {"sync-method", 's', 0, G_OPTION_ARG_STRING, &opt_sync_method,
+      "Only measure this sync-method", "METHOD"},
+  {NULL}
+};
+
+typedef struct
+{
+  gint fd;                      /* our end */
+  GstPollFD pfd;
+  gint sink_fd;                 /* the end handed to the sink */
+  GSocket *socket;              /* for multisocketsink */
+  gboolean slow;
+  gboolean leaving;             /* removal requested by us */
+  gboolean joined;
+  gint64 added;
+  gint64 budget;                /* slow clients: bytes left for this tick */
+} Client;
+
+typedef struct
+{
+  GstElement *pipeline, *src, *sink;
+  gboolean use_fd;
+  GstPoll *poll;
+  GHashTable *clients;          /* sink fd -> Client */
+  GPtrArray *active;
+  GAsyncQueue *removed;         /* sink fds removed from the sink */
+
+  GThread *feeder;
+  volatile gint running;
+
+  guint64 bytes;
+  guint joins, forced;
+  GArray *latencies;            /* gdouble, ms */
+} Bench;
+
+static gint
+bench_client_fd (Bench * bench, gpointer handle)
+{
+  if (bench->use_fd)
+    return GPOINTER_TO_INT (handle);
+  return g_socket_get_fd (G_SOCKET (handle));
+}
+
+/* may be called from the streaming thread */
+static void
+on_client_removed (GstElement * sink, gpointer handle, Bench * bench)
+{
+  g_async_queue_push (bench->removed,
+      GINT_TO_POINTER (bench_client_fd (bench, handle) + 1));
+}
+
+static void
+bench_add_client (Bench * bench)
+{
+  Client *client;
+  gint fds[2];
+
+  if (socketpair (AF_UNIX, SOCK_STREAM, 0, fds) < 0) {
+    g_printerr ("socketpair failed: %s\n", g_strerror (errno));
+    return;
+  }
+  fcntl (fds[0], F_SETFL, fcntl (fds[0], F_GETFL) | O_NONBLOCK);
+
+  client = g_slice_new0 (Client);
+  client->fd = fds[0];
+  client->sink_fd = fds[1];
+  client->slow = g_random_int_range (0, 100) < opt_slow;
+  client->added = g_get_monotonic_time ();
+
+  gst_poll_fd_init (&client->pfd);
+  client->pfd.fd = client->fd;
+  gst_poll_add_fd (bench->poll, &client->pfd);
+  gst_poll_fd_ctl_read (bench->poll, &client->pfd, TRUE);
+
+  g_hash_table_insert (bench->clients, GINT_TO_POINTER (client->sink_fd),
+      client);
+  g_ptr_array_add (bench->active, client);
+
+  if (bench->use_fd) {
+    g_signal_emit_by_name (bench->sink, "add", client->sink_fd);
+  } else {
+    client->socket = g_socket_new_from_fd (client->sink_fd, NULL);
+    g_signal_emit_by_name (bench->sink, "add", client->socket);
+  }
+}
+
+/* called when the sink let go of the client */
+static void
+bench_free_client (Bench * bench, gint sink_fd)
+{
+  Client *client;
+
+  client = g_hash_table_lookup (bench->clients, GINT_TO_POINTER (sink_fd));
+  if (client == NULL)
+    return;
+
+  if (!client->leaving)
+    bench->forced++;
+
+  g_hash_table_remove (bench->clients, GINT_TO_POINTER (sink_fd));
+  g_ptr_array_remove_fast (bench->active, client);
+
+  gst_poll_remove_fd (bench->poll, &client->pfd);
+  close (client->fd);
+  if (client->socket)
+    g_object_unref (client->socket);
+  else
+    close (client->sink_fd);
+  g_slice_free (Client, client);
+}
+
+static void
+bench_remove_client (Bench * bench, Client * client)
+{
+  client->leaving = TRUE;
+  if (bench->use_fd)
+    g_signal_emit_by_name (bench->sink, "remove", client->sink_fd);
+  else
+    g_signal_emit_by_name (bench->sink, "remove", client->socket);
+}
+
+static void
+bench_read_client (Bench * bench, Client * client)
+{
+  static guint8 data[READ_MAX];
+  gint64 total = 0, max;
+  gssize n;
+
+  max = client->slow ? MIN (client->budget, READ_MAX) : READ_MAX;
+
+  while (total < max) {
+    n = read (client->fd, data, max - total);
+    if (n <= 0)
+      break;
+    total += n;
+  }
+
+  if (total > 0 && !client->joined) {
+    gdouble latency = (g_get_monotonic_time () - client->added) / 1000.0;
+
+    g_array_append_val (bench->latencies, latency);
+    client->joined = TRUE;
+    bench->joins++;
+  }
+
+  bench->bytes += total;
+  if (client->slow) {
+    client->budget -= total;
+    if (client->budget <= 0)
+      gst_poll_fd_ctl_read (bench->poll, &client->pfd, FALSE);
+  }
+}
+
+static gpointer
+bench_feed (Bench * bench)
+{
+  GstAppSrc *appsrc = GST_APP_SRC (bench->src);
+  gint64 start, due;
+  guint64 i;
+
+  start = g_get_monotonic_time ();
+  for (i = 0; g_atomic_int_get (&bench->running); i++) {
+    GstBuffer *buf;
+
+    buf = gst_buffer_new_allocate (NULL, opt_buffer_size, NULL);
+    gst_buffer_memset (buf, 0, 0x42, opt_buffer_size);
+    if (opt_keyframe > 0 && i % opt_keyframe != 0)
+      GST_BUFFER_FLAG_SET (buf, GST_BUFFER_FLAG_DELTA_UNIT);
+
+    if (gst_app_src_push_buffer (appsrc, buf) != GST_FLOW_OK)
+      break;
+
+    if (opt_bitrate > 0) {
+      due = start + (i + 1) * opt_buffer_size * 8 * 1000 / opt_bitrate;
+      if (due > g_get_monotonic_time ())
+        g_usleep (due - g_get_monotonic_time ());
+    }
+  }
+  gst_app_src_end_of_stream (appsrc);
+
+  return NULL;
+}
+
+static gdouble
+bench_cpu_time (void)
+{
+  struct rusage usage;
+
+  getrusage (RUSAGE_SELF, &usage);
+
+  return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+      (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+/* resident memory in KiB */
+static gdouble
+bench_memory (void)
+{
+  struct rusage usage;
+  gchar *contents;
+  gdouble rss = 0;
+
+  if (g_file_get_contents ("/proc/self/statm", &contents, NULL, NULL)) {
+    gchar **fields = g_strsplit (contents, " ", -1);
+
+    if (fields[0] && fields[1])
+      rss = g_ascii_strtod (fields[1], NULL) * sysconf (_SC_PAGESIZE) / 1024;
+    g_strfreev (fields);
+    g_free (contents);
+    return rss;
+  }
+
+  getrusage (RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+static gint
+compare_double (gconstpointer a, gconstpointer b)
+{
+  gdouble da = *(const gdouble *) a, db = *(const gdouble *) b;
+
+  return da < db ? -1 : (da > db ? 1 : 0);
+}
+
+static gdouble
+percentile (GArray * values, gdouble p)
+{
+  if (values->len == 0)
+    return 0.0;
+
+  return g_array_index (values, gdouble, (guint) ((values->len - 1) * p));
+}
+
+static void
+bench_run (const gchar * sync_method)
+{
+  Bench bench = { NULL, };
+  gchar **burst, *params;
+  gint64 start, end, now, last_tick;
+  gdouble cpu, mem_before, churn = 0.0, gbit;
+  GstBus *bus;
+  GstMessage *msg;
+  guint i;
+
+  bench.use_fd = g_str_equal (opt_element, "multifdsink");
+  bench.poll = gst_poll_new (TRUE);
+  bench.clients = g_hash_table_new (NULL, NULL);
+  bench.active = g_ptr_array_new ();
+  bench.removed = g_async_queue_new ();
+  bench.latencies = g_array_new (FALSE, FALSE, sizeof (gdouble));
+
+  bench.pipeline = gst_pipeline_new (NULL);
+  bench.src = gst_element_factory_make ("appsrc", NULL);
+  bench.sink = gst_element_factory_make (opt_element, NULL);
+  if (bench.src == NULL || bench.sink == NULL) {
+    g_printerr ("could not create appsrc or %s\n", opt_element);
+    exit (1);
+  }
+
+  g_object_set (bench.src, "block", TRUE, "max-bytes",
+      (guint64) opt_buffer_size * 16, NULL);
+  gst_util_set_object_arg (G_OBJECT (bench.sink), "sync-method", sync_method);
+  g_object_set (bench.sink, "sync", FALSE, "buffers-max", opt_buffers_max,
+      NULL);
+  burst = g_strsplit (opt_burst, ":", 2);
+  if (burst[0] && burst[1]) {
+    gst_util_set_object_arg (G_OBJECT (bench.sink), "burst-format", burst[0]);
+    gst_util_set_object_arg (G_OBJECT (bench.sink), "burst-value", burst[1]);
+  }
+  g_strfreev (burst);
+
+  g_signal_connect (bench.sink, bench.use_fd ? "client-fd-removed" :
+      "client-socket-removed", G_CALLBACK (on_client_removed), &bench);
+
+  gst_bin_add_many (GST_BIN (bench.pipeline), bench.src, bench.sink, NULL);
+  gst_element_link (bench.src, bench.sink);
+  gst_element_set_state (bench.pipeline, GST_STATE_PLAYING);
+
+  mem_before = bench_memory ();
+
+  for (i = 0; i < opt_clients; i++)
+    bench_add_client (&bench);
+
+  bench.running = 1;
+  bench.feeder = g_thread_new ("feeder", (GThreadFunc) bench_feed, &bench);
+
+  cpu = bench_cpu_time ();
+  start = last_tick = g_get_monotonic_time ();
+  end = start + opt_duration * G_TIME_SPAN_SECOND;
+  bus = gst_element_get_bus (bench.pipeline);
+
+  while ((now = g_get_monotonic_time ()) < end) {
+    gpointer removed;
+
+    gst_poll_wait (bench.poll, TICK * GST_USECOND);
+
+    for (i = 0; i < bench.active->len; i++) {
+      Client *client = g_ptr_array_index (bench.active, i);
+
+      if (gst_poll_fd_can_read (bench.poll, &client->pfd))
+        bench_read_client (&bench, client);
+    }
+
+    while ((removed = g_async_queue_try_pop (bench.removed)))
+      bench_free_client (&bench, GPOINTER_TO_INT (removed) - 1);
+
+    if ((msg = gst_bus_pop_filtered (bus, GST_MESSAGE_ERROR))) {
+      g_printerr ("error from %s\n", GST_MESSAGE_SRC_NAME (msg));
+      gst_message_unref (msg);
+      break;
+    }
+
+    if (now - last_tick < TICK)
+      continue;
+
+    /* give the slow clients their share for this tick */
+    for (i = 0; i < bench.active->len; i++) {
+      Client *client = g_ptr_array_index (bench.active, i);
+
+      if (!client->slow)
+        continue;
+      client->budget = (gint64) opt_slow_rate * 1024 * (now - last_tick) /
+          G_TIME_SPAN_SECOND;
+      gst_poll_fd_ctl_read (bench.poll, &client->pfd, TRUE);
+    }
+
+    /* replace some clients, and those the sink removed */
+    churn += (gdouble) opt_churn * (now - last_tick) / G_TIME_SPAN_SECOND;
+    for (; churn >= 1.0 && bench.active->len > 0; churn -= 1.0) {
+      Client *client;
+
+      client = g_ptr_array_index (bench.active,
+          g_random_int_range (0, bench.active->len));
+      if (!client->leaving)
+        bench_remove_client (&bench, client);
+    }
+    for (i = g_hash_table_size (bench.clients); i < opt_clients; i++)
+      bench_add_client (&bench);
+
+    last_tick = now;
+  }
+  gst_object_unref (bus);
+
+  cpu = bench_cpu_time () - cpu;
+  now = g_get_monotonic_time ();
+  gbit = bench.bytes * 8 / 1e9;
+
+  params = g_strdup_printf ("element=%s;sync-method=%s;clients=%d;"
+      "slow=%d%%;churn=%d/s;bitrate=%dkbit/s", opt_element, sync_method,
+      opt_clients, opt_slow, opt_churn, opt_bitrate);
+
+  g_array_sort (bench.latencies, compare_double);
+
+  benchmark_report ("tcp-clients", "delivered", params, 1,
+      gbit / ((now - start) / 1e6), "Gbit/s");
+  benchmark_report ("tcp-clients", "cpu", params, 1,
+      gbit > 0 ? cpu / gbit : 0.0, "s/Gbit");
+  benchmark_report ("tcp-clients", "join-latency-p50", params,
+      bench.latencies->len, percentile (bench.latencies, 0.5), "ms");
+  benchmark_report ("tcp-clients", "join-latency-p99", params,
+      bench.latencies->len, percentile (bench.latencies, 0.99), "ms");
+  benchmark_report ("tcp-clients", "join-latency-max", params,
+      bench.latencies->len, percentile (bench.latencies, 1.0), "ms");
+  benchmark_report ("tcp-clients", "memory", params, 1,
+      bench_memory () - mem_before, "KiB");
+  benchmark_report ("tcp-clients", "forced-removals", params, 1,
+      bench.forced, "clients");
+
+  g_free (params);
+
+  g_atomic_int_set (&bench.running, 0);
+  gst_element_set_state (bench.pipeline, GST_STATE_NULL);
+  g_thread_join (bench.feeder);
+
+  /* the sink dropped all clients when it stopped */
+  {
+    gpointer removed;
+
+    while ((removed = g_async_queue_try_pop (bench.removed)))
+      bench_free_client (&bench, GPOINTER_TO_INT (removed) - 1);
+  }
+  while (bench.active->len > 0) {
+    Client *client = g_ptr_array_index (bench.active, 0);
+
+    client->leaving = TRUE;
+    bench_free_client (&bench, client->sink_fd);
+  }
+
+  gst_object_unref (bench.pipeline);
+  g_array_free (bench.latencies, TRUE);
+  g_async_queue_unref (bench.removed);
+  g_ptr_array_free (bench.active, TRUE);
+  g_hash_table_destroy (bench.clients);
+  gst_poll_free (bench.poll);
+}
+
+int
+main (int argc, char **argv)
+{
+  GOptionContext *ctx;
+  GError *err = NULL;
+  struct rlimit limit;
+  gint i, max_fd;
+
+  ctx = g_option_context_new ("- multisocketsink/multifdsink clients");
+  g_option_context_add_main_entries (ctx, entries, NULL);
+  g_option_context_add_group (ctx, gst_init_get_option_group ());
+  if (!g_option_context_parse (ctx, &argc, &argv, &err)) {
+    g_printerr ("%s\n", err->message);
+    return 1;
+  }
+  g_option_context_free (ctx);
+
+  if (opt_element == NULL)
+    opt_element = g_strdup ("multisocketsink");
+  if (opt_burst == NULL)
+    opt_burst = g_strdup ("bytes:65536");
+
+  /* two descriptors per client, plus churn */
+  max_fd = opt_clients * 2 + opt_churn * 2 + 256;
+  if (getrlimit (RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < max_fd) {
+    limit.rlim_cur = MIN (limit.rlim_max, max_fd);
+    setrlimit (RLIMIT_NOFILE, &limit);
+    if (limit.rlim_cur < max_fd)
+      g_printerr ("warning: can only open %d files\n", (gint) limit.rlim_cur);
+  }
+
+  benchmark_header ();
+
+  for (i = 0; i < G_N_ELEMENTS (sync_methods); i++) {
+    if (opt_sync_method && !g_str_equal (opt_sync_method, sync_methods[i]))
+      continue;
+    bench_run (sync_methods[i]);
+  }
+
+  return 0;
+}
@@ -0,0 +1,167 @@
+/* GStreamer
+ *
+ * vs-image.c: throughput of the videoscale scaling functions
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+
+/* Measures the vs_image_scale_* functions of the videoscale element for
+ * all methods, with upscaling and downscaling. Results are printed as CSV,
+ * see benchmark.h. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "vs_image.h"
+#include "vs_4tap.h"
+
+#include "benchmark.h"
+
+typedef void (*ScaleFunc) (const VSImage * dest, const VSImage * src,
+    uint8_t * tmpbuf);
+typedef void (*LanczosFunc) (const VSImage * dest, const VSImage * src,
+    uint8_t * tmpbuf, double sharpness, gboolean dither, int submethod,
+    double a, double sharpen, int y_start, int y_end);
+
+static const struct
+{
+  const gchar *name;
+  gint pixel_size;
+  ScaleFunc nearest, linear, fourtap;
+  LanczosFunc lanczos;
+} formats[] = {
+  {
+  "RGBA", 4, vs_image_scale_nearest_RGBA, vs_image_scale_linear_RGBA,
+        vs_image_scale_4tap_RGBA, NULL}, {
+  "AYUV", 4, vs_image_scale_nearest_RGBA, vs_image_scale_linear_RGBA,
+        vs_image_scale_4tap_RGBA, vs_image_scale_lanczos_AYUV}, {
+  "RGB", 3, vs_image_scale_nearest_RGB, vs_image_scale_linear_RGB,
+        vs_image_scale_4tap_RGB, NULL}, {
+  "YUYV", 2, vs_image_scale_nearest_YUYV, vs_image_scale_linear_YUYV,
+        vs_image_scale_4tap_YUYV, NULL}, {
+  "UYVY", 2, vs_image_scale_nearest_UYVY, vs_image_scale_linear_UYVY,
+        vs_image_scale_4tap_UYVY, NULL}, {
+  "NV12-UV", 2, vs_image_scale_nearest_NV12, vs_image_scale_linear_NV12,
+        NULL, NULL}, {
+  "Y", 1, vs_image_scale_nearest_Y, vs_image_scale_linear_Y,
+        vs_image_scale_4tap_Y, vs_image_scale_lanczos_Y}, {
+  "Y16", 2, vs_image_scale_nearest_Y16, vs_image_scale_linear_Y16,
+        vs_image_scale_4tap_Y16, NULL}, {
+  "RGB565", 2, vs_image_scale_nearest_RGB565, vs_image_scale_linear_RGB565,
+        vs_image_scale_4tap_RGB565, NULL}, {
+  "AYUV64", 8, vs_image_scale_nearest_AYUV64, vs_image_scale_linear_AYUV64,
+        vs_image_scale_4tap_AYUV64, vs_image_scale_lanczos_AYUV64}
+};
+
+static const struct
+{
+  gint in_width, in_height;
+  gint out_width, out_height;
+} sizes[] = {
+  {
+  640, 480, 1280, 720}, {
+  1920, 1080, 1280, 720}, {
+  1920, 1080, 640, 360}
+};
+
+typedef struct
+{
+  VSImage src, dest;
+  uint8_t *tmpbuf;
+  ScaleFunc scale;
+  LanczosFunc lanczos;
+} ScaleData;
+
+static void
+scale_func (ScaleData * data)
+{
+  data->scale (&data->dest, &data->src, data->tmpbuf);
+}
+
+/* same defaults as the videoscale element */
+static void
+lanczos_func (ScaleData * data)
+{
+  data->lanczos (&data->dest, &data->src, data->tmpbuf, 1.0, FALSE, 1, 2.0,
+      0.0, 0, data->dest.height);
+}
+
+static void
+setup_image (VSImage * image, gint width, gint height, gint pixel_size)
+{
+  memset (image, 0, sizeof (VSImage));
+  image->width = image->real_width = width;
+  image->height = image->real_height = height;
+  image->stride = (width * pixel_size + 3) & ~3;
+  image->pixels = image->real_pixels = g_malloc (image->stride * height);
+  memset (image->pixels, 0x80, image->stride * height);
+}
+
+static void
+benchmark_scale (gint format, gint size, const gchar * method,
+    ScaleFunc scale, LanczosFunc lanczos)
+{
+  ScaleData data;
+  gint pixel_size = formats[format].pixel_size;
+  gchar *name, *params;
+
+  setup_image (&data.src, sizes[size].in_width, sizes[size].in_height,
+      pixel_size);
+  setup_image (&data.dest, sizes[size].out_width, sizes[size].out_height,
+      pixel_size);
+  data.tmpbuf = g_malloc (sizes[size].out_width * sizeof (guint64) * 4);
+  data.scale = scale;
+  data.lanczos = lanczos;
+
+  name = g_strdup_printf ("%s-%s", method, formats[format].name);
+  params = g_strdup_printf ("%dx%d-%dx%d", sizes[size].in_width,
+      sizes[size].in_height, sizes[size].out_width, sizes[size].out_height);
+
+  benchmark_run ("vs-image", name, params, "pixel",
+      (guint64) sizes[size].out_width * sizes[size].out_height,
+      (BenchmarkFunc) (lanczos ? lanczos_func : scale_func), &data);
+
+  g_free (params);
+  g_free (name);
+  g_free (data.tmpbuf);
+  g_free (data.dest.real_pixels);
+  g_free (data.src.real_pixels);
+}
+
+int
+main (int argc, char **argv)
+{
+  gint i, j;
+
+  vs_4tap_init ();
+
+  benchmark_header ();
+
+  for (j = 0; j < G_N_ELEMENTS (sizes); j++) {
+    for (i = 0; i < G_N_ELEMENTS (formats); i++) {
+      benchmark_scale (i, j, "nearest", formats[i].nearest, NULL);
+      benchmark_scale (i, j, "linear", formats[i].linear, NULL);
+      if (formats[i].fourtap)
+        benchmark_scale (i, j, "4tap", formats[i].fourtap, NULL);
+      if (formats[i].lanczos)
+        benchmark_scale (i, j, "lanczos", NULL, formats[i].lanczos);
+    }
+  }
+
+  return 0;
+}
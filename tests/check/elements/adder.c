@@ -1248,6 +1248,201 @@ GST_START_TEST (test_flush_start_flush_stop)
 GST_END_TEST;
 
 
+/* mix enough inputs to use the mixing kernel for all inputs at once, one of
+ * them with a pad volume */
+GST_START_TEST (test_mix_many)
+{
+  GstElement *bin, *adder, *sink;
+  GstBus *bus;
+  GstMessage *msg;
+  GstPad *pad;
+  GstMapInfo map;
+  gint16 *samples;
+  gint i, expected;
+
+  bin = gst_pipeline_new ("pipeline");
+  adder = gst_element_factory_make ("adder", "adder");
+  sink = gst_element_factory_make ("fakesink", "sink");
+  g_object_set (sink, "signal-handoffs", TRUE, NULL);
+  g_signal_connect (sink, "handoff", (GCallback) handoff_buffer_cb, NULL);
+  gst_bin_add_many (GST_BIN (bin), adder, sink, NULL);
+  fail_unless (gst_element_link (adder, sink));
+
+  for (i = 0; i < 6; i++) {
+    GstElement *src, *capsfilter;
+    GstCaps *caps;
+
+    /* a 1 Hz square wave is constant for the first half second */
+    src = gst_element_factory_make ("audiotestsrc", NULL);
+    g_object_set (src, "wave", 1, "freq", 1.0, "volume", 0.1,
+        "num-buffers", 1, "samplesperbuffer", 441, NULL);
+    capsfilter = gst_element_factory_make ("capsfilter", NULL);
+    caps = gst_caps_new_simple ("audio/x-raw",
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+        "format", G_TYPE_STRING, "S16BE",
+#else
+        "format", G_TYPE_STRING, "S16LE",
+#endif
+        "layout", G_TYPE_STRING, "interleaved",
+        "rate", G_TYPE_INT, 44100, "channels", G_TYPE_INT, 1, NULL);
+    g_object_set (capsfilter, "caps", caps, NULL);
+    gst_caps_unref (caps);
+    gst_bin_add_many (GST_BIN (bin), src, capsfilter, NULL);
+    fail_unless (gst_element_link (src, capsfilter));
+    fail_unless (gst_element_link (capsfilter, adder));
+
+    if (i == 5) {
+      GstPad *srcpad = gst_element_get_static_pad (capsfilter, "src");
+
+      pad = gst_pad_get_peer (srcpad);
+      g_object_set (pad, "volume", 0.5, NULL);
+      gst_object_unref (pad);
+      gst_object_unref (srcpad);
+    }
+  }
+
+  fail_unless (gst_element_set_state (bin,
+          GST_STATE_PLAYING) != GST_STATE_CHANGE_FAILURE);
+
+  bus = gst_element_get_bus (bin);
+  msg = gst_bus_timed_pop_filtered (bus, GST_CLOCK_TIME_NONE,
+      GST_MESSAGE_EOS | GST_MESSAGE_ERROR);
+  fail_unless_equals_int (GST_MESSAGE_TYPE (msg), GST_MESSAGE_EOS);
+  gst_message_unref (msg);
+  gst_object_unref (bus);
+
+  fail_unless (handoff_buffer != NULL);
+  gst_buffer_map (handoff_buffer, &map, GST_MAP_READ);
+  fail_unless_equals_int (map.size, 441 * 2);
+  samples = (gint16 *) map.data;
+  /* 5.5 times the amplitude of one input */
+  expected = 32767 * 0.1 * 5.5;
+  for (i = 0; i < 441; i++)
+    fail_unless (ABS (samples[i] - expected) <= 8, "sample %d is %d, not %d",
+        i, samples[i], expected);
+  gst_buffer_unmap (handoff_buffer, &map);
+  gst_buffer_replace (&handoff_buffer, NULL);
+
+  gst_element_set_state (bin, GST_STATE_NULL);
+  gst_object_unref (bin);
+}
+
+GST_END_TEST;
+
+/* push a constant buffer of 441 mono S16 frames into @sinkpad and return the
+ * mixed output */
+static GstBuffer *
+push_constant_buffer (GstPad * sinkpad, gint16 value, GstClockTime timestamp)
+{
+  GstBuffer *buffer;
+  GstMapInfo map;
+  gint i;
+
+  buffer = gst_buffer_new_and_alloc (441 * 2);
+  gst_buffer_map (buffer, &map, GST_MAP_WRITE);
+  for (i = 0; i < 441; i++)
+    ((gint16 *) map.data)[i] = value;
+  gst_buffer_unmap (buffer, &map);
+  GST_BUFFER_TIMESTAMP (buffer) = timestamp;
+  GST_BUFFER_DURATION (buffer) = 10 * GST_MSECOND;
+
+  ck_assert_int_eq (gst_pad_chain (sinkpad, buffer), GST_FLOW_OK);
+  fail_unless (handoff_buffer != NULL);
+  buffer = handoff_buffer;
+  handoff_buffer = NULL;
+
+  return buffer;
+}
+
+/* check that pad volume and mute changes are ramped over the next buffer */
+GST_START_TEST (test_volume_ramp)
+{
+  GstSegment segment;
+  GstElement *bin, *adder, *sink;
+  GstPad *sinkpad;
+  GstBuffer *buffer;
+  GstMapInfo map;
+  GstCaps *caps;
+  gint16 *samples;
+  gint i;
+
+  bin = gst_pipeline_new ("pipeline");
+  adder = gst_element_factory_make ("adder", "adder");
+  sink = gst_element_factory_make ("fakesink", "sink");
+  g_object_set (sink, "signal-handoffs", TRUE, NULL);
+  g_signal_connect (sink, "handoff", (GCallback) handoff_buffer_cb, NULL);
+  gst_bin_add_many (GST_BIN (bin), adder, sink, NULL);
+  fail_unless (gst_element_link (adder, sink));
+
+  fail_unless (gst_element_set_state (bin,
+          GST_STATE_PLAYING) != GST_STATE_CHANGE_FAILURE);
+
+  sinkpad = gst_element_get_request_pad (adder, "sink_%u");
+  fail_if (sinkpad == NULL, NULL);
+
+  gst_pad_send_event (sinkpad, gst_event_new_stream_start ("test"));
+  caps = gst_caps_new_simple ("audio/x-raw",
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+      "format", G_TYPE_STRING, "S16BE",
+#else
+      "format", G_TYPE_STRING, "S16LE",
+#endif
+      "layout", G_TYPE_STRING, "interleaved",
+      "rate", G_TYPE_INT, 44100, "channels", G_TYPE_INT, 1, NULL);
+  gst_pad_set_caps (sinkpad, caps);
+  gst_caps_unref (caps);
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  gst_pad_send_event (sinkpad, gst_event_new_segment (&segment));
+
+  /* unity volume, passed through unchanged */
+  buffer = push_constant_buffer (sinkpad, 1000, 0);
+  gst_buffer_map (buffer, &map, GST_MAP_READ);
+  samples = (gint16 *) map.data;
+  for (i = 0; i < 441; i++)
+    fail_unless_equals_int (samples[i], 1000);
+  gst_buffer_unmap (buffer, &map);
+  gst_buffer_unref (buffer);
+
+  /* muting ramps the volume down over the next buffer */
+  g_object_set (sinkpad, "mute", TRUE, NULL);
+  buffer = push_constant_buffer (sinkpad, 1000, 10 * GST_MSECOND);
+  gst_buffer_map (buffer, &map, GST_MAP_READ);
+  samples = (gint16 *) map.data;
+  fail_unless (samples[0] > 990, "first sample is %d", samples[0]);
+  for (i = 1; i < 441; i++)
+    fail_unless (samples[i] <= samples[i - 1], "sample %d is %d after %d", i,
+        samples[i], samples[i - 1]);
+  fail_unless_equals_int (samples[440], 0);
+  gst_buffer_unmap (buffer, &map);
+  gst_buffer_unref (buffer);
+
+  /* once ramped down the pad is skipped */
+  buffer = push_constant_buffer (sinkpad, 1000, 20 * GST_MSECOND);
+  fail_unless (GST_BUFFER_FLAG_IS_SET (buffer, GST_BUFFER_FLAG_GAP));
+  gst_buffer_unref (buffer);
+
+  /* unmuting to a lower volume ramps up to that volume */
+  g_object_set (sinkpad, "mute", FALSE, "volume", 0.5, NULL);
+  buffer = push_constant_buffer (sinkpad, 1000, 30 * GST_MSECOND);
+  gst_buffer_map (buffer, &map, GST_MAP_READ);
+  samples = (gint16 *) map.data;
+  fail_unless (samples[0] < 10, "first sample is %d", samples[0]);
+  for (i = 1; i < 441; i++)
+    fail_unless (samples[i] >= samples[i - 1], "sample %d is %d after %d", i,
+        samples[i], samples[i - 1]);
+  fail_unless (ABS (samples[440] - 500) <= 1, "last sample is %d",
+      samples[440]);
+  gst_buffer_unmap (buffer, &map);
+  gst_buffer_unref (buffer);
+
+  gst_element_release_request_pad (adder, sinkpad);
+  gst_object_unref (sinkpad);
+  gst_element_set_state (bin, GST_STATE_NULL);
+  gst_object_unref (bin);
+}
+
+GST_END_TEST;
+
 static Suite *
 adder_suite (void)
 {
@@ -1264,6 +1459,8 @@ adder_suite (void)
   tcase_add_test (tc_chain, test_add_pad);
   tcase_add_test (tc_chain, test_remove_pad);
   tcase_add_test (tc_chain, test_clip);
+  tcase_add_test (tc_chain, test_mix_many);
+  tcase_add_test (tc_chain, test_volume_ramp);
   tcase_add_test (tc_chain, test_duration_is_max);
   tcase_add_test (tc_chain, test_duration_unknown_overrides);
   tcase_add_test (tc_chain, test_loop);
@@ -313,6 +313,89 @@ GST_START_TEST (test_buffer_list_fallback_signal)
 
 GST_END_TEST;
 
+GST_START_TEST (test_pull_samples)
+{
+  GstElement *sink;
+  GstSample *samples[4];
+  GstBuffer *buf;
+  guint i;
+
+  sink = setup_appsink ();
+
+  ASSERT_SET_STATE (sink, GST_STATE_PLAYING, GST_STATE_CHANGE_ASYNC);
+
+  for (i = 0; i < G_N_ELEMENTS (values); i++) {
+    buf = gst_buffer_new_and_alloc (sizeof (gint));
+    gst_buffer_fill (buf, 0, &values[i], sizeof (gint));
+    fail_unless (gst_pad_push (mysrcpad, buf) == GST_FLOW_OK);
+  }
+
+  /* all queued samples are returned, but not more */
+  fail_unless_equals_int (gst_app_sink_pull_samples (GST_APP_SINK (sink),
+          samples, G_N_ELEMENTS (samples)), G_N_ELEMENTS (values));
+
+  for (i = 0; i < G_N_ELEMENTS (values); i++) {
+    buf = gst_sample_get_buffer (samples[i]);
+    gst_check_buffer_data (buf, &values[i], sizeof (gint));
+    gst_sample_unref (samples[i]);
+  }
+
+  /* EOS without queued samples returns none */
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_eos ()));
+  fail_unless_equals_int (gst_app_sink_pull_samples (GST_APP_SINK (sink),
+          samples, G_N_ELEMENTS (samples)), 0);
+
+  ASSERT_SET_STATE (sink, GST_STATE_NULL, GST_STATE_CHANGE_SUCCESS);
+  cleanup_appsink (sink);
+}
+
+GST_END_TEST;
+
+static gboolean
+propose_allocation_function (GstAppSink * appsink, GstQuery * query,
+    gpointer pool)
+{
+  gst_query_add_allocation_pool (query, pool, 4, 2, 0);
+
+  return TRUE;
+}
+
+GST_START_TEST (test_propose_allocation)
+{
+  GstElement *sink;
+  GstAppSinkCallbacks callbacks = { NULL };
+  GstBufferPool *pool, *proposed = NULL;
+  GstQuery *query;
+  GstCaps *caps;
+  guint size, min, max;
+
+  sink = setup_appsink ();
+
+  pool = gst_buffer_pool_new ();
+  callbacks.propose_allocation = propose_allocation_function;
+  gst_app_sink_set_callbacks (GST_APP_SINK (sink), &callbacks, pool, NULL);
+
+  ASSERT_SET_STATE (sink, GST_STATE_PLAYING, GST_STATE_CHANGE_ASYNC);
+
+  caps = gst_caps_new_empty_simple ("application/x-gst-check");
+  query = gst_query_new_allocation (caps, TRUE);
+  fail_unless (gst_pad_peer_query (mysrcpad, query));
+  fail_unless_equals_int (gst_query_get_n_allocation_pools (query), 1);
+  gst_query_parse_nth_allocation_pool (query, 0, &proposed, &size, &min, &max);
+  fail_unless (proposed == pool);
+  fail_unless_equals_int (size, 4);
+  fail_unless_equals_int (min, 2);
+  gst_object_unref (proposed);
+  gst_query_unref (query);
+  gst_caps_unref (caps);
+
+  ASSERT_SET_STATE (sink, GST_STATE_NULL, GST_STATE_CHANGE_SUCCESS);
+  cleanup_appsink (sink);
+  gst_object_unref (pool);
+}
+
+GST_END_TEST;
+
 static Suite *
 appsink_suite (void)
 {
@@ -326,6 +409,8 @@ appsink_suite (void)
   tcase_add_test (tc_chain, test_notify1);
   tcase_add_test (tc_chain, test_buffer_list_fallback);
   tcase_add_test (tc_chain, test_buffer_list_fallback_signal);
+  tcase_add_test (tc_chain, test_pull_samples);
+  tcase_add_test (tc_chain, test_propose_allocation);
 
   return s;
 }
@@ -111,6 +111,113 @@ GST_START_TEST (test_appsrc_non_null_caps)
 
 GST_END_TEST;
 
+/*
+ * Pushes a list of 3 buffers and a single buffer into appsrc and checks that
+ * all of them come out in order.
+ */
+GST_START_TEST (test_appsrc_push_buffer_list)
+{
+  GstElement *src;
+  GstBufferList *list;
+  GstBuffer *buffer;
+  GList *walk;
+  gsize size;
+
+  src = setup_appsrc ();
+
+  ASSERT_SET_STATE (src, GST_STATE_PLAYING, GST_STATE_CHANGE_SUCCESS);
+
+  list = gst_buffer_list_new ();
+  gst_buffer_list_add (list, gst_buffer_new_and_alloc (1));
+  gst_buffer_list_add (list, gst_buffer_new_and_alloc (2));
+  gst_buffer_list_add (list, gst_buffer_new_and_alloc (3));
+  fail_unless (gst_app_src_push_buffer_list (GST_APP_SRC (src),
+          list) == GST_FLOW_OK);
+
+  buffer = gst_buffer_new_and_alloc (4);
+  fail_unless (gst_app_src_push_buffer (GST_APP_SRC (src),
+          buffer) == GST_FLOW_OK);
+
+  fail_unless (gst_app_src_end_of_stream (GST_APP_SRC (src)) == GST_FLOW_OK);
+
+  /* Give some time to the appsrc loop to push the buffers */
+  g_usleep (G_USEC_PER_SEC * 3);
+
+  fail_unless_equals_int (g_list_length (buffers), 4);
+  for (walk = buffers, size = 1; walk; walk = walk->next, size++)
+    fail_unless_equals_int (gst_buffer_get_size (walk->data), size);
+  gst_check_drop_buffers ();
+
+  ASSERT_SET_STATE (src, GST_STATE_NULL, GST_STATE_CHANGE_SUCCESS);
+  cleanup_appsrc (src);
+}
+
+GST_END_TEST;
+
+static void
+check_queue_stats (GstElement * src, guint buffers, guint64 dropped)
+{
+  GstStructure *stats;
+  guint level;
+  guint64 n_dropped;
+
+  g_object_get (src, "stats", &stats, NULL);
+  fail_unless (stats != NULL);
+  fail_unless (gst_structure_get_uint (stats, "current-level-buffers",
+          &level));
+  fail_unless (gst_structure_get_uint64 (stats, "dropped", &n_dropped));
+  fail_unless_equals_int (level, buffers);
+  fail_unless_equals_int (n_dropped, dropped);
+  gst_structure_free (stats);
+}
+
+static GstBuffer *
+create_timed_buffer (GstClockTime pts)
+{
+  GstBuffer *buffer;
+
+  buffer = gst_buffer_new_and_alloc (4);
+  GST_BUFFER_PTS (buffer) = pts;
+  GST_BUFFER_DURATION (buffer) = GST_SECOND;
+
+  return buffer;
+}
+
+/*
+ * Checks that the leaky types drop new or old buffers once max-buffers or
+ * max-time is reached.
+ */
+GST_START_TEST (test_appsrc_leaky)
+{
+  GstElement *src;
+  gint i;
+
+  src = setup_appsrc ();
+
+  g_object_set (src, "max-buffers", 2, "leaky-type",
+      GST_APP_LEAKY_TYPE_UPSTREAM, NULL);
+  for (i = 0; i < 4; i++)
+    fail_unless (gst_app_src_push_buffer (GST_APP_SRC (src),
+            create_timed_buffer (i * GST_SECOND)) == GST_FLOW_OK);
+  check_queue_stats (src, 2, 2);
+
+  cleanup_appsrc (src);
+
+  src = setup_appsrc ();
+
+  /* 3 seconds of data fit, the oldest buffers make room after that */
+  g_object_set (src, "max-time", 3 * GST_SECOND, "leaky-type",
+      GST_APP_LEAKY_TYPE_DOWNSTREAM, NULL);
+  for (i = 0; i < 5; i++)
+    fail_unless (gst_app_src_push_buffer (GST_APP_SRC (src),
+            create_timed_buffer (i * GST_SECOND)) == GST_FLOW_OK);
+  check_queue_stats (src, 3, 2);
+
+  cleanup_appsrc (src);
+}
+
+GST_END_TEST;
+
 static GstAppSinkCallbacks app_callbacks;
 
 typedef struct
@@ -264,6 +371,88 @@ GST_START_TEST (test_appsrc_block_deadlock)
 
 GST_END_TEST;
 
+static void
+range_need_data (GstAppSrc * src, guint length, gpointer user_data)
+{
+  fail ("need-data emitted for data in the pushed ranges");
+}
+
+static gboolean
+range_seek_data (GstAppSrc * src, guint64 offset, gpointer user_data)
+{
+  fail ("seek-data emitted for data in the pushed ranges");
+  return FALSE;
+}
+
+static GstFlowReturn
+push_range_data (GstElement * src, const guint8 * data, guint64 offset,
+    gsize size)
+{
+  return gst_app_src_push_range (GST_APP_SRC (src), offset,
+      gst_buffer_new_wrapped (g_memdup (data + offset, size), size));
+}
+
+static void
+check_range (GstPad * srcpad, const guint8 * data, guint64 offset,
+    guint size, gsize expected)
+{
+  GstBuffer *buffer = NULL;
+  GstMapInfo map;
+
+  fail_unless_equals_int (gst_pad_get_range (srcpad, offset, size, &buffer),
+      GST_FLOW_OK);
+  fail_unless (buffer != NULL);
+  fail_unless (gst_buffer_map (buffer, &map, GST_MAP_READ));
+  fail_unless_equals_int (map.size, expected);
+  fail_unless (memcmp (map.data, data + offset, expected) == 0);
+  gst_buffer_unmap (buffer, &map);
+  gst_buffer_unref (buffer);
+}
+
+/*
+ * Pushes overlapping and adjacent ranges of a random-access stream and checks
+ * that pulling from them doesn't ask the application for data.
+ */
+GST_START_TEST (test_appsrc_push_range)
+{
+  GstElement *src;
+  GstPad *srcpad;
+  guint8 data[100];
+  guint i;
+
+  for (i = 0; i < sizeof (data); i++)
+    data[i] = i;
+
+  src = gst_element_factory_make ("appsrc", NULL);
+  g_object_set (src, "stream-type", GST_APP_STREAM_TYPE_RANDOM_ACCESS,
+      "size", (gint64) sizeof (data), NULL);
+  g_signal_connect (src, "need-data", G_CALLBACK (range_need_data), NULL);
+  g_signal_connect (src, "seek-data", G_CALLBACK (range_seek_data), NULL);
+
+  srcpad = gst_element_get_static_pad (src, "src");
+  fail_unless (gst_pad_activate_mode (srcpad, GST_PAD_MODE_PULL, TRUE));
+
+  fail_unless_equals_int (push_range_data (src, data, 0, 40), GST_FLOW_OK);
+  fail_unless_equals_int (push_range_data (src, data, 30, 30), GST_FLOW_OK);
+  fail_unless_equals_int (push_range_data (src, data, 60, 40), GST_FLOW_OK);
+  /* contained in the ranges above */
+  fail_unless_equals_int (push_range_data (src, data, 35, 10), GST_FLOW_OK);
+
+  check_range (srcpad, data, 20, 50, 50);
+  check_range (srcpad, data, 0, 100, 100);
+  /* short read at the end of the stream */
+  check_range (srcpad, data, 90, 50, 10);
+
+  fail_unless (gst_pad_activate_mode (srcpad, GST_PAD_MODE_PULL, FALSE));
+  fail_unless_equals_int (push_range_data (src, data, 0, 10),
+      GST_FLOW_FLUSHING);
+
+  gst_object_unref (srcpad);
+  gst_object_unref (src);
+}
+
+GST_END_TEST;
+
 static Suite *
 appsrc_suite (void)
 {
@@ -271,7 +460,10 @@ appsrc_suite (void)
   TCase *tc_chain = tcase_create ("general");
 
   tcase_add_test (tc_chain, test_appsrc_non_null_caps);
+  tcase_add_test (tc_chain, test_appsrc_push_buffer_list);
+  tcase_add_test (tc_chain, test_appsrc_leaky);
   tcase_add_test (tc_chain, test_appsrc_block_deadlock);
+  tcase_add_test (tc_chain, test_appsrc_push_range);
 
   tcase_set_timeout (tc_chain, 20);
   suite_add_tcase (s, tc_chain);
@@ -722,6 +722,17 @@ GST_START_TEST (test_float_conversion)
         out, get_float_caps (1, G_BYTE_ORDER, 32));
   }
 
+  {
+    gfloat in[] = { 0.0, 1.0, -1.0, 0.5, -0.5, 1.1, -1.1 };
+    gint32 out[] = { 0, G_MAXINT32, G_MININT32, 1073741824, -1073741824,
+      G_MAXINT32, G_MININT32
+    };
+
+    RUN_CONVERSION ("32 float to 32 signed",
+        in, get_float_caps (1, G_BYTE_ORDER, 32),
+        out, get_int_caps (1, G_BYTE_ORDER, 32, 32, TRUE));
+  }
+
   /* 64 float <-> 16 signed */
   /* NOTE: if audioconvert was doing dithering we'd have a problem */
   {
@@ -1504,6 +1515,122 @@ GST_START_TEST (test_preserve_width)
 
 GST_END_TEST;
 
+static GstCaps *
+get_caps (GstAudioFormat fmt, guint channels,
+    const GstAudioChannelPosition * position)
+{
+  GstAudioInfo info;
+
+  gst_audio_info_init (&info);
+  gst_audio_info_set_format (&info, fmt, 48000, channels, position);
+
+  return gst_audio_info_to_caps (&info);
+}
+
+static GstBuffer *
+convert_with_threads (GstCaps * incaps, GstCaps * outcaps, GstBuffer * inbuf,
+    guint n_threads)
+{
+  GstElement *audioconvert;
+  GstBuffer *outbuf;
+  gint64 start;
+
+  audioconvert = setup_audioconvert (gst_caps_ref (outcaps));
+  g_object_set (audioconvert, "n-threads", n_threads, NULL);
+
+  fail_unless (gst_element_set_state (audioconvert,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+  gst_check_setup_events (mysrcpad, audioconvert, incaps, GST_FORMAT_TIME);
+
+  start = g_get_monotonic_time ();
+  fail_unless_equals_int (gst_pad_push (mysrcpad, gst_buffer_ref (inbuf)),
+      GST_FLOW_OK);
+  GST_INFO ("%u threads: %" G_GINT64_FORMAT " us", n_threads,
+      g_get_monotonic_time () - start);
+
+  fail_unless (g_list_length (buffers) == 1);
+  outbuf = buffers->data;
+  buffers = g_list_remove (buffers, outbuf);
+
+  fail_unless (gst_element_set_state (audioconvert,
+          GST_STATE_NULL) == GST_STATE_CHANGE_SUCCESS, "could not set to null");
+  cleanup_audioconvert (audioconvert);
+
+  return outbuf;
+}
+
+/* converts one buffer with 1 to 4 threads and checks that the results are
+ * the same, the conversion times are logged at INFO level */
+static void
+verify_threaded_convert (const gchar * which, GstCaps * incaps,
+    GstCaps * outcaps, gint samples)
+{
+  GstBuffer *inbuf, *ref, *outbuf;
+  GstAudioInfo info;
+  GstMapInfo map;
+  GRand *rand;
+  guint i, n_threads;
+
+  GST_DEBUG ("verifying threaded conversion %s", which);
+
+  fail_unless (gst_audio_info_from_caps (&info, incaps));
+  inbuf = gst_buffer_new_and_alloc (samples * info.bpf);
+  gst_buffer_map (inbuf, &map, GST_MAP_WRITE);
+  rand = g_rand_new_with_seed (42);
+  if (GST_AUDIO_INFO_IS_FLOAT (&info)) {
+    for (i = 0; i < map.size / sizeof (gfloat); i++)
+      ((gfloat *) map.data)[i] = g_rand_double_range (rand, -1.0, 1.0);
+  } else {
+    for (i = 0; i < map.size; i++)
+      map.data[i] = g_rand_int (rand);
+  }
+  g_rand_free (rand);
+  gst_buffer_unmap (inbuf, &map);
+
+  ref = convert_with_threads (incaps, outcaps, inbuf, 1);
+  gst_buffer_map (ref, &map, GST_MAP_READ);
+
+  for (n_threads = 2; n_threads <= 4; n_threads++) {
+    outbuf = convert_with_threads (incaps, outcaps, inbuf, n_threads);
+    gst_check_buffer_data (outbuf, map.data, map.size);
+    gst_buffer_unref (outbuf);
+  }
+
+  gst_buffer_unmap (ref, &map);
+  gst_buffer_unref (ref);
+  gst_buffer_unref (inbuf);
+  gst_caps_unref (incaps);
+  gst_caps_unref (outcaps);
+}
+
+GST_START_TEST (test_n_threads)
+{
+  static const GstAudioChannelPosition pos_5_1[] = {
+    GST_AUDIO_CHANNEL_POSITION_FRONT_LEFT,
+    GST_AUDIO_CHANNEL_POSITION_FRONT_RIGHT,
+    GST_AUDIO_CHANNEL_POSITION_FRONT_CENTER,
+    GST_AUDIO_CHANNEL_POSITION_LFE1,
+    GST_AUDIO_CHANNEL_POSITION_REAR_LEFT,
+    GST_AUDIO_CHANNEL_POSITION_REAR_RIGHT
+  };
+
+  verify_threaded_convert ("64 channels S24LE to S32LE",
+      get_caps (GST_AUDIO_FORMAT_S24LE, 64, NULL),
+      get_caps (GST_AUDIO_FORMAT_S32LE, 64, NULL), 4800);
+  verify_threaded_convert ("64 channels S32LE to F32LE",
+      get_caps (GST_AUDIO_FORMAT_S32LE, 64, NULL),
+      get_caps (GST_AUDIO_FORMAT_F32LE, 64, NULL), 4800);
+  verify_threaded_convert ("64 channels F32LE to S24LE",
+      get_caps (GST_AUDIO_FORMAT_F32LE, 64, NULL),
+      get_caps (GST_AUDIO_FORMAT_S24LE, 64, NULL), 4801);
+  verify_threaded_convert ("5.1 F32LE to stereo S16LE",
+      get_caps (GST_AUDIO_FORMAT_F32LE, 6, pos_5_1),
+      get_caps (GST_AUDIO_FORMAT_S16LE, 2, NULL), 48000);
+}
+
+GST_END_TEST;
+
 static Suite *
 audioconvert_suite (void)
 {
@@ -1519,6 +1646,7 @@ audioconvert_suite (void)
   tcase_add_test (tc_chain, test_caps_negotiation);
   tcase_add_test (tc_chain, test_convert_undefined_multichannel);
   tcase_add_test (tc_chain, test_preserve_width);
+  tcase_add_test (tc_chain, test_n_threads);
 
   return s;
 }
@@ -441,6 +441,26 @@ GST_START_TEST (test_large_discont)
    * buffers, because the gap is > 1 second (but less than 2 seconds) */
   fail_unless_equals_int (g_list_length (buffers), 4);
 
+  /* the filler buffers contain silence and share the same memory */
+  {
+    GstBuffer *fill1 = GST_BUFFER (g_list_nth_data (buffers, 1));
+    GstBuffer *fill2 = GST_BUFFER (g_list_nth_data (buffers, 2));
+    GstMapInfo map1, map2;
+    gint i;
+
+    fail_unless (GST_BUFFER_FLAG_IS_SET (fill1, GST_BUFFER_FLAG_GAP));
+    fail_unless (GST_BUFFER_FLAG_IS_SET (fill2, GST_BUFFER_FLAG_GAP));
+
+    gst_buffer_map (fill1, &map1, GST_MAP_READ);
+    gst_buffer_map (fill2, &map2, GST_MAP_READ);
+    fail_unless_equals_int (map1.size, 44100 * sizeof (gfloat));
+    fail_unless (map1.data == map2.data);
+    for (i = 0; i < map2.size / sizeof (gfloat); i++)
+      fail_unless (((gfloat *) map2.data)[i] == 0.0);
+    gst_buffer_unmap (fill2, &map2);
+    gst_buffer_unmap (fill1, &map1);
+  }
+
   gst_element_set_state (audiorate, GST_STATE_NULL);
   gst_caps_unref (caps);
 
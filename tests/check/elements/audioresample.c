@@ -1090,6 +1090,152 @@ GST_START_TEST (test_fft)
 
 GST_END_TEST;
 
+#define THREADS_CHANNELS 16
+#define THREADS_SAMPLES 4096
+
+/* resample a multichannel ramp with @n_threads threads and return a copy of
+ * the output */
+static gpointer
+run_threads_instance (guint n_threads, const gchar * format, gint width,
+    gsize * size)
+{
+  GstElement *audioresample;
+  GstBuffer *inbuffer, *outbuffer;
+  GstMapInfo map;
+  gpointer data;
+  gint i, c;
+
+  audioresample =
+      setup_audioresample (THREADS_CHANNELS, 0, 48000, 44100, format);
+  g_object_set (audioresample, "n-threads", n_threads, NULL);
+
+  fail_unless (gst_element_set_state (audioresample,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  inbuffer = gst_buffer_new_and_alloc (THREADS_SAMPLES * THREADS_CHANNELS *
+      width / 8);
+  GST_BUFFER_TIMESTAMP (inbuffer) = 0;
+  GST_BUFFER_DURATION (inbuffer) =
+      GST_FRAMES_TO_CLOCK_TIME (THREADS_SAMPLES, 48000);
+  GST_BUFFER_OFFSET (inbuffer) = 0;
+  GST_BUFFER_OFFSET_END (inbuffer) = THREADS_SAMPLES;
+
+  /* give every channel a different ramp */
+  gst_buffer_map (inbuffer, &map, GST_MAP_WRITE);
+  for (i = 0; i < THREADS_SAMPLES; i++) {
+    for (c = 0; c < THREADS_CHANNELS; c++) {
+      gdouble v = ((i * (c + 1)) % THREADS_SAMPLES) * 2.0 / THREADS_SAMPLES
+          - 1.0;
+
+      if (width == 16)
+        ((gint16 *) map.data)[i * THREADS_CHANNELS + c] = v * 32767;
+      else
+        ((gfloat *) map.data)[i * THREADS_CHANNELS + c] = v;
+    }
+  }
+  gst_buffer_unmap (inbuffer, &map);
+
+  fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+  fail_unless_equals_int (g_list_length (buffers), 1);
+
+  outbuffer = GST_BUFFER (buffers->data);
+  gst_buffer_map (outbuffer, &map, GST_MAP_READ);
+  data = g_memdup (map.data, map.size);
+  *size = map.size;
+  gst_buffer_unmap (outbuffer, &map);
+
+  cleanup_audioresample (audioresample);
+
+  return data;
+}
+
+/* check that resampling channel groups in parallel gives the same output */
+GST_START_TEST (test_threads)
+{
+  static const struct
+  {
+    const gchar *format;
+    gint width;
+  } formats[] = {
+    {
+    GST_AUDIO_NE (F32), 32}, {
+    GST_AUDIO_NE (S16), 16}
+  };
+  gpointer ref, out;
+  gsize ref_size, out_size;
+  guint i, n_threads;
+
+  for (i = 0; i < G_N_ELEMENTS (formats); i++) {
+    ref = run_threads_instance (1, formats[i].format, formats[i].width,
+        &ref_size);
+    fail_unless (ref_size > 0);
+
+    for (n_threads = 2; n_threads <= 5; n_threads++) {
+      out = run_threads_instance (n_threads, formats[i].format,
+          formats[i].width, &out_size);
+      fail_unless_equals_int (out_size, ref_size);
+      fail_unless (memcmp (out, ref, ref_size) == 0,
+          "output with %u threads differs for %s", n_threads,
+          formats[i].format);
+      g_free (out);
+    }
+    g_free (ref);
+  }
+}
+
+GST_END_TEST;
+
+/* push one buffer of 48kHz S16 downsampled to 8kHz and return the number of
+ * output samples, which is smaller the more input the filter holds back */
+static guint
+run_low_latency_instance (gboolean low_latency)
+{
+  GstElement *audioresample;
+  GstBuffer *inbuffer;
+  GstMapInfo map;
+  gsize size;
+
+  audioresample =
+      setup_audioresample (1, 0, 48000, 8000, GST_AUDIO_NE (S16));
+  g_object_set (audioresample, "low-latency", low_latency, NULL);
+
+  fail_unless (gst_element_set_state (audioresample,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  inbuffer = gst_buffer_new_and_alloc (4800 * 2);
+  gst_buffer_map (inbuffer, &map, GST_MAP_WRITE);
+  memset (map.data, 0, map.size);
+  gst_buffer_unmap (inbuffer, &map);
+  GST_BUFFER_TIMESTAMP (inbuffer) = 0;
+  GST_BUFFER_DURATION (inbuffer) = GST_FRAMES_TO_CLOCK_TIME (4800, 48000);
+  GST_BUFFER_OFFSET (inbuffer) = 0;
+  GST_BUFFER_OFFSET_END (inbuffer) = 4800;
+
+  fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+  fail_unless_equals_int (g_list_length (buffers), 1);
+  size = gst_buffer_get_size (GST_BUFFER (buffers->data));
+
+  cleanup_audioresample (audioresample);
+
+  return size / 2;
+}
+
+GST_START_TEST (test_low_latency)
+{
+  guint normal, low;
+
+  normal = run_low_latency_instance (FALSE);
+  low = run_low_latency_instance (TRUE);
+
+  GST_INFO ("output samples: normal %u, low latency %u", normal, low);
+  fail_unless (low > normal);
+  fail_unless (low <= 800);
+}
+
+GST_END_TEST;
+
 static Suite *
 audioresample_suite (void)
 {
@@ -1104,6 +1250,8 @@ audioresample_suite (void)
   tcase_add_test (tc_chain, test_live_switch);
   tcase_add_test (tc_chain, test_timestamp_drift);
   tcase_add_test (tc_chain, test_fft);
+  tcase_add_test (tc_chain, test_threads);
+  tcase_add_test (tc_chain, test_low_latency);
 
 #ifndef GST_DISABLE_PARSE
   tcase_set_timeout (tc_chain, 360);
@@ -21,6 +21,7 @@
  */
 
 #include <unistd.h>
+#include <math.h>
 
 #include <gst/check/gstcheck.h>
 #include <gst/audio/audio.h>
@@ -112,6 +113,59 @@ GST_START_TEST (test_all_waves)
 
 GST_END_TEST;
 
+GST_START_TEST (test_sine)
+{
+  GstElement *audiotestsrc;
+  GstCaps *caps;
+  GstAudioInfo info;
+  GList *l;
+  gint k = 0;
+
+  audiotestsrc = setup_audiotestsrc ();
+  g_object_set (audiotestsrc, "wave", 0, "freq", 440.0, "volume", 1.0, NULL);
+
+  fail_unless (gst_element_set_state (audiotestsrc,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  g_mutex_lock (&check_mutex);
+  while (g_list_length (buffers) < 10)
+    g_cond_wait (&check_cond, &check_mutex);
+  g_mutex_unlock (&check_mutex);
+
+  gst_element_set_state (audiotestsrc, GST_STATE_READY);
+
+  caps = gst_pad_get_current_caps (mysinkpad);
+  fail_unless (caps != NULL);
+  fail_unless (gst_audio_info_from_caps (&info, caps));
+  gst_caps_unref (caps);
+
+  /* the oscillator must stay in phase with a real sine over several
+   * buffers */
+  for (l = buffers; l; l = l->next) {
+    GstMapInfo map;
+    gint16 *samples;
+    gint i;
+
+    gst_buffer_map (GST_BUFFER (l->data), &map, GST_MAP_READ);
+    samples = (gint16 *) map.data;
+    for (i = 0; i < map.size / sizeof (gint16); i++) {
+      gdouble expected;
+
+      k++;
+      expected = 32767.0 * sin (2.0 * G_PI * 440.0 * k / info.rate);
+      fail_unless (ABS (samples[i] - expected) <= 2.0,
+          "sample %d is %d, expected %f", k, samples[i], expected);
+    }
+    gst_buffer_unmap (GST_BUFFER (l->data), &map);
+  }
+
+  /* cleanup */
+  cleanup_audiotestsrc (audiotestsrc);
+}
+
+GST_END_TEST;
+
 static Suite *
 audiotestsrc_suite (void)
 {
@@ -120,6 +174,7 @@ audiotestsrc_suite (void)
 
   suite_add_tcase (s, tc_chain);
   tcase_add_test (tc_chain, test_all_waves);
+  tcase_add_test (tc_chain, test_sine);
 
   return s;
 }
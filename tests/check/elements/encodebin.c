@@ -1020,6 +1020,71 @@ GST_START_TEST (test_encodebin_named_requests)
 
 GST_END_TEST;
 
+GST_START_TEST (test_encodebin_shared_video_renditions)
+{
+  GstElement *ebin;
+  GstEncodingContainerProfile *cprof;
+  GstCaps *ogg, *theora, *restriction;
+  GstPad *srcpad, *sinkpad, *sinkpad2;
+
+  /* Create a profile with two theora renditions of different sizes */
+  ogg = gst_caps_new_empty_simple ("application/ogg");
+  cprof =
+      gst_encoding_container_profile_new ((gchar *) "myprofile", NULL, ogg,
+      NULL);
+  gst_caps_unref (ogg);
+
+  theora = gst_caps_new_empty_simple ("video/x-theora");
+  restriction = gst_caps_new_simple ("video/x-raw", "width", G_TYPE_INT, 320,
+      "height", G_TYPE_INT, 240, NULL);
+  fail_unless (gst_encoding_container_profile_add_profile (cprof,
+          (GstEncodingProfile *) gst_encoding_video_profile_new (theora, NULL,
+              restriction, 0)));
+  gst_caps_unref (restriction);
+  restriction = gst_caps_new_simple ("video/x-raw", "width", G_TYPE_INT, 160,
+      "height", G_TYPE_INT, 120, NULL);
+  fail_unless (gst_encoding_container_profile_add_profile (cprof,
+          (GstEncodingProfile *) gst_encoding_video_profile_new (theora, NULL,
+              restriction, 0)));
+  gst_caps_unref (restriction);
+  gst_caps_unref (theora);
+
+  ebin = gst_element_factory_make ("encodebin", NULL);
+  gst_util_set_object_arg (G_OBJECT (ebin), "flags", "share-video-input");
+  g_object_set (ebin, "profile", cprof, NULL);
+  gst_encoding_profile_unref (cprof);
+
+  /* Check if the source pad was properly created */
+  srcpad = gst_element_get_static_pad (ebin, "src");
+  fail_unless (srcpad != NULL);
+  gst_object_unref (srcpad);
+
+  /* A single video sink pad feeds both renditions */
+  sinkpad = gst_element_get_request_pad (ebin, "video_%u");
+  fail_unless (sinkpad != NULL);
+  _caps_match (sinkpad, "video/x-raw;video/x-theora");
+  fail_unless_equals_int (GST_ELEMENT (ebin)->numsinkpads, 1);
+
+  /* and can only be requested once */
+  sinkpad2 = gst_element_get_request_pad (ebin, "video_%u");
+  fail_unless (sinkpad2 == NULL);
+
+  fail_unless_equals_int (gst_element_set_state (ebin, GST_STATE_PAUSED),
+      GST_STATE_CHANGE_SUCCESS);
+
+  /* Set back to NULL */
+  fail_unless_equals_int (gst_element_set_state (ebin, GST_STATE_NULL),
+      GST_STATE_CHANGE_SUCCESS);
+
+  gst_element_release_request_pad (GST_ELEMENT (ebin), sinkpad);
+  gst_object_unref (sinkpad);
+  fail_unless_equals_int (GST_ELEMENT (ebin)->numsinkpads, 0);
+
+  gst_object_unref (ebin);
+}
+
+GST_END_TEST;
+
 static Suite *
 encodebin_suite (void)
 {
@@ -1043,6 +1108,7 @@ encodebin_suite (void)
   tcase_add_test (tc_chain, test_encodebin_impossible_element_combination);
   tcase_add_test (tc_chain, test_encodebin_reuse);
   tcase_add_test (tc_chain, test_encodebin_named_requests);
+  tcase_add_test (tc_chain, test_encodebin_shared_video_renditions);
 
   return s;
 }
@@ -141,6 +141,58 @@ GST_START_TEST (test_add_client)
 
 GST_END_TEST;
 
+/* all buffers of a buffer list are queued and sent in order */
+GST_START_TEST (test_render_list)
+{
+  GstElement *sink;
+  GstBufferList *list;
+  GstBuffer *buffer;
+  GstCaps *caps;
+  int pfd[2];
+  gchar data[12];
+  guint buffers_queued;
+
+  sink = setup_multifdsink ();
+
+  fail_if (pipe (pfd) == -1);
+
+  ASSERT_SET_STATE (sink, GST_STATE_PLAYING, GST_STATE_CHANGE_ASYNC);
+
+  /* add the client */
+  g_signal_emit_by_name (sink, "add", pfd[1]);
+
+  caps = gst_caps_from_string ("application/x-gst-check");
+  gst_check_setup_events (mysrcpad, sink, caps, GST_FORMAT_BYTES);
+
+  list = gst_buffer_list_new ();
+  buffer = gst_buffer_new_and_alloc (4);
+  gst_buffer_fill (buffer, 0, "dead", 4);
+  gst_buffer_list_add (list, buffer);
+  buffer = gst_buffer_new_and_alloc (4);
+  gst_buffer_fill (buffer, 0, "beef", 4);
+  gst_buffer_list_add (list, buffer);
+  buffer = gst_buffer_new_and_alloc (4);
+  gst_buffer_fill (buffer, 0, "cafe", 4);
+  gst_buffer_list_add (list, buffer);
+  fail_unless (gst_pad_push_list (mysrcpad, list) == GST_FLOW_OK);
+
+  GST_DEBUG ("reading");
+  fail_if (read (pfd[0], data, 12) < 12);
+  fail_unless (strncmp (data, "deadbeefcafe", 12) == 0);
+  wait_bytes_served (sink, 12);
+
+  g_object_get (sink, "buffers-queued", &buffers_queued, NULL);
+  fail_unless (buffers_queued <= 3);
+
+  GST_DEBUG ("cleaning up multifdsink");
+  ASSERT_SET_STATE (sink, GST_STATE_NULL, GST_STATE_CHANGE_SUCCESS);
+  cleanup_multifdsink (sink);
+
+  gst_caps_unref (caps);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_add_client_in_null_state)
 {
   GstElement *sink;
@@ -804,6 +856,136 @@ GST_END_TEST;
  * an old client still needs to read from before the new streamheaders
  * a new client gets the new streamheaders
  */
+/* the data is spread out over time at the pacing bitrate */
+GST_START_TEST (test_pacing)
+{
+  GstElement *sink;
+  GstBuffer *buffer;
+  GstCaps *caps;
+  GstStructure *stats = NULL;
+  guint64 bitrate;
+  gint64 start, elapsed;
+  int pfd[2];
+  gchar data[100];
+  gsize total = 0;
+
+  sink = setup_multifdsink ();
+  /* 1000 bytes per second */
+  g_object_set (sink, "pacing", TRUE, "pacing-bitrate", 8000, NULL);
+
+  fail_if (pipe (pfd) == -1);
+
+  ASSERT_SET_STATE (sink, GST_STATE_PLAYING, GST_STATE_CHANGE_ASYNC);
+
+  g_signal_emit_by_name (sink, "add", pfd[1]);
+
+  caps = gst_caps_from_string ("application/x-gst-check");
+  gst_check_setup_events (mysrcpad, sink, caps, GST_FORMAT_BYTES);
+  buffer = gst_buffer_new_and_alloc (100);
+  gst_buffer_memset (buffer, 0, 0xde, 100);
+
+  start = g_get_monotonic_time ();
+  fail_unless (gst_pad_push (mysrcpad, buffer) == GST_FLOW_OK);
+
+  GST_DEBUG ("reading");
+  while (total < sizeof (data)) {
+    ssize_t nread = read (pfd[0], data + total, sizeof (data) - total);
+
+    fail_if (nread <= 0);
+    total += nread;
+  }
+  elapsed = g_get_monotonic_time () - start;
+  /* only the first 20 bytes can be sent right away */
+  fail_unless (elapsed >= 50 * G_TIME_SPAN_MILLISECOND,
+      "data was not paced, took %" G_GINT64_FORMAT " us", elapsed);
+  wait_bytes_served (sink, 100);
+
+  g_signal_emit_by_name (sink, "get-stats", pfd[1], &stats);
+  fail_unless (stats != NULL);
+  fail_unless (gst_structure_get_uint64 (stats, "pacing-bitrate", &bitrate));
+  fail_unless_equals_uint64 (bitrate, 8000);
+  gst_structure_free (stats);
+
+  GST_DEBUG ("cleaning up multifdsink");
+  ASSERT_SET_STATE (sink, GST_STATE_NULL, GST_STATE_CHANGE_SUCCESS);
+  cleanup_multifdsink (sink);
+
+  gst_caps_unref (caps);
+}
+
+GST_END_TEST;
+
+/* the stats of the clients are posted on the bus */
+GST_START_TEST (test_stats_message)
+{
+  GstElement *sink;
+  GstBuffer *buffer;
+  GstCaps *caps;
+  GstBus *bus;
+  GstMessage *msg;
+  const GstStructure *s;
+  const GValue *clients, *latency;
+  const GstStructure *client;
+  guint64 writes;
+  int pfd[2];
+  gchar data[4];
+
+  sink = setup_multifdsink ();
+  g_object_set (sink, "stats-interval", (guint64) 1, NULL);
+
+  bus = gst_bus_new ();
+  gst_element_set_bus (sink, bus);
+
+  fail_if (pipe (pfd) == -1);
+
+  ASSERT_SET_STATE (sink, GST_STATE_PLAYING, GST_STATE_CHANGE_ASYNC);
+
+  g_signal_emit_by_name (sink, "add", pfd[1]);
+
+  caps = gst_caps_from_string ("application/x-gst-check");
+  gst_check_setup_events (mysrcpad, sink, caps, GST_FORMAT_BYTES);
+
+  buffer = gst_buffer_new_and_alloc (4);
+  gst_buffer_fill (buffer, 0, "dead", 4);
+  fail_unless (gst_pad_push (mysrcpad, buffer) == GST_FLOW_OK);
+  fail_if (read (pfd[0], data, 4) < 4);
+  wait_bytes_served (sink, 4);
+
+  /* the stats of the second buffer include the write of the first one */
+  buffer = gst_buffer_new_and_alloc (4);
+  gst_buffer_fill (buffer, 0, "beef", 4);
+  g_usleep (G_USEC_PER_SEC / 100);
+  gst_bus_set_flushing (bus, TRUE);
+  gst_bus_set_flushing (bus, FALSE);
+  fail_unless (gst_pad_push (mysrcpad, buffer) == GST_FLOW_OK);
+
+  msg = gst_bus_pop_filtered (bus, GST_MESSAGE_ELEMENT);
+  fail_unless (msg != NULL);
+  s = gst_message_get_structure (msg);
+  fail_unless (gst_structure_has_name (s, "multihandlesink-stats"));
+  clients = gst_structure_get_value (s, "clients");
+  fail_unless (clients != NULL);
+  fail_unless_equals_int (gst_value_array_get_size (clients), 1);
+
+  client = gst_value_get_structure (gst_value_array_get_value (clients, 0));
+  fail_unless (gst_structure_get_uint64 (client, "writes", &writes));
+  fail_unless (writes >= 1);
+  latency = gst_structure_get_value (client, "send-latency");
+  fail_unless (latency != NULL);
+  fail_unless_equals_int (gst_value_array_get_size (latency), 16);
+  gst_message_unref (msg);
+
+  GST_DEBUG ("cleaning up multifdsink");
+  ASSERT_SET_STATE (sink, GST_STATE_NULL, GST_STATE_CHANGE_SUCCESS);
+  gst_element_set_bus (sink, NULL);
+  gst_object_unref (bus);
+  cleanup_multifdsink (sink);
+
+  gst_caps_unref (caps);
+}
+
+GST_END_TEST;
+
 static Suite *
 multifdsink_suite (void)
 {
@@ -814,12 +996,15 @@ multifdsink_suite (void)
   tcase_add_test (tc_chain, test_no_clients);
   tcase_add_test (tc_chain, test_add_client);
   tcase_add_test (tc_chain, test_add_client_in_null_state);
+  tcase_add_test (tc_chain, test_render_list);
   tcase_add_test (tc_chain, test_streamheader);
   tcase_add_test (tc_chain, test_change_streamheader);
   tcase_add_test (tc_chain, test_burst_client_bytes);
   tcase_add_test (tc_chain, test_burst_client_bytes_keyframe);
   tcase_add_test (tc_chain, test_burst_client_bytes_with_keyframe);
   tcase_add_test (tc_chain, test_client_next_keyframe);
+  tcase_add_test (tc_chain, test_pacing);
+  tcase_add_test (tc_chain, test_stats_message);
 
   return s;
 }
@@ -200,6 +200,164 @@ GST_START_TEST (test_add_client)
 
 GST_END_TEST;
 
+/* all data still arrives when the TCP send options are set, they are ignored
+ * for local sockets */
+GST_START_TEST (test_cork)
+{
+  GstElement *sink;
+  GstBuffer *buffer;
+  GstCaps *caps;
+  gchar data[8];
+  GSocket *sinksocket, *srcsocket;
+  gboolean cork;
+  guint lowat;
+
+  sink = setup_multisocketsink ();
+  fail_unless (setup_handles (&sinksocket, &srcsocket));
+
+  g_object_set (sink, "cork", TRUE, "notsent-lowat", 16384, NULL);
+  g_object_get (sink, "cork", &cork, "notsent-lowat", &lowat, NULL);
+  fail_unless (cork);
+  fail_unless_equals_int (lowat, 16384);
+
+  ASSERT_SET_STATE (sink, GST_STATE_PLAYING, GST_STATE_CHANGE_ASYNC);
+
+  caps = gst_caps_from_string ("application/x-gst-check");
+  gst_check_setup_events (mysrcpad, sink, caps, GST_FORMAT_BYTES);
+
+  /* queue the buffers before the client is added, so that they are sent
+   * together */
+  buffer = gst_buffer_new_and_alloc (4);
+  gst_buffer_fill (buffer, 0, "dead", 4);
+  fail_unless (gst_pad_push (mysrcpad, buffer) == GST_FLOW_OK);
+  buffer = gst_buffer_new_and_alloc (4);
+  gst_buffer_fill (buffer, 0, "beef", 4);
+  fail_unless (gst_pad_push (mysrcpad, buffer) == GST_FLOW_OK);
+
+  g_signal_emit_by_name (sink, "add_full", sinksocket,
+      GST_SYNC_METHOD_BURST, GST_FORMAT_BUFFERS, (guint64) 2,
+      GST_FORMAT_BUFFERS, (guint64) 2);
+
+  GST_DEBUG ("reading");
+  fail_if (read_handle (srcsocket, data, 8) < 8);
+  fail_unless (strncmp (data, "deadbeef", 8) == 0);
+  wait_bytes_served (sink, 8);
+
+  GST_DEBUG ("cleaning up multisocketsink");
+  ASSERT_SET_STATE (sink, GST_STATE_NULL, GST_STATE_CHANGE_SUCCESS);
+  cleanup_multisocketsink (sink);
+
+  gst_caps_unref (caps);
+
+  g_object_unref (srcsocket);
+  g_object_unref (sinksocket);
+}
+
+GST_END_TEST;
+
+/* zerocopy falls back to normal writes for sockets that don't support it,
+ * like local ones */
+GST_START_TEST (test_zerocopy)
+{
+  GstElement *sink;
+  GstBuffer *buffer;
+  GstCaps *caps;
+  GSocket *sinksocket, *srcsocket;
+  gboolean zerocopy;
+  guint8 *data;
+  gsize size = 64 * 1024, got;
+  guint i;
+
+  sink = setup_multisocketsink ();
+  fail_unless (setup_handles (&sinksocket, &srcsocket));
+
+  g_object_set (sink, "zerocopy", TRUE, NULL);
+  g_object_get (sink, "zerocopy", &zerocopy, NULL);
+  fail_unless (zerocopy);
+
+  ASSERT_SET_STATE (sink, GST_STATE_PLAYING, GST_STATE_CHANGE_ASYNC);
+
+  caps = gst_caps_from_string ("application/x-gst-check");
+  gst_check_setup_events (mysrcpad, sink, caps, GST_FORMAT_BYTES);
+
+  g_signal_emit_by_name (sink, "add", sinksocket);
+
+  data = g_malloc (size);
+  for (i = 0; i < size; i++)
+    data[i] = i & 0xff;
+  buffer = gst_buffer_new_wrapped (g_memdup (data, size), size);
+  fail_unless (gst_pad_push (mysrcpad, buffer) == GST_FLOW_OK);
+
+  GST_DEBUG ("reading");
+  memset (data, 0, size);
+  for (got = 0; got < size;) {
+    gssize ret = read_handle (srcsocket, data + got, size - got);
+
+    fail_unless (ret > 0);
+    got += ret;
+  }
+  for (i = 0; i < size; i++)
+    fail_unless_equals_int (data[i], i & 0xff);
+  wait_bytes_served (sink, size);
+  g_free (data);
+
+  GST_DEBUG ("cleaning up multisocketsink");
+  ASSERT_SET_STATE (sink, GST_STATE_NULL, GST_STATE_CHANGE_SUCCESS);
+  cleanup_multisocketsink (sink);
+
+  gst_caps_unref (caps);
+
+  g_object_unref (srcsocket);
+  g_object_unref (sinksocket);
+}
+
+GST_END_TEST;
+
+/* clients spread over several threads all get the data */
+GST_START_TEST (test_add_client_threads)
+{
+  GstElement *sink;
+  GstBuffer *buffer;
+  GstCaps *caps;
+  GSocket *sinksocket[3], *srcsocket[3];
+  gint i;
+
+  sink = setup_multisocketsink ();
+  g_object_set (sink, "n-threads", 2, NULL);
+  for (i = 0; i < 3; i++)
+    fail_unless (setup_handles (&sinksocket[i], &srcsocket[i]));
+
+  ASSERT_SET_STATE (sink, GST_STATE_PLAYING, GST_STATE_CHANGE_ASYNC);
+
+  /* add the clients */
+  for (i = 0; i < 3; i++)
+    g_signal_emit_by_name (sink, "add", sinksocket[i]);
+  fail_unless_num_handles (sink, 3);
+
+  caps = gst_caps_from_string ("application/x-gst-check");
+  buffer = gst_buffer_new_and_alloc (4);
+  gst_check_setup_events (mysrcpad, sink, caps, GST_FORMAT_BYTES);
+  gst_buffer_fill (buffer, 0, "dead", 4);
+  fail_unless (gst_pad_push (mysrcpad, buffer) == GST_FLOW_OK);
+
+  for (i = 0; i < 3; i++)
+    fail_unless_read ("client", srcsocket[i], 4, "dead");
+  wait_bytes_served (sink, 12);
+
+  GST_DEBUG ("cleaning up multisocketsink");
+  ASSERT_SET_STATE (sink, GST_STATE_NULL, GST_STATE_CHANGE_SUCCESS);
+  cleanup_multisocketsink (sink);
+
+  gst_caps_unref (caps);
+
+  for (i = 0; i < 3; i++) {
+    g_object_unref (srcsocket[i]);
+    g_object_unref (sinksocket[i]);
+  }
+}
+
+GST_END_TEST;
+
 /* from the given two data buffers, create two streamheader buffers and
  * some caps that match it, and store them in the given pointers
  * returns  one ref to each of the buffers and the caps */
@@ -874,6 +1032,9 @@ multisocketsink_suite (void)
   suite_add_tcase (s, tc_chain);
   tcase_add_test (tc_chain, test_no_clients);
   tcase_add_test (tc_chain, test_add_client);
+  tcase_add_test (tc_chain, test_cork);
+  tcase_add_test (tc_chain, test_zerocopy);
+  tcase_add_test (tc_chain, test_add_client_threads);
   tcase_add_test (tc_chain, test_streamheader);
   tcase_add_test (tc_chain, test_change_streamheader);
   tcase_add_test (tc_chain, test_burst_client_bytes);
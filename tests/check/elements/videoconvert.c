@@ -27,8 +27,11 @@
 # include <valgrind/valgrind.h>
 #endif
 
+#include <string.h>
+
 #include <gst/check/gstcheck.h>
 #include <gst/video/video.h>
+#include <gst/allocators/allocators.h>
 
 static guint
 get_num_formats (void)
@@ -117,6 +120,255 @@ GST_START_TEST (test_template_formats)
 
 GST_END_TEST;
 
+static GstBuffer *handoff_buffer = NULL;
+
+static void
+handoff_buffer_cb (GstElement * fakesink, GstBuffer * buffer, GstPad * pad,
+    gpointer user_data)
+{
+  gst_buffer_replace (&handoff_buffer, buffer);
+}
+
+/* convert one frame of videotestsrc and return the output buffer */
+static GstBuffer *
+convert_frame (const gchar * in_format, const gchar * out_format,
+    const gchar * interlace_mode, guint n_threads)
+{
+  GstElement *pipeline, *sink;
+  GstMessage *msg;
+  GstBuffer *buffer;
+  gchar *desc;
+
+  desc = g_strdup_printf ("videotestsrc pattern=smpte num-buffers=1 ! "
+      "video/x-raw,format=%s,width=322,height=243,interlace-mode=%s ! "
+      "videoconvert n-threads=%u ! video/x-raw,format=%s ! "
+      "fakesink name=sink signal-handoffs=true", in_format, interlace_mode,
+      n_threads, out_format);
+  pipeline = gst_parse_launch (desc, NULL);
+  fail_unless (pipeline != NULL);
+  g_free (desc);
+
+  sink = gst_bin_get_by_name (GST_BIN (pipeline), "sink");
+  g_signal_connect (sink, "handoff", (GCallback) handoff_buffer_cb, NULL);
+  gst_object_unref (sink);
+
+  fail_unless (gst_element_set_state (pipeline,
+          GST_STATE_PLAYING) != GST_STATE_CHANGE_FAILURE);
+  msg = gst_bus_timed_pop_filtered (GST_ELEMENT_BUS (pipeline),
+      GST_CLOCK_TIME_NONE, GST_MESSAGE_EOS | GST_MESSAGE_ERROR);
+  fail_unless (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_EOS);
+  gst_message_unref (msg);
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+  gst_object_unref (pipeline);
+
+  buffer = handoff_buffer;
+  handoff_buffer = NULL;
+  fail_unless (buffer != NULL);
+
+  return buffer;
+}
+
+static void
+check_threaded_convert (const gchar * in_format, const gchar * out_format,
+    const gchar * interlace_mode)
+{
+  GstBuffer *ref, *buf;
+  GstMapInfo ref_map, map;
+  guint n_threads;
+
+  ref = convert_frame (in_format, out_format, interlace_mode, 1);
+  gst_buffer_map (ref, &ref_map, GST_MAP_READ);
+
+  for (n_threads = 2; n_threads <= 5; n_threads++) {
+    GST_DEBUG ("%s -> %s %s, %u threads", in_format, out_format,
+        interlace_mode, n_threads);
+    buf = convert_frame (in_format, out_format, interlace_mode, n_threads);
+    gst_buffer_map (buf, &map, GST_MAP_READ);
+    fail_unless_equals_int (map.size, ref_map.size);
+    fail_unless (memcmp (map.data, ref_map.data, map.size) == 0);
+    gst_buffer_unmap (buf, &map);
+    gst_buffer_unref (buf);
+  }
+
+  gst_buffer_unmap (ref, &ref_map);
+  gst_buffer_unref (ref);
+}
+
+GST_START_TEST (test_n_threads)
+{
+  /* generic path with chroma resampling */
+  check_threaded_convert ("I420", "BGRx", "progressive");
+  check_threaded_convert ("BGRx", "I420", "progressive");
+  check_threaded_convert ("I420", "BGRx", "interleaved");
+  check_threaded_convert ("NV12", "Y41B", "progressive");
+  /* fastpaths */
+  check_threaded_convert ("I420", "YUY2", "progressive");
+  check_threaded_convert ("I420", "YUY2", "interleaved");
+  check_threaded_convert ("YUY2", "I420", "progressive");
+}
+
+GST_END_TEST;
+
+static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS ("video/x-raw"));
+static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC, GST_PAD_ALWAYS, GST_STATIC_CAPS ("video/x-raw"));
+
+GST_START_TEST (test_passthrough_dmabuf)
+{
+  GstElement *videoconvert;
+  GstPad *mysrcpad, *mysinkpad;
+  GstBuffer *buf, *outbuf;
+  GstMemory *mem;
+  GstCaps *caps;
+  GstBus *bus;
+
+  videoconvert = gst_check_setup_element ("videoconvert");
+  mysrcpad = gst_check_setup_src_pad (videoconvert, &srctemplate);
+  mysinkpad = gst_check_setup_sink_pad (videoconvert, &sinktemplate);
+  bus = gst_bus_new ();
+  gst_element_set_bus (videoconvert, bus);
+  gst_pad_set_active (mysrcpad, TRUE);
+  gst_pad_set_active (mysinkpad, TRUE);
+
+  fail_unless (gst_element_set_state (videoconvert,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS);
+
+  caps = gst_caps_from_string ("video/x-raw, format=I420, width=320, "
+      "height=240, framerate=25/1");
+  gst_check_setup_events (mysrcpad, videoconvert, caps, GST_FORMAT_TIME);
+  gst_caps_unref (caps);
+
+  /* dmabuf memory without a valid fd can't be mapped, so any attempt to
+   * access the data on the passthrough path would fail */
+  mem = gst_dmabuf_allocator_alloc (NULL, -1, 320 * 240 * 3 / 2);
+  fail_unless (mem != NULL);
+  buf = gst_buffer_new ();
+  gst_buffer_append_memory (buf, mem);
+  GST_BUFFER_TIMESTAMP (buf) = 0;
+
+  fail_unless_equals_int (gst_pad_push (mysrcpad, buf), GST_FLOW_OK);
+
+  fail_unless_equals_int (g_list_length (buffers), 1);
+  outbuf = GST_BUFFER (buffers->data);
+  fail_unless_equals_int (gst_buffer_n_memory (outbuf), 1);
+  fail_unless (gst_buffer_peek_memory (outbuf, 0) == mem);
+  fail_unless (gst_bus_pop_filtered (bus, GST_MESSAGE_WARNING) == NULL);
+
+  gst_check_drop_buffers ();
+  gst_element_set_state (videoconvert, GST_STATE_NULL);
+  gst_bus_set_flushing (bus, TRUE);
+  gst_object_unref (bus);
+  gst_pad_set_active (mysrcpad, FALSE);
+  gst_pad_set_active (mysinkpad, FALSE);
+  gst_check_teardown_src_pad (videoconvert);
+  gst_check_teardown_sink_pad (videoconvert);
+  gst_check_teardown_element (videoconvert);
+}
+
+GST_END_TEST;
+
+static GstStaticPadTemplate bgrx_sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK, GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("video/x-raw, format=BGRx"));
+
+static void
+push_colorimetry_caps (GstPad * mysrcpad, const gchar * colorimetry)
+{
+  GstCaps *caps;
+
+  caps = gst_caps_new_simple ("video/x-raw", "format", G_TYPE_STRING, "I420",
+      "width", G_TYPE_INT, 16, "height", G_TYPE_INT, 16,
+      "framerate", GST_TYPE_FRACTION, 25, 1,
+      "colorimetry", G_TYPE_STRING, colorimetry, NULL);
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_caps (caps)));
+  gst_caps_unref (caps);
+}
+
+static GstBuffer *
+convert_saturated_frame (GstPad * mysrcpad)
+{
+  GstBuffer *buf, *outbuf;
+  GstMapInfo map;
+
+  /* saturated chroma so that the matrices give different colours */
+  buf = gst_buffer_new_allocate (NULL, 16 * 16 * 3 / 2, NULL);
+  gst_buffer_map (buf, &map, GST_MAP_WRITE);
+  memset (map.data, 128, 16 * 16);
+  memset (map.data + 16 * 16, 64, 8 * 8);
+  memset (map.data + 16 * 16 + 8 * 8, 192, 8 * 8);
+  gst_buffer_unmap (buf, &map);
+  GST_BUFFER_TIMESTAMP (buf) = 0;
+
+  fail_unless_equals_int (gst_pad_push (mysrcpad, buf), GST_FLOW_OK);
+  fail_unless_equals_int (g_list_length (buffers), 1);
+  outbuf = gst_buffer_ref (GST_BUFFER (buffers->data));
+  gst_check_drop_buffers ();
+
+  return outbuf;
+}
+
+static gboolean
+buffers_equal (GstBuffer * a, GstBuffer * b)
+{
+  GstMapInfo map;
+  gboolean res;
+
+  gst_buffer_map (b, &map, GST_MAP_READ);
+  res = gst_buffer_get_size (a) == map.size &&
+      gst_buffer_memcmp (a, 0, map.data, map.size) == 0;
+  gst_buffer_unmap (b, &map);
+
+  return res;
+}
+
+GST_START_TEST (test_colorimetry_renegotiation)
+{
+  GstElement *videoconvert;
+  GstPad *mysrcpad, *mysinkpad;
+  GstBuffer *out601, *out709, *outagain;
+  GstSegment segment;
+
+  videoconvert = gst_check_setup_element ("videoconvert");
+  mysrcpad = gst_check_setup_src_pad (videoconvert, &srctemplate);
+  mysinkpad = gst_check_setup_sink_pad (videoconvert, &bgrx_sinktemplate);
+  gst_pad_set_active (mysrcpad, TRUE);
+  gst_pad_set_active (mysinkpad, TRUE);
+
+  fail_unless (gst_element_set_state (videoconvert,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS);
+
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_stream_start ("test")));
+  push_colorimetry_caps (mysrcpad, "bt601");
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_segment (&segment)));
+  out601 = convert_saturated_frame (mysrcpad);
+
+  /* the converter made for bt601 must not be reused for bt709 */
+  push_colorimetry_caps (mysrcpad, "bt709");
+  out709 = convert_saturated_frame (mysrcpad);
+  fail_if (buffers_equal (out601, out709));
+
+  /* and switching back picks the bt601 one again */
+  push_colorimetry_caps (mysrcpad, "bt601");
+  outagain = convert_saturated_frame (mysrcpad);
+  fail_unless (buffers_equal (out601, outagain));
+
+  gst_buffer_unref (out601);
+  gst_buffer_unref (out709);
+  gst_buffer_unref (outagain);
+
+  gst_element_set_state (videoconvert, GST_STATE_NULL);
+  gst_pad_set_active (mysrcpad, FALSE);
+  gst_pad_set_active (mysinkpad, FALSE);
+  gst_check_teardown_src_pad (videoconvert);
+  gst_check_teardown_sink_pad (videoconvert);
+  gst_check_teardown_element (videoconvert);
+}
+
+GST_END_TEST;
+
 static Suite *
 videoconvert_suite (void)
 {
@@ -126,6 +378,9 @@ videoconvert_suite (void)
   suite_add_tcase (s, tc_chain);
 
   tcase_add_test (tc_chain, test_template_formats);
+  tcase_add_test (tc_chain, test_n_threads);
+  tcase_add_test (tc_chain, test_passthrough_dmabuf);
+  tcase_add_test (tc_chain, test_colorimetry_renegotiation);
 
   return s;
 }
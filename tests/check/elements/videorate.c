@@ -1133,6 +1133,53 @@ GST_START_TEST (test_rate)
 
 GST_END_TEST;
 
+/* frames that are late according to downstream QoS are not pushed */
+GST_START_TEST (test_qos)
+{
+  GstElement *videorate;
+  GstBuffer *first, *second, *outbuffer;
+  GstCaps *caps;
+
+  videorate = setup_videorate ();
+  g_object_set (videorate, "qos", TRUE, NULL);
+  fail_unless (gst_element_set_state (videorate,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  first = gst_buffer_new_and_alloc (4);
+  GST_BUFFER_TIMESTAMP (first) = 0;
+  gst_buffer_memset (first, 0, 1, 4);
+  caps = gst_caps_from_string (VIDEO_CAPS_STRING);
+  gst_check_setup_events (mysrcpad, videorate, caps, GST_FORMAT_TIME);
+  gst_caps_unref (caps);
+  fail_unless (gst_pad_push (mysrcpad, first) == GST_FLOW_OK);
+  fail_unless_equals_int (g_list_length (buffers), 0);
+
+  /* downstream can't show anything before 80ms */
+  gst_pad_push_event (mysinkpad, gst_event_new_qos (GST_QOS_TYPE_UNDERFLOW,
+          1.0, 0, GST_SECOND * 2 / 25));
+
+  /* this would normally output frames at 0, 40, 80 and 120ms, only the last
+   * one is still in time */
+  second = gst_buffer_new_and_alloc (4);
+  GST_BUFFER_TIMESTAMP (second) = GST_SECOND * 12 / 50;
+  gst_buffer_memset (second, 0, 2, 4);
+  fail_unless (gst_pad_push (mysrcpad, second) == GST_FLOW_OK);
+
+  fail_unless_equals_int (g_list_length (buffers), 1);
+  assert_videorate_stats (videorate, "qos", 2, 1, 3, 3);
+
+  outbuffer = buffers->data;
+  fail_unless_equals_uint64 (GST_BUFFER_TIMESTAMP (outbuffer),
+      GST_SECOND * 3 / 25);
+  fail_unless_equals_uint64 (GST_BUFFER_OFFSET (outbuffer), 0);
+  fail_unless (GST_BUFFER_FLAG_IS_SET (outbuffer, GST_BUFFER_FLAG_DISCONT));
+
+  cleanup_videorate (videorate);
+}
+
+GST_END_TEST;
+
 static Suite *
 videorate_suite (void)
 {
@@ -1152,6 +1199,7 @@ videorate_suite (void)
   tcase_add_loop_test (tc_chain, test_caps_negotiation,
       0, G_N_ELEMENTS (caps_negotiation_tests));
   tcase_add_test (tc_chain, test_rate);
+  tcase_add_test (tc_chain, test_qos);
 
   return s;
 }
@@ -971,6 +971,443 @@ GST_START_TEST (test_basetransform_negotiation)
 
 GST_END_TEST;
 
+static void
+on_sink_handoff_keep (GstElement * element, GstBuffer * buffer, GstPad * pad,
+    gpointer user_data)
+{
+  GstBuffer **out = user_data;
+
+  gst_buffer_replace (out, buffer);
+}
+
+/* runs @desc and returns the last buffer of the element named sink,
+ * @probe is installed on the src pad of the element named src */
+static GstBuffer *
+run_pipeline_for_buffer (const gchar * desc, GstPadProbeCallback probe,
+    gpointer probe_data)
+{
+  GstElement *pipeline, *sink;
+  GstMessage *msg;
+  GstBuffer *buffer = NULL;
+
+  pipeline = gst_parse_launch (desc, NULL);
+  fail_unless (pipeline != NULL);
+
+  if (probe) {
+    GstElement *src;
+    GstPad *pad;
+
+    src = gst_bin_get_by_name (GST_BIN (pipeline), "src");
+    pad = gst_element_get_static_pad (src, "src");
+    gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_BUFFER, probe, probe_data,
+        NULL);
+    gst_object_unref (pad);
+    gst_object_unref (src);
+  }
+
+  sink = gst_bin_get_by_name (GST_BIN (pipeline), "sink");
+  g_signal_connect (sink, "handoff", G_CALLBACK (on_sink_handoff_keep),
+      &buffer);
+  gst_object_unref (sink);
+
+  gst_element_set_state (pipeline, GST_STATE_PLAYING);
+  msg = gst_bus_timed_pop_filtered (GST_ELEMENT_BUS (pipeline), -1,
+      GST_MESSAGE_EOS | GST_MESSAGE_ERROR);
+  fail_unless_equals_int (GST_MESSAGE_TYPE (msg), GST_MESSAGE_EOS);
+  gst_message_unref (msg);
+
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+  gst_object_unref (pipeline);
+
+  fail_unless (buffer != NULL);
+  return buffer;
+}
+
+static GstBuffer *
+scale_with_threads (const gchar * format, gint method, guint n_threads)
+{
+  GstBuffer *buffer;
+  gchar *desc;
+
+  desc = g_strdup_printf ("videotestsrc num-buffers=1 pattern=smpte ! "
+      "video/x-raw,format=%s,width=320,height=240 ! "
+      "videoscale method=%d n-threads=%u ! video/x-raw,width=200,height=130 ! "
+      "fakesink name=sink signal-handoffs=true", format, method, n_threads);
+  buffer = run_pipeline_for_buffer (desc, NULL, NULL);
+  g_free (desc);
+
+  return buffer;
+}
+
+static void
+test_threads (gint method, const gchar ** formats)
+{
+  GstBuffer *ref, *buf;
+  GstMapInfo ref_map, map;
+  gint i;
+
+  for (i = 0; formats[i]; i++) {
+    GST_DEBUG ("testing format %s", formats[i]);
+
+    ref = scale_with_threads (formats[i], method, 1);
+    buf = scale_with_threads (formats[i], method, 4);
+
+    gst_buffer_map (ref, &ref_map, GST_MAP_READ);
+    gst_buffer_map (buf, &map, GST_MAP_READ);
+    /* the bands must give exactly the same output */
+    fail_unless_equals_int (ref_map.size, map.size);
+    fail_unless (memcmp (ref_map.data, map.data, map.size) == 0);
+    gst_buffer_unmap (buf, &map);
+    gst_buffer_unmap (ref, &ref_map);
+
+    gst_buffer_unref (ref);
+    gst_buffer_unref (buf);
+  }
+}
+
+GST_START_TEST (test_threads_method_2)
+{
+  static const gchar *formats[] = { "AYUV", "I420", "YUY2", "GRAY8", NULL };
+
+  test_threads (2, formats);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_threads_method_3)
+{
+  static const gchar *formats[] = { "AYUV", "ARGB64", "I420", "Y444", NULL };
+
+  test_threads (3, formats);
+}
+
+GST_END_TEST;
+
+static GstBuffer *
+scale_solid_color (const gchar * format, gint method, gint src_width,
+    gint src_height, gint dest_width, gint dest_height)
+{
+  GstBuffer *buffer;
+  gchar *desc;
+
+  desc = g_strdup_printf ("videotestsrc num-buffers=1 pattern=solid-color "
+      "foreground-color=0xff20c060 ! "
+      "video/x-raw,format=%s,width=%d,height=%d ! videoscale method=%d ! "
+      "video/x-raw,width=%d,height=%d ! "
+      "fakesink name=sink signal-handoffs=true", format, src_width,
+      src_height, method, dest_width, dest_height);
+  buffer = run_pipeline_for_buffer (desc, NULL, NULL);
+  g_free (desc);
+
+  return buffer;
+}
+
+/* scaling a solid color must give the same color, this checks that the
+ * components of the interleaved and 16 bits formats are not mixed up */
+static void
+test_solid_color (gint method)
+{
+  static const gchar *formats[] = { "NV12", "GRAY16_LE", "GRAY16_BE",
+    "AYUV64", NULL
+  };
+  static const gint sizes[][4] = {
+    {320, 240, 160, 120}, {160, 120, 320, 240}, {320, 240, 112, 80}
+  };
+  GstBuffer *ref, *buf;
+  GstMapInfo ref_map, map;
+  gint i, j;
+
+  for (i = 0; formats[i]; i++) {
+    for (j = 0; j < G_N_ELEMENTS (sizes); j++) {
+      GST_DEBUG ("testing format %s from %dx%d to %dx%d", formats[i],
+          sizes[j][0], sizes[j][1], sizes[j][2], sizes[j][3]);
+
+      ref = scale_solid_color (formats[i], method, sizes[j][2], sizes[j][3],
+          sizes[j][2], sizes[j][3]);
+      buf = scale_solid_color (formats[i], method, sizes[j][0], sizes[j][1],
+          sizes[j][2], sizes[j][3]);
+
+      gst_buffer_map (ref, &ref_map, GST_MAP_READ);
+      gst_buffer_map (buf, &map, GST_MAP_READ);
+      fail_unless_equals_int (ref_map.size, map.size);
+      fail_unless (memcmp (ref_map.data, map.data, map.size) == 0);
+      gst_buffer_unmap (buf, &map);
+      gst_buffer_unmap (ref, &ref_map);
+
+      gst_buffer_unref (ref);
+      gst_buffer_unref (buf);
+    }
+  }
+}
+
+GST_START_TEST (test_solid_color_method_0)
+{
+  test_solid_color (0);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_solid_color_method_1)
+{
+  test_solid_color (1);
+}
+
+GST_END_TEST;
+
+static GstPadProbeReturn
+add_crop_meta_probe (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
+{
+  GstBuffer **inbuf = user_data;
+  GstBuffer *buffer = GST_PAD_PROBE_INFO_BUFFER (info);
+  GstVideoCropMeta *crop;
+
+  buffer = gst_buffer_make_writable (buffer);
+  crop = gst_buffer_add_video_crop_meta (buffer);
+  crop->x = 80;
+  crop->y = 60;
+  crop->width = 160;
+  crop->height = 120;
+  GST_PAD_PROBE_INFO_DATA (info) = buffer;
+
+  gst_buffer_replace (inbuf, buffer);
+
+  return GST_PAD_PROBE_OK;
+}
+
+#define GRADIENT_SRC_WIDTH 20
+#define GRADIENT_DEST_WIDTH 13
+
+/* replaces the input with a horizontal GRAY16_LE gradient of 1000 per
+ * pixel */
+static GstPadProbeReturn
+fill_gradient_probe (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
+{
+  GstBuffer *buffer = GST_PAD_PROBE_INFO_BUFFER (info);
+  GstMapInfo map;
+  guint16 *p;
+  gint i;
+
+  buffer = gst_buffer_make_writable (buffer);
+  gst_buffer_map (buffer, &map, GST_MAP_WRITE);
+  p = (guint16 *) map.data;
+  for (i = 0; i < map.size / 2; i++)
+    p[i] = GUINT16_TO_LE ((i % GRADIENT_SRC_WIDTH) * 1000);
+  gst_buffer_unmap (buffer, &map);
+  GST_PAD_PROBE_INFO_DATA (info) = buffer;
+
+  return GST_PAD_PROBE_OK;
+}
+
+/* nearest picks the closest pixel for the 16 bits formats, like the C
+ * code did before orc was used: x of 32768 and above goes to the next one */
+GST_START_TEST (test_nearest_rounding_16bit)
+{
+  GstBuffer *outbuf;
+  GstMapInfo map;
+  gint i, j, x, acc, increment;
+  guint16 *p;
+
+  outbuf = run_pipeline_for_buffer ("videotestsrc name=src num-buffers=1 ! "
+      "video/x-raw,format=GRAY16_LE,width=20,height=1 ! videoscale method=0 ! "
+      "video/x-raw,width=13,height=1 ! fakesink name=sink signal-handoffs=true",
+      fill_gradient_probe, NULL);
+  fail_unless (outbuf != NULL);
+
+  increment = ((GRADIENT_SRC_WIDTH - 1) << 16) / (GRADIENT_DEST_WIDTH - 1);
+
+  gst_buffer_map (outbuf, &map, GST_MAP_READ);
+  p = (guint16 *) map.data;
+  for (i = 0, acc = 0; i < GRADIENT_DEST_WIDTH; i++, acc += increment) {
+    j = acc >> 16;
+    x = acc & 0xffff;
+    if (x >= 32768 && j + 1 < GRADIENT_SRC_WIDTH)
+      j++;
+    fail_unless_equals_int (GUINT16_FROM_LE (p[i]), j * 1000);
+  }
+  gst_buffer_unmap (outbuf, &map);
+
+  gst_buffer_unref (outbuf);
+}
+
+GST_END_TEST;
+
+/* scaling the 160x120 crop region to 160x120 with nearest must copy it */
+static void
+test_crop_meta (const gchar * element)
+{
+  GstBuffer *inbuf = NULL, *outbuf;
+  GstMapInfo in_map, out_map;
+  gchar *desc;
+  gint i;
+
+  desc = g_strdup_printf ("videotestsrc name=src num-buffers=1 "
+      "pattern=smpte ! video/x-raw,format=AYUV,width=320,height=240 ! %s method=0 ! "
+      "video/x-raw,width=160,height=120 ! "
+      "fakesink name=sink signal-handoffs=true", element);
+  outbuf = run_pipeline_for_buffer (desc, add_crop_meta_probe, &inbuf);
+  g_free (desc);
+
+  fail_unless (inbuf != NULL);
+  fail_unless (gst_buffer_get_video_crop_meta (outbuf) == NULL);
+
+  gst_buffer_map (inbuf, &in_map, GST_MAP_READ);
+  gst_buffer_map (outbuf, &out_map, GST_MAP_READ);
+  fail_unless_equals_int (out_map.size, 160 * 120 * 4);
+  for (i = 0; i < 120; i++) {
+    fail_unless (memcmp (out_map.data + i * 160 * 4,
+            in_map.data + (60 + i) * 320 * 4 + 80 * 4, 160 * 4) == 0);
+  }
+  gst_buffer_unmap (outbuf, &out_map);
+  gst_buffer_unmap (inbuf, &in_map);
+
+  gst_buffer_unref (inbuf);
+  gst_buffer_unref (outbuf);
+}
+
+GST_START_TEST (test_crop_meta_videoscale)
+{
+  test_crop_meta ("videoscale");
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_crop_meta_videoconvertscale)
+{
+  test_crop_meta ("videoconvertscale");
+}
+
+GST_END_TEST;
+
+static void
+test_convert_scale (gint method)
+{
+  GstElement *pipeline, *src, *sink, *scale, *capsfilter1, *capsfilter2;
+  GstMessage *msg;
+  GstCaps *caps;
+  guint n_buffers = 0;
+
+  pipeline = gst_pipeline_new (NULL);
+  src = gst_element_factory_make ("videotestsrc", NULL);
+  capsfilter1 = gst_element_factory_make ("capsfilter", NULL);
+  scale = gst_element_factory_make ("videoconvertscale", NULL);
+  capsfilter2 = gst_element_factory_make ("capsfilter", NULL);
+  sink = gst_element_factory_make ("fakesink", NULL);
+  fail_unless (pipeline && src && capsfilter1 && scale && capsfilter2 && sink);
+
+  g_object_set (src, "num-buffers", 3, NULL);
+  g_object_set (scale, "method", method, NULL);
+  g_object_set (sink, "signal-handoffs", TRUE, NULL);
+  g_signal_connect (sink, "handoff", G_CALLBACK (on_sink_handoff), &n_buffers);
+
+  caps = gst_caps_new_simple ("video/x-raw", "format", G_TYPE_STRING,
+      "I420", "width", G_TYPE_INT, 320,
+      "height", G_TYPE_INT, 240, "framerate", GST_TYPE_FRACTION, 30, 1,
+      "pixel-aspect-ratio", GST_TYPE_FRACTION, 1, 1, NULL);
+  g_object_set (capsfilter1, "caps", caps, NULL);
+  gst_caps_unref (caps);
+
+  /* different size and format, in one element */
+  caps = gst_caps_new_simple ("video/x-raw", "format", G_TYPE_STRING,
+      "YUY2", "width", G_TYPE_INT, 161,
+      "height", G_TYPE_INT, 121, NULL);
+  g_object_set (capsfilter2, "caps", caps, NULL);
+  gst_caps_unref (caps);
+
+  gst_bin_add_many (GST_BIN (pipeline), src, capsfilter1, scale, capsfilter2,
+      sink, NULL);
+  fail_unless (gst_element_link_many (src, capsfilter1, scale, capsfilter2,
+          sink, NULL));
+
+  fail_unless_equals_int (gst_element_set_state (pipeline, GST_STATE_PLAYING),
+      GST_STATE_CHANGE_ASYNC);
+
+  msg = gst_bus_timed_pop_filtered (GST_ELEMENT_BUS (pipeline), -1,
+      GST_MESSAGE_EOS | GST_MESSAGE_ERROR);
+  fail_unless_equals_int (GST_MESSAGE_TYPE (msg), GST_MESSAGE_EOS);
+  gst_message_unref (msg);
+
+  fail_unless_equals_int (n_buffers, 3);
+
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+  gst_object_unref (pipeline);
+}
+
+GST_START_TEST (test_convert_scale_method_0)
+{
+  test_convert_scale (0);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_convert_scale_method_1)
+{
+  test_convert_scale (1);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_convert_scale_method_2)
+{
+  test_convert_scale (2);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_convert_scale_method_3)
+{
+  test_convert_scale (3);
+}
+
+GST_END_TEST;
+
+/* white YUV input scaled to BGRx must be white with all the methods, which
+ * checks that the lines go through the color matrix */
+static void
+test_convert_scale_to_rgb (const gchar * format)
+{
+  GstBuffer *outbuf;
+  GstMapInfo map;
+  gchar *desc;
+  gint method, i;
+
+  for (method = 0; method < 4; method++) {
+    desc = g_strdup_printf ("videotestsrc num-buffers=1 pattern=white ! "
+        "video/x-raw,format=%s,width=64,height=48 ! "
+        "videoconvertscale method=%d ! "
+        "video/x-raw,format=BGRx,width=40,height=30 ! "
+        "fakesink name=sink signal-handoffs=true", format, method);
+    outbuf = run_pipeline_for_buffer (desc, NULL, NULL);
+    g_free (desc);
+
+    gst_buffer_map (outbuf, &map, GST_MAP_READ);
+    fail_unless_equals_int (map.size, 40 * 30 * 4);
+    for (i = 0; i < 40 * 30; i++) {
+      fail_unless (map.data[i * 4 + 0] >= 253, "method %d pixel %d: B %u",
+          method, i, map.data[i * 4 + 0]);
+      fail_unless (map.data[i * 4 + 1] >= 253, "method %d pixel %d: G %u",
+          method, i, map.data[i * 4 + 1]);
+      fail_unless (map.data[i * 4 + 2] >= 253, "method %d pixel %d: R %u",
+          method, i, map.data[i * 4 + 2]);
+    }
+    gst_buffer_unmap (outbuf, &map);
+    gst_buffer_unref (outbuf);
+  }
+}
+
+GST_START_TEST (test_convert_scale_I420_to_rgb)
+{
+  test_convert_scale_to_rgb ("I420");
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_convert_scale_AYUV64_to_rgb)
+{
+  test_convert_scale_to_rgb ("AYUV64");
+}
+
+GST_END_TEST;
+
 static Suite *
 videoscale_suite (void)
 {
@@ -1037,6 +1474,19 @@ videoscale_suite (void)
   tcase_add_test (tc_chain, test_reverse_negotiation);
 #endif
   tcase_add_test (tc_chain, test_basetransform_negotiation);
+  tcase_add_test (tc_chain, test_solid_color_method_0);
+  tcase_add_test (tc_chain, test_solid_color_method_1);
+  tcase_add_test (tc_chain, test_nearest_rounding_16bit);
+  tcase_add_test (tc_chain, test_threads_method_2);
+  tcase_add_test (tc_chain, test_threads_method_3);
+  tcase_add_test (tc_chain, test_crop_meta_videoscale);
+  tcase_add_test (tc_chain, test_crop_meta_videoconvertscale);
+  tcase_add_test (tc_chain, test_convert_scale_method_0);
+  tcase_add_test (tc_chain, test_convert_scale_method_1);
+  tcase_add_test (tc_chain, test_convert_scale_method_2);
+  tcase_add_test (tc_chain, test_convert_scale_method_3);
+  tcase_add_test (tc_chain, test_convert_scale_I420_to_rgb);
+  tcase_add_test (tc_chain, test_convert_scale_AYUV64_to_rgb);
 
   return s;
 }
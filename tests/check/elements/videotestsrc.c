@@ -32,6 +32,7 @@
 #include <unistd.h>
 
 #include <gst/check/gstcheck.h>
+#include <gst/video/video.h>
 
 /* For ease of programming we use globals to keep refs for our floating
  * src and sink pads we create; otherwise we always have to do get_pad,
@@ -366,6 +367,100 @@ GST_START_TEST (test_rgb_formats)
 
 GST_END_TEST;
 
+GST_START_TEST (test_static_pattern)
+{
+  GstElement *videotestsrc;
+  GstBuffer *buf1, *buf2;
+  GstMapInfo map1, map2;
+
+  videotestsrc = setup_videotestsrc ();
+  /* black */
+  g_object_set (videotestsrc, "pattern", 2, NULL);
+
+  fail_unless (gst_element_set_state (videotestsrc,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  g_mutex_lock (&check_mutex);
+  while (g_list_length (buffers) < 2) {
+    GST_DEBUG_OBJECT (videotestsrc, "Waiting for more buffers");
+    g_cond_wait (&check_cond, &check_mutex);
+  }
+  g_mutex_unlock (&check_mutex);
+
+  gst_element_set_state (videotestsrc, GST_STATE_READY);
+
+  buf1 = GST_BUFFER (buffers->data);
+  buf2 = GST_BUFFER (buffers->next->data);
+
+  /* the second frame is the first one again with new timestamps */
+  fail_unless (GST_BUFFER_TIMESTAMP (buf2) > GST_BUFFER_TIMESTAMP (buf1));
+  fail_unless_equals_uint64 (GST_BUFFER_OFFSET (buf2),
+      GST_BUFFER_OFFSET (buf1) + 1);
+
+  gst_buffer_map (buf1, &map1, GST_MAP_READ);
+  gst_buffer_map (buf2, &map2, GST_MAP_READ);
+  fail_unless (map1.data == map2.data);
+  fail_unless_equals_int (map1.size, map2.size);
+  gst_buffer_unmap (buf2, &map2);
+  gst_buffer_unmap (buf1, &map1);
+
+  /* cleanup */
+  cleanup_videotestsrc (videotestsrc);
+}
+
+GST_END_TEST;
+
+
+/* announces support for the video meta */
+static gboolean
+video_meta_query (GstPad * pad, GstObject * parent, GstQuery * query)
+{
+  if (GST_QUERY_TYPE (query) == GST_QUERY_ALLOCATION) {
+    gst_query_add_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL);
+    return TRUE;
+  }
+
+  return gst_pad_query_default (pad, parent, query);
+}
+
+GST_START_TEST (test_static_pattern_video_meta)
+{
+  GstElement *videotestsrc;
+  GstBuffer *buf1, *buf2;
+
+  videotestsrc = setup_videotestsrc ();
+  gst_pad_set_query_function (mysinkpad, video_meta_query);
+  /* black */
+  g_object_set (videotestsrc, "pattern", 2, NULL);
+
+  fail_unless (gst_element_set_state (videotestsrc,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  g_mutex_lock (&check_mutex);
+  while (g_list_length (buffers) < 2) {
+    GST_DEBUG_OBJECT (videotestsrc, "Waiting for more buffers");
+    g_cond_wait (&check_cond, &check_mutex);
+  }
+  g_mutex_unlock (&check_mutex);
+
+  gst_element_set_state (videotestsrc, GST_STATE_READY);
+
+  buf1 = GST_BUFFER (buffers->data);
+  buf2 = GST_BUFFER (buffers->next->data);
+
+  /* the cached frame comes from the video pool, its copies keep the meta */
+  fail_unless (gst_buffer_get_video_meta (buf1) != NULL);
+  fail_unless (gst_buffer_get_video_meta (buf2) != NULL);
+  fail_unless_equals_int (gst_buffer_get_video_meta (buf2)->format,
+      GST_VIDEO_FORMAT_UYVY);
+
+  /* cleanup */
+  cleanup_videotestsrc (videotestsrc);
+}
+
+GST_END_TEST;
 
 /* FIXME: add tests for YUV formats */
 
@@ -386,6 +481,8 @@ videotestsrc_suite (void)
 
   tcase_add_test (tc_chain, test_all_patterns);
   tcase_add_test (tc_chain, test_rgb_formats);
+  tcase_add_test (tc_chain, test_static_pattern);
+  tcase_add_test (tc_chain, test_static_pattern_video_meta);
 
   return s;
 }
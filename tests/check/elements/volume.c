@@ -1642,6 +1642,148 @@ GST_START_TEST (test_mute_f64)
 
 GST_END_TEST;
 
+GST_START_TEST (test_half_s16_not_writable)
+{
+  GstElement *volume;
+  GstBuffer *inbuffer;
+  GstBuffer *outbuffer;
+  GstCaps *caps;
+  gint16 in[2] = { 16384, -256 };
+  gint16 out[2] = { 8192, -128 };
+  GstMapInfo map;
+
+  volume = setup_volume ();
+  g_object_set (G_OBJECT (volume), "volume", 0.5, NULL);
+  fail_unless (gst_element_set_state (volume,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  inbuffer = gst_buffer_new_and_alloc (4);
+  gst_buffer_fill (inbuffer, 0, in, 4);
+  caps = gst_caps_from_string (VOLUME_CAPS_STRING_S16);
+  gst_check_setup_events (mysrcpad, volume, caps, GST_FORMAT_TIME);
+  gst_caps_unref (caps);
+  /* keep a reference, so that the buffer can't be changed in place */
+  gst_buffer_ref (inbuffer);
+  ASSERT_BUFFER_REFCOUNT (inbuffer, "inbuffer", 2);
+
+  fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+  /* the output went into a new buffer and the input is untouched */
+  ASSERT_BUFFER_REFCOUNT (inbuffer, "inbuffer", 1);
+  fail_unless_equals_int (g_list_length (buffers), 1);
+  fail_if ((outbuffer = (GstBuffer *) buffers->data) == NULL);
+  fail_if (inbuffer == outbuffer);
+  gst_buffer_map (outbuffer, &map, GST_MAP_READ);
+  fail_unless (memcmp (map.data, out, 4) == 0);
+  gst_buffer_unmap (outbuffer, &map);
+  gst_buffer_map (inbuffer, &map, GST_MAP_READ);
+  fail_unless (memcmp (map.data, in, 4) == 0);
+  gst_buffer_unmap (inbuffer, &map);
+  gst_buffer_unref (inbuffer);
+
+  /* cleanup */
+  cleanup_volume (volume);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_half_s24_not_writable)
+{
+  GstElement *volume;
+  GstBuffer *inbuffer;
+  GstBuffer *outbuffer;
+  GstCaps *caps;
+  gint32 in_32[2] = { 4194304, -4096 };
+  guint8 in[6];
+  GstMapInfo map;
+  gint32 res_32[2];
+  gint32 out_32[2] = { 2097152, -2048 };
+
+  write_unaligned_u24 (in, in_32[0]);
+  write_unaligned_u24 (in + 3, in_32[1]);
+
+  volume = setup_volume ();
+  g_object_set (G_OBJECT (volume), "volume", 0.5, NULL);
+  fail_unless (gst_element_set_state (volume,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  inbuffer = gst_buffer_new_and_alloc (6);
+  gst_buffer_fill (inbuffer, 0, in, 6);
+  caps = gst_caps_from_string (VOLUME_CAPS_STRING_S24);
+  gst_check_setup_events (mysrcpad, volume, caps, GST_FORMAT_TIME);
+  gst_caps_unref (caps);
+  gst_buffer_ref (inbuffer);
+
+  fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+  ASSERT_BUFFER_REFCOUNT (inbuffer, "inbuffer", 1);
+  fail_unless_equals_int (g_list_length (buffers), 1);
+  fail_if ((outbuffer = (GstBuffer *) buffers->data) == NULL);
+  fail_if (inbuffer == outbuffer);
+  gst_buffer_map (outbuffer, &map, GST_MAP_READ);
+
+  res_32[0] = get_unaligned_i24 (map.data);
+  res_32[1] = get_unaligned_i24 ((map.data + 3));
+
+  GST_INFO ("expected %+5d %+5d  real %+5d %+5d", out_32[0], out_32[1],
+      res_32[0], res_32[1]);
+  fail_unless (memcmp (res_32, out_32, 8) == 0);
+  gst_buffer_unmap (outbuffer, &map);
+  gst_buffer_map (inbuffer, &map, GST_MAP_READ);
+  fail_unless (memcmp (map.data, in, 6) == 0);
+  gst_buffer_unmap (inbuffer, &map);
+  gst_buffer_unref (inbuffer);
+
+  /* cleanup */
+  cleanup_volume (volume);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_mute_s16_not_writable)
+{
+  GstElement *volume;
+  GstBuffer *inbuffer;
+  GstBuffer *outbuffer;
+  GstCaps *caps;
+  gint16 in[2] = { 16384, -256 };
+  gint16 out[2] = { 0, 0 };
+  GstMapInfo map;
+
+  volume = setup_volume ();
+  g_object_set (G_OBJECT (volume), "mute", TRUE, NULL);
+  fail_unless (gst_element_set_state (volume,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  inbuffer = gst_buffer_new_and_alloc (4);
+  gst_buffer_fill (inbuffer, 0, in, 4);
+  caps = gst_caps_from_string (VOLUME_CAPS_STRING_S16);
+  gst_check_setup_events (mysrcpad, volume, caps, GST_FORMAT_TIME);
+  gst_caps_unref (caps);
+  gst_buffer_ref (inbuffer);
+
+  fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+  ASSERT_BUFFER_REFCOUNT (inbuffer, "inbuffer", 1);
+  fail_unless_equals_int (g_list_length (buffers), 1);
+  fail_if ((outbuffer = (GstBuffer *) buffers->data) == NULL);
+  fail_if (inbuffer == outbuffer);
+  fail_unless (GST_BUFFER_FLAG_IS_SET (outbuffer, GST_BUFFER_FLAG_GAP));
+  fail_if (GST_BUFFER_FLAG_IS_SET (inbuffer, GST_BUFFER_FLAG_GAP));
+  gst_buffer_map (outbuffer, &map, GST_MAP_READ);
+  fail_unless (memcmp (map.data, out, 4) == 0);
+  gst_buffer_unmap (outbuffer, &map);
+  gst_buffer_map (inbuffer, &map, GST_MAP_READ);
+  fail_unless (memcmp (map.data, in, 4) == 0);
+  gst_buffer_unmap (inbuffer, &map);
+  gst_buffer_unref (inbuffer);
+
+  /* cleanup */
+  cleanup_volume (volume);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_wrong_caps)
 {
   GstElement *volume;
@@ -1863,6 +2005,64 @@ GST_START_TEST (test_controller_defaults_at_ts0)
 GST_END_TEST;
 
 
+/* more channels than there are special cased ORC functions for */
+GST_START_TEST (test_controller_processing_multichannel)
+{
+  GstControlSource *cs;
+  GstTimedValueControlSource *tvcs;
+  GstElement *volume;
+  GstBuffer *inbuffer, *outbuffer;
+  GstCaps *caps;
+  gdouble *out, in[6] = { 1.0, 0.5, -1.0, 0.25, 0.125, -0.5 };
+  GstMapInfo map;
+  GstSegment seg;
+  gint i;
+
+  volume = setup_volume ();
+
+  cs = gst_interpolation_control_source_new ();
+  g_object_set (cs, "mode", GST_INTERPOLATION_MODE_LINEAR, NULL);
+  gst_object_add_control_binding (GST_OBJECT_CAST (volume),
+      gst_direct_control_binding_new (GST_OBJECT_CAST (volume), "volume", cs));
+
+  /* the value range for volume is 0.0 ... 10.0 */
+  tvcs = (GstTimedValueControlSource *) cs;
+  gst_timed_value_control_source_set (tvcs, 0 * GST_SECOND, 0.05);
+
+  fail_unless (gst_element_set_state (volume,
+          GST_STATE_PLAYING) == GST_STATE_CHANGE_SUCCESS,
+      "could not set to playing");
+
+  inbuffer = gst_buffer_new_and_alloc (sizeof (in));
+  gst_buffer_fill (inbuffer, 0, in, sizeof (in));
+  caps = gst_caps_new_simple ("audio/x-raw",
+      "format", G_TYPE_STRING, FORMATS7,
+      "layout", G_TYPE_STRING, "interleaved",
+      "rate", G_TYPE_INT, 44100, "channels", G_TYPE_INT, 3, NULL);
+  gst_check_setup_events (mysrcpad, volume, caps, GST_FORMAT_TIME);
+  GST_BUFFER_TIMESTAMP (inbuffer) = 0;
+  gst_caps_unref (caps);
+
+  gst_segment_init (&seg, GST_FORMAT_TIME);
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_segment (&seg)) == TRUE);
+
+  fail_unless (gst_pad_push (mysrcpad, inbuffer) == GST_FLOW_OK);
+  fail_unless_equals_int (g_list_length (buffers), 1);
+  fail_if ((outbuffer = (GstBuffer *) buffers->data) == NULL);
+  gst_buffer_map (outbuffer, &map, GST_MAP_READ);
+  out = (gdouble *) map.data;
+  for (i = 0; i < 6; i++)
+    fail_unless (ABS (out[i] - in[i] * 0.5) < 1e-9, "sample %d is %f, not %f",
+        i, out[i], in[i] * 0.5);
+  gst_buffer_unmap (outbuffer, &map);
+
+  gst_object_unref (cs);
+  cleanup_volume (volume);
+}
+
+GST_END_TEST;
+
 static Suite *
 volume_suite (void)
 {
@@ -1901,11 +2101,15 @@ volume_suite (void)
   tcase_add_test (tc_chain, test_double_f64);
   tcase_add_test (tc_chain, test_ten_f64);
   tcase_add_test (tc_chain, test_mute_f64);
+  tcase_add_test (tc_chain, test_half_s16_not_writable);
+  tcase_add_test (tc_chain, test_half_s24_not_writable);
+  tcase_add_test (tc_chain, test_mute_s16_not_writable);
   tcase_add_test (tc_chain, test_wrong_caps);
   tcase_add_test (tc_chain, test_passthrough);
   tcase_add_test (tc_chain, test_controller_usability);
   tcase_add_test (tc_chain, test_controller_processing);
   tcase_add_test (tc_chain, test_controller_defaults_at_ts0);
+  tcase_add_test (tc_chain, test_controller_processing_multichannel);
 
   return s;
 }
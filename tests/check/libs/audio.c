@@ -29,6 +29,7 @@
 
 #include <gst/audio/audio.h>
 #include <string.h>
+#include <math.h>
 
 GST_START_TEST (test_buffer_clipping_time)
 {
@@ -228,6 +229,75 @@ GST_START_TEST (test_buffer_clipping_time)
 
 GST_END_TEST;
 
+GST_START_TEST (test_buffer_clipping_with_meta)
+{
+  GstSegment s;
+  GstBuffer *buf;
+  GstBuffer *ret;
+  GstAudioClippingMeta *cmeta;
+  GstMapInfo map;
+  guint8 *data;
+
+  /* Clip start and end */
+  buf = gst_buffer_new ();
+  data = (guint8 *) g_malloc (1000);
+  gst_buffer_append_memory (buf,
+      gst_memory_new_wrapped (0, data, 1000, 0, 1000, data, g_free));
+
+  gst_segment_init (&s, GST_FORMAT_TIME);
+  s.start = 4 * GST_SECOND;
+  s.stop = 8 * GST_SECOND;
+  s.time = 4 * GST_SECOND;
+
+  GST_BUFFER_TIMESTAMP (buf) = 2 * GST_SECOND;
+  GST_BUFFER_DURATION (buf) = 10 * GST_SECOND;
+  GST_BUFFER_OFFSET (buf) = 200;
+  GST_BUFFER_OFFSET_END (buf) = 1200;
+
+  ret = gst_audio_buffer_clip_with_meta (buf, &s, 100, 1);
+  fail_unless (ret == buf);
+
+  /* nothing but the meta changes */
+  fail_unless (GST_BUFFER_TIMESTAMP (ret) == 2 * GST_SECOND);
+  fail_unless (GST_BUFFER_DURATION (ret) == 10 * GST_SECOND);
+  fail_unless (GST_BUFFER_OFFSET (ret) == 200);
+  fail_unless (GST_BUFFER_OFFSET_END (ret) == 1200);
+  gst_buffer_map (ret, &map, GST_MAP_READ);
+  fail_unless (map.data == data);
+  fail_unless (map.size == 1000);
+  gst_buffer_unmap (ret, &map);
+
+  cmeta = gst_buffer_get_audio_clipping_meta (ret);
+  fail_unless (cmeta != NULL);
+  fail_unless_equals_int (cmeta->format, GST_FORMAT_DEFAULT);
+  fail_unless_equals_uint64 (cmeta->start, 200);
+  fail_unless_equals_uint64 (cmeta->end, 400);
+
+  gst_buffer_unref (ret);
+
+  /* Nothing to clip, no meta */
+  buf = gst_buffer_new ();
+  data = (guint8 *) g_malloc (1000);
+  gst_buffer_append_memory (buf,
+      gst_memory_new_wrapped (0, data, 1000, 0, 1000, data, g_free));
+
+  gst_segment_init (&s, GST_FORMAT_TIME);
+  s.start = 0 * GST_SECOND;
+  s.stop = 20 * GST_SECOND;
+  s.time = 0 * GST_SECOND;
+
+  GST_BUFFER_TIMESTAMP (buf) = 2 * GST_SECOND;
+  GST_BUFFER_DURATION (buf) = 10 * GST_SECOND;
+
+  ret = gst_audio_buffer_clip_with_meta (buf, &s, 100, 1);
+  fail_unless (ret == buf);
+  fail_unless (gst_buffer_get_audio_clipping_meta (ret) == NULL);
+
+  gst_buffer_unref (ret);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_buffer_clipping_samples)
 {
   GstSegment s;
@@ -578,6 +648,54 @@ GST_START_TEST (test_multichannel_reorder)
 
 GST_END_TEST;
 
+GST_START_TEST (test_multichannel_reorder_formats)
+{
+  GstAudioChannelPosition from[3] = {
+    GST_AUDIO_CHANNEL_POSITION_FRONT_LEFT,
+    GST_AUDIO_CHANNEL_POSITION_FRONT_RIGHT,
+    GST_AUDIO_CHANNEL_POSITION_FRONT_CENTER
+  };
+  GstAudioChannelPosition to[3] = {
+    GST_AUDIO_CHANNEL_POSITION_FRONT_CENTER,
+    GST_AUDIO_CHANNEL_POSITION_FRONT_LEFT,
+    GST_AUDIO_CHANNEL_POSITION_FRONT_RIGHT
+  };
+  GstAudioFormat formats[] = {
+    GST_AUDIO_FORMAT_S8, GST_AUDIO_FORMAT_S16, GST_AUDIO_FORMAT_S24,
+    GST_AUDIO_FORMAT_F32, GST_AUDIO_FORMAT_F64
+  };
+  gint i, j, k;
+
+  for (i = 0; i < G_N_ELEMENTS (formats); i++) {
+    const GstAudioFormatInfo *info = gst_audio_format_get_info (formats[i]);
+    gint bps = GST_AUDIO_FORMAT_INFO_WIDTH (info) / 8;
+    guint8 *data, *expected;
+    gsize size = 5 * 3 * bps;
+
+    data = g_malloc (size);
+    expected = g_malloc (size);
+    for (j = 0; j < 5; j++) {
+      for (k = 0; k < bps; k++) {
+        data[(j * 3 + 0) * bps + k] = j * 3 + 0;
+        data[(j * 3 + 1) * bps + k] = j * 3 + 1;
+        data[(j * 3 + 2) * bps + k] = j * 3 + 2;
+        expected[(j * 3 + 0) * bps + k] = j * 3 + 2;
+        expected[(j * 3 + 1) * bps + k] = j * 3 + 0;
+        expected[(j * 3 + 2) * bps + k] = j * 3 + 1;
+      }
+    }
+
+    fail_unless (gst_audio_reorder_channels (data, size, formats[i], 3, from,
+            to));
+    fail_unless (memcmp (data, expected, size) == 0);
+
+    g_free (data);
+    g_free (expected);
+  }
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_audio_info)
 {
   GstAudioFormat fmt;
@@ -591,6 +709,376 @@ GST_START_TEST (test_audio_info)
 
 GST_END_TEST;
 
+GST_START_TEST (test_audio_info_from_caps_cached)
+{
+  GstAudioInfo info;
+  GstCaps *caps;
+
+  caps = gst_caps_new_simple ("audio/x-raw",
+      "format", G_TYPE_STRING, "S16LE", "layout", G_TYPE_STRING, "interleaved",
+      "rate", G_TYPE_INT, 44100, "channels", G_TYPE_INT, 2, NULL);
+
+  fail_unless (gst_audio_info_from_caps (&info, caps));
+  fail_unless (gst_audio_info_from_caps (&info, caps));
+  fail_unless_equals_int (GST_AUDIO_INFO_RATE (&info), 44100);
+  fail_unless_equals_int (GST_AUDIO_INFO_BPF (&info), 4);
+
+  /* the same caps changed in place must be parsed again */
+  gst_caps_set_simple (caps, "rate", G_TYPE_INT, 48000,
+      "format", G_TYPE_STRING, "F32LE", NULL);
+  fail_unless (gst_audio_info_from_caps (&info, caps));
+  fail_unless_equals_int (GST_AUDIO_INFO_RATE (&info), 48000);
+  fail_unless_equals_int (GST_AUDIO_INFO_BPF (&info), 8);
+
+  gst_caps_unref (caps);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_audio_converter)
+{
+  GstAudioInfo in_info, out_info;
+  GstAudioConverter *convert;
+  const GstStructure *config;
+  gint16 in[1024];
+  gint16 out16[2048];
+  gfloat out[1024];
+  guint threads;
+  gint i;
+
+  for (i = 0; i < G_N_ELEMENTS (in); i++)
+    in[i] = (i - 512) * 64;
+
+  gst_audio_info_set_format (&in_info, GST_AUDIO_FORMAT_S16, 44100, 1, NULL);
+  gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_F32, 44100, 1, NULL);
+
+  convert = gst_audio_converter_new (&in_info, &out_info,
+      gst_structure_new ("GstAudioConverter",
+          GST_AUDIO_CONVERTER_OPT_THREADS, G_TYPE_UINT, 2, NULL));
+  fail_unless (convert != NULL);
+
+  config = gst_audio_converter_get_config (convert);
+  fail_unless (gst_structure_get_uint (config,
+          GST_AUDIO_CONVERTER_OPT_THREADS, &threads));
+  fail_unless_equals_int (threads, 2);
+
+  fail_unless (gst_audio_converter_samples (convert, in, out,
+          G_N_ELEMENTS (in), FALSE));
+  for (i = 0; i < G_N_ELEMENTS (in); i++)
+    fail_unless (out[i] == in[i] / 32768.0);
+
+  gst_audio_converter_free (convert);
+
+  /* duplicate mono to stereo without dithering */
+  gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_S16, 44100, 2, NULL);
+
+  convert = gst_audio_converter_new (&in_info, &out_info,
+      gst_structure_new ("GstAudioConverter",
+          GST_AUDIO_CONVERTER_OPT_DITHER_METHOD, GST_TYPE_AUDIO_DITHER_METHOD,
+          GST_AUDIO_DITHER_NONE, NULL));
+  fail_unless (convert != NULL);
+
+  fail_unless (gst_audio_converter_samples (convert, in, out16,
+          G_N_ELEMENTS (in), FALSE));
+  for (i = 0; i < G_N_ELEMENTS (in); i++) {
+    fail_unless_equals_int (out16[2 * i], in[i]);
+    fail_unless_equals_int (out16[2 * i + 1], in[i]);
+  }
+
+  gst_audio_converter_free (convert);
+}
+
+GST_END_TEST;
+
+#define MIX_SAMPLES 64
+
+static const GstAudioChannelPosition pos_3_0[] = {
+  GST_AUDIO_CHANNEL_POSITION_FRONT_LEFT,
+  GST_AUDIO_CHANNEL_POSITION_FRONT_RIGHT,
+  GST_AUDIO_CHANNEL_POSITION_FRONT_CENTER
+};
+
+static const GstAudioChannelPosition pos_4_0[] = {
+  GST_AUDIO_CHANNEL_POSITION_FRONT_LEFT,
+  GST_AUDIO_CHANNEL_POSITION_FRONT_RIGHT,
+  GST_AUDIO_CHANNEL_POSITION_REAR_LEFT,
+  GST_AUDIO_CHANNEL_POSITION_REAR_RIGHT
+};
+
+static const GstAudioChannelPosition pos_5_1[] = {
+  GST_AUDIO_CHANNEL_POSITION_FRONT_LEFT,
+  GST_AUDIO_CHANNEL_POSITION_FRONT_RIGHT,
+  GST_AUDIO_CHANNEL_POSITION_FRONT_CENTER,
+  GST_AUDIO_CHANNEL_POSITION_LFE1,
+  GST_AUDIO_CHANNEL_POSITION_REAR_LEFT,
+  GST_AUDIO_CHANNEL_POSITION_REAR_RIGHT
+};
+
+/* the mixing kernels picked for the matrix must give the same result as
+ * multiplying every frame with the full matrix */
+GST_START_TEST (test_audio_converter_channel_mix)
+{
+  static const struct
+  {
+    gint in_channels;
+    const GstAudioChannelPosition *in_pos;
+    gint out_channels;
+    const GstAudioChannelPosition *out_pos;
+  } mixes[] = {
+    /* permute */
+    {
+    1, NULL, 2, NULL},
+        /* stereo to mono */
+    {
+    2, NULL, 1, NULL},
+        /* 5.1 to stereo */
+    {
+    6, pos_5_1, 2, NULL},
+        /* sparse */
+    {
+    3, pos_3_0, 2, NULL},
+        /* sparse with more output than input channels */
+    {
+    4, pos_4_0, 6, pos_5_1}
+  };
+  GstAudioInfo in_info, out_info;
+  GstAudioConverter *convert;
+  gdouble in[MIX_SAMPLES * 6], out[MIX_SAMPLES * 6];
+  gdouble matrix[6][6], res;
+  gint m, i, o, n, in_channels, out_channels;
+
+  for (m = 0; m < G_N_ELEMENTS (mixes); m++) {
+    in_channels = mixes[m].in_channels;
+    out_channels = mixes[m].out_channels;
+
+    gst_audio_info_set_format (&in_info, GST_AUDIO_FORMAT_F64, 44100,
+        in_channels, mixes[m].in_pos);
+    gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_F64, 44100,
+        out_channels, mixes[m].out_pos);
+    convert = gst_audio_converter_new (&in_info, &out_info, NULL);
+    fail_unless (convert != NULL);
+
+    /* get the full matrix from the output for one input channel at a time,
+     * scaling by 0.25 is exact */
+    for (i = 0; i < in_channels; i++) {
+      for (n = 0; n < in_channels; n++)
+        in[n] = (n == i) ? 0.25 : 0.0;
+      fail_unless (gst_audio_converter_samples (convert, in, out, 1, FALSE));
+      for (o = 0; o < out_channels; o++)
+        matrix[i][o] = out[o] * 4.0;
+    }
+
+    for (n = 0; n < MIX_SAMPLES * in_channels; n++)
+      in[n] = ((n * 37) % 101 - 50) / 80.0;
+    fail_unless (gst_audio_converter_samples (convert, in, out, MIX_SAMPLES,
+            FALSE));
+
+    for (n = 0; n < MIX_SAMPLES; n++) {
+      for (o = 0; o < out_channels; o++) {
+        res = 0.0;
+        for (i = 0; i < in_channels; i++)
+          res += in[n * in_channels + i] * matrix[i][o];
+        res = CLAMP (res, -1.0, 1.0);
+
+        fail_unless (ABS (out[n * out_channels + o] - res) < 1e-12,
+            "%d -> %d channels, frame %d channel %d: %f != %f", in_channels,
+            out_channels, n, o, out[n * out_channels + o], res);
+      }
+    }
+
+    gst_audio_converter_free (convert);
+  }
+}
+
+GST_END_TEST;
+
+#define QUANTIZE_SAMPLES 256
+
+static const gdouble ns_high_coeffs[] = {
+  2.08484, -2.92975, 3.27918, -3.31399, 2.61339, -1.72008, 0.876066, -0.340122
+};
+
+/* noise shapes one channel of @in into 16 bits, with an error history of
+ * its own */
+static void
+noise_shape_reference (GstAudioNoiseShapingMethod ns, const gdouble * in,
+    gint stride, gint16 * out)
+{
+  gdouble errors[8] = { 0.0, };
+  gdouble factor = 32767.0, tmp, orig, cur_error, q;
+  gint n, j;
+
+  for (n = 0; n < QUANTIZE_SAMPLES; n++) {
+    tmp = in[n * stride];
+    if (ns == GST_AUDIO_NOISE_SHAPING_ERROR_FEEDBACK) {
+      orig = tmp;
+      tmp -= errors[0];
+    } else {
+      cur_error = 0.0;
+      for (j = 0; j < 8; j++)
+        cur_error += errors[j] * ns_high_coeffs[j];
+      tmp -= cur_error;
+      orig = tmp;
+    }
+    q = floor (tmp * factor + 0.5);
+    q = CLAMP (q, -factor - 1, factor);
+    out[n] = (gint16) q;
+
+    if (ns == GST_AUDIO_NOISE_SHAPING_ERROR_FEEDBACK) {
+      errors[0] += q / factor - orig;
+    } else {
+      for (j = 7; j > 0; j--)
+        errors[j] = errors[j - 1];
+      errors[0] = q / factor - orig;
+    }
+  }
+}
+
+static GstAudioConverter *
+new_quantize_converter (GstAudioFormat in_format,
+    GstAudioDitherMethod dither, GstAudioNoiseShapingMethod ns)
+{
+  GstAudioInfo in_info, out_info;
+
+  gst_audio_info_set_format (&in_info, in_format, 44100, 2, NULL);
+  gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_S16, 44100, 2,
+      NULL);
+
+  return gst_audio_converter_new (&in_info, &out_info,
+      gst_structure_new ("GstAudioConverter",
+          GST_AUDIO_CONVERTER_OPT_DITHER_METHOD, GST_TYPE_AUDIO_DITHER_METHOD,
+          dither, GST_AUDIO_CONVERTER_OPT_NOISE_SHAPING_METHOD,
+          GST_TYPE_AUDIO_NOISE_SHAPING_METHOD, ns, NULL));
+}
+
+/* the quantizer must round and shape the noise like a plain per channel
+ * loop, and keep the dither noise within its range */
+GST_START_TEST (test_audio_converter_quantize)
+{
+  static const GstAudioDitherMethod dithers[] = {
+    GST_AUDIO_DITHER_RPDF, GST_AUDIO_DITHER_TPDF, GST_AUDIO_DITHER_TPDF_HF
+  };
+  static const GstAudioNoiseShapingMethod shapes[] = {
+    GST_AUDIO_NOISE_SHAPING_ERROR_FEEDBACK, GST_AUDIO_NOISE_SHAPING_HIGH
+  };
+  GstAudioConverter *convert;
+  gint32 in32[QUANTIZE_SAMPLES * 2];
+  gdouble in64[QUANTIZE_SAMPLES * 2];
+  gint16 out[QUANTIZE_SAMPLES * 2], expected[QUANTIZE_SAMPLES];
+  gint64 tmp;
+  gint i, n, c;
+  gboolean varies;
+
+  /* without dithering, add half a step and saturate */
+  for (n = 0; n < QUANTIZE_SAMPLES * 2; n++)
+    in32[n] = (gint32) (G_MININT32 + (guint32) n * 16843009u + n % 3);
+  in32[0] = G_MAXINT32;
+  in32[1] = G_MININT32;
+  in32[2] = 0x7fff8000;
+  in32[3] = -32769;
+
+  convert = new_quantize_converter (GST_AUDIO_FORMAT_S32,
+      GST_AUDIO_DITHER_NONE, GST_AUDIO_NOISE_SHAPING_NONE);
+  fail_unless (convert != NULL);
+  fail_unless (gst_audio_converter_samples (convert, in32, out,
+          QUANTIZE_SAMPLES, FALSE));
+  for (n = 0; n < QUANTIZE_SAMPLES * 2; n++) {
+    tmp = CLAMP ((gint64) in32[n] + 32768, G_MININT32, G_MAXINT32);
+    fail_unless_equals_int (out[n], tmp >> 16);
+  }
+  gst_audio_converter_free (convert);
+
+  /* the dither noise moves the output by at most one step */
+  for (n = 0; n < QUANTIZE_SAMPLES * 2; n++)
+    in32[n] = 0x12345678;
+
+  for (i = 0; i < G_N_ELEMENTS (dithers); i++) {
+    convert = new_quantize_converter (GST_AUDIO_FORMAT_S32, dithers[i],
+        GST_AUDIO_NOISE_SHAPING_NONE);
+    fail_unless (convert != NULL);
+    fail_unless (gst_audio_converter_samples (convert, in32, out,
+            QUANTIZE_SAMPLES, FALSE));
+
+    varies = FALSE;
+    for (n = 0; n < QUANTIZE_SAMPLES * 2; n++) {
+      fail_unless (out[n] >= 0x1233 && out[n] <= 0x1235,
+          "dither %d: %d out of range", dithers[i], out[n]);
+      if (out[n] != out[0])
+        varies = TRUE;
+    }
+    fail_unless (varies, "dither %d adds no noise", dithers[i]);
+    gst_audio_converter_free (convert);
+  }
+
+  /* noise shaping keeps the errors of the channels apart */
+  for (n = 0; n < QUANTIZE_SAMPLES; n++) {
+    in64[2 * n] = ((n * 37) % 101 - 50) / 60.0;
+    in64[2 * n + 1] = ((n * 53) % 97 - 48) / 60.0;
+  }
+
+  for (i = 0; i < G_N_ELEMENTS (shapes); i++) {
+    convert = new_quantize_converter (GST_AUDIO_FORMAT_F64,
+        GST_AUDIO_DITHER_NONE, shapes[i]);
+    fail_unless (convert != NULL);
+    fail_unless (gst_audio_converter_samples (convert, in64, out,
+            QUANTIZE_SAMPLES, FALSE));
+
+    for (c = 0; c < 2; c++) {
+      noise_shape_reference (shapes[i], in64 + c, 2, expected);
+      for (n = 0; n < QUANTIZE_SAMPLES; n++)
+        fail_unless (out[2 * n + c] == expected[n],
+            "noise shaping %d, channel %d sample %d: %d != %d", shapes[i], c,
+            n, out[2 * n + c], expected[n]);
+    }
+    gst_audio_converter_free (convert);
+  }
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_iec61937_payload)
+{
+  GstAudioRingBufferSpec spec = { 0, };
+  /* AC3 sync word, crc and an odd payload size to test the last byte */
+  static const guint8 src[] = { 0x0b, 0x77, 0x01, 0x02, 0x03, 0x07, 0x10,
+    0x11, 0x12
+  };
+  guint8 *dst;
+  gint dst_n, other_endianness, i;
+
+  spec.type = GST_AUDIO_RING_BUFFER_FORMAT_TYPE_AC3;
+  dst_n = gst_audio_iec61937_frame_size (&spec);
+  fail_unless_equals_int (dst_n, 1536 * 4);
+  dst = g_malloc (dst_n);
+
+  other_endianness = (G_BYTE_ORDER == G_LITTLE_ENDIAN) ?
+      G_BIG_ENDIAN : G_LITTLE_ENDIAN;
+
+  /* payload in our own byte order is copied */
+  fail_unless (gst_audio_iec61937_payload (src, sizeof (src), dst, dst_n,
+          &spec, G_BYTE_ORDER));
+  fail_unless (memcmp (dst + 8, src, sizeof (src)) == 0);
+  for (i = 8 + sizeof (src); i < dst_n; i++)
+    fail_unless_equals_int (dst[i], 0);
+
+  /* and swapped in the other byte order */
+  memset (dst, 0xff, dst_n);
+  fail_unless (gst_audio_iec61937_payload (src, sizeof (src), dst, dst_n,
+          &spec, other_endianness));
+  for (i = 0; i + 1 < sizeof (src); i += 2) {
+    fail_unless_equals_int (dst[8 + i], src[i + 1]);
+    fail_unless_equals_int (dst[8 + i + 1], src[i]);
+  }
+  fail_unless_equals_int (dst[8 + sizeof (src) - 1], 0);
+  fail_unless_equals_int (dst[8 + sizeof (src)], src[sizeof (src) - 1]);
+  for (i = 8 + sizeof (src) + 1; i < dst_n; i++)
+    fail_unless_equals_int (dst[i], 0);
+
+  g_free (dst);
+}
+
+GST_END_TEST;
+
 static Suite *
 audio_suite (void)
 {
@@ -600,10 +1088,17 @@ audio_suite (void)
 
   suite_add_tcase (s, tc_chain);
   tcase_add_test (tc_chain, test_audio_info);
+  tcase_add_test (tc_chain, test_audio_info_from_caps_cached);
   tcase_add_test (tc_chain, test_buffer_clipping_time);
   tcase_add_test (tc_chain, test_buffer_clipping_samples);
+  tcase_add_test (tc_chain, test_buffer_clipping_with_meta);
   tcase_add_test (tc_chain, test_multichannel_checks);
   tcase_add_test (tc_chain, test_multichannel_reorder);
+  tcase_add_test (tc_chain, test_multichannel_reorder_formats);
+  tcase_add_test (tc_chain, test_audio_converter);
+  tcase_add_test (tc_chain, test_audio_converter_channel_mix);
+  tcase_add_test (tc_chain, test_audio_converter_quantize);
+  tcase_add_test (tc_chain, test_iec61937_payload);
 
   return s;
 }
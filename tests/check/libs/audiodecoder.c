@@ -0,0 +1,237 @@
+/* GStreamer
+ *
+ * Copyright (C) 2013 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#include <gst/gst.h>
+#include <gst/check/gstcheck.h>
+#include <gst/audio/audio.h>
+
+static GstPad *mysrcpad, *mysinkpad;
+static GstElement *dec;
+static GstBufferPool *sink_pool;
+
+#define TEST_RATE 1000
+#define TEST_SAMPLES_PER_BUFFER 10
+#define TEST_OUTPUT_SIZE (TEST_SAMPLES_PER_BUFFER * 2)
+
+#define GST_AUDIO_DECODER_TESTER_TYPE gst_audio_decoder_tester_get_type()
+static GType gst_audio_decoder_tester_get_type (void);
+
+typedef struct _GstAudioDecoderTester GstAudioDecoderTester;
+typedef struct _GstAudioDecoderTesterClass GstAudioDecoderTesterClass;
+
+/* Decodes every input buffer into TEST_SAMPLES_PER_BUFFER mono S16 samples
+ * allocated with gst_audio_decoder_allocate_output_buffer() */
+struct _GstAudioDecoderTester
+{
+  GstAudioDecoder parent;
+};
+
+struct _GstAudioDecoderTesterClass
+{
+  GstAudioDecoderClass parent_class;
+};
+
+G_DEFINE_TYPE (GstAudioDecoderTester, gst_audio_decoder_tester,
+    GST_TYPE_AUDIO_DECODER);
+
+static gboolean
+gst_audio_decoder_tester_start (GstAudioDecoder * dec)
+{
+  return TRUE;
+}
+
+static gboolean
+gst_audio_decoder_tester_stop (GstAudioDecoder * dec)
+{
+  return TRUE;
+}
+
+static gboolean
+gst_audio_decoder_tester_set_format (GstAudioDecoder * dec, GstCaps * caps)
+{
+  GstAudioInfo info;
+
+  gst_audio_info_init (&info);
+  gst_audio_info_set_format (&info, GST_AUDIO_FORMAT_S16, TEST_RATE, 1, NULL);
+
+  return gst_audio_decoder_set_output_format (dec, &info);
+}
+
+static GstFlowReturn
+gst_audio_decoder_tester_handle_frame (GstAudioDecoder * dec,
+    GstBuffer * buffer)
+{
+  GstBuffer *output;
+
+  /* draining */
+  if (buffer == NULL)
+    return GST_FLOW_OK;
+
+  output = gst_audio_decoder_allocate_output_buffer (dec, TEST_OUTPUT_SIZE);
+  fail_unless (output != NULL);
+  gst_buffer_memset (output, 0, 0, TEST_OUTPUT_SIZE);
+
+  return gst_audio_decoder_finish_frame (dec, output, 1);
+}
+
+static void
+gst_audio_decoder_tester_class_init (GstAudioDecoderTesterClass * klass)
+{
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstAudioDecoderClass *audiodecoder_class = GST_AUDIO_DECODER_CLASS (klass);
+
+  static GstStaticPadTemplate sink_templ = GST_STATIC_PAD_TEMPLATE ("sink",
+      GST_PAD_SINK, GST_PAD_ALWAYS,
+      GST_STATIC_CAPS ("audio/x-test-custom"));
+
+  static GstStaticPadTemplate src_templ = GST_STATIC_PAD_TEMPLATE ("src",
+      GST_PAD_SRC, GST_PAD_ALWAYS,
+      GST_STATIC_CAPS ("audio/x-raw"));
+
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&sink_templ));
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&src_templ));
+
+  gst_element_class_set_metadata (element_class,
+      "AudioDecoderTester", "Decoder/Audio", "yep", "me");
+
+  audiodecoder_class->start = gst_audio_decoder_tester_start;
+  audiodecoder_class->stop = gst_audio_decoder_tester_stop;
+  audiodecoder_class->set_format = gst_audio_decoder_tester_set_format;
+  audiodecoder_class->handle_frame = gst_audio_decoder_tester_handle_frame;
+}
+
+static void
+gst_audio_decoder_tester_init (GstAudioDecoderTester * tester)
+{
+}
+
+static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS ("audio/x-raw"));
+
+static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC, GST_PAD_ALWAYS, GST_STATIC_CAPS ("audio/x-test-custom"));
+
+/* offers a pool with a single buffer, which stays in the buffers list of
+ * the check sink pad and so is never released */
+static gboolean
+sink_query (GstPad * pad, GstObject * parent, GstQuery * query)
+{
+  if (GST_QUERY_TYPE (query) == GST_QUERY_ALLOCATION) {
+    GstStructure *config;
+    GstCaps *caps;
+
+    gst_query_parse_allocation (query, &caps, NULL);
+
+    if (sink_pool == NULL) {
+      sink_pool = gst_buffer_pool_new ();
+      config = gst_buffer_pool_get_config (sink_pool);
+      gst_buffer_pool_config_set_params (config, caps, TEST_OUTPUT_SIZE, 1, 1);
+      fail_unless (gst_buffer_pool_set_config (sink_pool, config));
+    }
+    gst_query_add_allocation_pool (query, sink_pool, TEST_OUTPUT_SIZE, 1, 1);
+    return TRUE;
+  }
+
+  return gst_pad_query_default (pad, parent, query);
+}
+
+static void
+setup_audiodecodertester (void)
+{
+  dec = g_object_new (GST_AUDIO_DECODER_TESTER_TYPE, NULL);
+  mysrcpad = gst_check_setup_src_pad (dec, &srctemplate);
+  mysinkpad = gst_check_setup_sink_pad (dec, &sinktemplate);
+  gst_pad_set_query_function (mysinkpad, sink_query);
+}
+
+static void
+cleanup_audiodecodertest (void)
+{
+  gst_element_set_state (dec, GST_STATE_NULL);
+  gst_pad_set_active (mysrcpad, FALSE);
+  gst_pad_set_active (mysinkpad, FALSE);
+  gst_check_teardown_src_pad (dec);
+  gst_check_teardown_sink_pad (dec);
+  gst_check_teardown_element (dec);
+  gst_check_drop_buffers ();
+
+  if (sink_pool)
+    gst_object_unref (sink_pool);
+  sink_pool = NULL;
+}
+
+GST_START_TEST (audiodecoder_exhausted_pool)
+{
+  GstSegment segment;
+  guint i;
+
+  setup_audiodecodertester ();
+  gst_pad_set_active (mysrcpad, TRUE);
+  gst_element_set_state (dec, GST_STATE_PLAYING);
+  gst_pad_set_active (mysinkpad, TRUE);
+
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_stream_start ("test")));
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_caps (gst_caps_new_empty_simple
+              ("audio/x-test-custom"))));
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_segment (&segment)));
+
+  /* downstream keeps the only pool buffer, the following buffers are
+   * allocated instead of blocking on the pool */
+  for (i = 0; i < 3; i++) {
+    GstBuffer *buf = gst_buffer_new_and_alloc (1);
+
+    GST_BUFFER_PTS (buf) = gst_util_uint64_scale_int (i *
+        TEST_SAMPLES_PER_BUFFER, GST_SECOND, TEST_RATE);
+    GST_BUFFER_DURATION (buf) = gst_util_uint64_scale_int
+        (TEST_SAMPLES_PER_BUFFER, GST_SECOND, TEST_RATE);
+    fail_unless (gst_pad_push (mysrcpad, buf) == GST_FLOW_OK);
+  }
+  fail_unless_equals_int (g_list_length (buffers), 3);
+  fail_unless (sink_pool != NULL);
+  fail_unless (GST_BUFFER_CAST (buffers->data)->pool == sink_pool);
+  fail_unless (GST_BUFFER_CAST (buffers->next->data)->pool == NULL);
+
+  cleanup_audiodecodertest ();
+}
+
+GST_END_TEST;
+
+static Suite *
+gst_audiodecoder_suite (void)
+{
+  Suite *s = suite_create ("GstAudioDecoder");
+  TCase *tc = tcase_create ("general");
+
+  suite_add_tcase (s, tc);
+  tcase_add_test (tc, audiodecoder_exhausted_pool);
+
+  return s;
+}
+
+GST_CHECK_MAIN (gst_audiodecoder);
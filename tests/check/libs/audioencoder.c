@@ -0,0 +1,306 @@
+/* GStreamer
+ *
+ * Copyright (C) 2013 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#include <gst/gst.h>
+#include <gst/check/gstcheck.h>
+#include <gst/audio/audio.h>
+
+static GstPad *mysrcpad, *mysinkpad;
+static GstElement *enc;
+
+#define TEST_RATE 1000
+#define TEST_FRAME_SAMPLES 10
+#define TEST_FRAME_DURATION \
+    (GST_SECOND * TEST_FRAME_SAMPLES / TEST_RATE)
+
+#define GST_AUDIO_ENCODER_TESTER_TYPE gst_audio_encoder_tester_get_type()
+static GType gst_audio_encoder_tester_get_type (void);
+
+typedef struct _GstAudioEncoderTester GstAudioEncoderTester;
+typedef struct _GstAudioEncoderTesterClass GstAudioEncoderTesterClass;
+
+/* "Encodes" each frame of TEST_FRAME_SAMPLES mono S16 samples into one
+ * gint16 holding its first sample. Earlier frames take longer to encode,
+ * so that frames encoded in parallel complete out of order. */
+struct _GstAudioEncoderTester
+{
+  GstAudioEncoder parent;
+
+  gboolean independent;
+  GThread *streaming_thread;
+  /* set when handle_frame ran on another thread than the streaming one */
+  volatile gint other_thread;
+};
+
+struct _GstAudioEncoderTesterClass
+{
+  GstAudioEncoderClass parent_class;
+};
+
+G_DEFINE_TYPE (GstAudioEncoderTester, gst_audio_encoder_tester,
+    GST_TYPE_AUDIO_ENCODER);
+
+static gboolean
+gst_audio_encoder_tester_start (GstAudioEncoder * enc)
+{
+  GstAudioEncoderTester *tester = (GstAudioEncoderTester *) enc;
+
+  gst_audio_encoder_set_frame_independent (enc, tester->independent);
+  return TRUE;
+}
+
+static gboolean
+gst_audio_encoder_tester_stop (GstAudioEncoder * enc)
+{
+  return TRUE;
+}
+
+static gboolean
+gst_audio_encoder_tester_set_format (GstAudioEncoder * enc,
+    GstAudioInfo * info)
+{
+  GstCaps *caps;
+  gboolean res;
+
+  gst_audio_encoder_set_frame_samples_min (enc, TEST_FRAME_SAMPLES);
+  gst_audio_encoder_set_frame_samples_max (enc, TEST_FRAME_SAMPLES);
+
+  caps = gst_caps_new_empty_simple ("audio/x-test-custom");
+  res = gst_audio_encoder_set_output_format (enc, caps);
+  gst_caps_unref (caps);
+
+  return res;
+}
+
+static GstFlowReturn
+gst_audio_encoder_tester_handle_frame (GstAudioEncoder * enc,
+    GstBuffer * buffer)
+{
+  GstAudioEncoderTester *tester = (GstAudioEncoderTester *) enc;
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstMapInfo map;
+  const gint16 *samples;
+  gint n_samples, offset, len;
+
+  /* draining */
+  if (buffer == NULL)
+    return GST_FLOW_OK;
+
+  if (g_thread_self () != tester->streaming_thread)
+    g_atomic_int_set (&tester->other_thread, TRUE);
+
+  gst_buffer_map (buffer, &map, GST_MAP_READ);
+  samples = (const gint16 *) map.data;
+  n_samples = map.size / sizeof (gint16);
+
+  /* the last frame is incomplete when draining */
+  for (offset = 0; offset < n_samples && ret == GST_FLOW_OK; offset += len) {
+    GstBuffer *output;
+
+    len = MIN (TEST_FRAME_SAMPLES, n_samples - offset);
+    g_usleep ((4 - samples[offset] % 4) * 1000);
+
+    output = gst_audio_encoder_allocate_output_buffer (enc, sizeof (gint16));
+    gst_buffer_fill (output, 0, &samples[offset], sizeof (gint16));
+    ret = gst_audio_encoder_finish_frame (enc, output, len);
+  }
+  gst_buffer_unmap (buffer, &map);
+
+  return ret;
+}
+
+static void
+gst_audio_encoder_tester_class_init (GstAudioEncoderTesterClass * klass)
+{
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstAudioEncoderClass *audioencoder_class = GST_AUDIO_ENCODER_CLASS (klass);
+
+  static GstStaticPadTemplate sink_templ = GST_STATIC_PAD_TEMPLATE ("sink",
+      GST_PAD_SINK, GST_PAD_ALWAYS,
+      GST_STATIC_CAPS ("audio/x-raw"));
+
+  static GstStaticPadTemplate src_templ = GST_STATIC_PAD_TEMPLATE ("src",
+      GST_PAD_SRC, GST_PAD_ALWAYS,
+      GST_STATIC_CAPS ("audio/x-test-custom"));
+
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&sink_templ));
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&src_templ));
+
+  gst_element_class_set_metadata (element_class,
+      "AudioEncoderTester", "Encoder/Audio", "yep", "me");
+
+  audioencoder_class->start = gst_audio_encoder_tester_start;
+  audioencoder_class->stop = gst_audio_encoder_tester_stop;
+  audioencoder_class->set_format = gst_audio_encoder_tester_set_format;
+  audioencoder_class->handle_frame = gst_audio_encoder_tester_handle_frame;
+}
+
+static void
+gst_audio_encoder_tester_init (GstAudioEncoderTester * tester)
+{
+}
+
+static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS ("audio/x-test-custom"));
+
+static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC, GST_PAD_ALWAYS, GST_STATIC_CAPS ("audio/x-raw"));
+
+static void
+setup_audioencodertester (gboolean independent, guint n_threads)
+{
+  GstAudioEncoderTester *tester;
+
+  enc = g_object_new (GST_AUDIO_ENCODER_TESTER_TYPE, "n-threads", n_threads,
+      NULL);
+  tester = (GstAudioEncoderTester *) enc;
+  tester->independent = independent;
+  tester->streaming_thread = g_thread_self ();
+  mysrcpad = gst_check_setup_src_pad (enc, &srctemplate);
+  mysinkpad = gst_check_setup_sink_pad (enc, &sinktemplate);
+}
+
+static void
+cleanup_audioencodertest (void)
+{
+  gst_element_set_state (enc, GST_STATE_NULL);
+  gst_pad_set_active (mysrcpad, FALSE);
+  gst_pad_set_active (mysinkpad, FALSE);
+  gst_check_teardown_src_pad (enc);
+  gst_check_teardown_sink_pad (enc);
+  gst_check_teardown_element (enc);
+  gst_check_drop_buffers ();
+}
+
+/* pushes @n_samples samples, each holding the number of the frame it is
+ * in, starting at sample @first */
+static void
+push_samples (guint first, guint n_samples)
+{
+  GstBuffer *buf;
+  GstMapInfo map;
+  gint16 *samples;
+  guint i;
+
+  buf = gst_buffer_new_and_alloc (n_samples * sizeof (gint16));
+  gst_buffer_map (buf, &map, GST_MAP_WRITE);
+  samples = (gint16 *) map.data;
+  for (i = 0; i < n_samples; i++)
+    samples[i] = (first + i) / TEST_FRAME_SAMPLES;
+  gst_buffer_unmap (buf, &map);
+
+  GST_BUFFER_PTS (buf) = gst_util_uint64_scale_int (first, GST_SECOND,
+      TEST_RATE);
+  GST_BUFFER_DURATION (buf) = gst_util_uint64_scale_int (n_samples,
+      GST_SECOND, TEST_RATE);
+  fail_unless (gst_pad_push (mysrcpad, buf) == GST_FLOW_OK);
+}
+
+static void
+run_encoder (gboolean independent, guint n_threads)
+{
+  GstAudioInfo info;
+  GstSegment segment;
+  GList *l;
+  gint i;
+
+  setup_audioencodertester (independent, n_threads);
+  gst_pad_set_active (mysrcpad, TRUE);
+  gst_element_set_state (enc, GST_STATE_PLAYING);
+  gst_pad_set_active (mysinkpad, TRUE);
+
+  gst_audio_info_init (&info);
+  gst_audio_info_set_format (&info, GST_AUDIO_FORMAT_S16, TEST_RATE, 1, NULL);
+
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_stream_start ("test")));
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_caps (gst_audio_info_to_caps (&info))));
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_segment (&segment)));
+
+  /* 8 complete frames, then 4 complete frames and half a frame that is
+   * only encoded when draining at EOS */
+  push_samples (0, 8 * TEST_FRAME_SAMPLES);
+  push_samples (8 * TEST_FRAME_SAMPLES, 4 * TEST_FRAME_SAMPLES + 5);
+  fail_unless_equals_int (g_list_length (buffers), 12);
+
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_eos ()));
+  fail_unless_equals_int (g_list_length (buffers), 13);
+
+  /* the frames come out in input order with the timestamps of sequential
+   * encoding */
+  for (l = buffers, i = 0; l; l = l->next, i++) {
+    GstBuffer *buf = l->data;
+    gint16 number;
+
+    gst_buffer_extract (buf, 0, &number, sizeof (gint16));
+    fail_unless_equals_int (number, i);
+    fail_unless_equals_uint64 (GST_BUFFER_PTS (buf), i * TEST_FRAME_DURATION);
+  }
+  fail_unless_equals_uint64 (GST_BUFFER_DURATION (g_list_last
+          (buffers)->data), TEST_FRAME_DURATION / 2);
+}
+
+GST_START_TEST (audioencoder_parallel_order)
+{
+  run_encoder (TRUE, 4);
+
+  /* some frames were encoded by the worker threads */
+  fail_unless (g_atomic_int_get (&((GstAudioEncoderTester *)
+              enc)->other_thread));
+
+  cleanup_audioencodertest ();
+}
+
+GST_END_TEST;
+
+GST_START_TEST (audioencoder_parallel_dependent)
+{
+  /* without independent frames n-threads has no effect */
+  run_encoder (FALSE, 4);
+
+  fail_if (g_atomic_int_get (&((GstAudioEncoderTester *) enc)->other_thread));
+
+  cleanup_audioencodertest ();
+}
+
+GST_END_TEST;
+
+static Suite *
+gst_audioencoder_suite (void)
+{
+  Suite *s = suite_create ("GstAudioEncoder");
+  TCase *tc = tcase_create ("general");
+
+  suite_add_tcase (s, tc);
+  tcase_add_test (tc, audioencoder_parallel_order);
+  tcase_add_test (tc, audioencoder_parallel_dependent);
+
+  return s;
+}
+
+GST_CHECK_MAIN (gst_audioencoder);
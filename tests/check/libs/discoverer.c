@@ -182,6 +182,203 @@ GST_START_TEST (test_disco_missing_plugins)
 
 GST_END_TEST;
 
+GST_START_TEST (test_disco_parse_only)
+{
+  GError *err = NULL;
+  GstDiscoverer *dc;
+  GstDiscovererInfo *info;
+  GList *streams, *l;
+  gchar *uri, *path;
+
+  dc = gst_discoverer_new (10 * GST_SECOND, &err);
+  fail_unless (dc != NULL);
+  fail_unless (err == NULL);
+  g_object_set (dc, "parse-only", TRUE, NULL);
+
+  path = g_build_filename (GST_TEST_FILES_PATH, "theora-vorbis.ogg", NULL);
+  uri = gst_filename_to_uri (path, &err);
+  g_free (path);
+  fail_unless (err == NULL);
+
+  info = gst_discoverer_discover_uri (dc, uri, &err);
+  fail_unless (info != NULL);
+  /* in case we don't have the ogg demuxer */
+  if (err) {
+    GST_INFO ("result: %d", gst_discoverer_info_get_result (info));
+    g_error_free (err);
+    goto done;
+  }
+
+  /* no decoders were plugged, so the streams keep their encoded caps */
+  streams = gst_discoverer_info_get_stream_list (info);
+  fail_unless (streams != NULL);
+  for (l = streams; l; l = l->next) {
+    GstCaps *caps = gst_discoverer_stream_info_get_caps (l->data);
+    const gchar *name;
+
+    if (caps == NULL)
+      continue;
+    name = gst_structure_get_name (gst_caps_get_structure (caps, 0));
+    GST_INFO ("stream caps %" GST_PTR_FORMAT, caps);
+    fail_if (g_str_equal (name, "audio/x-raw"));
+    fail_if (g_str_equal (name, "video/x-raw"));
+    gst_caps_unref (caps);
+  }
+  gst_discoverer_stream_info_list_free (streams);
+
+done:
+  gst_discoverer_info_unref (info);
+  g_free (uri);
+  g_object_unref (dc);
+}
+
+GST_END_TEST;
+
+static void
+async_discovered_cb (GstDiscoverer * dc, GstDiscovererInfo * info,
+    GError * err, guint * n_discovered)
+{
+  fail_unless (info != NULL);
+  GST_INFO ("discovered %s: %d", gst_discoverer_info_get_uri (info),
+      gst_discoverer_info_get_result (info));
+  (*n_discovered)++;
+}
+
+static void
+async_finished_cb (GstDiscoverer * dc, GMainLoop * loop)
+{
+  g_main_loop_quit (loop);
+}
+
+GST_START_TEST (test_disco_cache)
+{
+  GError *err = NULL;
+  GstDiscoverer *dc;
+  GstDiscovererInfo *info, *cached;
+  GList *streams, *cached_streams, *l, *m;
+  gchar *uri, *path, *cache_dir;
+  const gchar *name;
+  GDir *dir;
+
+  cache_dir = g_dir_make_tmp ("discoverer-XXXXXX", &err);
+  fail_unless (cache_dir != NULL);
+  fail_unless (err == NULL);
+
+  path = g_build_filename (GST_TEST_FILES_PATH, "theora-vorbis.ogg", NULL);
+  uri = gst_filename_to_uri (path, &err);
+  g_free (path);
+  fail_unless (err == NULL);
+
+  dc = gst_discoverer_new (10 * GST_SECOND, &err);
+  fail_unless (dc != NULL);
+  fail_unless (err == NULL);
+  g_object_set (dc, "cache-directory", cache_dir, NULL);
+  info = gst_discoverer_discover_uri (dc, uri, &err);
+  g_object_unref (dc);
+  fail_unless (info != NULL);
+  /* in case we don't have the ogg demuxer */
+  if (err) {
+    GST_INFO ("result: %d", gst_discoverer_info_get_result (info));
+    g_error_free (err);
+    gst_discoverer_info_unref (info);
+    goto done;
+  }
+
+  /* a new discoverer using the same directory gets the stored result */
+  dc = gst_discoverer_new (10 * GST_SECOND, &err);
+  fail_unless (dc != NULL);
+  g_object_set (dc, "cache-directory", cache_dir, NULL);
+  cached = gst_discoverer_discover_uri (dc, uri, &err);
+  g_object_unref (dc);
+  fail_unless (cached != NULL);
+  fail_unless (err == NULL);
+
+  fail_unless_equals_int (gst_discoverer_info_get_result (cached),
+      GST_DISCOVERER_OK);
+  fail_unless_equals_string (gst_discoverer_info_get_uri (cached), uri);
+  fail_unless_equals_uint64 (gst_discoverer_info_get_duration (cached),
+      gst_discoverer_info_get_duration (info));
+  fail_unless_equals_int (gst_discoverer_info_get_seekable (cached),
+      gst_discoverer_info_get_seekable (info));
+
+  streams = gst_discoverer_info_get_stream_list (info);
+  cached_streams = gst_discoverer_info_get_stream_list (cached);
+  fail_unless_equals_int (g_list_length (cached_streams),
+      g_list_length (streams));
+  for (l = streams, m = cached_streams; l && m; l = l->next, m = m->next) {
+    GstCaps *caps, *cached_caps;
+
+    fail_unless (G_OBJECT_TYPE (m->data) == G_OBJECT_TYPE (l->data));
+    caps = gst_discoverer_stream_info_get_caps (l->data);
+    cached_caps = gst_discoverer_stream_info_get_caps (m->data);
+    fail_unless (gst_caps_is_equal (caps, cached_caps));
+    gst_caps_unref (caps);
+    gst_caps_unref (cached_caps);
+  }
+  gst_discoverer_stream_info_list_free (streams);
+  gst_discoverer_stream_info_list_free (cached_streams);
+
+  gst_discoverer_info_unref (cached);
+  gst_discoverer_info_unref (info);
+
+done:
+  dir = g_dir_open (cache_dir, 0, NULL);
+  while (dir && (name = g_dir_read_name (dir))) {
+    path = g_build_filename (cache_dir, name, NULL);
+    g_unlink (path);
+    g_free (path);
+  }
+  if (dir)
+    g_dir_close (dir);
+  g_rmdir (cache_dir);
+  g_free (cache_dir);
+  g_free (uri);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_disco_async_concurrent)
+{
+  const gchar *files[] = { "theora-vorbis.ogg", "test.mp3", "test.mkv",
+    "theora-vorbis.ogg", "partialframe.mjpeg"
+  };
+  GError *err = NULL;
+  GstDiscoverer *dc;
+  GMainLoop *loop;
+  guint n_discovered = 0;
+  gchar *uri, *path;
+  int i;
+
+  dc = gst_discoverer_new (10 * GST_SECOND, &err);
+  fail_unless (dc != NULL);
+  fail_unless (err == NULL);
+  g_object_set (dc, "max-concurrent", 3, NULL);
+
+  loop = g_main_loop_new (NULL, FALSE);
+  g_signal_connect (dc, "discovered", G_CALLBACK (async_discovered_cb),
+      &n_discovered);
+  g_signal_connect (dc, "finished", G_CALLBACK (async_finished_cb), loop);
+
+  gst_discoverer_start (dc);
+  for (i = 0; i < G_N_ELEMENTS (files); ++i) {
+    path = g_build_filename (GST_TEST_FILES_PATH, files[i], NULL);
+    uri = gst_filename_to_uri (path, &err);
+    g_free (path);
+    fail_unless (err == NULL);
+    fail_unless (gst_discoverer_discover_uri_async (dc, uri));
+    g_free (uri);
+  }
+
+  g_main_loop_run (loop);
+  fail_unless_equals_int (n_discovered, G_N_ELEMENTS (files));
+
+  gst_discoverer_stop (dc);
+  g_main_loop_unref (loop);
+  g_object_unref (dc);
+}
+
+GST_END_TEST;
+
 static Suite *
 discoverer_suite (void)
 {
@@ -195,6 +392,9 @@ discoverer_suite (void)
   tcase_add_test (tc_chain, test_disco_sync_reuse_mp3);
   tcase_add_test (tc_chain, test_disco_sync_reuse_timeout);
   tcase_add_test (tc_chain, test_disco_missing_plugins);
+  tcase_add_test (tc_chain, test_disco_parse_only);
+  tcase_add_test (tc_chain, test_disco_async_concurrent);
+  tcase_add_test (tc_chain, test_disco_cache);
   return s;
 }
 
@@ -401,6 +401,87 @@ GST_START_TEST (test_f32_22050hz)
 
 GST_END_TEST;
 
+GST_START_TEST (test_f32_window)
+{
+  GstFFTWindow windows[] = { GST_FFT_WINDOW_HANN, GST_FFT_WINDOW_HANN,
+    GST_FFT_WINDOW_BLACKMAN, GST_FFT_WINDOW_RECTANGULAR, GST_FFT_WINDOW_HANN
+  };
+  gint i, w;
+  gfloat *in;
+  GstFFTF32 *ctx;
+
+  in = g_new (gfloat, 64);
+  ctx = gst_fft_f32_new (64, FALSE);
+
+  /* the same instance must follow changes of the window function */
+  for (w = 0; w < G_N_ELEMENTS (windows); w++) {
+    for (i = 0; i < 64; i++)
+      in[i] = 1.0;
+
+    gst_fft_f32_window (ctx, in, windows[w]);
+
+    for (i = 0; i < 64; i++) {
+      gdouble expected = 1.0;
+
+      if (windows[w] == GST_FFT_WINDOW_HANN)
+        expected = 0.5 - 0.5 * cos (2.0 * G_PI * i / 64);
+      else if (windows[w] == GST_FFT_WINDOW_BLACKMAN)
+        expected = 0.42 - 0.5 * cos ((2.0 * i) / 64) +
+            0.08 * cos ((4.0 * i) / 64);
+
+      fail_unless (fabs (in[i] - expected) < 1e-6);
+    }
+  }
+
+  gst_fft_f32_free (ctx);
+  g_free (in);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_f32_interleaved)
+{
+  gint i, c;
+  gfloat *in, *chan;
+  GstFFTF32Complex *out, *chan_out;
+  GstFFTF32 *ctx;
+
+  in = g_new (gfloat, 2 * 64);
+  chan = g_new (gfloat, 64);
+  out = g_new (GstFFTF32Complex, 2 * 33);
+  chan_out = g_new (GstFFTF32Complex, 33);
+  ctx = gst_fft_f32_new (64, FALSE);
+
+  for (i = 0; i < 64; i++) {
+    in[2 * i] = sin (2.0 * G_PI * 4 * i / 64);
+    in[2 * i + 1] = cos (2.0 * G_PI * 11 * i / 64);
+  }
+
+  gst_fft_f32_fft_interleaved (ctx, in, 2, GST_FFT_WINDOW_HAMMING, out);
+
+  /* must be the same as doing each channel separately */
+  for (c = 0; c < 2; c++) {
+    for (i = 0; i < 64; i++)
+      chan[i] = in[2 * i + c];
+
+    gst_fft_f32_window (ctx, chan, GST_FFT_WINDOW_HAMMING);
+    gst_fft_f32_fft (ctx, chan, chan_out);
+
+    for (i = 0; i < 33; i++) {
+      fail_unless_equals_float (out[c * 33 + i].r, chan_out[i].r);
+      fail_unless_equals_float (out[c * 33 + i].i, chan_out[i].i);
+    }
+  }
+
+  gst_fft_f32_free (ctx);
+  g_free (in);
+  g_free (chan);
+  g_free (out);
+  g_free (chan_out);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_f64_0hz)
 {
   gint i;
@@ -538,6 +619,8 @@ fft_suite (void)
   tcase_add_test (tc_chain, test_f32_0hz);
   tcase_add_test (tc_chain, test_f32_11025hz);
   tcase_add_test (tc_chain, test_f32_22050hz);
+  tcase_add_test (tc_chain, test_f32_window);
+  tcase_add_test (tc_chain, test_f32_interleaved);
   tcase_add_test (tc_chain, test_f64_0hz);
   tcase_add_test (tc_chain, test_f64_11025hz);
   tcase_add_test (tc_chain, test_f64_22050hz);
@@ -25,6 +25,7 @@
 #include <gst/check/gstcheck.h>
 
 #include <gst/rtp/gstrtpbuffer.h>
+#include <gst/rtp/gstrtpbufferpool.h>
 #include <gst/rtp/gstrtphdrext.h>
 #include <gst/rtp/gstrtcpbuffer.h>
 #include <string.h>
@@ -148,6 +149,160 @@ GST_START_TEST (test_rtp_buffer)
 
 GST_END_TEST;
 
+GST_START_TEST (test_rtp_buffer_map_skip_padding)
+{
+  GstBuffer *buf;
+  GstMapInfo map;
+  GstRTPBuffer rtp = { NULL, };
+
+  buf = gst_rtp_buffer_new_allocate (16, 4, 0);
+
+  fail_unless (gst_rtp_buffer_map (buf, GST_MAP_READ, &rtp));
+  fail_unless_equals_int (gst_rtp_buffer_get_payload_len (&rtp), 16);
+  gst_rtp_buffer_unmap (&rtp);
+
+  /* the payload includes the padding when it is skipped */
+  fail_unless (gst_rtp_buffer_map (buf,
+          GST_MAP_READ | GST_RTP_BUFFER_MAP_FLAG_SKIP_PADDING, &rtp));
+  fail_unless (gst_rtp_buffer_get_padding (&rtp));
+  fail_unless_equals_int (gst_rtp_buffer_get_payload_len (&rtp), 20);
+  gst_rtp_buffer_unmap (&rtp);
+
+  /* an invalid padding length is not checked either */
+  gst_buffer_map (buf, &map, GST_MAP_WRITE);
+  map.data[map.size - 1] = 0xff;
+  gst_buffer_unmap (buf, &map);
+
+  fail_if (gst_rtp_buffer_map (buf, GST_MAP_READ, &rtp));
+  fail_unless (gst_rtp_buffer_map (buf,
+          GST_MAP_READ | GST_RTP_BUFFER_MAP_FLAG_SKIP_PADDING, &rtp));
+  fail_unless_equals_int (gst_rtp_buffer_get_seq (&rtp), 0);
+  gst_rtp_buffer_unmap (&rtp);
+
+  gst_buffer_unref (buf);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_rtp_buffer_list_set_headers)
+{
+  GstBufferList *list;
+  GstRTPBuffer rtp = { NULL, };
+  guint16 seqnum;
+  guint i;
+
+  list = gst_buffer_list_new ();
+  for (i = 0; i < 3; i++)
+    gst_buffer_list_add (list, gst_rtp_buffer_new_allocate (8, 0, 0));
+
+  seqnum = gst_rtp_buffer_list_set_headers (list, 0x12345678, 96, 65534,
+      1000, 10);
+  fail_unless_equals_int (seqnum, 1);
+
+  for (i = 0; i < 3; i++) {
+    fail_unless (gst_rtp_buffer_map (gst_buffer_list_get (list, i),
+            GST_MAP_READ, &rtp));
+    fail_unless_equals_int (gst_rtp_buffer_get_ssrc (&rtp), 0x12345678);
+    fail_unless_equals_int (gst_rtp_buffer_get_payload_type (&rtp), 96);
+    fail_unless_equals_int (gst_rtp_buffer_get_seq (&rtp),
+        (guint16) (65534 + i));
+    fail_unless_equals_int (gst_rtp_buffer_get_timestamp (&rtp), 1000 + i * 10);
+    gst_rtp_buffer_unmap (&rtp);
+  }
+
+  /* stops at a packet that is not RTP */
+  gst_buffer_list_insert (list, 1, gst_buffer_new_and_alloc (4));
+  seqnum = gst_rtp_buffer_list_set_headers (list, 0, 0, 10, 0, 0);
+  fail_unless_equals_int (seqnum, 11);
+
+  gst_buffer_list_unref (list);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_rtp_buffer_new_share_payload)
+{
+  GstBuffer *payload, *buf;
+  GstRTPBuffer rtp = { NULL, };
+  guint8 *data;
+
+  payload = gst_buffer_new_and_alloc (16);
+  gst_buffer_memset (payload, 0, 0xaa, 16);
+
+  buf = gst_rtp_buffer_new_share_payload (payload, 4, 8, 4, 2);
+  fail_unless_equals_int (gst_buffer_get_size (buf),
+      RTP_HEADER_LEN + 2 * 4 + 8 + 4);
+
+  /* the payload memory is shared, not copied */
+  fail_unless_equals_int (gst_buffer_n_memory (buf), 3);
+  fail_unless (gst_buffer_peek_memory (buf, 1)->parent ==
+      gst_buffer_peek_memory (payload, 0));
+
+  fail_unless (gst_rtp_buffer_map (buf, GST_MAP_READ, &rtp));
+  fail_unless (gst_rtp_buffer_get_padding (&rtp));
+  fail_unless_equals_int (gst_rtp_buffer_get_csrc_count (&rtp), 2);
+  fail_unless_equals_int (gst_rtp_buffer_get_payload_len (&rtp), 8);
+  data = gst_rtp_buffer_get_payload (&rtp);
+  fail_unless_equals_int (data[0], 0xaa);
+  fail_unless_equals_int (data[7], 0xaa);
+  gst_rtp_buffer_unmap (&rtp);
+
+  gst_buffer_unref (buf);
+  gst_buffer_unref (payload);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_rtp_buffer_pool)
+{
+  GstBufferPool *pool;
+  GstStructure *config;
+  GstBuffer *buf, *prev;
+  gsize offset, maxsize;
+
+  pool = gst_rtp_buffer_pool_new ();
+  fail_unless (GST_IS_RTP_BUFFER_POOL (pool));
+
+  config = gst_buffer_pool_get_config (pool);
+  gst_buffer_pool_config_set_params (config, NULL, 1400, 1, 0);
+  fail_unless (gst_buffer_pool_set_config (pool, config));
+  fail_unless (gst_buffer_pool_set_active (pool, TRUE));
+
+  fail_unless (gst_buffer_pool_acquire_buffer (pool, &buf,
+          NULL) == GST_FLOW_OK);
+  fail_unless_equals_int (gst_buffer_get_size (buf), 1400);
+
+  /* shrink to a packet and append a payload memory */
+  gst_buffer_resize (buf, 4, 12);
+  gst_buffer_append_memory (buf, gst_allocator_alloc (NULL, 100, NULL));
+  fail_unless_equals_int (gst_buffer_n_memory (buf), 2);
+  prev = buf;
+  gst_buffer_unref (buf);
+
+  /* the buffer comes back with its full size and only the first memory */
+  fail_unless (gst_buffer_pool_acquire_buffer (pool, &buf,
+          NULL) == GST_FLOW_OK);
+  fail_unless (buf == prev);
+  fail_unless_equals_int (gst_buffer_n_memory (buf), 1);
+  fail_unless_equals_int (gst_buffer_get_sizes (buf, &offset, &maxsize),
+      1400);
+  fail_unless_equals_int (offset, 0);
+
+  /* a first memory that is too small is replaced */
+  gst_buffer_replace_all_memory (buf, gst_allocator_alloc (NULL, 10, NULL));
+  gst_buffer_unref (buf);
+  fail_unless (gst_buffer_pool_acquire_buffer (pool, &buf,
+          NULL) == GST_FLOW_OK);
+  fail_unless_equals_int (gst_buffer_n_memory (buf), 1);
+  fail_unless_equals_int (gst_buffer_get_size (buf), 1400);
+  gst_buffer_unref (buf);
+
+  fail_unless (gst_buffer_pool_set_active (pool, FALSE));
+  gst_object_unref (pool);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_rtp_buffer_validate_corrupt)
 {
   GstBuffer *buf;
@@ -388,6 +543,90 @@ GST_START_TEST (test_rtp_buffer_set_extension_data)
 
 GST_END_TEST;
 
+GST_START_TEST (test_rtp_buffer_get_extension_headers)
+{
+  GstBuffer *buf;
+  GstRTPBuffer rtp = { NULL };
+  GstRTPHeaderExtension exts[2];
+  guint8 misc_data[4] = { 1, 2, 3, 4 };
+  guint8 new_data[4] = { 5, 6, 7, 8 };
+  guint8 appbits = 0xff;
+  gpointer pointer;
+  guint size;
+
+  /* one byte header */
+  buf = gst_rtp_buffer_new_allocate (20, 0, 0);
+  gst_rtp_buffer_map (buf, GST_MAP_READWRITE, &rtp);
+
+  fail_unless (gst_rtp_buffer_get_extension_headers (&rtp, &appbits, exts,
+          2) == 0);
+
+  fail_unless (gst_rtp_buffer_add_extension_onebyte_header (&rtp, 5,
+          misc_data, 2) == TRUE);
+  fail_unless (gst_rtp_buffer_add_extension_onebyte_header (&rtp, 6,
+          misc_data, 4) == TRUE);
+  fail_unless (gst_rtp_buffer_add_extension_onebyte_header (&rtp, 7,
+          misc_data, 1) == TRUE);
+
+  fail_unless (gst_rtp_buffer_get_extension_headers (&rtp, &appbits, NULL,
+          0) == 3);
+  fail_unless (gst_rtp_buffer_get_extension_headers (&rtp, &appbits, exts,
+          2) == 3);
+  fail_unless (appbits == 0);
+  fail_unless (exts[0].id == 5);
+  fail_unless (exts[0].size == 2);
+  fail_unless (memcmp (exts[0].data, misc_data, 2) == 0);
+  fail_unless (exts[1].id == 6);
+  fail_unless (exts[1].size == 4);
+  fail_unless (memcmp (exts[1].data, misc_data, 4) == 0);
+
+  /* in place updates need the same size */
+  fail_unless (gst_rtp_buffer_set_extension_onebyte_header (&rtp, 6, 0,
+          new_data, 2) == FALSE);
+  fail_unless (gst_rtp_buffer_set_extension_onebyte_header (&rtp, 8, 0,
+          new_data, 4) == FALSE);
+  fail_unless (gst_rtp_buffer_set_extension_onebyte_header (&rtp, 6, 0,
+          new_data, 4) == TRUE);
+  fail_unless (gst_rtp_buffer_get_extension_onebyte_header (&rtp, 6, 0,
+          &pointer, &size) == TRUE);
+  fail_unless (pointer == exts[1].data);
+  fail_unless (size == 4);
+  fail_unless (memcmp (pointer, new_data, 4) == 0);
+  fail_unless (gst_rtp_buffer_get_extension_onebyte_header (&rtp, 5, 0,
+          &pointer, &size) == TRUE);
+  fail_unless (memcmp (pointer, misc_data, 2) == 0);
+
+  gst_rtp_buffer_unmap (&rtp);
+  gst_buffer_unref (buf);
+
+  /* two bytes header */
+  buf = gst_rtp_buffer_new_allocate (20, 0, 0);
+  gst_rtp_buffer_map (buf, GST_MAP_READWRITE, &rtp);
+
+  fail_unless (gst_rtp_buffer_add_extension_twobytes_header (&rtp, 3, 5,
+          misc_data, 2) == TRUE);
+  fail_unless (gst_rtp_buffer_add_extension_twobytes_header (&rtp, 3, 6,
+          misc_data, 4) == TRUE);
+
+  fail_unless (gst_rtp_buffer_get_extension_headers (&rtp, &appbits, exts,
+          2) == 2);
+  fail_unless (appbits == 3);
+  fail_unless (exts[0].id == 5);
+  fail_unless (exts[0].size == 2);
+  fail_unless (exts[1].id == 6);
+  fail_unless (exts[1].size == 4);
+
+  fail_unless (gst_rtp_buffer_set_extension_twobytes_header (&rtp, 5, 0,
+          new_data, 2) == TRUE);
+  fail_unless (memcmp (exts[0].data, new_data, 2) == 0);
+  fail_unless (memcmp (exts[1].data, misc_data, 4) == 0);
+
+  gst_rtp_buffer_unmap (&rtp);
+  gst_buffer_unref (buf);
+}
+
+GST_END_TEST;
+
 #if 0
 GST_START_TEST (test_rtp_buffer_list_set_extension)
 {
@@ -759,6 +998,92 @@ GST_START_TEST (test_rtcp_buffer)
 
 GST_END_TEST;
 
+GST_START_TEST (test_rtcp_packet_add_rbs)
+{
+  GstBuffer *buf;
+  GstRTCPPacket packet;
+  GstRTCPBuffer rtcp = { NULL, };
+  GstRTCPReportBlock blocks[40];
+  guint i, added;
+
+  for (i = 0; i < G_N_ELEMENTS (blocks); i++) {
+    blocks[i].ssrc = 0x10000 + i;
+    blocks[i].fractionlost = i;
+    blocks[i].packetslost = -1 - (gint) i;
+    blocks[i].exthighestseq = 1000 + i;
+    blocks[i].jitter = 2000 + i;
+    blocks[i].lsr = 3000 + i;
+    blocks[i].dlsr = 4000 + i;
+  }
+
+  buf = gst_rtcp_buffer_new (1400);
+  gst_rtcp_buffer_map (buf, GST_MAP_READWRITE, &rtcp);
+
+  /* the first packet takes the maximum amount of report blocks */
+  fail_unless (gst_rtcp_buffer_add_packet (&rtcp, GST_RTCP_TYPE_RR, &packet));
+  gst_rtcp_packet_rr_set_ssrc (&packet, 0x44556677);
+  fail_unless (gst_rtcp_packet_add_rb (&packet, 0x1234, 0, 0, 0, 0, 0, 0));
+  added = gst_rtcp_packet_add_rbs (&packet, blocks, G_N_ELEMENTS (blocks));
+  fail_unless_equals_int (added, GST_RTCP_MAX_RB_COUNT - 1);
+  fail_unless_equals_int (gst_rtcp_packet_get_rb_count (&packet),
+      GST_RTCP_MAX_RB_COUNT);
+  fail_unless_equals_int (gst_rtcp_packet_get_length (&packet),
+      1 + 6 * GST_RTCP_MAX_RB_COUNT);
+
+  /* the remaining blocks go in a second packet */
+  fail_unless (gst_rtcp_buffer_add_packet (&rtcp, GST_RTCP_TYPE_RR, &packet));
+  fail_unless_equals_int (gst_rtcp_packet_add_rbs (&packet, blocks + added,
+          G_N_ELEMENTS (blocks) - added), G_N_ELEMENTS (blocks) - added);
+  fail_unless_equals_int (gst_rtcp_packet_get_rb_count (&packet),
+      G_N_ELEMENTS (blocks) - added);
+
+  fail_unless_equals_int (gst_rtcp_buffer_get_packet_count (&rtcp), 2);
+
+  /* check the values of some blocks */
+  fail_unless (gst_rtcp_buffer_get_first_packet (&rtcp, &packet));
+  {
+    guint32 ssrc, exthighestseq, jitter, lsr, dlsr;
+    guint8 fractionlost;
+    gint32 packetslost;
+
+    gst_rtcp_packet_get_rb (&packet, 1, &ssrc, &fractionlost, &packetslost,
+        &exthighestseq, &jitter, &lsr, &dlsr);
+    fail_unless_equals_int (ssrc, 0x10000);
+    fail_unless_equals_int (fractionlost, 0);
+    fail_unless_equals_int (packetslost, -1);
+    fail_unless_equals_int (exthighestseq, 1000);
+    fail_unless_equals_int (jitter, 2000);
+    fail_unless_equals_int (lsr, 3000);
+    fail_unless_equals_int (dlsr, 4000);
+
+    fail_unless (gst_rtcp_packet_move_to_next (&packet));
+    gst_rtcp_packet_get_rb (&packet, 0, &ssrc, &fractionlost, &packetslost,
+        &exthighestseq, &jitter, &lsr, &dlsr);
+    fail_unless_equals_int (ssrc, 0x10000 + added);
+    fail_unless_equals_int (fractionlost, added);
+    fail_unless_equals_int (packetslost, -1 - (gint) added);
+    fail_unless_equals_int (dlsr, 4000 + added);
+  }
+  gst_rtcp_buffer_unmap (&rtcp);
+
+  fail_unless (gst_rtcp_buffer_validate (buf));
+  gst_buffer_unref (buf);
+
+  /* the MTU limits the amount of blocks */
+  buf = gst_rtcp_buffer_new (100);
+  gst_rtcp_buffer_map (buf, GST_MAP_READWRITE, &rtcp);
+  fail_unless (gst_rtcp_buffer_add_packet (&rtcp, GST_RTCP_TYPE_RR, &packet));
+  fail_unless_equals_int (gst_rtcp_packet_add_rbs (&packet, blocks,
+          G_N_ELEMENTS (blocks)), 3);
+  fail_unless_equals_int (gst_rtcp_packet_add_rbs (&packet, blocks,
+          G_N_ELEMENTS (blocks)), 0);
+  gst_rtcp_buffer_unmap (&rtcp);
+  fail_unless_equals_int (gst_buffer_get_size (buf), 8 + 3 * 24);
+  gst_buffer_unref (buf);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_rtp_ntp64_extension)
 {
   GstBuffer *buf;
@@ -963,12 +1288,18 @@ rtp_suite (void)
 
   suite_add_tcase (s, tc_chain);
   tcase_add_test (tc_chain, test_rtp_buffer);
+  tcase_add_test (tc_chain, test_rtp_buffer_map_skip_padding);
+  tcase_add_test (tc_chain, test_rtp_buffer_list_set_headers);
+  tcase_add_test (tc_chain, test_rtp_buffer_new_share_payload);
+  tcase_add_test (tc_chain, test_rtp_buffer_pool);
   tcase_add_test (tc_chain, test_rtp_buffer_validate_corrupt);
   tcase_add_test (tc_chain, test_rtp_buffer_set_extension_data);
+  tcase_add_test (tc_chain, test_rtp_buffer_get_extension_headers);
   //tcase_add_test (tc_chain, test_rtp_buffer_list_set_extension);
   tcase_add_test (tc_chain, test_rtp_seqnum_compare);
 
   tcase_add_test (tc_chain, test_rtcp_buffer);
+  tcase_add_test (tc_chain, test_rtcp_packet_add_rbs);
   tcase_add_test (tc_chain, test_rtp_ntp64_extension);
   tcase_add_test (tc_chain, test_rtp_ntp56_extension);
 
@@ -26,6 +26,7 @@
 
 #include <gst/rtsp/gstrtspurl.h>
 #include <gst/rtsp/gstrtsprange.h>
+#include <gst/rtsp/gstrtspmessage.h>
 #include <string.h>
 
 GST_START_TEST (test_rtsp_url_basic)
@@ -539,6 +540,66 @@ GST_START_TEST (test_rtsp_range_convert)
 
 GST_END_TEST;
 
+GST_START_TEST (test_rtsp_message_headers)
+{
+  GstRTSPMessage *msg;
+  gchar *val;
+  GString *str;
+
+  fail_unless (gst_rtsp_message_new_request (&msg, GST_RTSP_OPTIONS,
+          "rtsp://localhost/test") == GST_RTSP_OK);
+
+  fail_unless (gst_rtsp_message_get_header (msg, GST_RTSP_HDR_CSEQ, &val,
+          0) == GST_RTSP_ENOTIMPL);
+
+  gst_rtsp_message_add_header (msg, GST_RTSP_HDR_CSEQ, "1");
+  gst_rtsp_message_add_header (msg, GST_RTSP_HDR_REQUIRE, "a");
+  gst_rtsp_message_add_header (msg, GST_RTSP_HDR_SESSION, "s");
+  gst_rtsp_message_add_header (msg, GST_RTSP_HDR_REQUIRE, "b");
+  gst_rtsp_message_add_header (msg, GST_RTSP_HDR_REQUIRE, "c");
+
+  fail_unless (gst_rtsp_message_get_header (msg, GST_RTSP_HDR_CSEQ, &val,
+          0) == GST_RTSP_OK);
+  fail_unless_equals_string (val, "1");
+  fail_unless (gst_rtsp_message_get_header (msg, GST_RTSP_HDR_CSEQ, &val,
+          1) == GST_RTSP_ENOTIMPL);
+  fail_unless (gst_rtsp_message_get_header (msg, GST_RTSP_HDR_REQUIRE, &val,
+          2) == GST_RTSP_OK);
+  fail_unless_equals_string (val, "c");
+  fail_unless (gst_rtsp_message_get_header (msg, GST_RTSP_HDR_REQUIRE, &val,
+          -1) == GST_RTSP_ENOTIMPL);
+
+  /* removing moves the other headers */
+  fail_unless (gst_rtsp_message_remove_header (msg, GST_RTSP_HDR_REQUIRE,
+          0) == GST_RTSP_OK);
+  fail_unless (gst_rtsp_message_get_header (msg, GST_RTSP_HDR_REQUIRE, &val,
+          0) == GST_RTSP_OK);
+  fail_unless_equals_string (val, "b");
+  fail_unless (gst_rtsp_message_get_header (msg, GST_RTSP_HDR_SESSION, &val,
+          0) == GST_RTSP_OK);
+  fail_unless_equals_string (val, "s");
+  gst_rtsp_message_add_header (msg, GST_RTSP_HDR_REQUIRE, "d");
+  fail_unless (gst_rtsp_message_get_header (msg, GST_RTSP_HDR_REQUIRE, &val,
+          2) == GST_RTSP_OK);
+  fail_unless_equals_string (val, "d");
+
+  /* headers are serialized in the order they were added */
+  str = g_string_new ("");
+  gst_rtsp_message_append_headers (msg, str);
+  fail_unless_equals_string (str->str, "CSeq: 1\r\nSession: s\r\n"
+      "Require: b\r\nRequire: c\r\nRequire: d\r\n");
+  g_string_free (str, TRUE);
+
+  fail_unless (gst_rtsp_message_remove_header (msg, GST_RTSP_HDR_REQUIRE,
+          -1) == GST_RTSP_OK);
+  fail_unless (gst_rtsp_message_get_header (msg, GST_RTSP_HDR_REQUIRE, &val,
+          0) == GST_RTSP_ENOTIMPL);
+
+  gst_rtsp_message_free (msg);
+}
+
+GST_END_TEST;
+
 static Suite *
 rtsp_suite (void)
 {
@@ -554,6 +615,7 @@ rtsp_suite (void)
   tcase_add_test (tc_chain, test_rtsp_range_smpte);
   tcase_add_test (tc_chain, test_rtsp_range_clock);
   tcase_add_test (tc_chain, test_rtsp_range_convert);
+  tcase_add_test (tc_chain, test_rtsp_message_headers);
 
   return s;
 }
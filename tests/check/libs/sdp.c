@@ -193,6 +193,38 @@ GST_START_TEST (modify)
   gst_sdp_message_free (message);
 }
 
+GST_END_TEST
+GST_START_TEST (parse_size)
+{
+  GstSDPMessage *message;
+  const GstSDPMedia *media;
+  const gchar *tail = "m=audio 1010 TCP 14\r\n";
+  gchar *data, *text;
+  guint size;
+
+  /* only the first @size bytes may be parsed, the rest is garbage */
+  data = g_strconcat (sdp, "m=video 5000 RTP/AVP 26\r\n", NULL);
+  size = strlen (sdp) - strlen (tail);
+
+  gst_sdp_message_new (&message);
+  fail_unless (gst_sdp_message_parse_buffer ((guint8 *) data, size,
+          message) == GST_SDP_OK);
+  g_free (data);
+
+  fail_unless_equals_int (gst_sdp_message_medias_len (message), 3);
+  media = gst_sdp_message_get_media (message, 2);
+  fail_unless_equals_string (gst_sdp_media_get_media (media), "audio");
+  fail_unless_equals_int (gst_sdp_media_get_port (media), 4545);
+
+  /* every media line is terminated */
+  gst_sdp_media_set_information ((GstSDPMedia *) media, "info");
+  text = gst_sdp_message_as_text (message);
+  fail_unless (strstr (text, "i=info\r\na=sendrecv\r\n") != NULL);
+  g_free (text);
+
+  gst_sdp_message_free (message);
+}
+
 GST_END_TEST
 /*
  * End of test cases
@@ -207,6 +239,7 @@ sdp_suite (void)
   tcase_add_test (tc_chain, copy);
   tcase_add_test (tc_chain, boxed);
   tcase_add_test (tc_chain, modify);
+  tcase_add_test (tc_chain, parse_size);
 
   return s;
 }
@@ -686,6 +686,62 @@ GST_START_TEST (test_id3v1_utf8_tag)
 
 GST_END_TEST;
 
+GST_START_TEST (test_id3v2_text_encodings)
+{
+  const guint8 id3v2[] = {
+    /* header: ID3v2.4.0, no flags, 70 bytes of frames */
+    'I', 'D', '3', 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 70,
+    /* TIT2, ISO-8859-1 */
+    'T', 'I', 'T', '2', 0x00, 0x00, 0x00, 5, 0x00, 0x00,
+    0x00, 'C', 'a', 'f', 0xe9,
+    /* TPE1, UTF-16 with little endian BOM */
+    'T', 'P', 'E', '1', 0x00, 0x00, 0x00, 11, 0x00, 0x00,
+    0x01, 0xff, 0xfe, 'A', 0x00, 'l', 0x00, 'e', 0x00, 0x61, 0x01,
+    /* TALB, UTF-16BE */
+    'T', 'A', 'L', 'B', 0x00, 0x00, 0x00, 9, 0x00, 0x00,
+    0x02, 0x01, 0x7d, 0x00, 'l', 0x00, 'u', 0x01, 0x65,
+    /* TCON, UTF-8 */
+    'T', 'C', 'O', 'N', 0x00, 0x00, 0x00, 5, 0x00, 0x00,
+    0x03, 'R', 'o', 'c', 'k'
+  };
+  GstTagList *tags;
+  GstBuffer *buf;
+  gchar *s;
+
+  buf = gst_buffer_new_allocate (NULL, sizeof (id3v2), NULL);
+  gst_buffer_fill (buf, 0, id3v2, sizeof (id3v2));
+
+  tags = gst_tag_list_from_id3v2_tag (buf);
+  fail_unless (tags != NULL);
+
+  GST_LOG ("Got tags: %" GST_PTR_FORMAT, tags);
+
+  s = NULL;
+  fail_unless (gst_tag_list_get_string (tags, GST_TAG_TITLE, &s));
+  fail_unless_equals_string (s, "Café");
+  g_free (s);
+
+  s = NULL;
+  fail_unless (gst_tag_list_get_string (tags, GST_TAG_ARTIST, &s));
+  fail_unless_equals_string (s, "Aleš");
+  g_free (s);
+
+  s = NULL;
+  fail_unless (gst_tag_list_get_string (tags, GST_TAG_ALBUM, &s));
+  fail_unless_equals_string (s, "Žluť");
+  g_free (s);
+
+  s = NULL;
+  fail_unless (gst_tag_list_get_string (tags, GST_TAG_GENRE, &s));
+  fail_unless_equals_string (s, "Rock");
+  g_free (s);
+
+  gst_tag_list_unref (tags);
+  gst_buffer_unref (buf);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_language_utils)
 {
   gchar **lang_codes, **c;
@@ -1799,6 +1855,7 @@ tag_suite (void)
   tcase_add_test (tc_chain, test_vorbis_tags);
   tcase_add_test (tc_chain, test_id3_tags);
   tcase_add_test (tc_chain, test_id3v1_utf8_tag);
+  tcase_add_test (tc_chain, test_id3v2_text_encodings);
   tcase_add_test (tc_chain, test_language_utils);
   tcase_add_test (tc_chain, test_license_utils);
   tcase_add_test (tc_chain, test_xmp_formatting);
@@ -477,6 +477,80 @@ GST_START_TEST (test_video_formats_pack_unpack)
 
 GST_END_TEST;
 
+GST_START_TEST (test_video_formats_pack_unpack_lines)
+{
+  guint n, num_formats;
+
+  num_formats = 100;
+  while (gst_video_format_to_string (num_formats) == NULL)
+    --num_formats;
+
+  for (n = GST_VIDEO_FORMAT_ENCODED + 1; n < num_formats; ++n) {
+    const GstVideoFormatInfo *vfinfo, *unpackinfo;
+    GstVideoFormat fmt = n;
+    GstVideoInfo vinfo;
+    gpointer data[GST_VIDEO_MAX_PLANES], data2[GST_VIDEO_MAX_PLANES];
+    gint stride[GST_VIDEO_MAX_PLANES];
+    guint8 *vdata, *vdata2, *lines, *lines2;
+    gsize vsize, unpack_size, i;
+    guint p, l;
+
+    GST_INFO ("testing %s", gst_video_format_to_string (fmt));
+
+    vfinfo = gst_video_format_get_info (fmt);
+    unpackinfo = gst_video_format_get_info (vfinfo->unpack_format);
+
+    gst_video_info_init (&vinfo);
+    gst_video_info_set_format (&vinfo, fmt, WIDTH, HEIGHT);
+    vsize = GST_VIDEO_INFO_SIZE (&vinfo);
+    vdata = g_malloc (vsize);
+    vdata2 = g_malloc (vsize);
+    for (i = 0; i < vsize; i++)
+      vdata[i] = i * 7;
+    memset (vdata2, 0x99, vsize);
+
+    unpack_size =
+        GST_VIDEO_FORMAT_INFO_BITS (unpackinfo) *
+        GST_VIDEO_FORMAT_INFO_N_COMPONENTS (unpackinfo) *
+        GST_ROUND_UP_16 (WIDTH);
+    lines = g_malloc0 (unpack_size * HEIGHT);
+    lines2 = g_malloc0 (unpack_size * HEIGHT);
+
+    for (p = 0; p < GST_VIDEO_INFO_N_PLANES (&vinfo); ++p) {
+      data[p] = vdata + GST_VIDEO_INFO_PLANE_OFFSET (&vinfo, p);
+      data2[p] = vdata2 + GST_VIDEO_INFO_PLANE_OFFSET (&vinfo, p);
+      stride[p] = GST_VIDEO_INFO_PLANE_STRIDE (&vinfo, p);
+    }
+
+    /* unpacking all lines at once must give the same result as unpacking
+     * them one by one */
+    for (l = 0; l < HEIGHT; l++)
+      vfinfo->unpack_func (vfinfo, GST_VIDEO_PACK_FLAG_NONE,
+          lines + l * unpack_size, data, stride, 0, l, WIDTH);
+    gst_video_format_info_unpack_lines (vfinfo, GST_VIDEO_PACK_FLAG_NONE,
+        lines2, unpack_size, data, stride, 0, 0, WIDTH, HEIGHT);
+    fail_unless (memcmp (lines, lines2, unpack_size * HEIGHT) == 0);
+
+    /* and the same for packing */
+    memcpy (vdata, vdata2, vsize);
+    for (l = 0; l < HEIGHT; l++)
+      vfinfo->pack_func (vfinfo, GST_VIDEO_PACK_FLAG_NONE,
+          lines + l * unpack_size, unpack_size, data, stride,
+          GST_VIDEO_CHROMA_SITE_UNKNOWN, l, WIDTH);
+    gst_video_format_info_pack_lines (vfinfo, GST_VIDEO_PACK_FLAG_NONE,
+        lines, unpack_size, data2, stride, GST_VIDEO_CHROMA_SITE_UNKNOWN, 0,
+        WIDTH, HEIGHT);
+    fail_unless (memcmp (vdata, vdata2, vsize) == 0);
+
+    g_free (lines2);
+    g_free (lines);
+    g_free (vdata2);
+    g_free (vdata);
+  }
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_video_formats)
 {
   guint i;
@@ -815,6 +889,59 @@ GST_START_TEST (test_convert_frame)
       GST_CLOCK_TIME_NONE, &error);
   fail_unless (to_sample != NULL);
   fail_unless (error == NULL);
+  gst_sample_unref (to_sample);
+
+  /* again with the same caps, reusing the pipeline */
+  to_sample =
+      gst_video_convert_sample (from_sample, to_caps,
+      GST_CLOCK_TIME_NONE, &error);
+  fail_unless (to_sample != NULL);
+  fail_unless (error == NULL);
+  gst_sample_unref (to_sample);
+  gst_caps_unref (to_caps);
+
+  /* only the format changes, converted in memory */
+  to_caps = gst_caps_from_string ("video/x-raw, format=(string)BGRx");
+  to_sample =
+      gst_video_convert_sample (from_sample, to_caps,
+      GST_CLOCK_TIME_NONE, &error);
+  fail_unless (to_sample != NULL);
+  fail_unless (error == NULL);
+  gst_video_info_from_caps (&vinfo, gst_sample_get_caps (to_sample));
+  fail_unless_equals_int (GST_VIDEO_INFO_FORMAT (&vinfo),
+      GST_VIDEO_FORMAT_BGRx);
+  fail_unless_equals_int (GST_VIDEO_INFO_WIDTH (&vinfo), 640);
+  fail_unless_equals_int (GST_VIDEO_INFO_HEIGHT (&vinfo), 480);
+  gst_buffer_map (gst_sample_get_buffer (to_sample), &map, GST_MAP_READ);
+  for (i = 0; i < 640 * 480; i++) {
+    fail_unless_equals_int (map.data[4 * i + 0], 0);    /* B */
+    fail_unless_equals_int (map.data[4 * i + 1], 0);    /* G */
+    fail_unless_equals_int (map.data[4 * i + 2], 255);  /* R */
+  }
+  gst_buffer_unmap (gst_sample_get_buffer (to_sample), &map);
+  gst_sample_unref (to_sample);
+  gst_caps_unref (to_caps);
+
+  /* RGB to YUV at the same size, also converted in memory */
+  to_caps = gst_caps_from_string ("video/x-raw, format=(string)AYUV");
+  to_sample =
+      gst_video_convert_sample (from_sample, to_caps,
+      GST_CLOCK_TIME_NONE, &error);
+  fail_unless (to_sample != NULL);
+  fail_unless (error == NULL);
+  gst_video_info_from_caps (&vinfo, gst_sample_get_caps (to_sample));
+  fail_unless_equals_int (GST_VIDEO_INFO_FORMAT (&vinfo),
+      GST_VIDEO_FORMAT_AYUV);
+  fail_unless_equals_int (GST_VIDEO_INFO_COLORIMETRY (&vinfo).matrix,
+      GST_VIDEO_COLOR_MATRIX_BT601);
+  gst_buffer_map (gst_sample_get_buffer (to_sample), &map, GST_MAP_READ);
+  for (i = 0; i < 640 * 480; i++) {
+    /* BT.601 red is Y 81, U 90, V 240 */
+    fail_unless (ABS (map.data[4 * i + 1] - 81) <= 1);
+    fail_unless (ABS (map.data[4 * i + 2] - 90) <= 1);
+    fail_unless (ABS (map.data[4 * i + 3] - 240) <= 1);
+  }
+  gst_buffer_unmap (gst_sample_get_buffer (to_sample), &map);
 
   gst_buffer_unref (from_buffer);
   gst_caps_unref (from_caps);
@@ -921,6 +1048,223 @@ GST_START_TEST (test_convert_frame_async)
 
 GST_END_TEST;
 
+static void
+check_frames_equal (GstVideoFrame * a, GstVideoFrame * b)
+{
+  guint p, l;
+
+  for (p = 0; p < GST_VIDEO_FRAME_N_PLANES (a); p++) {
+    guint w = GST_VIDEO_FRAME_COMP_WIDTH (a, p) *
+        GST_VIDEO_FRAME_COMP_PSTRIDE (a, p);
+
+    for (l = 0; l < GST_VIDEO_FRAME_COMP_HEIGHT (a, p); l++) {
+      guint8 *la = (guint8 *) GST_VIDEO_FRAME_PLANE_DATA (a, p) +
+          l * GST_VIDEO_FRAME_PLANE_STRIDE (a, p);
+      guint8 *lb = (guint8 *) GST_VIDEO_FRAME_PLANE_DATA (b, p) +
+          l * GST_VIDEO_FRAME_PLANE_STRIDE (b, p);
+
+      fail_unless (memcmp (la, lb, w) == 0);
+    }
+  }
+}
+
+GST_START_TEST (test_video_frame_copy)
+{
+  GstVideoInfo sinfo, dinfo;
+  GstVideoFrame sframe, dframe, dframe2;
+  GstBuffer *sbuf, *dbuf, *dbuf2;
+  GstMapInfo map;
+  gsize i;
+  guint p;
+
+  /* big enough for the luma plane to use streaming stores */
+  gst_video_info_set_format (&dinfo, GST_VIDEO_FORMAT_I420, 3840, 2160);
+
+  /* source with padded lines */
+  sinfo = dinfo;
+  sinfo.size = 0;
+  for (p = 0; p < GST_VIDEO_INFO_N_PLANES (&sinfo); p++) {
+    sinfo.stride[p] = dinfo.stride[p] + 64;
+    sinfo.offset[p] = sinfo.size;
+    sinfo.size += sinfo.stride[p] * GST_VIDEO_INFO_COMP_HEIGHT (&sinfo, p);
+  }
+
+  sbuf = gst_buffer_new_and_alloc (sinfo.size);
+  gst_buffer_map (sbuf, &map, GST_MAP_WRITE);
+  for (i = 0; i < map.size; i++)
+    map.data[i] = i * 7;
+  gst_buffer_unmap (sbuf, &map);
+  dbuf = gst_buffer_new_and_alloc (dinfo.size);
+
+  fail_unless (gst_video_frame_map (&sframe, &sinfo, sbuf, GST_MAP_READ));
+  fail_unless (gst_video_frame_map (&dframe, &dinfo, dbuf, GST_MAP_WRITE));
+
+  /* different strides */
+  gst_buffer_memset (dbuf, 0, 0, dinfo.size);
+  fail_unless (gst_video_frame_copy (&dframe, &sframe));
+  check_frames_equal (&dframe, &sframe);
+
+  gst_buffer_memset (dbuf, 0, 0, dinfo.size);
+  fail_unless (gst_video_frame_copy_threaded (&dframe, &sframe, 4));
+  check_frames_equal (&dframe, &sframe);
+
+  /* equal strides */
+  dbuf2 = gst_buffer_new_and_alloc (dinfo.size);
+  fail_unless (gst_video_frame_map (&dframe2, &dinfo, dbuf2, GST_MAP_WRITE));
+  fail_unless (gst_video_frame_copy_threaded (&dframe2, &dframe, 0));
+  check_frames_equal (&dframe2, &sframe);
+  gst_video_frame_unmap (&dframe2);
+
+  gst_video_frame_unmap (&dframe);
+  gst_video_frame_unmap (&sframe);
+  gst_buffer_unref (dbuf2);
+  gst_buffer_unref (dbuf);
+  gst_buffer_unref (sbuf);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_video_frame_map_planes)
+{
+  GstVideoInfo info;
+  GstVideoFrame frame;
+  GstBuffer *buf;
+  GstMapInfo map;
+  GstMemory *mem;
+  guint p;
+  gsize size;
+
+  gst_video_info_set_format (&info, GST_VIDEO_FORMAT_I420, 320, 240);
+
+  /* each plane in its own memory block */
+  buf = gst_buffer_new ();
+  for (p = 0; p < GST_VIDEO_INFO_N_PLANES (&info); p++) {
+    if (p + 1 < GST_VIDEO_INFO_N_PLANES (&info))
+      size = info.offset[p + 1] - info.offset[p];
+    else
+      size = info.size - info.offset[p];
+    gst_buffer_append_memory (buf, gst_allocator_alloc (NULL, size, NULL));
+  }
+  fail_unless_equals_int (gst_buffer_n_memory (buf), 3);
+
+  fail_unless (gst_video_frame_map (&frame, &info, buf, GST_MAP_WRITE));
+
+  /* the memory was not merged and the planes point in their own block */
+  fail_unless_equals_int (gst_buffer_n_memory (buf), 3);
+  for (p = 0; p < GST_VIDEO_INFO_N_PLANES (&info); p++) {
+    mem = gst_buffer_peek_memory (buf, p);
+    fail_unless (gst_memory_map (mem, &map, GST_MAP_READ));
+    fail_unless (GST_VIDEO_FRAME_PLANE_DATA (&frame, p) == map.data);
+    gst_memory_unmap (mem, &map);
+  }
+  memset (GST_VIDEO_FRAME_PLANE_DATA (&frame, 2), 0x80,
+      GST_VIDEO_FRAME_PLANE_STRIDE (&frame, 2) *
+      GST_VIDEO_FRAME_COMP_HEIGHT (&frame, 2));
+  gst_video_frame_unmap (&frame);
+
+  fail_unless_equals_int (gst_buffer_n_memory (buf), 3);
+  fail_unless (gst_buffer_map (buf, &map, GST_MAP_READ));
+  fail_unless_equals_int (map.data[info.offset[2]], 0x80);
+  gst_buffer_unmap (buf, &map);
+
+  gst_buffer_unref (buf);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_video_buffer_pool_stats)
+{
+  GstBufferPool *pool;
+  GstStructure *config, *stats;
+  GstBuffer *buf1, *buf2, *buf3;
+  GstCaps *caps;
+  guint allocated, acquired, reused;
+
+  caps = gst_caps_new_simple ("video/x-raw", "format", G_TYPE_STRING, "I420",
+      "width", G_TYPE_INT, 320, "height", G_TYPE_INT, 240, NULL);
+
+  pool = gst_video_buffer_pool_new ();
+  config = gst_buffer_pool_get_config (pool);
+  gst_buffer_pool_config_set_params (config, caps, 320 * 240 * 3 / 2, 2, 0);
+  fail_unless (gst_buffer_pool_set_config (pool, config));
+  fail_unless (gst_buffer_pool_set_active (pool, TRUE));
+
+  /* min-buffers are allocated when activating */
+  g_object_get (pool, "stats", &stats, NULL);
+  fail_unless (gst_structure_get_uint (stats, "allocated", &allocated));
+  fail_unless_equals_int (allocated, 2);
+  gst_structure_free (stats);
+
+  fail_unless (gst_buffer_pool_acquire_buffer (pool, &buf1, NULL) ==
+      GST_FLOW_OK);
+  fail_unless (gst_buffer_pool_acquire_buffer (pool, &buf2, NULL) ==
+      GST_FLOW_OK);
+  fail_unless (gst_buffer_pool_acquire_buffer (pool, &buf3, NULL) ==
+      GST_FLOW_OK);
+  gst_buffer_unref (buf1);
+  gst_buffer_unref (buf2);
+  gst_buffer_unref (buf3);
+
+  g_object_get (pool, "stats", &stats, NULL);
+  fail_unless (gst_structure_get (stats, "allocated", G_TYPE_UINT, &allocated,
+          "acquired", G_TYPE_UINT, &acquired, "reused", G_TYPE_UINT, &reused,
+          NULL));
+  fail_unless_equals_int (allocated, 3);
+  fail_unless_equals_int (acquired, 3);
+  fail_unless_equals_int (reused, 2);
+  gst_structure_free (stats);
+
+  fail_unless (gst_buffer_pool_set_active (pool, FALSE));
+  gst_object_unref (pool);
+  gst_caps_unref (caps);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_video_buffer_pool_huge_pages)
+{
+  GstBufferPool *pool;
+  GstStructure *config;
+  GstBuffer *buf;
+  GstMapInfo map;
+  GstCaps *caps;
+  gint node;
+
+  pool = gst_video_buffer_pool_new ();
+  if (!gst_buffer_pool_has_option (pool,
+          GST_BUFFER_POOL_OPTION_VIDEO_HUGE_PAGES)) {
+    gst_object_unref (pool);
+    return;
+  }
+
+  caps = gst_caps_new_simple ("video/x-raw", "format", G_TYPE_STRING, "I420",
+      "width", G_TYPE_INT, 1920, "height", G_TYPE_INT, 1080, NULL);
+
+  config = gst_buffer_pool_get_config (pool);
+  gst_buffer_pool_config_set_params (config, caps, 1920 * 1080 * 3 / 2, 1, 0);
+  gst_buffer_pool_config_add_option (config,
+      GST_BUFFER_POOL_OPTION_VIDEO_HUGE_PAGES);
+  gst_buffer_pool_config_set_video_numa_node (config, 0);
+  fail_unless (gst_buffer_pool_config_get_video_numa_node (config, &node));
+  fail_unless_equals_int (node, 0);
+  fail_unless (gst_buffer_pool_set_config (pool, config));
+  fail_unless (gst_buffer_pool_set_active (pool, TRUE));
+
+  fail_unless (gst_buffer_pool_acquire_buffer (pool, &buf, NULL) ==
+      GST_FLOW_OK);
+  fail_unless (gst_buffer_map (buf, &map, GST_MAP_WRITE));
+  fail_unless_equals_int (map.size, 1920 * 1080 * 3 / 2);
+  memset (map.data, 0xff, map.size);
+  gst_buffer_unmap (buf, &map);
+  gst_buffer_unref (buf);
+
+  fail_unless (gst_buffer_pool_set_active (pool, FALSE));
+  gst_object_unref (pool);
+  gst_caps_unref (caps);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_video_size_from_caps)
 {
   GstVideoInfo vinfo;
@@ -940,6 +1284,47 @@ GST_START_TEST (test_video_size_from_caps)
 
 GST_END_TEST;
 
+GST_START_TEST (test_video_info_from_caps_cached)
+{
+  GstVideoInfo vinfo;
+  GstCaps *caps, *copy;
+
+  caps = gst_caps_new_simple ("video/x-raw",
+      "format", G_TYPE_STRING, "I420",
+      "width", G_TYPE_INT, 320,
+      "height", G_TYPE_INT, 240, "framerate", GST_TYPE_FRACTION, 30, 1, NULL);
+
+  fail_unless (gst_video_info_from_caps (&vinfo, caps));
+  fail_unless (gst_video_info_from_caps (&vinfo, caps));
+  fail_unless_equals_int (GST_VIDEO_INFO_WIDTH (&vinfo), 320);
+  fail_unless_equals_int (GST_VIDEO_INFO_FPS_N (&vinfo), 30);
+
+  /* the same caps changed in place must be parsed again */
+  gst_caps_set_simple (caps, "width", G_TYPE_INT, 640,
+      "framerate", GST_TYPE_FRACTION, 25, 1, NULL);
+  fail_unless (gst_video_info_from_caps (&vinfo, caps));
+  fail_unless_equals_int (GST_VIDEO_INFO_WIDTH (&vinfo), 640);
+  fail_unless_equals_int (GST_VIDEO_INFO_FPS_N (&vinfo), 25);
+  fail_unless (GST_VIDEO_INFO_SIZE (&vinfo) == (640 * 240 * 12 / 8));
+
+  /* equal caps at another address are parsed on their own */
+  copy = gst_caps_copy (caps);
+  gst_caps_set_simple (caps, "height", G_TYPE_INT, 480, NULL);
+  fail_unless (gst_video_info_from_caps (&vinfo, copy));
+  fail_unless_equals_int (GST_VIDEO_INFO_HEIGHT (&vinfo), 240);
+  fail_unless (gst_video_info_from_caps (&vinfo, caps));
+  fail_unless_equals_int (GST_VIDEO_INFO_HEIGHT (&vinfo), 480);
+  gst_caps_unref (copy);
+
+  /* and failures aren't remembered */
+  gst_caps_set_simple (caps, "format", G_TYPE_STRING, "invalid", NULL);
+  fail_if (gst_video_info_from_caps (&vinfo, caps));
+
+  gst_caps_unref (caps);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_overlay_composition)
 {
   GstVideoOverlayComposition *comp1, *comp2;
@@ -1656,6 +2041,428 @@ GST_START_TEST (test_overlay_composition_global_alpha)
 
 GST_END_TEST;
 
+static void
+fill_frame_yuv (GstVideoFrame * frame, guint8 y, guint8 u, guint8 v)
+{
+  const guint8 vals[3] = { y, u, v };
+  guint c, l, x;
+
+  for (c = 0; c < 3; c++) {
+    for (l = 0; l < GST_VIDEO_FRAME_COMP_HEIGHT (frame, c); l++) {
+      guint8 *data = (guint8 *) GST_VIDEO_FRAME_COMP_DATA (frame, c) +
+          l * GST_VIDEO_FRAME_COMP_STRIDE (frame, c);
+
+      for (x = 0; x < GST_VIDEO_FRAME_COMP_WIDTH (frame, c); x++)
+        data[x * GST_VIDEO_FRAME_COMP_PSTRIDE (frame, c)] = vals[c];
+    }
+  }
+}
+
+static gboolean
+blend_is_covered (gint x, gint y)
+{
+  /* the opaque left halves of the overlays blended at 8x8 and -4x-4 */
+  return (x >= 8 && x < 16 && y >= 8 && y < 24) || (x < 4 && y < 12);
+}
+
+GST_START_TEST (test_video_blend)
+{
+  /* the direct 4:2:0 path and the generic path for Y444 */
+  static const GstVideoFormat formats[] = { GST_VIDEO_FORMAT_I420,
+    GST_VIDEO_FORMAT_NV12, GST_VIDEO_FORMAT_Y444
+  };
+  const guint8 expected[3][2] = { {0x10, 0xeb}, {0x80, 0x40}, {0x80, 0xc0} };
+  GstVideoInfo sinfo, dinfo;
+  GstVideoFrame sframe, dframe;
+  GstBuffer *sbuf, *dbuf;
+  GstMapInfo map;
+  guint i, c, l, x;
+
+  /* AYUV overlay, opaque in the left half, transparent in the right half */
+  gst_video_info_set_format (&sinfo, GST_VIDEO_FORMAT_AYUV, 16, 16);
+  sbuf = gst_buffer_new_and_alloc (sinfo.size);
+  gst_buffer_map (sbuf, &map, GST_MAP_WRITE);
+  for (l = 0; l < 16; l++) {
+    guint8 *data = map.data + l * GST_VIDEO_INFO_PLANE_STRIDE (&sinfo, 0);
+
+    for (x = 0; x < 16; x++, data += 4) {
+      data[0] = x < 8 ? 0xff : 0x00;
+      data[1] = 0xeb;
+      data[2] = 0x40;
+      data[3] = 0xc0;
+    }
+  }
+  gst_buffer_unmap (sbuf, &map);
+  fail_unless (gst_video_frame_map (&sframe, &sinfo, sbuf, GST_MAP_READ));
+
+  for (i = 0; i < G_N_ELEMENTS (formats); i++) {
+    gst_video_info_set_format (&dinfo, formats[i], 64, 64);
+    dbuf = gst_buffer_new_and_alloc (dinfo.size);
+    fail_unless (gst_video_frame_map (&dframe, &dinfo, dbuf, GST_MAP_WRITE));
+    fill_frame_yuv (&dframe, 0x10, 0x80, 0x80);
+
+    /* inside the frame and clipped at the top left */
+    fail_unless (gst_video_blend (&dframe, &sframe, 8, 8, 1.0));
+    fail_unless (gst_video_blend (&dframe, &sframe, -4, -4, 1.0));
+
+    for (c = 0; c < 3; c++) {
+      gint ws = GST_VIDEO_FORMAT_INFO_W_SUB (dinfo.finfo, c);
+      gint hs = GST_VIDEO_FORMAT_INFO_H_SUB (dinfo.finfo, c);
+
+      for (l = 0; l < GST_VIDEO_FRAME_COMP_HEIGHT (&dframe, c); l++) {
+        guint8 *data = (guint8 *) GST_VIDEO_FRAME_COMP_DATA (&dframe, c) +
+            l * GST_VIDEO_FRAME_COMP_STRIDE (&dframe, c);
+
+        for (x = 0; x < GST_VIDEO_FRAME_COMP_WIDTH (&dframe, c); x++) {
+          fail_unless_equals_int (data[x * GST_VIDEO_FRAME_COMP_PSTRIDE
+                  (&dframe, c)], expected[c][blend_is_covered (x << ws,
+                      l << hs)]);
+        }
+      }
+    }
+
+    gst_video_frame_unmap (&dframe);
+    gst_buffer_unref (dbuf);
+  }
+
+  gst_video_frame_unmap (&sframe);
+  gst_buffer_unref (sbuf);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_video_converter)
+{
+  GstVideoInfo sinfo, dinfo;
+  GstVideoFrame sframe, dframe;
+  GstVideoConverter *convert;
+  const GstStructure *config;
+  GstBuffer *sbuf, *dbuf;
+  guint8 *data;
+  guint threads;
+  gint x, y;
+
+  gst_video_info_set_format (&sinfo, GST_VIDEO_FORMAT_I420, 320, 240);
+  gst_video_info_set_format (&dinfo, GST_VIDEO_FORMAT_AYUV, 320, 240);
+
+  convert = gst_video_converter_new (&sinfo, &dinfo,
+      gst_structure_new ("GstVideoConverter",
+          GST_VIDEO_CONVERTER_OPT_THREADS, G_TYPE_UINT, 2, NULL));
+  fail_unless (convert != NULL);
+
+  config = gst_video_converter_get_config (convert);
+  fail_unless (gst_structure_get_uint (config,
+          GST_VIDEO_CONVERTER_OPT_THREADS, &threads));
+  fail_unless_equals_int (threads, 2);
+
+  /* a flat grey frame stays grey */
+  sbuf = gst_buffer_new_and_alloc (sinfo.size);
+  gst_buffer_memset (sbuf, 0, 128, sinfo.size);
+  dbuf = gst_buffer_new_and_alloc (dinfo.size);
+  gst_buffer_memset (dbuf, 0, 0, dinfo.size);
+
+  fail_unless (gst_video_frame_map (&sframe, &sinfo, sbuf, GST_MAP_READ));
+  fail_unless (gst_video_frame_map (&dframe, &dinfo, dbuf, GST_MAP_WRITE));
+
+  gst_video_converter_frame (convert, &sframe, &dframe);
+
+  for (y = 0; y < GST_VIDEO_FRAME_HEIGHT (&dframe); y++) {
+    data = (guint8 *) GST_VIDEO_FRAME_PLANE_DATA (&dframe, 0) +
+        y * GST_VIDEO_FRAME_PLANE_STRIDE (&dframe, 0);
+    for (x = 0; x < GST_VIDEO_FRAME_WIDTH (&dframe); x++) {
+      fail_unless_equals_int (data[4 * x + 0], 0xff);
+      fail_unless_equals_int (data[4 * x + 1], 128);
+      fail_unless_equals_int (data[4 * x + 2], 128);
+      fail_unless_equals_int (data[4 * x + 3], 128);
+    }
+  }
+
+  /* options can be changed on an existing converter */
+  fail_unless (gst_video_converter_set_config (convert,
+          gst_structure_new ("GstVideoConverter",
+              GST_VIDEO_CONVERTER_OPT_DITHER_METHOD,
+              GST_TYPE_VIDEO_DITHER_METHOD, GST_VIDEO_DITHER_VERTERR, NULL)));
+  config = gst_video_converter_get_config (convert);
+  fail_unless (gst_structure_get_uint (config,
+          GST_VIDEO_CONVERTER_OPT_THREADS, &threads));
+  fail_unless_equals_int (threads, 2);
+
+  gst_video_frame_unmap (&dframe);
+  gst_video_frame_unmap (&sframe);
+  gst_buffer_unref (dbuf);
+  gst_buffer_unref (sbuf);
+  gst_video_converter_free (convert);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_video_converter_dither)
+{
+  GstVideoInfo sinfo, dinfo;
+  GstVideoFrame sframe, dframe;
+  GstVideoConverter *convert;
+  GstBuffer *sbuf, *dbuf;
+  GstMapInfo map;
+  guint16 *pixels;
+  guint8 *data;
+  gint i, x, y, method;
+  guint sum;
+
+  gst_video_info_set_format (&sinfo, GST_VIDEO_FORMAT_AYUV64, 64, 32);
+  gst_video_info_set_format (&dinfo, GST_VIDEO_FORMAT_AYUV, 64, 32);
+
+  /* flat frame with a luma of 128.25 in 8 bits */
+  sbuf = gst_buffer_new_and_alloc (sinfo.size);
+  fail_unless (gst_buffer_map (sbuf, &map, GST_MAP_WRITE));
+  pixels = (guint16 *) map.data;
+  for (i = 0; i < map.size / 8; i++) {
+    pixels[4 * i + 0] = 0xffff;
+    pixels[4 * i + 1] = 0x8040;
+    pixels[4 * i + 2] = 0x8000;
+    pixels[4 * i + 3] = 0x8000;
+  }
+  gst_buffer_unmap (sbuf, &map);
+  dbuf = gst_buffer_new_and_alloc (dinfo.size);
+
+  for (method = GST_VIDEO_DITHER_NONE; method <= GST_VIDEO_DITHER_BAYER;
+      method++) {
+    convert = gst_video_converter_new (&sinfo, &dinfo,
+        gst_structure_new ("GstVideoConverter",
+            GST_VIDEO_CONVERTER_OPT_DITHER_METHOD,
+            GST_TYPE_VIDEO_DITHER_METHOD, method, NULL));
+    fail_unless (convert != NULL);
+
+    fail_unless (gst_video_frame_map (&sframe, &sinfo, sbuf, GST_MAP_READ));
+    fail_unless (gst_video_frame_map (&dframe, &dinfo, dbuf, GST_MAP_WRITE));
+
+    gst_video_converter_frame (convert, &sframe, &dframe);
+
+    sum = 0;
+    for (y = 0; y < GST_VIDEO_FRAME_HEIGHT (&dframe); y++) {
+      data = (guint8 *) GST_VIDEO_FRAME_PLANE_DATA (&dframe, 0) +
+          y * GST_VIDEO_FRAME_PLANE_STRIDE (&dframe, 0);
+      for (x = 0; x < GST_VIDEO_FRAME_WIDTH (&dframe); x++) {
+        fail_unless_equals_int (data[4 * x + 0], 0xff);
+        fail_unless (data[4 * x + 1] == 128 || data[4 * x + 1] == 129);
+        sum += data[4 * x + 1] - 128;
+      }
+    }
+    /* without dithering the fraction is lost, all methods must bring back
+     * roughly one pixel in four */
+    if (method == GST_VIDEO_DITHER_NONE)
+      fail_unless_equals_int (sum, 0);
+    else
+      fail_unless (sum > 64 * 32 / 8 && sum < 64 * 32 * 3 / 8,
+          "method %d sum %u", method, sum);
+
+    gst_video_frame_unmap (&dframe);
+    gst_video_frame_unmap (&sframe);
+    gst_video_converter_free (convert);
+  }
+
+  gst_buffer_unref (dbuf);
+  gst_buffer_unref (sbuf);
+}
+
+GST_END_TEST;
+
+/* converts @sbuf with a new converter and returns the output */
+static GstBuffer *
+convert_with_threads (GstVideoInfo * sinfo, GstVideoInfo * dinfo,
+    GstBuffer * sbuf, gint method, guint n_threads)
+{
+  GstVideoFrame sframe, dframe;
+  GstVideoConverter *convert;
+  GstBuffer *dbuf;
+
+  convert = gst_video_converter_new (sinfo, dinfo,
+      gst_structure_new ("GstVideoConverter",
+          GST_VIDEO_CONVERTER_OPT_DITHER_METHOD,
+          GST_TYPE_VIDEO_DITHER_METHOD, method,
+          GST_VIDEO_CONVERTER_OPT_THREADS, G_TYPE_UINT, n_threads, NULL));
+  fail_unless (convert != NULL);
+
+  dbuf = gst_buffer_new_and_alloc (dinfo->size);
+  gst_buffer_memset (dbuf, 0, 0, dinfo->size);
+
+  fail_unless (gst_video_frame_map (&sframe, sinfo, sbuf, GST_MAP_READ));
+  fail_unless (gst_video_frame_map (&dframe, dinfo, dbuf, GST_MAP_WRITE));
+  gst_video_converter_frame (convert, &sframe, &dframe);
+  gst_video_frame_unmap (&dframe);
+  gst_video_frame_unmap (&sframe);
+
+  gst_video_converter_free (convert);
+
+  return dbuf;
+}
+
+/* the slices must not change the output, also not with error diffusion
+ * which carries the rounding errors from line to line */
+GST_START_TEST (test_video_converter_dither_threads)
+{
+  GstVideoInfo sinfo, dinfo;
+  GstBuffer *sbuf, *ref, *dbuf;
+  GstMapInfo map, ref_map;
+  guint16 *pixels;
+  gint i, method;
+  guint n_threads;
+
+  gst_video_info_set_format (&sinfo, GST_VIDEO_FORMAT_AYUV64, 64, 64);
+  gst_video_info_set_format (&dinfo, GST_VIDEO_FORMAT_AYUV, 64, 64);
+
+  /* a gradient with fractions that don't repeat on every line */
+  sbuf = gst_buffer_new_and_alloc (sinfo.size);
+  fail_unless (gst_buffer_map (sbuf, &map, GST_MAP_WRITE));
+  pixels = (guint16 *) map.data;
+  for (i = 0; i < map.size / 8; i++) {
+    pixels[4 * i + 0] = 0xffff;
+    pixels[4 * i + 1] = 0x4000 + i * 7;
+    pixels[4 * i + 2] = 0x8000 + (i % 64) * 13;
+    pixels[4 * i + 3] = 0x8000 - (i / 64) * 11;
+  }
+  gst_buffer_unmap (sbuf, &map);
+
+  for (method = GST_VIDEO_DITHER_NONE; method <= GST_VIDEO_DITHER_BAYER;
+      method++) {
+    ref = convert_with_threads (&sinfo, &dinfo, sbuf, method, 1);
+    fail_unless (gst_buffer_map (ref, &ref_map, GST_MAP_READ));
+
+    for (n_threads = 2; n_threads <= 4; n_threads++) {
+      dbuf = convert_with_threads (&sinfo, &dinfo, sbuf, method, n_threads);
+      fail_unless (gst_buffer_map (dbuf, &map, GST_MAP_READ));
+      fail_unless (memcmp (map.data, ref_map.data, map.size) == 0,
+          "method %d differs with %u threads", method, n_threads);
+      gst_buffer_unmap (dbuf, &map);
+      gst_buffer_unref (dbuf);
+    }
+
+    gst_buffer_unmap (ref, &ref_map);
+    gst_buffer_unref (ref);
+  }
+
+  gst_buffer_unref (sbuf);
+}
+
+GST_END_TEST;
+
+static guint8
+tile_pattern (gint plane, gint x, gint y)
+{
+  return (x * 7 + y * 3 + plane * 101) & 0xff;
+}
+
+GST_START_TEST (test_video_tile)
+{
+  /* the tiles of a 4x3 plane, pairs of rows are in Z and flipped Z order and
+   * the last row is linear because the number of rows is odd */
+  static const guint tile_index[3][4] = {
+    {0, 1, 6, 7}, {2, 3, 4, 5}, {8, 9, 10, 11}
+  };
+  const GstVideoFormatInfo *finfo;
+  GstVideoTileMode mode;
+  GstVideoInfo tinfo, info;
+  GstVideoFrame tframe, frame;
+  GstVideoConverter *convert;
+  GstBuffer *tbuf, *buf;
+  GstVideoFormat out_format[] = { GST_VIDEO_FORMAT_NV12,
+    GST_VIDEO_FORMAT_I420
+  };
+  guint8 *line, *tile, *u, *v;
+  gint p, x, y, tx, ty, stride, i;
+
+  for (y = 0; y < 3; y++)
+    for (x = 0; x < 4; x++)
+      fail_unless_equals_int (gst_video_tile_get_index
+          (GST_VIDEO_TILE_MODE_ZFLIPZ_2X2, x, y, 4, 3), tile_index[y][x]);
+
+  finfo = gst_video_format_get_info (GST_VIDEO_FORMAT_NV12_64Z32);
+  fail_unless (GST_VIDEO_FORMAT_INFO_IS_TILED (finfo));
+  mode = GST_VIDEO_FORMAT_INFO_TILE_MODE (finfo);
+  fail_unless_equals_int (mode, GST_VIDEO_TILE_MODE_ZFLIPZ_2X2);
+  fail_unless_equals_int (GST_VIDEO_FORMAT_INFO_TILE_WS (finfo), 6);
+  fail_unless_equals_int (GST_VIDEO_FORMAT_INFO_TILE_HS (finfo), 5);
+
+  gst_video_info_set_format (&tinfo, GST_VIDEO_FORMAT_NV12_64Z32, 200, 300);
+  fail_unless_equals_int (GST_VIDEO_TILE_X_TILES (tinfo.stride[0]), 4);
+  fail_unless_equals_int (GST_VIDEO_TILE_Y_TILES (tinfo.stride[0]), 10);
+  fail_unless_equals_int (GST_VIDEO_TILE_X_TILES (tinfo.stride[1]), 4);
+  fail_unless_equals_int (GST_VIDEO_TILE_Y_TILES (tinfo.stride[1]), 5);
+  fail_unless_equals_int (tinfo.size, 256 * 320 * 3 / 2);
+
+  /* fill the tiles with a pattern of the position in the plane */
+  tbuf = gst_buffer_new_and_alloc (tinfo.size);
+  fail_unless (gst_video_frame_map (&tframe, &tinfo, tbuf, GST_MAP_WRITE));
+  for (p = 0; p < 2; p++) {
+    stride = GST_VIDEO_FRAME_PLANE_STRIDE (&tframe, p);
+    for (ty = 0; ty < GST_VIDEO_TILE_Y_TILES (stride); ty++) {
+      for (tx = 0; tx < GST_VIDEO_TILE_X_TILES (stride); tx++) {
+        tile = (guint8 *) GST_VIDEO_FRAME_PLANE_DATA (&tframe, p) +
+            (gst_video_tile_get_index (mode, tx, ty,
+                GST_VIDEO_TILE_X_TILES (stride),
+                GST_VIDEO_TILE_Y_TILES (stride)) << 11);
+        for (y = 0; y < 32; y++)
+          for (x = 0; x < 64; x++)
+            tile[y * 64 + x] = tile_pattern (p, tx * 64 + x, ty * 32 + y);
+      }
+    }
+  }
+  gst_video_frame_unmap (&tframe);
+
+  /* unpacking detiles a line */
+  fail_unless (gst_video_frame_map (&tframe, &tinfo, tbuf, GST_MAP_READ));
+  line = g_malloc (200 * 4);
+  finfo->unpack_func (finfo, GST_VIDEO_PACK_FLAG_NONE, line, tframe.data,
+      tframe.info.stride, 0, 37, 200);
+  for (x = 0; x < 200; x++) {
+    fail_unless_equals_int (line[4 * x + 1], tile_pattern (0, x, 37));
+    fail_unless_equals_int (line[4 * x + 2], tile_pattern (1, x & ~1, 18));
+    fail_unless_equals_int (line[4 * x + 3],
+        tile_pattern (1, (x & ~1) + 1, 18));
+  }
+  g_free (line);
+
+  /* and the converter detiles to the linear formats, with two slices */
+  for (i = 0; i < G_N_ELEMENTS (out_format); i++) {
+    gst_video_info_set_format (&info, out_format[i], 200, 300);
+    convert = gst_video_converter_new (&tinfo, &info,
+        gst_structure_new ("GstVideoConverter",
+            GST_VIDEO_CONVERTER_OPT_THREADS, G_TYPE_UINT, 2, NULL));
+    fail_unless (convert != NULL);
+
+    buf = gst_buffer_new_and_alloc (info.size);
+    fail_unless (gst_video_frame_map (&frame, &info, buf, GST_MAP_WRITE));
+    gst_video_converter_frame (convert, &tframe, &frame);
+
+    for (y = 0; y < 300; y++) {
+      line = (guint8 *) GST_VIDEO_FRAME_PLANE_DATA (&frame, 0) +
+          y * GST_VIDEO_FRAME_PLANE_STRIDE (&frame, 0);
+      for (x = 0; x < 200; x++)
+        fail_unless_equals_int (line[x], tile_pattern (0, x, y));
+    }
+    for (y = 0; y < 150; y++) {
+      u = (guint8 *) GST_VIDEO_FRAME_COMP_DATA (&frame, 1) +
+          y * GST_VIDEO_FRAME_COMP_STRIDE (&frame, 1);
+      v = (guint8 *) GST_VIDEO_FRAME_COMP_DATA (&frame, 2) +
+          y * GST_VIDEO_FRAME_COMP_STRIDE (&frame, 2);
+      for (x = 0; x < 100; x++) {
+        fail_unless_equals_int (u[x * GST_VIDEO_FRAME_COMP_PSTRIDE (&frame,
+                    1)], tile_pattern (1, 2 * x, y));
+        fail_unless_equals_int (v[x * GST_VIDEO_FRAME_COMP_PSTRIDE (&frame,
+                    2)], tile_pattern (1, 2 * x + 1, y));
+      }
+    }
+
+    gst_video_frame_unmap (&frame);
+    gst_buffer_unref (buf);
+    gst_video_converter_free (convert);
+  }
+
+  gst_video_frame_unmap (&tframe);
+  gst_buffer_unref (tbuf);
+}
+
+GST_END_TEST;
+
 static Suite *
 video_suite (void)
 {
@@ -1667,15 +2474,26 @@ video_suite (void)
   tcase_add_test (tc_chain, test_video_formats_rgb);
   tcase_add_test (tc_chain, test_video_formats_all);
   tcase_add_test (tc_chain, test_video_formats_pack_unpack);
+  tcase_add_test (tc_chain, test_video_formats_pack_unpack_lines);
   tcase_add_test (tc_chain, test_dar_calc);
   tcase_add_test (tc_chain, test_parse_caps_rgb);
   tcase_add_test (tc_chain, test_events);
   tcase_add_test (tc_chain, test_convert_frame);
   tcase_add_test (tc_chain, test_convert_frame_async);
   tcase_add_test (tc_chain, test_video_size_from_caps);
+  tcase_add_test (tc_chain, test_video_info_from_caps_cached);
+  tcase_add_test (tc_chain, test_video_frame_copy);
+  tcase_add_test (tc_chain, test_video_frame_map_planes);
+  tcase_add_test (tc_chain, test_video_converter);
+  tcase_add_test (tc_chain, test_video_converter_dither);
+  tcase_add_test (tc_chain, test_video_converter_dither_threads);
+  tcase_add_test (tc_chain, test_video_tile);
+  tcase_add_test (tc_chain, test_video_buffer_pool_stats);
+  tcase_add_test (tc_chain, test_video_buffer_pool_huge_pages);
   tcase_add_test (tc_chain, test_overlay_composition);
   tcase_add_test (tc_chain, test_overlay_composition_premultiplied_alpha);
   tcase_add_test (tc_chain, test_overlay_composition_global_alpha);
+  tcase_add_test (tc_chain, test_video_blend);
 
   return s;
 }
@@ -0,0 +1,342 @@
+/* GStreamer
+ *
+ * Copyright (C) 2013 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#include <gst/gst.h>
+#include <gst/check/gstcheck.h>
+#include <gst/video/video.h>
+
+static GstPad *mysrcpad, *mysinkpad;
+static GstElement *dec;
+
+#define TEST_VIDEO_WIDTH 16
+#define TEST_VIDEO_HEIGHT 16
+#define TEST_VIDEO_FPS_N 25
+#define TEST_VIDEO_FPS_D 1
+
+#define GST_VIDEO_DECODER_TESTER_TYPE gst_video_decoder_tester_get_type()
+static GType gst_video_decoder_tester_get_type (void);
+
+typedef struct _GstVideoDecoderTester GstVideoDecoderTester;
+typedef struct _GstVideoDecoderTesterClass GstVideoDecoderTesterClass;
+
+/* Decodes two frames at a time and finishes the second one first, like a
+ * decoder with worker threads would when the second frame is faster to
+ * decode. With drop_first set, the first frame of each pair is dropped
+ * instead of finished. */
+struct _GstVideoDecoderTester
+{
+  GstVideoDecoder parent;
+
+  GstVideoCodecFrame *held;
+  gboolean drop_first;
+};
+
+struct _GstVideoDecoderTesterClass
+{
+  GstVideoDecoderClass parent_class;
+};
+
+G_DEFINE_TYPE (GstVideoDecoderTester, gst_video_decoder_tester,
+    GST_TYPE_VIDEO_DECODER);
+
+static gboolean
+gst_video_decoder_tester_start (GstVideoDecoder * dec)
+{
+  gst_video_decoder_set_max_concurrent_frames (dec, 2);
+  return TRUE;
+}
+
+static gboolean
+gst_video_decoder_tester_stop (GstVideoDecoder * dec)
+{
+  GstVideoDecoderTester *tester = (GstVideoDecoderTester *) dec;
+
+  if (tester->held)
+    gst_video_codec_frame_unref (tester->held);
+  tester->held = NULL;
+
+  return TRUE;
+}
+
+static gboolean
+gst_video_decoder_tester_set_format (GstVideoDecoder * dec,
+    GstVideoCodecState * state)
+{
+  GstVideoCodecState *res = gst_video_decoder_set_output_state (dec,
+      GST_VIDEO_FORMAT_GRAY8, TEST_VIDEO_WIDTH, TEST_VIDEO_HEIGHT, NULL);
+
+  gst_video_codec_state_unref (res);
+  return TRUE;
+}
+
+static GstFlowReturn
+gst_video_decoder_tester_output (GstVideoDecoder * dec,
+    GstVideoCodecFrame * frame)
+{
+  GstFlowReturn ret;
+
+  ret = gst_video_decoder_allocate_output_frame (dec, frame);
+  if (ret != GST_FLOW_OK) {
+    gst_video_codec_frame_unref (frame);
+    return ret;
+  }
+  /* so that the output order can be checked without timestamps */
+  gst_buffer_memset (frame->output_buffer, 0, frame->system_frame_number, 1);
+
+  return gst_video_decoder_finish_frame (dec, frame);
+}
+
+static GstFlowReturn
+gst_video_decoder_tester_handle_frame (GstVideoDecoder * dec,
+    GstVideoCodecFrame * frame)
+{
+  GstVideoDecoderTester *tester = (GstVideoDecoderTester *) dec;
+  GstVideoCodecFrame *first;
+  GstFlowReturn ret;
+
+  if (tester->held == NULL) {
+    tester->held = frame;
+    return GST_FLOW_OK;
+  }
+
+  first = tester->held;
+  tester->held = NULL;
+
+  /* the second frame is finished first and has to wait for the first */
+  ret = gst_video_decoder_tester_output (dec, frame);
+  fail_unless (ret == GST_FLOW_OK);
+
+  if (tester->drop_first)
+    return gst_video_decoder_drop_frame (dec, first);
+
+  return gst_video_decoder_tester_output (dec, first);
+}
+
+static GstFlowReturn
+gst_video_decoder_tester_finish (GstVideoDecoder * dec)
+{
+  GstVideoDecoderTester *tester = (GstVideoDecoderTester *) dec;
+  GstVideoCodecFrame *held = tester->held;
+
+  tester->held = NULL;
+  if (held)
+    return gst_video_decoder_tester_output (dec, held);
+
+  return GST_FLOW_OK;
+}
+
+static void
+gst_video_decoder_tester_class_init (GstVideoDecoderTesterClass * klass)
+{
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstVideoDecoderClass *videodecoder_class = GST_VIDEO_DECODER_CLASS (klass);
+
+  static GstStaticPadTemplate sink_templ = GST_STATIC_PAD_TEMPLATE ("sink",
+      GST_PAD_SINK, GST_PAD_ALWAYS,
+      GST_STATIC_CAPS ("video/x-test-custom"));
+
+  static GstStaticPadTemplate src_templ = GST_STATIC_PAD_TEMPLATE ("src",
+      GST_PAD_SRC, GST_PAD_ALWAYS,
+      GST_STATIC_CAPS ("video/x-raw"));
+
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&sink_templ));
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&src_templ));
+
+  gst_element_class_set_metadata (element_class,
+      "VideoDecoderTester", "Decoder/Video", "yep", "me");
+
+  videodecoder_class->start = gst_video_decoder_tester_start;
+  videodecoder_class->stop = gst_video_decoder_tester_stop;
+  videodecoder_class->set_format = gst_video_decoder_tester_set_format;
+  videodecoder_class->handle_frame = gst_video_decoder_tester_handle_frame;
+  videodecoder_class->finish = gst_video_decoder_tester_finish;
+}
+
+static void
+gst_video_decoder_tester_init (GstVideoDecoderTester * tester)
+{
+}
+
+static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS ("video/x-raw"));
+
+static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC, GST_PAD_ALWAYS, GST_STATIC_CAPS ("video/x-test-custom"));
+
+static void
+setup_videodecodertester (gboolean drop_first)
+{
+  dec = g_object_new (GST_VIDEO_DECODER_TESTER_TYPE, NULL);
+  ((GstVideoDecoderTester *) dec)->drop_first = drop_first;
+  mysrcpad = gst_check_setup_src_pad (dec, &srctemplate);
+  mysinkpad = gst_check_setup_sink_pad (dec, &sinktemplate);
+}
+
+static void
+cleanup_videodecodertest (void)
+{
+  gst_pad_set_active (mysrcpad, FALSE);
+  gst_pad_set_active (mysinkpad, FALSE);
+  gst_check_teardown_src_pad (dec);
+  gst_check_teardown_sink_pad (dec);
+  gst_check_teardown_element (dec);
+  gst_check_drop_buffers ();
+}
+
+static void
+start_stream (void)
+{
+  GstSegment segment;
+
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_stream_start ("test")));
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_caps (gst_caps_new_simple ("video/x-test-custom",
+                  "width", G_TYPE_INT, TEST_VIDEO_WIDTH,
+                  "height", G_TYPE_INT, TEST_VIDEO_HEIGHT,
+                  "framerate", GST_TYPE_FRACTION, TEST_VIDEO_FPS_N,
+                  TEST_VIDEO_FPS_D, NULL))));
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_segment (&segment)));
+}
+
+static void
+push_frames (guint n, gboolean timestamped)
+{
+  guint i;
+
+  for (i = 0; i < n; i++) {
+    GstBuffer *buf = gst_buffer_new_and_alloc (1);
+
+    if (timestamped) {
+      GST_BUFFER_PTS (buf) = gst_util_uint64_scale_round (i,
+          GST_SECOND * TEST_VIDEO_FPS_D, TEST_VIDEO_FPS_N);
+      GST_BUFFER_DURATION (buf) = gst_util_uint64_scale_round (1,
+          GST_SECOND * TEST_VIDEO_FPS_D, TEST_VIDEO_FPS_N);
+    }
+    fail_unless (gst_pad_push (mysrcpad, buf) == GST_FLOW_OK);
+  }
+}
+
+static void
+check_output_order (const guint * expected, guint n_expected)
+{
+  GList *l;
+  guint i;
+
+  fail_unless_equals_int (g_list_length (buffers), n_expected);
+  for (l = buffers, i = 0; l; l = l->next, i++) {
+    GstBuffer *buf = l->data;
+
+    fail_unless_equals_uint64 (GST_BUFFER_PTS (buf),
+        gst_util_uint64_scale_round (expected[i],
+            GST_SECOND * TEST_VIDEO_FPS_D, TEST_VIDEO_FPS_N));
+  }
+}
+
+GST_START_TEST (videodecoder_concurrent_order)
+{
+  const guint expected[] = { 0, 1, 2, 3, 4 };
+
+  setup_videodecodertester (FALSE);
+  gst_pad_set_active (mysrcpad, TRUE);
+  gst_element_set_state (dec, GST_STATE_PLAYING);
+  gst_pad_set_active (mysinkpad, TRUE);
+  start_stream ();
+
+  /* frames finished out of order go out in order */
+  push_frames (5, TRUE);
+  check_output_order (expected, 4);
+
+  /* the frame still held by the subclass is finished at EOS */
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_eos ()));
+  check_output_order (expected, 5);
+
+  cleanup_videodecodertest ();
+}
+
+GST_END_TEST;
+
+GST_START_TEST (videodecoder_concurrent_drop)
+{
+  const guint expected[] = { 1, 3 };
+
+  setup_videodecodertester (TRUE);
+  gst_pad_set_active (mysrcpad, TRUE);
+  gst_element_set_state (dec, GST_STATE_PLAYING);
+  gst_pad_set_active (mysinkpad, TRUE);
+  start_stream ();
+
+  /* dropping the frame a finished one waits for releases it */
+  push_frames (4, TRUE);
+  check_output_order (expected, 2);
+
+  cleanup_videodecodertest ();
+}
+
+GST_END_TEST;
+
+GST_START_TEST (videodecoder_concurrent_no_timestamps)
+{
+  GList *l;
+  guint i;
+
+  setup_videodecodertester (FALSE);
+  gst_pad_set_active (mysrcpad, TRUE);
+  gst_element_set_state (dec, GST_STATE_PLAYING);
+  gst_pad_set_active (mysinkpad, TRUE);
+  start_stream ();
+
+  /* without timestamps frames go out in decoding order */
+  push_frames (6, FALSE);
+  fail_unless_equals_int (g_list_length (buffers), 6);
+  for (l = buffers, i = 0; l; l = l->next, i++) {
+    guint8 number;
+
+    gst_buffer_extract (l->data, 0, &number, 1);
+    fail_unless_equals_int (number, i);
+  }
+
+  cleanup_videodecodertest ();
+}
+
+GST_END_TEST;
+
+static Suite *
+gst_videodecoder_suite (void)
+{
+  Suite *s = suite_create ("GstVideoDecoder");
+  TCase *tc = tcase_create ("general");
+
+  suite_add_tcase (s, tc);
+  tcase_add_test (tc, videodecoder_concurrent_order);
+  tcase_add_test (tc, videodecoder_concurrent_drop);
+  tcase_add_test (tc, videodecoder_concurrent_no_timestamps);
+
+  return s;
+}
+
+GST_CHECK_MAIN (gst_videodecoder);
@@ -0,0 +1,311 @@
+/* GStreamer
+ *
+ * Copyright (C) 2013 Collabora Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#include <gst/gst.h>
+#include <gst/check/gstcheck.h>
+#include <gst/video/video.h>
+
+static GstPad *mysrcpad, *mysinkpad;
+static GstElement *enc;
+
+static GMutex eos_lock;
+static GCond eos_cond;
+static gboolean got_eos;
+
+#define TEST_VIDEO_WIDTH 16
+#define TEST_VIDEO_HEIGHT 16
+#define TEST_VIDEO_FPS_N 25
+#define TEST_VIDEO_FPS_D 1
+
+#define GST_VIDEO_ENCODER_TESTER_TYPE gst_video_encoder_tester_get_type()
+static GType gst_video_encoder_tester_get_type (void);
+
+typedef struct _GstVideoEncoderTester GstVideoEncoderTester;
+typedef struct _GstVideoEncoderTesterClass GstVideoEncoderTesterClass;
+
+/* "Encodes" each frame into one byte holding its frame number and records
+ * the thread handle_frame runs on */
+struct _GstVideoEncoderTester
+{
+  GstVideoEncoder parent;
+
+  GThread *encode_thread;
+  gboolean other_thread;
+};
+
+struct _GstVideoEncoderTesterClass
+{
+  GstVideoEncoderClass parent_class;
+};
+
+G_DEFINE_TYPE (GstVideoEncoderTester, gst_video_encoder_tester,
+    GST_TYPE_VIDEO_ENCODER);
+
+static gboolean
+gst_video_encoder_tester_start (GstVideoEncoder * enc)
+{
+  gst_video_encoder_set_input_queue (enc, 2, 0);
+  return TRUE;
+}
+
+static gboolean
+gst_video_encoder_tester_set_format (GstVideoEncoder * enc,
+    GstVideoCodecState * state)
+{
+  GstVideoCodecState *res = gst_video_encoder_set_output_state (enc,
+      gst_caps_new_empty_simple ("video/x-test-custom"), state);
+
+  gst_video_codec_state_unref (res);
+  return TRUE;
+}
+
+static GstFlowReturn
+gst_video_encoder_tester_handle_frame (GstVideoEncoder * enc,
+    GstVideoCodecFrame * frame)
+{
+  GstVideoEncoderTester *tester = (GstVideoEncoderTester *) enc;
+  guint8 number = frame->system_frame_number;
+
+  if (tester->encode_thread == NULL)
+    tester->encode_thread = g_thread_self ();
+  else if (tester->encode_thread != g_thread_self ())
+    tester->other_thread = TRUE;
+
+  frame->output_buffer = gst_buffer_new_allocate (NULL, 1, NULL);
+  gst_buffer_fill (frame->output_buffer, 0, &number, 1);
+  GST_VIDEO_CODEC_FRAME_SET_SYNC_POINT (frame);
+
+  return gst_video_encoder_finish_frame (enc, frame);
+}
+
+static void
+gst_video_encoder_tester_class_init (GstVideoEncoderTesterClass * klass)
+{
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstVideoEncoderClass *videoencoder_class = GST_VIDEO_ENCODER_CLASS (klass);
+
+  static GstStaticPadTemplate sink_templ = GST_STATIC_PAD_TEMPLATE ("sink",
+      GST_PAD_SINK, GST_PAD_ALWAYS,
+      GST_STATIC_CAPS ("video/x-raw"));
+
+  static GstStaticPadTemplate src_templ = GST_STATIC_PAD_TEMPLATE ("src",
+      GST_PAD_SRC, GST_PAD_ALWAYS,
+      GST_STATIC_CAPS ("video/x-test-custom"));
+
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&sink_templ));
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&src_templ));
+
+  gst_element_class_set_metadata (element_class,
+      "VideoEncoderTester", "Encoder/Video", "yep", "me");
+
+  videoencoder_class->start = gst_video_encoder_tester_start;
+  videoencoder_class->set_format = gst_video_encoder_tester_set_format;
+  videoencoder_class->handle_frame = gst_video_encoder_tester_handle_frame;
+}
+
+static void
+gst_video_encoder_tester_init (GstVideoEncoderTester * tester)
+{
+}
+
+static GstStaticPadTemplate sinktemplate = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS ("video/x-test-custom"));
+
+static GstStaticPadTemplate srctemplate = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC, GST_PAD_ALWAYS, GST_STATIC_CAPS ("video/x-raw"));
+
+static GstPadProbeReturn
+eos_probe (GstPad * pad, GstPadProbeInfo * info, gpointer user_data)
+{
+  if (GST_EVENT_TYPE (GST_PAD_PROBE_INFO_EVENT (info)) == GST_EVENT_EOS) {
+    g_mutex_lock (&eos_lock);
+    got_eos = TRUE;
+    g_cond_signal (&eos_cond);
+    g_mutex_unlock (&eos_lock);
+  }
+
+  return GST_PAD_PROBE_OK;
+}
+
+static void
+setup_videoencodertester (void)
+{
+  enc = g_object_new (GST_VIDEO_ENCODER_TESTER_TYPE, NULL);
+  mysrcpad = gst_check_setup_src_pad (enc, &srctemplate);
+  mysinkpad = gst_check_setup_sink_pad (enc, &sinktemplate);
+  gst_pad_add_probe (mysinkpad, GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM,
+      eos_probe, NULL, NULL);
+  got_eos = FALSE;
+}
+
+static void
+cleanup_videoencodertest (void)
+{
+  gst_element_set_state (enc, GST_STATE_NULL);
+  gst_pad_set_active (mysrcpad, FALSE);
+  gst_pad_set_active (mysinkpad, FALSE);
+  gst_check_teardown_src_pad (enc);
+  gst_check_teardown_sink_pad (enc);
+  gst_check_teardown_element (enc);
+  gst_check_drop_buffers ();
+}
+
+static void
+start_stream (void)
+{
+  GstSegment segment;
+  GstVideoInfo info;
+
+  gst_video_info_set_format (&info, GST_VIDEO_FORMAT_GRAY8, TEST_VIDEO_WIDTH,
+      TEST_VIDEO_HEIGHT);
+  info.fps_n = TEST_VIDEO_FPS_N;
+  info.fps_d = TEST_VIDEO_FPS_D;
+
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_stream_start ("test")));
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_caps (gst_video_info_to_caps (&info))));
+  gst_segment_init (&segment, GST_FORMAT_TIME);
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_segment (&segment)));
+}
+
+static void
+push_frames (guint first, guint n)
+{
+  guint i;
+
+  for (i = first; i < first + n; i++) {
+    GstBuffer *buf;
+
+    buf = gst_buffer_new_allocate (NULL,
+        TEST_VIDEO_WIDTH * TEST_VIDEO_HEIGHT, NULL);
+    GST_BUFFER_PTS (buf) = gst_util_uint64_scale_round (i,
+        GST_SECOND * TEST_VIDEO_FPS_D, TEST_VIDEO_FPS_N);
+    GST_BUFFER_DURATION (buf) = gst_util_uint64_scale_round (1,
+        GST_SECOND * TEST_VIDEO_FPS_D, TEST_VIDEO_FPS_N);
+    fail_unless (gst_pad_push (mysrcpad, buf) == GST_FLOW_OK);
+  }
+}
+
+static void
+push_eos_and_wait (void)
+{
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_eos ()));
+
+  g_mutex_lock (&eos_lock);
+  while (!got_eos)
+    g_cond_wait (&eos_cond, &eos_lock);
+  g_mutex_unlock (&eos_lock);
+}
+
+static void
+check_output (guint n)
+{
+  GList *l;
+  guint i;
+
+  fail_unless_equals_int (g_list_length (buffers), n);
+  for (l = buffers, i = 0; l; l = l->next, i++) {
+    guint8 number;
+
+    gst_buffer_extract (l->data, 0, &number, 1);
+    fail_unless_equals_int (number, i);
+  }
+}
+
+GST_START_TEST (videoencoder_input_queue)
+{
+  GstVideoEncoderTester *tester;
+
+  setup_videoencodertester ();
+  tester = (GstVideoEncoderTester *) enc;
+  gst_pad_set_active (mysrcpad, TRUE);
+  gst_element_set_state (enc, GST_STATE_PLAYING);
+  gst_pad_set_active (mysinkpad, TRUE);
+
+  /* the encode thread runs as soon as the pads are active */
+  fail_unless (GST_PAD_TASK (GST_VIDEO_ENCODER_SRC_PAD (enc)) != NULL);
+  fail_unless_equals_int (gst_task_get_state (GST_PAD_TASK
+          (GST_VIDEO_ENCODER_SRC_PAD (enc))), GST_TASK_STARTED);
+
+  start_stream ();
+  push_frames (0, 10);
+
+  /* EOS is queued behind the frames and drains them in order */
+  push_eos_and_wait ();
+  check_output (10);
+
+  fail_unless (tester->encode_thread != NULL);
+  fail_unless (tester->encode_thread != g_thread_self ());
+  fail_if (tester->other_thread);
+
+  cleanup_videoencodertest ();
+}
+
+GST_END_TEST;
+
+GST_START_TEST (videoencoder_input_queue_flush)
+{
+  setup_videoencodertester ();
+  gst_pad_set_active (mysrcpad, TRUE);
+  gst_element_set_state (enc, GST_STATE_PLAYING);
+  gst_pad_set_active (mysinkpad, TRUE);
+
+  start_stream ();
+  push_frames (0, 5);
+
+  /* a flush pauses the encode thread and the flush stop starts it again */
+  fail_unless (gst_pad_push_event (mysrcpad, gst_event_new_flush_start ()));
+  fail_unless (gst_pad_push_event (mysrcpad,
+          gst_event_new_flush_stop (TRUE)));
+  fail_unless_equals_int (gst_task_get_state (GST_PAD_TASK
+          (GST_VIDEO_ENCODER_SRC_PAD (enc))), GST_TASK_STARTED);
+  gst_check_drop_buffers ();
+
+  start_stream ();
+  push_frames (5, 5);
+  push_eos_and_wait ();
+  fail_unless_equals_int (g_list_length (buffers), 5);
+
+  cleanup_videoencodertest ();
+}
+
+GST_END_TEST;
+
+static Suite *
+gst_videoencoder_suite (void)
+{
+  Suite *s = suite_create ("GstVideoEncoder");
+  TCase *tc = tcase_create ("general");
+
+  suite_add_tcase (s, tc);
+  tcase_add_test (tc, videoencoder_input_queue);
+  tcase_add_test (tc, videoencoder_input_queue_flush);
+
+  return s;
+}
+
+GST_CHECK_MAIN (gst_videoencoder);
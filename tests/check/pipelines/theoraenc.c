@@ -308,6 +308,133 @@ GST_START_TEST (test_continuity)
 
 GST_END_TEST;
 
+GST_START_TEST (test_adaptive_drop)
+{
+  GstElement *bin;
+  GstPad *pad;
+  gchar *pipe_str;
+  GstBuffer *buffer;
+  GError *error = NULL;
+  GstClockTime next_timestamp = 0;
+  guint i, n_empty = 0;
+
+  /* frames of 10us can't be encoded in time, so frames after the first
+   * one get dropped */
+  pipe_str = g_strdup_printf ("videotestsrc num-buffers=10"
+      " ! video/x-raw,format=(string)I420,width=320,height=240,"
+      "framerate=100000/1"
+      " ! theoraenc adaptive-speed=true adaptive-max-lag=1"
+      " ! fakesink name=fs0");
+
+  bin = gst_parse_launch (pipe_str, &error);
+  fail_unless (bin != NULL, "Error parsing pipeline: %s",
+      error ? error->message : "(invalid error)");
+  g_free (pipe_str);
+
+  {
+    GstElement *sink = gst_bin_get_by_name (GST_BIN (bin), "fs0");
+
+    fail_unless (sink != NULL, "Could not get fakesink out of bin");
+    pad = gst_element_get_static_pad (sink, "sink");
+    fail_unless (pad != NULL, "Could not get pad out of fakesink");
+    gst_object_unref (sink);
+  }
+
+  gst_buffer_straw_start_pipeline (bin, pad);
+
+  for (i = 0; i < 3; i++) {
+    buffer = gst_buffer_straw_get_buffer (bin, pad);
+    check_buffer_is_header (buffer, TRUE);
+    gst_buffer_unref (buffer);
+  }
+
+  /* dropped frames are still sent, as empty packets */
+  for (i = 0; i < 10; i++) {
+    buffer = gst_buffer_straw_get_buffer (bin, pad);
+    check_buffer_is_header (buffer, FALSE);
+    check_buffer_timestamp (buffer, next_timestamp);
+    if (i == 0)
+      fail_unless (gst_buffer_get_size (buffer) > 0);
+    else if (gst_buffer_get_size (buffer) == 0)
+      n_empty++;
+    next_timestamp += GST_BUFFER_DURATION (buffer);
+    gst_buffer_unref (buffer);
+  }
+  fail_unless (n_empty > 0);
+
+  gst_buffer_straw_stop_pipeline (bin, pad);
+
+  gst_object_unref (pad);
+  gst_object_unref (bin);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_adaptive_drop_keyframe_distance)
+{
+  GstElement *bin;
+  GstPad *pad;
+  gchar *pipe_str;
+  GstBuffer *buffer;
+  GError *error = NULL;
+  guint i, n_empty = 0;
+
+  /* with keyframes at least every 4 frames the granule shift is 2, runs of
+   * dropped frames must not push the keyframe distance past that */
+  pipe_str = g_strdup_printf ("videotestsrc num-buffers=40"
+      " ! video/x-raw,format=(string)I420,width=320,height=240,"
+      "framerate=100000/1"
+      " ! theoraenc keyframe-force=4 adaptive-speed=true adaptive-max-lag=1"
+      " ! fakesink name=fs0");
+
+  bin = gst_parse_launch (pipe_str, &error);
+  fail_unless (bin != NULL, "Error parsing pipeline: %s",
+      error ? error->message : "(invalid error)");
+  g_free (pipe_str);
+
+  {
+    GstElement *sink = gst_bin_get_by_name (GST_BIN (bin), "fs0");
+
+    fail_unless (sink != NULL, "Could not get fakesink out of bin");
+    pad = gst_element_get_static_pad (sink, "sink");
+    fail_unless (pad != NULL, "Could not get pad out of fakesink");
+    gst_object_unref (sink);
+  }
+
+  gst_buffer_straw_start_pipeline (bin, pad);
+
+  for (i = 0; i < 3; i++) {
+    buffer = gst_buffer_straw_get_buffer (bin, pad);
+    check_buffer_is_header (buffer, TRUE);
+    gst_buffer_unref (buffer);
+  }
+
+  for (i = 0; i < 40; i++) {
+    guint64 granulepos;
+
+    buffer = gst_buffer_straw_get_buffer (bin, pad);
+    check_buffer_is_header (buffer, FALSE);
+    granulepos = GST_BUFFER_OFFSET_END (buffer);
+
+    if (!old_libtheora) {
+      fail_unless_equals_uint64 ((granulepos >> 2) + (granulepos & 3), i + 1);
+      if ((granulepos & 3) == 0)
+        fail_if (GST_BUFFER_FLAG_IS_SET (buffer, GST_BUFFER_FLAG_DELTA_UNIT));
+    }
+    if (gst_buffer_get_size (buffer) == 0)
+      n_empty++;
+    gst_buffer_unref (buffer);
+  }
+  fail_unless (n_empty > 0);
+
+  gst_buffer_straw_stop_pipeline (bin, pad);
+
+  gst_object_unref (pad);
+  gst_object_unref (bin);
+}
+
+GST_END_TEST;
+
 #endif /* #ifndef GST_DISABLE_PARSE */
 
 static Suite *
@@ -323,6 +450,8 @@ theoraenc_suite (void)
 #ifndef GST_DISABLE_PARSE
   tcase_add_test (tc_chain, test_granulepos_offset);
   tcase_add_test (tc_chain, test_continuity);
+  tcase_add_test (tc_chain, test_adaptive_drop);
+  tcase_add_test (tc_chain, test_adaptive_drop_keyframe_distance);
 #endif
 
   return s;
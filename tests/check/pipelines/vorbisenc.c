@@ -374,6 +374,80 @@ GST_START_TEST (test_discontinuity)
 
 GST_END_TEST;
 
+static gint64 chunk_last_granulepos;
+static GstClockTime chunk_next_timestamp;
+static guint chunk_n_buffers;
+
+static GstPadProbeReturn
+check_chunk_buffer (GstPad * pad, GstPadProbeInfo * info, gpointer unused)
+{
+  GstBuffer *buffer = GST_PAD_PROBE_INFO_BUFFER (info);
+  gint64 granulepos = GST_BUFFER_OFFSET_END (buffer);
+
+  /* skip headers */
+  if (GST_BUFFER_FLAG_IS_SET (buffer, GST_BUFFER_FLAG_HEADER))
+    return GST_PAD_PROBE_OK;
+
+  fail_unless (granulepos >= chunk_last_granulepos,
+      "granulepos %" G_GINT64_FORMAT " after %" G_GINT64_FORMAT,
+      granulepos, chunk_last_granulepos);
+  check_buffer_timestamp (buffer, chunk_next_timestamp);
+
+  chunk_next_timestamp += GST_BUFFER_DURATION (buffer);
+  chunk_last_granulepos = granulepos;
+  chunk_n_buffers++;
+
+  return GST_PAD_PROBE_OK;
+}
+
+GST_START_TEST (test_chunks)
+{
+  GstElement *bin, *sink;
+  GstPad *pad;
+  GstBus *bus;
+  GstMessage *msg;
+  GError *error = NULL;
+
+  /* 5 seconds in chunks of one second, on 3 threads */
+  bin = gst_parse_launch ("audiotestsrc num-buffers=215 samplesperbuffer=1024"
+      " ! audio/x-raw,rate=44100,channels=2 ! audioconvert"
+      " ! vorbisenc chunk-duration=1000000000 n-threads=3"
+      " ! fakesink name=sink", &error);
+  fail_unless (bin != NULL, "Error parsing pipeline: %s",
+      error ? error->message : "(invalid error)");
+
+  sink = gst_bin_get_by_name (GST_BIN (bin), "sink");
+  pad = gst_element_get_static_pad (sink, "sink");
+  gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_BUFFER,
+      (GstPadProbeCallback) check_chunk_buffer, NULL, NULL);
+  gst_object_unref (sink);
+
+  chunk_last_granulepos = 0;
+  chunk_next_timestamp = 0;
+  chunk_n_buffers = 0;
+
+  fail_unless (gst_element_set_state (bin, GST_STATE_PLAYING)
+      != GST_STATE_CHANGE_FAILURE);
+
+  bus = gst_element_get_bus (bin);
+  msg = gst_bus_timed_pop_filtered (bus, GST_CLOCK_TIME_NONE,
+      GST_MESSAGE_EOS | GST_MESSAGE_ERROR);
+  fail_unless (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_EOS);
+  gst_message_unref (msg);
+  gst_object_unref (bus);
+
+  /* the joined chunks cover all of the input */
+  fail_unless (chunk_n_buffers > 0);
+  fail_unless_equals_int (chunk_last_granulepos, 215 * 1024);
+
+  fail_unless (gst_element_set_state (bin, GST_STATE_NULL)
+      == GST_STATE_CHANGE_SUCCESS);
+  gst_object_unref (pad);
+  gst_object_unref (bin);
+}
+
+GST_END_TEST;
+
 #endif /* #ifndef GST_DISABLE_PARSE */
 
 static Suite *
@@ -387,6 +461,7 @@ vorbisenc_suite (void)
   tcase_add_test (tc_chain, test_granulepos_offset);
   tcase_add_test (tc_chain, test_timestamps);
   tcase_add_test (tc_chain, test_discontinuity);
+  tcase_add_test (tc_chain, test_chunks);
 #endif
 
   return s;
@@ -0,0 +1,99 @@
+/* GStreamer audioresample benchmark
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* Resamples N_BUFFERS buffers of stereo audio from 48000 to 44100 Hz for
+ * each sample format and quality of the audioresample element, and prints the
+ * time it takes per run. A format name can be given on the command line to
+ * only run that format. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gst/gst.h>
+
+#define N_BUFFERS 1000
+
+static const gchar *formats[] = { "S16LE", "F32LE", "F64LE" };
+
+static void
+run_format (const gchar * format, gint quality)
+{
+  GstElement *pipeline;
+  GstBus *bus;
+  GstMessage *msg;
+  GError *error = NULL;
+  gchar *desc;
+  gint64 start, elapsed;
+
+  desc = g_strdup_printf ("audiotestsrc num-buffers=%d samplesperbuffer=1024 "
+      "! audio/x-raw,format=%s,rate=48000,channels=2 "
+      "! audioresample quality=%d ! audio/x-raw,rate=44100 "
+      "! fakesink sync=false", N_BUFFERS, format, quality);
+  pipeline = gst_parse_launch (desc, &error);
+  g_free (desc);
+
+  if (pipeline == NULL) {
+    g_print ("could not create pipeline: %s\n", error->message);
+    g_error_free (error);
+    return;
+  }
+
+  bus = gst_element_get_bus (pipeline);
+
+  start = g_get_monotonic_time ();
+  gst_element_set_state (pipeline, GST_STATE_PLAYING);
+  msg = gst_bus_timed_pop_filtered (bus, GST_CLOCK_TIME_NONE,
+      GST_MESSAGE_EOS | GST_MESSAGE_ERROR);
+  elapsed = g_get_monotonic_time () - start;
+
+  if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_ERROR) {
+    gst_message_parse_error (msg, &error, NULL);
+    g_print ("%-6s quality %2d: error %s\n", format, quality, error->message);
+    g_error_free (error);
+  } else {
+    g_print ("%-6s quality %2d: %8.3f ms\n", format, quality,
+        (gdouble) elapsed / 1000);
+  }
+  gst_message_unref (msg);
+
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+  gst_object_unref (bus);
+  gst_object_unref (pipeline);
+}
+
+gint
+main (gint argc, gchar ** argv)
+{
+  gint i, q;
+
+  gst_init (&argc, &argv);
+
+  g_print ("48000 -> 44100 Hz, 2 channels, %d buffers of 1024 samples\n",
+      N_BUFFERS);
+
+  for (i = 0; i < G_N_ELEMENTS (formats); i++) {
+    if (argc > 1 && g_ascii_strcasecmp (argv[1], formats[i]) != 0)
+      continue;
+
+    for (q = 0; q <= 10; q++)
+      run_format (formats[i], q);
+  }
+
+  return 0;
+}
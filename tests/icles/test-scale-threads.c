@@ -0,0 +1,107 @@
+/* GStreamer multithreaded videoscale benchmark
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* Scales 4K frames down to 640x360 with the given method (lanczos by
+ * default) and n-threads set to 1, 2, 4... up to the number of processors,
+ * and prints the frame rate for each of them. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+
+#include <gst/gst.h>
+
+#define N_BUFFERS 50
+
+static gdouble
+run_pipeline (const gchar * method, const gchar * format, guint n_threads)
+{
+  GstElement *pipeline;
+  GstMessage *msg;
+  GError *error = NULL;
+  gchar *pstr;
+  gint64 start, end;
+
+  pstr = g_strdup_printf ("videotestsrc num-buffers=%d pattern=black ! "
+      "video/x-raw,format=%s,width=3840,height=2160 ! "
+      "videoscale method=%s n-threads=%u ! video/x-raw,width=640,height=360 ! "
+      "fakesink sync=false", N_BUFFERS, format, method, n_threads);
+  pipeline = gst_parse_launch (pstr, &error);
+  g_free (pstr);
+
+  if (pipeline == NULL) {
+    g_print ("failed to create pipeline: %s\n", error->message);
+    g_error_free (error);
+    exit (-1);
+  }
+
+  gst_element_set_state (pipeline, GST_STATE_PAUSED);
+  gst_element_get_state (pipeline, NULL, NULL, GST_CLOCK_TIME_NONE);
+
+  start = g_get_monotonic_time ();
+  gst_element_set_state (pipeline, GST_STATE_PLAYING);
+  msg = gst_bus_timed_pop_filtered (GST_ELEMENT_BUS (pipeline),
+      GST_CLOCK_TIME_NONE, GST_MESSAGE_EOS | GST_MESSAGE_ERROR);
+  end = g_get_monotonic_time ();
+
+  if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_ERROR) {
+    g_print ("error while running the pipeline\n");
+    exit (-1);
+  }
+  gst_message_unref (msg);
+
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+  gst_object_unref (pipeline);
+
+  return N_BUFFERS * 1e6 / (end - start);
+}
+
+gint
+main (gint argc, gchar ** argv)
+{
+  const gchar *method = "lanczos", *format = "AYUV";
+  guint n_threads, max_threads;
+  gdouble fps, base_fps = 0.0;
+
+  gst_init (&argc, &argv);
+
+  if (argc > 1)
+    method = argv[1];
+  if (argc > 2)
+    format = argv[2];
+
+#if GLIB_CHECK_VERSION(2,36,0)
+  max_threads = g_get_num_processors ();
+#else
+  max_threads = 4;
+#endif
+
+  g_print ("method %s, format %s, 3840x2160 -> 640x360\n", method, format);
+
+  for (n_threads = 1; n_threads <= max_threads; n_threads *= 2) {
+    fps = run_pipeline (method, format, n_threads);
+    if (n_threads == 1)
+      base_fps = fps;
+    g_print ("%2u threads: %7.2f fps (x%.2f)\n", n_threads, fps,
+        fps / base_fps);
+  }
+
+  return 0;
+}
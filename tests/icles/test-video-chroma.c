@@ -0,0 +1,95 @@
+/* GStreamer chroma resampling benchmark
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* Resamples the chroma of 1920x1080 frames of AYUV and AYUV64 lines for
+ * 4:2:0 up and downsampling with jpeg and mpeg2 siting and prints the time
+ * it takes per frame. Run with ORC_CODE=backup to compare against the C
+ * code. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gst/gst.h>
+#include <gst/video/video.h>
+
+#define WIDTH 1920
+#define HEIGHT 1080
+#define N_FRAMES 20
+
+static void
+run_resample (GstVideoFormat format, GstVideoChromaSite site, gint factor)
+{
+  GstVideoChromaResample *resample;
+  gpointer lines[4];
+  guint8 *pixels;
+  guint n_lines;
+  gint i, n, y, stride;
+  gint64 start, time = 0;
+
+  resample = gst_video_chroma_resample_new (GST_VIDEO_CHROMA_METHOD_LINEAR,
+      site, GST_VIDEO_CHROMA_FLAG_NONE, format, factor, factor);
+  gst_video_chroma_resample_get_info (resample, &n_lines, NULL);
+
+  stride = WIDTH * (format == GST_VIDEO_FORMAT_AYUV64 ? 8 : 4);
+  pixels = g_malloc (stride * n_lines);
+  for (i = 0; i < stride * n_lines; i++)
+    pixels[i] = g_random_int ();
+  for (i = 0; i < n_lines; i++)
+    lines[i] = pixels + i * stride;
+
+  for (n = 0; n < N_FRAMES; n++) {
+    start = g_get_monotonic_time ();
+    for (y = 0; y < HEIGHT; y += n_lines)
+      gst_video_chroma_resample (resample, lines, WIDTH);
+    time += g_get_monotonic_time () - start;
+  }
+
+  g_print ("%-8s %-6s %-10s %8.3f ms/frame\n",
+      gst_video_format_to_string (format), gst_video_chroma_to_string (site),
+      factor > 0 ? "upsample" : "downsample",
+      (gdouble) time / (N_FRAMES * 1000));
+
+  g_free (pixels);
+  gst_video_chroma_resample_free (resample);
+}
+
+gint
+main (gint argc, gchar ** argv)
+{
+  static const GstVideoFormat formats[] = { GST_VIDEO_FORMAT_AYUV,
+    GST_VIDEO_FORMAT_AYUV64
+  };
+  static const GstVideoChromaSite sites[] = { GST_VIDEO_CHROMA_SITE_JPEG,
+    GST_VIDEO_CHROMA_SITE_MPEG2
+  };
+  gint i, j;
+
+  gst_init (&argc, &argv);
+
+  g_print ("%dx%d, %d frames\n", WIDTH, HEIGHT, N_FRAMES);
+
+  for (i = 0; i < G_N_ELEMENTS (formats); i++) {
+    for (j = 0; j < G_N_ELEMENTS (sites); j++) {
+      run_resample (formats[i], sites[j], 1);
+      run_resample (formats[i], sites[j], -1);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,118 @@
+/* GStreamer video format pack/unpack benchmark
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* Unpacks and packs 1920x1080 frames of every video format that has
+ * pack and unpack functions, and prints the time it takes per frame for
+ * each direction. A format name can be given on the command line to only
+ * run that format. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gst/gst.h>
+#include <gst/video/video.h>
+
+#define WIDTH 1920
+#define HEIGHT 1080
+#define N_FRAMES 20
+
+static void
+run_format (GstVideoFormat format)
+{
+  const GstVideoFormatInfo *finfo;
+  GstVideoInfo info;
+  gpointer data[GST_VIDEO_MAX_PLANES] = { NULL, };
+  guint8 *pixels, *tmpline;
+  gint i, y, n, pack_lines;
+  gint64 start, unpack_time = 0, pack_time = 0;
+
+  finfo = gst_video_format_get_info (format);
+  if (finfo->unpack_func == NULL || finfo->pack_func == NULL)
+    return;
+
+  gst_video_info_set_format (&info, format, WIDTH, HEIGHT);
+
+  pixels = g_malloc0 (info.size);
+  for (i = 0; i < GST_VIDEO_FORMAT_INFO_N_PLANES (finfo); i++)
+    data[i] = pixels + info.offset[i];
+
+  pack_lines = finfo->pack_lines;
+  /* some unpack functions write full pixel groups, leave room for that */
+  tmpline = g_malloc0 (pack_lines * (WIDTH + 16) * 8);
+
+  for (n = 0; n < N_FRAMES; n++) {
+    for (y = 0; y < HEIGHT; y += pack_lines) {
+      start = g_get_monotonic_time ();
+      for (i = 0; i < pack_lines; i++)
+        finfo->unpack_func (finfo, GST_VIDEO_PACK_FLAG_NONE,
+            tmpline + i * (WIDTH + 16) * 8, data, info.stride, 0, y + i,
+            WIDTH);
+      unpack_time += g_get_monotonic_time () - start;
+
+      start = g_get_monotonic_time ();
+      finfo->pack_func (finfo, GST_VIDEO_PACK_FLAG_NONE, tmpline,
+          (WIDTH + 16) * 8, data, info.stride, info.chroma_site, y, WIDTH);
+      pack_time += g_get_monotonic_time () - start;
+    }
+  }
+
+  g_print ("%-12s unpack %8.3f ms/frame   pack %8.3f ms/frame\n",
+      gst_video_format_to_string (format),
+      (gdouble) unpack_time / (N_FRAMES * 1000),
+      (gdouble) pack_time / (N_FRAMES * 1000));
+
+  g_free (tmpline);
+  g_free (pixels);
+}
+
+gint
+main (gint argc, gchar ** argv)
+{
+  GEnumClass *klass;
+  gint i;
+
+  gst_init (&argc, &argv);
+
+  if (argc > 1) {
+    GstVideoFormat format = gst_video_format_from_string (argv[1]);
+
+    if (format == GST_VIDEO_FORMAT_UNKNOWN) {
+      g_print ("unknown format %s\n", argv[1]);
+      return -1;
+    }
+    run_format (format);
+    return 0;
+  }
+
+  g_print ("%dx%d, %d frames\n", WIDTH, HEIGHT, N_FRAMES);
+
+  klass = g_type_class_ref (GST_TYPE_VIDEO_FORMAT);
+  for (i = 0; i < klass->n_values; i++) {
+    GstVideoFormat format = klass->values[i].value;
+
+    if (format == GST_VIDEO_FORMAT_UNKNOWN ||
+        format == GST_VIDEO_FORMAT_ENCODED)
+      continue;
+
+    run_format (format);
+  }
+  g_type_class_unref (klass);
+
+  return 0;
+}
@@ -0,0 +1,138 @@
+/* GStreamer controlled volume benchmark
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/* Runs N_BUFFERS buffers of audio through the volume element for each sample
+ * format and a few channel counts, once with a static volume and once with
+ * the volume controlled by a linear fade, and prints the time it takes per
+ * run. A format name can be given on the command line to only run that
+ * format. */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gst/gst.h>
+#include <gst/controller/gstinterpolationcontrolsource.h>
+#include <gst/controller/gstdirectcontrolbinding.h>
+
+#define N_BUFFERS 1000
+#define SAMPLES_PER_BUFFER 1024
+#define RATE 48000
+
+static const gchar *formats[] = { "S8", "S16LE", "S32LE", "F32LE", "F64LE" };
+static const gint channels[] = { 1, 2, 6 };
+
+static gint64
+run_pipeline (const gchar * format, gint n_channels, gboolean controlled)
+{
+  GstElement *pipeline, *volume;
+  GstControlSource *cs;
+  GstBus *bus;
+  GstMessage *msg;
+  GError *error = NULL;
+  gchar *desc;
+  gint64 start, elapsed;
+
+  desc = g_strdup_printf ("audiotestsrc num-buffers=%d samplesperbuffer=%d "
+      "! audio/x-raw,format=%s,rate=%d,channels=%d "
+      "! volume name=volume volume=0.5 ! fakesink sync=false", N_BUFFERS,
+      SAMPLES_PER_BUFFER, format, RATE, n_channels);
+  pipeline = gst_parse_launch (desc, &error);
+  g_free (desc);
+
+  if (pipeline == NULL) {
+    g_print ("could not create pipeline: %s\n", error->message);
+    g_error_free (error);
+    return -1;
+  }
+
+  if (controlled) {
+    volume = gst_bin_get_by_name (GST_BIN (pipeline), "volume");
+    cs = gst_interpolation_control_source_new ();
+    g_object_set (cs, "mode", GST_INTERPOLATION_MODE_LINEAR, NULL);
+    /* control values are the volume divided by 10 */
+    gst_timed_value_control_source_set (GST_TIMED_VALUE_CONTROL_SOURCE (cs),
+        0, 0.0);
+    gst_timed_value_control_source_set (GST_TIMED_VALUE_CONTROL_SOURCE (cs),
+        gst_util_uint64_scale_int (N_BUFFERS * SAMPLES_PER_BUFFER,
+            GST_SECOND, RATE), 0.1);
+    gst_object_add_control_binding (GST_OBJECT (volume),
+        gst_direct_control_binding_new (GST_OBJECT (volume), "volume", cs));
+    gst_object_unref (cs);
+    gst_object_unref (volume);
+  }
+
+  bus = gst_element_get_bus (pipeline);
+
+  start = g_get_monotonic_time ();
+  gst_element_set_state (pipeline, GST_STATE_PLAYING);
+  msg = gst_bus_timed_pop_filtered (bus, GST_CLOCK_TIME_NONE,
+      GST_MESSAGE_EOS | GST_MESSAGE_ERROR);
+  elapsed = g_get_monotonic_time () - start;
+
+  if (GST_MESSAGE_TYPE (msg) == GST_MESSAGE_ERROR) {
+    gst_message_parse_error (msg, &error, NULL);
+    g_print ("%-6s %d channels: error %s\n", format, n_channels,
+        error->message);
+    g_error_free (error);
+    elapsed = -1;
+  }
+  gst_message_unref (msg);
+
+  gst_element_set_state (pipeline, GST_STATE_NULL);
+  gst_object_unref (bus);
+  gst_object_unref (pipeline);
+
+  return elapsed;
+}
+
+static void
+run_format (const gchar * format, gint n_channels)
+{
+  gint64 static_time, controlled_time;
+
+  static_time = run_pipeline (format, n_channels, FALSE);
+  controlled_time = run_pipeline (format, n_channels, TRUE);
+  if (static_time < 0 || controlled_time < 0)
+    return;
+
+  g_print ("%-6s %d channels: static %8.3f ms   controlled %8.3f ms\n",
+      format, n_channels, (gdouble) static_time / 1000,
+      (gdouble) controlled_time / 1000);
+}
+
+gint
+main (gint argc, gchar ** argv)
+{
+  gint i, c;
+
+  gst_init (&argc, &argv);
+
+  g_print ("%d buffers of %d samples at %d Hz\n", N_BUFFERS,
+      SAMPLES_PER_BUFFER, RATE);
+
+  for (i = 0; i < G_N_ELEMENTS (formats); i++) {
+    if (argc > 1 && g_ascii_strcasecmp (argv[1], formats[i]) != 0)
+      continue;
+
+    for (c = 0; c < G_N_ELEMENTS (channels); c++)
+      run_format (formats[i], channels[c]);
+  }
+
+  return 0;
+}
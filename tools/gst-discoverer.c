@@ -22,6 +22,7 @@
 #endif
 
 #include <stdlib.h>
+#include <string.h>
 #include <glib.h>
 #include <gst/gst.h>
 #include <gst/pbutils/pbutils.h>
@@ -29,12 +30,18 @@
 static gboolean async = FALSE;
 static gboolean show_toc = FALSE;
 static gboolean verbose = FALSE;
+static gboolean machine = FALSE;
+
+/* start times of the uris being discovered, for the machine readable
+ * output */
+static GMutex start_times_lock;
+static GHashTable *start_times = NULL;
+static guint n_discovered = 0;
 
 typedef struct
 {
   GstDiscoverer *dc;
-  int argc;
-  char **argv;
+  GPtrArray *inputs;
 } PrivStruct;
 
 static void
@@ -451,6 +458,68 @@ print_info (GstDiscovererInfo * info, GError * err)
   g_print ("\n");
 }
 
+static const gchar *
+result_to_string (GstDiscovererResult result)
+{
+  switch (result) {
+    case GST_DISCOVERER_OK:
+      return "ok";
+    case GST_DISCOVERER_URI_INVALID:
+      return "uri-invalid";
+    case GST_DISCOVERER_ERROR:
+      return "error";
+    case GST_DISCOVERER_TIMEOUT:
+      return "timeout";
+    case GST_DISCOVERER_BUSY:
+      return "busy";
+    case GST_DISCOVERER_MISSING_PLUGINS:
+      return "missing-plugins";
+  }
+  return "unknown";
+}
+
+/* one line per uri: uri, result, duration (ns), seekable, discovery time (us)
+ * and error message, separated by tabs */
+static void
+print_machine_info (GstDiscovererInfo * info, GError * err, gint64 elapsed)
+{
+  gchar *msg;
+
+  msg = err ? g_strescape (err->message, NULL) : g_strdup ("");
+  g_print ("%s\t%s\t%" G_GUINT64_FORMAT "\t%d\t%" G_GINT64_FORMAT "\t%s\n",
+      gst_discoverer_info_get_uri (info),
+      result_to_string (gst_discoverer_info_get_result (info)),
+      gst_discoverer_info_get_duration (info),
+      gst_discoverer_info_get_seekable (info), elapsed, msg);
+  g_free (msg);
+}
+
+static void
+set_start_time (const gchar * uri)
+{
+  gint64 *start = g_new (gint64, 1);
+
+  *start = g_get_monotonic_time ();
+  g_mutex_lock (&start_times_lock);
+  g_hash_table_insert (start_times, g_strdup (uri), start);
+  g_mutex_unlock (&start_times_lock);
+}
+
+static gint64
+get_elapsed_time (const gchar * uri)
+{
+  gint64 *start, elapsed = -1;
+
+  g_mutex_lock (&start_times_lock);
+  if ((start = g_hash_table_lookup (start_times, uri))) {
+    elapsed = g_get_monotonic_time () - *start;
+    g_hash_table_remove (start_times, uri);
+  }
+  g_mutex_unlock (&start_times_lock);
+
+  return elapsed;
+}
+
 static void
 process_file (GstDiscoverer * dc, const gchar * filename)
 {
@@ -498,10 +567,18 @@ process_file (GstDiscoverer * dc, const gchar * filename)
     uri = g_strdup (filename);
   }
 
+  if (machine)
+    set_start_time (uri);
+
   if (async == FALSE) {
-    g_print ("Analyzing %s\n", uri);
+    if (!machine)
+      g_print ("Analyzing %s\n", uri);
     info = gst_discoverer_discover_uri (dc, uri, &err);
-    print_info (info, err);
+    if (machine)
+      print_machine_info (info, err, get_elapsed_time (uri));
+    else
+      print_info (info, err);
+    n_discovered++;
     if (err)
       g_error_free (err);
     gst_discoverer_info_unref (info);
@@ -515,20 +592,78 @@ process_file (GstDiscoverer * dc, const gchar * filename)
 static void
 _new_discovered_uri (GstDiscoverer * dc, GstDiscovererInfo * info, GError * err)
 {
-  print_info (info, err);
+  if (machine)
+    print_machine_info (info, err,
+        get_elapsed_time (gst_discoverer_info_get_uri (info)));
+  else
+    print_info (info, err);
+  n_discovered++;
+}
+
+/* queued uris can wait for a free pipeline, so restart their clock when
+ * their source is created */
+static void
+_source_setup (GstDiscoverer * dc, GstElement * source, gpointer user_data)
+{
+  gchar *uri;
+
+  if (!GST_IS_URI_HANDLER (source))
+    return;
+
+  uri = gst_uri_handler_get_uri (GST_URI_HANDLER (source));
+  if (uri) {
+    gint64 *start;
+
+    g_mutex_lock (&start_times_lock);
+    if ((start = g_hash_table_lookup (start_times, uri)))
+      *start = g_get_monotonic_time ();
+    g_mutex_unlock (&start_times_lock);
+    g_free (uri);
+  }
 }
 
 static gboolean
 _run_async (PrivStruct * ps)
 {
-  gint i;
+  guint i;
 
-  for (i = 1; i < ps->argc; i++)
-    process_file (ps->dc, ps->argv[i]);
+  for (i = 0; i < ps->inputs->len; i++)
+    process_file (ps->dc, g_ptr_array_index (ps->inputs, i));
 
   return FALSE;
 }
 
+/* adds the files or uris listed in @filename, one per line, to @inputs. "-"
+ * reads the list from stdin. */
+static gboolean
+read_file_list (const gchar * filename, GPtrArray * inputs, GError ** err)
+{
+  GIOChannel *channel;
+  GIOStatus status;
+  gchar *line;
+  gsize term;
+
+  if (strcmp (filename, "-") == 0)
+    channel = g_io_channel_unix_new (0);
+  else
+    channel = g_io_channel_new_file (filename, "r", err);
+
+  if (channel == NULL)
+    return FALSE;
+
+  while ((status = g_io_channel_read_line (channel, &line, NULL, &term,
+              err)) == G_IO_STATUS_NORMAL) {
+    line[term] = '\0';
+    if (line[0] != '\0')
+      g_ptr_array_add (inputs, line);
+    else
+      g_free (line);
+  }
+  g_io_channel_unref (channel);
+
+  return status == G_IO_STATUS_EOF;
+}
+
 static void
 _discoverer_finished (GstDiscoverer * dc, GMainLoop * ml)
 {
@@ -541,6 +676,11 @@ main (int argc, char **argv)
   GError *err = NULL;
   GstDiscoverer *dc;
   gint timeout = 10;
+  gint jobs = 1;
+  gchar *file_list = NULL;
+  GPtrArray *inputs;
+  gint64 start;
+  gint i;
   GOptionEntry options[] = {
     {"async", 'a', 0, G_OPTION_ARG_NONE, &async,
         "Run asynchronously", NULL},
@@ -552,6 +692,14 @@ main (int argc, char **argv)
         "Output TOC (chapters and editions)", NULL},
     {"verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose,
         "Verbose properties", NULL},
+    {"jobs", 'j', 0, G_OPTION_ARG_INT, &jobs,
+        "Discover N uris at the same time, implies --async (default 1)", "N"},
+    {"file-list", 'f', 0, G_OPTION_ARG_FILENAME, &file_list,
+        "Also discover the files or uris listed in FILE, one per line "
+        "(- for stdin)", "FILE"},
+    {"machine-readable", 'm', 0, G_OPTION_ARG_NONE, &machine,
+        "Print one tab separated line with the result and the discovery "
+        "time per uri", NULL},
     {NULL}
   };
   GOptionContext *ctx;
@@ -569,7 +717,16 @@ main (int argc, char **argv)
 
   g_option_context_free (ctx);
 
-  if (argc < 2) {
+  inputs = g_ptr_array_new_with_free_func (g_free);
+  for (i = 1; i < argc; i++)
+    g_ptr_array_add (inputs, g_strdup (argv[i]));
+
+  if (file_list && !read_file_list (file_list, inputs, &err)) {
+    g_print ("Error reading %s: %s\n", file_list, err->message);
+    exit (1);
+  }
+
+  if (inputs->len == 0) {
     g_print ("usage: %s <uris>\n", argv[0]);
     exit (-1);
   }
@@ -580,17 +737,26 @@ main (int argc, char **argv)
     exit (1);
   }
 
+  if (jobs > 1) {
+    async = TRUE;
+    g_object_set (dc, "max-concurrent", CLAMP (jobs, 1, 64), NULL);
+  }
+
+  start_times = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+  start = g_get_monotonic_time ();
+
+  if (machine)
+    g_print ("# uri\tresult\tduration\tseekable\ttime-us\terror\n");
+
   if (async == FALSE) {
-    gint i;
-    for (i = 1; i < argc; i++)
-      process_file (dc, argv[i]);
+    for (i = 0; i < inputs->len; i++)
+      process_file (dc, g_ptr_array_index (inputs, i));
   } else {
     PrivStruct *ps = g_new0 (PrivStruct, 1);
     GMainLoop *ml = g_main_loop_new (NULL, FALSE);
 
     ps->dc = dc;
-    ps->argc = argc;
-    ps->argv = argv;
+    ps->inputs = inputs;
 
     /* adding uris will be started when the mainloop runs */
     g_idle_add ((GSourceFunc) _run_async, ps);
@@ -598,6 +764,8 @@ main (int argc, char **argv)
     /* connect signals */
     g_signal_connect (dc, "discovered", G_CALLBACK (_new_discovered_uri), NULL);
     g_signal_connect (dc, "finished", G_CALLBACK (_discoverer_finished), ml);
+    if (machine)
+      g_signal_connect (dc, "source-setup", G_CALLBACK (_source_setup), NULL);
 
     gst_discoverer_start (dc);
     /* run mainloop */
@@ -609,5 +777,17 @@ main (int argc, char **argv)
   }
   g_object_unref (dc);
 
+  if (machine) {
+    gdouble secs = (g_get_monotonic_time () - start) / (gdouble) G_USEC_PER_SEC;
+
+    g_print ("# %u uris in %.3f s (%.1f per second) with %d jobs\n",
+        n_discovered, secs, secs > 0 ? n_discovered / secs : 0.0,
+        MAX (jobs, 1));
+  }
+
+  g_hash_table_unref (start_times);
+  g_ptr_array_free (inputs, TRUE);
+  g_free (file_list);
+
   return 0;
 }